@@ -536,6 +536,30 @@ void invariant( AList_type( Prefix ) *current )
 
 #ifdef PROTOCOLS_ENABLED
 
+/**
+   span
+
+   returns the item array for the P_Indexable protocol
+*/
+
+static
+Type *
+span( AList_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == ALIST_TYPE ) && ( (*current)._item_type = Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   // items are held in index order from the start of the array
+   Type *result = (*current).array;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
 /**
    indexable protocol function array
 */
@@ -567,7 +591,8 @@ p_indexable_table[P_INDEXABLE_FUNCTION_COUNT]
    AList_count( Prefix ),
    AList_item( Prefix ),
    AList_replace( Prefix ),
-   AList_replace_and_dispose( Prefix )
+   AList_replace_and_dispose( Prefix ),
+   span
 };
 
 static
@@ -75,6 +75,7 @@ struct node
 {
    Type value;
    int32_t balance;
+   int32_t size;
    struct node *parent;
    struct node *left;
    struct node *right;
@@ -169,6 +170,8 @@ node_make( void )
    node_t *node = ( node_t * ) calloc( 1, sizeof( node_t ) );
    CHECK( "node allocated correctly", node != NULL );
 
+   (*node).size = 1;
+
    POSTCONDITION( "node not null", node != NULL );
    return node;
 }
@@ -194,6 +197,67 @@ node_dispose( node_t **node )
    return;
 }
 
+/**
+   node_size
+
+   return the number of nodes in the subtree rooted at node
+
+   @param node the subtree root, may be NULL
+   @return the subtree size
+*/
+
+static
+int32_t
+node_size( node_t *node )
+{
+   int32_t result = 0;
+
+   if ( node != NULL )
+   {
+      result = (*node).size;
+   }
+
+   return result;
+}
+
+/**
+   update_size
+
+   recompute the subtree size of a node from its children
+
+   @param node the node to update
+*/
+
+static
+void
+update_size( node_t *node )
+{
+   (*node).size = 1 + node_size( (*node).left ) + node_size( (*node).right );
+
+   return;
+}
+
+/**
+   update_sizes_to_root
+
+   recompute the subtree sizes of a node and all of its ancestors
+
+   @param node the lowest node whose subtree changed, may be NULL
+*/
+
+static
+void
+update_sizes_to_root( node_t *node )
+{
+   while ( node != NULL )
+   {
+      update_size( node );
+      node = (*node).parent;
+   }
+
+   return;
+}
+
 /**
    has_recurse
 
@@ -489,37 +553,34 @@ static
 node_t *
 node_for_index( AVLTree_type( Prefix ) *current, int32_t index )
 {
-   int32_t i = 0;
    node_t *result = NULL;
+   int32_t left_size = 0;
 
-   // get cursor
-   AVLTree_cursor_type( Prefix ) *c
-      =  ( AVLTree_cursor_type( Prefix ) * )
-         calloc( 1, sizeof( AVLTree_cursor_type( Prefix ) ) );
-   CHECK( "c allocated correctly", c != NULL );
-
-   // set avltree in cursor
-   (*c).avltree = current;
-
-   if ( ( index < 0 ) || ( index >= (*current).count ) )
+   if ( ( index >= 0 ) && ( index < (*current).count ) )
    {
-      result = NULL;
-   }
-   else
-   {
-      // iterate to index
-      cursor_start( c );
-      result = (*c).item;
+      // descend using subtree sizes
+      result = (*current).root;
 
-      for( i = 1; i <= index; i++ )
+      while ( result != NULL )
       {
-         cursor_forth( c );
-         result = (*c).item;
+         left_size = node_size( (*result).left );
+
+         if ( index < left_size )
+         {
+            result = (*result).left;
+         }
+         else if ( index == left_size )
+         {
+            break;
+         }
+         else
+         {
+            index = index - left_size - 1;
+            result = (*result).right;
+         }
       }
    }
 
-   free( c );
-
    return result;
 }
 
@@ -530,47 +591,96 @@ node_for_index( AVLTree_type( Prefix ) *current, int32_t index )
 
    @param current the tree
    @param node the specified node
-   @return the index of the specified node
+   @return the index of the specified node, -1 if node is NULL
 */
 static
 int32_t
 index_for_node( AVLTree_type( Prefix ) *current, node_t *node )
 {
-   int32_t result = 0;
-   int32_t flag = 0;
-
-   // get cursor
-   AVLTree_cursor_type( Prefix ) *c
-      =  ( AVLTree_cursor_type( Prefix ) * )
-         calloc( 1, sizeof( AVLTree_cursor_type( Prefix ) ) );
-   CHECK( "c allocated correctly", c != NULL );
-
-   // set avltree in cursor
-   (*c).avltree = current;
+   int32_t result = -1;
+   node_t *parent = NULL;
 
-   if ( (*current).count > 0 )
+   if ( node != NULL )
    {
-      cursor_start( c );
+      // count nodes to the left of node on the way up to the root
+      result = node_size( (*node).left );
+      parent = (*node).parent;
 
-      while ( cursor_off( c ) == 0 )
+      while ( parent != NULL )
       {
-         if ( (*c).item == node )
+         if ( (*parent).right == node )
          {
-            flag = 1;
-            break;
+            result = result + node_size( (*parent).left ) + 1;
          }
-         result = result + 1;
-         cursor_forth( c );
+
+         node = parent;
+         parent = (*node).parent;
       }
    }
 
-   if ( flag == 0 )
+   return result;
+}
+
+/**
+   count_less_than
+
+   Return number of items in tree ordered before value
+
+   @param current the tree
+   @param value the value to compare to
+   @return the number of items less than value
+*/
+static
+int32_t
+count_less_than( AVLTree_type( Prefix ) *current, Type value )
+{
+   int32_t result = 0;
+   node_t *node = (*current).root;
+
+   while ( node != NULL )
    {
-      result = -1;
+      if ( ORDER_FUNCTION( value, (*node).value ) == 1 )
+      {
+         node = (*node).left;
+      }
+      else
+      {
+         result = result + node_size( (*node).left ) + 1;
+         node = (*node).right;
+      }
    }
 
-   // free c
-   free( c );
+   return result;
+}
+
+/**
+   count_less_than_or_equal
+
+   Return number of items in tree not ordered after value
+
+   @param current the tree
+   @param value the value to compare to
+   @return the number of items less than or equal to value
+*/
+static
+int32_t
+count_less_than_or_equal( AVLTree_type( Prefix ) *current, Type value )
+{
+   int32_t result = 0;
+   node_t *node = (*current).root;
+
+   while ( node != NULL )
+   {
+      if ( ORDER_FUNCTION( (*node).value, value ) == 1 )
+      {
+         result = result + node_size( (*node).left ) + 1;
+         node = (*node).right;
+      }
+      else
+      {
+         node = (*node).left;
+      }
+   }
 
    return result;
 }
@@ -974,6 +1084,9 @@ rotate_left( AVLTree_type( Prefix ) *current, node_t *node )
    (*right).balance = (*right).balance - 1;
    (*node).balance = - (*right).balance;
 
+   update_size( node );
+   update_size( right );
+
    return right;
 }
 
@@ -1023,6 +1136,9 @@ rotate_right( AVLTree_type( Prefix ) *current, node_t *node )
    (*left).balance = (*left).balance + 1;
    (*node).balance = - (*left).balance;
 
+   update_size( node );
+   update_size( left );
+
    return left;
 }
 
@@ -1100,6 +1216,10 @@ rotate_left_right( AVLTree_type( Prefix ) *current, node_t *node )
 
    ( *left_right ).balance = 0;
 
+   update_size( node );
+   update_size( left );
+   update_size( left_right );
+
    return left_right;
 }
 
@@ -1176,6 +1296,10 @@ rotate_right_left( AVLTree_type( Prefix ) *current, node_t *node )
 
    ( *right_left ).balance = 0;
 
+   update_size( node );
+   update_size( right );
+   update_size( right_left );
+
    return right_left;
 }
 
@@ -1218,6 +1342,7 @@ put( AVLTree_type( Prefix ) *current, Type value )
             {
                (*node).left = new_node;
                ( *new_node ).parent = node;
+               update_sizes_to_root( node );
                insert_balance( current, node, -1 );
                break;
             }
@@ -1234,6 +1359,7 @@ put( AVLTree_type( Prefix ) *current, Type value )
             {
                (*node).right = new_node;
                ( *new_node ).parent = node;
+               update_sizes_to_root( node );
                insert_balance( current, node, 1 );
                break;
             }
@@ -1435,12 +1561,14 @@ remove( AVLTree_type( Prefix ) *current, node_t *node )
                if ( (*parent).left == node )
                {
                   (*parent).left = NULL;
+                  update_sizes_to_root( parent );
                   delete_balance( current, parent, 1 );
                }
                // node is parent's right child
                else
                {
                   (*parent).right = NULL;
+                  update_sizes_to_root( parent );
                   delete_balance( current, parent, -1 );
                }
             }
@@ -1449,6 +1577,7 @@ remove( AVLTree_type( Prefix ) *current, node_t *node )
          else
          {
             replace_node( node, right );
+            update_sizes_to_root( node );
             delete_balance( current, node, 0 );
             node_to_delete = right;
          }
@@ -1457,6 +1586,7 @@ remove( AVLTree_type( Prefix ) *current, node_t *node )
       else if ( right == NULL )
       {
          replace_node( node, left );
+         update_sizes_to_root( node );
          delete_balance( current, node, 0 );
          node_to_delete = left;
       }
@@ -1490,6 +1620,7 @@ remove( AVLTree_type( Prefix ) *current, node_t *node )
                   (*parent).right = successor;
                }
             }
+            update_sizes_to_root( successor );
             delete_balance( current, successor, -1 );
          }
          else
@@ -1543,6 +1674,7 @@ remove( AVLTree_type( Prefix ) *current, node_t *node )
                   (*parent).right = successor;
                }
             }
+            update_sizes_to_root( successor_parent );
             delete_balance( current, successor_parent, 1 );
          }
       }
@@ -2255,6 +2387,49 @@ balance_ok( AVLTree_type( Prefix ) *p )
    return result;
 }
 
+static
+int32_t
+sizes_ok_recurse( node_t *node )
+{
+   int32_t result = 1;
+
+   result = ( (*node).size == 1 + node_size( (*node).left ) + node_size( (*node).right ) );
+
+   if ( result == 1 )
+   {
+      if ( (*node).left != NULL )
+      {
+         result = sizes_ok_recurse( (*node).left );
+      }
+   }
+
+   if ( result == 1 )
+   {
+      if ( (*node).right != NULL )
+      {
+         result = sizes_ok_recurse( (*node).right );
+      }
+   }
+
+   return result;
+}
+
+static
+int32_t
+sizes_ok( AVLTree_type( Prefix ) *p )
+{
+   int32_t result = 1;
+
+   result = ( node_size( (*p).root ) == (*p).count );
+
+   if ( ( result == 1 ) && ( (*p).root != NULL ) )
+   {
+      result = sizes_ok_recurse( (*p).root );
+   }
+
+   return result;
+}
+
 /**
    cursors_off_or_valid
 */
@@ -2373,6 +2548,7 @@ void invariant( AVLTree_type( Prefix ) *current )
    assert( ( ( void ) "cursors avltree OK", cursors_avltree_ok( current ) ) );
    assert( ( ( void ) "avltree in order", in_order( current ) ) );
    assert( ( ( void ) "avltree in balance", balance_ok( current ) ) );
+   assert( ( ( void ) "subtree sizes ok", sizes_ok( current ) ) );
    assert( ( ( void ) "cursors off or valid", cursors_off_or_valid( current ) ) );
    assert( ( ( void ) "node pointers consistent", node_pointers_consistent( current ) ) );
    return;
@@ -3255,18 +3431,11 @@ AVLTree_item( Prefix )( AVLTree_type( Prefix ) *current, int32_t index )
    INVARIANT( current );
    PRECONDITION( "index ok", ( index >= 0 ) && ( index < (*current).count ) );
 
-   int32_t i = 0;
    Type value;
 
-   cursor_start( (*current).first_cursor );
+   (*(*current).first_cursor).item = node_for_index( current, index );
    value = cursor_item_at( (*current).first_cursor );
 
-   for( i = 1; i <= index; i++ )
-   {
-      cursor_forth( (*current).first_cursor );
-      value = cursor_item_at( (*current).first_cursor );
-   }
-
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
@@ -3775,6 +3944,55 @@ AVLTree_occurrences_eq_fn( Prefix )
    return result;
 }
 
+/**
+   AVLTree_rank
+*/
+
+int32_t
+AVLTree_rank( Prefix )( AVLTree_type( Prefix ) *current, Type value )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == AVLTREE_TYPE ) && ( (*current)._item_type = Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = count_less_than( current, value );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   POSTCONDITION( "result ok", ( result >= 0 ) && ( result <= (*current).count ) );
+
+   return result;
+}
+
+/**
+   AVLTree_count_in_range
+*/
+
+int32_t
+AVLTree_count_in_range( Prefix )( AVLTree_type( Prefix ) *current, Type lo, Type hi )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == AVLTREE_TYPE ) && ( (*current)._item_type = Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   if ( ORDER_FUNCTION( lo, hi ) == 1 )
+   {
+      result = count_less_than_or_equal( current, hi ) - count_less_than( current, lo );
+   }
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   POSTCONDITION( "result ok", ( result >= 0 ) && ( result <= (*current).count ) );
+
+   return result;
+}
+
 /**
    AVLTree_search_forth
 */
@@ -3954,13 +4172,7 @@ AVLTree_cursor_go( Prefix )( AVLTree_cursor_type( Prefix ) *cursor, int32_t inde
    INVARIANT( (*cursor).avltree );
    PRECONDITION( "index ok", ( ( index >= 0 ) && ( index < ( *(*cursor).avltree ).count ) ) );
 
-   int32_t i = 0;
-   cursor_start( cursor );
-
-   for( i = 1; i <= index; i++ )
-   {
-      cursor_forth( cursor );
-   }
+   (*cursor).item = node_for_index( (*cursor).avltree, index );
 
    INVARIANT( (*cursor).avltree );
    UNLOCK( (*cursor).mutex );
@@ -4258,13 +4470,7 @@ AVLTree_go( Prefix )( AVLTree_type( Prefix ) *current, int32_t index )
    INVARIANT( current );
    PRECONDITION( "index ok", ( ( index >= 0 ) && ( index < (*current).count ) ) );
 
-   int32_t i = 0;
-   cursor_start( (*current).first_cursor );
-
-   for( i = 1; i <= index; i++ )
-   {
-      cursor_forth( (*current).first_cursor );
-   }
+   (*(*current).first_cursor).item = node_for_index( current, index );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -578,6 +578,33 @@ int32_t AVLTree_occurrences_eq_fn( Prefix )
    int32_t ( *equality_test_func )( Type v1, Type v2 )
 );
 
+/**
+   AVLTree_rank
+
+   Returns the number of items in the AVLTree_t instance that are ordered
+   before value. This is the index of the first item equal to value, if any.
+
+   @param  current AVLTree_t instance
+   @param  value the value to rank
+   @return count of items less than value
+*/
+#define AVLTree_rank( arg ) PRIMITIVE_CAT( arg, _avltree_rank )
+int32_t AVLTree_rank( Prefix )( AVLTree_type( Prefix ) *current, Type value );
+
+/**
+   AVLTree_count_in_range
+
+   Returns the number of items in the AVLTree_t instance that are ordered
+   between lo and hi, inclusive. Returns 0 if hi is ordered before lo.
+
+   @param  current AVLTree_t instance
+   @param  lo the lowest value of the range
+   @param  hi the highest value of the range
+   @return count of items in range
+*/
+#define AVLTree_count_in_range( arg ) PRIMITIVE_CAT( arg, _avltree_count_in_range )
+int32_t AVLTree_count_in_range( Prefix )( AVLTree_type( Prefix ) *current, Type lo, Type hi );
+
 /**
    AVLTree_search_forth
 
@@ -755,6 +755,33 @@ int32_t AVLTree_kv_occurrences_value_eq_fn( Prefix )
    int32_t ( *equality_test_func )( Type v1, Type v2 )
 );
 
+/**
+   AVLTree_kv_rank
+
+   Returns the number of keys in the AVLTree_kv_t instance that are ordered
+   before key. This is the index of the first key equal to key, if any.
+
+   @param  current AVLTree_kv_t instance
+   @param  key the key to rank
+   @return count of keys less than key
+*/
+#define AVLTree_kv_rank( arg ) PRIMITIVE_CAT( arg, _avltree_kv_rank )
+int32_t AVLTree_kv_rank( Prefix )( AVLTree_kv_type( Prefix ) *current, Key key );
+
+/**
+   AVLTree_kv_count_in_range
+
+   Returns the number of keys in the AVLTree_kv_t instance that are ordered
+   between lo and hi, inclusive. Returns 0 if hi is ordered before lo.
+
+   @param  current AVLTree_kv_t instance
+   @param  lo the lowest key of the range
+   @param  hi the highest key of the range
+   @return count of keys in range
+*/
+#define AVLTree_kv_count_in_range( arg ) PRIMITIVE_CAT( arg, _avltree_kv_count_in_range )
+int32_t AVLTree_kv_count_in_range( Prefix )( AVLTree_kv_type( Prefix ) *current, Key lo, Key hi );
+
 
 /*
    Cursor movement
@@ -75,6 +75,7 @@ struct node;
 struct node
 {
    Type value;
+   int32_t size;
    struct node *parent;
    struct node *left;
    struct node *right;
@@ -130,6 +131,8 @@ node_make( void )
    node_t *node = ( node_t * ) calloc( 1, sizeof( node_t ) );
    CHECK( "node not null", node != NULL );
    
+   (*node).size = 1;
+   
    return node;
 }
 
@@ -154,6 +157,45 @@ node_dispose( node_t **node )
    return;
 }
 
+/**
+   node_size
+   
+   number of nodes in subtree rooted at node, 0 for NULL
+*/
+
+static
+int32_t
+node_size( node_t *node )
+{
+   int32_t result = 0;
+   
+   if ( node != NULL )
+   {
+      result = (*node).size;
+   }
+   
+   return result;
+}
+
+/**
+   update_sizes_to_root
+   
+   recompute subtree sizes from node up to the root
+*/
+
+static
+void
+update_sizes_to_root( node_t *node )
+{
+   while ( node != NULL )
+   {
+      (*node).size = 1 + node_size( (*node).left ) + node_size( (*node).right );
+      node = (*node).parent;
+   }
+   
+   return;
+}
+
 /**
    has_recurse
 */
@@ -435,37 +477,34 @@ static
 node_t *
 node_for_index( BSTree_type( Prefix ) *current, int32_t index )
 {
-   int32_t i = 0;
    node_t *result = NULL;
+   int32_t left_size = 0;
 
-   // get cursor
-   BSTree_cursor_type( Prefix ) *c
-      =  ( BSTree_cursor_type( Prefix ) * )
-         calloc( 1, sizeof( BSTree_cursor_type( Prefix ) ) );
-   CHECK( "c allocated_correctly", c != NULL );
-   
-   // set bstree in cursor
-   (*c).bstree = current;
-
-   if ( ( index < 0 ) || ( index >= (*current).count ) )
+   if ( ( index >= 0 ) && ( index < (*current).count ) )
    {
-      result = NULL;
-   }
-   else
-   {
-      // iterate to index
-      cursor_start( c );
-      result = (*c).item;
+      // descend using subtree sizes
+      result = (*current).root;
       
-      for( i = 1; i <= index; i++ )
+      while ( result != NULL )
       {
-         cursor_forth( c );
-         result = (*c).item;
+         left_size = node_size( (*result).left );
+         
+         if ( index < left_size )
+         {
+            result = (*result).left;
+         }
+         else if ( index == left_size )
+         {
+            break;
+         }
+         else
+         {
+            index = index - left_size - 1;
+            result = (*result).right;
+         }
       }
    }
 
-   free( c );
-   
    return result;
 }
 
@@ -476,41 +515,82 @@ static
 int32_t
 index_for_node( BSTree_type( Prefix ) *current, node_t *node )
 {
-   int32_t result = 0;
-   int32_t flag = 0;
-   
-   // get cursor
-   BSTree_cursor_type( Prefix ) *c
-      =  ( BSTree_cursor_type( Prefix ) * )
-         calloc( 1, sizeof( BSTree_cursor_type( Prefix ) ) );
-   CHECK( "c allocated_correctly", c != NULL );
+   int32_t result = -1;
+   node_t *parent = NULL;
    
-   // set bstree in cursor
-   (*c).bstree = current;
-
-   if ( (*current).count > 0 )
+   if ( node != NULL )
    {
-      cursor_start( c );
+      // count nodes to the left of node on the way up to the root
+      result = node_size( (*node).left );
+      parent = (*node).parent;
       
-      while ( cursor_off( c ) == 0 )
+      while ( parent != NULL )
       {
-         if ( (*c).item == node )
+         if ( (*parent).right == node )
          {
-            flag = 1;
-            break;
+            result = result + node_size( (*parent).left ) + 1;
          }
-         result = result + 1;
-         cursor_forth( c );
+         
+         node = parent;
+         parent = (*node).parent;
       }
    }
-      
-   if ( flag == 0 )
+   
+   return result;
+}
+
+/**
+   count_less_than
+   
+   number of items ordered before value
+*/
+static
+int32_t
+count_less_than( BSTree_type( Prefix ) *current, Type value )
+{
+   int32_t result = 0;
+   node_t *node = (*current).root;
+   
+   while ( node != NULL )
    {
-      result = -1;
+      if ( ORDER_FUNCTION( value, (*node).value ) == 1 )
+      {
+         node = (*node).left;
+      }
+      else
+      {
+         result = result + node_size( (*node).left ) + 1;
+         node = (*node).right;
+      }
    }
    
-   // free c
-   free( c );
+   return result;
+}
+
+/**
+   count_less_than_or_equal
+   
+   number of items not ordered after value
+*/
+static
+int32_t
+count_less_than_or_equal( BSTree_type( Prefix ) *current, Type value )
+{
+   int32_t result = 0;
+   node_t *node = (*current).root;
+   
+   while ( node != NULL )
+   {
+      if ( ORDER_FUNCTION( (*node).value, value ) == 1 )
+      {
+         result = result + node_size( (*node).left ) + 1;
+         node = (*node).right;
+      }
+      else
+      {
+         node = (*node).left;
+      }
+   }
    
    return result;
 }
@@ -658,6 +738,9 @@ put_recurse( node_t *node, Type value )
    int32_t result = 0;
    node_t *new_node = NULL;
    
+   // value will be inserted below this node
+   (*node).size = (*node).size + 1;
+   
    // if value is inserted, exit 
       
    // in order recursion - left, self, right
@@ -830,6 +913,7 @@ swap_nodes( BSTree_type( Prefix ) *current, node_t *n1, node_t *n2 )
    int32_t n2_parent_is_left = 0;
    node_t *left = NULL;
    node_t *right = NULL;
+   int32_t size = 0;
    int32_t parent_of_n2_is_n1 = 0;
 #ifdef SWAP_GENERAL_CASE   
    int32_t parent_of_n1_is_n2 = 0;
@@ -1001,6 +1085,11 @@ swap_nodes( BSTree_type( Prefix ) *current, node_t *n1, node_t *n2 )
       (*current).root = n2;
    }
    
+   // subtree sizes stay with the positions
+   size = (*n1).size;
+   (*n1).size = (*n2).size;
+   (*n2).size = size;
+   
    return;
 }
 
@@ -1027,6 +1116,9 @@ remove_recurse( BSTree_type( Prefix ) *current, node_t *node )
          (*(*node).parent).right = NULL;
       }
       
+      // update sizes above the removed node
+      update_sizes_to_root( (*node).parent );
+      
       // and dispose of the node
       node_dispose( &node );    
      
@@ -1049,6 +1141,9 @@ remove_recurse( BSTree_type( Prefix ) *current, node_t *node )
          (*(*node).left).parent = (*node).parent;
       }
       
+      // update sizes above the removed node
+      update_sizes_to_root( (*node).parent );
+      
       // and dispose of the node
       node_dispose( &node );
       
@@ -1071,6 +1166,9 @@ remove_recurse( BSTree_type( Prefix ) *current, node_t *node )
          (*(*node).right).parent = (*node).parent;
       }
       
+      // update sizes above the removed node
+      update_sizes_to_root( (*node).parent );
+      
       // and dispose of the node
       node_dispose( &node );
       
@@ -1178,6 +1276,9 @@ remove_and_dispose_recurse( BSTree_type( Prefix ) *current, node_t *node )
       // dispose of the value
       VALUE_DEEP_DISPOSE_FUNCTION( (*node).value );
       
+      // update sizes above the removed node
+      update_sizes_to_root( (*node).parent );
+      
       // and dispose of the node
       node_dispose( &node );    
      
@@ -1203,6 +1304,9 @@ remove_and_dispose_recurse( BSTree_type( Prefix ) *current, node_t *node )
       // dispose of the value
       VALUE_DEEP_DISPOSE_FUNCTION( (*node).value );
       
+      // update sizes above the removed node
+      update_sizes_to_root( (*node).parent );
+      
       // and dispose of the node
       node_dispose( &node );
       
@@ -1228,6 +1332,9 @@ remove_and_dispose_recurse( BSTree_type( Prefix ) *current, node_t *node )
       // dispose of the value
       VALUE_DEEP_DISPOSE_FUNCTION( (*node).value );
       
+      // update sizes above the removed node
+      update_sizes_to_root( (*node).parent );
+      
       // and dispose of the node
       node_dispose( &node );
       
@@ -1567,6 +1674,28 @@ set_node_parent_pointers( BSTree_type( Prefix ) *current )
    return result;
 }
 
+/**
+   set_node_sizes_recurse
+*/
+static
+int32_t
+set_node_sizes_recurse( node_t *node ) 
+{
+   (*node).size = 1;
+   
+   if ( (*node).left != NULL )
+   {
+      (*node).size = (*node).size + set_node_sizes_recurse( (*node).left );
+   }
+   
+   if ( (*node).right != NULL )
+   {
+      (*node).size = (*node).size + set_node_sizes_recurse( (*node).right );
+   }
+
+   return (*node).size;   
+}
+
 /**
    balance
 */
@@ -1595,6 +1724,9 @@ balance( BSTree_type( Prefix ) *current )
       
       // set node parent pointers
       set_node_parent_pointers( current );
+      
+      // set subtree sizes
+      set_node_sizes_recurse( (*current).root );
    }
    
    // set root parent to NULL
@@ -2382,6 +2514,49 @@ node_pointers_consistent( BSTree_type( Prefix ) *current )
    return result;
 }
 
+static
+int32_t
+sizes_ok_recurse( node_t *node ) 
+{
+   int32_t result = 1;
+   
+   result = ( (*node).size == 1 + node_size( (*node).left ) + node_size( (*node).right ) );
+   
+   if ( result == 1 )
+   {
+      if ( (*node).left != NULL )
+      {
+         result = sizes_ok_recurse( (*node).left );
+      }
+   }
+   
+   if ( result == 1 )
+   {
+      if ( (*node).right != NULL )
+      {
+         result = sizes_ok_recurse( (*node).right );
+      }
+   }
+
+   return result;   
+}
+
+static
+int32_t
+sizes_ok( BSTree_type( Prefix ) *current )
+{
+   int32_t result = 1;
+
+   result = ( node_size( (*current).root ) == (*current).count );
+
+   if ( ( result == 1 ) && ( (*current).root != NULL ) )
+   {
+      result = sizes_ok_recurse( (*current).root );
+   }
+   
+   return result;
+}
+
 static
 void invariant( BSTree_type( Prefix ) *current )
 {
@@ -2395,6 +2570,7 @@ void invariant( BSTree_type( Prefix ) *current )
    assert(((void) "cursors bstree OK", cursors_bstree_ok( current ) ));
    assert(((void) "bstree in order", in_order( current ) ));
    assert(((void) "node pointers consistent", node_pointers_consistent( current ) ));
+   assert(((void) "subtree sizes ok", sizes_ok( current ) ));
    assert(((void) "cursors null or valid", cursors_null_or_valid( current ) ));
    return;
 }
@@ -3759,6 +3935,55 @@ BSTree_occurrences_eq_fn( Prefix )
    return result;
 }
 
+/**
+   BSTree_rank
+*/
+
+int32_t
+BSTree_rank( Prefix )( BSTree_type( Prefix ) *current, Type value )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == BSTREE_TYPE ) && ( (*current)._item_type = Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = count_less_than( current, value );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   POSTCONDITION( "result ok", ( result >= 0 ) && ( result <= (*current).count ) );
+   
+   return result;
+}
+
+/**
+   BSTree_count_in_range
+*/
+
+int32_t
+BSTree_count_in_range( Prefix )( BSTree_type( Prefix ) *current, Type lo, Type hi )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == BSTREE_TYPE ) && ( (*current)._item_type = Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+   
+   if ( ORDER_FUNCTION( lo, hi ) == 1 )
+   {
+      result = count_less_than_or_equal( current, hi ) - count_less_than( current, lo );
+   }
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   POSTCONDITION( "result ok", ( result >= 0 ) && ( result <= (*current).count ) );
+   
+   return result;
+}
+
 /**
    BSTree_search_forth
 */
@@ -3934,13 +4159,7 @@ BSTree_cursor_go( Prefix )( BSTree_cursor_type( Prefix ) *cursor, int32_t index
    INVARIANT( (*cursor).bstree );
    PRECONDITION( "index ok", ( ( index >= 0 ) && ( index < (*(*cursor).bstree).count ) ) );
 
-   int32_t i = 0;
-   cursor_start( cursor );
-
-   for( i = 1; i <= index; i++ )
-   {
-      cursor_forth( cursor );
-   }
+   (*cursor).item = node_for_index( (*cursor).bstree, index );
 
    INVARIANT( (*cursor).bstree );
    UNLOCK( (*(*cursor).bstree).mutex );
@@ -4195,13 +4414,7 @@ BSTree_go( Prefix )( BSTree_type( Prefix ) *current, int32_t index )
    INVARIANT( current );
    PRECONDITION( "index ok", ( ( index >= 0 ) && ( index < (*current).count ) ) );
 
-   int32_t i = 0;
-   cursor_start( (*current).first_cursor );
-
-   for( i = 1; i <= index; i++ )
-   {
-      cursor_forth( (*current).first_cursor );
-   }
+   (*(*current).first_cursor).item = node_for_index( current, index );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -575,6 +575,33 @@ int32_t BSTree_occurrences_eq_fn( Prefix )
    int32_t ( *equality_test_func )( Type v1, Type v2 )
 );
 
+/**
+   BSTree_rank
+
+   Returns the number of items in the BSTree_t instance that are ordered
+   before value. This is the index of the first item equal to value, if any.
+
+   @param  current BSTree_t instance
+   @param  value the value to rank
+   @return count of items less than value
+*/
+#define BSTree_rank( arg ) PRIMITIVE_CAT( arg, _bstree_rank )
+int32_t BSTree_rank( Prefix )( BSTree_type( Prefix ) *current, Type value );
+
+/**
+   BSTree_count_in_range
+
+   Returns the number of items in the BSTree_t instance that are ordered
+   between lo and hi, inclusive. Returns 0 if hi is ordered before lo.
+
+   @param  current BSTree_t instance
+   @param  lo the lowest value of the range
+   @param  hi the highest value of the range
+   @return count of items in range
+*/
+#define BSTree_count_in_range( arg ) PRIMITIVE_CAT( arg, _bstree_count_in_range )
+int32_t BSTree_count_in_range( Prefix )( BSTree_type( Prefix ) *current, Type lo, Type hi );
+
 /**
    BSTree_search_forth
 
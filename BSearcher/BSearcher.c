@@ -241,12 +241,16 @@ search
    int32_t hi = 0;
    int32_t m = 0;
    int32_t n = 0;
+   Type *array = NULL;
 
    // get direct pointer to item, put functions
    item = ( *p_indexable ).get_function( P_INDEXABLE_TYPE, P_INDEXABLE_ITEM );
 
    n = P_Indexable_count( Prefix )( p_indexable );
 
+   // read items directly if they are held in one array
+   array = P_Indexable_span( Prefix )( p_indexable );
+
    // continue until p_indexable is searched
    lo = 0;
    hi = n - 1;
@@ -263,7 +267,14 @@ search
       }
 
       // get the midpoint value
-      value = item( p_indexable, m );
+      if ( array != NULL )
+      {
+         value = array[m];
+      }
+      else
+      {
+         value = item( p_indexable, m );
+      }
 
       // compare value at midpoint to target
       if ( func( value, target ) < 0 )
@@ -0,0 +1,518 @@
+/**
+ @file main.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "benchmark of asynchronous binary file reads and writes"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+
+ @section Description
+
+ Measures random 4 KB reads spread over many files and 64 KB writes that
+ fill the files, in megabytes per second, in each directory given, by
+ default /dev/shm, which is tmpfs on linux, and the current directory,
+ which is usually on disk.
+
+ The sync rows read or write one block at a time on one thread with
+ Binary_File_go and Binary_File_read_uint8_array or
+ Binary_File_put_uint8_array. The pool rows keep queue depth requests in
+ flight on a Binary_File_async_make_thread_pool instance, and the uring
+ rows do the same on a Binary_File_async_make instance, which uses
+ io_uring where it can. The hot reads find the files in the page cache,
+ the cold reads drop them from it first with posix_fadvise, so that on
+ disk every read goes to the device.
+
+ The check column is the number of blocks whose sum differs from that of
+ the sync row, which should be zero.
+
+ usage: Binary_File_async_benchmark [files] [megabytes per file] [queue depth] [directory ...]
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+
+#include "Binary_File.h"
+#include "Binary_File_async.h"
+#include "Rng_Isaac.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEFAULT_FILE_COUNT 64
+#define DEFAULT_MEGABYTES 4
+#define DEFAULT_QUEUE_DEPTH 64
+#define READ_SIZE 4096
+#define WRITE_SIZE 65536
+#define READ_COUNT 16384
+#define THREAD_COUNT 4
+#define MIN_TIME 0.5
+
+/**
+   kinds of access timed
+*/
+
+#define KIND_SYNC 0
+#define KIND_POOL 1
+#define KIND_URING 2
+
+static char_t *kind_names[] = { "sync", "pool", "uring" };
+
+/**
+   now
+
+   @return monotonic time in seconds
+*/
+
+static
+float64_t
+now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return ( float64_t ) ts.tv_sec + ( float64_t ) ts.tv_nsec * 1.0e-9;
+}
+
+/**
+   sum_bytes
+
+   @return the sum of count bytes
+*/
+
+static
+uint32_t
+sum_bytes( uint8_t *p, int32_t count )
+{
+   int32_t i = 0;
+   uint32_t result = 0;
+
+   for ( i = 0; i < count; i++ )
+   {
+      result = result + p[i];
+   }
+
+   return result;
+}
+
+/**
+   make_async
+
+   @return an async instance of the given kind
+*/
+
+static
+binary_file_async_t *
+make_async( int32_t kind, int32_t queue_depth )
+{
+   binary_file_async_t *result = NULL;
+
+   if ( kind == KIND_POOL )
+   {
+      result = binary_file_async_make_thread_pool( queue_depth, THREAD_COUNT );
+   }
+   else
+   {
+      result = binary_file_async_make( queue_depth );
+   }
+
+   return result;
+}
+
+/**
+   open_files
+
+   open every file for reading or writing, and drop the files from the
+   page cache if is_cold is 1
+*/
+
+static
+void
+open_files( binary_file_t **files, int32_t file_count, int32_t is_write, int32_t is_cold )
+{
+   int32_t i = 0;
+
+   for ( i = 0; i < file_count; i++ )
+   {
+      if ( is_write == 1 )
+      {
+         binary_file_open_write( files[i] );
+      }
+      else
+      {
+         binary_file_open_read( files[i] );
+      }
+
+      if ( is_cold == 1 )
+      {
+         posix_fadvise( binary_file_descriptor( files[i] ), 0, 0, POSIX_FADV_DONTNEED );
+      }
+   }
+
+   return;
+}
+
+/**
+   close_files
+*/
+
+static
+void
+close_files( binary_file_t **files, int32_t file_count )
+{
+   int32_t i = 0;
+
+   for ( i = 0; i < file_count; i++ )
+   {
+      binary_file_close( files[i] );
+   }
+
+   return;
+}
+
+/**
+   read_blocks
+
+   read the blocks at the given files and offsets, leaving the sum of
+   each block in sums. The async instance is fresh, so the id of each
+   request is the index of its block.
+*/
+
+static
+void
+read_blocks
+(
+   int32_t kind,
+   binary_file_async_t *async,
+   binary_file_t **files,
+   int32_t *file_index,
+   int64_t *offsets,
+   int32_t count,
+   int32_t queue_depth,
+   raw_buffer_t **buffers,
+   uint32_t *sums
+)
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t n = 0;
+   int32_t done = 0;
+   int32_t free_count = queue_depth;
+   raw_buffer_t **free_buffers = ( raw_buffer_t ** ) calloc( queue_depth, sizeof( raw_buffer_t * ) );
+   binary_file_async_completion_t *completions
+      = ( binary_file_async_completion_t * ) calloc( queue_depth, sizeof( binary_file_async_completion_t ) );
+
+   if ( kind == KIND_SYNC )
+   {
+      for ( i = 0; i < count; i++ )
+      {
+         binary_file_go( files[ file_index[i] ], offsets[i] );
+         binary_file_read_uint8_array( files[ file_index[i] ], raw_buffer_base( buffers[0] ), READ_SIZE );
+         sums[i] = sum_bytes( raw_buffer_base( buffers[0] ), READ_SIZE );
+      }
+   }
+   else
+   {
+      memcpy( free_buffers, buffers, queue_depth * sizeof( raw_buffer_t * ) );
+
+      // keep the queue full, collect whatever has completed
+      while ( done < count )
+      {
+         while ( ( i < count ) && ( free_count > 0 ) )
+         {
+            free_count = free_count - 1;
+            binary_file_async_read( async, files[ file_index[i] ], free_buffers[free_count], offsets[i] );
+            i = i + 1;
+         }
+
+         n = binary_file_async_wait( async, completions, 1, queue_depth );
+
+         for ( j = 0; j < n; j++ )
+         {
+            sums[ completions[j].id ] = sum_bytes( raw_buffer_base( completions[j].buffer ), READ_SIZE );
+            free_buffers[free_count] = completions[j].buffer;
+            free_count = free_count + 1;
+         }
+
+         done = done + n;
+      }
+   }
+
+   free( free_buffers );
+   free( completions );
+
+   return;
+}
+
+/**
+   write_blocks
+
+   fill every file with blocks of WRITE_SIZE bytes from buffer
+*/
+
+static
+void
+write_blocks
+(
+   int32_t kind,
+   binary_file_async_t *async,
+   binary_file_t **files,
+   int32_t file_count,
+   int32_t block_count,
+   int32_t queue_depth,
+   raw_buffer_t *buffer
+)
+{
+   int32_t i = 0;
+   int32_t count = file_count * block_count;
+   int32_t done = 0;
+   binary_file_async_completion_t *completions
+      = ( binary_file_async_completion_t * ) calloc( queue_depth, sizeof( binary_file_async_completion_t ) );
+
+   if ( kind == KIND_SYNC )
+   {
+      for ( i = 0; i < count; i++ )
+      {
+         binary_file_put_uint8_array( files[ i / block_count ], raw_buffer_base( buffer ), WRITE_SIZE );
+      }
+   }
+   else
+   {
+      // every write is of the same buffer, so only the count in flight matters
+      while ( done < count )
+      {
+         while ( ( i < count ) && ( binary_file_async_is_full( async ) == 0 ) )
+         {
+            binary_file_async_write( async, files[ i / block_count ], buffer, ( int64_t ) ( i % block_count ) * WRITE_SIZE );
+            i = i + 1;
+         }
+
+         done = done + binary_file_async_wait( async, completions, 1, queue_depth );
+      }
+   }
+
+   free( completions );
+
+   return;
+}
+
+/**
+   report
+*/
+
+static
+void
+report( char_t *name, int32_t kind, float64_t rate, float64_t rate_base, int32_t check )
+{
+   printf
+   (
+      "   %-10s %-5s %9.1f MB/s   speedup %6.2f   (check %d)\n",
+      name,
+      kind_names[kind],
+      rate,
+      rate / rate_base,
+      check
+   );
+
+   return;
+}
+
+/**
+   bench_directory
+*/
+
+static
+void
+bench_directory( char_t *directory, int32_t file_count, int32_t megabytes, int32_t queue_depth )
+{
+   int32_t i = 0;
+   int32_t n = 0;
+   int32_t kind = 0;
+   int32_t is_cold = 0;
+   int32_t check = 0;
+   int32_t file_size = megabytes * 1048576;
+   int32_t block_count = file_size / WRITE_SIZE;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+   char_t name[4096];
+   float64_t t = 0.0;
+   float64_t rate = 0.0;
+   float64_t rate_base = 0.0;
+   binary_file_t **files = ( binary_file_t ** ) calloc( file_count, sizeof( binary_file_t * ) );
+   raw_buffer_t **buffers = ( raw_buffer_t ** ) calloc( queue_depth, sizeof( raw_buffer_t * ) );
+   raw_buffer_t *write_buffer = raw_buffer_make( WRITE_SIZE );
+   int32_t *file_index = ( int32_t * ) calloc( READ_COUNT, sizeof( int32_t ) );
+   int64_t *offsets = ( int64_t * ) calloc( READ_COUNT, sizeof( int64_t ) );
+   uint32_t *sums = ( uint32_t * ) calloc( READ_COUNT, sizeof( uint32_t ) );
+   uint32_t *sums_base = ( uint32_t * ) calloc( READ_COUNT, sizeof( uint32_t ) );
+   binary_file_async_t *async = NULL;
+
+   for ( i = 0; i < file_count; i++ )
+   {
+      snprintf( name, sizeof( name ), "%s/Binary_File_async_benchmark_%d.bin", directory, i );
+      files[i] = binary_file_make_cstring( name );
+   }
+
+   for ( i = 0; i < queue_depth; i++ )
+   {
+      buffers[i] = raw_buffer_make( READ_SIZE );
+   }
+
+   for ( i = 0; i < WRITE_SIZE; i++ )
+   {
+      raw_buffer_put_uint8( write_buffer, ( uint8_t ) ( i * 7 + ( i >> 8 ) ), i );
+   }
+
+   // random blocks of random files, on block boundaries
+   for ( i = 0; i < READ_COUNT; i++ )
+   {
+      file_index[i] = ( int32_t ) ( ( uint64_t ) rng_isaac_u32_item( rng ) * file_count >> 32 );
+      rng_isaac_forth( rng );
+      offsets[i] = ( int64_t ) ( ( uint64_t ) rng_isaac_u32_item( rng ) * ( file_size / READ_SIZE ) >> 32 ) * READ_SIZE;
+      rng_isaac_forth( rng );
+   }
+
+   printf( "\n%s: %d files of %d MB, queue depth %d\n", directory, file_count, megabytes, queue_depth );
+
+   for ( kind = KIND_SYNC; kind <= KIND_URING; kind++ )
+   {
+      t = now();
+      n = 0;
+      while ( ( n == 0 ) || ( now() - t < MIN_TIME ) )
+      {
+         async = ( kind == KIND_SYNC ) ? NULL : make_async( kind, queue_depth );
+         open_files( files, file_count, 1, 0 );
+         write_blocks( kind, async, files, file_count, block_count, queue_depth, write_buffer );
+         close_files( files, file_count );
+         if ( async != NULL )
+         {
+            binary_file_async_dispose( &async );
+         }
+         n = n + 1;
+      }
+      rate = ( float64_t ) file_count * file_size * n / ( now() - t ) / 1.0e6;
+
+      if ( kind == KIND_SYNC )
+      {
+         rate_base = rate;
+      }
+
+      report( "write", kind, rate, rate_base, 0 );
+   }
+
+   for ( is_cold = 0; is_cold <= 1; is_cold++ )
+   {
+      for ( kind = KIND_SYNC; kind <= KIND_URING; kind++ )
+      {
+         t = now();
+         n = 0;
+         while ( ( n == 0 ) || ( now() - t < MIN_TIME ) )
+         {
+            async = ( kind == KIND_SYNC ) ? NULL : make_async( kind, queue_depth );
+            open_files( files, file_count, 0, is_cold );
+            read_blocks( kind, async, files, file_index, offsets, READ_COUNT, queue_depth, buffers, ( kind == KIND_SYNC ) ? sums_base : sums );
+            close_files( files, file_count );
+            if ( async != NULL )
+            {
+               binary_file_async_dispose( &async );
+            }
+            n = n + 1;
+         }
+         rate = ( float64_t ) READ_COUNT * READ_SIZE * n / ( now() - t ) / 1.0e6;
+
+         if ( kind == KIND_SYNC )
+         {
+            rate_base = rate;
+            memcpy( sums, sums_base, READ_COUNT * sizeof( uint32_t ) );
+         }
+
+         check = 0;
+         for ( i = 0; i < READ_COUNT; i++ )
+         {
+            if ( sums[i] != sums_base[i] )
+            {
+               check = check + 1;
+            }
+         }
+
+         report( ( is_cold == 1 ) ? "read cold" : "read hot", kind, rate, rate_base, check );
+      }
+   }
+
+   for ( i = 0; i < file_count; i++ )
+   {
+      binary_file_delete( files[i] );
+      binary_file_dispose( &files[i] );
+   }
+
+   for ( i = 0; i < queue_depth; i++ )
+   {
+      raw_buffer_deep_dispose( &buffers[i] );
+   }
+
+   raw_buffer_deep_dispose( &write_buffer );
+
+   free( files );
+   free( buffers );
+   free( file_index );
+   free( offsets );
+   free( sums );
+   free( sums_base );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+int
+main( int argc, char **argv )
+{
+   int32_t i = 0;
+   int32_t file_count = DEFAULT_FILE_COUNT;
+   int32_t megabytes = DEFAULT_MEGABYTES;
+   int32_t queue_depth = DEFAULT_QUEUE_DEPTH;
+
+   if ( argc > 1 )
+   {
+      file_count = atoi( argv[1] );
+   }
+
+   if ( argc > 2 )
+   {
+      megabytes = atoi( argv[2] );
+   }
+
+   if ( argc > 3 )
+   {
+      queue_depth = atoi( argv[3] );
+   }
+
+   if ( argc > 4 )
+   {
+      for ( i = 4; i < argc; i++ )
+      {
+         bench_directory( argv[i], file_count, megabytes, queue_depth );
+      }
+   }
+   else
+   {
+      bench_directory( "/dev/shm", file_count, megabytes, queue_depth );
+      bench_directory( ".", file_count, megabytes, queue_depth );
+   }
+
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
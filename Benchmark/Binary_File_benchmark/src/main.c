@@ -0,0 +1,374 @@
+/**
+ @file main.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "benchmark of binary file array reads and puts"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+
+ @section Description
+
+ Measures writing and reading a file of int32_t and float64_t items, in
+ megabytes per second.
+
+ The item rows put or read one item per Binary_File call, in native and
+ in big endian byte order. The buffered rows do the same after
+ Binary_File_set_buffer_size gives the file a 1 MB buffer. The array rows
+ put or read the items in arrays of the given length with the array
+ functions.
+
+ The check column is the number of items read that differ from those
+ written, which should be zero.
+
+ usage: Binary_File_benchmark [megabytes] [array length] [file name]
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "Binary_File.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEFAULT_MEGABYTES 64
+#define DEFAULT_ARRAY_LENGTH 65536
+#define DEFAULT_FILE_NAME "Binary_File_benchmark.bin"
+#define BUFFER_SIZE ( 1 << 20 )
+
+/**
+   kinds of access timed
+*/
+
+#define KIND_ITEM 0
+#define KIND_ITEM_BE 1
+#define KIND_BUFFERED 2
+#define KIND_BUFFERED_BE 3
+#define KIND_ARRAY 4
+#define KIND_ARRAY_BE 5
+
+static char_t *kind_names[] = { "item", "item be", "buffered", "buffered be", "array", "array be" };
+
+/**
+   types of item timed
+*/
+
+#define TYPE_INT32 0
+#define TYPE_FLOAT64 1
+
+static char_t *type_names[] = { "int32", "float64" };
+static int32_t type_sizes[] = { 4, 8 };
+
+/**
+   now
+
+   @return monotonic time in seconds
+*/
+
+static
+float64_t
+now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return ( float64_t ) ts.tv_sec + ( float64_t ) ts.tv_nsec * 1.0e-9;
+}
+
+/**
+   put_items
+
+   write count items from values with the given kind of access
+*/
+
+static
+void
+put_items( binary_file_t *file, int32_t kind, int32_t type, void *values, int32_t count, int32_t array_length )
+{
+   int32_t i = 0;
+   int32_t n = 0;
+   int32_t *pi = ( int32_t * ) values;
+   float64_t *pf = ( float64_t * ) values;
+   int32_t is_be = ( kind == KIND_ITEM_BE ) || ( kind == KIND_BUFFERED_BE ) || ( kind == KIND_ARRAY_BE );
+
+   if ( ( kind == KIND_ARRAY ) || ( kind == KIND_ARRAY_BE ) )
+   {
+      for ( i = 0; i < count; i = i + array_length )
+      {
+         n = ( count - i < array_length ) ? count - i : array_length;
+
+         if ( type == TYPE_INT32 )
+         {
+            if ( is_be == 1 )
+            {
+               binary_file_put_int32_array_be( file, &pi[i], n );
+            }
+            else
+            {
+               binary_file_put_int32_array( file, &pi[i], n );
+            }
+         }
+         else
+         {
+            if ( is_be == 1 )
+            {
+               binary_file_put_float64_array_be( file, &pf[i], n );
+            }
+            else
+            {
+               binary_file_put_float64_array( file, &pf[i], n );
+            }
+         }
+      }
+   }
+   else
+   {
+      for ( i = 0; i < count; i++ )
+      {
+         if ( type == TYPE_INT32 )
+         {
+            if ( is_be == 1 )
+            {
+               binary_file_put_int32_be( file, pi[i] );
+            }
+            else
+            {
+               binary_file_put_int32( file, pi[i] );
+            }
+         }
+         else
+         {
+            if ( is_be == 1 )
+            {
+               binary_file_put_float64_be( file, pf[i] );
+            }
+            else
+            {
+               binary_file_put_float64( file, pf[i] );
+            }
+         }
+      }
+   }
+
+   return;
+}
+
+/**
+   read_items
+
+   read count items into values with the given kind of access
+*/
+
+static
+void
+read_items( binary_file_t *file, int32_t kind, int32_t type, void *values, int32_t count, int32_t array_length )
+{
+   int32_t i = 0;
+   int32_t n = 0;
+   int32_t *pi = ( int32_t * ) values;
+   float64_t *pf = ( float64_t * ) values;
+   int32_t is_be = ( kind == KIND_ITEM_BE ) || ( kind == KIND_BUFFERED_BE ) || ( kind == KIND_ARRAY_BE );
+
+   if ( ( kind == KIND_ARRAY ) || ( kind == KIND_ARRAY_BE ) )
+   {
+      for ( i = 0; i < count; i = i + array_length )
+      {
+         n = ( count - i < array_length ) ? count - i : array_length;
+
+         if ( type == TYPE_INT32 )
+         {
+            if ( is_be == 1 )
+            {
+               binary_file_read_int32_array_be( file, &pi[i], n );
+            }
+            else
+            {
+               binary_file_read_int32_array( file, &pi[i], n );
+            }
+         }
+         else
+         {
+            if ( is_be == 1 )
+            {
+               binary_file_read_float64_array_be( file, &pf[i], n );
+            }
+            else
+            {
+               binary_file_read_float64_array( file, &pf[i], n );
+            }
+         }
+      }
+   }
+   else
+   {
+      for ( i = 0; i < count; i++ )
+      {
+         if ( type == TYPE_INT32 )
+         {
+            if ( is_be == 1 )
+            {
+               pi[i] = binary_file_read_int32_be( file );
+            }
+            else
+            {
+               pi[i] = binary_file_read_int32( file );
+            }
+         }
+         else
+         {
+            if ( is_be == 1 )
+            {
+               pf[i] = binary_file_read_float64_be( file );
+            }
+            else
+            {
+               pf[i] = binary_file_read_float64( file );
+            }
+         }
+      }
+   }
+
+   return;
+}
+
+/**
+   bench_type
+*/
+
+static
+void
+bench_type( int32_t type, int32_t megabytes, int32_t array_length, char_t *file_name )
+{
+   int32_t i = 0;
+   int32_t kind = 0;
+   int32_t check = 0;
+   int32_t size = type_sizes[type];
+   int32_t count = ( int32_t ) ( ( int64_t ) megabytes * 1000000 / size );
+   float64_t t = 0.0;
+   float64_t rate_put = 0.0;
+   float64_t rate_read = 0.0;
+   float64_t rate_put_base = 0.0;
+   float64_t rate_read_base = 0.0;
+   uint8_t *values = ( uint8_t * ) calloc( count, size );
+   uint8_t *values_read = ( uint8_t * ) calloc( count, size );
+   binary_file_t *file = binary_file_make_cstring( file_name );
+
+   for ( i = 0; i < count; i++ )
+   {
+      if ( type == TYPE_INT32 )
+      {
+         ( ( int32_t * ) values )[i] = i * 7 - 1000;
+      }
+      else
+      {
+         ( ( float64_t * ) values )[i] = i * 0.5 - 1000.0;
+      }
+   }
+
+   for ( kind = KIND_ITEM; kind <= KIND_ARRAY_BE; kind++ )
+   {
+      if ( ( kind == KIND_BUFFERED ) || ( kind == KIND_BUFFERED_BE ) )
+      {
+         binary_file_set_buffer_size( file, BUFFER_SIZE );
+      }
+      else
+      {
+         binary_file_set_buffer_size( file, 0 );
+      }
+
+      t = now();
+      binary_file_open_write( file );
+      put_items( file, kind, type, values, count, array_length );
+      binary_file_close( file );
+      rate_put = ( float64_t ) count * size / ( now() - t ) / 1.0e6;
+
+      memset( values_read, 0, ( int64_t ) count * size );
+
+      t = now();
+      binary_file_open_read( file );
+      read_items( file, kind, type, values_read, count, array_length );
+      binary_file_close( file );
+      rate_read = ( float64_t ) count * size / ( now() - t ) / 1.0e6;
+
+      if ( kind == KIND_ITEM )
+      {
+         rate_put_base = rate_put;
+         rate_read_base = rate_read;
+      }
+
+      check = 0;
+      for ( i = 0; i < count; i++ )
+      {
+         if ( memcmp( &values[ ( int64_t ) i * size ], &values_read[ ( int64_t ) i * size ], size ) != 0 )
+         {
+            check = check + 1;
+         }
+      }
+
+      printf
+      (
+         "   %-7s %-11s put %9.1f MB/s  speedup %6.2f   read %9.1f MB/s  speedup %6.2f   (check %d)\n",
+         type_names[type],
+         kind_names[kind],
+         rate_put,
+         rate_put / rate_put_base,
+         rate_read,
+         rate_read / rate_read_base,
+         check
+      );
+   }
+
+   binary_file_delete( file );
+   binary_file_dispose( &file );
+
+   free( values );
+   free( values_read );
+
+   return;
+}
+
+int
+main( int argc, char **argv )
+{
+   int32_t megabytes = DEFAULT_MEGABYTES;
+   int32_t array_length = DEFAULT_ARRAY_LENGTH;
+   char_t *file_name = DEFAULT_FILE_NAME;
+
+   if ( argc > 1 )
+   {
+      megabytes = atoi( argv[1] );
+   }
+
+   if ( argc > 2 )
+   {
+      array_length = atoi( argv[2] );
+   }
+
+   if ( argc > 3 )
+   {
+      file_name = argv[3];
+   }
+
+   printf( "\nwrite and read %d MB, arrays of %d items\n", megabytes, array_length );
+
+   bench_type( TYPE_INT32, megabytes, array_length, file_name );
+   bench_type( TYPE_FLOAT64, megabytes, array_length, file_name );
+
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,28 @@
+#!lua
+
+local name = "Binary_File_mmap_benchmark"
+
+-- A solution contains projects, and defines the available configurations
+solution( name )
+   configurations { "Release", "Debug" }
+   location "build"
+
+   -- A project defines one build target
+   project( name )
+      kind "ConsoleApp"
+      language "C"
+      files { "src/*.c", "../../base/*.c", "../../Binary_File/*.c", "../../Protocol_Base/*.c", "../../String/*.c", "../../Raw_Buffer/*.c", "../../Rng_Isaac/Rng_Isaac.c" }
+      links { "m", "rt", "pthread" }
+      includedirs { "src", "../../base", "../../dbc", "../../Rng_Isaac", "../../Binary_File", "../../Protocol_Base", "../../P_Indexable", "../../P_Iterable", "../../P_Iterable_kv", "../../P_DIterable", "../../P_DIterable_kv", "../../P_Clonable", "../../P_Searcher", "../../P_Sorter", "../../String", "../../Raw_Buffer" }
+
+      -- A configuration defines one way a project can be built
+      configuration "Release"
+         defines { "NDEBUG" }
+         flags { "Optimize" }
+         buildoptions { "-O2", "-march=native" }
+
+      configuration "Debug"
+         defines { "DEBUG" }
+         flags { "Symbols" }
+         buildoptions { "-O0", "-g3", "-Wall" }
+
@@ -0,0 +1,327 @@
+/**
+ @file main.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "benchmark of mapped binary file reads"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+
+ @section Description
+
+ Measures reading a file in blocks and summing their bytes, in megabytes
+ per second, reading the blocks in order and in a pseudo random order.
+
+ The raw buffer row reads each block into a new raw buffer with
+ Binary_File_read_raw_buffer, and the bytes row reads each block into a
+ new array with Binary_File_read_bytes. The view rows open the file with
+ Binary_File_make_mmap_read and view each block in the mapping with
+ Binary_File_read_raw_buffer_view or Binary_File_raw_buffer_view, which
+ copy nothing, after Binary_File_advise gives the matching access hint.
+ The file is in the page cache for every row.
+
+ The check column is the number of blocks whose sum differs from that of
+ the raw buffer row, which should be zero.
+
+ usage: Binary_File_mmap_benchmark [megabytes] [block size] [file name]
+
+ The block size must be a multiple of 16.
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "Binary_File.h"
+#include "Rng_Isaac.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEFAULT_MEGABYTES 256
+#define DEFAULT_BLOCK_SIZE 4096
+#define DEFAULT_FILE_NAME "Binary_File_mmap_benchmark.bin"
+#define MIN_TIME 0.5
+#define LANE_COUNT 16
+
+/**
+   kinds of read timed
+*/
+
+#define KIND_RAW_BUFFER 0
+#define KIND_BYTES 1
+#define KIND_VIEW 2
+
+static char_t *kind_names[] = { "raw buffer", "bytes", "view" };
+
+/**
+   now
+
+   @return monotonic time in seconds
+*/
+
+static
+float64_t
+now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return ( float64_t ) ts.tv_sec + ( float64_t ) ts.tv_nsec * 1.0e-9;
+}
+
+/**
+   sum_bytes
+
+   @return the sum of count bytes, count a multiple of LANE_COUNT, in
+   fixed length runs that the compiler turns into SIMD adds
+*/
+
+static
+uint32_t
+sum_bytes( uint8_t *p, int32_t count )
+{
+   int32_t i = 0;
+   int32_t k = 0;
+   uint32_t lanes[LANE_COUNT] = { 0 };
+   uint32_t result = 0;
+
+   for ( i = 0; i < count; i = i + LANE_COUNT )
+   {
+      for ( k = 0; k < LANE_COUNT; k++ )
+      {
+         lanes[k] = lanes[k] + p[i + k];
+      }
+   }
+
+   for ( k = 0; k < LANE_COUNT; k++ )
+   {
+      result = result + lanes[k];
+   }
+
+   return result;
+}
+
+/**
+   read_blocks
+
+   read the blocks in the order given by order, leaving the sum of each
+   block in sums
+*/
+
+static
+void
+read_blocks
+(
+   int32_t kind,
+   binary_file_t *file,
+   int32_t *order,
+   int32_t block_count,
+   int32_t block_size,
+   uint32_t *sums
+)
+{
+   int32_t i = 0;
+   int64_t offset = 0;
+   uint8_t *bytes = NULL;
+   raw_buffer_t *raw_buffer = NULL;
+
+   for ( i = 0; i < block_count; i++ )
+   {
+      offset = ( int64_t ) order[i] * block_size;
+
+      if ( kind == KIND_RAW_BUFFER )
+      {
+         binary_file_go( file, offset );
+         raw_buffer = binary_file_read_raw_buffer( file, block_size );
+         sums[ order[i] ] = sum_bytes( raw_buffer_base( raw_buffer ), block_size );
+         raw_buffer_deep_dispose( &raw_buffer );
+      }
+      else if ( kind == KIND_BYTES )
+      {
+         binary_file_go( file, offset );
+         bytes = binary_file_read_bytes( file, block_size );
+         sums[ order[i] ] = sum_bytes( bytes, block_size );
+         free( bytes );
+      }
+      else if ( order[i] == i )
+      {
+         // blocks in order are viewed from the current position
+         raw_buffer = binary_file_read_raw_buffer_view( file, block_size );
+         sums[ order[i] ] = sum_bytes( raw_buffer_base( raw_buffer ), block_size );
+         raw_buffer_deep_dispose( &raw_buffer );
+      }
+      else
+      {
+         raw_buffer = binary_file_raw_buffer_view( file, offset, block_size );
+         sums[ order[i] ] = sum_bytes( raw_buffer_base( raw_buffer ), block_size );
+         raw_buffer_deep_dispose( &raw_buffer );
+      }
+   }
+
+   return;
+}
+
+/**
+   bench_order
+*/
+
+static
+void
+bench_order( int32_t is_random, int32_t megabytes, int32_t block_size, char_t *file_name )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t t = 0;
+   int32_t n = 0;
+   int32_t kind = 0;
+   int32_t check = 0;
+   int32_t block_count = ( int32_t ) ( ( int64_t ) megabytes * 1000000 / block_size );
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+   float64_t start = 0.0;
+   float64_t rate = 0.0;
+   float64_t rate_base = 0.0;
+   int32_t *order = ( int32_t * ) calloc( block_count, sizeof( int32_t ) );
+   uint32_t *sums = ( uint32_t * ) calloc( block_count, sizeof( uint32_t ) );
+   uint32_t *sums_base = ( uint32_t * ) calloc( block_count, sizeof( uint32_t ) );
+   binary_file_t *file = NULL;
+
+   for ( i = 0; i < block_count; i++ )
+   {
+      order[i] = i;
+   }
+
+   // shuffle the blocks for random access
+   for ( i = block_count - 1; ( is_random == 1 ) && ( i > 0 ); i-- )
+   {
+      j = ( int32_t ) ( ( uint64_t ) rng_isaac_u32_item( rng ) * ( i + 1 ) >> 32 );
+      rng_isaac_forth( rng );
+      t = order[i];
+      order[i] = order[j];
+      order[j] = t;
+   }
+
+   for ( kind = KIND_RAW_BUFFER; kind <= KIND_VIEW; kind++ )
+   {
+      memset( sums, 0, block_count * sizeof( uint32_t ) );
+
+      start = now();
+      n = 0;
+      while ( ( n == 0 ) || ( now() - start < MIN_TIME ) )
+      {
+         if ( kind == KIND_VIEW )
+         {
+            file = binary_file_make_mmap_read_cstring( file_name );
+            binary_file_advise( file, ( is_random == 1 ) ? BINARY_FILE_ADVICE_RANDOM : BINARY_FILE_ADVICE_SEQUENTIAL );
+         }
+         else
+         {
+            file = binary_file_make_open_read_cstring( file_name );
+         }
+
+         read_blocks( kind, file, order, block_count, block_size, ( kind == KIND_RAW_BUFFER ) ? sums_base : sums );
+
+         binary_file_dispose( &file );
+         n = n + 1;
+      }
+      rate = ( float64_t ) block_count * block_size * n / ( now() - start ) / 1.0e6;
+
+      if ( kind == KIND_RAW_BUFFER )
+      {
+         rate_base = rate;
+         memcpy( sums, sums_base, block_count * sizeof( uint32_t ) );
+      }
+
+      check = 0;
+      for ( i = 0; i < block_count; i++ )
+      {
+         if ( sums[i] != sums_base[i] )
+         {
+            check = check + 1;
+         }
+      }
+
+      printf
+      (
+         "   %-6s %-10s %9.1f MB/s   speedup %6.2f   (check %d)\n",
+         ( is_random == 1 ) ? "random" : "order",
+         kind_names[kind],
+         rate,
+         rate / rate_base,
+         check
+      );
+   }
+
+   free( order );
+   free( sums );
+   free( sums_base );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+int
+main( int argc, char **argv )
+{
+   int32_t i = 0;
+   int32_t megabytes = DEFAULT_MEGABYTES;
+   int32_t block_size = DEFAULT_BLOCK_SIZE;
+   int32_t count = 0;
+   char_t *file_name = DEFAULT_FILE_NAME;
+   uint8_t *bytes = NULL;
+   binary_file_t *file = NULL;
+
+   if ( argc > 1 )
+   {
+      megabytes = atoi( argv[1] );
+   }
+
+   if ( argc > 2 )
+   {
+      block_size = atoi( argv[2] );
+   }
+
+   if ( argc > 3 )
+   {
+      file_name = argv[3];
+   }
+
+   // write the file, which leaves it in the page cache
+   count = ( int32_t ) ( ( int64_t ) megabytes * 1000000 / block_size ) * block_size;
+   bytes = ( uint8_t * ) calloc( count, sizeof( uint8_t ) );
+   for ( i = 0; i < count; i++ )
+   {
+      bytes[i] = ( uint8_t ) ( i * 7 + ( i >> 12 ) );
+   }
+
+   file = binary_file_make_cstring( file_name );
+   binary_file_open_write( file );
+   binary_file_put_uint8_array( file, bytes, count );
+   binary_file_close( file );
+   free( bytes );
+
+   printf( "\nread %d MB in blocks of %d bytes\n", megabytes, block_size );
+
+   bench_order( 0, megabytes, block_size, file_name );
+   bench_order( 1, megabytes, block_size, file_name );
+
+   binary_file_delete( file );
+   binary_file_dispose( &file );
+
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
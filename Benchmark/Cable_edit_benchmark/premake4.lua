@@ -0,0 +1,28 @@
+#!lua
+
+local name = "Cable_edit_benchmark"
+
+-- A solution contains projects, and defines the available configurations
+solution( name )
+   configurations { "Release", "Debug" }
+   location "build"
+
+   -- A project defines one build target
+   project( name )
+      kind "ConsoleApp"
+      language "C"
+      files { "src/*.c", "../../Cable/*.c", "../../Rng_Isaac/Rng_Isaac.c" }
+      links { "m", "rt", "pthread" }
+      includedirs { "src", "../../base", "../../dbc", "../../Rng_Isaac", "../../Cable" }
+
+      -- A configuration defines one way a project can be built
+      configuration "Release"
+         defines { "NDEBUG" }
+         flags { "Optimize" }
+         buildoptions { "-O2" }
+
+      configuration "Debug"
+         defines { "DEBUG" }
+         flags { "Symbols" }
+         buildoptions { "-O0", "-g3", "-Wall" }
+
@@ -0,0 +1,271 @@
+/**
+ @file main.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "benchmark of random cable_t edits against document size"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+
+ @section Description
+
+ Measures the cost of small random edits - inserting a short string or
+ removing a short substring at a random position, plus a read of one
+ character - in documents of growing size.
+
+ The cable rows use cable_insert_cstring, cable_remove_substring and
+ cable_item. Nodes carry subtree character weights, so each edit should
+ cost about the same whatever the document size. The flat rows do the
+ same edits on a single character array with memmove, whose cost grows
+ with the document size, as a reference.
+
+ usage: Cable_edit_benchmark [edits per size]
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "Cable.h"
+#include "Rng_Isaac.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEFAULT_EDITS 200000
+#define SIZE_COUNT 5
+#define MAX_INSERT 16
+#define MAX_REMOVE 16
+
+static int32_t sizes[SIZE_COUNT] = { 65536, 262144, 1048576, 4194304, 16777216 };
+
+/**
+   now
+
+   @return monotonic time in seconds
+*/
+
+static
+float64_t
+now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return ( float64_t ) ts.tv_sec + ( float64_t ) ts.tv_nsec * 1.0e-9;
+}
+
+/**
+   next_value
+
+   pseudo random value from an rng
+*/
+
+static
+int32_t
+next_value( rng_isaac_t *rng )
+{
+   int32_t result = ( int32_t ) ( rng_isaac_u32_item( rng ) >> 1 );
+
+   rng_isaac_forth( rng );
+
+   return result;
+}
+
+/**
+   make_document
+
+   @return a string of size random lower case letters
+*/
+
+static
+char_t *
+make_document( int32_t size )
+{
+   int32_t i = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 4321 );
+   char_t *result = ( char_t * ) calloc( size + 1, sizeof( char_t ) );
+
+   for ( i = 0; i < size; i++ )
+   {
+      result[i] = 'a' + next_value( rng ) % 26;
+   }
+
+   rng_isaac_dispose( &rng );
+
+   return result;
+}
+
+/**
+   report
+*/
+
+static
+void
+report( char_t *name, int32_t size, int32_t edits, float64_t t, int32_t check )
+{
+   printf
+   (
+      "   %-6s size %9d %10.3f us/edit %12.0f edits/s   (check %d)\n",
+      name,
+      size,
+      t * 1.0e6 / edits,
+      edits / t,
+      check
+   );
+
+   return;
+}
+
+/**
+   run_cable
+
+   random inserts and removes in a cable, document size stays near size
+*/
+
+static
+void
+run_cable( char_t *document, int32_t size, int32_t edits )
+{
+   int32_t i = 0;
+   int32_t n = 0;
+   int32_t index = 0;
+   int32_t length = 0;
+   int32_t check = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+   char_t s[MAX_INSERT + 1] = {0};
+   float64_t t = 0.0;
+   cable_t *cable = cable_make_from_cstring( document );
+
+   memset( s, 'x', MAX_INSERT );
+
+   t = now();
+
+   for ( i = 0; i < edits; i++ )
+   {
+      length = cable_count( cable );
+
+      if ( ( i & 1 ) == 0 )
+      {
+         n = 1 + next_value( rng ) % MAX_INSERT;
+         index = next_value( rng ) % length;
+         cable_insert_cstring( cable, &s[MAX_INSERT - n], index );
+      }
+      else
+      {
+         n = 1 + next_value( rng ) % MAX_REMOVE;
+         index = next_value( rng ) % ( length - n );
+         cable_remove_substring( cable, index, index + n - 1 );
+      }
+
+      check = check + cable_item( cable, next_value( rng ) % cable_count( cable ) );
+   }
+
+   t = now() - t;
+
+   report( "cable", size, edits, t, check );
+
+   cable_dispose( &cable );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+/**
+   run_flat
+
+   the same edits in a flat character array
+*/
+
+static
+void
+run_flat( char_t *document, int32_t size, int32_t edits )
+{
+   int32_t i = 0;
+   int32_t n = 0;
+   int32_t index = 0;
+   int32_t length = size;
+   int32_t check = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+   char_t s[MAX_INSERT + 1] = {0};
+   float64_t t = 0.0;
+   char_t *flat = ( char_t * ) calloc( size + MAX_INSERT * edits + 1, sizeof( char_t ) );
+
+   memcpy( flat, document, size );
+   memset( s, 'x', MAX_INSERT );
+
+   t = now();
+
+   for ( i = 0; i < edits; i++ )
+   {
+      if ( ( i & 1 ) == 0 )
+      {
+         n = 1 + next_value( rng ) % MAX_INSERT;
+         index = next_value( rng ) % length;
+         memmove( &flat[index + n], &flat[index], length - index );
+         memcpy( &flat[index], &s[MAX_INSERT - n], n );
+         length = length + n;
+      }
+      else
+      {
+         n = 1 + next_value( rng ) % MAX_REMOVE;
+         index = next_value( rng ) % ( length - n );
+         memmove( &flat[index], &flat[index + n], length - index - n );
+         length = length - n;
+      }
+
+      check = check + flat[ next_value( rng ) % length ];
+   }
+
+   t = now() - t;
+
+   report( "flat", size, edits, t, check );
+
+   free( flat );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+int
+main( int argc, char **argv )
+{
+   int32_t edits = DEFAULT_EDITS;
+   int32_t i = 0;
+   char_t *document = NULL;
+
+   if ( argc > 1 )
+   {
+      edits = atoi( argv[1] );
+   }
+
+   printf( "\nrandom edits per document size, %d edits per size\n", edits );
+
+   for ( i = 0; i < SIZE_COUNT; i++ )
+   {
+      document = make_document( sizes[i] );
+
+      run_cable( document, sizes[i], edits );
+      run_flat( document, sizes[i], edits );
+
+      free( document );
+   }
+
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,312 @@
+/**
+ @file main.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "benchmark of batched fft and shared plans"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+
+ @section Description
+
+ Measures transforming a batch of frames of growing length, in frames per
+ second.
+
+ The frame row transforms each frame with Fft_set_input and Fft_fft, then
+ copies the output out, the way a caller did before Fft_fft_batch. The
+ batch row transforms the same frames, as the rows of a matrix, with one
+ Fft_fft_batch call.
+
+ The make rows time making an Fft_t instance of each length with Fft_make,
+ which computes the twiddle factors each time, against making one from a
+ shared plan with Fft_make_from_plan.
+
+ The Release configuration builds with -fcx-limited-range, so that complex
+ products are inlined without the checks for infinite operands, which
+ lets the compiler vectorize the loop across the frames of a batch.
+
+ usage: Fft_batch_benchmark [max length] [frames per batch]
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "d_Matvec.h"
+#include "cd_Matvec.h"
+#include "cd_Fft.h"
+#include "Rng_Isaac.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEFAULT_MAX_LENGTH 4096
+#define DEFAULT_FRAME_COUNT 16
+#define MIN_TIME 0.5
+
+/**
+   kinds of transform timed
+*/
+
+#define KIND_FRAME 0
+#define KIND_BATCH 1
+
+static char_t *kind_names[] = { "frame", "batch" };
+
+/**
+   now
+
+   @return monotonic time in seconds
+*/
+
+static
+float64_t
+now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return ( float64_t ) ts.tv_sec + ( float64_t ) ts.tv_nsec * 1.0e-9;
+}
+
+/**
+   next_value
+
+   pseudo random value in [-1, 1] from an rng
+*/
+
+static
+float64_t
+next_value( rng_isaac_t *rng )
+{
+   float64_t result = 2.0*rng_isaac_f64_item( rng ) - 1.0;
+
+   rng_isaac_forth( rng );
+
+   return result;
+}
+
+/**
+   report
+*/
+
+static
+void
+report( char_t *name, int32_t n, float64_t rate, float64_t rate_base, float64_t check )
+{
+   printf
+   (
+      "   %-10s n %6d %12.0f frames/s   speedup %6.2f   (check %.2e)\n",
+      name,
+      n,
+      rate,
+      rate / rate_base,
+      check
+   );
+
+   return;
+}
+
+/**
+   transform_frames
+
+   transform the rows of input into the rows of output, one frame at a
+   time or as a batch
+*/
+
+static
+void
+transform_frames( int32_t kind, cd_fft_t *fft, cd_matvec_t *input, cd_matvec_t *output )
+{
+   int32_t i = 0;
+   int32_t n = cd_matvec_columns( input );
+   int32_t count = cd_matvec_rows( input );
+   complex128_t *pin = cd_matvec_as_array( input );
+   complex128_t *pout = cd_matvec_as_array( output );
+   complex128_t *pfft_in = cd_matvec_as_array( cd_fft_input( fft ) );
+   complex128_t *pfft_out = cd_matvec_as_array( cd_fft_output( fft ) );
+
+   if ( kind == KIND_FRAME )
+   {
+      for ( i = 0; i < count; i++ )
+      {
+         memcpy( pfft_in, pin + i * n, n * sizeof( complex128_t ) );
+         cd_fft_fft( fft );
+         memcpy( pout + i * n, pfft_out, n * sizeof( complex128_t ) );
+      }
+   }
+   else
+   {
+      cd_fft_fft_batch( fft, input, output );
+   }
+
+   return;
+}
+
+/**
+   bench_batch
+*/
+
+static
+void
+bench_batch( int32_t n, int32_t frame_count )
+{
+   int32_t i = 0;
+   int32_t kind = 0;
+   int32_t count = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+   float64_t t = 0.0;
+   float64_t rate = 0.0;
+   float64_t rate_base = 0.0;
+   float64_t check = 0.0;
+   cd_fft_t *fft = cd_fft_make( n );
+   cd_matvec_t *input = cd_matvec_make( frame_count, n );
+   cd_matvec_t *output = cd_matvec_make( frame_count, n );
+   cd_matvec_t *output_base = cd_matvec_make( frame_count, n );
+   complex128_t *pin = cd_matvec_as_array( input );
+   complex128_t *pout = cd_matvec_as_array( output );
+   complex128_t *pout_base = cd_matvec_as_array( output_base );
+
+   for ( i = 0; i < frame_count * n; i++ )
+   {
+      pin[i] = next_value( rng ) + next_value( rng )*I;
+   }
+
+   for ( kind = KIND_FRAME; kind <= KIND_BATCH; kind++ )
+   {
+      t = now();
+      count = 0;
+      while ( ( count == 0 ) || ( now() - t < MIN_TIME ) )
+      {
+         transform_frames( kind, fft, input, ( kind == KIND_FRAME ) ? output_base : output );
+         count = count + 1;
+      }
+      t = ( now() - t ) / count;
+
+      rate = frame_count / t;
+      if ( kind == KIND_FRAME )
+      {
+         rate_base = rate;
+      }
+
+      // largest difference from the frame at a time output
+      check = 0.0;
+      for ( i = 0; ( kind == KIND_BATCH ) && ( i < frame_count * n ); i++ )
+      {
+         if ( cabs( pout[i] - pout_base[i] ) > check )
+         {
+            check = cabs( pout[i] - pout_base[i] );
+         }
+      }
+
+      report( kind_names[kind], n, rate, rate_base, check );
+   }
+
+   cd_fft_deep_dispose( &fft );
+   cd_matvec_dispose( &input );
+   cd_matvec_dispose( &output );
+   cd_matvec_dispose( &output_base );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+/**
+   bench_make
+*/
+
+static
+void
+bench_make( int32_t n )
+{
+   int32_t count = 0;
+   float64_t t = 0.0;
+   float64_t t_base = 0.0;
+   cd_fft_t *fft = NULL;
+   cd_fft_plan_t *plan = cd_fft_plan_make( n );
+
+   t = now();
+   count = 0;
+   while ( ( count == 0 ) || ( now() - t < MIN_TIME ) )
+   {
+      fft = cd_fft_make( n );
+      cd_fft_deep_dispose( &fft );
+      count = count + 1;
+   }
+   t_base = ( now() - t ) / count;
+
+   t = now();
+   count = 0;
+   while ( ( count == 0 ) || ( now() - t < MIN_TIME ) )
+   {
+      fft = cd_fft_make_from_plan( plan );
+      cd_fft_deep_dispose( &fft );
+      count = count + 1;
+   }
+   t = ( now() - t ) / count;
+
+   printf
+   (
+      "   make       n %6d %10.2f us   from plan %10.2f us   speedup %6.2f\n",
+      n,
+      t_base * 1.0e6,
+      t * 1.0e6,
+      t_base / t
+   );
+
+   cd_fft_plan_dispose( &plan );
+
+   return;
+}
+
+int
+main( int argc, char **argv )
+{
+   int32_t i = 0;
+   int32_t max_length = DEFAULT_MAX_LENGTH;
+   int32_t frame_count = DEFAULT_FRAME_COUNT;
+   int32_t lengths[] = { 64, 256, 960, 1024, 3000, 4096, 16384 };
+   int32_t length_count = sizeof( lengths ) / sizeof( lengths[0] );
+
+   if ( argc > 1 )
+   {
+      max_length = atoi( argv[1] );
+   }
+
+   if ( argc > 2 )
+   {
+      frame_count = atoi( argv[2] );
+   }
+
+   printf( "\ntransform batches of %d complex frames\n", frame_count );
+
+   for ( i = 0; ( i < length_count ) && ( lengths[i] <= max_length ); i++ )
+   {
+      bench_batch( lengths[i], frame_count );
+   }
+
+   printf( "\nmake an fft instance\n" );
+
+   for ( i = 0; ( i < length_count ) && ( lengths[i] <= max_length ); i++ )
+   {
+      bench_make( lengths[i] );
+   }
+
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
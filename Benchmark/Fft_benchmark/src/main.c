@@ -0,0 +1,378 @@
+/**
+ @file main.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "benchmark of fft lengths and real input"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+
+ @section Description
+
+ Measures transforming frames of real samples, by default 3000 long.
+
+ The legacy row reproduces the previous radix 2 Fft_fft, which read and
+ wrote every item through the Matvec item and put functions, on the frame
+ zero padded to the next power of two. The padded row is Fft_fft on the
+ same padded frame. The mixed and real rows transform the frame at its own
+ length with Fft_fft and Fft_real_fft. The prime row transforms a frame one
+ sample longer when that length has a prime factor greater than five,
+ which is done with Bluestein's algorithm.
+
+ usage: Fft_benchmark [frame length]
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "d_Matvec.h"
+#include "cd_Matvec.h"
+#include "cd_Fft.h"
+#include "Rng_Isaac.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEFAULT_LENGTH 3000
+#define MIN_TIME 0.5
+
+/**
+   kinds of transform timed
+*/
+
+#define KIND_LEGACY 0
+#define KIND_PADDED 1
+#define KIND_MIXED 2
+#define KIND_REAL 3
+#define KIND_PRIME 4
+
+static char_t *kind_names[] = { "legacy", "padded", "mixed", "real", "prime" };
+
+/**
+   now
+
+   @return monotonic time in seconds
+*/
+
+static
+float64_t
+now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return ( float64_t ) ts.tv_sec + ( float64_t ) ts.tv_nsec * 1.0e-9;
+}
+
+/**
+   next_value
+
+   pseudo random value in [-1, 1] from an rng
+*/
+
+static
+float64_t
+next_value( rng_isaac_t *rng )
+{
+   float64_t result = 2.0*rng_isaac_f64_item( rng ) - 1.0;
+
+   rng_isaac_forth( rng );
+
+   return result;
+}
+
+/**
+   legacy_fft
+
+   the previous radix 2 transform of v into itself, one Matvec call per
+   item access, with precomputed coefficients and bit reverse table
+*/
+
+static
+void
+legacy_fft( cd_matvec_t *v, cd_matvec_t *coefficients, int32_t *ia, int32_t n, int32_t log_length )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+   int32_t l = 0;
+   int32_t n2 = 0;
+   complex128_t cis = 0.0;
+   complex128_t g = 0.0;
+   complex128_t g1 = 0.0;
+   complex128_t g2 = 0.0;
+
+   for ( i = 0, j = 0, l = log_length - 1, n2 = n / 2; i < log_length; i++ )
+   {
+      for ( ; j < n; )
+      {
+         for ( k = 0; k < n2; k++ )
+         {
+            cis = cd_matvec_vector_item( coefficients, ia[j >> l] );
+            g = cd_matvec_vector_item( v, j + n2 ) * cis;
+            g1 = cd_matvec_vector_item( v, j ) - g;
+            g2 = cd_matvec_vector_item( v, j ) + g;
+            cd_matvec_vector_put( v, g1, j + n2 );
+            cd_matvec_vector_put( v, g2, j );
+
+            j = j + 1;
+         }
+         j = j + n2;
+      }
+
+      j = 0;
+      l = l - 1;
+      n2 = n2 / 2;
+   }
+
+   cd_matvec_scale( v, 2.0 / n );
+
+   for ( i = 0; i < n; i++ )
+   {
+      if ( ia[i] > i )
+      {
+         g1 = cd_matvec_vector_item( v, i );
+         g2 = cd_matvec_vector_item( v, ia[i] );
+         cd_matvec_vector_put( v, g2, i );
+         cd_matvec_vector_put( v, g1, ia[i] );
+      }
+   }
+
+   return;
+}
+
+/**
+   bench_legacy
+
+   @return seconds per frame
+*/
+
+static
+float64_t
+bench_legacy( float64_t *frame, int32_t length, int32_t n )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t count = 0;
+   int32_t log_length = 0;
+   float64_t t = 0.0;
+   int32_t *ia = ( int32_t * ) calloc( n, sizeof( int32_t ) );
+   cd_matvec_t *coefficients = cd_matvec_make_column_vector( n );
+   cd_matvec_t *v = cd_matvec_make_column_vector( n );
+
+   while ( ( 1 << log_length ) < n )
+   {
+      log_length = log_length + 1;
+   }
+
+   for ( i = 0; i < n; i++ )
+   {
+      cd_matvec_vector_put( coefficients, cos( 2.0 * M_PI * i / n ) + sin( 2.0 * M_PI * i / n )*I, i );
+
+      ia[i] = 0;
+      for ( j = 0; j < log_length; j++ )
+      {
+         ia[i] = ( ia[i] << 1 ) | ( ( i >> j ) & 1 );
+      }
+   }
+
+   t = now();
+   count = 0;
+   while ( ( count == 0 ) || ( now() - t < MIN_TIME ) )
+   {
+      for ( i = 0; i < n; i++ )
+      {
+         cd_matvec_vector_put( v, ( i < length ) ? frame[i] : 0.0, i );
+      }
+      legacy_fft( v, coefficients, ia, n, log_length );
+      count = count + 1;
+   }
+   t = ( now() - t ) / count;
+
+   free( ia );
+   cd_matvec_dispose( &coefficients );
+   cd_matvec_dispose( &v );
+
+   return t;
+}
+
+/**
+   bench_fft
+
+   @return seconds per frame
+*/
+
+static
+float64_t
+bench_fft( int32_t kind, float64_t *frame, int32_t length, int32_t n )
+{
+   int32_t i = 0;
+   int32_t count = 0;
+   float64_t t = 0.0;
+   cd_fft_t *fft = cd_fft_make( n );
+   d_matvec_t *v = d_matvec_make_column_vector( n );
+
+   for ( i = 0; i < n; i++ )
+   {
+      d_matvec_vector_put( v, ( i < length ) ? frame[i] : 0.0, i );
+   }
+
+   t = now();
+   count = 0;
+   while ( ( count == 0 ) || ( now() - t < MIN_TIME ) )
+   {
+      cd_fft_set_real_input( fft, v );
+
+      if ( kind == KIND_REAL )
+      {
+         cd_fft_real_fft( fft );
+      }
+      else
+      {
+         cd_fft_fft( fft );
+      }
+
+      count = count + 1;
+   }
+   t = ( now() - t ) / count;
+
+   cd_fft_deep_dispose( &fft );
+   d_matvec_dispose( &v );
+
+   return t;
+}
+
+/**
+   has_large_prime_factor
+
+   @return 1 if n has a prime factor greater than five
+*/
+
+static
+int32_t
+has_large_prime_factor( int32_t n )
+{
+   while ( n % 2 == 0 )
+   {
+      n = n / 2;
+   }
+
+   while ( n % 3 == 0 )
+   {
+      n = n / 3;
+   }
+
+   while ( n % 5 == 0 )
+   {
+      n = n / 5;
+   }
+
+   return ( n > 1 );
+}
+
+int
+main( int argc, char **argv )
+{
+   int32_t i = 0;
+   int32_t kind = 0;
+   int32_t length = DEFAULT_LENGTH;
+   int32_t padded = 0;
+   int32_t n = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+   float64_t t = 0.0;
+   float64_t t_base = 0.0;
+   float64_t *frame = NULL;
+
+   if ( argc > 1 )
+   {
+      length = atoi( argv[1] );
+   }
+
+   padded = 2;
+   while ( padded < length )
+   {
+      padded = 2 * padded;
+   }
+
+   frame = ( float64_t * ) calloc( length + 1, sizeof( float64_t ) );
+   for ( i = 0; i < length + 1; i++ )
+   {
+      frame[i] = next_value( rng );
+   }
+
+   printf( "\ntransform a frame of %d real samples\n", length );
+
+   for ( kind = KIND_LEGACY; kind <= KIND_PRIME; kind++ )
+   {
+      n = length;
+
+      switch ( kind )
+      {
+         case KIND_LEGACY:
+         {
+            n = padded;
+            t = bench_legacy( frame, length, n );
+            t_base = t;
+            break;
+         }
+
+         case KIND_PADDED:
+         {
+            n = padded;
+            t = bench_fft( kind, frame, length, n );
+            break;
+         }
+
+         case KIND_PRIME:
+         {
+            n = length + 1;
+            t = 0.0;
+            if ( has_large_prime_factor( n ) == 1 )
+            {
+               t = bench_fft( kind, frame, n, n );
+            }
+            break;
+         }
+
+         default:
+         {
+            t = bench_fft( kind, frame, length, n );
+            break;
+         }
+      }
+
+      if ( t > 0.0 )
+      {
+         printf
+         (
+            "   %-8s n %7d %10.2f us/frame   speedup %6.2f\n",
+            kind_names[kind],
+            n,
+            t * 1.0e6,
+            t_base / t
+         );
+      }
+   }
+
+   free( frame );
+
+   rng_isaac_dispose( &rng );
+
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,327 @@
+/**
+ @file main.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "benchmark of HTable_flat against HTable"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Times put, successful and unsuccessful lookup, and remove for the chained
+ HTable_t and the open addressing HTable_flat_t, with int32_t keys and with
+ string_t keys.
+
+ usage: HTable_flat_benchmark [count]
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "ii_HTable.h"
+#include "ss_HTable.h"
+#include "ii_HTable_flat.h"
+#include "ss_HTable_flat.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEFAULT_COUNT 1000000
+
+// HTable_remove walks the insertion sequence list, so only time a few
+#define MAX_REMOVE_COUNT 10000
+
+/**
+   now
+
+   @return monotonic time in seconds
+*/
+
+static
+float64_t
+now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return ( float64_t ) ts.tv_sec + ( float64_t ) ts.tv_nsec * 1.0e-9;
+}
+
+/**
+   report
+
+   print one result line in millions of operations per second
+*/
+
+static
+void
+report( char_t *table, char_t *operation, int32_t count, float64_t seconds, int64_t check )
+{
+   printf
+   (
+      "%-14s %-12s %10.2f Mops/s   (check %lld)\n",
+      table,
+      operation,
+      ( ( float64_t ) count / seconds ) * 1.0e-6,
+      ( long long ) check
+   );
+
+   return;
+}
+
+/**
+   make_int_keys
+
+   scrambled, distinct, even, non-negative keys so that neither table sees
+   them in hash order and key + 1 is never present
+*/
+
+static
+int32_t *
+make_int_keys( int32_t count )
+{
+   int32_t i = 0;
+   int32_t *result = ( int32_t * ) calloc( count, sizeof( int32_t ) );
+
+   for ( i = 0; i < count; i++ )
+   {
+      result[i] = ( int32_t ) ( ( ( uint32_t ) i * 2654435761u ) & 0x3FFFFFFF ) * 2;
+   }
+
+   return result;
+}
+
+/**
+   make_string_keys
+*/
+
+static
+string_t **
+make_string_keys( int32_t count, char_t *prefix )
+{
+   int32_t i = 0;
+   char_t buffer[64] = {0};
+   string_t **result = ( string_t ** ) calloc( count, sizeof( string_t * ) );
+
+   for ( i = 0; i < count; i++ )
+   {
+      sprintf( buffer, "%s/%08x/item", prefix, ( uint32_t ) i * 2654435761u );
+      result[i] = string_make_from_cstring( buffer );
+   }
+
+   return result;
+}
+
+/**
+   benchmark_int_keys
+*/
+
+static
+void
+benchmark_int_keys( int32_t count )
+{
+   int32_t i = 0;
+   int64_t check = 0;
+   float64_t t = 0.0;
+   int32_t remove_count = count < MAX_REMOVE_COUNT ? count : MAX_REMOVE_COUNT;
+   int32_t *keys = make_int_keys( count );
+
+   ii_htable_t *htable = ii_htable_make();
+   ii_htable_flat_t *flat = ii_htable_flat_make();
+
+   printf( "\nint32_t keys, count = %d\n\n", count );
+
+   t = now();
+   for ( i = 0; i < count; i++ )
+   {
+      ii_htable_put( htable, i, keys[i] );
+   }
+   report( "HTable", "put", count, now() - t, ii_htable_count( htable ) );
+
+   t = now();
+   for ( i = 0; i < count; i++ )
+   {
+      ii_htable_flat_put( flat, i, keys[i] );
+   }
+   report( "HTable_flat", "put", count, now() - t, ii_htable_flat_count( flat ) );
+
+   check = 0;
+   t = now();
+   for ( i = 0; i < count; i++ )
+   {
+      check = check + ii_htable_item( htable, keys[i] );
+   }
+   report( "HTable", "item (hit)", count, now() - t, check );
+
+   check = 0;
+   t = now();
+   for ( i = 0; i < count; i++ )
+   {
+      check = check + ii_htable_flat_item( flat, keys[i] );
+   }
+   report( "HTable_flat", "item (hit)", count, now() - t, check );
+
+   check = 0;
+   t = now();
+   for ( i = 0; i < count; i++ )
+   {
+      check = check + ii_htable_has( htable, keys[i] + 1 );
+   }
+   report( "HTable", "has (miss)", count, now() - t, check );
+
+   check = 0;
+   t = now();
+   for ( i = 0; i < count; i++ )
+   {
+      check = check + ii_htable_flat_has( flat, keys[i] + 1 );
+   }
+   report( "HTable_flat", "has (miss)", count, now() - t, check );
+
+   t = now();
+   for ( i = 0; i < remove_count; i++ )
+   {
+      ii_htable_remove( htable, keys[i] );
+   }
+   report( "HTable", "remove", remove_count, now() - t, ii_htable_count( htable ) );
+
+   t = now();
+   for ( i = 0; i < remove_count; i++ )
+   {
+      ii_htable_flat_remove( flat, keys[i] );
+   }
+   report( "HTable_flat", "remove", remove_count, now() - t, ii_htable_flat_count( flat ) );
+
+   ii_htable_dispose( &htable );
+   ii_htable_flat_dispose( &flat );
+   free( keys );
+
+   return;
+}
+
+/**
+   benchmark_string_keys
+*/
+
+static
+void
+benchmark_string_keys( int32_t count )
+{
+   int32_t i = 0;
+   int64_t check = 0;
+   float64_t t = 0.0;
+   int32_t remove_count = count < MAX_REMOVE_COUNT ? count : MAX_REMOVE_COUNT;
+   string_t **keys = make_string_keys( count, "key" );
+   string_t **missing = make_string_keys( count, "missing" );
+
+   ss_htable_t *htable = ss_htable_make();
+   ss_htable_flat_t *flat = ss_htable_flat_make();
+
+   printf( "\nstring_t keys, count = %d\n\n", count );
+
+   t = now();
+   for ( i = 0; i < count; i++ )
+   {
+      ss_htable_put( htable, keys[i], keys[i] );
+   }
+   report( "HTable", "put", count, now() - t, ss_htable_count( htable ) );
+
+   t = now();
+   for ( i = 0; i < count; i++ )
+   {
+      ss_htable_flat_put( flat, keys[i], keys[i] );
+   }
+   report( "HTable_flat", "put", count, now() - t, ss_htable_flat_count( flat ) );
+
+   check = 0;
+   t = now();
+   for ( i = 0; i < count; i++ )
+   {
+      check = check + ( ss_htable_item( htable, keys[i] ) == keys[i] );
+   }
+   report( "HTable", "item (hit)", count, now() - t, check );
+
+   check = 0;
+   t = now();
+   for ( i = 0; i < count; i++ )
+   {
+      check = check + ( ss_htable_flat_item( flat, keys[i] ) == keys[i] );
+   }
+   report( "HTable_flat", "item (hit)", count, now() - t, check );
+
+   check = 0;
+   t = now();
+   for ( i = 0; i < count; i++ )
+   {
+      check = check + ss_htable_has( htable, missing[i] );
+   }
+   report( "HTable", "has (miss)", count, now() - t, check );
+
+   check = 0;
+   t = now();
+   for ( i = 0; i < count; i++ )
+   {
+      check = check + ss_htable_flat_has( flat, missing[i] );
+   }
+   report( "HTable_flat", "has (miss)", count, now() - t, check );
+
+   t = now();
+   for ( i = 0; i < remove_count; i++ )
+   {
+      ss_htable_remove( htable, keys[i] );
+   }
+   report( "HTable", "remove", remove_count, now() - t, ss_htable_count( htable ) );
+
+   t = now();
+   for ( i = 0; i < remove_count; i++ )
+   {
+      ss_htable_flat_remove( flat, keys[i] );
+   }
+   report( "HTable_flat", "remove", remove_count, now() - t, ss_htable_flat_count( flat ) );
+
+   ss_htable_dispose( &htable );
+   ss_htable_flat_dispose( &flat );
+
+   for ( i = 0; i < count; i++ )
+   {
+      string_deep_dispose( &keys[i] );
+      string_deep_dispose( &missing[i] );
+   }
+   free( keys );
+   free( missing );
+
+   return;
+}
+
+/**
+   main
+*/
+
+int main( int argc, char *argv[] )
+{
+   int32_t count = DEFAULT_COUNT;
+
+   if ( argc > 1 )
+   {
+      count = atoi( argv[1] );
+   }
+
+   benchmark_int_keys( count );
+   benchmark_string_keys( count );
+
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
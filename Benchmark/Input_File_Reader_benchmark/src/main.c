@@ -0,0 +1,313 @@
+/**
+ @file main.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "benchmark of input file reader tokenizing"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+
+ @section Description
+
+ Measures tokenizing a whitespace delimited text file with comments and
+ quoted tokens, in lines per second and megabytes per second.
+
+ The tokens row reads each line with Ifr_forth, which makes a string for
+ the line and for each token, and walks the list from Ifr_tokens. The
+ slices row reads with Ifr_forth_slices from a reader made with
+ Ifr_make_slices, and the mmap row does the same from a reader made with
+ Ifr_make_mmap, which find token slices in a reusable read buffer or the
+ mapped file. The parallel row reads from a reader made with
+ Ifr_make_parallel, which tokenizes chunks of the mapped file on the given
+ number of worker threads and delivers the lines in order, and the
+ unordered row delivers the chunks as they finish. Comments are skipped in
+ every row, and the file is in the page cache for every row.
+
+ The check column is the number of lines whose tokens differ from those of
+ the tokens row, which should be zero.
+
+ usage: Input_File_Reader_benchmark [lines] [threads] [file name]
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "Input_File_Reader.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEFAULT_LINE_COUNT 1000000
+#define DEFAULT_THREAD_COUNT 4
+#define DEFAULT_FILE_NAME "Input_File_Reader_benchmark.txt"
+#define MIN_TIME 0.5
+
+/**
+   kinds of reader timed
+*/
+
+#define KIND_TOKENS 0
+#define KIND_SLICES 1
+#define KIND_MMAP 2
+#define KIND_PARALLEL 3
+#define KIND_UNORDERED 4
+
+static char_t *kind_names[] = { "tokens", "slices", "mmap", "parallel", "unordered" };
+
+/**
+   now
+
+   @return monotonic time in seconds
+*/
+
+static
+float64_t
+now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return ( float64_t ) ts.tv_sec + ( float64_t ) ts.tv_nsec * 1.0e-9;
+}
+
+/**
+   hash_token
+
+   @return hash of the characters of a token mixed into h
+*/
+
+static
+uint32_t
+hash_token( uint32_t h, char_t *p, int32_t count )
+{
+   int32_t i = 0;
+   uint32_t result = h;
+
+   for ( i = 0; i < count; i++ )
+   {
+      result = ( result ^ ( uint8_t ) p[i] ) * 16777619u;
+   }
+
+   // separate the tokens
+   result = ( result ^ 0xffu ) * 16777619u;
+
+   return result;
+}
+
+/**
+   read_file
+
+   tokenize the file with the given kind of reader, leaving the hash of the
+   tokens of each line in hashes, return the number of lines read, which
+   is one less than the line number at end of file
+*/
+
+static
+int32_t
+read_file( int32_t kind, char_t *file_name, int32_t thread_count, uint32_t *hashes, int32_t line_count )
+{
+   int32_t i = 0;
+   int32_t n = 0;
+   int32_t line_number = 0;
+   int32_t line_number_max = 0;
+   uint32_t h = 0;
+   ifr_t *ifr = NULL;
+   s_dlist_t *list = NULL;
+   string_t *s = NULL;
+   ifr_slice_t *slices = NULL;
+
+   if ( kind == KIND_TOKENS )
+   {
+      ifr = ifr_make_cstring( file_name );
+   }
+   else if ( kind == KIND_SLICES )
+   {
+      ifr = ifr_make_slices_cstring( file_name );
+   }
+   else if ( kind == KIND_MMAP )
+   {
+      ifr = ifr_make_mmap_cstring( file_name );
+   }
+   else
+   {
+      ifr = ifr_make_parallel_cstring( file_name, thread_count, ( kind == KIND_PARALLEL ) ? 1 : 0 );
+   }
+
+   ifr_put_is_skip_comments( ifr, 1 );
+
+   while ( ifr_eof( ifr ) == 0 )
+   {
+      h = 2166136261u;
+
+      if ( kind == KIND_TOKENS )
+      {
+         ifr_forth( ifr );
+         list = ifr_tokens( ifr );
+
+         for( s_dlist_start( list ); s_dlist_off( list ) == 0; s_dlist_forth( list ) )
+         {
+            s = s_dlist_item_at( list );
+            h = hash_token( h, string_as_cstring( s ), string_count( s ) );
+         }
+      }
+      else
+      {
+         ifr_forth_slices( ifr );
+         slices = ifr_slices( ifr );
+         n = ifr_slice_count( ifr );
+
+         for ( i = 0; i < n; i++ )
+         {
+            h = hash_token( h, slices[i].base, slices[i].count );
+         }
+      }
+
+      line_number = ifr_line_number( ifr );
+      if ( line_number <= line_count )
+      {
+         hashes[ line_number - 1 ] = h;
+      }
+
+      if ( line_number > line_number_max )
+      {
+         line_number_max = line_number;
+      }
+   }
+
+   ifr_deep_dispose( &ifr );
+
+   return line_number_max - 1;
+}
+
+int
+main( int argc, char **argv )
+{
+   int32_t i = 0;
+   int32_t n = 0;
+   int32_t kind = 0;
+   int32_t check = 0;
+   int32_t line_count = DEFAULT_LINE_COUNT;
+   int32_t thread_count = DEFAULT_THREAD_COUNT;
+   int32_t lines_read = 0;
+   int64_t size = 0;
+   char_t *file_name = DEFAULT_FILE_NAME;
+   float64_t t = 0.0;
+   float64_t rate = 0.0;
+   float64_t rate_base = 0.0;
+   uint32_t *hashes = NULL;
+   uint32_t *hashes_base = NULL;
+   FILE *fp = NULL;
+
+   if ( argc > 1 )
+   {
+      line_count = atoi( argv[1] );
+   }
+
+   if ( argc > 2 )
+   {
+      thread_count = atoi( argv[2] );
+   }
+
+   if ( argc > 3 )
+   {
+      file_name = argv[3];
+   }
+
+   // write the file, which leaves it in the page cache
+   fp = fopen( file_name, "w" );
+   for ( i = 0; i < line_count; i++ )
+   {
+      if ( i % 20 == 0 )
+      {
+         fprintf( fp, "-- section %d\n", i / 20 );
+      }
+      else if ( i % 20 == 10 )
+      {
+         fprintf( fp, "\n" );
+      }
+      else
+      {
+         fprintf
+         (
+            fp,
+            "sample_%d\t%d %.6f \"label %d\" %d %d // note %d\n",
+            i,
+            i * 7 % 1000,
+            i * 0.001,
+            i % 97,
+            i % 13,
+            i % 5,
+            i
+         );
+      }
+   }
+   size = ftell( fp );
+   fclose( fp );
+
+   hashes = ( uint32_t * ) calloc( line_count, sizeof( uint32_t ) );
+   hashes_base = ( uint32_t * ) calloc( line_count, sizeof( uint32_t ) );
+
+   printf( "\ntokenize %d lines, %.1f MB, %d threads\n", line_count, size / 1.0e6, thread_count );
+
+   for ( kind = KIND_TOKENS; kind <= KIND_UNORDERED; kind++ )
+   {
+      memset( hashes, 0, line_count * sizeof( uint32_t ) );
+
+      t = now();
+      n = 0;
+      while ( ( n == 0 ) || ( now() - t < MIN_TIME ) )
+      {
+         lines_read = read_file( kind, file_name, thread_count, ( kind == KIND_TOKENS ) ? hashes_base : hashes, line_count );
+         n = n + 1;
+      }
+      t = now() - t;
+      rate = ( float64_t ) lines_read * n / t;
+
+      if ( kind == KIND_TOKENS )
+      {
+         rate_base = rate;
+         memcpy( hashes, hashes_base, line_count * sizeof( uint32_t ) );
+      }
+
+      check = 0;
+      for ( i = 0; i < line_count; i++ )
+      {
+         if ( hashes[i] != hashes_base[i] )
+         {
+            check = check + 1;
+         }
+      }
+
+      printf
+      (
+         "   %-9s %11.0f lines/s %8.1f MB/s   speedup %6.2f   (check %d)\n",
+         kind_names[kind],
+         rate,
+         ( float64_t ) size * n / t / 1.0e6,
+         rate / rate_base,
+         check
+      );
+   }
+
+   remove( file_name );
+
+   free( hashes );
+   free( hashes_base );
+
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
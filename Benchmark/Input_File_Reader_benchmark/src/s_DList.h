@@ -0,0 +1,70 @@
+/**
+ @file s_DList.h
+ @author Greg Lee
+ @version 0.0
+ @brief: "include file for doubly linked lists of strings"
+ 
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ 
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ 1. Permission is hereby granted to use, copy, modify and/or
+    distribute this package, provided that:
+       * copyright notices are retained unchanged,
+       * any distribution of this package, whether modified or not,
+         includes this license text.
+ 2. Permission is hereby also granted to distribute binary programs
+    which depend on this package. If the binary program depends on a
+    modified version of this package, you are encouraged to publicly
+    release the modified version of this package. 
+
+ THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT WARRANTY. ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE AUTHORS BE LIABLE TO ANY PARTY FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES ARISING IN ANY WAY OUT OF THE USE OF THIS PACKAGE.
+ 
+ @section Description
+
+ Defines to make a dlist into a _dlist.
+
+*/
+
+#ifndef S_DLIST_H_
+#define S_DLIST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PROTOCOLS_ENABLED
+
+#include "base.h"
+#include "protocol.h"
+#include "String.h"
+
+#define Prefix s
+#define Type string_t *
+#define Type_Code STRING_TYPE
+
+#include "DList.h"
+
+#undef Prefix
+#undef Type
+#undef Type_Code
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* S_DLIST_H_ */
+
+/* End of file */
+
+
+
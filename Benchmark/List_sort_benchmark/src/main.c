@@ -0,0 +1,374 @@
+/**
+ @file main.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "benchmark of concurrent SList and DList sorting"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+
+ @section Description
+
+ Measures the total throughput of worker threads that each repeatedly fill
+ and sort their own independent list, for 1, 2, 4 and 8 threads.
+
+ The legacy rows fill the same SList and then reproduce the previous sort
+ path, which copied the nodes into a pointer array and called qsort while
+ holding a process wide mutex that also guarded the global comparator. The current rows call SList_sort
+ and DList_sort, which relink the nodes with no shared state.
+
+ usage: List_sort_benchmark [list size] [rounds per thread]
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "int_SList.h"
+#include "i_DList.h"
+#include "Rng_Isaac.h"
+
+#ifdef MULTITHREADED
+#include MULTITHREAD_INCLUDE
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEFAULT_SIZE 20000
+#define DEFAULT_ROUNDS 20
+#define MAX_THREADS 8
+
+/**
+   kinds of sort timed
+*/
+
+#define KIND_LEGACY 0
+#define KIND_SLIST 1
+#define KIND_DLIST 2
+
+static char_t *kind_names[] = { "legacy", "SList", "DList" };
+
+/**
+   worker arguments
+*/
+
+typedef struct
+{
+   int32_t kind;
+   int32_t size;
+   int32_t rounds;
+   rng_isaac_t *rng;
+   int32_t check;
+} work_t;
+
+/**
+   legacy sort state, shared by every thread as in the previous code
+*/
+
+static MULTITHREAD_MUTEX_DEFINITION_INIT( legacy_sort_mutex );
+
+static
+int32_t ( *legacy_sort_func )( int32_t v1, int32_t v2 ) = NULL;
+
+/**
+   now
+
+   @return monotonic time in seconds
+*/
+
+static
+float64_t
+now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return ( float64_t ) ts.tv_sec + ( float64_t ) ts.tv_nsec * 1.0e-9;
+}
+
+/**
+   sort_func
+
+   ascending order of int32_t values
+*/
+
+static
+int32_t
+sort_func( int32_t v1, int32_t v2 )
+{
+   return ( v1 > v2 ) - ( v1 < v2 );
+}
+
+/**
+   legacy_compare
+*/
+
+static
+int
+legacy_compare( const void *a, const void *b )
+{
+   return legacy_sort_func( **( int32_t ** ) a, **( int32_t ** ) b );
+}
+
+/**
+   next_value
+
+   pseudo random value from a per thread rng
+*/
+
+static
+int32_t
+next_value( rng_isaac_t *rng )
+{
+   int32_t result = ( int32_t ) ( rng_isaac_u32_item( rng ) >> 1 );
+
+   rng_isaac_forth( rng );
+
+   return result;
+}
+
+/**
+   run_legacy
+*/
+
+static
+void
+run_legacy( work_t *work )
+{
+   int32_t i = 0;
+   int32_t r = 0;
+   int_slist_t *list = int_slist_make();
+   int32_t *values = ( int32_t * ) calloc( (*work).size, sizeof( int32_t ) );
+   int32_t **array = ( int32_t ** ) calloc( (*work).size, sizeof( int32_t * ) );
+
+   for ( r = 0; r < (*work).rounds; r++ )
+   {
+      int_slist_wipe_out( list );
+
+      for ( i = 0; i < (*work).size; i++ )
+      {
+         int_slist_put_last( list, next_value( (*work).rng ) );
+      }
+
+      // gather the items as the previous code gathered the nodes
+      i = 0;
+      int_slist_start( list );
+      while ( int_slist_off( list ) == 0 )
+      {
+         values[i] = int_slist_item_at( list );
+         array[i] = &values[i];
+         i = i + 1;
+         int_slist_forth( list );
+      }
+
+      LOCK( legacy_sort_mutex );
+      legacy_sort_func = sort_func;
+      qsort( array, (*work).size, sizeof( int32_t * ), legacy_compare );
+      UNLOCK( legacy_sort_mutex );
+
+      (*work).check = (*work).check ^ *array[0];
+   }
+
+   free( array );
+   free( values );
+   int_slist_dispose( &list );
+
+   return;
+}
+
+/**
+   run_slist
+*/
+
+static
+void
+run_slist( work_t *work )
+{
+   int32_t i = 0;
+   int32_t r = 0;
+   int_slist_t *list = int_slist_make();
+
+   for ( r = 0; r < (*work).rounds; r++ )
+   {
+      int_slist_wipe_out( list );
+
+      for ( i = 0; i < (*work).size; i++ )
+      {
+         int_slist_put_last( list, next_value( (*work).rng ) );
+      }
+
+      int_slist_sort( list, sort_func );
+
+      (*work).check = (*work).check ^ int_slist_first( list );
+   }
+
+   int_slist_dispose( &list );
+
+   return;
+}
+
+/**
+   run_dlist
+*/
+
+static
+void
+run_dlist( work_t *work )
+{
+   int32_t i = 0;
+   int32_t r = 0;
+   i_dlist_t *list = i_dlist_make();
+
+   for ( r = 0; r < (*work).rounds; r++ )
+   {
+      i_dlist_wipe_out( list );
+
+      for ( i = 0; i < (*work).size; i++ )
+      {
+         i_dlist_put_last( list, next_value( (*work).rng ) );
+      }
+
+      i_dlist_sort( list, sort_func );
+
+      (*work).check = (*work).check ^ i_dlist_first( list );
+   }
+
+   i_dlist_dispose( &list );
+
+   return;
+}
+
+/**
+   worker
+
+   thread entry point
+*/
+
+static
+void *
+worker( void *arg )
+{
+   work_t *work = ( work_t * ) arg;
+
+   switch ( (*work).kind )
+   {
+      case KIND_LEGACY:
+      {
+         run_legacy( work );
+         break;
+      }
+
+      case KIND_SLIST:
+      {
+         run_slist( work );
+         break;
+      }
+
+      default:
+      {
+         run_dlist( work );
+         break;
+      }
+   }
+
+   return NULL;
+}
+
+/**
+   bench
+
+   run thread_count workers of one kind and report items sorted per second
+*/
+
+static
+void
+bench( int32_t kind, int32_t thread_count, int32_t size, int32_t rounds )
+{
+   int32_t i = 0;
+   int32_t check = 0;
+   float64_t t = 0.0;
+   MULTITHREAD_THREAD_DEFINITION( threads[MAX_THREADS] );
+   work_t work[MAX_THREADS];
+
+   for ( i = 0; i < thread_count; i++ )
+   {
+      work[i].kind = kind;
+      work[i].size = size;
+      work[i].rounds = rounds;
+      work[i].rng = rng_isaac_make_with_seed( 12345 + 977 * i );
+      work[i].check = 0;
+   }
+
+   t = now();
+
+   for ( i = 0; i < thread_count; i++ )
+   {
+      MULTITHREAD_THREAD_CREATE( &threads[i], NULL, worker, &work[i] );
+   }
+
+   for ( i = 0; i < thread_count; i++ )
+   {
+      MULTITHREAD_THREAD_JOIN( threads[i], NULL );
+      check = check ^ work[i].check;
+      rng_isaac_dispose( &work[i].rng );
+   }
+
+   t = now() - t;
+
+   printf
+   (
+      "   %-8s threads %2d %10.2f M items/s   (check %d)\n",
+      kind_names[kind],
+      thread_count,
+      ( ( float64_t ) size * rounds * thread_count / t ) * 1.0e-6,
+      check
+   );
+
+   return;
+}
+
+int
+main( int argc, char **argv )
+{
+   int32_t size = DEFAULT_SIZE;
+   int32_t rounds = DEFAULT_ROUNDS;
+   int32_t kind = 0;
+   int32_t thread_count = 0;
+
+   if ( argc > 1 )
+   {
+      size = atoi( argv[1] );
+   }
+
+   if ( argc > 2 )
+   {
+      rounds = atoi( argv[2] );
+   }
+
+   printf( "\nlist size %d, rounds per thread %d, fill and sort\n", size, rounds );
+
+   for ( kind = KIND_LEGACY; kind <= KIND_DLIST; kind++ )
+   {
+      for ( thread_count = 1; thread_count <= MAX_THREADS; thread_count = 2 * thread_count )
+      {
+         bench( kind, thread_count, size, rounds );
+      }
+   }
+
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
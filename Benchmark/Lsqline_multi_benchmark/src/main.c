@@ -0,0 +1,374 @@
+/**
+ @file main.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "benchmark of least squares lines of many series"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+
+ @section Description
+
+ Measures fitting lines to many series of points, in points per second,
+ and the accuracy of the fit after many points.
+
+ The lsqline row keeps one Lsqline_t instance per series, puts each point
+ into its series and computes every series after each window of points,
+ then resets them. The multi rows put a point into every series with one
+ Lsqline_multi_put call and compute every series with one
+ Lsqline_multi_compute call after each window of points, with float32_t
+ and with float64_t sums.
+
+ The check column is the largest difference of the slopes from those of
+ the lsqline row.
+
+ The drift table puts many points far from the origin into one series
+ that lies exactly on a line of slope 0.5 and reports the error of the
+ computed slope.
+
+ usage: Lsqline_multi_benchmark [series] [window] [drift points]
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "Lsqline.h"
+#include "Lsqline_multi.h"
+#include "Rng_Isaac.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEFAULT_SERIES_COUNT 10000
+#define DEFAULT_WINDOW 64
+#define DEFAULT_DRIFT_COUNT 1000000
+#define MIN_TIME 0.5
+
+/**
+   kinds of fit timed
+*/
+
+#define KIND_LSQLINE 0
+#define KIND_MULTI 1
+#define KIND_MULTI_FLOAT64 2
+
+static char_t *kind_names[] = { "lsqline", "multi", "multi f64" };
+
+/**
+   now
+
+   @return monotonic time in seconds
+*/
+
+static
+float64_t
+now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return ( float64_t ) ts.tv_sec + ( float64_t ) ts.tv_nsec * 1.0e-9;
+}
+
+/**
+   next_value
+
+   pseudo random value in [-1, 1] from an rng
+*/
+
+static
+float64_t
+next_value( rng_isaac_t *rng )
+{
+   float64_t result = 2.0*rng_isaac_f64_item( rng ) - 1.0;
+
+   rng_isaac_forth( rng );
+
+   return result;
+}
+
+/**
+   fit_window
+
+   put a window of points into every series and compute the lines,
+   leaving the slopes in slopes
+*/
+
+static
+void
+fit_window
+(
+   int32_t kind,
+   lsqline_t **lines,
+   lsqline_multi_t *multi,
+   float32_t *x,
+   float32_t *y,
+   int32_t series_count,
+   int32_t window,
+   float32_t *slopes
+)
+{
+   int32_t i = 0;
+   int32_t j = 0;
+
+   if ( kind == KIND_LSQLINE )
+   {
+      for ( i = 0; i < window; i++ )
+      {
+         for ( j = 0; j < series_count; j++ )
+         {
+            lsqline_put( lines[j], x[i * series_count + j], y[i * series_count + j] );
+         }
+      }
+
+      for ( j = 0; j < series_count; j++ )
+      {
+         lsqline_compute( lines[j] );
+         slopes[j] = lsqline_slope( lines[j] );
+         lsqline_reset( lines[j] );
+      }
+   }
+   else
+   {
+      for ( i = 0; i < window; i++ )
+      {
+         lsqline_multi_put( multi, &x[i * series_count], &y[i * series_count] );
+      }
+
+      lsqline_multi_compute( multi );
+
+      for ( j = 0; j < series_count; j++ )
+      {
+         slopes[j] = lsqline_multi_slope( multi, j );
+      }
+   }
+
+   return;
+}
+
+/**
+   bench_fit
+*/
+
+static
+void
+bench_fit( int32_t series_count, int32_t window )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t kind = 0;
+   int32_t count = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+   float64_t t = 0.0;
+   float64_t rate = 0.0;
+   float64_t rate_base = 0.0;
+   float64_t check = 0.0;
+   float32_t *x = ( float32_t * ) calloc( window * series_count, sizeof( float32_t ) );
+   float32_t *y = ( float32_t * ) calloc( window * series_count, sizeof( float32_t ) );
+   float32_t *slopes = ( float32_t * ) calloc( series_count, sizeof( float32_t ) );
+   float32_t *slopes_base = ( float32_t * ) calloc( series_count, sizeof( float32_t ) );
+   lsqline_t **lines = ( lsqline_t ** ) calloc( series_count, sizeof( lsqline_t * ) );
+   lsqline_multi_t *multi = NULL;
+
+   // series j is a noisy line of slope j/series_count
+   for ( i = 0; i < window; i++ )
+   {
+      for ( j = 0; j < series_count; j++ )
+      {
+         x[i * series_count + j] = i;
+         y[i * series_count + j] = ( float32_t ) j / series_count * i + 0.1 * next_value( rng );
+      }
+   }
+
+   for ( j = 0; j < series_count; j++ )
+   {
+      lines[j] = lsqline_make( window );
+   }
+
+   for ( kind = KIND_LSQLINE; kind <= KIND_MULTI_FLOAT64; kind++ )
+   {
+      if ( kind == KIND_MULTI )
+      {
+         multi = lsqline_multi_make( series_count, window );
+      }
+      else if ( kind == KIND_MULTI_FLOAT64 )
+      {
+         multi = lsqline_multi_make_float64( series_count, window );
+      }
+
+      t = now();
+      count = 0;
+      while ( ( count == 0 ) || ( now() - t < MIN_TIME ) )
+      {
+         fit_window
+         (
+            kind,
+            lines,
+            multi,
+            x,
+            y,
+            series_count,
+            window,
+            ( kind == KIND_LSQLINE ) ? slopes_base : slopes
+         );
+         count = count + 1;
+      }
+      rate = ( float64_t ) series_count * window * count / ( now() - t );
+
+      if ( kind == KIND_LSQLINE )
+      {
+         rate_base = rate;
+      }
+
+      check = 0.0;
+      for ( j = 0; ( kind != KIND_LSQLINE ) && ( j < series_count ); j++ )
+      {
+         if ( fabs( slopes[j] - slopes_base[j] ) > check )
+         {
+            check = fabs( slopes[j] - slopes_base[j] );
+         }
+      }
+
+      printf
+      (
+         "   %-10s %14.0f points/s   speedup %6.2f   (check %.2e)\n",
+         kind_names[kind],
+         rate,
+         rate / rate_base,
+         check
+      );
+
+      if ( multi != NULL )
+      {
+         lsqline_multi_dispose( &multi );
+      }
+   }
+
+   for ( j = 0; j < series_count; j++ )
+   {
+      lsqline_dispose( &lines[j] );
+   }
+
+   free( lines );
+   free( x );
+   free( y );
+   free( slopes );
+   free( slopes_base );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+/**
+   bench_drift
+*/
+
+static
+void
+bench_drift( int32_t window, int32_t drift_count )
+{
+   int32_t i = 0;
+   int32_t kind = 0;
+   float32_t x = 0.0;
+   float32_t y = 0.0;
+   float32_t slope = 0.0;
+   lsqline_t *line = NULL;
+   lsqline_multi_t *multi = NULL;
+
+   for ( kind = KIND_LSQLINE; kind <= KIND_MULTI_FLOAT64; kind++ )
+   {
+      if ( kind == KIND_LSQLINE )
+      {
+         line = lsqline_make( drift_count );
+      }
+      else if ( kind == KIND_MULTI )
+      {
+         multi = lsqline_multi_make( 1, window );
+      }
+      else
+      {
+         multi = lsqline_multi_make_float64( 1, window );
+      }
+
+      // points on y = 0.5x + 2, all of them exact in float32_t
+      for ( i = 0; i < drift_count; i++ )
+      {
+         x = 100000.0 + ( i % 997 );
+         y = 0.5 * x + 2.0;
+
+         if ( kind == KIND_LSQLINE )
+         {
+            lsqline_put( line, x, y );
+         }
+         else
+         {
+            lsqline_multi_put( multi, &x, &y );
+         }
+      }
+
+      if ( kind == KIND_LSQLINE )
+      {
+         lsqline_compute( line );
+         slope = lsqline_slope( line );
+         lsqline_dispose( &line );
+      }
+      else
+      {
+         lsqline_multi_compute( multi );
+         slope = lsqline_multi_slope( multi, 0 );
+         lsqline_multi_dispose( &multi );
+      }
+
+      printf( "   %-10s slope %14.8f   error %.2e\n", kind_names[kind], slope, fabs( slope - 0.5 ) );
+   }
+
+   return;
+}
+
+int
+main( int argc, char **argv )
+{
+   int32_t series_count = DEFAULT_SERIES_COUNT;
+   int32_t window = DEFAULT_WINDOW;
+   int32_t drift_count = DEFAULT_DRIFT_COUNT;
+
+   if ( argc > 1 )
+   {
+      series_count = atoi( argv[1] );
+   }
+
+   if ( argc > 2 )
+   {
+      window = atoi( argv[2] );
+   }
+
+   if ( argc > 3 )
+   {
+      drift_count = atoi( argv[3] );
+   }
+
+   printf( "\nfit %d series with windows of %d points\n", series_count, window );
+   bench_fit( series_count, window );
+
+   printf( "\nfit %d points of one series far from the origin\n", drift_count );
+   bench_drift( window, drift_count );
+
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
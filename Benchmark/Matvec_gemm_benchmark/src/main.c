@@ -0,0 +1,327 @@
+/**
+ @file main.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "GFLOP/s benchmark of Matvec matrix multiplication"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+
+ @section Description
+
+ Measures Matvec_multiplied on square float64 and complex128 matrices of
+ growing size, in GFLOP/s (2 n^3 flops per real product, 8 n^3 per
+ complex product). The loop rows reproduce the previous i-j-k triple loop
+ on the same arrays, up to a size where it still finishes in reasonable
+ time, as a reference.
+
+ Build with the instruction sets of the machine (the Release
+ configuration uses -march=native) to use the AVX2 or AVX-512 kernels.
+
+ usage: Matvec_gemm_benchmark [max size] [max loop size]
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "d_Matvec.h"
+#include "cd_Matvec.h"
+#include "Rng_Isaac.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEFAULT_MAX_SIZE 2048
+#define DEFAULT_MAX_LOOP_SIZE 512
+#define MIN_TIME 0.5
+
+/**
+   now
+
+   @return monotonic time in seconds
+*/
+
+static
+float64_t
+now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return ( float64_t ) ts.tv_sec + ( float64_t ) ts.tv_nsec * 1.0e-9;
+}
+
+/**
+   next_value
+
+   pseudo random value in [-1, 1] from an rng
+*/
+
+static
+float64_t
+next_value( rng_isaac_t *rng )
+{
+   float64_t result = 2.0*rng_isaac_f64_item( rng ) - 1.0;
+
+   rng_isaac_forth( rng );
+
+   return result;
+}
+
+/**
+   report
+*/
+
+static
+void
+report( char_t *name, int32_t n, float64_t flops, float64_t t, float64_t check )
+{
+   printf
+   (
+      "   %-8s n %5d %10.2f GFLOP/s %10.4f s   (check %g)\n",
+      name,
+      n,
+      flops / t * 1.0e-9,
+      t,
+      check
+   );
+
+   return;
+}
+
+/**
+   d_loop
+
+   the previous triple loop
+*/
+
+static
+void
+d_loop( float64_t *pa, float64_t *pa_other, float64_t *pa_result, int32_t n )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+   float64_t item = 0.0;
+
+   for ( i = 0; i < n; i++ )
+   {
+      for ( j = 0; j < n; j++ )
+      {
+         item = 0.0;
+         for( k = 0; k < n; k++ )
+         {
+            item = item + pa[i * n + k] * pa_other[k * n + j];
+         }
+         pa_result[i * n + j] = item;
+      }
+   }
+
+   return;
+}
+
+/**
+   cd_loop
+
+   the previous triple loop
+*/
+
+static
+void
+cd_loop( complex128_t *pa, complex128_t *pa_other, complex128_t *pa_result, int32_t n )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+   complex128_t item = 0.0;
+
+   for ( i = 0; i < n; i++ )
+   {
+      for ( j = 0; j < n; j++ )
+      {
+         item = 0.0;
+         for( k = 0; k < n; k++ )
+         {
+            item = item + pa[i * n + k] * pa_other[k * n + j];
+         }
+         pa_result[i * n + j] = item;
+      }
+   }
+
+   return;
+}
+
+/**
+   bench_d
+*/
+
+static
+void
+bench_d( int32_t n, int32_t max_loop_size )
+{
+   int32_t i = 0;
+   int32_t count = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+   float64_t t = 0.0;
+   float64_t flops = 2.0 * n * n * ( float64_t ) n;
+   d_matvec_t *dm = NULL;
+   d_matvec_t *dm1 = d_matvec_make( n, n );
+   d_matvec_t *dm2 = d_matvec_make( n, n );
+   float64_t *pa1 = d_matvec_as_array( dm1 );
+   float64_t *pa2 = d_matvec_as_array( dm2 );
+   float64_t *pa = NULL;
+
+   for ( i = 0; i < n * n; i++ )
+   {
+      pa1[i] = next_value( rng );
+      pa2[i] = next_value( rng );
+   }
+
+   t = now();
+   count = 0;
+   while ( ( count == 0 ) || ( now() - t < MIN_TIME ) )
+   {
+      if ( dm != NULL )
+      {
+         d_matvec_dispose( &dm );
+      }
+      dm = d_matvec_multiplied( dm1, dm2 );
+      count = count + 1;
+   }
+   t = ( now() - t ) / count;
+
+   report( "float64", n, flops, t, d_matvec_item( dm, n / 2, n / 3 ) );
+
+   if ( n <= max_loop_size )
+   {
+      pa = ( float64_t * ) calloc( n * n, sizeof( float64_t ) );
+
+      t = now();
+      d_loop( pa1, pa2, pa, n );
+      t = now() - t;
+
+      report( "loop", n, flops, t, pa[ ( n / 2 ) * n + n / 3 ] );
+
+      free( pa );
+   }
+
+   d_matvec_dispose( &dm );
+   d_matvec_dispose( &dm1 );
+   d_matvec_dispose( &dm2 );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+/**
+   bench_cd
+*/
+
+static
+void
+bench_cd( int32_t n, int32_t max_loop_size )
+{
+   int32_t i = 0;
+   int32_t count = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 4321 );
+   float64_t t = 0.0;
+   float64_t flops = 8.0 * n * n * ( float64_t ) n;
+   cd_matvec_t *cdm = NULL;
+   cd_matvec_t *cdm1 = cd_matvec_make( n, n );
+   cd_matvec_t *cdm2 = cd_matvec_make( n, n );
+   complex128_t *pa1 = cd_matvec_as_array( cdm1 );
+   complex128_t *pa2 = cd_matvec_as_array( cdm2 );
+   complex128_t *pa = NULL;
+
+   for ( i = 0; i < n * n; i++ )
+   {
+      pa1[i] = next_value( rng ) + next_value( rng )*I;
+      pa2[i] = next_value( rng ) + next_value( rng )*I;
+   }
+
+   t = now();
+   count = 0;
+   while ( ( count == 0 ) || ( now() - t < MIN_TIME ) )
+   {
+      if ( cdm != NULL )
+      {
+         cd_matvec_dispose( &cdm );
+      }
+      cdm = cd_matvec_multiplied( cdm1, cdm2 );
+      count = count + 1;
+   }
+   t = ( now() - t ) / count;
+
+   report( "complex", n, flops, t, creal( cd_matvec_item( cdm, n / 2, n / 3 ) ) );
+
+   if ( n <= max_loop_size )
+   {
+      pa = ( complex128_t * ) calloc( n * n, sizeof( complex128_t ) );
+
+      t = now();
+      cd_loop( pa1, pa2, pa, n );
+      t = now() - t;
+
+      report( "loop", n, flops, t, creal( pa[ ( n / 2 ) * n + n / 3 ] ) );
+
+      free( pa );
+   }
+
+   cd_matvec_dispose( &cdm );
+   cd_matvec_dispose( &cdm1 );
+   cd_matvec_dispose( &cdm2 );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+int
+main( int argc, char **argv )
+{
+   int32_t n = 0;
+   int32_t max_size = DEFAULT_MAX_SIZE;
+   int32_t max_loop_size = DEFAULT_MAX_LOOP_SIZE;
+
+   if ( argc > 1 )
+   {
+      max_size = atoi( argv[1] );
+   }
+
+   if ( argc > 2 )
+   {
+      max_loop_size = atoi( argv[2] );
+   }
+
+   printf( "\nfloat64 matrix products\n" );
+
+   for ( n = 128; n <= max_size; n = 2 * n )
+   {
+      bench_d( n, max_loop_size );
+   }
+
+   printf( "\ncomplex128 matrix products\n" );
+
+   for ( n = 128; n <= max_size; n = 2 * n )
+   {
+      bench_cd( n, max_loop_size );
+   }
+
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,484 @@
+/**
+ @file main.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "benchmark of solving with cached factors against inverting"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+
+ @section Description
+
+ Measures solving A X = B for a symmetric positive definite float64 matrix
+ A of growing size.
+
+ The first table solves for an n by m B in one step: Matvec_inverse
+ followed by Matvec_multiplied, against Matvec_lu and Matvec_cholesky
+ make followed by solve_many.
+
+ The second table solves for a series of single right hand sides with the
+ same A, the way a caller inverting each time used to: Matvec_inverse and
+ Matvec_multiplied per vector, against one factorization followed by one
+ solve per vector.
+
+ The check column is the largest item of A X - B.
+
+ usage: Matvec_lu_benchmark [max size] [right hand sides]
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "d_Matvec.h"
+#include "d_Matvec_lu.h"
+#include "d_Matvec_cholesky.h"
+#include "Rng_Isaac.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEFAULT_MAX_SIZE 512
+#define DEFAULT_RHS_COUNT 16
+#define MIN_TIME 0.5
+
+/**
+   kinds of solve timed
+*/
+
+#define KIND_INVERSE 0
+#define KIND_LU 1
+#define KIND_CHOLESKY 2
+
+static char_t *kind_names[] = { "inverse", "lu", "cholesky" };
+
+/**
+   now
+
+   @return monotonic time in seconds
+*/
+
+static
+float64_t
+now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return ( float64_t ) ts.tv_sec + ( float64_t ) ts.tv_nsec * 1.0e-9;
+}
+
+/**
+   next_value
+
+   pseudo random value in [-1, 1] from an rng
+*/
+
+static
+float64_t
+next_value( rng_isaac_t *rng )
+{
+   float64_t result = 2.0*rng_isaac_f64_item( rng ) - 1.0;
+
+   rng_isaac_forth( rng );
+
+   return result;
+}
+
+/**
+   make_spd
+
+   @return C^T C + n I for a pseudo random n by n C
+*/
+
+static
+d_matvec_t *
+make_spd( int32_t n )
+{
+   int32_t i = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+   d_matvec_t *c = d_matvec_make( n, n );
+   d_matvec_t *ct = NULL;
+   d_matvec_t *result = NULL;
+   float64_t *pa = d_matvec_as_array( c );
+
+   for ( i = 0; i < n * n; i++ )
+   {
+      pa[i] = next_value( rng );
+   }
+
+   ct = d_matvec_transposed( c );
+   result = d_matvec_multiplied( ct, c );
+   pa = d_matvec_as_array( result );
+
+   for ( i = 0; i < n; i++ )
+   {
+      pa[i * n + i] = pa[i * n + i] + n;
+   }
+
+   d_matvec_dispose( &c );
+   d_matvec_dispose( &ct );
+
+   rng_isaac_dispose( &rng );
+
+   return result;
+}
+
+/**
+   make_rhs
+
+   @return pseudo random n by m matrix
+*/
+
+static
+d_matvec_t *
+make_rhs( int32_t n, int32_t m )
+{
+   int32_t i = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 4321 );
+   d_matvec_t *result = d_matvec_make( n, m );
+   float64_t *pa = d_matvec_as_array( result );
+
+   for ( i = 0; i < n * m; i++ )
+   {
+      pa[i] = next_value( rng );
+   }
+
+   rng_isaac_dispose( &rng );
+
+   return result;
+}
+
+/**
+   residual
+
+   @return largest item of a x - b
+*/
+
+static
+float64_t
+residual( d_matvec_t *a, d_matvec_t *x, d_matvec_t *b )
+{
+   int32_t i = 0;
+   int32_t count = d_matvec_rows( b ) * d_matvec_columns( b );
+   float64_t result = 0.0;
+   d_matvec_t *ax = d_matvec_multiplied( a, x );
+   float64_t *pax = d_matvec_as_array( ax );
+   float64_t *pb = d_matvec_as_array( b );
+
+   for ( i = 0; i < count; i++ )
+   {
+      if ( fabs( pax[i] - pb[i] ) > result )
+      {
+         result = fabs( pax[i] - pb[i] );
+      }
+   }
+
+   d_matvec_dispose( &ax );
+
+   return result;
+}
+
+/**
+   solve_once
+
+   @return X for A X = B in one step of the given kind
+*/
+
+static
+d_matvec_t *
+solve_once( int32_t kind, d_matvec_t *a, d_matvec_t *b )
+{
+   d_matvec_t *inverse = NULL;
+   d_matvec_lu_t *lu = NULL;
+   d_matvec_cholesky_t *cholesky = NULL;
+   d_matvec_t *result = NULL;
+
+   switch ( kind )
+   {
+      case KIND_INVERSE:
+      {
+         inverse = d_matvec_inverse( a );
+         result = d_matvec_multiplied( inverse, b );
+         d_matvec_dispose( &inverse );
+         break;
+      }
+
+      case KIND_LU:
+      {
+         lu = d_matvec_lu_make( a );
+         result = d_matvec_lu_solve_many( lu, b );
+         d_matvec_lu_dispose( &lu );
+         break;
+      }
+
+      default:
+      {
+         cholesky = d_matvec_cholesky_make( a );
+         result = d_matvec_cholesky_solve_many( cholesky, b );
+         d_matvec_cholesky_dispose( &cholesky );
+         break;
+      }
+   }
+
+   return result;
+}
+
+/**
+   solve_series
+
+   solve A x = b for each column b of B as a separate vector, either
+   inverting A for each one or factoring A once
+
+   @return largest residual
+*/
+
+static
+float64_t
+solve_series( int32_t kind, d_matvec_t *a, d_matvec_t **bs, int32_t count )
+{
+   int32_t i = 0;
+   float64_t r = 0.0;
+   float64_t result = 0.0;
+   d_matvec_t *inverse = NULL;
+   d_matvec_lu_t *lu = NULL;
+   d_matvec_cholesky_t *cholesky = NULL;
+   d_matvec_t *x = NULL;
+
+   if ( kind == KIND_LU )
+   {
+      lu = d_matvec_lu_make( a );
+   }
+   else if ( kind == KIND_CHOLESKY )
+   {
+      cholesky = d_matvec_cholesky_make( a );
+   }
+
+   for ( i = 0; i < count; i++ )
+   {
+      switch ( kind )
+      {
+         case KIND_INVERSE:
+         {
+            inverse = d_matvec_inverse( a );
+            x = d_matvec_multiplied( inverse, bs[i] );
+            d_matvec_dispose( &inverse );
+            break;
+         }
+
+         case KIND_LU:
+         {
+            x = d_matvec_lu_solve( lu, bs[i] );
+            break;
+         }
+
+         default:
+         {
+            x = d_matvec_cholesky_solve( cholesky, bs[i] );
+            break;
+         }
+      }
+
+      // only the last vector is checked, to keep the timing clean
+      if ( i == count - 1 )
+      {
+         r = residual( a, x, bs[i] );
+         if ( r > result )
+         {
+            result = r;
+         }
+      }
+
+      d_matvec_dispose( &x );
+   }
+
+   if ( lu != NULL )
+   {
+      d_matvec_lu_dispose( &lu );
+   }
+
+   if ( cholesky != NULL )
+   {
+      d_matvec_cholesky_dispose( &cholesky );
+   }
+
+   return result;
+}
+
+/**
+   report
+*/
+
+static
+void
+report( char_t *name, int32_t n, float64_t t, float64_t t_base, float64_t check )
+{
+   printf
+   (
+      "   %-8s n %5d %10.4f ms   speedup %6.2f   (check %.2e)\n",
+      name,
+      n,
+      t * 1.0e3,
+      t_base / t,
+      check
+   );
+
+   return;
+}
+
+/**
+   bench_once
+*/
+
+static
+void
+bench_once( int32_t n, int32_t m )
+{
+   int32_t kind = 0;
+   int32_t count = 0;
+   float64_t t = 0.0;
+   float64_t t_base = 0.0;
+   float64_t check = 0.0;
+   d_matvec_t *a = make_spd( n );
+   d_matvec_t *b = make_rhs( n, m );
+   d_matvec_t *x = NULL;
+
+   for ( kind = KIND_INVERSE; kind <= KIND_CHOLESKY; kind++ )
+   {
+      t = now();
+      count = 0;
+      while ( ( count == 0 ) || ( now() - t < MIN_TIME ) )
+      {
+         if ( x != NULL )
+         {
+            d_matvec_dispose( &x );
+         }
+         x = solve_once( kind, a, b );
+         count = count + 1;
+      }
+      t = ( now() - t ) / count;
+
+      if ( kind == KIND_INVERSE )
+      {
+         t_base = t;
+      }
+
+      check = residual( a, x, b );
+      d_matvec_dispose( &x );
+
+      report( kind_names[kind], n, t, t_base, check );
+   }
+
+   d_matvec_dispose( &a );
+   d_matvec_dispose( &b );
+
+   return;
+}
+
+/**
+   bench_series
+*/
+
+static
+void
+bench_series( int32_t n, int32_t m )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t kind = 0;
+   int32_t count = 0;
+   float64_t t = 0.0;
+   float64_t t_base = 0.0;
+   float64_t check = 0.0;
+   d_matvec_t *a = make_spd( n );
+   d_matvec_t *b = make_rhs( n, m );
+   d_matvec_t **bs = ( d_matvec_t ** ) calloc( m, sizeof( d_matvec_t * ) );
+
+   for ( j = 0; j < m; j++ )
+   {
+      bs[j] = d_matvec_make( n, 1 );
+      for ( i = 0; i < n; i++ )
+      {
+         d_matvec_put( bs[j], d_matvec_item( b, i, j ), i, 0 );
+      }
+   }
+
+   for ( kind = KIND_INVERSE; kind <= KIND_CHOLESKY; kind++ )
+   {
+      t = now();
+      count = 0;
+      while ( ( count == 0 ) || ( now() - t < MIN_TIME ) )
+      {
+         check = solve_series( kind, a, bs, m );
+         count = count + 1;
+      }
+      t = ( now() - t ) / count;
+
+      if ( kind == KIND_INVERSE )
+      {
+         t_base = t;
+      }
+
+      report( kind_names[kind], n, t, t_base, check );
+   }
+
+   for ( j = 0; j < m; j++ )
+   {
+      d_matvec_dispose( &bs[j] );
+   }
+   free( bs );
+
+   d_matvec_dispose( &a );
+   d_matvec_dispose( &b );
+
+   return;
+}
+
+int
+main( int argc, char **argv )
+{
+   int32_t n = 0;
+   int32_t max_size = DEFAULT_MAX_SIZE;
+   int32_t rhs_count = DEFAULT_RHS_COUNT;
+
+   if ( argc > 1 )
+   {
+      max_size = atoi( argv[1] );
+   }
+
+   if ( argc > 2 )
+   {
+      rhs_count = atoi( argv[2] );
+   }
+
+   printf( "\nsolve A X = B, B with %d columns, in one step\n", rhs_count );
+
+   for ( n = 64; n <= max_size; n = 2 * n )
+   {
+      bench_once( n, rhs_count );
+   }
+
+   printf( "\nsolve A x = b for %d vectors b in turn\n", rhs_count );
+
+   for ( n = 64; n <= max_size; n = 2 * n )
+   {
+      bench_series( n, rhs_count );
+   }
+
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
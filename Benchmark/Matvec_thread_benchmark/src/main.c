@@ -0,0 +1,282 @@
+/**
+ @file main.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "scaling benchmark of threaded Matvec operations"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+
+ @section Description
+
+ Measures Matvec_multiplied, Matvec_add, Matvec_transpose, Matvec_inverse
+ and Matvec_determinant on a square float64 matrix with 1, 2, 4, ... up to
+ the given number of threads. The check column compares the bits of each
+ result with the single threaded one.
+
+ usage: Matvec_thread_benchmark [size] [max threads]
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "d_Matvec.h"
+#include "Rng_Isaac.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEFAULT_SIZE 1024
+#define MIN_TIME 0.5
+
+/**
+   kinds of operation timed
+*/
+
+#define KIND_MULTIPLIED 0
+#define KIND_ADD 1
+#define KIND_TRANSPOSE 2
+#define KIND_INVERSE 3
+#define KIND_DETERMINANT 4
+
+static char_t *kind_names[] = { "multiplied", "add", "transpose", "inverse", "determinant" };
+
+/**
+   now
+
+   @return monotonic time in seconds
+*/
+
+static
+float64_t
+now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return ( float64_t ) ts.tv_sec + ( float64_t ) ts.tv_nsec * 1.0e-9;
+}
+
+/**
+   fill
+
+   put the same pseudo random values in [-1, 1] into dm each time
+*/
+
+static
+void
+fill( d_matvec_t *dm, int32_t n, uint64_t seed )
+{
+   int32_t i = 0;
+   float64_t *pa = d_matvec_as_array( dm );
+   rng_isaac_t *rng = rng_isaac_make_with_seed( seed );
+
+   rng_isaac_fill_f64( rng, pa, n * n );
+
+   for ( i = 0; i < n * n; i++ )
+   {
+      pa[i] = 2.0 * pa[i] - 1.0;
+   }
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+/**
+   run
+
+   do one operation of kind on dm, other is the second operand
+
+   @return the result matrix, or NULL when the operation works in place
+*/
+
+static
+d_matvec_t *
+run( int32_t kind, d_matvec_t *dm, d_matvec_t *other, float64_t *det )
+{
+   d_matvec_t *result = NULL;
+
+   switch ( kind )
+   {
+      case KIND_MULTIPLIED:
+      {
+         result = d_matvec_multiplied( dm, other );
+         break;
+      }
+
+      case KIND_ADD:
+      {
+         d_matvec_add( dm, other );
+         break;
+      }
+
+      case KIND_TRANSPOSE:
+      {
+         d_matvec_transpose( dm );
+         break;
+      }
+
+      case KIND_INVERSE:
+      {
+         result = d_matvec_inverse( dm );
+         break;
+      }
+
+      default:
+      {
+         *det = d_matvec_determinant( dm );
+         break;
+      }
+   }
+
+   return result;
+}
+
+/**
+   bench
+
+   time operation kind on threads threads, compare the result with base
+
+   @return the time of one operation in seconds
+*/
+
+static
+float64_t
+bench( int32_t kind, int32_t n, int32_t threads, float64_t t_base, d_matvec_t *base, float64_t *det_base )
+{
+   int32_t count = 0;
+   int32_t check = 0;
+   float64_t t = 0.0;
+   float64_t det = 0.0;
+   d_matvec_t *dm = d_matvec_make( n, n );
+   d_matvec_t *other = d_matvec_make( n, n );
+   d_matvec_t *result = NULL;
+
+   fill( other, n, 4321u );
+   d_matvec_set_thread_count( dm, threads );
+
+   t = 0.0;
+   count = 0;
+   while ( ( count == 0 ) || ( t < MIN_TIME ) )
+   {
+      if ( result != NULL )
+      {
+         d_matvec_dispose( &result );
+      }
+
+      // in place operations start from the same items every time
+      fill( dm, n, 12345u );
+
+      t = t - now();
+      result = run( kind, dm, other, &det );
+      t = t + now();
+
+      count = count + 1;
+   }
+   t = t / count;
+
+   if ( result == NULL )
+   {
+      result = d_matvec_make_from( dm );
+   }
+
+   if ( threads == 1 )
+   {
+      d_matvec_set_from( base, result );
+      *det_base = det;
+      t_base = t;
+   }
+
+   check
+      =  ( memcmp( d_matvec_as_array( base ), d_matvec_as_array( result ), n * n * sizeof( float64_t ) ) == 0 )
+         &&
+         ( memcmp( det_base, &det, sizeof( float64_t ) ) == 0 );
+
+   printf
+   (
+      "   %-12s threads %3d %10.4f s   speedup %6.2f   (same bits %d)\n",
+      kind_names[kind],
+      threads,
+      t,
+      t_base / t,
+      check
+   );
+
+   d_matvec_dispose( &result );
+   d_matvec_dispose( &dm );
+   d_matvec_dispose( &other );
+
+   return t;
+}
+
+int
+main( int argc, char **argv )
+{
+   int32_t n = DEFAULT_SIZE;
+   int32_t max_threads = ( int32_t ) sysconf( _SC_NPROCESSORS_ONLN );
+   int32_t threads = 0;
+   int32_t kind = 0;
+   float64_t t_base = 0.0;
+   float64_t det_base = 0.0;
+   d_matvec_t *base = NULL;
+
+   if ( argc > 1 )
+   {
+      n = atoi( argv[1] );
+   }
+
+   if ( argc > 2 )
+   {
+      max_threads = atoi( argv[2] );
+   }
+
+   if ( max_threads < 1 )
+   {
+      max_threads = 1;
+   }
+
+   base = d_matvec_make( n, n );
+
+   printf( "\n%d by %d float64 matrix\n", n, n );
+
+   for ( kind = KIND_MULTIPLIED; kind <= KIND_DETERMINANT; kind++ )
+   {
+      for ( threads = 1; threads <= max_threads; threads = 2 * threads )
+      {
+         if ( threads == 1 )
+         {
+            t_base = bench( kind, n, threads, 0.0, base, &det_base );
+         }
+         else
+         {
+            bench( kind, n, threads, t_base, base, &det_base );
+         }
+
+         // include max_threads itself when it is not a power of two
+         if ( ( threads < max_threads ) && ( 2 * threads > max_threads ) )
+         {
+            threads = max_threads / 2;
+         }
+      }
+   }
+
+   d_matvec_dispose( &base );
+
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
@@ -0,0 +1,319 @@
+/**
+ @file main.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "benchmark of PQueue put and remove"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+
+ @section Description
+
+ Times the array heap PQueue_t against the previous sorted linked list
+ implementation, reproduced here as the legacy queue. Three patterns are
+ measured: put count random priorities then remove them all, the same with
+ PQueue_put_many, and a scheduler style hold loop that keeps count items
+ queued while repeatedly removing the top and putting a later one.
+
+ The legacy queue is O(n) per put, so it is only timed up to
+ MAX_LEGACY_COUNT items.
+
+ usage: PQueue_benchmark [count]
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "int_PQueue.h"
+#include "Rng_Isaac.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEFAULT_COUNT 1000000
+
+// the legacy put walks the list, so only time a few
+#define MAX_LEGACY_COUNT 20000
+
+#define HOLD_ROUNDS 4
+
+/**
+   now
+
+   @return monotonic time in seconds
+*/
+
+static
+float64_t
+now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return ( float64_t ) ts.tv_sec + ( float64_t ) ts.tv_nsec * 1.0e-9;
+}
+
+/**
+   report
+*/
+
+static
+void
+report( char_t *name, char_t *op, int32_t count, float64_t t, int32_t check )
+{
+   printf
+   (
+      "   %-8s %-12s %10d ops %10.2f Mops/s   (check %d)\n",
+      name,
+      op,
+      count,
+      ( ( float64_t ) count / t ) * 1.0e-6,
+      check
+   );
+
+   return;
+}
+
+/**
+   legacy queue
+
+   the previous PQueue_t, a singly linked list kept in priority order
+*/
+
+struct legacy_node
+{
+   struct legacy_node *next;
+   int32_t value;
+};
+
+typedef struct legacy_node legacy_node_t;
+
+typedef struct
+{
+   legacy_node_t *first;
+   int32_t count;
+} legacy_t;
+
+/**
+   legacy_put
+*/
+
+static
+void
+legacy_put( legacy_t *q, int32_t value )
+{
+   legacy_node_t *node = ( legacy_node_t * ) calloc( 1, sizeof( legacy_node_t ) );
+   legacy_node_t **p = &(*q).first;
+
+   (*node).value = value;
+
+   // walk past every item that comes before or with value
+   while ( ( *p != NULL ) && ( (**p).value >= value ) )
+   {
+      p = &(**p).next;
+   }
+
+   (*node).next = *p;
+   *p = node;
+   (*q).count = (*q).count + 1;
+
+   return;
+}
+
+/**
+   legacy_remove
+*/
+
+static
+int32_t
+legacy_remove( legacy_t *q )
+{
+   legacy_node_t *node = (*q).first;
+   int32_t result = (*node).value;
+
+   (*q).first = (*node).next;
+   (*q).count = (*q).count - 1;
+   free( node );
+
+   return result;
+}
+
+/**
+   make_values
+
+   pseudo random priorities
+*/
+
+static
+int32_t *
+make_values( int32_t count )
+{
+   int32_t i = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+   int32_t *result = ( int32_t * ) calloc( count, sizeof( int32_t ) );
+
+   for ( i = 0; i < count; i++ )
+   {
+      result[i] = ( int32_t ) ( rng_isaac_u32_item( rng ) >> 1 );
+      rng_isaac_forth( rng );
+   }
+
+   rng_isaac_dispose( &rng );
+
+   return result;
+}
+
+/**
+   bench_legacy
+*/
+
+static
+void
+bench_legacy( int32_t *values, int32_t count )
+{
+   int32_t i = 0;
+   int32_t check = 0;
+   float64_t t = 0.0;
+   legacy_t q = { NULL, 0 };
+
+   t = now();
+   for ( i = 0; i < count; i++ )
+   {
+      legacy_put( &q, values[i] );
+   }
+   t = now() - t;
+   report( "legacy", "put", count, t, q.count );
+
+   t = now();
+   for ( i = 0; i < count; i++ )
+   {
+      check = check ^ legacy_remove( &q );
+   }
+   t = now() - t;
+   report( "legacy", "remove", count, t, check );
+
+   // hold: remove the top, put it back later
+   for ( i = 0; i < count; i++ )
+   {
+      legacy_put( &q, values[i] );
+   }
+
+   check = 0;
+   t = now();
+   for ( i = 0; i < HOLD_ROUNDS * count; i++ )
+   {
+      check = legacy_remove( &q );
+      legacy_put( &q, check - ( values[ i % count ] & 0xFFFF ) );
+   }
+   t = now() - t;
+   report( "legacy", "hold", HOLD_ROUNDS * count, t, check );
+
+   while ( q.count > 0 )
+   {
+      legacy_remove( &q );
+   }
+
+   return;
+}
+
+/**
+   bench_heap
+*/
+
+static
+void
+bench_heap( int32_t *values, int32_t count )
+{
+   int32_t i = 0;
+   int32_t check = 0;
+   float64_t t = 0.0;
+   int_pqueue_t *q = int_pqueue_make();
+
+   t = now();
+   for ( i = 0; i < count; i++ )
+   {
+      int_pqueue_put( q, values[i] );
+   }
+   t = now() - t;
+   report( "heap", "put", count, t, int_pqueue_count( q ) );
+
+   t = now();
+   for ( i = 0; i < count; i++ )
+   {
+      check = check ^ int_pqueue_item( q );
+      int_pqueue_remove( q );
+   }
+   t = now() - t;
+   report( "heap", "remove", count, t, check );
+
+   t = now();
+   int_pqueue_put_many( q, values, count );
+   t = now() - t;
+   report( "heap", "put_many", count, t, int_pqueue_count( q ) );
+
+   // hold: remove the top, put it back later
+   check = 0;
+   t = now();
+   for ( i = 0; i < HOLD_ROUNDS * count; i++ )
+   {
+      check = int_pqueue_item( q );
+      int_pqueue_remove( q );
+      int_pqueue_put( q, check - ( values[ i % count ] & 0xFFFF ) );
+   }
+   t = now() - t;
+   report( "heap", "hold", HOLD_ROUNDS * count, t, check );
+
+   int_pqueue_dispose( &q );
+
+   return;
+}
+
+int
+main( int argc, char **argv )
+{
+   int32_t count = DEFAULT_COUNT;
+   int32_t legacy_count = 0;
+   int32_t *values = NULL;
+
+   if ( argc > 1 )
+   {
+      count = atoi( argv[1] );
+   }
+
+   legacy_count = count;
+   if ( legacy_count > MAX_LEGACY_COUNT )
+   {
+      legacy_count = MAX_LEGACY_COUNT;
+   }
+
+   values = make_values( count );
+
+   printf( "\nqueue size %d\n", legacy_count );
+   bench_legacy( values, legacy_count );
+   bench_heap( values, legacy_count );
+
+   if ( count > legacy_count )
+   {
+      printf( "\nqueue size %d\n", count );
+      bench_heap( values, count );
+   }
+
+   free( values );
+
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
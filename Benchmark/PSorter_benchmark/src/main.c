@@ -0,0 +1,204 @@
+/**
+ @file main.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "scaling benchmark of the parallel sorter"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+
+ @section Description
+
+ Measures PSorter sorting a Sequence of random int32_t values with 1, 2,
+ 4, ... up to the given number of threads, and the parallel is_sorted of
+ the result. MSorter, the single threaded merge sort, is timed on the same
+ values as a reference.
+
+ usage: PSorter_benchmark [size] [max threads] [grain size]
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "i_Sequence.h"
+#include "i_MSorter.h"
+#include "i_PSorter.h"
+#include "Rng_Isaac.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEFAULT_SIZE 10000000
+#define DEFAULT_GRAIN_SIZE 16384
+
+/**
+   now
+
+   @return monotonic time in seconds
+*/
+
+static
+float64_t
+now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return ( float64_t ) ts.tv_sec + ( float64_t ) ts.tv_nsec * 1.0e-9;
+}
+
+/**
+   sort_func
+
+   ascending order of int32_t values
+*/
+
+static
+int32_t
+sort_func( int32_t v1, int32_t v2 )
+{
+   return ( v1 > v2 ) - ( v1 < v2 );
+}
+
+/**
+   fill
+
+   put the same pseudo random values into seq each time
+*/
+
+static
+void
+fill( i_sequence_t *seq, int32_t size )
+{
+   int32_t i = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+
+   for ( i = 0; i < size; i++ )
+   {
+      i_sequence_put( seq, ( int32_t ) ( rng_isaac_u32_item( rng ) >> 1 ), i );
+      rng_isaac_forth( rng );
+   }
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+/**
+   report
+*/
+
+static
+void
+report( char_t *name, int32_t threads, int32_t size, float64_t t, float64_t t_base, int32_t check )
+{
+   printf
+   (
+      "   %-10s threads %3d %10.2f M items/s   speedup %6.2f   (check %d)\n",
+      name,
+      threads,
+      ( ( float64_t ) size / t ) * 1.0e-6,
+      t_base / t,
+      check
+   );
+
+   return;
+}
+
+int
+main( int argc, char **argv )
+{
+   int32_t size = DEFAULT_SIZE;
+   int32_t max_threads = ( int32_t ) sysconf( _SC_NPROCESSORS_ONLN );
+   int32_t grain_size = DEFAULT_GRAIN_SIZE;
+   int32_t threads = 0;
+   int32_t check = 0;
+   float64_t t = 0.0;
+   float64_t t_base = 0.0;
+   float64_t t_sorted_base = 0.0;
+   i_sequence_t *seq = NULL;
+   protocol_base_t *pb_seq = NULL;
+   i_psorter_t *sorter = NULL;
+
+   if ( argc > 1 )
+   {
+      size = atoi( argv[1] );
+   }
+
+   if ( argc > 2 )
+   {
+      max_threads = atoi( argv[2] );
+   }
+
+   if ( argc > 3 )
+   {
+      grain_size = atoi( argv[3] );
+   }
+
+   if ( max_threads < 1 )
+   {
+      max_threads = 1;
+   }
+
+   seq = i_sequence_make_n( size );
+   pb_seq = ( protocol_base_t * ) seq;
+   i_sequence_ensure_count( seq, size );
+
+   printf( "\nsort %d random int32_t values, grain size %d\n", size, grain_size );
+
+   fill( seq, size );
+   t = now();
+   i_msorter_sort( pb_seq, sort_func );
+   t_base = now() - t;
+   check = i_sequence_item( seq, size / 2 );
+   report( "MSorter", 1, size, t_base, t_base, check );
+
+   for ( threads = 1; threads <= max_threads; threads = 2 * threads )
+   {
+      sorter = i_psorter_make_n( threads, grain_size );
+
+      fill( seq, size );
+      t = now();
+      i_psorter_sort_predefined_comparison_function( sorter, pb_seq );
+      t = now() - t;
+      check = i_sequence_item( seq, size / 2 );
+      report( "sort", threads, size, t, t_base, check );
+
+      t = now();
+      check = i_psorter_is_sorted_predefined_comparison_function( sorter, pb_seq );
+      t = now() - t;
+      if ( threads == 1 )
+      {
+         t_sorted_base = t;
+      }
+      report( "is_sorted", threads, size, t, t_sorted_base, check );
+
+      i_psorter_dispose( &sorter );
+
+      // include max_threads itself when it is not a power of two
+      if ( ( threads < max_threads ) && ( 2 * threads > max_threads ) )
+      {
+         threads = max_threads / 2;
+      }
+   }
+
+   i_sequence_dispose( &seq );
+
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,423 @@
+/**
+ @file main.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "benchmark of batched quaternion operations"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+
+ @section Description
+
+ Measures rotating a cloud of points, composing pairs of quaternions and
+ interpolating pairs of quaternions, in items per second.
+
+ The vector row rotates each point held in a Matvec vector with
+ Quaternion_rotate_vector, and the xyz row rotates each point with
+ Quaternion_rotate_xyz, which returns a new array. The multiply and
+ interpolate rows call Quaternion_multiply and Quaternion_interpolate on
+ one pair of Quaternion_t instances at a time. The batch rows do the same
+ work with Quaternion_rotate_xyz_batch, Quaternion_multiply_batch and
+ Quaternion_slerp_batch on structure of arrays buffers.
+
+ The check column is the largest difference of the batch results from
+ those of the first row of each table.
+
+ usage: Quaternion_benchmark [count]
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "d_Matvec.h"
+#include "d_Quaternion.h"
+#include "Rng_Isaac.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEFAULT_COUNT 1000000
+#define MIN_TIME 0.5
+
+/**
+   now
+
+   @return monotonic time in seconds
+*/
+
+static
+float64_t
+now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return ( float64_t ) ts.tv_sec + ( float64_t ) ts.tv_nsec * 1.0e-9;
+}
+
+/**
+   next_value
+
+   pseudo random value in [-1, 1] from an rng
+*/
+
+static
+float64_t
+next_value( rng_isaac_t *rng )
+{
+   float64_t result = 2.0*rng_isaac_f64_item( rng ) - 1.0;
+
+   rng_isaac_forth( rng );
+
+   return result;
+}
+
+/**
+   fill_unit
+
+   fill four component arrays with pseudo random unit quaternions
+*/
+
+static
+void
+fill_unit( float64_t **q, int32_t count, rng_isaac_t *rng )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   float64_t m = 0.0;
+
+   for ( i = 0; i < count; i++ )
+   {
+      m = 0.0;
+      for ( j = 0; j < 4; j++ )
+      {
+         q[j][i] = next_value( rng );
+         m = m + q[j][i] * q[j][i];
+      }
+
+      m = sqrt( m );
+      for ( j = 0; j < 4; j++ )
+      {
+         q[j][i] = q[j][i] / m;
+      }
+   }
+
+   return;
+}
+
+/**
+   largest_difference
+
+   @return largest difference between items of k pairs of arrays
+*/
+
+static
+float64_t
+largest_difference( float64_t **a, float64_t **b, int32_t k, int32_t count )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   float64_t result = 0.0;
+
+   for ( j = 0; j < k; j++ )
+   {
+      for ( i = 0; i < count; i++ )
+      {
+         if ( fabs( a[j][i] - b[j][i] ) > result )
+         {
+            result = fabs( a[j][i] - b[j][i] );
+         }
+      }
+   }
+
+   return result;
+}
+
+/**
+   report
+*/
+
+static
+void
+report( char_t *name, float64_t rate, float64_t rate_base, float64_t check )
+{
+   printf
+   (
+      "   %-12s %14.0f /s   speedup %7.2f   (check %.2e)\n",
+      name,
+      rate,
+      rate / rate_base,
+      check
+   );
+
+   return;
+}
+
+/**
+   bench_rotate
+*/
+
+static
+void
+bench_rotate( int32_t count )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t n = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+   float64_t t = 0.0;
+   float64_t rate = 0.0;
+   float64_t rate_base = 0.0;
+   float64_t *array = NULL;
+   float64_t *p[3] = { NULL, NULL, NULL };
+   float64_t *base[3] = { NULL, NULL, NULL };
+   float64_t *batch[3] = { NULL, NULL, NULL };
+   d_quaternion_t *q = d_quaternion_make_from_roll_pitch_yaw( 0.3, -0.2, 1.1 );
+   d_matvec_t *v = d_matvec_make_column_vector( 3 );
+
+   for ( j = 0; j < 3; j++ )
+   {
+      p[j] = ( float64_t * ) calloc( count, sizeof( float64_t ) );
+      base[j] = ( float64_t * ) calloc( count, sizeof( float64_t ) );
+      batch[j] = ( float64_t * ) calloc( count, sizeof( float64_t ) );
+      for ( i = 0; i < count; i++ )
+      {
+         p[j][i] = next_value( rng );
+      }
+   }
+
+   t = now();
+   n = 0;
+   while ( ( n == 0 ) || ( now() - t < MIN_TIME ) )
+   {
+      for ( i = 0; i < count; i++ )
+      {
+         d_matvec_vector_put_x( v, p[0][i] );
+         d_matvec_vector_put_y( v, p[1][i] );
+         d_matvec_vector_put_z( v, p[2][i] );
+         d_quaternion_rotate_vector( q, v );
+         base[0][i] = d_matvec_vector_x( v );
+         base[1][i] = d_matvec_vector_y( v );
+         base[2][i] = d_matvec_vector_z( v );
+      }
+      n = n + 1;
+   }
+   rate_base = ( float64_t ) count * n / ( now() - t );
+   report( "vector", rate_base, rate_base, 0.0 );
+
+   t = now();
+   n = 0;
+   while ( ( n == 0 ) || ( now() - t < MIN_TIME ) )
+   {
+      for ( i = 0; i < count; i++ )
+      {
+         array = d_quaternion_rotate_xyz( q, p[0][i], p[1][i], p[2][i] );
+         base[0][i] = array[0];
+         base[1][i] = array[1];
+         base[2][i] = array[2];
+         free( array );
+      }
+      n = n + 1;
+   }
+   rate = ( float64_t ) count * n / ( now() - t );
+   report( "xyz", rate, rate_base, 0.0 );
+
+   t = now();
+   n = 0;
+   while ( ( n == 0 ) || ( now() - t < MIN_TIME ) )
+   {
+      for ( j = 0; j < 3; j++ )
+      {
+         memcpy( batch[j], p[j], count * sizeof( float64_t ) );
+      }
+      d_quaternion_rotate_xyz_batch( q, batch[0], batch[1], batch[2], count );
+      n = n + 1;
+   }
+   rate = ( float64_t ) count * n / ( now() - t );
+   report( "batch", rate, rate_base, largest_difference( base, batch, 3, count ) );
+
+   for ( j = 0; j < 3; j++ )
+   {
+      free( p[j] );
+      free( base[j] );
+      free( batch[j] );
+   }
+
+   d_quaternion_dispose( &q );
+   d_matvec_dispose( &v );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+/**
+   bench_pairs
+
+   time multiplying or interpolating pairs of quaternions, one pair of
+   Quaternion_t instances at a time and as a batch
+*/
+
+static
+void
+bench_pairs( int32_t is_multiply, int32_t count )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t n = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 4321 );
+   float64_t t = 0.0;
+   float64_t rate = 0.0;
+   float64_t rate_base = 0.0;
+   float64_t *a[4] = { NULL, NULL, NULL, NULL };
+   float64_t *b[4] = { NULL, NULL, NULL, NULL };
+   float64_t *base[4] = { NULL, NULL, NULL, NULL };
+   float64_t *batch[4] = { NULL, NULL, NULL, NULL };
+   d_quaternion_t **qa = ( d_quaternion_t ** ) calloc( count, sizeof( d_quaternion_t * ) );
+   d_quaternion_t **qb = ( d_quaternion_t ** ) calloc( count, sizeof( d_quaternion_t * ) );
+
+   for ( j = 0; j < 4; j++ )
+   {
+      a[j] = ( float64_t * ) calloc( count, sizeof( float64_t ) );
+      b[j] = ( float64_t * ) calloc( count, sizeof( float64_t ) );
+      base[j] = ( float64_t * ) calloc( count, sizeof( float64_t ) );
+      batch[j] = ( float64_t * ) calloc( count, sizeof( float64_t ) );
+   }
+
+   fill_unit( a, count, rng );
+   fill_unit( b, count, rng );
+
+   // keep b close to a, as consecutive poses are, so that interpolating
+   // linearly gives nearly the same result as slerp
+   for ( i = 0; ( is_multiply == 0 ) && ( i < count ); i++ )
+   {
+      for ( j = 0; j < 4; j++ )
+      {
+         b[j][i] = a[j][i] + 0.01 * b[j][i];
+      }
+   }
+
+   for ( i = 0; i < count; i++ )
+   {
+      qa[i] = d_quaternion_make( a[0][i], a[1][i], a[2][i], a[3][i] );
+      qb[i] = d_quaternion_make( b[0][i], b[1][i], b[2][i], b[3][i] );
+      if ( is_multiply == 0 )
+      {
+         d_quaternion_normalize( qb[i] );
+         b[0][i] = d_quaternion_q0( qb[i] );
+         b[1][i] = d_quaternion_q1( qb[i] );
+         b[2][i] = d_quaternion_q2( qb[i] );
+         b[3][i] = d_quaternion_q3( qb[i] );
+      }
+   }
+
+   t = now();
+   n = 0;
+   while ( ( n == 0 ) || ( now() - t < MIN_TIME ) )
+   {
+      for ( i = 0; i < count; i++ )
+      {
+         d_quaternion_set( qa[i], a[0][i], 0 );
+         d_quaternion_set( qa[i], a[1][i], 1 );
+         d_quaternion_set( qa[i], a[2][i], 2 );
+         d_quaternion_set( qa[i], a[3][i], 3 );
+
+         if ( is_multiply == 1 )
+         {
+            d_quaternion_multiply( qa[i], qb[i] );
+         }
+         else
+         {
+            d_quaternion_interpolate( qa[i], qb[i], 0.5, 0.5 );
+         }
+
+         base[0][i] = d_quaternion_q0( qa[i] );
+         base[1][i] = d_quaternion_q1( qa[i] );
+         base[2][i] = d_quaternion_q2( qa[i] );
+         base[3][i] = d_quaternion_q3( qa[i] );
+      }
+      n = n + 1;
+   }
+   rate_base = ( float64_t ) count * n / ( now() - t );
+   report( ( is_multiply == 1 ) ? "multiply" : "interpolate", rate_base, rate_base, 0.0 );
+
+   t = now();
+   n = 0;
+   while ( ( n == 0 ) || ( now() - t < MIN_TIME ) )
+   {
+      for ( j = 0; j < 4; j++ )
+      {
+         memcpy( batch[j], a[j], count * sizeof( float64_t ) );
+      }
+
+      if ( is_multiply == 1 )
+      {
+         d_quaternion_multiply_batch( batch[0], batch[1], batch[2], batch[3], b[0], b[1], b[2], b[3], count );
+      }
+      else
+      {
+         d_quaternion_slerp_batch( batch[0], batch[1], batch[2], batch[3], b[0], b[1], b[2], b[3], 0.5, count );
+      }
+      n = n + 1;
+   }
+   rate = ( float64_t ) count * n / ( now() - t );
+   report( "batch", rate, rate_base, largest_difference( base, batch, 4, count ) );
+
+   for ( i = 0; i < count; i++ )
+   {
+      d_quaternion_dispose( &qa[i] );
+      d_quaternion_dispose( &qb[i] );
+   }
+   free( qa );
+   free( qb );
+
+   for ( j = 0; j < 4; j++ )
+   {
+      free( a[j] );
+      free( b[j] );
+      free( base[j] );
+      free( batch[j] );
+   }
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+int
+main( int argc, char **argv )
+{
+   int32_t count = DEFAULT_COUNT;
+
+   if ( argc > 1 )
+   {
+      count = atoi( argv[1] );
+   }
+
+   printf( "\nrotate %d points by one quaternion\n", count );
+   bench_rotate( count );
+
+   printf( "\nmultiply %d pairs of quaternions\n", count );
+   bench_pairs( 1, count );
+
+   printf( "\ninterpolate half way between %d pairs of quaternions\n", count );
+   bench_pairs( 0, count );
+
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
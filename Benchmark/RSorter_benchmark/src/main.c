@@ -0,0 +1,317 @@
+/**
+ @file main.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "benchmark of the radix sorter"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+
+ @section Description
+
+ Measures sorting random int32_t ids and increasing, jittered uint64_t
+ timestamps in a Sequence. RSorter radix sorts both, QSorter quicksorts
+ the ids, and the C library qsort sorts a plain array of the same values
+ as a reference.
+
+ usage: RSorter_benchmark [size] [rounds]
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "i_Sequence.h"
+#include "i_QSorter.h"
+#include "i_RSorter.h"
+#include "u64_Sequence.h"
+#include "u64_RSorter.h"
+#include "Rng_Isaac.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEFAULT_SIZE 4000000
+#define DEFAULT_ROUNDS 3
+
+/**
+   now
+
+   @return monotonic time in seconds
+*/
+
+static
+float64_t
+now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return ( float64_t ) ts.tv_sec + ( float64_t ) ts.tv_nsec * 1.0e-9;
+}
+
+/**
+   sort_func
+
+   ascending order of int32_t values
+*/
+
+static
+int32_t
+sort_func( int32_t v1, int32_t v2 )
+{
+   return ( v1 > v2 ) - ( v1 < v2 );
+}
+
+/**
+   compare_int32, compare_uint64
+
+   qsort comparison functions
+*/
+
+static
+int
+compare_int32( const void *a, const void *b )
+{
+   int32_t x = *( int32_t * ) a;
+   int32_t y = *( int32_t * ) b;
+
+   return ( x > y ) - ( x < y );
+}
+
+static
+int
+compare_uint64( const void *a, const void *b )
+{
+   uint64_t x = *( uint64_t * ) a;
+   uint64_t y = *( uint64_t * ) b;
+
+   return ( x > y ) - ( x < y );
+}
+
+/**
+   make_ids
+
+   @return size pseudo random int32_t ids
+*/
+
+static
+int32_t *
+make_ids( int32_t size )
+{
+   int32_t i = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+   int32_t *result = ( int32_t * ) calloc( size, sizeof( int32_t ) );
+
+   for ( i = 0; i < size; i++ )
+   {
+      result[i] = rng_isaac_i32_item( rng );
+      rng_isaac_forth( rng );
+   }
+
+   rng_isaac_dispose( &rng );
+
+   return result;
+}
+
+/**
+   make_timestamps
+
+   @return size nanosecond timestamps, mostly increasing with some
+   events arriving up to a millisecond late
+*/
+
+static
+uint64_t *
+make_timestamps( int32_t size )
+{
+   int32_t i = 0;
+   uint32_t x = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 4321 );
+   uint64_t t = 1514764800000000000u;
+   uint64_t *result = ( uint64_t * ) calloc( size, sizeof( uint64_t ) );
+
+   for ( i = 0; i < size; i++ )
+   {
+      x = rng_isaac_u32_item( rng );
+      rng_isaac_forth( rng );
+      t = t + ( x >> 22 );
+      result[i] = t - ( ( x & 0xFF ) < 16 ? ( x >> 12 ) % 1000000u : 0 );
+   }
+
+   rng_isaac_dispose( &rng );
+
+   return result;
+}
+
+/**
+   report
+*/
+
+static
+void
+report( char_t *name, int32_t size, int32_t rounds, float64_t t, float64_t t_base, int32_t check )
+{
+   printf
+   (
+      "   %-8s %10.2f M items/s   speedup %6.2f   (check %d)\n",
+      name,
+      ( ( float64_t ) size * rounds / t ) * 1.0e-6,
+      t_base / t,
+      check
+   );
+
+   return;
+}
+
+/**
+   bench_ids
+*/
+
+static
+void
+bench_ids( int32_t size, int32_t rounds )
+{
+   int32_t i = 0;
+   int32_t r = 0;
+   int32_t check = 0;
+   float64_t t = 0.0;
+   float64_t t_qsort = 0.0;
+   float64_t t_qsorter = 0.0;
+   float64_t t_rsorter = 0.0;
+   i_rsorter_t *rsorter = i_rsorter_make();
+   int32_t *ids = make_ids( size );
+   int32_t *array = ( int32_t * ) calloc( size, sizeof( int32_t ) );
+   i_sequence_t *seq = i_sequence_make_n( size );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+
+   i_sequence_ensure_count( seq, size );
+
+   printf( "\nsort %d random int32_t ids, %d rounds\n", size, rounds );
+
+   for ( r = 0; r < rounds; r++ )
+   {
+      memcpy( array, ids, size * sizeof( int32_t ) );
+      t = now();
+      qsort( array, size, sizeof( int32_t ), compare_int32 );
+      t_qsort = t_qsort + now() - t;
+
+      for ( i = 0; i < size; i++ )
+      {
+         i_sequence_put( seq, ids[i], i );
+      }
+      t = now();
+      i_qsorter_sort( pb_seq, sort_func );
+      t_qsorter = t_qsorter + now() - t;
+
+      for ( i = 0; i < size; i++ )
+      {
+         i_sequence_put( seq, ids[i], i );
+      }
+      t = now();
+      i_rsorter_sort_predefined_comparison_function( rsorter, pb_seq );
+      t_rsorter = t_rsorter + now() - t;
+   }
+
+   check = ( i_sequence_item( seq, size / 2 ) == array[size / 2] );
+
+   report( "qsort", size, rounds, t_qsort, t_qsort, array[size / 2] );
+   report( "QSorter", size, rounds, t_qsorter, t_qsort, check );
+   report( "RSorter", size, rounds, t_rsorter, t_qsort, check );
+
+   i_rsorter_dispose( &rsorter );
+   i_sequence_dispose( &seq );
+   free( array );
+   free( ids );
+
+   return;
+}
+
+/**
+   bench_timestamps
+*/
+
+static
+void
+bench_timestamps( int32_t size, int32_t rounds )
+{
+   int32_t i = 0;
+   int32_t r = 0;
+   int32_t check = 0;
+   float64_t t = 0.0;
+   float64_t t_qsort = 0.0;
+   float64_t t_rsorter = 0.0;
+   u64_rsorter_t *rsorter = u64_rsorter_make();
+   uint64_t *timestamps = make_timestamps( size );
+   uint64_t *array = ( uint64_t * ) calloc( size, sizeof( uint64_t ) );
+   u64_sequence_t *seq = u64_sequence_make_n( size );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+
+   u64_sequence_ensure_count( seq, size );
+
+   printf( "\nsort %d uint64_t timestamps, %d rounds\n", size, rounds );
+
+   for ( r = 0; r < rounds; r++ )
+   {
+      memcpy( array, timestamps, size * sizeof( uint64_t ) );
+      t = now();
+      qsort( array, size, sizeof( uint64_t ), compare_uint64 );
+      t_qsort = t_qsort + now() - t;
+
+      for ( i = 0; i < size; i++ )
+      {
+         u64_sequence_put( seq, timestamps[i], i );
+      }
+      t = now();
+      u64_rsorter_sort_predefined_comparison_function( rsorter, pb_seq );
+      t_rsorter = t_rsorter + now() - t;
+   }
+
+   check = ( u64_sequence_item( seq, size / 2 ) == array[size / 2] );
+
+   report( "qsort", size, rounds, t_qsort, t_qsort, 1 );
+   report( "RSorter", size, rounds, t_rsorter, t_qsort, check );
+
+   u64_rsorter_dispose( &rsorter );
+   u64_sequence_dispose( &seq );
+   free( array );
+   free( timestamps );
+
+   return;
+}
+
+int
+main( int argc, char **argv )
+{
+   int32_t size = DEFAULT_SIZE;
+   int32_t rounds = DEFAULT_ROUNDS;
+
+   if ( argc > 1 )
+   {
+      size = atoi( argv[1] );
+   }
+
+   if ( argc > 2 )
+   {
+      rounds = atoi( argv[2] );
+   }
+
+   bench_ids( size, rounds );
+   bench_timestamps( size, rounds );
+
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
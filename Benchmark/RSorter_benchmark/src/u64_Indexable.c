@@ -0,0 +1,38 @@
+/**
+ @file u64_Indexable.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "implementation file for Indexable of uint64_ts"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Defines for u64_Indexable type.
+
+*/
+
+#include "u64_Indexable.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define Prefix u64
+#define Type uint64_t
+
+#include "P_Indexable.c"
+
+#undef Prefix
+#undef Type
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,44 @@
+/**
+ @file u64_Sequence.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "implementation file for sequences of uint64_ts"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Defines for u64_Sequence type.
+
+*/
+
+#include "u64_Sequence.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define VALUE_DEEP_DISPOSE_FUNCTION( arg ) 
+#define VALUE_DEEP_CLONE_FUNCTION( arg ) ( arg )
+#define VALUE_DEEP_EQUAL_FUNCTION( arg1, arg2 ) ( (arg1) == (arg2) )
+
+#define Prefix u64
+#define Type uint64_t
+#define Type_Code uint64_type_code
+
+#include "Sequence.c"
+
+#undef Prefix 
+#undef Type 
+#undef Type_Code
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
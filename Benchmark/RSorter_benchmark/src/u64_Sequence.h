@@ -0,0 +1,48 @@
+/**
+ @file u64_Sequence.h
+ @author Greg Lee
+ @version 0.0
+ @brief: "include file for sequences of uint64_ts"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Defines to make a sequence into a u64_sequence.
+
+*/
+
+#ifndef U64_SEQUENCE_H_
+#define U64_SEQUENCE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PROTOCOLS_ENABLED
+
+#include "base.h"
+#include "protocol.h"
+
+#define Prefix u64
+#define Type uint64_t
+
+#include "Sequence.h"
+
+#undef Prefix 
+#undef Type 
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* U64_SEQUENCE_H_ */
+
+/* End of file */
+
+
+
@@ -0,0 +1,244 @@
+/**
+ @file main.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "benchmark of bulk access to the isaac rng"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+
+ @section Description
+
+ Measures filling an array with pseudo random numbers, in numbers per
+ second and megabytes per second of output.
+
+ The item rows fill the array one number at a time with rng_isaac_u64_item,
+ rng_isaac_u32_item or rng_isaac_f64_item and rng_isaac_forth, each of which
+ locks the rng. The fill rows fill the same array with one call of
+ rng_isaac_fill_u64, rng_isaac_fill_u32 or rng_isaac_fill_f64.
+
+ The check column is the number of items that differ from those of the
+ item row, which should be zero.
+
+ usage: Rng_Isaac_benchmark [count]
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "Rng_Isaac.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEFAULT_COUNT 1000000
+#define MIN_TIME 0.5
+
+/**
+   kinds of number filled
+*/
+
+#define KIND_U64 0
+#define KIND_U32 1
+#define KIND_F64 2
+
+static char_t *kind_names[] = { "u64", "u32", "f64" };
+static int32_t kind_sizes[] = { 8, 4, 8 };
+
+/**
+   now
+
+   @return monotonic time in seconds
+*/
+
+static
+float64_t
+now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return ( float64_t ) ts.tv_sec + ( float64_t ) ts.tv_nsec * 1.0e-9;
+}
+
+/**
+   fill_items
+
+   fill array with count numbers of the given kind, one at a time
+*/
+
+static
+void
+fill_items( int32_t kind, rng_isaac_t *rng, void *array, int32_t count )
+{
+   int32_t i = 0;
+   uint64_t *pu64 = ( uint64_t * ) array;
+   uint32_t *pu32 = ( uint32_t * ) array;
+   float64_t *pf64 = ( float64_t * ) array;
+
+   for ( i = 0; i < count; i++ )
+   {
+      if ( kind == KIND_U64 )
+      {
+         pu64[i] = rng_isaac_u64_item( rng );
+      }
+      else if ( kind == KIND_U32 )
+      {
+         pu32[i] = rng_isaac_u32_item( rng );
+      }
+      else
+      {
+         pf64[i] = rng_isaac_f64_item( rng );
+      }
+      rng_isaac_forth( rng );
+   }
+
+   return;
+}
+
+/**
+   fill_bulk
+
+   fill array with count numbers of the given kind in one call
+*/
+
+static
+void
+fill_bulk( int32_t kind, rng_isaac_t *rng, void *array, int32_t count )
+{
+   if ( kind == KIND_U64 )
+   {
+      rng_isaac_fill_u64( rng, ( uint64_t * ) array, count );
+   }
+   else if ( kind == KIND_U32 )
+   {
+      rng_isaac_fill_u32( rng, ( uint32_t * ) array, count );
+   }
+   else
+   {
+      rng_isaac_fill_f64( rng, ( float64_t * ) array, count );
+   }
+
+   return;
+}
+
+/**
+   time_fill
+
+   @return numbers per second filled, one at a time or in bulk, from a
+   fresh rng
+*/
+
+static
+float64_t
+time_fill( int32_t is_bulk, int32_t kind, void *array, int32_t count )
+{
+   int32_t n = 0;
+   float64_t t = 0.0;
+   rng_isaac_t *rng = NULL;
+
+   t = now();
+   n = 0;
+   while ( ( n == 0 ) || ( now() - t < MIN_TIME ) )
+   {
+      rng = rng_isaac_make_with_seed( 12345 );
+
+      if ( is_bulk == 1 )
+      {
+         fill_bulk( kind, rng, array, count );
+      }
+      else
+      {
+         fill_items( kind, rng, array, count );
+      }
+
+      rng_isaac_dispose( &rng );
+      n = n + 1;
+   }
+
+   return ( float64_t ) count * n / ( now() - t );
+}
+
+/**
+   report
+*/
+
+static
+void
+report( char_t *name, int32_t kind, float64_t rate, float64_t rate_base, int32_t check )
+{
+   printf
+   (
+      "   %-5s %-4s %14.0f /s %9.1f MB/s   speedup %6.2f   (check %d)\n",
+      name,
+      kind_names[kind],
+      rate,
+      rate * kind_sizes[kind] / 1.0e6,
+      rate / rate_base,
+      check
+   );
+
+   return;
+}
+
+int
+main( int argc, char **argv )
+{
+   int32_t kind = 0;
+   int32_t count = DEFAULT_COUNT;
+   int32_t check = 0;
+   int32_t i = 0;
+   float64_t rate = 0.0;
+   float64_t rate_base = 0.0;
+   uint64_t *array = NULL;
+   uint64_t *array_base = NULL;
+
+   if ( argc > 1 )
+   {
+      count = atoi( argv[1] );
+   }
+
+   array = ( uint64_t * ) calloc( count, sizeof( uint64_t ) );
+   array_base = ( uint64_t * ) calloc( count, sizeof( uint64_t ) );
+
+   printf( "\nfill an array with %d pseudo random numbers\n", count );
+
+   for ( kind = KIND_U64; kind <= KIND_F64; kind++ )
+   {
+      rate_base = time_fill( 0, kind, array_base, count );
+      report( "item", kind, rate_base, rate_base, 0 );
+
+      rate = time_fill( 1, kind, array, count );
+
+      check = 0;
+      for ( i = 0; i < count * kind_sizes[kind] / 8; i++ )
+      {
+         if ( array[i] != array_base[i] )
+         {
+            check = check + 1;
+         }
+      }
+
+      report( "fill", kind, rate, rate_base, check );
+   }
+
+   free( array );
+   free( array_base );
+
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
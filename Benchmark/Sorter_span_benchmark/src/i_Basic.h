@@ -0,0 +1,43 @@
+/**
+ @file i_Basic.h
+ @author Greg Lee
+ @version 0.0
+ @brief: "include file for Basic protocol objects"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Defines to make Basic_t.
+
+*/
+
+#ifndef P_BASIC_H
+#define P_BASIC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "base.h"
+
+#define Prefix i
+
+#include "P_Basic.h"
+
+#undef Prefix
+ 
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* P_BASIC_H */
+
+/* End of file */
+
+
+
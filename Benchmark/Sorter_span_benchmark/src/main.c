@@ -0,0 +1,301 @@
+/**
+ @file main.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "benchmark of sorting through the P_Indexable span"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+
+ @section Description
+
+ Measures sorting a Sequence of random int32_t values of growing size.
+
+ The legacy row reproduces the previous QSorter path, which read and wrote
+ every item through the P_Indexable item and put functions, each of which
+ checks its arguments and takes the container mutex. The other rows call
+ QSorter_sort, MSorter_sort and HSorter_sort, which now fetch the item
+ array with P_Indexable_span and sort it directly.
+
+ usage: Sorter_span_benchmark [rounds per size]
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "i_Sequence.h"
+#include "i_QSorter.h"
+#include "i_MSorter.h"
+#include "i_HSorter.h"
+#include "Rng_Isaac.h"
+
+#include "Protocol_Base.ph"
+#include "P_Indexable.ph"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEFAULT_ROUNDS 5
+#define SIZE_COUNT 4
+
+static int32_t sizes[SIZE_COUNT] = { 10000, 100000, 1000000, 4000000 };
+
+/**
+   kinds of sort timed
+*/
+
+#define KIND_LEGACY 0
+#define KIND_QSORTER 1
+#define KIND_MSORTER 2
+#define KIND_HSORTER 3
+
+static char_t *kind_names[] = { "legacy", "QSorter", "MSorter", "HSorter" };
+
+/**
+   now
+
+   @return monotonic time in seconds
+*/
+
+static
+float64_t
+now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return ( float64_t ) ts.tv_sec + ( float64_t ) ts.tv_nsec * 1.0e-9;
+}
+
+/**
+   sort_func
+
+   ascending order of int32_t values
+*/
+
+static
+int32_t
+sort_func( int32_t v1, int32_t v2 )
+{
+   return ( v1 > v2 ) - ( v1 < v2 );
+}
+
+/**
+   next_value
+
+   pseudo random value from an rng
+*/
+
+static
+int32_t
+next_value( rng_isaac_t *rng )
+{
+   int32_t result = ( int32_t ) ( rng_isaac_u32_item( rng ) >> 1 );
+
+   rng_isaac_forth( rng );
+
+   return result;
+}
+
+/**
+   legacy_sort
+
+   the previous QSorter quicksort, one protocol call per item access
+*/
+
+static
+void
+legacy_sort
+(
+   protocol_base_t *p_indexable,
+   int32_t (*func)( int32_t a, int32_t b ),
+   int32_t start,
+   int32_t stop
+)
+{
+   int32_t pivot;
+   int32_t temp;
+   int32_t (*item)( protocol_base_t *p_indexable, int32_t index ) = NULL;
+   void (*put)( protocol_base_t *p_indexable, int32_t value, int32_t index ) = NULL;
+
+   int32_t left = 0;
+   int32_t right = 0;
+   int32_t p = 0;
+
+   item = ( *p_indexable ).get_function( P_INDEXABLE_TYPE, P_INDEXABLE_ITEM );
+   put = ( *p_indexable ).get_function( P_INDEXABLE_TYPE, P_INDEXABLE_PUT );
+
+   while ( start < stop )
+   {
+      left = start;
+      p = start + ( stop - start ) / 2;
+      right = stop;
+
+      pivot = item( p_indexable, p );
+
+      while ( 1 )
+      {
+         while ( ( left <= right ) && ( func( item( p_indexable, left ), pivot ) <= 0 ) )
+         {
+            left++;
+         }
+
+         while ( ( left <= right ) && ( func( item( p_indexable, right ), pivot ) > 0 ) )
+         {
+            right--;
+         }
+
+         if ( left > right )
+         {
+            break;
+         }
+
+         temp = item( p_indexable, left );
+         put( p_indexable, item( p_indexable, right ), left );
+         put( p_indexable, temp, right );
+
+         if ( p == right )
+         {
+            p = left;
+         }
+
+         left++;
+         right--;
+      }
+
+      put( p_indexable, item( p_indexable, right ), p );
+      put( p_indexable, pivot, right );
+      right--;
+
+      if ( ( right - start ) < ( stop - left ) )
+      {
+         legacy_sort( p_indexable, func, start, right );
+         start = left;
+      }
+      else
+      {
+         legacy_sort( p_indexable, func, left, stop );
+         stop = right;
+      }
+   }
+
+   return;
+}
+
+/**
+   bench
+
+   fill and sort a sequence rounds times, report items sorted per second
+*/
+
+static
+void
+bench( int32_t kind, int32_t size, int32_t rounds )
+{
+   int32_t i = 0;
+   int32_t r = 0;
+   int32_t check = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+   float64_t t = 0.0;
+   float64_t t_sort = 0.0;
+   i_sequence_t *seq = i_sequence_make_n( size );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+
+   i_sequence_ensure_count( seq, size );
+
+   for ( r = 0; r < rounds; r++ )
+   {
+      for ( i = 0; i < size; i++ )
+      {
+         i_sequence_put( seq, next_value( rng ), i );
+      }
+
+      t = now();
+
+      switch ( kind )
+      {
+         case KIND_LEGACY:
+         {
+            legacy_sort( pb_seq, sort_func, 0, size - 1 );
+            break;
+         }
+
+         case KIND_QSORTER:
+         {
+            i_qsorter_sort( pb_seq, sort_func );
+            break;
+         }
+
+         case KIND_MSORTER:
+         {
+            i_msorter_sort( pb_seq, sort_func );
+            break;
+         }
+
+         default:
+         {
+            i_hsorter_sort( pb_seq, sort_func );
+            break;
+         }
+      }
+
+      t_sort = t_sort + now() - t;
+
+      check = check ^ i_sequence_item( seq, size / 2 );
+   }
+
+   printf
+   (
+      "   %-8s size %8d %10.2f M items/s   (check %d)\n",
+      kind_names[kind],
+      size,
+      ( ( float64_t ) size * rounds / t_sort ) * 1.0e-6,
+      check
+   );
+
+   i_sequence_dispose( &seq );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+int
+main( int argc, char **argv )
+{
+   int32_t rounds = DEFAULT_ROUNDS;
+   int32_t kind = 0;
+   int32_t i = 0;
+
+   if ( argc > 1 )
+   {
+      rounds = atoi( argv[1] );
+   }
+
+   printf( "\nsort random int32_t values in a Sequence, %d rounds per size\n", rounds );
+
+   for ( i = 0; i < SIZE_COUNT; i++ )
+   {
+      for ( kind = KIND_LEGACY; kind <= KIND_HSORTER; kind++ )
+      {
+         bench( kind, sizes[i], rounds );
+      }
+   }
+
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,430 @@
+/**
+ @file main.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "benchmark of string_t hash codes"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+
+ @section Description
+
+ Measures throughput and distribution quality of the string_t hash code
+ against the previous byte at a time hash, over several realistic key sets:
+ short sequential identifiers, file paths sharing long prefixes, random
+ words and long delimited text lines.
+
+ For each key set it reports hashing speed, the number of colliding 32 bit
+ hash codes (with the number expected from an ideal hash), and the
+ normalized chi-square and maximum bucket load when the hash codes are
+ reduced to buckets with a power of two mask and with a prime modulus.
+ A chi-square near 1.0 means the keys are spread like random values.
+
+ usage: String_hash_benchmark [count]
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "String.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEFAULT_COUNT 1000000
+
+// hash at least this many bytes per timing run
+#define MIN_TIMED_BYTES 200000000
+
+#define PRIME_BUCKET_COUNT 1048573
+
+#define HASH_PRIME_NUMBER 8388593U
+
+/**
+   key set names
+*/
+
+static char_t *key_set_names[] = { "sequential", "paths", "words", "lines" };
+
+#define KEY_SET_COUNT 4
+
+/**
+   now
+
+   @return monotonic time in seconds
+*/
+
+static
+float64_t
+now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return ( float64_t ) ts.tv_sec + ( float64_t ) ts.tv_nsec * 1.0e-9;
+}
+
+/**
+   legacy_hash
+
+   the previous string_t hash code, one byte and one modulo per character
+*/
+
+static
+int32_t
+legacy_hash( char_t *s )
+{
+   uint32_t result = 0;
+   int32_t i = 0;
+   int32_t count = strlen( s );
+
+   for( i = 0; i < count; i++ )
+   {
+      result = ( ( result % HASH_PRIME_NUMBER ) << 8 ) + ( uint32_t ) s[i];
+   }
+
+   return ( int32_t ) result;
+}
+
+/**
+   scramble
+
+   distinct 32 bit value for each index
+*/
+
+static
+uint32_t
+scramble( int32_t i )
+{
+   return ( uint32_t ) i * 2654435761u;
+}
+
+/**
+   make_key
+
+   write key i of the given key set into buffer, all keys in a set are
+   distinct
+*/
+
+static
+void
+make_key( int32_t set, int32_t i, char_t *buffer )
+{
+   uint32_t x = scramble( i );
+   int32_t j = 0;
+
+   switch ( set )
+   {
+      case 0:
+      {
+         sprintf( buffer, "key%d", i );
+         break;
+      }
+
+      case 1:
+      {
+         sprintf
+         (
+            buffer,
+            "/home/projects/library/source/module_%03d/component_%04d/file.c",
+            i % 997,
+            i / 997
+         );
+         break;
+      }
+
+      case 2:
+      {
+         // base 26 digits of a scrambled index, at least four letters
+         j = 0;
+         do
+         {
+            buffer[j] = 'a' + ( x % 26 );
+            x = x / 26;
+            j = j + 1;
+         }
+         while ( ( x > 0 ) || ( j < 4 ) );
+         buffer[j] = 0;
+         break;
+      }
+
+      default:
+      {
+         sprintf
+         (
+            buffer,
+            "2018-01-01T%02d:%02d:%02d,sensor_%06d,temperature,%10.4f,humidity,%8.3f,status,ok",
+            ( i / 3600 ) % 24,
+            ( i / 60 ) % 60,
+            i % 60,
+            i % 100000,
+            ( float64_t ) ( x % 100000 ) * 0.001,
+            ( float64_t ) ( x % 7919 ) * 0.01
+         );
+         break;
+      }
+   }
+
+   return;
+}
+
+/**
+   make_keys
+*/
+
+static
+char_t **
+make_keys( int32_t set, int32_t count, int64_t *byte_count )
+{
+   int32_t i = 0;
+   char_t buffer[256] = {0};
+   char_t **result = ( char_t ** ) calloc( count, sizeof( char_t * ) );
+
+   *byte_count = 0;
+
+   for ( i = 0; i < count; i++ )
+   {
+      make_key( set, i, buffer );
+      result[i] = strdup( buffer );
+      *byte_count = *byte_count + strlen( buffer );
+   }
+
+   return result;
+}
+
+/**
+   time_hash
+
+   hash every key repeatedly and report the speed, fills hashes
+*/
+
+static
+void
+time_hash
+(
+   char_t *name,
+   int32_t( *hash )( char_t * ),
+   char_t **keys,
+   int32_t count,
+   int64_t byte_count,
+   uint32_t *hashes
+)
+{
+   int32_t i = 0;
+   int32_t pass = 0;
+   int32_t passes = 1 + ( int32_t ) ( MIN_TIMED_BYTES / ( byte_count + 1 ) );
+   uint32_t check = 0;
+   float64_t t = 0.0;
+
+   t = now();
+   for ( pass = 0; pass < passes; pass++ )
+   {
+      for ( i = 0; i < count; i++ )
+      {
+         hashes[i] = ( uint32_t ) hash( keys[i] );
+         check = check + hashes[i];
+      }
+   }
+   t = now() - t;
+
+   printf
+   (
+      "   %-8s %10.1f MB/s %10.2f Mhash/s   (check %08x)\n",
+      name,
+      ( ( float64_t ) byte_count * passes / t ) * 1.0e-6,
+      ( ( float64_t ) count * passes / t ) * 1.0e-6,
+      check
+   );
+
+   return;
+}
+
+/**
+   compare_uint32
+*/
+
+static
+int
+compare_uint32( const void *a, const void *b )
+{
+   uint32_t x = *( uint32_t * ) a;
+   uint32_t y = *( uint32_t * ) b;
+
+   return ( x > y ) - ( x < y );
+}
+
+/**
+   bucket_stats
+
+   normalized chi-square and maximum load of hashes reduced to buckets
+*/
+
+static
+void
+bucket_stats
+(
+   uint32_t *hashes,
+   int32_t count,
+   int32_t bucket_count,
+   int32_t use_mask,
+   float64_t *chi_square,
+   int32_t *max_load
+)
+{
+   int32_t i = 0;
+   int32_t *buckets = ( int32_t * ) calloc( bucket_count, sizeof( int32_t ) );
+   uint32_t b = 0;
+   float64_t expected = ( float64_t ) count / bucket_count;
+   float64_t d = 0.0;
+   float64_t sum = 0.0;
+
+   *max_load = 0;
+
+   for ( i = 0; i < count; i++ )
+   {
+      if ( use_mask == 1 )
+      {
+         b = hashes[i] & ( uint32_t ) ( bucket_count - 1 );
+      }
+      else
+      {
+         b = hashes[i] % ( uint32_t ) bucket_count;
+      }
+
+      buckets[b] = buckets[b] + 1;
+
+      if ( buckets[b] > *max_load )
+      {
+         *max_load = buckets[b];
+      }
+   }
+
+   for ( i = 0; i < bucket_count; i++ )
+   {
+      d = buckets[i] - expected;
+      sum = sum + d * d / expected;
+   }
+
+   *chi_square = sum / ( bucket_count - 1 );
+
+   free( buckets );
+
+   return;
+}
+
+/**
+   quality
+
+   report collisions and bucket distribution of a set of hashes
+*/
+
+static
+void
+quality( char_t *name, uint32_t *hashes, int32_t count )
+{
+   int32_t i = 0;
+   int32_t collisions = 0;
+   int32_t mask_buckets = 1;
+   int32_t max_mask = 0;
+   int32_t max_prime = 0;
+   float64_t chi_mask = 0.0;
+   float64_t chi_prime = 0.0;
+   uint32_t *sorted = ( uint32_t * ) calloc( count, sizeof( uint32_t ) );
+
+   memcpy( sorted, hashes, count * sizeof( uint32_t ) );
+   qsort( sorted, count, sizeof( uint32_t ), compare_uint32 );
+
+   for ( i = 1; i < count; i++ )
+   {
+      if ( sorted[i] == sorted[i - 1] )
+      {
+         collisions = collisions + 1;
+      }
+   }
+
+   while ( mask_buckets < count )
+   {
+      mask_buckets = mask_buckets * 2;
+   }
+
+   bucket_stats( hashes, count, mask_buckets, 1, &chi_mask, &max_mask );
+   bucket_stats( hashes, count, PRIME_BUCKET_COUNT, 0, &chi_prime, &max_prime );
+
+   printf
+   (
+      "   %-8s collisions %8d   mask chi2 %10.3f max %6d   prime chi2 %10.3f max %6d\n",
+      name,
+      collisions,
+      chi_mask,
+      max_mask,
+      chi_prime,
+      max_prime
+   );
+
+   free( sorted );
+
+   return;
+}
+
+int
+main( int argc, char **argv )
+{
+   int32_t count = DEFAULT_COUNT;
+   int32_t set = 0;
+   int32_t i = 0;
+   int64_t byte_count = 0;
+   char_t **keys = NULL;
+   uint32_t *hashes = NULL;
+
+   if ( argc > 1 )
+   {
+      count = atoi( argv[1] );
+   }
+
+   hashes = ( uint32_t * ) calloc( count, sizeof( uint32_t ) );
+
+   for ( set = 0; set < KEY_SET_COUNT; set++ )
+   {
+      keys = make_keys( set, count, &byte_count );
+
+      printf
+      (
+         "\n%s keys, count = %d, mean length %.1f, ideal collisions %.1f\n",
+         key_set_names[set],
+         count,
+         ( float64_t ) byte_count / count,
+         ( ( float64_t ) count * ( count - 1 ) ) / ( 2.0 * 2147483648.0 )
+      );
+
+      time_hash( "legacy", legacy_hash, keys, count, byte_count, hashes );
+      quality( "legacy", hashes, count );
+
+      time_hash( "current", string_hash_code_cstring, keys, count, byte_count, hashes );
+      quality( "current", hashes, count );
+
+      for ( i = 0; i < count; i++ )
+      {
+         free( keys[i] );
+      }
+      free( keys );
+   }
+
+   free( hashes );
+
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,395 @@
+/**
+ @file main.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "benchmark of blocked, parallel and truncated svd"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+
+ @section Description
+
+ Measures the singular value decomposition of a tall float64 matrix with
+ a spread of singular values, by default 1000 by 200.
+
+ The legacy row reproduces the previous Svd_svd, which made two cyclic
+ sweeps of column rotations, reading and writing every item through the
+ Matvec item and put functions, whether or not the sweeps had converged.
+ The jacobi rows run Svd_svd to convergence with one thread and with the
+ given thread count. The top k row asks for the leading k singular values
+ with Svd_set_truncation.
+
+ The check column is the largest relative difference of the leading k
+ singular values from those of the one thread jacobi row.
+
+ usage: Svd_benchmark [rows] [columns] [threads] [k]
+
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "d_Matvec.h"
+#include "d_Svd.h"
+#include "Rng_Isaac.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DEFAULT_ROWS 1000
+#define DEFAULT_COLUMNS 200
+#define DEFAULT_THREAD_COUNT 4
+#define DEFAULT_TRUNCATION 10
+#define MIN_TIME 0.5
+
+/**
+   kinds of decomposition timed
+*/
+
+#define KIND_LEGACY 0
+#define KIND_JACOBI 1
+#define KIND_THREADED 2
+#define KIND_TOP_K 3
+
+static char_t *kind_names[] = { "legacy", "jacobi", "threaded", "top k" };
+
+/**
+   now
+
+   @return monotonic time in seconds
+*/
+
+static
+float64_t
+now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return ( float64_t ) ts.tv_sec + ( float64_t ) ts.tv_nsec * 1.0e-9;
+}
+
+/**
+   next_value
+
+   pseudo random value in [-1, 1] from an rng
+*/
+
+static
+float64_t
+next_value( rng_isaac_t *rng )
+{
+   float64_t result = 2.0*rng_isaac_f64_item( rng ) - 1.0;
+
+   rng_isaac_forth( rng );
+
+   return result;
+}
+
+/**
+   make_input
+
+   @return pseudo random m by n matrix with column j scaled by 0.98^j
+*/
+
+static
+d_matvec_t *
+make_input( int32_t m, int32_t n )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+   d_matvec_t *result = d_matvec_make( m, n );
+   float64_t *pa = d_matvec_as_array( result );
+
+   for ( i = 0; i < m; i++ )
+   {
+      for ( j = 0; j < n; j++ )
+      {
+         pa[i * n + j] = next_value( rng ) * pow( 0.98, j );
+      }
+   }
+
+   rng_isaac_dispose( &rng );
+
+   return result;
+}
+
+/**
+   legacy_rotate
+
+   the previous rotation of columns i1 and i2 of a, and the same rotation
+   of b, one Matvec call per item access
+*/
+
+static
+void
+legacy_rotate( d_matvec_t *a, d_matvec_t *b, int32_t i1, int32_t i2, float64_t rotation_error )
+{
+   int32_t i = 0;
+   int32_t k = 0;
+   int32_t is_swap = 0;
+   float64_t p = 0.0;
+   float64_t q = 0.0;
+   float64_t v = 0.0;
+   float64_t c = 1.0;
+   float64_t s = 0.0;
+   float64_t x = 0.0;
+   float64_t y = 0.0;
+   d_matvec_t *ab[2] = { a, b };
+
+   p = d_matvec_column_vector_dot( a, i1, i2 );
+   q = d_matvec_column_vector_squared_magnitude( a, i1 );
+   v = d_matvec_column_vector_squared_magnitude( a, i2 );
+
+   if ( p * p > rotation_error * ( q * q + v * v ) )
+   {
+      is_swap = ( q < v );
+      q = q - v;
+      v = sqrt( 4.0 * p * p + q * q );
+      c = sqrt( ( v + fabs( q ) ) / ( 2.0 * v ) );
+      s = p / ( v * c );
+   }
+   else
+   {
+      is_swap = ( q < v );
+   }
+
+   if ( ( is_swap == 1 ) || ( s != 0.0 ) )
+   {
+      for ( k = 0; k < 2; k++ )
+      {
+         for ( i = 0; i < d_matvec_rows( ab[k] ); i++ )
+         {
+            if ( is_swap == 0 )
+            {
+               x = c * d_matvec_item( ab[k], i, i1 ) + s * d_matvec_item( ab[k], i, i2 );
+               y = -s * d_matvec_item( ab[k], i, i1 ) + c * d_matvec_item( ab[k], i, i2 );
+            }
+            else
+            {
+               x = c * d_matvec_item( ab[k], i, i2 ) + s * d_matvec_item( ab[k], i, i1 );
+               y = -s * d_matvec_item( ab[k], i, i2 ) + c * d_matvec_item( ab[k], i, i1 );
+            }
+            d_matvec_put( ab[k], x, i, i1 );
+            d_matvec_put( ab[k], y, i, i2 );
+         }
+      }
+   }
+
+   return;
+}
+
+/**
+   legacy_svd
+
+   the previous two sweeps of column rotations
+
+   @return the column norms of the rotated input, largest first
+*/
+
+static
+float64_t *
+legacy_svd( d_matvec_t *input )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+   int32_t n = d_matvec_columns( input );
+   float64_t t = 0.0;
+   float64_t *result = ( float64_t * ) calloc( n, sizeof( float64_t ) );
+   d_matvec_t *a = d_matvec_copied( input );
+   d_matvec_t *b = d_matvec_make( n, n );
+
+   d_matvec_set_to_one( b );
+
+   for ( k = 0; k < 2; k++ )
+   {
+      for ( i = 0; i < n; i++ )
+      {
+         for ( j = i + 1; j < n; j++ )
+         {
+            legacy_rotate( a, b, i, j, 1.0e-12 );
+         }
+      }
+   }
+
+   for ( i = 0; i < n; i++ )
+   {
+      result[i] = sqrt( d_matvec_column_vector_squared_magnitude( a, i ) );
+   }
+
+   // the sweeps leave the values only roughly in order
+   for ( i = 1; i < n; i++ )
+   {
+      for ( j = i; ( j > 0 ) && ( result[j - 1] < result[j] ); j-- )
+      {
+         t = result[j - 1];
+         result[j - 1] = result[j];
+         result[j] = t;
+      }
+   }
+
+   d_matvec_dispose( &a );
+   d_matvec_dispose( &b );
+
+   return result;
+}
+
+/**
+   decompose
+
+   @return the singular values of input from the given kind of svd
+*/
+
+static
+float64_t *
+decompose( int32_t kind, d_matvec_t *input, int32_t thread_count, int32_t truncation )
+{
+   int32_t i = 0;
+   int32_t count = 0;
+   float64_t *result = NULL;
+   d_svd_t *svd = NULL;
+   d_matvec_t *values = NULL;
+
+   if ( kind == KIND_LEGACY )
+   {
+      result = legacy_svd( input );
+   }
+   else
+   {
+      svd = d_svd_make();
+      d_svd_set_input( svd, d_matvec_copied( input ) );
+      d_svd_set_rotation_error( svd, 1.0e-12 );
+
+      if ( kind == KIND_THREADED )
+      {
+         d_svd_set_thread_count( svd, thread_count );
+      }
+
+      if ( kind == KIND_TOP_K )
+      {
+         d_svd_set_truncation( svd, truncation );
+      }
+
+      d_svd_svd( svd );
+
+      values = d_svd_singular_values( svd );
+      count = d_matvec_vector_length( values );
+      result = ( float64_t * ) calloc( count, sizeof( float64_t ) );
+      for ( i = 0; i < count; i++ )
+      {
+         result[i] = d_matvec_vector_item( values, i );
+      }
+
+      d_svd_deep_dispose( &svd );
+   }
+
+   return result;
+}
+
+int
+main( int argc, char **argv )
+{
+   int32_t i = 0;
+   int32_t kind = 0;
+   int32_t count = 0;
+   int32_t m = DEFAULT_ROWS;
+   int32_t n = DEFAULT_COLUMNS;
+   int32_t thread_count = DEFAULT_THREAD_COUNT;
+   int32_t truncation = DEFAULT_TRUNCATION;
+   float64_t t = 0.0;
+   float64_t t_base = 0.0;
+   float64_t check = 0.0;
+   float64_t *values = NULL;
+   float64_t *values_base = NULL;
+   d_matvec_t *input = NULL;
+
+   if ( argc > 1 )
+   {
+      m = atoi( argv[1] );
+   }
+
+   if ( argc > 2 )
+   {
+      n = atoi( argv[2] );
+   }
+
+   if ( argc > 3 )
+   {
+      thread_count = atoi( argv[3] );
+   }
+
+   if ( argc > 4 )
+   {
+      truncation = atoi( argv[4] );
+   }
+
+   input = make_input( m, n );
+
+   printf( "\ndecompose a %d by %d matrix, %d threads, top %d\n", m, n, thread_count, truncation );
+
+   values_base = decompose( KIND_JACOBI, input, 1, 0 );
+
+   for ( kind = KIND_LEGACY; kind <= KIND_TOP_K; kind++ )
+   {
+      t = now();
+      count = 0;
+      while ( ( count == 0 ) || ( now() - t < MIN_TIME ) )
+      {
+         if ( values != NULL )
+         {
+            free( values );
+         }
+         values = decompose( kind, input, thread_count, truncation );
+         count = count + 1;
+      }
+      t = ( now() - t ) / count;
+
+      if ( kind == KIND_LEGACY )
+      {
+         t_base = t;
+      }
+
+      check = 0.0;
+      for ( i = 0; i < truncation; i++ )
+      {
+         if ( fabs( values[i] - values_base[i] ) / values_base[i] > check )
+         {
+            check = fabs( values[i] - values_base[i] ) / values_base[i];
+         }
+      }
+
+      free( values );
+      values = NULL;
+
+      printf
+      (
+         "   %-8s %10.2f ms   speedup %6.2f   (check %.2e)\n",
+         kind_names[kind],
+         t * 1.0e3,
+         t_base / t,
+         check
+      );
+   }
+
+   free( values_base );
+   d_matvec_dispose( &input );
+
+   return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
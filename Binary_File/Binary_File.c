@@ -47,6 +47,8 @@ extern "C" {
 #include <unistd.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 #include <utime.h>
 #include <dirent.h>
 #include <endian.h>
@@ -61,6 +63,26 @@ extern "C" {
    defines
 */
 
+/**
+   byte orders of the items of an array
+*/
+
+#define ORDER_NATIVE 0
+#define ORDER_BIG 1
+#define ORDER_LITTLE 2
+
+/**
+   SWAP_CHUNK_SIZE - bytes of an array put through the swap buffer at a time
+*/
+
+#define SWAP_CHUNK_SIZE 32768
+
+/**
+   SWAP_LANE_COUNT - items byte swapped together
+*/
+
+#define SWAP_LANE_COUNT 8
+
 union Int_16_union
 {
    uint16_t    u;
@@ -101,6 +123,12 @@ struct binary_file_struct
    int32_t is_open_write;
    int32_t is_open_append;
 
+   uint8_t *buffer;
+   int32_t buffer_size;
+
+   uint8_t *map;
+   int64_t map_count;
+
    MULTITHREAD_MUTEX_DEFINITION( mutex );
 };
 
@@ -159,6 +187,240 @@ is_file_end_of_file( binary_file_t *current )
    return result;
 }
 
+/**
+   is_host_order
+
+   return 1 if items in the given byte order need no swapping
+*/
+
+static
+int32_t
+is_host_order( int32_t size, int32_t order )
+{
+   int32_t result = 0;
+
+   if (
+      ( size == 1 )
+      ||
+      ( order == ORDER_NATIVE )
+      ||
+      ( ( order == ORDER_BIG ) && ( BYTE_ORDER == BIG_ENDIAN ) )
+      ||
+      ( ( order == ORDER_LITTLE ) && ( BYTE_ORDER == LITTLE_ENDIAN ) )
+   )
+   {
+      result = 1;
+   }
+
+   return result;
+}
+
+/**
+   reorder
+
+   swap the bytes of count items of the given size between host order and
+   the given byte order, in place
+*/
+
+static
+void
+reorder( void *array, int32_t size, int32_t count, int32_t order )
+{
+   int32_t i = 0;
+   int32_t k = 0;
+   int32_t n = count - count % SWAP_LANE_COUNT;
+   uint16_t *p16 = ( uint16_t * ) array;
+   uint32_t *p32 = ( uint32_t * ) array;
+   uint64_t *p64 = ( uint64_t * ) array;
+
+   // the order is not the host's, so each item is byte swapped, in fixed
+   // length runs that the compiler turns into SIMD shuffles
+   if ( ( is_host_order( size, order ) == 0 ) && ( size == 2 ) )
+   {
+      for ( i = 0; i < n; i = i + SWAP_LANE_COUNT )
+      {
+         for ( k = i; k < i + SWAP_LANE_COUNT; k++ )
+         {
+            p16[k] = __builtin_bswap16( p16[k] );
+         }
+      }
+
+      for ( i = n; i < count; i++ )
+      {
+         p16[i] = __builtin_bswap16( p16[i] );
+      }
+   }
+   else if ( ( is_host_order( size, order ) == 0 ) && ( size == 4 ) )
+   {
+      for ( i = 0; i < n; i = i + SWAP_LANE_COUNT )
+      {
+         for ( k = i; k < i + SWAP_LANE_COUNT; k++ )
+         {
+            p32[k] = __builtin_bswap32( p32[k] );
+         }
+      }
+
+      for ( i = n; i < count; i++ )
+      {
+         p32[i] = __builtin_bswap32( p32[i] );
+      }
+   }
+   else if ( ( is_host_order( size, order ) == 0 ) && ( size == 8 ) )
+   {
+      for ( i = 0; i < n; i = i + SWAP_LANE_COUNT )
+      {
+         for ( k = i; k < i + SWAP_LANE_COUNT; k++ )
+         {
+            p64[k] = __builtin_bswap64( p64[k] );
+         }
+      }
+
+      for ( i = n; i < count; i++ )
+      {
+         p64[i] = __builtin_bswap64( p64[i] );
+      }
+   }
+
+   return;
+}
+
+/**
+   read_array
+
+   read count items of the given size and byte order into array with one
+   fread, return the number of items read
+*/
+
+static
+int32_t
+read_array( binary_file_t *current, void *array, int32_t size, int32_t count, int32_t order )
+{
+   int32_t result = 0;
+
+   result = ( int32_t ) fread( array, size, count, (*current).file );
+
+   reorder( array, size, result, order );
+
+   return result;
+}
+
+/**
+   put_array
+
+   write count items of the given size and byte order from array, through
+   a swap buffer if they must be byte swapped
+*/
+
+static
+void
+put_array( binary_file_t *current, void *array, int32_t size, int32_t count, int32_t order )
+{
+   int32_t i = 0;
+   int32_t n = 0;
+   int32_t chunk_count = SWAP_CHUNK_SIZE / size;
+   uint64_t chunk[ SWAP_CHUNK_SIZE / sizeof( uint64_t ) ];
+
+   if ( is_host_order( size, order ) == 1 )
+   {
+      fwrite( array, size, count, (*current).file );
+   }
+   else
+   {
+      for ( i = 0; i < count; i = i + chunk_count )
+      {
+         n = ( count - i < chunk_count ) ? count - i : chunk_count;
+         memcpy( chunk, ( uint8_t * ) array + ( int64_t ) i * size, n * size );
+         reorder( chunk, size, n, order );
+         fwrite( chunk, size, n, (*current).file );
+      }
+   }
+
+   return;
+}
+
+/**
+   set_file_buffer
+
+   give the open file the internal buffer, or the stdio default
+*/
+
+static
+void
+set_file_buffer( binary_file_t *current )
+{
+   if ( (*current).file != NULL )
+   {
+      if ( (*current).buffer != NULL )
+      {
+         setvbuf( (*current).file, ( char * ) (*current).buffer, _IOFBF, (*current).buffer_size );
+      }
+      else
+      {
+         setvbuf( (*current).file, NULL, _IOFBF, BUFSIZ );
+      }
+   }
+
+   return;
+}
+
+/**
+   map_file
+
+   map the whole of the file just opened for reading, if it is not empty
+*/
+
+static
+void
+map_file( binary_file_t *current )
+{
+   struct stat st;
+   void *p = NULL;
+
+   (*current).map = NULL;
+   (*current).map_count = 0;
+
+   if (
+      ( (*current).file != NULL )
+      &&
+      ( fstat( fileno( (*current).file ), &st ) == 0 )
+      &&
+      ( st.st_size > 0 )
+   )
+   {
+      // copy on write, so a put into a view changes only this process's copy
+      p = mmap( NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno( (*current).file ), 0 );
+
+      // if the file cannot be mapped it is still open for reading
+      if ( p != MAP_FAILED )
+      {
+         (*current).map = ( uint8_t * ) p;
+         (*current).map_count = st.st_size;
+      }
+   }
+
+   return;
+}
+
+/**
+   unmap_file
+
+   remove the mapping of the file, if any
+*/
+
+static
+void
+unmap_file( binary_file_t *current )
+{
+   if ( (*current).map != NULL )
+   {
+      munmap( (*current).map, (*current).map_count );
+      (*current).map = NULL;
+      (*current).map_count = 0;
+   }
+
+   return;
+}
+
 /**
    binary_file_make
 */
@@ -462,6 +724,46 @@ binary_file_make_open_read_append_cstring( char_t *name )
 
 
 
+/**
+   binary_file_make_mmap_read
+*/
+binary_file_t *
+binary_file_make_mmap_read( string_t *name )
+{
+   PRECONDITION( "name not null", name != NULL );
+
+   binary_file_t *result = binary_file_make( name );
+
+   (*result).file = fopen( string_as_cstring( name ), "rb" );
+   if ( (*result).file != NULL )
+   {
+      (*result).is_open_read = 1;
+      map_file( result );
+   }
+
+   return result;
+}
+
+/**
+   binary_file_make_mmap_read_cstring
+*/
+binary_file_t *
+binary_file_make_mmap_read_cstring( char_t *name )
+{
+   PRECONDITION( "name not null", name != NULL );
+
+   binary_file_t *result = binary_file_make_cstring( name );
+
+   (*result).file = fopen( name, "rb" );
+   if ( (*result).file != NULL )
+   {
+      (*result).is_open_read = 1;
+      map_file( result );
+   }
+
+   return result;
+}
+
 /**
    binary_file_dispose
 */
@@ -478,6 +780,9 @@ binary_file_dispose( binary_file_t **current )
    // delete binary_file name
    string_deep_dispose( &(**current).name );
 
+   // remove the mapping, if any
+   unmap_file( *current );
+
    // if file is not NULL, close it
    if ( (**current).file != NULL )
    {
@@ -488,6 +793,9 @@ binary_file_dispose( binary_file_t **current )
       (**current).is_open_append = 0;
    }
 
+   // delete the internal buffer after the file that uses it is closed
+   free( (**current).buffer );
+
    MULTITHREAD_MUTEX_DESTROY( (**current).mutex );
 
    // delete binary_file struct
@@ -540,6 +848,30 @@ binary_file_name_cstring( binary_file_t *current )
    return result;
 }
 
+/**
+   binary_file_descriptor
+*/
+
+int32_t
+binary_file_descriptor( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   // write pending output so that the descriptor sees it
+   fflush( (*current).file );
+
+   int32_t result = fileno( (*current).file );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
 /**
    binary_file_position
 */
@@ -595,6 +927,28 @@ binary_file_count( binary_file_t *current )
    return result;
 }
 
+/**
+   binary_file_buffer_size
+*/
+
+int32_t
+binary_file_buffer_size( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = (*current).buffer_size;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
 /**
    binary_file_after
 */
@@ -826,6 +1180,27 @@ binary_file_is_open_append( binary_file_t *current )
    return result;
 }
 
+/**
+   binary_file_is_mapped
+*/
+
+int32_t
+binary_file_is_mapped( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   // return 1 if the file has a mapping
+   int32_t result = ( (*current).map != NULL );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
 /**
    binary_file_open_read
 */
@@ -843,6 +1218,9 @@ binary_file_open_read( binary_file_t *current )
    (*current).file = fopen( string_as_cstring( (*current).name ), "rb" );
    (*current).is_open_read = 1;
 
+   // use the internal buffer, if any
+   set_file_buffer( current );
+
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
@@ -866,6 +1244,9 @@ binary_file_open_write( binary_file_t *current )
    (*current).file = fopen( string_as_cstring( (*current).name ), "wb" );
    (*current).is_open_write = 1;
 
+   // use the internal buffer, if any
+   set_file_buffer( current );
+
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
@@ -889,6 +1270,9 @@ binary_file_open_append( binary_file_t *current )
    (*current).file = fopen( string_as_cstring( (*current).name ), "ab" );
    (*current).is_open_append = 1;
 
+   // use the internal buffer, if any
+   set_file_buffer( current );
+
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
@@ -913,6 +1297,9 @@ binary_file_open_read_write( binary_file_t *current )
    (*current).is_open_read = 1;
    (*current).is_open_write = 1;
 
+   // use the internal buffer, if any
+   set_file_buffer( current );
+
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
@@ -937,6 +1324,9 @@ binary_file_create_read_write( binary_file_t *current )
    (*current).is_open_read = 1;
    (*current).is_open_write = 1;
 
+   // use the internal buffer, if any
+   set_file_buffer( current );
+
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
@@ -961,6 +1351,37 @@ binary_file_open_read_append( binary_file_t *current )
    (*current).is_open_read = 1;
    (*current).is_open_append = 1;
 
+   // use the internal buffer, if any
+   set_file_buffer( current );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   binary_file_open_mmap_read
+*/
+
+void
+binary_file_open_mmap_read( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file not open", (*current).file == NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   // open file
+   (*current).file = fopen( string_as_cstring( (*current).name ), "rb" );
+   (*current).is_open_read = 1;
+
+   // use the internal buffer, if any, for reads that do not use the map
+   set_file_buffer( current );
+
+   map_file( current );
+
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
@@ -980,6 +1401,9 @@ binary_file_close( binary_file_t *current )
    LOCK( (*current).mutex );
    INVARIANT( current );
 
+   // remove the mapping, if any
+   unmap_file( current );
+
    // close file, if open
    if ( (*current).file != NULL )
    {
@@ -1236,19 +1660,31 @@ binary_file_rename_cstring( binary_file_t *current, char_t *name )
 }
 
 /**
-   binary_file_put_int8
+   binary_file_set_buffer_size
 */
 
 void
-binary_file_put_int8( binary_file_t *current, int8_t arg )
+binary_file_set_buffer_size( binary_file_t *current, int32_t size )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
-   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "size ok", size >= 0 );
    LOCK( (*current).mutex );
+   PRECONDITION( "binary_file not open", (*current).file == NULL );
    INVARIANT( current );
 
-   fwrite( &arg, sizeof( int8_t ), 1, (*current).file );
+   // setvbuf is only allowed before the first I/O on a stream, so the new
+   // buffer is given to the file by the next open
+   free( (*current).buffer );
+
+   (*current).buffer = NULL;
+   (*current).buffer_size = size;
+
+   if ( size > 0 )
+   {
+      (*current).buffer = ( uint8_t * ) malloc( size );
+      CHECK( "(*current).buffer allocated correctly", (*current).buffer != NULL );
+   }
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -1257,19 +1693,73 @@ binary_file_put_int8( binary_file_t *current, int8_t arg )
 }
 
 /**
-   binary_file_put_int16
+   binary_file_advise
 */
 
 void
-binary_file_put_int16( binary_file_t *current, int16_t arg )
+binary_file_advise( binary_file_t *current, int32_t advice )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "advice ok", ( advice >= BINARY_FILE_ADVICE_NORMAL ) && ( advice <= BINARY_FILE_ADVICE_WILLNEED ) );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   fwrite( &arg, sizeof( int16_t ), 1, (*current).file );
+   int32_t madvice[] = { MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED };
+   int32_t fadvice[] = { POSIX_FADV_NORMAL, POSIX_FADV_SEQUENTIAL, POSIX_FADV_RANDOM, POSIX_FADV_WILLNEED };
+
+   // a hint only, so failure is not an error
+   if ( (*current).map != NULL )
+   {
+      madvise( (*current).map, (*current).map_count, madvice[advice] );
+   }
+   else
+   {
+      posix_fadvise( fileno( (*current).file ), 0, 0, fadvice[advice] );
+   }
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   binary_file_put_int8
+*/
+
+void
+binary_file_put_int8( binary_file_t *current, int8_t arg )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   fwrite( &arg, sizeof( int8_t ), 1, (*current).file );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   binary_file_put_int16
+*/
+
+void
+binary_file_put_int16( binary_file_t *current, int16_t arg )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   fwrite( &arg, sizeof( int16_t ), 1, (*current).file );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -2042,536 +2532,1251 @@ binary_file_put_bytes( binary_file_t *current, uint8_t *arg, int32_t count )
 }
 
 /**
-   binary_file_read_int8
+   binary_file_put_int8_array
 */
 
-int8_t
-binary_file_read_int8( binary_file_t *current )
+void
+binary_file_put_int8_array( binary_file_t *current, int8_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   int8_t result = 0;
-   fread( &result, sizeof( int8_t ), 1, (*current).file );
+   put_array( current, array, sizeof( int8_t ), count, ORDER_NATIVE );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result;
+   return;
 }
 
 /**
-   binary_file_read_int16
+   binary_file_put_int16_array
 */
 
-int16_t
-binary_file_read_int16( binary_file_t *current )
+void
+binary_file_put_int16_array( binary_file_t *current, int16_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   int16_t result = 0;
-   fread( &result, sizeof( int16_t ), 1, (*current).file );
+   put_array( current, array, sizeof( int16_t ), count, ORDER_NATIVE );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result;
+   return;
 }
 
 /**
-   binary_file_read_int32
+   binary_file_put_int32_array
 */
 
-int32_t
-binary_file_read_int32( binary_file_t *current )
+void
+binary_file_put_int32_array( binary_file_t *current, int32_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   int32_t result = 0;
-   fread( &result, sizeof( int32_t ), 1, (*current).file );
+   put_array( current, array, sizeof( int32_t ), count, ORDER_NATIVE );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result;
+   return;
 }
 
 /**
-   binary_file_read_int64
+   binary_file_put_int64_array
 */
 
-int64_t
-binary_file_read_int64( binary_file_t *current )
+void
+binary_file_put_int64_array( binary_file_t *current, int64_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   int64_t result = 0;
-   fread( &result, sizeof( int64_t ), 1, (*current).file );
+   put_array( current, array, sizeof( int64_t ), count, ORDER_NATIVE );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result;
+   return;
 }
 
 /**
-   binary_file_read_uint8
+   binary_file_put_uint8_array
 */
 
-uint8_t
-binary_file_read_uint8( binary_file_t *current )
+void
+binary_file_put_uint8_array( binary_file_t *current, uint8_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   uint8_t result = 0;
-
-   fread( &result, sizeof( uint8_t ), 1, (*current).file );
+   put_array( current, array, sizeof( uint8_t ), count, ORDER_NATIVE );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result;
+   return;
 }
 
 /**
-   binary_file_read_uint16
+   binary_file_put_uint16_array
 */
 
-uint16_t
-binary_file_read_uint16( binary_file_t *current )
+void
+binary_file_put_uint16_array( binary_file_t *current, uint16_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   uint16_t result = 0;
-   fread( &result, sizeof( uint16_t ), 1, (*current).file );
+   put_array( current, array, sizeof( uint16_t ), count, ORDER_NATIVE );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result;
+   return;
 }
 
 /**
-   binary_file_read_uint32
+   binary_file_put_uint32_array
 */
 
-uint32_t
-binary_file_read_uint32( binary_file_t *current )
+void
+binary_file_put_uint32_array( binary_file_t *current, uint32_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   uint32_t result = 0;
-   fread( &result, sizeof( uint32_t ), 1, (*current).file );
+   put_array( current, array, sizeof( uint32_t ), count, ORDER_NATIVE );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result;
+   return;
 }
 
 /**
-   binary_file_read_uint64
+   binary_file_put_uint64_array
 */
 
-uint64_t
-binary_file_read_uint64( binary_file_t *current )
+void
+binary_file_put_uint64_array( binary_file_t *current, uint64_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   uint64_t result = 0;
-   fread( &result, sizeof( uint64_t ), 1, (*current).file );
+   put_array( current, array, sizeof( uint64_t ), count, ORDER_NATIVE );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result;
+   return;
 }
 
 /**
-   binary_file_read_float32
+   binary_file_put_float32_array
 */
 
-float32_t
-binary_file_read_float32( binary_file_t *current )
+void
+binary_file_put_float32_array( binary_file_t *current, float32_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   float32_t result = 0;
-   fread( &result, sizeof( float32_t ), 1, (*current).file );
+   put_array( current, array, sizeof( float32_t ), count, ORDER_NATIVE );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result;
+   return;
 }
 
 /**
-   binary_file_read_float64
+   binary_file_put_float64_array
 */
 
-float64_t
-binary_file_read_float64( binary_file_t *current )
+void
+binary_file_put_float64_array( binary_file_t *current, float64_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   float64_t result = 0;
-   fread( &result, sizeof( float64_t ), 1, (*current).file );
+   put_array( current, array, sizeof( float64_t ), count, ORDER_NATIVE );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result;
+   return;
 }
 
 /**
-   binary_file_read_int8_be
+   binary_file_put_int8_array_be
 */
 
-int8_t
-binary_file_read_int8_be( binary_file_t *current )
+void
+binary_file_put_int8_array_be( binary_file_t *current, int8_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   int8_t result = 0;
-   fread( &result, sizeof( int8_t ), 1, (*current).file );
+   put_array( current, array, sizeof( int8_t ), count, ORDER_BIG );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result;
+   return;
 }
 
 /**
-   binary_file_read_int16_be
+   binary_file_put_int16_array_be
 */
 
-int16_t
-binary_file_read_int16_be( binary_file_t *current )
+void
+binary_file_put_int16_array_be( binary_file_t *current, int16_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   Int_16_t result = {0};
-
-   fread( &result.u, sizeof( int16_t ), 1, (*current).file );
-
-   result.u = be16toh( result.u );
+   put_array( current, array, sizeof( int16_t ), count, ORDER_BIG );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result.i;
+   return;
 }
 
 /**
-   binary_file_read_int32_be
+   binary_file_put_int32_array_be
 */
 
-int32_t
-binary_file_read_int32_be( binary_file_t *current )
+void
+binary_file_put_int32_array_be( binary_file_t *current, int32_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   Int_Float_32_t result = {0};
-
-   fread( &result.u, sizeof( int32_t ), 1, (*current).file );
-
-   result.u = be32toh( result.u );
+   put_array( current, array, sizeof( int32_t ), count, ORDER_BIG );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result.i;
+   return;
 }
 
 /**
-   binary_file_read_int64_be
+   binary_file_put_int64_array_be
 */
 
-int64_t
-binary_file_read_int64_be( binary_file_t *current )
+void
+binary_file_put_int64_array_be( binary_file_t *current, int64_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   Int_Float_64_t result = {0};
-
-   fread( &result.u, sizeof( int64_t ), 1, (*current).file );
-
-   result.u = be64toh( result.u );
+   put_array( current, array, sizeof( int64_t ), count, ORDER_BIG );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result.i;
+   return;
 }
 
 /**
-   binary_file_read_uint8_be
+   binary_file_put_uint8_array_be
 */
 
-uint8_t
-binary_file_read_uint8_be( binary_file_t *current )
+void
+binary_file_put_uint8_array_be( binary_file_t *current, uint8_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   uint8_t result = 0;
-
-   fread( &result, sizeof( uint8_t ), 1, (*current).file );
+   put_array( current, array, sizeof( uint8_t ), count, ORDER_BIG );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result;
+   return;
 }
 
 /**
-   binary_file_read_uint16_be
+   binary_file_put_uint16_array_be
 */
 
-uint16_t
-binary_file_read_uint16_be( binary_file_t *current )
+void
+binary_file_put_uint16_array_be( binary_file_t *current, uint16_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   uint16_t result = 0;
-
-   fread( &result, sizeof( uint16_t ), 1, (*current).file );
-
-   result = be16toh( result );
+   put_array( current, array, sizeof( uint16_t ), count, ORDER_BIG );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result;
+   return;
 }
 
 /**
-   binary_file_read_uint32_be
+   binary_file_put_uint32_array_be
 */
 
-uint32_t
-binary_file_read_uint32_be( binary_file_t *current )
+void
+binary_file_put_uint32_array_be( binary_file_t *current, uint32_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   uint32_t result = 0;
-
-   fread( &result, sizeof( uint32_t ), 1, (*current).file );
-
-   result = be32toh( result );
+   put_array( current, array, sizeof( uint32_t ), count, ORDER_BIG );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result;
+   return;
 }
 
 /**
-   binary_file_read_uint64_be
+   binary_file_put_uint64_array_be
 */
 
-uint64_t
-binary_file_read_uint64_be( binary_file_t *current )
+void
+binary_file_put_uint64_array_be( binary_file_t *current, uint64_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   uint64_t result = 0;
-
-   fread( &result, sizeof( uint64_t ), 1, (*current).file );
-
-   result = be64toh( result );
+   put_array( current, array, sizeof( uint64_t ), count, ORDER_BIG );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result;
+   return;
 }
 
 /**
-   binary_file_read_float32_be
+   binary_file_put_float32_array_be
 */
 
-float32_t
-binary_file_read_float32_be( binary_file_t *current )
+void
+binary_file_put_float32_array_be( binary_file_t *current, float32_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   Int_Float_32_t result = {0};
-
-   fread( &result.u, sizeof( float32_t ), 1, (*current).file );
-
-   result.u = be32toh( result.u );
+   put_array( current, array, sizeof( float32_t ), count, ORDER_BIG );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result.f;
+   return;
 }
 
 /**
-   binary_file_read_float64_be
+   binary_file_put_float64_array_be
 */
 
-float64_t
-binary_file_read_float64_be( binary_file_t *current )
+void
+binary_file_put_float64_array_be( binary_file_t *current, float64_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   Int_Float_64_t result = {0};
-
-   fread( &result.u, sizeof( float64_t ), 1, (*current).file );
-
-   result.u = be64toh( result.u );
+   put_array( current, array, sizeof( float64_t ), count, ORDER_BIG );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result.f;
+   return;
 }
 
 /**
-   binary_file_read_int8_le
+   binary_file_put_int8_array_le
 */
 
-int8_t
-binary_file_read_int8_le( binary_file_t *current )
+void
+binary_file_put_int8_array_le( binary_file_t *current, int8_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   int8_t result = 0;
-   fread( &result, sizeof( int8_t ), 1, (*current).file );
+   put_array( current, array, sizeof( int8_t ), count, ORDER_LITTLE );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result;
+   return;
 }
 
 /**
-   binary_file_read_int16_le
+   binary_file_put_int16_array_le
 */
 
-int16_t
-binary_file_read_int16_le( binary_file_t *current )
+void
+binary_file_put_int16_array_le( binary_file_t *current, int16_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   Int_16_t result = {0};
-
-   fread( &result.u, sizeof( int16_t ), 1, (*current).file );
-
-   result.u = le16toh( result.u );
+   put_array( current, array, sizeof( int16_t ), count, ORDER_LITTLE );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result.i;
+   return;
 }
 
 /**
-   binary_file_read_int32_le
+   binary_file_put_int32_array_le
 */
 
-int32_t
-binary_file_read_int32_le( binary_file_t *current )
+void
+binary_file_put_int32_array_le( binary_file_t *current, int32_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   Int_Float_32_t result = {0};
-
-   fread( &result.u, sizeof( int32_t ), 1, (*current).file );
-
-   result.u = le32toh( result.u );
+   put_array( current, array, sizeof( int32_t ), count, ORDER_LITTLE );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   binary_file_put_int64_array_le
+*/
+
+void
+binary_file_put_int64_array_le( binary_file_t *current, int64_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   put_array( current, array, sizeof( int64_t ), count, ORDER_LITTLE );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   binary_file_put_uint8_array_le
+*/
+
+void
+binary_file_put_uint8_array_le( binary_file_t *current, uint8_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   put_array( current, array, sizeof( uint8_t ), count, ORDER_LITTLE );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   binary_file_put_uint16_array_le
+*/
+
+void
+binary_file_put_uint16_array_le( binary_file_t *current, uint16_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   put_array( current, array, sizeof( uint16_t ), count, ORDER_LITTLE );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   binary_file_put_uint32_array_le
+*/
+
+void
+binary_file_put_uint32_array_le( binary_file_t *current, uint32_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   put_array( current, array, sizeof( uint32_t ), count, ORDER_LITTLE );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   binary_file_put_uint64_array_le
+*/
+
+void
+binary_file_put_uint64_array_le( binary_file_t *current, uint64_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   put_array( current, array, sizeof( uint64_t ), count, ORDER_LITTLE );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   binary_file_put_float32_array_le
+*/
+
+void
+binary_file_put_float32_array_le( binary_file_t *current, float32_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   put_array( current, array, sizeof( float32_t ), count, ORDER_LITTLE );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   binary_file_put_float64_array_le
+*/
+
+void
+binary_file_put_float64_array_le( binary_file_t *current, float64_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   put_array( current, array, sizeof( float64_t ), count, ORDER_LITTLE );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   binary_file_read_int8
+*/
+
+int8_t
+binary_file_read_int8( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int8_t result = 0;
+   fread( &result, sizeof( int8_t ), 1, (*current).file );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_int16
+*/
+
+int16_t
+binary_file_read_int16( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int16_t result = 0;
+   fread( &result, sizeof( int16_t ), 1, (*current).file );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_int32
+*/
+
+int32_t
+binary_file_read_int32( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+   fread( &result, sizeof( int32_t ), 1, (*current).file );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_int64
+*/
+
+int64_t
+binary_file_read_int64( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int64_t result = 0;
+   fread( &result, sizeof( int64_t ), 1, (*current).file );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_uint8
+*/
+
+uint8_t
+binary_file_read_uint8( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   uint8_t result = 0;
+
+   fread( &result, sizeof( uint8_t ), 1, (*current).file );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_uint16
+*/
+
+uint16_t
+binary_file_read_uint16( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   uint16_t result = 0;
+   fread( &result, sizeof( uint16_t ), 1, (*current).file );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_uint32
+*/
+
+uint32_t
+binary_file_read_uint32( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   uint32_t result = 0;
+   fread( &result, sizeof( uint32_t ), 1, (*current).file );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_uint64
+*/
+
+uint64_t
+binary_file_read_uint64( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   uint64_t result = 0;
+   fread( &result, sizeof( uint64_t ), 1, (*current).file );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_float32
+*/
+
+float32_t
+binary_file_read_float32( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   float32_t result = 0;
+   fread( &result, sizeof( float32_t ), 1, (*current).file );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_float64
+*/
+
+float64_t
+binary_file_read_float64( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   float64_t result = 0;
+   fread( &result, sizeof( float64_t ), 1, (*current).file );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_int8_be
+*/
+
+int8_t
+binary_file_read_int8_be( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int8_t result = 0;
+   fread( &result, sizeof( int8_t ), 1, (*current).file );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_int16_be
+*/
+
+int16_t
+binary_file_read_int16_be( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   Int_16_t result = {0};
+
+   fread( &result.u, sizeof( int16_t ), 1, (*current).file );
+
+   result.u = be16toh( result.u );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result.i;
+}
+
+/**
+   binary_file_read_int32_be
+*/
+
+int32_t
+binary_file_read_int32_be( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   Int_Float_32_t result = {0};
+
+   fread( &result.u, sizeof( int32_t ), 1, (*current).file );
+
+   result.u = be32toh( result.u );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result.i;
+}
+
+/**
+   binary_file_read_int64_be
+*/
+
+int64_t
+binary_file_read_int64_be( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   Int_Float_64_t result = {0};
+
+   fread( &result.u, sizeof( int64_t ), 1, (*current).file );
+
+   result.u = be64toh( result.u );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result.i;
+}
+
+/**
+   binary_file_read_uint8_be
+*/
+
+uint8_t
+binary_file_read_uint8_be( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   uint8_t result = 0;
+
+   fread( &result, sizeof( uint8_t ), 1, (*current).file );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_uint16_be
+*/
+
+uint16_t
+binary_file_read_uint16_be( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   uint16_t result = 0;
+
+   fread( &result, sizeof( uint16_t ), 1, (*current).file );
+
+   result = be16toh( result );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_uint32_be
+*/
+
+uint32_t
+binary_file_read_uint32_be( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   uint32_t result = 0;
+
+   fread( &result, sizeof( uint32_t ), 1, (*current).file );
+
+   result = be32toh( result );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_uint64_be
+*/
+
+uint64_t
+binary_file_read_uint64_be( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   uint64_t result = 0;
+
+   fread( &result, sizeof( uint64_t ), 1, (*current).file );
+
+   result = be64toh( result );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_float32_be
+*/
+
+float32_t
+binary_file_read_float32_be( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   Int_Float_32_t result = {0};
+
+   fread( &result.u, sizeof( float32_t ), 1, (*current).file );
+
+   result.u = be32toh( result.u );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result.f;
+}
+
+/**
+   binary_file_read_float64_be
+*/
+
+float64_t
+binary_file_read_float64_be( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   Int_Float_64_t result = {0};
+
+   fread( &result.u, sizeof( float64_t ), 1, (*current).file );
+
+   result.u = be64toh( result.u );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result.f;
+}
+
+/**
+   binary_file_read_int8_le
+*/
+
+int8_t
+binary_file_read_int8_le( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int8_t result = 0;
+   fread( &result, sizeof( int8_t ), 1, (*current).file );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_int16_le
+*/
+
+int16_t
+binary_file_read_int16_le( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   Int_16_t result = {0};
+
+   fread( &result.u, sizeof( int16_t ), 1, (*current).file );
+
+   result.u = le16toh( result.u );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result.i;
+}
+
+/**
+   binary_file_read_int32_le
+*/
+
+int32_t
+binary_file_read_int32_le( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   Int_Float_32_t result = {0};
+
+   fread( &result.u, sizeof( int32_t ), 1, (*current).file );
+
+   result.u = le32toh( result.u );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result.i;
+}
+
+/**
+   binary_file_read_int64_le
+*/
+
+int64_t
+binary_file_read_int64_le( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   Int_Float_64_t result = {0};
+
+   fread( &result.u, sizeof( int64_t ), 1, (*current).file );
+
+   result.u = le64toh( result.u );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -2580,46 +3785,655 @@ binary_file_read_int32_le( binary_file_t *current )
 }
 
 /**
-   binary_file_read_int64_le
+   binary_file_read_uint8_le
+*/
+
+uint8_t
+binary_file_read_uint8_le( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   uint8_t result = 0;
+
+   fread( &result, sizeof( uint8_t ), 1, (*current).file );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_uint16_le
+*/
+
+uint16_t
+binary_file_read_uint16_le( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   uint16_t result = 0;
+
+   fread( &result, sizeof( uint16_t ), 1, (*current).file );
+
+   result = le16toh( result );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_uint32_le
+*/
+
+uint32_t
+binary_file_read_uint32_le( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   uint32_t result = 0;
+
+   fread( &result, sizeof( uint32_t ), 1, (*current).file );
+
+   result = le32toh( result );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_uint64_le
+*/
+
+uint64_t
+binary_file_read_uint64_le( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   uint64_t result = 0;
+
+   fread( &result, sizeof( uint64_t ), 1, (*current).file );
+
+   result = le64toh( result );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_float32_le
+*/
+
+float32_t
+binary_file_read_float32_le( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   Int_Float_32_t result = {0};
+
+   fread( &result.u, sizeof( float32_t ), 1, (*current).file );
+
+   result.u = le32toh( result.u );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result.f;
+}
+
+/**
+   binary_file_read_float64_le
+*/
+
+float64_t
+binary_file_read_float64_le( binary_file_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   Int_Float_64_t result = {0};
+
+   fread( &result.u, sizeof( float64_t ), 1, (*current).file );
+
+   result.u = le64toh( result.u );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result.f;
+}
+
+/**
+   binary_file_read_raw_buffer
+*/
+
+raw_buffer_t *
+binary_file_read_raw_buffer( binary_file_t *current, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   raw_buffer_t *result = raw_buffer_make( count );
+   fread( raw_buffer_base( result ), sizeof( uint8_t ), count, (*current).file );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_raw_buffer_view
+*/
+
+raw_buffer_t *
+binary_file_raw_buffer_view( binary_file_t *current, int64_t offset, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file mapped", (*current).map != NULL );
+   PRECONDITION( "offset ok", ( offset >= 0 ) && ( offset <= (*current).map_count ) );
+   PRECONDITION( "count ok", ( count >= 0 ) && ( count <= (*current).map_count - offset ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   raw_buffer_t *result = raw_buffer_make_borrowed( (*current).map + offset, count );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_raw_buffer_view
+*/
+
+raw_buffer_t *
+binary_file_read_raw_buffer_view( binary_file_t *current, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file mapped", (*current).map != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int64_t pos = ftell( (*current).file );
+   int32_t n = count;
+
+   // like fread, stop at the end of the file
+   if ( pos >= (*current).map_count )
+   {
+      pos = (*current).map_count;
+      n = 0;
+   }
+   else if ( n > (*current).map_count - pos )
+   {
+      n = ( int32_t ) ( (*current).map_count - pos );
+   }
+
+   raw_buffer_t *result = raw_buffer_make_borrowed( (*current).map + pos, n );
+
+   // move past the bytes viewed
+   fseek( (*current).file, n, SEEK_CUR );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_string
+*/
+
+string_t *
+binary_file_read_string( binary_file_t *current, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   string_t *result = string_make_n( count + 1 );
+   char *s = ( char * ) calloc( count + 1, sizeof( char_t ) );
+   CHECK( "s allocated correctly", s != NULL );
+
+   fread( s, sizeof( char_t ), count + 1, (*current).file );
+   string_append_cstring( result, s );
+   free( s );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_cstring
+*/
+
+char_t *
+binary_file_read_cstring( binary_file_t *current, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   char_t *result = ( char_t * ) calloc( count + 1, sizeof( char_t ) );
+   CHECK( "result allocated correctly", result != NULL );
+
+   fread( result, sizeof( char_t ), count + 1, (*current).file );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_bytes
+*/
+
+uint8_t *
+binary_file_read_bytes( binary_file_t *current, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   uint8_t *result = ( uint8_t * ) calloc( count, sizeof( uint8_t ) );
+   CHECK( "result allocated correctly", result != NULL );
+
+   fread( result, sizeof( uint8_t ), count, (*current).file );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_int8_array
+*/
+
+int32_t
+binary_file_read_int8_array( binary_file_t *current, int8_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = read_array( current, array, sizeof( int8_t ), count, ORDER_NATIVE );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_int16_array
+*/
+
+int32_t
+binary_file_read_int16_array( binary_file_t *current, int16_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = read_array( current, array, sizeof( int16_t ), count, ORDER_NATIVE );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_int32_array
+*/
+
+int32_t
+binary_file_read_int32_array( binary_file_t *current, int32_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = read_array( current, array, sizeof( int32_t ), count, ORDER_NATIVE );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_int64_array
+*/
+
+int32_t
+binary_file_read_int64_array( binary_file_t *current, int64_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = read_array( current, array, sizeof( int64_t ), count, ORDER_NATIVE );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_uint8_array
+*/
+
+int32_t
+binary_file_read_uint8_array( binary_file_t *current, uint8_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = read_array( current, array, sizeof( uint8_t ), count, ORDER_NATIVE );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_uint16_array
+*/
+
+int32_t
+binary_file_read_uint16_array( binary_file_t *current, uint16_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = read_array( current, array, sizeof( uint16_t ), count, ORDER_NATIVE );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_uint32_array
+*/
+
+int32_t
+binary_file_read_uint32_array( binary_file_t *current, uint32_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = read_array( current, array, sizeof( uint32_t ), count, ORDER_NATIVE );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_uint64_array
+*/
+
+int32_t
+binary_file_read_uint64_array( binary_file_t *current, uint64_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = read_array( current, array, sizeof( uint64_t ), count, ORDER_NATIVE );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_float32_array
+*/
+
+int32_t
+binary_file_read_float32_array( binary_file_t *current, float32_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = read_array( current, array, sizeof( float32_t ), count, ORDER_NATIVE );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_float64_array
+*/
+
+int32_t
+binary_file_read_float64_array( binary_file_t *current, float64_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = read_array( current, array, sizeof( float64_t ), count, ORDER_NATIVE );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_int8_array_be
+*/
+
+int32_t
+binary_file_read_int8_array_be( binary_file_t *current, int8_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = read_array( current, array, sizeof( int8_t ), count, ORDER_BIG );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_int16_array_be
 */
 
-int64_t
-binary_file_read_int64_le( binary_file_t *current )
+int32_t
+binary_file_read_int16_array_be( binary_file_t *current, int16_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   Int_Float_64_t result = {0};
+   int32_t result = 0;
 
-   fread( &result.u, sizeof( int64_t ), 1, (*current).file );
+   result = read_array( current, array, sizeof( int16_t ), count, ORDER_BIG );
 
-   result.u = le64toh( result.u );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_int32_array_be
+*/
+
+int32_t
+binary_file_read_int32_array_be( binary_file_t *current, int32_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = read_array( current, array, sizeof( int32_t ), count, ORDER_BIG );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result.i;
+   return result;
 }
 
 /**
-   binary_file_read_uint8_le
+   binary_file_read_int64_array_be
 */
 
-uint8_t
-binary_file_read_uint8_le( binary_file_t *current )
+int32_t
+binary_file_read_int64_array_be( binary_file_t *current, int64_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   uint8_t result = 0;
+   int32_t result = 0;
 
-   fread( &result, sizeof( uint8_t ), 1, (*current).file );
+   result = read_array( current, array, sizeof( int64_t ), count, ORDER_BIG );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -2628,23 +4442,48 @@ binary_file_read_uint8_le( binary_file_t *current )
 }
 
 /**
-   binary_file_read_uint16_le
+   binary_file_read_uint8_array_be
 */
 
-uint16_t
-binary_file_read_uint16_le( binary_file_t *current )
+int32_t
+binary_file_read_uint8_array_be( binary_file_t *current, uint8_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   uint16_t result = 0;
+   int32_t result = 0;
 
-   fread( &result, sizeof( uint16_t ), 1, (*current).file );
+   result = read_array( current, array, sizeof( uint8_t ), count, ORDER_BIG );
 
-   result = le16toh( result );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_uint16_array_be
+*/
+
+int32_t
+binary_file_read_uint16_array_be( binary_file_t *current, uint16_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = read_array( current, array, sizeof( uint16_t ), count, ORDER_BIG );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -2653,23 +4492,48 @@ binary_file_read_uint16_le( binary_file_t *current )
 }
 
 /**
-   binary_file_read_uint32_le
+   binary_file_read_uint32_array_be
 */
 
-uint32_t
-binary_file_read_uint32_le( binary_file_t *current )
+int32_t
+binary_file_read_uint32_array_be( binary_file_t *current, uint32_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   uint32_t result = 0;
+   int32_t result = 0;
 
-   fread( &result, sizeof( uint32_t ), 1, (*current).file );
+   result = read_array( current, array, sizeof( uint32_t ), count, ORDER_BIG );
 
-   result = le32toh( result );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_uint64_array_be
+*/
+
+int32_t
+binary_file_read_uint64_array_be( binary_file_t *current, uint64_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = read_array( current, array, sizeof( uint64_t ), count, ORDER_BIG );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -2678,23 +4542,48 @@ binary_file_read_uint32_le( binary_file_t *current )
 }
 
 /**
-   binary_file_read_uint64_le
+   binary_file_read_float32_array_be
 */
 
-uint64_t
-binary_file_read_uint64_le( binary_file_t *current )
+int32_t
+binary_file_read_float32_array_be( binary_file_t *current, float32_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   uint64_t result = 0;
+   int32_t result = 0;
 
-   fread( &result, sizeof( uint64_t ), 1, (*current).file );
+   result = read_array( current, array, sizeof( float32_t ), count, ORDER_BIG );
 
-   result = le64toh( result );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_float64_array_be
+*/
+
+int32_t
+binary_file_read_float64_array_be( binary_file_t *current, float64_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = read_array( current, array, sizeof( float64_t ), count, ORDER_BIG );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -2703,70 +4592,123 @@ binary_file_read_uint64_le( binary_file_t *current )
 }
 
 /**
-   binary_file_read_float32_le
+   binary_file_read_int8_array_le
 */
 
-float32_t
-binary_file_read_float32_le( binary_file_t *current )
+int32_t
+binary_file_read_int8_array_le( binary_file_t *current, int8_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   Int_Float_32_t result = {0};
+   int32_t result = 0;
 
-   fread( &result.u, sizeof( float32_t ), 1, (*current).file );
+   result = read_array( current, array, sizeof( int8_t ), count, ORDER_LITTLE );
 
-   result.u = le32toh( result.u );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_int16_array_le
+*/
+
+int32_t
+binary_file_read_int16_array_le( binary_file_t *current, int16_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = read_array( current, array, sizeof( int16_t ), count, ORDER_LITTLE );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result.f;
+   return result;
 }
 
 /**
-   binary_file_read_float64_le
+   binary_file_read_int32_array_le
 */
 
-float64_t
-binary_file_read_float64_le( binary_file_t *current )
+int32_t
+binary_file_read_int32_array_le( binary_file_t *current, int32_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   Int_Float_64_t result = {0};
+   int32_t result = 0;
 
-   fread( &result.u, sizeof( float64_t ), 1, (*current).file );
+   result = read_array( current, array, sizeof( int32_t ), count, ORDER_LITTLE );
 
-   result.u = le64toh( result.u );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_int64_array_le
+*/
+
+int32_t
+binary_file_read_int64_array_le( binary_file_t *current, int64_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = read_array( current, array, sizeof( int64_t ), count, ORDER_LITTLE );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
 
-   return result.f;
+   return result;
 }
 
 /**
-   binary_file_read_raw_buffer
+   binary_file_read_uint8_array_le
 */
 
-raw_buffer_t *
-binary_file_read_raw_buffer( binary_file_t *current, int32_t count )
+int32_t
+binary_file_read_uint8_array_le( binary_file_t *current, uint8_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   raw_buffer_t *result = raw_buffer_make( count );
-   fread( raw_buffer_base( result ), sizeof( uint8_t ), count, (*current).file );
+   int32_t result = 0;
+
+   result = read_array( current, array, sizeof( uint8_t ), count, ORDER_LITTLE );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -2775,25 +4717,23 @@ binary_file_read_raw_buffer( binary_file_t *current, int32_t count )
 }
 
 /**
-   binary_file_read_string
+   binary_file_read_uint16_array_le
 */
 
-string_t *
-binary_file_read_string( binary_file_t *current, int32_t count )
+int32_t
+binary_file_read_uint16_array_le( binary_file_t *current, uint16_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   string_t *result = string_make_n( count + 1 );
-   char *s = ( char * ) calloc( count + 1, sizeof( char_t ) );
-   CHECK( "s allocated correctly", s != NULL );
+   int32_t result = 0;
 
-   fread( s, sizeof( char_t ), count + 1, (*current).file );
-   string_append_cstring( result, s );
-   free( s );
+   result = read_array( current, array, sizeof( uint16_t ), count, ORDER_LITTLE );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -2802,22 +4742,23 @@ binary_file_read_string( binary_file_t *current, int32_t count )
 }
 
 /**
-   binary_file_read_cstring
+   binary_file_read_uint32_array_le
 */
 
-char_t *
-binary_file_read_cstring( binary_file_t *current, int32_t count )
+int32_t
+binary_file_read_uint32_array_le( binary_file_t *current, uint32_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   char_t *result = ( char_t * ) calloc( count + 1, sizeof( char_t ) );
-   CHECK( "result allocated correctly", result != NULL );
+   int32_t result = 0;
 
-   fread( result, sizeof( char_t ), count + 1, (*current).file );
+   result = read_array( current, array, sizeof( uint32_t ), count, ORDER_LITTLE );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -2826,22 +4767,73 @@ binary_file_read_cstring( binary_file_t *current, int32_t count )
 }
 
 /**
-   binary_file_read_bytes
+   binary_file_read_uint64_array_le
 */
 
-uint8_t *
-binary_file_read_bytes( binary_file_t *current, int32_t count )
+int32_t
+binary_file_read_uint64_array_le( binary_file_t *current, uint64_t *array, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
    PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   uint8_t *result = ( uint8_t * ) calloc( count, sizeof( uint8_t ) );
-   CHECK( "result allocated correctly", result != NULL );
+   int32_t result = 0;
 
-   fread( result, sizeof( uint8_t ), count, (*current).file );
+   result = read_array( current, array, sizeof( uint64_t ), count, ORDER_LITTLE );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_float32_array_le
+*/
+
+int32_t
+binary_file_read_float32_array_le( binary_file_t *current, float32_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = read_array( current, array, sizeof( float32_t ), count, ORDER_LITTLE );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_read_float64_array_le
+*/
+
+int32_t
+binary_file_read_float64_array_le( binary_file_t *current, float64_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "binary_file type OK", (*current)._type == BINARY_FILE_TYPE );
+   PRECONDITION( "binary_file open", (*current).file != NULL );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = read_array( current, array, sizeof( float64_t ), count, ORDER_LITTLE );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -67,6 +67,15 @@ extern "C" {
 #include "String.h"
 #include "Raw_Buffer.h"
 
+/**
+   access pattern hints for binary_file_advise
+*/
+
+#define BINARY_FILE_ADVICE_NORMAL 0
+#define BINARY_FILE_ADVICE_SEQUENTIAL 1
+#define BINARY_FILE_ADVICE_RANDOM 2
+#define BINARY_FILE_ADVICE_WILLNEED 3
+
 /**
    Structure declaration
 */
@@ -264,6 +273,34 @@ binary_file_make_open_read_append( string_t *name );
 binary_file_t *
 binary_file_make_open_read_append_cstring( char_t *name );
 
+/**
+   binary_file_make_mmap_read
+
+   Create and initialize a binary_file_t instance.
+   Binary_File is opened for reading and, if it is not empty, mapped into
+   memory so that binary_file_raw_buffer_view and
+   binary_file_read_raw_buffer_view can return its contents without
+   copying. The other read functions still work.
+
+   @param name the file name
+   @return pointer to the new data structure
+*/
+binary_file_t *
+binary_file_make_mmap_read( string_t *name );
+
+/**
+   binary_file_make_mmap_read_cstring
+
+   Create and initialize a binary_file_t instance.
+   Binary_File is opened for reading and, if it is not empty, mapped into
+   memory.
+
+   @param name the file name
+   @return pointer to the new data structure
+*/
+binary_file_t *
+binary_file_make_mmap_read_cstring( char_t *name );
+
 /*
    Disposal
 */
@@ -306,6 +343,20 @@ binary_file_name( binary_file_t *current );
 char_t *
 binary_file_name_cstring( binary_file_t *current );
 
+/**
+   binary_file_descriptor
+
+   Returns the file descriptor of the open file, after writing any pending
+   output. Reads and writes made through the descriptor, such as those
+   queued on a binary_file_async_t, bypass the stdio buffer and do not
+   move the current position.
+
+   @param current the binary_file_t instance
+   @return the file descriptor
+*/
+int32_t
+binary_file_descriptor( binary_file_t *current );
+
 
 /**
    binary_file_position
@@ -334,6 +385,17 @@ binary_file_position( binary_file_t *current );
 int64_t
 binary_file_count( binary_file_t *current );
 
+/**
+   binary_file_buffer_size
+
+   Returns the size of the internal buffer, 0 for the stdio default.
+
+   @param current the binary_file_t instance
+   @return the buffer size in bytes
+*/
+int32_t
+binary_file_buffer_size( binary_file_t *current );
+
 
 /*
    Status Report
@@ -438,6 +500,17 @@ binary_file_is_open_write( binary_file_t *current );
 int32_t
 binary_file_is_open_append( binary_file_t *current );
 
+/**
+   binary_file_is_mapped
+
+   Returns 1 if binary_file is open for reading and mapped into memory
+
+   @param current the binary_file_t instance
+   @return 1 if true, 0 othewise
+*/
+int32_t
+binary_file_is_mapped( binary_file_t *current );
+
 
 /*
    Status Setting
@@ -509,6 +582,18 @@ binary_file_create_read_write( binary_file_t *current );
 void
 binary_file_open_read_append( binary_file_t *current );
 
+/**
+   binary_file_open_mmap_read
+
+   Opens binary_file for reading and, if it is not empty, maps it into
+   memory
+
+   @param current the binary_file_t instance
+*/
+
+void
+binary_file_open_mmap_read( binary_file_t *current );
+
 /**
    binary_file_close
 
@@ -643,6 +728,33 @@ void binary_file_rename( binary_file_t *current, string_t *name );
 */
 void binary_file_rename_cstring( binary_file_t *current, char_t *name );
 
+/**
+   binary_file_set_buffer_size
+
+   Set the size of the internal buffer used when the file is next opened,
+   0 for the stdio default. A large buffer cuts the number of system calls
+   made by reads and writes of single items. The file must be closed.
+
+   @param current the binary_file_t instance
+   @param size the buffer size in bytes
+*/
+void binary_file_set_buffer_size( binary_file_t *current, int32_t size );
+
+/**
+   binary_file_advise
+
+   Tell the system how the open file will be read, one of
+   BINARY_FILE_ADVICE_NORMAL, BINARY_FILE_ADVICE_SEQUENTIAL,
+   BINARY_FILE_ADVICE_RANDOM or BINARY_FILE_ADVICE_WILLNEED. The hint
+   applies to the mapping if the file is mapped, and to the file
+   otherwise. Sequential access lets the system read further ahead,
+   random access stops it reading ahead pages that will not be used.
+
+   @param current the binary_file_t instance
+   @param advice the access pattern
+*/
+void binary_file_advise( binary_file_t *current, int32_t advice );
+
 /*
    Output
 */
@@ -987,6 +1099,336 @@ void binary_file_put_cstring( binary_file_t *current, char_t *arg );
 */
 void binary_file_put_bytes( binary_file_t *current, uint8_t *arg, int32_t count );
 
+/**
+   binary_file_put_int8_array
+
+   Write count items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_int8_array( binary_file_t *current, int8_t *array, int32_t count );
+
+/**
+   binary_file_put_int16_array
+
+   Write count items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_int16_array( binary_file_t *current, int16_t *array, int32_t count );
+
+/**
+   binary_file_put_int32_array
+
+   Write count items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_int32_array( binary_file_t *current, int32_t *array, int32_t count );
+
+/**
+   binary_file_put_int64_array
+
+   Write count items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_int64_array( binary_file_t *current, int64_t *array, int32_t count );
+
+/**
+   binary_file_put_uint8_array
+
+   Write count items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_uint8_array( binary_file_t *current, uint8_t *array, int32_t count );
+
+/**
+   binary_file_put_uint16_array
+
+   Write count items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_uint16_array( binary_file_t *current, uint16_t *array, int32_t count );
+
+/**
+   binary_file_put_uint32_array
+
+   Write count items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_uint32_array( binary_file_t *current, uint32_t *array, int32_t count );
+
+/**
+   binary_file_put_uint64_array
+
+   Write count items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_uint64_array( binary_file_t *current, uint64_t *array, int32_t count );
+
+/**
+   binary_file_put_float32_array
+
+   Write count items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_float32_array( binary_file_t *current, float32_t *array, int32_t count );
+
+/**
+   binary_file_put_float64_array
+
+   Write count items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_float64_array( binary_file_t *current, float64_t *array, int32_t count );
+
+/**
+   binary_file_put_int8_array_be
+
+   Write count big endian items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_int8_array_be( binary_file_t *current, int8_t *array, int32_t count );
+
+/**
+   binary_file_put_int16_array_be
+
+   Write count big endian items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_int16_array_be( binary_file_t *current, int16_t *array, int32_t count );
+
+/**
+   binary_file_put_int32_array_be
+
+   Write count big endian items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_int32_array_be( binary_file_t *current, int32_t *array, int32_t count );
+
+/**
+   binary_file_put_int64_array_be
+
+   Write count big endian items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_int64_array_be( binary_file_t *current, int64_t *array, int32_t count );
+
+/**
+   binary_file_put_uint8_array_be
+
+   Write count big endian items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_uint8_array_be( binary_file_t *current, uint8_t *array, int32_t count );
+
+/**
+   binary_file_put_uint16_array_be
+
+   Write count big endian items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_uint16_array_be( binary_file_t *current, uint16_t *array, int32_t count );
+
+/**
+   binary_file_put_uint32_array_be
+
+   Write count big endian items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_uint32_array_be( binary_file_t *current, uint32_t *array, int32_t count );
+
+/**
+   binary_file_put_uint64_array_be
+
+   Write count big endian items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_uint64_array_be( binary_file_t *current, uint64_t *array, int32_t count );
+
+/**
+   binary_file_put_float32_array_be
+
+   Write count big endian items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_float32_array_be( binary_file_t *current, float32_t *array, int32_t count );
+
+/**
+   binary_file_put_float64_array_be
+
+   Write count big endian items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_float64_array_be( binary_file_t *current, float64_t *array, int32_t count );
+
+/**
+   binary_file_put_int8_array_le
+
+   Write count little endian items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_int8_array_le( binary_file_t *current, int8_t *array, int32_t count );
+
+/**
+   binary_file_put_int16_array_le
+
+   Write count little endian items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_int16_array_le( binary_file_t *current, int16_t *array, int32_t count );
+
+/**
+   binary_file_put_int32_array_le
+
+   Write count little endian items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_int32_array_le( binary_file_t *current, int32_t *array, int32_t count );
+
+/**
+   binary_file_put_int64_array_le
+
+   Write count little endian items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_int64_array_le( binary_file_t *current, int64_t *array, int32_t count );
+
+/**
+   binary_file_put_uint8_array_le
+
+   Write count little endian items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_uint8_array_le( binary_file_t *current, uint8_t *array, int32_t count );
+
+/**
+   binary_file_put_uint16_array_le
+
+   Write count little endian items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_uint16_array_le( binary_file_t *current, uint16_t *array, int32_t count );
+
+/**
+   binary_file_put_uint32_array_le
+
+   Write count little endian items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_uint32_array_le( binary_file_t *current, uint32_t *array, int32_t count );
+
+/**
+   binary_file_put_uint64_array_le
+
+   Write count little endian items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_uint64_array_le( binary_file_t *current, uint64_t *array, int32_t count );
+
+/**
+   binary_file_put_float32_array_le
+
+   Write count little endian items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_float32_array_le( binary_file_t *current, float32_t *array, int32_t count );
+
+/**
+   binary_file_put_float64_array_le
+
+   Write count little endian items of array at current file position
+
+   @param current the binary_file_t instance
+   @param array the items to be written
+   @param count the number of items
+*/
+void binary_file_put_float64_array_le( binary_file_t *current, float64_t *array, int32_t count );
+
 /*
    Input
 */
@@ -1302,6 +1744,39 @@ binary_file_read_float64_le( binary_file_t *current );
 raw_buffer_t *
 binary_file_read_raw_buffer( binary_file_t *current, int32_t count );
 
+/**
+   binary_file_raw_buffer_view
+
+   Return raw buffer that views count bytes of the mapped file from
+   offset, without copying them and without moving the current position.
+   The raw buffer is borrowed from the mapping, so it must be disposed
+   before the file is closed or disposed. The mapping is copy on write,
+   so puts into the raw buffer are seen by other views of the same bytes
+   but never reach the file.
+
+   @param current the binary_file_t instance
+   @param offset position of the first byte in the file
+   @param count number of bytes to view
+*/
+raw_buffer_t *
+binary_file_raw_buffer_view( binary_file_t *current, int64_t offset, int32_t count );
+
+/**
+   binary_file_read_raw_buffer_view
+
+   Return raw buffer that views count bytes of the mapped file from the
+   current position, or fewer at the end of the file, without copying
+   them, and move the current position past them. The raw buffer is
+   borrowed from the mapping, so it must be disposed before the file is
+   closed or disposed. The mapping is copy on write, so puts into the raw
+   buffer never reach the file.
+
+   @param current the binary_file_t instance
+   @param count number of bytes to view
+*/
+raw_buffer_t *
+binary_file_read_raw_buffer_view( binary_file_t *current, int32_t count );
+
 /**
    binary_file_read_string
 
@@ -1337,6 +1812,396 @@ binary_file_read_cstring( binary_file_t *current, int32_t count );
 uint8_t *
 binary_file_read_bytes( binary_file_t *current, int32_t count );
 
+/**
+   binary_file_read_int8_array
+
+   Read count items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_int8_array( binary_file_t *current, int8_t *array, int32_t count );
+
+/**
+   binary_file_read_int16_array
+
+   Read count items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_int16_array( binary_file_t *current, int16_t *array, int32_t count );
+
+/**
+   binary_file_read_int32_array
+
+   Read count items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_int32_array( binary_file_t *current, int32_t *array, int32_t count );
+
+/**
+   binary_file_read_int64_array
+
+   Read count items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_int64_array( binary_file_t *current, int64_t *array, int32_t count );
+
+/**
+   binary_file_read_uint8_array
+
+   Read count items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_uint8_array( binary_file_t *current, uint8_t *array, int32_t count );
+
+/**
+   binary_file_read_uint16_array
+
+   Read count items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_uint16_array( binary_file_t *current, uint16_t *array, int32_t count );
+
+/**
+   binary_file_read_uint32_array
+
+   Read count items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_uint32_array( binary_file_t *current, uint32_t *array, int32_t count );
+
+/**
+   binary_file_read_uint64_array
+
+   Read count items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_uint64_array( binary_file_t *current, uint64_t *array, int32_t count );
+
+/**
+   binary_file_read_float32_array
+
+   Read count items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_float32_array( binary_file_t *current, float32_t *array, int32_t count );
+
+/**
+   binary_file_read_float64_array
+
+   Read count items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_float64_array( binary_file_t *current, float64_t *array, int32_t count );
+
+/**
+   binary_file_read_int8_array_be
+
+   Read count big endian items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_int8_array_be( binary_file_t *current, int8_t *array, int32_t count );
+
+/**
+   binary_file_read_int16_array_be
+
+   Read count big endian items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_int16_array_be( binary_file_t *current, int16_t *array, int32_t count );
+
+/**
+   binary_file_read_int32_array_be
+
+   Read count big endian items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_int32_array_be( binary_file_t *current, int32_t *array, int32_t count );
+
+/**
+   binary_file_read_int64_array_be
+
+   Read count big endian items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_int64_array_be( binary_file_t *current, int64_t *array, int32_t count );
+
+/**
+   binary_file_read_uint8_array_be
+
+   Read count big endian items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_uint8_array_be( binary_file_t *current, uint8_t *array, int32_t count );
+
+/**
+   binary_file_read_uint16_array_be
+
+   Read count big endian items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_uint16_array_be( binary_file_t *current, uint16_t *array, int32_t count );
+
+/**
+   binary_file_read_uint32_array_be
+
+   Read count big endian items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_uint32_array_be( binary_file_t *current, uint32_t *array, int32_t count );
+
+/**
+   binary_file_read_uint64_array_be
+
+   Read count big endian items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_uint64_array_be( binary_file_t *current, uint64_t *array, int32_t count );
+
+/**
+   binary_file_read_float32_array_be
+
+   Read count big endian items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_float32_array_be( binary_file_t *current, float32_t *array, int32_t count );
+
+/**
+   binary_file_read_float64_array_be
+
+   Read count big endian items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_float64_array_be( binary_file_t *current, float64_t *array, int32_t count );
+
+/**
+   binary_file_read_int8_array_le
+
+   Read count little endian items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_int8_array_le( binary_file_t *current, int8_t *array, int32_t count );
+
+/**
+   binary_file_read_int16_array_le
+
+   Read count little endian items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_int16_array_le( binary_file_t *current, int16_t *array, int32_t count );
+
+/**
+   binary_file_read_int32_array_le
+
+   Read count little endian items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_int32_array_le( binary_file_t *current, int32_t *array, int32_t count );
+
+/**
+   binary_file_read_int64_array_le
+
+   Read count little endian items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_int64_array_le( binary_file_t *current, int64_t *array, int32_t count );
+
+/**
+   binary_file_read_uint8_array_le
+
+   Read count little endian items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_uint8_array_le( binary_file_t *current, uint8_t *array, int32_t count );
+
+/**
+   binary_file_read_uint16_array_le
+
+   Read count little endian items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_uint16_array_le( binary_file_t *current, uint16_t *array, int32_t count );
+
+/**
+   binary_file_read_uint32_array_le
+
+   Read count little endian items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_uint32_array_le( binary_file_t *current, uint32_t *array, int32_t count );
+
+/**
+   binary_file_read_uint64_array_le
+
+   Read count little endian items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_uint64_array_le( binary_file_t *current, uint64_t *array, int32_t count );
+
+/**
+   binary_file_read_float32_array_le
+
+   Read count little endian items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_float32_array_le( binary_file_t *current, float32_t *array, int32_t count );
+
+/**
+   binary_file_read_float64_array_le
+
+   Read count little endian items at current file position into array
+
+   @param current the binary_file_t instance
+   @param array the items read
+   @param count the number of items to read
+   @return the number of items read, less than count at end of file
+*/
+int32_t
+binary_file_read_float64_array_le( binary_file_t *current, float64_t *array, int32_t count );
+
 /*
    Removal
 */
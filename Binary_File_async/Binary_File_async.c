@@ -0,0 +1,1164 @@
+/**
+ @file Binary_File_async.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "asynchronous reads and writes of binary files"
+
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0):
+
+ 1. Permission is hereby granted to use, copy, modify and/or
+    distribute this package, provided that:
+       * copyright notices are retained unchanged,
+       * any distribution of this package, whether modified or not,
+         includes this license text.
+ 2. Permission is hereby also granted to distribute binary programs
+    which depend on this package. If the binary program depends on a
+    modified version of this package, you are encouraged to publicly
+    release the modified version of this package.
+
+ THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT WARRANTY. ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE AUTHORS BE LIABLE TO ANY PARTY FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES ARISING IN ANY WAY OUT OF THE USE OF THIS PACKAGE.
+
+
+ @section Description
+
+ Function definitions for the opaque binary_file_async_t type.
+
+ Each request in flight holds one of queue_depth slots, and the slot
+ index travels with the request to the system and back. With io_uring a
+ queued request is written straight into the submission ring and the
+ kernel sees it at the next io_uring_enter. The rings are driven with the
+ raw system calls, so no library beyond the kernel headers is needed.
+ With the thread pool a queued request waits in a fifo of slots, is
+ handed to the pool as a job when submitted, and the job puts its slot in
+ the done fifo.
+
+*/
+
+#include "Binary_File_async.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/types.h>
+
+#ifdef MULTITHREADED
+#include MULTITHREAD_INCLUDE
+#endif
+
+#include "pool.h"
+#include "dbc.h"
+
+/**
+   defines
+*/
+
+/**
+   BINARY_FILE_ASYNC_URING - defined where io_uring can be used
+*/
+
+#ifdef __linux__
+#if defined( __has_include )
+#if __has_include( <linux/io_uring.h> )
+#define BINARY_FILE_ASYNC_URING
+#endif
+#endif
+#endif
+
+#ifdef BINARY_FILE_ASYNC_URING
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#endif
+
+/**
+   request structure
+
+   one read or write in flight
+*/
+
+typedef struct
+{
+   int64_t id;
+   raw_buffer_t *buffer;
+   uint8_t *base;
+   int32_t count;
+   int64_t offset;
+   int32_t fd;
+   int32_t is_write;
+   int32_t result;
+} request_t;
+
+/**
+   fifo structure
+
+   a ring of slot indices
+*/
+
+typedef struct
+{
+   int32_t *items;
+   int32_t capacity;
+   int32_t head;
+   int32_t count;
+} fifo_t;
+
+#ifdef BINARY_FILE_ASYNC_URING
+
+/**
+   uring structure
+
+   the shared rings of an io_uring
+*/
+
+typedef struct
+{
+   int32_t fd;
+
+   uint8_t *ring;
+   size_t ring_size;
+   struct io_uring_sqe *sqes;
+   size_t sqes_size;
+
+   uint32_t *sq_tail;
+   uint32_t *sq_mask;
+   uint32_t *sq_array;
+   uint32_t *cq_head;
+   uint32_t *cq_tail;
+   uint32_t *cq_mask;
+   struct io_uring_cqe *cqes;
+
+   // tail of the submission ring as the kernel will next see it
+   uint32_t tail;
+} uring_t;
+
+#endif // BINARY_FILE_ASYNC_URING
+
+/**
+   Binary_File_async structure
+*/
+
+struct binary_file_async_struct
+{
+   int32_t _type;
+
+   int32_t queue_depth;
+   int32_t is_uring;
+   int64_t next_id;
+
+   // one request per slot, and the slots not in use
+   request_t *requests;
+   fifo_t free_slots;
+
+   // requests queued but not submitted
+   int32_t queued_count;
+
+   // requests submitted whose completions have not been collected
+   int32_t submitted_count;
+
+#ifdef BINARY_FILE_ASYNC_URING
+   uring_t uring;
+#endif // BINARY_FILE_ASYNC_URING
+
+   // thread pool, when not io_uring
+   fifo_t queued;
+   fifo_t done;
+   pool_t pool;
+
+   MULTITHREAD_COND_DEFINITION( work_done );
+   MULTITHREAD_MUTEX_DEFINITION( mutex );
+};
+
+/**
+   Invariant
+*/
+
+#if INVARIANT_CONDITIONAL != 0
+
+static
+int32_t
+storage_not_null( binary_file_async_t *p )
+{
+   int32_t result = 1;
+
+   result = ( ( (*p).requests != NULL ) && ( (*p).free_slots.items != NULL ) );
+
+   return result;
+}
+
+static
+int32_t
+counts_ok( binary_file_async_t *p )
+{
+   int32_t result = 1;
+
+   result =
+      ( (*p).queued_count >= 0 )
+      &&
+      ( (*p).submitted_count >= 0 )
+      &&
+      ( (*p).queued_count + (*p).submitted_count + (*p).free_slots.count == (*p).queue_depth );
+
+   return result;
+}
+
+static
+void invariant( binary_file_async_t *p )
+{
+   assert( ( ( void ) "storage_not_null", storage_not_null( p ) ) );
+   assert( ( ( void ) "counts_ok", counts_ok( p ) ) );
+   return;
+}
+
+#endif
+
+/**
+   fifo_make
+
+   allocate the items of a fifo of the given capacity
+*/
+
+static
+void
+fifo_make( fifo_t *fifo, int32_t capacity )
+{
+   (*fifo).items = ( int32_t * ) calloc( capacity, sizeof( int32_t ) );
+   CHECK( "(*fifo).items allocated correctly", (*fifo).items != NULL );
+
+   (*fifo).capacity = capacity;
+   (*fifo).head = 0;
+   (*fifo).count = 0;
+
+   return;
+}
+
+/**
+   fifo_put
+
+   add a slot at the tail of a fifo
+*/
+
+static
+void
+fifo_put( fifo_t *fifo, int32_t slot )
+{
+   (*fifo).items[ ( (*fifo).head + (*fifo).count ) % (*fifo).capacity ] = slot;
+   (*fifo).count = (*fifo).count + 1;
+
+   return;
+}
+
+/**
+   fifo_take
+
+   remove and return the slot at the head of a fifo
+*/
+
+static
+int32_t
+fifo_take( fifo_t *fifo )
+{
+   int32_t result = (*fifo).items[ (*fifo).head ];
+
+   (*fifo).head = ( (*fifo).head + 1 ) % (*fifo).capacity;
+   (*fifo).count = (*fifo).count - 1;
+
+   return result;
+}
+
+/**
+   run_request
+
+   do the read or write of a request with one pread or pwrite, leaving
+   the byte count or minus the error number in the request
+*/
+
+static
+void
+run_request( request_t *request )
+{
+   ssize_t n = 0;
+
+   if ( (*request).is_write == 1 )
+   {
+      n = pwrite( (*request).fd, (*request).base, (*request).count, (*request).offset );
+   }
+   else
+   {
+      n = pread( (*request).fd, (*request).base, (*request).count, (*request).offset );
+   }
+
+   (*request).result = ( n < 0 ) ? -errno : ( int32_t ) n;
+
+   return;
+}
+
+/**
+   collect
+
+   fill a completion from the request in slot and free the slot
+*/
+
+static
+void
+collect( binary_file_async_t *current, int32_t slot, int32_t result, binary_file_async_completion_t *completion )
+{
+   (*completion).id = (*current).requests[slot].id;
+   (*completion).buffer = (*current).requests[slot].buffer;
+   (*completion).result = result;
+
+   (*current).requests[slot].buffer = NULL;
+   fifo_put( &(*current).free_slots, slot );
+   (*current).submitted_count = (*current).submitted_count - 1;
+
+   return;
+}
+
+#ifdef BINARY_FILE_ASYNC_URING
+
+/**
+   uring_open
+
+   set up an io_uring of at least entries entries, return 1 on success.
+   Kernels before 5.6 lack the plain read and write operations, so their
+   rings are not used.
+*/
+
+static
+int32_t
+uring_open( uring_t *uring, int32_t entries )
+{
+   int32_t result = 0;
+   struct io_uring_params params;
+   size_t sq_size = 0;
+   size_t cq_size = 0;
+   void *p = NULL;
+
+   memset( &params, 0, sizeof( params ) );
+   memset( uring, 0, sizeof( uring_t ) );
+
+   (*uring).fd = ( int32_t ) syscall( __NR_io_uring_setup, entries, &params );
+
+   if ( (*uring).fd >= 0 )
+   {
+      if (
+         ( ( params.features & IORING_FEAT_SINGLE_MMAP ) != 0 )
+         &&
+         ( ( params.features & IORING_FEAT_RW_CUR_POS ) != 0 )
+      )
+      {
+         // the submission and completion rings share one mapping
+         sq_size = params.sq_off.array + params.sq_entries * sizeof( uint32_t );
+         cq_size = params.cq_off.cqes + params.cq_entries * sizeof( struct io_uring_cqe );
+         (*uring).ring_size = ( sq_size > cq_size ) ? sq_size : cq_size;
+
+         p = mmap( NULL, (*uring).ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, (*uring).fd, IORING_OFF_SQ_RING );
+
+         if ( p != MAP_FAILED )
+         {
+            (*uring).ring = ( uint8_t * ) p;
+            (*uring).sqes_size = params.sq_entries * sizeof( struct io_uring_sqe );
+
+            p = mmap( NULL, (*uring).sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, (*uring).fd, IORING_OFF_SQES );
+
+            if ( p != MAP_FAILED )
+            {
+               (*uring).sqes = ( struct io_uring_sqe * ) p;
+               result = 1;
+            }
+            else
+            {
+               munmap( (*uring).ring, (*uring).ring_size );
+            }
+         }
+      }
+
+      if ( result == 1 )
+      {
+         (*uring).sq_tail = ( uint32_t * ) ( (*uring).ring + params.sq_off.tail );
+         (*uring).sq_mask = ( uint32_t * ) ( (*uring).ring + params.sq_off.ring_mask );
+         (*uring).sq_array = ( uint32_t * ) ( (*uring).ring + params.sq_off.array );
+         (*uring).cq_head = ( uint32_t * ) ( (*uring).ring + params.cq_off.head );
+         (*uring).cq_tail = ( uint32_t * ) ( (*uring).ring + params.cq_off.tail );
+         (*uring).cq_mask = ( uint32_t * ) ( (*uring).ring + params.cq_off.ring_mask );
+         (*uring).cqes = ( struct io_uring_cqe * ) ( (*uring).ring + params.cq_off.cqes );
+         (*uring).tail = *(*uring).sq_tail;
+      }
+      else
+      {
+         close( (*uring).fd );
+         (*uring).fd = -1;
+      }
+   }
+
+   return result;
+}
+
+/**
+   uring_close
+
+   tear down an io_uring
+*/
+
+static
+void
+uring_close( uring_t *uring )
+{
+   munmap( (*uring).sqes, (*uring).sqes_size );
+   munmap( (*uring).ring, (*uring).ring_size );
+   close( (*uring).fd );
+   (*uring).fd = -1;
+
+   return;
+}
+
+/**
+   uring_queue
+
+   write the request in slot into the submission ring
+*/
+
+static
+void
+uring_queue( uring_t *uring, request_t *request, int32_t slot )
+{
+   uint32_t index = (*uring).tail & *(*uring).sq_mask;
+   struct io_uring_sqe *sqe = &(*uring).sqes[index];
+
+   memset( sqe, 0, sizeof( struct io_uring_sqe ) );
+   (*sqe).opcode = ( (*request).is_write == 1 ) ? IORING_OP_WRITE : IORING_OP_READ;
+   (*sqe).fd = (*request).fd;
+   (*sqe).off = ( uint64_t ) (*request).offset;
+   (*sqe).addr = ( uint64_t ) ( uintptr_t ) (*request).base;
+   (*sqe).len = ( uint32_t ) (*request).count;
+   (*sqe).user_data = ( uint64_t ) slot;
+
+   (*uring).sq_array[index] = index;
+   (*uring).tail = (*uring).tail + 1;
+
+   // publish the entry to the kernel
+   __atomic_store_n( (*uring).sq_tail, (*uring).tail, __ATOMIC_RELEASE );
+
+   return;
+}
+
+/**
+   uring_enter
+
+   submit count entries and wait for min_count completions, retrying if
+   interrupted, return the number of entries submitted
+*/
+
+static
+int32_t
+uring_enter( uring_t *uring, int32_t count, int32_t min_count )
+{
+   int32_t result = 0;
+   int32_t n = 0;
+   uint32_t flags = ( min_count > 0 ) ? IORING_ENTER_GETEVENTS : 0;
+
+   do
+   {
+      n = ( int32_t ) syscall( __NR_io_uring_enter, (*uring).fd, count - result, min_count, flags, NULL, 0 );
+
+      if ( n > 0 )
+      {
+         result = result + n;
+      }
+   }
+   while ( ( ( n < 0 ) && ( errno == EINTR ) ) || ( ( n > 0 ) && ( result < count ) ) );
+
+   return result;
+}
+
+/**
+   uring_collect
+
+   collect up to count completions from the completion ring
+*/
+
+static
+int32_t
+uring_collect( binary_file_async_t *current, binary_file_async_completion_t *completions, int32_t count )
+{
+   int32_t result = 0;
+   uring_t *uring = &(*current).uring;
+   uint32_t head = *(*uring).cq_head;
+   uint32_t tail = __atomic_load_n( (*uring).cq_tail, __ATOMIC_ACQUIRE );
+   struct io_uring_cqe *cqe = NULL;
+
+   while ( ( head != tail ) && ( result < count ) )
+   {
+      cqe = &(*uring).cqes[ head & *(*uring).cq_mask ];
+      collect( current, ( int32_t ) (*cqe).user_data, (*cqe).res, &completions[result] );
+      head = head + 1;
+      result = result + 1;
+   }
+
+   // hand the entries back to the kernel
+   __atomic_store_n( (*uring).cq_head, head, __ATOMIC_RELEASE );
+
+   return result;
+}
+
+#endif // BINARY_FILE_ASYNC_URING
+
+/**
+   pool_collect
+
+   collect up to count completions from the done fifo
+*/
+
+static
+int32_t
+pool_collect( binary_file_async_t *current, binary_file_async_completion_t *completions, int32_t count )
+{
+   int32_t result = 0;
+   int32_t slot = 0;
+
+   while ( ( (*current).done.count > 0 ) && ( result < count ) )
+   {
+      slot = fifo_take( &(*current).done );
+      collect( current, slot, (*current).requests[slot].result, &completions[result] );
+      result = result + 1;
+   }
+
+   return result;
+}
+
+/**
+   request_job
+
+   pool job that runs the request in slot index, then hands it to the done
+   fifo
+
+   @param arg the binary_file_async_t instance
+   @param index the slot of the request
+*/
+
+static
+void
+request_job( void *arg, int32_t index )
+{
+   binary_file_async_t *current = ( binary_file_async_t * ) arg;
+
+   // the slot belongs to this job until it is done
+   run_request( &(*current).requests[index] );
+
+   LOCK( (*current).mutex );
+   fifo_put( &(*current).done, index );
+   MULTITHREAD_COND_BROADCAST( (*current).work_done );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   pool_open
+
+   set up the fifos and start thread_count worker threads
+*/
+
+static
+void
+pool_open( binary_file_async_t *current, int32_t thread_count )
+{
+   fifo_make( &(*current).queued, (*current).queue_depth );
+   fifo_make( &(*current).done, (*current).queue_depth );
+
+   MULTITHREAD_COND_INIT( (*current).work_done );
+
+   pool_start( &(*current).pool, thread_count );
+
+   return;
+}
+
+/**
+   pool_close
+
+   wait for the submitted requests, then stop and join the worker threads.
+   Called with the mutex unlocked, the workers take it to finish.
+*/
+
+static
+void
+pool_close( binary_file_async_t *current )
+{
+   pool_stop( &(*current).pool );
+
+   MULTITHREAD_COND_DESTROY( (*current).work_done );
+
+   free( (*current).queued.items );
+   free( (*current).done.items );
+
+   return;
+}
+
+/**
+   make
+
+   allocate a new instance, with an io_uring if is_uring is 1 and one can
+   be set up, and with a thread pool otherwise
+*/
+
+static
+binary_file_async_t *
+make( int32_t queue_depth, int32_t is_uring, int32_t thread_count )
+{
+   int32_t i = 0;
+
+   // allocate Binary_File_async struct
+   binary_file_async_t * result
+      = ( binary_file_async_t * ) calloc( 1, sizeof( binary_file_async_t ) );
+   CHECK( "result allocated correctly", result != NULL );
+
+   // set type
+   (*result)._type = BINARY_FILE_ASYNC_TYPE;
+
+   (*result).queue_depth = queue_depth;
+   (*result).next_id = 0;
+   (*result).queued_count = 0;
+   (*result).submitted_count = 0;
+
+   (*result).requests = ( request_t * ) calloc( queue_depth, sizeof( request_t ) );
+   CHECK( "(*result).requests allocated correctly", (*result).requests != NULL );
+
+   // every slot starts free
+   fifo_make( &(*result).free_slots, queue_depth );
+   for ( i = 0; i < queue_depth; i++ )
+   {
+      fifo_put( &(*result).free_slots, i );
+   }
+
+   MULTITHREAD_MUTEX_INIT( (*result).mutex );
+
+   (*result).is_uring = 0;
+
+#ifdef BINARY_FILE_ASYNC_URING
+   if ( is_uring == 1 )
+   {
+      (*result).is_uring = uring_open( &(*result).uring, queue_depth );
+   }
+#endif // BINARY_FILE_ASYNC_URING
+
+   if ( (*result).is_uring == 0 )
+   {
+      pool_open( result, thread_count );
+   }
+
+   INVARIANT( result );
+
+   return result;
+}
+
+/**
+   queue_request
+
+   fill a free slot with a request and queue it, return its id. The
+   descriptor, base and count are found before the instance is locked.
+*/
+
+static
+int64_t
+queue_request
+(
+   binary_file_async_t *current,
+   int32_t fd,
+   raw_buffer_t *buffer,
+   uint8_t *base,
+   int32_t count,
+   int64_t offset,
+   int32_t is_write
+)
+{
+   int64_t result = (*current).next_id;
+   int32_t slot = fifo_take( &(*current).free_slots );
+   request_t *request = &(*current).requests[slot];
+
+   (*current).next_id = (*current).next_id + 1;
+
+   (*request).id = result;
+   (*request).buffer = buffer;
+   (*request).base = base;
+   (*request).count = count;
+   (*request).offset = offset;
+   (*request).fd = fd;
+   (*request).is_write = is_write;
+   (*request).result = 0;
+
+#ifdef BINARY_FILE_ASYNC_URING
+   if ( (*current).is_uring == 1 )
+   {
+      uring_queue( &(*current).uring, request, slot );
+   }
+#endif // BINARY_FILE_ASYNC_URING
+
+   if ( (*current).is_uring == 0 )
+   {
+      fifo_put( &(*current).queued, slot );
+   }
+
+   (*current).queued_count = (*current).queued_count + 1;
+
+   return result;
+}
+
+/**
+   submit
+
+   hand the queued requests to the io_uring or the workers, return the
+   number submitted
+*/
+
+static
+int32_t
+submit( binary_file_async_t *current )
+{
+   int32_t result = 0;
+   int32_t slot = 0;
+
+#ifdef BINARY_FILE_ASYNC_URING
+   if ( ( (*current).is_uring == 1 ) && ( (*current).queued_count > 0 ) )
+   {
+      result = uring_enter( &(*current).uring, (*current).queued_count, 0 );
+   }
+#endif // BINARY_FILE_ASYNC_URING
+
+   if ( (*current).is_uring == 0 )
+   {
+      while ( (*current).queued.count > 0 )
+      {
+         slot = fifo_take( &(*current).queued );
+
+         if ( (*current).pool.worker_count > 0 )
+         {
+            pool_submit( &(*current).pool, request_job, current, slot );
+         }
+         else
+         {
+            // no threads, so run the request here
+            run_request( &(*current).requests[slot] );
+            fifo_put( &(*current).done, slot );
+         }
+
+         result = result + 1;
+      }
+   }
+
+   (*current).queued_count = (*current).queued_count - result;
+   (*current).submitted_count = (*current).submitted_count + result;
+
+   return result;
+}
+
+/**
+   wait_for_completions
+
+   collect up to count completions, waiting until at least min_count have
+   been collected or none of the submitted requests are left
+*/
+
+static
+int32_t
+wait_for_completions
+(
+   binary_file_async_t *current,
+   binary_file_async_completion_t *completions,
+   int32_t min_count,
+   int32_t count
+)
+{
+   int32_t result = 0;
+
+#ifdef BINARY_FILE_ASYNC_URING
+   if ( (*current).is_uring == 1 )
+   {
+      result = uring_collect( current, completions, count );
+
+      while ( ( result < min_count ) && ( (*current).submitted_count > 0 ) )
+      {
+         // block in the kernel outside the lock
+         UNLOCK( (*current).mutex );
+         uring_enter( &(*current).uring, 0, 1 );
+         LOCK( (*current).mutex );
+
+         result = result + uring_collect( current, &completions[result], count - result );
+      }
+   }
+#endif // BINARY_FILE_ASYNC_URING
+
+   if ( (*current).is_uring == 0 )
+   {
+      result = pool_collect( current, completions, count );
+
+      while ( ( result < min_count ) && ( (*current).submitted_count > 0 ) )
+      {
+#ifdef MULTITHREADED
+         MULTITHREAD_COND_WAIT( (*current).work_done, (*current).mutex );
+#endif // MULTITHREADED
+
+         result = result + pool_collect( current, &completions[result], count - result );
+      }
+   }
+
+   return result;
+}
+
+/**
+   binary_file_async_make
+*/
+
+binary_file_async_t *
+binary_file_async_make( int32_t queue_depth )
+{
+   PRECONDITION( "queue_depth ok", queue_depth > 0 );
+
+   binary_file_async_t *result = make( queue_depth, 1, BINARY_FILE_ASYNC_DEFAULT_THREAD_COUNT );
+
+   POSTCONDITION( "queue_depth set", (*result).queue_depth == queue_depth );
+
+   return result;
+}
+
+/**
+   binary_file_async_make_thread_pool
+*/
+
+binary_file_async_t *
+binary_file_async_make_thread_pool( int32_t queue_depth, int32_t thread_count )
+{
+   PRECONDITION( "queue_depth ok", queue_depth > 0 );
+   PRECONDITION( "thread_count ok", thread_count > 0 );
+
+   binary_file_async_t *result = make( queue_depth, 0, thread_count );
+
+   POSTCONDITION( "queue_depth set", (*result).queue_depth == queue_depth );
+   POSTCONDITION( "not uring", (*result).is_uring == 0 );
+
+   return result;
+}
+
+/**
+   binary_file_async_dispose
+*/
+
+void
+binary_file_async_dispose( binary_file_async_t **current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "*current not null", *current != NULL );
+   PRECONDITION( "current type OK", (**current)._type == BINARY_FILE_ASYNC_TYPE );
+   LOCK( (**current).mutex );
+   INVARIANT( *current );
+
+#ifdef BINARY_FILE_ASYNC_URING
+   binary_file_async_completion_t completion;
+
+   if ( (**current).is_uring == 1 )
+   {
+      // the kernel may still be reading into or writing from the buffers
+      while ( (**current).submitted_count > 0 )
+      {
+         if ( uring_collect( *current, &completion, 1 ) == 0 )
+         {
+            uring_enter( &(**current).uring, 0, 1 );
+         }
+      }
+
+      uring_close( &(**current).uring );
+   }
+#endif // BINARY_FILE_ASYNC_URING
+
+   UNLOCK( (**current).mutex );
+
+   if ( (**current).is_uring == 0 )
+   {
+      pool_close( *current );
+   }
+
+   MULTITHREAD_MUTEX_DESTROY( (**current).mutex );
+
+   free( (**current).requests );
+   free( (**current).free_slots.items );
+
+   // delete binary_file_async struct
+   free( *current );
+
+   // set to null
+   *current = NULL;
+
+   return;
+}
+
+/**
+   binary_file_async_queue_depth
+*/
+
+int32_t
+binary_file_async_queue_depth( binary_file_async_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == BINARY_FILE_ASYNC_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = (*current).queue_depth;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_async_is_uring
+*/
+
+int32_t
+binary_file_async_is_uring( binary_file_async_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == BINARY_FILE_ASYNC_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = (*current).is_uring;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_async_count
+*/
+
+int32_t
+binary_file_async_count( binary_file_async_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == BINARY_FILE_ASYNC_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = (*current).queued_count + (*current).submitted_count;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_async_queued_count
+*/
+
+int32_t
+binary_file_async_queued_count( binary_file_async_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == BINARY_FILE_ASYNC_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = (*current).queued_count;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_async_is_full
+*/
+
+int32_t
+binary_file_async_is_full( binary_file_async_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == BINARY_FILE_ASYNC_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = ( (*current).free_slots.count == 0 );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_async_read
+*/
+
+int64_t
+binary_file_async_read
+(
+   binary_file_async_t *current,
+   binary_file_t *file,
+   raw_buffer_t *buffer,
+   int64_t offset
+)
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == BINARY_FILE_ASYNC_TYPE );
+   PRECONDITION( "file not null", file != NULL );
+   PRECONDITION( "file open for reading", binary_file_is_open_read( file ) == 1 );
+   PRECONDITION( "buffer not null", buffer != NULL );
+   PRECONDITION( "offset ok", offset >= 0 );
+
+   int32_t fd = binary_file_descriptor( file );
+   uint8_t *base = raw_buffer_base( buffer );
+   int32_t count = raw_buffer_count( buffer );
+
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+   PRECONDITION( "not full", (*current).free_slots.count > 0 );
+
+   int64_t result = queue_request( current, fd, buffer, base, count, offset, 0 );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_async_write
+*/
+
+int64_t
+binary_file_async_write
+(
+   binary_file_async_t *current,
+   binary_file_t *file,
+   raw_buffer_t *buffer,
+   int64_t offset
+)
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == BINARY_FILE_ASYNC_TYPE );
+   PRECONDITION( "file not null", file != NULL );
+   PRECONDITION( "file open for writing", binary_file_is_open_write( file ) == 1 );
+   PRECONDITION( "file not open for appending", binary_file_is_open_append( file ) == 0 );
+   PRECONDITION( "buffer not null", buffer != NULL );
+   PRECONDITION( "offset ok", offset >= 0 );
+
+   int32_t fd = binary_file_descriptor( file );
+   uint8_t *base = raw_buffer_base( buffer );
+   int32_t count = raw_buffer_count( buffer );
+
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+   PRECONDITION( "not full", (*current).free_slots.count > 0 );
+
+   int64_t result = queue_request( current, fd, buffer, base, count, offset, 1 );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_async_submit
+*/
+
+int32_t
+binary_file_async_submit( binary_file_async_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == BINARY_FILE_ASYNC_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = submit( current );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_async_poll
+*/
+
+int32_t
+binary_file_async_poll
+(
+   binary_file_async_t *current,
+   binary_file_async_completion_t *completions,
+   int32_t count
+)
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == BINARY_FILE_ASYNC_TYPE );
+   PRECONDITION( "completions not null", completions != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = wait_for_completions( current, completions, 0, count );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   binary_file_async_wait
+*/
+
+int32_t
+binary_file_async_wait
+(
+   binary_file_async_t *current,
+   binary_file_async_completion_t *completions,
+   int32_t min_count,
+   int32_t count
+)
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == BINARY_FILE_ASYNC_TYPE );
+   PRECONDITION( "completions not null", completions != NULL );
+   PRECONDITION( "counts ok", ( min_count >= 0 ) && ( min_count <= count ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   submit( current );
+
+   result = wait_for_completions( current, completions, min_count, count );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
@@ -0,0 +1,336 @@
+/**
+ @file Binary_File_async.h
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "asynchronous reads and writes of binary files"
+
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0):
+
+ 1. Permission is hereby granted to use, copy, modify and/or
+    distribute this package, provided that:
+       * copyright notices are retained unchanged,
+       * any distribution of this package, whether modified or not,
+         includes this license text.
+ 2. Permission is hereby also granted to distribute binary programs
+    which depend on this package. If the binary program depends on a
+    modified version of this package, you are encouraged to publicly
+    release the modified version of this package.
+
+ THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT WARRANTY. ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE AUTHORS BE LIABLE TO ANY PARTY FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES ARISING IN ANY WAY OUT OF THE USE OF THIS PACKAGE.
+
+
+ @section Description
+
+ Function declarations for the opaque binary_file_async_t type.
+
+ A binary_file_async_t instance is a queue of reads and writes of open
+ binary_file_t instances, each at a given offset of its file and into or
+ from a raw_buffer_t owned by the caller. Requests are queued with
+ binary_file_async_read and binary_file_async_write, handed to the system
+ in one batch with binary_file_async_submit, and their completions are
+ collected in batches with binary_file_async_poll, which does not block,
+ or binary_file_async_wait, which does.
+
+ On linux the requests go to an io_uring. Where io_uring is not available,
+ or for an instance made with binary_file_async_make_thread_pool, they are
+ run with pread and pwrite on a pool of worker threads.
+
+ The reads and writes use the file descriptor of the binary_file_t, at
+ explicit offsets, so they bypass its stdio buffer and do not move its
+ current position. A file and raw buffer must stay open and undisposed
+ until the requests that use them complete.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef BINARY_FILE_ASYNC_T_H
+#define BINARY_FILE_ASYNC_T_H
+
+
+/**
+   Version
+*/
+
+#define BINARY_FILE_ASYNC_VERSION_MAJOR 2
+#define BINARY_FILE_ASYNC_VERSION_MINOR 0
+#define BINARY_FILE_ASYNC_VERSION_PATCH 0
+
+#define BINARY_FILE_ASYNC_MAKE_VERSION( major, minor, patch ) \
+   ( (major)*10000 + (minor)*100 + (patch) )
+
+#define BINARY_FILE_ASYNC_VERSION \
+   BINARY_FILE_ASYNC_MAKE_VERSION( BINARY_FILE_ASYNC_VERSION_MAJOR, \
+                       BINARY_FILE_ASYNC_VERSION_MINOR, \
+                       BINARY_FILE_ASYNC_VERSION_PATCH )
+
+/**
+   Includes
+*/
+
+#include "base.h"
+#include "Binary_File.h"
+#include "Raw_Buffer.h"
+
+/**
+   BINARY_FILE_ASYNC_DEFAULT_THREAD_COUNT - workers of a thread pool made
+   when io_uring is not available
+*/
+
+#define BINARY_FILE_ASYNC_DEFAULT_THREAD_COUNT 4
+
+/**
+   Structure declarations
+*/
+
+struct binary_file_async_struct;
+
+/**
+   Structure typedefs
+*/
+
+typedef struct binary_file_async_struct binary_file_async_t;
+
+/**
+   binary_file_async_completion_t
+
+   the outcome of one request: its id, the raw buffer it read into or
+   wrote from, and the number of bytes moved, which is less than the count
+   of the raw buffer at the end of a file, or minus the error number if
+   the request failed
+*/
+
+typedef struct
+{
+   int64_t id;
+   raw_buffer_t *buffer;
+   int32_t result;
+} binary_file_async_completion_t;
+
+/*
+   Initialization
+*/
+
+/**
+   binary_file_async_make
+
+   Return a new binary_file_async_t instance that holds up to queue_depth
+   requests that have not been collected. Uses io_uring if available, and
+   a pool of BINARY_FILE_ASYNC_DEFAULT_THREAD_COUNT threads otherwise.
+
+   @param  queue_depth the most requests in flight
+   @return binary_file_async_t instance
+*/
+binary_file_async_t * binary_file_async_make( int32_t queue_depth );
+
+/**
+   binary_file_async_make_thread_pool
+
+   Return a new binary_file_async_t instance that holds up to queue_depth
+   requests that have not been collected and runs them on thread_count
+   worker threads.
+
+   @param  queue_depth the most requests in flight
+   @param  thread_count the number of worker threads
+   @return binary_file_async_t instance
+*/
+binary_file_async_t *
+binary_file_async_make_thread_pool( int32_t queue_depth, int32_t thread_count );
+
+/*
+   Disposal
+*/
+
+/**
+   binary_file_async_dispose
+
+   Free a binary_file_async_t instance, after waiting for the requests
+   already submitted to complete. Requests not submitted are dropped. The
+   files and raw buffers are not disposed.
+
+   @param  current binary_file_async_t instance
+*/
+void binary_file_async_dispose( binary_file_async_t **current );
+
+/*
+   Access
+*/
+
+/**
+   binary_file_async_queue_depth
+
+   Return the most requests that can be in flight.
+
+   @param  current binary_file_async_t instance
+   @return the queue depth
+*/
+int32_t binary_file_async_queue_depth( binary_file_async_t *current );
+
+/**
+   binary_file_async_is_uring
+
+   Return 1 if the requests go to an io_uring, 0 if they run on a thread
+   pool.
+
+   @param  current binary_file_async_t instance
+   @return 1 if io_uring, 0 otherwise
+*/
+int32_t binary_file_async_is_uring( binary_file_async_t *current );
+
+/*
+   Measurement
+*/
+
+/**
+   binary_file_async_count
+
+   Return the number of requests queued, submitted or completed that have
+   not been collected.
+
+   @param  current binary_file_async_t instance
+   @return the number of requests in flight
+*/
+int32_t binary_file_async_count( binary_file_async_t *current );
+
+/**
+   binary_file_async_queued_count
+
+   Return the number of requests queued that have not been submitted.
+
+   @param  current binary_file_async_t instance
+   @return the number of requests not yet submitted
+*/
+int32_t binary_file_async_queued_count( binary_file_async_t *current );
+
+/*
+   Status report
+*/
+
+/**
+   binary_file_async_is_full
+
+   Return 1 if no more requests can be queued until some are collected.
+
+   @param  current binary_file_async_t instance
+   @return 1 if full, 0 otherwise
+*/
+int32_t binary_file_async_is_full( binary_file_async_t *current );
+
+/*
+   Element change
+*/
+
+/**
+   binary_file_async_read
+
+   Queue a read of raw_buffer_count( buffer ) bytes from offset in file
+   into buffer. The file must be open for reading.
+
+   @param  current binary_file_async_t instance
+   @param  file the file to read
+   @param  buffer the raw buffer to read into
+   @param  offset the position in the file to read from
+   @return the id of the request
+*/
+int64_t
+binary_file_async_read
+(
+   binary_file_async_t *current,
+   binary_file_t *file,
+   raw_buffer_t *buffer,
+   int64_t offset
+);
+
+/**
+   binary_file_async_write
+
+   Queue a write of the contents of buffer to offset in file. The file
+   must be open for writing, and not for appending.
+
+   @param  current binary_file_async_t instance
+   @param  file the file to write
+   @param  buffer the raw buffer to write from
+   @param  offset the position in the file to write to
+   @return the id of the request
+*/
+int64_t
+binary_file_async_write
+(
+   binary_file_async_t *current,
+   binary_file_t *file,
+   raw_buffer_t *buffer,
+   int64_t offset
+);
+
+/**
+   binary_file_async_submit
+
+   Hand the queued requests to the system in one batch.
+
+   @param  current binary_file_async_t instance
+   @return the number of requests submitted
+*/
+int32_t binary_file_async_submit( binary_file_async_t *current );
+
+/**
+   binary_file_async_poll
+
+   Collect up to count completed requests into completions, without
+   waiting.
+
+   @param  current binary_file_async_t instance
+   @param  completions array of at least count completions
+   @param  count the most completions to collect
+   @return the number of completions collected
+*/
+int32_t
+binary_file_async_poll
+(
+   binary_file_async_t *current,
+   binary_file_async_completion_t *completions,
+   int32_t count
+);
+
+/**
+   binary_file_async_wait
+
+   Submit any queued requests, then collect up to count completed requests
+   into completions, waiting until at least min_count have completed or
+   none are left in flight.
+
+   @param  current binary_file_async_t instance
+   @param  completions array of at least count completions
+   @param  min_count the fewest completions to wait for
+   @param  count the most completions to collect
+   @return the number of completions collected
+*/
+int32_t
+binary_file_async_wait
+(
+   binary_file_async_t *current,
+   binary_file_async_completion_t *completions,
+   int32_t min_count,
+   int32_t count
+);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BINARY_FILE_ASYNC_T_H */
+
+/* End of file */
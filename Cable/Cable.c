@@ -120,11 +120,12 @@ struct node;
 
 /**
    Node structure definition. Holds a value. a color, and node pointers.
+   The weight is the number of characters held in the node's subtree.
 */
 
 struct node
 {
-   int32_t index;
+   int32_t weight;
    int32_t start;
    int32_t count;
    rbcolor_t color;
@@ -184,14 +185,6 @@ struct cable_cursor_struct
    local functions
 */
 
-/**
-   redo_indices
-*/
-
-static
-void
-redo_indices( cable_t *cable );
-
 /**
    black_path_count
 
@@ -240,7 +233,7 @@ node_make( cable_t *cable )
    CHECK( "node allocated correctly", node != NULL );
 
    // set values
-   (*node).index = 0;
+   (*node).weight = 0;
    (*node).start = 0;
    (*node).count = 0;
    (*node).prev = NULL;
@@ -283,7 +276,7 @@ node_make_from( cable_t *cable, node_t *n )
    CHECK( "node allocated correctly", node != NULL );
 
    // set values
-   (*node).index = (*n).index;
+   (*node).weight = 0;
    (*node).start = (*n).start;
    (*node).count = (*n).count;
    (*node).prev = (*n).prev;
@@ -327,7 +320,7 @@ node_dispose( node_t *node )
    // free string storage
    free( (*node).str );
 
-   (*node).index = 0;
+   (*node).weight = 0;
    (*node).start = 0;
    (*node).count = 0;
    (*node).color = 0;
@@ -346,79 +339,104 @@ node_dispose( node_t *node )
 
 
 /**
-   node_has_index
+   node_update_weight
 
-   does this node contain the desired index?
+   recompute the weight of a node from its count and its children's weights
 
-   @param node the node to look at
-   @param index the desired indes
-   @return 1 if index is in node, 0 otherwise
+   @param node the node to update
 */
 
 static
-int32_t
-node_has_index( node_t *n, int32_t index )
+void
+node_update_weight( node_t *node )
 {
-   int32_t result = 0;
+   (*node).weight
+      =  ( *(*node).left ).weight
+         + (*node).count
+         + ( *(*node).right ).weight;
 
-   if (
-      ( index >= (*n).index )
-      &&
-      (
-         ( index < ( (*n).index + (*n).count ) )
-         ||
-         ( (*n).count ) == 0 )
-   )
+   return;
+}
+
+/**
+   tree_update_weights
+
+   recompute the weights from node up to the tree root, then the string count
+
+   @param cable the tree of nodes
+   @param node the node to start with
+*/
+
+static
+void
+tree_update_weights( cable_t *cable, node_t *node )
+{
+   while ( ( node != &null_node ) && ( node != &(*cable).root ) )
    {
-      result = 1;
+      node_update_weight( node );
+      node = (*node).parent;
    }
 
-   return result;
+   // the root weight is the string count
+   (*cable).str_count = ( *(*cable).root.left ).weight;
+
+   return;
 }
 
 /**
-   node_for_index_recurse
+   node_set_count
 
-   look for the node that contains index, recursive
+   change the number of characters in a node, keeping the weights correct
 
-   @param node the node to start looking at
-   @param index the desired index
-   @return the node with the desired index, NULL otherwise
+   @param cable the tree of nodes
+   @param node the node to change
+   @param count the new character count
 */
 
 static
-node_t *
-node_for_index_recurse( node_t *node, int32_t index )
+void
+node_set_count( cable_t *cable, node_t *node, int32_t count )
 {
-   node_t *result = &null_node;
+   (*node).count = count;
 
-   if ( node_has_index( node, index ) == 1 )
+   // nodes not yet in the tree get their weight in tree_put
+   if ( (*node).parent != &null_node )
    {
-      result = node;
+      tree_update_weights( cable, node );
    }
 
-   if ( result == &null_node )
-   {
-      if ( ( index < (*node).index ) == 1 )
-      {
+   return;
+}
 
-         if ( (*node).left != &null_node )
-         {
-            result = node_for_index_recurse( (*node).left, index );
-         }
-      }
-   }
+/**
+   index_for_node
+
+   Return the index of the first character in node
+
+   @param node the node to query for
+   @return the index of the node's first character in the cable
+*/
+
+static
+int32_t
+index_for_node( node_t *node )
+{
+   int32_t result = 0;
+   node_t *parent = NULL;
 
-   if ( result == &null_node )
+   // count characters to the left of node on the way up to the root
+   result = ( *(*node).left ).weight;
+   parent = (*node).parent;
+
+   while ( parent != &null_node )
    {
-      if ( ( index < (*node).index ) == 0 )
+      if ( (*parent).right == node )
       {
-
-         if ( (*node).right != &null_node )
-         {
-            result = node_for_index_recurse( (*node).right, index );
-         }
+         result = result + ( *(*parent).left ).weight + (*parent).count;
       }
+
+      node = parent;
+      parent = (*node).parent;
    }
 
    return result;
@@ -439,16 +457,32 @@ node_t *
 node_for_index( cable_t *cable, int32_t index )
 {
    node_t *result = NULL;
-   node_t *node = NULL;
+   int32_t left_weight = 0;
 
-   // get root node
-   result = &null_node;
-   node = (*cable).root.left;
+   // descend from the root using the subtree weights
+   result = (*cable).root.left;
 
-   // recurse to see if can find value in tree
-   if ( node != &null_node )
+   while ( result != &null_node )
    {
-      result = node_for_index_recurse( node, index );
+      left_weight = ( *(*result).left ).weight;
+
+      if ( index < left_weight )
+      {
+         result = (*result).left;
+      }
+      else if (
+         ( index < ( left_weight + (*result).count ) )
+         ||
+         ( (*result).count == 0 )
+      )
+      {
+         break;
+      }
+      else
+      {
+         index = index - left_weight - (*result).count;
+         result = (*result).right;
+      }
    }
 
    return result;
@@ -518,6 +552,10 @@ tree_rotate_left( cable_t *cable, node_t *node )
 
       (*child).left = node;
       (*node).parent = child;
+
+      // node is now below child, recompute both weights
+      node_update_weight( node );
+      node_update_weight( child );
    }
 
    return;
@@ -562,77 +600,15 @@ tree_rotate_right( cable_t *cable, node_t *node )
 
       (*child).right = node;
       (*node).parent = child;
-   }
-
-   return;
-}
-
-
-/**
-   tree_has_recurse
-
-   does the tree contain a node, recursive
 
-   @param node the node to start looking at
-   @param nx the node to look for
-   @return 1 if found, 0 otherwise
-*/
-static
-int32_t
-tree_has_recurse( node_t *node, node_t *nx )
-{
-   int32_t result = 0;
-
-   // in order recursion - left, self, right
-   // if tested value is found, exit
-   if ( (*node).left != &null_node )
-   {
-      result = tree_has_recurse( (*node).left, nx );
+      // node is now below child, recompute both weights
+      node_update_weight( node );
+      node_update_weight( child );
    }
 
-   if ( result == 0 )
-   {
-      result = ( node == nx );
-   }
-
-   if ( result == 0 )
-   {
-      if ( (*node).right != &null_node )
-      {
-         result = tree_has_recurse( (*node).right, nx );
-      }
-   }
-   return result;
+   return;
 }
 
-/**
-   tree_has
-
-   Return 1 if rbtree has node, 0 if not
-
-   @param cable cable_t instance
-   @param nx the node to query for
-   @return 1 if found, 0 otherwise
-*/
-
-static
-int32_t
-tree_has( cable_t *cable, node_t *nx )
-{
-   int32_t result = 0;
-   node_t *node = NULL;
-
-   // get root node
-   node = (*cable).root.left;
-
-   // recurse to see if can find value in tree
-   if ( node != &null_node )
-   {
-      result = tree_has_recurse( node, nx );
-   }
-
-   return result;
-}
 
 /**
    tree_sibling_of
@@ -754,7 +730,8 @@ tree_repair_put( cable_t *cable, node_t *node )
 /**
    tree_put
 
-   put a node into the tree of nodes
+   put a node into the tree of nodes, right after its predecessor in the
+   linked list of nodes
 
    @param cable the tree of nodes
    @param n the node to add
@@ -766,24 +743,41 @@ tree_put( cable_t *cable, node_t *n )
 {
    node_t *node = NULL;
    node_t *parent = NULL;
-   int32_t result = 0;
-
-   // start at root of tree
-   node = (*cable).root.left;
-   parent = &(*cable).root;
 
    // find insertion point
-   while( node != &null_node )
+   if ( (*n).prev == NULL )
    {
-      parent = node;
-      result = ( (*n).index < (*node).index );
-      if ( result == 1 )
+      // new node is the leftmost node in the tree
+      node = (*cable).root.left;
+      parent = &(*cable).root;
+
+      while( node != &null_node )
       {
+         parent = node;
          node = (*node).left;
       }
+
+      (*parent).left = n;
+   }
+   else
+   {
+      // new node is the in order successor of its predecessor
+      parent = (*n).prev;
+
+      if ( (*parent).right == &null_node )
+      {
+         (*parent).right = n;
+      }
       else
       {
-         node = (*node).right;
+         parent = (*parent).right;
+
+         while( (*parent).left != &null_node )
+         {
+            parent = (*parent).left;
+         }
+
+         (*parent).left = n;
       }
    }
 
@@ -792,22 +786,12 @@ tree_put( cable_t *cable, node_t *n )
    (*n).right = &null_node;
    (*n).parent = parent;
    (*n).color = red;
+   (*n).weight = (*n).count;
 
-   // adjust its parent node
-   if (
-      ( parent == &(*cable).root )
-      ||
-      ( (*n).index < (*parent).index )
-   )
-   {
-      (*parent).left = n;
-      tree_repair_put( cable, n );
-   }
-   else
-   {
-      (*parent).right = n;
-      tree_repair_put( cable, n );
-   }
+   // add the new node's characters to the weights above it
+   tree_update_weights( cable, parent );
+
+   tree_repair_put( cable, n );
 
    // ensure tree root is black
    ( *(*cable).root.left ).color = black;
@@ -1133,6 +1117,10 @@ tree_remove( cable_t *cable, node_t *n )
 
       }
 
+      // take the node's characters out of the weights above it, unlinking
+      // an empty node then leaves the weights unchanged
+      node_set_count( cable, node, 0 );
+
       // get the pull_up node
       if ( (*node).left != &null_node )
       {
@@ -1202,6 +1190,9 @@ tree_remove( cable_t *cable, node_t *n )
 
       // decrement count
       (*cable).count = (*cable).count - 1;
+
+      // update string count
+      (*cable).str_count = ( *(*cable).root.left ).weight;
    }
 
    // dispose of node
@@ -1466,20 +1457,18 @@ subcable_from_bounds( cable_t *cable, int32_t start_index, int32_t end_index )
       // set to iterate through cable
       node = node_for_index( cable, start_index );
       cp = node_as_cstring( node );
-      index = (*node).index;
+      index = index_for_node( node );
       count = (*node).count;
 
       // set up new node
       i_node = 0;
       n = node_make( cable );
-      (*n).index = 0;
       (*n).start = 0;
       (*n).count = length1;
       cpn = (*n).str;
       (*result).first = n;
 
       // tree_put new node into result tree
-      redo_indices( result );
       tree_put( result, n );
 
       // copy characters into new nodes
@@ -1500,7 +1489,6 @@ subcable_from_bounds( cable_t *cable, int32_t start_index, int32_t end_index )
          {
             // is full, make new node
             n1 = node_make( cable );
-            (*n1).index = i;
             (*n1).start = 0;
 
             length1 = end_index - i;
@@ -1518,7 +1506,6 @@ subcable_from_bounds( cable_t *cable, int32_t start_index, int32_t end_index )
             i_node = 0;
 
             // put new node into tree
-            redo_indices( result );
             tree_put( result, n );
 
          }
@@ -1530,7 +1517,7 @@ subcable_from_bounds( cable_t *cable, int32_t start_index, int32_t end_index )
             if ( node != NULL )
             {
                cp = node_as_cstring( node );
-               index = (*node).index;
+               index = index_for_node( node );
                count = (*node).count;
             }
          }
@@ -1540,44 +1527,6 @@ subcable_from_bounds( cable_t *cable, int32_t start_index, int32_t end_index )
    return result;
 }
 
-/**
-   redo_indices
-
-   recalculate the start indices for each node in the cable
-
-   @param cable the cable
-*/
-
-static
-void
-redo_indices( cable_t *cable )
-{
-   node_t *node = NULL;
-   int32_t index = 0;
-   int32_t count = 0;
-
-   // start at first node, set index
-   node = (*cable).first;
-   (*node).index = 0;
-   index = (*node).index;
-   count = (*node).count;
-   node = (*node).next;
-   index = count;
-
-   // set indices through linked list
-   while ( node != NULL )
-   {
-      (*node).index = index;
-      index = index + (*node).count;
-      count = count + (*node).count;
-      node = (*node).next;
-   }
-
-   // set string count
-   (*cable).str_count = count;
-
-   return;
-}
 /**
    remove_from_bounds
 
@@ -1604,10 +1553,14 @@ remove_from_bounds( cable_t *cable, int32_t start_index, int32_t end_index )
    int32_t length1 = 0;
    int32_t count = 0;
    int32_t n_to_move = 0;
+   int32_t index1 = 0;
+   int32_t index2 = 0;
 
    // get start and end node for start and end indices
    n1 = node_for_index( cable, start_index );
    n2 = node_for_index( cable, end_index );
+   index1 = index_for_node( n1 );
+   index2 = index_for_node( n2 );
    length = end_index - start_index + 1;
 
    // cases - same node, next to each other nodes, separated nodes
@@ -1615,19 +1568,18 @@ remove_from_bounds( cable_t *cable, int32_t start_index, int32_t end_index )
    // same node
    if ( n1 == n2 )
    {
-      n_to_move = (*n1).count - length - ( start_index - (*n1).index );
+      n_to_move = (*n1).count - length - ( start_index - index1 );
       count = (*n1).count - length;
-      cp = (*n1).str;
+      cp = &( (*n1).str[ (*n1).start ] );
 
       // move the chars after end_index up to start_index
       for ( i = 0; i < n_to_move; i++ )
       {
-         cp[i + start_index - (*n1).index ] = cp[ i + end_index - (*n1).index + 1 ];
+         cp[i + start_index - index1 ] = cp[ i + end_index - index1 + 1 ];
       }
 
       // adjust node count
-      (*n1).count = count;
-      redo_indices( cable );
+      node_set_count( cable, n1, count );
 
       // now see if n1 is now empty; if so, remove
       if ( ( (*cable).count > 1 ) && ( (*n1).count ==  0 ) )
@@ -1649,7 +1601,6 @@ remove_from_bounds( cable_t *cable, int32_t start_index, int32_t end_index )
             }
          }
          tree_remove( cable, n1 );
-         redo_indices( cable );
       }
    }
 
@@ -1658,13 +1609,11 @@ remove_from_bounds( cable_t *cable, int32_t start_index, int32_t end_index )
    {
       // change count in n1 and n2, start in n2
       old_n1_count = (*n1).count;
-      (*n1).count = start_index - (*n1).index;
+      node_set_count( cable, n1, start_index - index1 );
 
       length1 = length - ( old_n1_count - (*n1).count );
       (*n2).start = (*n2).start + length1;
-      (*n2).count = (*n2).count - length1;
-
-      redo_indices( cable );
+      node_set_count( cable, n2, (*n2).count - length1 );
 
       // now see if n1 and/or n2 is now empty; if so, remove
       if ( ( (*cable).str_count > 0 ) && ( (*n1).count == 0 ) && ( (*n2).count == 0 ) )
@@ -1688,7 +1637,6 @@ remove_from_bounds( cable_t *cable, int32_t start_index, int32_t end_index )
          }
          tree_remove( cable, n1 );
          tree_remove( cable, n2 );
-         redo_indices( cable );
       }
       else if ( ( (*cable).str_count == 0 ) && ( (*n1).count == 0 ) && ( (*n2).count == 0 ) )
       {
@@ -1696,7 +1644,6 @@ remove_from_bounds( cable_t *cable, int32_t start_index, int32_t end_index )
          (*n1).prev = NULL;
          (*n1).next = NULL;
          tree_remove( cable, n2 );
-         redo_indices( cable );
       }
       else if ( ( (*cable).str_count > 0 ) && ( (*n1).count ==  0 ) )
       {
@@ -1714,7 +1661,6 @@ remove_from_bounds( cable_t *cable, int32_t start_index, int32_t end_index )
             }
          }
          tree_remove( cable, n1 );
-         redo_indices( cable );
       }
       else if ( ( (*cable).str_count > 0 ) && ( (*n2).count ==  0 ) )
       {
@@ -1724,7 +1670,6 @@ remove_from_bounds( cable_t *cable, int32_t start_index, int32_t end_index )
             ( *(*n2).next ).prev = n1;
          }
          tree_remove( cable, n2 );
-         redo_indices( cable );
       }
 
    }
@@ -1742,19 +1687,17 @@ remove_from_bounds( cable_t *cable, int32_t start_index, int32_t end_index )
       }
 
       // adjust n1 count
-      (*n1).count = start_index - (*n1).index;
+      node_set_count( cable, n1, start_index - index1 );
 
       // adjust n2 start, count
-      length1 = (*n2).count - ( end_index - (*n2).index + 1 );
-      (*n2).start = end_index - (*n2).index + 1;
-      (*n2).count = length1;
+      length1 = (*n2).count - ( end_index - index2 + 1 );
+      (*n2).start = (*n2).start + end_index - index2 + 1;
+      node_set_count( cable, n2, length1 );
 
       // set pointers
       (*n1).next = n2;
       (*n2).prev = n1;
 
-      redo_indices( cable );
-
       // now see if n1 and/or n2 is now empty; if so, remove
       if ( ( (*cable).count > 1 ) && ( (*n1).count ==  0 ) )
       {
@@ -1774,7 +1717,6 @@ remove_from_bounds( cable_t *cable, int32_t start_index, int32_t end_index )
             nx = (*n1).prev;
          }
          tree_remove( cable, n1 );
-         redo_indices( cable );
          n1 = nx;
       }
 
@@ -1797,7 +1739,6 @@ remove_from_bounds( cable_t *cable, int32_t start_index, int32_t end_index )
             }
          }
          tree_remove( cable, n2 );
-         redo_indices( cable );
       }
 
    }
@@ -1827,6 +1768,7 @@ insert_at_index( cable_t *cable, int32_t index, int32_t count )
    char_t *cp = NULL;
    char_t *cp1 = NULL;
    int32_t length = 0;
+   int32_t offset = 0;
 
    // see if we're adding at the end of the cable
    if ( index == (*cable).str_count )
@@ -1850,7 +1792,6 @@ insert_at_index( cable_t *cable, int32_t index, int32_t count )
          node = node_make( cable );
          (*node).prev = node1;
          (*node1).next = node;
-         (*node).index = (*cable).str_count;
          if ( ( count - length ) < (*cable).str_length )
          {
             (*node).count = count - length;
@@ -1862,7 +1803,6 @@ insert_at_index( cable_t *cable, int32_t index, int32_t count )
             length = length + (*cable).str_length;
          }
 
-         redo_indices( cable );
          tree_put( cable, node );
          node1 = node;
       }
@@ -1886,6 +1826,7 @@ insert_at_index( cable_t *cable, int32_t index, int32_t count )
       {
          cp1 = (*n1).str;
          n2 = (*n1).next;
+         offset = index - index_for_node( n1 );
       }
 
       // see if count chars will fit in n1
@@ -1901,15 +1842,13 @@ insert_at_index( cable_t *cable, int32_t index, int32_t count )
          // and move chars after (*n1).count
          memmove
          (
-            &( (*n1).str[ index - (*n1).index + count ] ),
-            &( (*n1).str[ index - (*n1).index ] ),
-            (*n1).count - ( index - (*n1).index )
+            &( (*n1).str[ offset + count ] ),
+            &( (*n1).str[ offset ] ),
+            (*n1).count - offset
          );
 
          // adjust node count
-         (*n1).count = (*n1).count + count;
-
-         redo_indices( cable );
+         node_set_count( cable, n1, (*n1).count + count );
       }
       // add new node(s) to hold new chars
       else
@@ -1932,12 +1871,12 @@ insert_at_index( cable_t *cable, int32_t index, int32_t count )
          memmove
          (
             &( cp[ 0 ] ),
-            &( cp1[ (*n1).start + index - (*n1).index ] ),
-            (*n1).count - ( index - (*n1).index + (*n1).start )
+            &( cp1[ (*n1).start + offset ] ),
+            (*n1).count - offset
          );
 
-         (*node).count = (*n1).count - ( index - (*n1).index + (*n1).start );
-         (*n1).count = index - (*n1).index - (*n1).start;
+         (*node).count = (*n1).count - offset;
+         node_set_count( cable, n1, offset );
 
          // haven't added any chars yet, now do so one node at a time
          length = 0;
@@ -1968,74 +1907,47 @@ insert_at_index( cable_t *cable, int32_t index, int32_t count )
             nodex = node;
          }
 
-         redo_indices( cable );
-
-         // remove nodes with zero count, if any
-         node1 = (*cable).first;
-         nodex = (*node1).next;
+         // remove nodes with zero count, if any, and put new nodes into tree
+         node = n1;
 
-         while ( (*node1).count == 0 )
+         while( node != n2 )
          {
-            // update n1 if it has count of 0
-            if ( node1 == n1 )
-            {
-               n1 = (*node1).next;
-            }
-
-            (*nodex).prev = NULL;
-            (*cable).first = nodex;
-
-            // remove from tree and dispose of node
-            tree_remove( cable, node1 );
+            node1 = (*node).next;
 
-            node1 = (*cable).first;
-            nodex = (*node1).next;
-         }
-
-         while( nodex != n2 )
-         {
-            if ( (*nodex).count == 0 )
+            if ( (*node).count == 0 )
             {
-               // update n1 if it has count of 0
-               if ( nodex == n1 )
+               // take node out of linked list
+               if ( (*node).prev == NULL )
                {
-                  n1 = (*nodex).next;
+                  (*cable).first = node1;
+               }
+               else
+               {
+                  ( *(*node).prev ).next = node1;
                }
 
-               // take nodex out of linked list
-               (*node1).next = (*nodex).next;
-               if ( (*nodex).next != NULL )
+               if ( node1 != NULL )
                {
-                  ( *(*nodex).next ).prev = node1;
+                  (*node1).prev = (*node).prev;
                }
 
                // remove from tree and dispose of node
-               tree_remove( cable, nodex );
-
-               // prepare for next iteration
-               nodex = (*node1).next;
-            }
-            else
-            {
-               // prepare for next iteration
-               node1 = nodex;
-               nodex = (*nodex).next;
+               if ( (*node).parent == &null_node )
+               {
+                  node_dispose( node );
+               }
+               else
+               {
+                  tree_remove( cable, node );
+               }
             }
-         }
-
-         // redo indices
-         redo_indices( cable );
-
-         // put new nodes into tree
-         node = n1;
-
-         while( node != n2 )
-         {
-            if ( tree_has( cable, node ) == 0 )
+            else if ( (*node).parent == &null_node )
             {
                tree_put( cable, node );
             }
-            node = (*node).next;
+
+            // prepare for next iteration
+            node = node1;
          }
       }
    }
@@ -2101,7 +2013,7 @@ substring_index_in_bounds
    {
       // compare each character looking for substring
       node = node_for_index( cable, start_index );
-      index = (*node).index;
+      index = index_for_node( node );
       count = (*node).count;
 
       result = -1;
@@ -2112,14 +2024,14 @@ substring_index_in_bounds
          // cable access starting at index i
          nodex = node;
          cpx = node_as_cstring( nodex );
-         indexx = (*nodex).index;
+         indexx = index_for_node( nodex );
          countx = (*nodex).count;
 
          // go to start of other
          flag = 1;
          node1 = (*other).first;
          cp1 = node_as_cstring( node1 );
-         index1 = (*node1).index;
+         index1 = index_for_node( node1 );
          count1 = (*node1).count;
 
          // compare other to this spot in cable
@@ -2145,7 +2057,7 @@ substring_index_in_bounds
                if ( nodex != NULL )
                {
                   cpx = node_as_cstring( nodex );
-                  indexx = (*nodex).index;
+                  indexx = index_for_node( nodex );
                   countx = (*nodex).count;
                }
             }
@@ -2156,7 +2068,7 @@ substring_index_in_bounds
                if ( node1 != NULL )
                {
                   cp1 = node_as_cstring( node1 );
-                  index1 = (*node1).index;
+                  index1 = index_for_node( node1 );
                   count1 = (*node1).count;
                }
             }
@@ -2176,7 +2088,7 @@ substring_index_in_bounds
             node = (*node).next;
             if ( node != NULL )
             {
-               index = (*node).index;
+               index = index_for_node( node );
                count = (*node).count;
             }
          }
@@ -2242,7 +2154,7 @@ substring_index_in_bounds_cstring
    {
       // compare each character looking for substring
       node = node_for_index( cable, start_index );
-      index = (*node).index;
+      index = index_for_node( node );
       count = (*node).count;
 
       result = -1;
@@ -2253,7 +2165,7 @@ substring_index_in_bounds_cstring
          // cable access starting at index i
          nodex = node;
          cpx = node_as_cstring( nodex );
-         indexx = (*nodex).index;
+         indexx = index_for_node( nodex );
          countx = (*nodex).count;
          flag = 1;
 
@@ -2280,7 +2192,7 @@ substring_index_in_bounds_cstring
                if ( nodex != NULL )
                {
                   cpx = node_as_cstring( nodex );
-                  indexx = (*nodex).index;
+                  indexx = index_for_node( nodex );
                   countx = (*nodex).count;
                }
 
@@ -2301,7 +2213,7 @@ substring_index_in_bounds_cstring
             node = (*node).next;
             if ( node != NULL )
             {
-               index = (*node).index;
+               index = index_for_node( node );
                count = (*node).count;
             }
          }
@@ -2353,12 +2265,12 @@ replace_at_index
 
    node = node_for_index( cable, start_index );
    cp = node_as_cstring( node );
-   index = (*node).index;
+   index = index_for_node( node );
    count = (*node).count;
 
    node1 = (*other).first;
    cp1 = node_as_cstring( node1 );
-   index1 = (*node1).index;
+   index1 = index_for_node( node1 );
    count1 = (*node1).count;
 
    // write over cable with other's contents
@@ -2377,7 +2289,7 @@ replace_at_index
          if ( node != NULL )
          {
             cp = node_as_cstring( node );
-            index = (*node).index;
+            index = index_for_node( node );
             count = (*node).count;
          }
       }
@@ -2389,7 +2301,7 @@ replace_at_index
          if ( node1 != NULL )
          {
             cp1 = node_as_cstring( node1 );
-            index1 = (*node1).index;
+            index1 = index_for_node( node1 );
             count1 = (*node1).count;
          }
       }
@@ -2436,7 +2348,7 @@ replace_at_index_cstring
 
    node = node_for_index( cable, start_index );
    cp = node_as_cstring( node );
-   index = (*node).index;
+   index = index_for_node( node );
    count = (*node).count;
 
    // write over cable with other's contents
@@ -2455,7 +2367,7 @@ replace_at_index_cstring
          if ( node != NULL )
          {
             cp = node_as_cstring( node );
-            index = (*node).index;
+            index = index_for_node( node );
             count = (*node).count;
          }
       }
@@ -2530,14 +2442,14 @@ in_order_recurse( node_t *node )
 
    if ( (*node).left != &null_node )
    {
-      result = ( ( *(*node).left ).index < (*node).index );
+      result = ( index_for_node( (*node).left ) < index_for_node( node ) );
    }
 
    if ( result == 1 )
    {
       if ( (*node).right != &null_node )
       {
-         result = ( (*node).index < ( *(*node).right ).index );
+         result = ( index_for_node( node ) < index_for_node( (*node).right ) );
       }
    }
 
@@ -2611,6 +2523,11 @@ null_node_ok( cable_t *p )
       result = ( null_node.color == black );
    }
 
+   if ( result == 1 )
+   {
+      result = ( null_node.weight == 0 );
+   }
+
    return result;
 }
 
@@ -2675,7 +2592,7 @@ indices_ok( cable_t *p )
 
    node = (*p).first;
 
-   result = ( (*node).index == 0 );
+   result = ( index_for_node( node ) == 0 );
 
    if ( result == 1 )
    {
@@ -2684,7 +2601,7 @@ indices_ok( cable_t *p )
 
       while( ( node != NULL ) && ( result == 1 ) )
       {
-         result = ( (*node).index == index );
+         result = ( index_for_node( node ) == index );
          index = index + (*node).count;
          node = (*node).next;
       }
@@ -2699,7 +2616,7 @@ indices_ok( cable_t *p )
       while( ( cursor_off( cursor ) == 0 ) && ( result == 1 ) )
       {
          node = cursor_item( cursor );
-         result = ( (*node).index == index );
+         result = ( index_for_node( node ) == index );
          index = index + (*node).count;
          cursor_forth( cursor );
       }
@@ -2710,6 +2627,51 @@ indices_ok( cable_t *p )
    return result;
 }
 
+static
+int32_t
+weights_ok_recurse( node_t *node )
+{
+   int32_t result = 1;
+
+   result
+      =  ( (*node).weight
+           == ( *(*node).left ).weight + (*node).count + ( *(*node).right ).weight );
+
+   if ( result == 1 )
+   {
+      if ( (*node).left != &null_node )
+      {
+         result = weights_ok_recurse( (*node).left );
+      }
+   }
+
+   if ( result == 1 )
+   {
+      if ( (*node).right != &null_node )
+      {
+         result = weights_ok_recurse( (*node).right );
+      }
+   }
+
+   return result;
+}
+
+static
+int32_t
+weights_ok( cable_t *p )
+{
+   int32_t result = 1;
+
+   result = ( ( *(*p).root.left ).weight == (*p).str_count );
+
+   if ( ( result == 1 ) && ( (*p).root.left != &null_node ) )
+   {
+      result = weights_ok_recurse( (*p).root.left );
+   }
+
+   return result;
+}
+
 static
 int32_t
 sequence_ok( cable_t *p )
@@ -2895,6 +2857,7 @@ void invariant( cable_t *p )
    assert( ( ( void ) "nonnegative string count", nonnegative_str_count( p ) ) );
    assert( ( ( void ) "valid string count", valid_str_count( p ) ) );
    assert( ( ( void ) "indices ok", indices_ok( p ) ) );
+   assert( ( ( void ) "weights ok", weights_ok( p ) ) );
    assert( ( ( void ) "sequence ok", sequence_ok( p ) ) );
    assert( ( ( void ) "links ok", links_ok( p ) ) );
    assert( ( ( void ) "node colors ok", node_colors_ok( p ) ) );
@@ -3086,8 +3049,7 @@ cable_make_from( cable_t *cable )
          flag = 0;
       }
 
-      // adjust indices and counts
-      redo_indices( result );
+      // put node into tree
       tree_put( result, n );
 
       // prepare for next iteration
@@ -3137,11 +3099,8 @@ cable_make_from_cstring( char_t *str )
             s[j] = str[j];
          }
          (*node).start = 0;
-         (*node).count = j;
+         node_set_count( result, node, j );
          n1 = node;
-
-         // adjust indices
-         redo_indices( result );
       }
       else
       {
@@ -3151,7 +3110,6 @@ cable_make_from_cstring( char_t *str )
          {
             s[j] = str[i + j];
          }
-         (*node).index = i;
          (*node).start = 0;
          (*node).count = j;
 
@@ -3162,8 +3120,7 @@ cable_make_from_cstring( char_t *str )
          // prepare for next iteration
          n1 = node;
 
-         // adjust indices and put node into tree
-         redo_indices( result );
+         // put node into tree
          tree_put( result, node );
       }
       count = count + j;
@@ -3211,11 +3168,8 @@ cable_make_capacity_from_cstring( char_t *str, int32_t capacity )
             s[j] = str[j];
          }
          (*node).start = 0;
-         (*node).count = j;
+         node_set_count( result, node, j );
          n1 = node;
-
-         // adjust indices
-         redo_indices( result );
       }
       else
       {
@@ -3225,7 +3179,6 @@ cable_make_capacity_from_cstring( char_t *str, int32_t capacity )
          {
             s[j] = str[i + j];
          }
-         (*node).index = i;
          (*node).start = 0;
          (*node).count = j;
 
@@ -3236,8 +3189,7 @@ cable_make_capacity_from_cstring( char_t *str, int32_t capacity )
          // prepare for next iteration
          n1 = node;
 
-         // adjust indices and put node into tree
-         redo_indices( result );
+         // put node into tree
          tree_put( result, node );
       }
       count = count + j;
@@ -3303,7 +3255,7 @@ cable_item( cable_t *cable, int32_t index )
 
    node_t *node = node_for_index( cable, index );
 
-   char_t result = (*node).str[ index - (*node).index + (*node).start ];
+   char_t result = (*node).str[ index - index_for_node( node ) + (*node).start ];
 
    INVARIANT( cable );
    UNLOCK( (*cable).mutex );
@@ -3555,12 +3507,12 @@ cable_is_equal( cable_t *cable, cable_t *other )
       // cables are same length, compare each character
       node = (*cable).first;
       cp = node_as_cstring( node );
-      index = (*node).index;
+      index = index_for_node( node );
       count = (*node).count;
 
       node1 = (*other).first;
       cp1 = node_as_cstring( node1 );
-      index1 = (*node1).index;
+      index1 = index_for_node( node1 );
       count1 = (*node1).count;
 
       result = 1;
@@ -3587,7 +3539,7 @@ cable_is_equal( cable_t *cable, cable_t *other )
             if ( node != NULL )
             {
                cp = node_as_cstring( node );
-               index = (*node).index;
+               index = index_for_node( node );
                count = (*node).count;
             }
          }
@@ -3598,7 +3550,7 @@ cable_is_equal( cable_t *cable, cable_t *other )
             if ( node1 != NULL )
             {
                cp1 = node_as_cstring( node1 );
-               index1 = (*node1).index;
+               index1 = index_for_node( node1 );
                count1 = (*node1).count;
             }
          }
@@ -3648,7 +3600,7 @@ cable_is_equal_cstring( cable_t *cable, char_t *other )
       // cables are same length, compare each character
       node = (*cable).first;
       cp = node_as_cstring( node );
-      index = (*node).index;
+      index = index_for_node( node );
       count = (*node).count;
 
       result = 1;
@@ -3675,7 +3627,7 @@ cable_is_equal_cstring( cable_t *cable, char_t *other )
             if ( node != NULL )
             {
                cp = node_as_cstring( node );
-               index = (*node).index;
+               index = index_for_node( node );
                count = (*node).count;
             }
          }
@@ -3730,12 +3682,12 @@ cable_is_less_than( cable_t *cable, cable_t *other )
    // cables are same length, compare each character
    node = (*cable).first;
    cp = node_as_cstring( node );
-   index = (*node).index;
+   index = index_for_node( node );
    count = (*node).count;
 
    node1 = (*other).first;
    cp1 = node_as_cstring( node1 );
-   index1 = (*node1).index;
+   index1 = index_for_node( node1 );
    count1 = (*node1).count;
 
    result = 0;
@@ -3769,7 +3721,7 @@ cable_is_less_than( cable_t *cable, cable_t *other )
          if ( node != NULL )
          {
             cp = node_as_cstring( node );
-            index = (*node).index;
+            index = index_for_node( node );
             count = (*node).count;
          }
       }
@@ -3780,7 +3732,7 @@ cable_is_less_than( cable_t *cable, cable_t *other )
          if ( node1 != NULL )
          {
             cp1 = node_as_cstring( node1 );
-            index1 = (*node1).index;
+            index1 = index_for_node( node1 );
             count1 = (*node1).count;
          }
       }
@@ -3839,7 +3791,7 @@ cable_is_less_than_cstring( cable_t *cable, char_t *other )
    // cables are same length, compare each character
    node = (*cable).first;
    cp = node_as_cstring( node );
-   index = (*node).index;
+   index = index_for_node( node );
    count = (*node).count;
 
    result = 0;
@@ -3873,7 +3825,7 @@ cable_is_less_than_cstring( cable_t *cable, char_t *other )
          if ( node != NULL )
          {
             cp = node_as_cstring( node );
-            index = (*node).index;
+            index = index_for_node( node );
             count = (*node).count;
          }
       }
@@ -3937,12 +3889,12 @@ cable_is_greater_than( cable_t *cable, cable_t *other )
    // cables are same length, compare each character
    node = (*cable).first;
    cp = node_as_cstring( node );
-   index = (*node).index;
+   index = index_for_node( node );
    count = (*node).count;
 
    node1 = (*other).first;
    cp1 = node_as_cstring( node1 );
-   index1 = (*node1).index;
+   index1 = index_for_node( node1 );
    count1 = (*node1).count;
 
    result = 0;
@@ -3976,7 +3928,7 @@ cable_is_greater_than( cable_t *cable, cable_t *other )
          if ( node != NULL )
          {
             cp = node_as_cstring( node );
-            index = (*node).index;
+            index = index_for_node( node );
             count = (*node).count;
          }
       }
@@ -3987,7 +3939,7 @@ cable_is_greater_than( cable_t *cable, cable_t *other )
          if ( node1 != NULL )
          {
             cp1 = node_as_cstring( node1 );
-            index1 = (*node1).index;
+            index1 = index_for_node( node1 );
             count1 = (*node1).count;
          }
       }
@@ -4046,7 +3998,7 @@ cable_is_greater_than_cstring( cable_t *cable, char_t *other )
    // cables are same length, compare each character
    node = (*cable).first;
    cp = node_as_cstring( node );
-   index = (*node).index;
+   index = index_for_node( node );
    count = (*node).count;
 
    result = 0;
@@ -4080,7 +4032,7 @@ cable_is_greater_than_cstring( cable_t *cable, char_t *other )
          if ( node != NULL )
          {
             cp = node_as_cstring( node );
-            index = (*node).index;
+            index = index_for_node( node );
             count = (*node).count;
          }
       }
@@ -4467,7 +4419,7 @@ cable_split( cable_t *cable, char_t *separators, int32_t *result_count )
 
    node = (*cable).first;
    cp = node_as_cstring( node );
-   index = (*node).index;
+   index = index_for_node( node );
    count = (*node).count;
    start_index = 0;
 
@@ -4524,7 +4476,7 @@ cable_split( cable_t *cable, char_t *separators, int32_t *result_count )
          if ( node != NULL )
          {
             cp = node_as_cstring( node );
-            index = (*node).index;
+            index = index_for_node( node );
             count = (*node).count;
          }
       }
@@ -4599,7 +4551,7 @@ cable_as_lower
    // get lower case for each character, replace it
    node = node_for_index( result, 0 );
    cp = node_as_cstring( node );
-   index = (*node).index;
+   index = index_for_node( node );
    count = (*node).count;
 
    // see if this spot in cable is equal to other
@@ -4619,7 +4571,7 @@ cable_as_lower
             if ( node != NULL )
             {
                cp = node_as_cstring( node );
-               index = (*node).index;
+               index = index_for_node( node );
                count = (*node).count;
             }
          }
@@ -4669,7 +4621,7 @@ cable_as_upper
    // get upper case for each character, replace it
    node = node_for_index( result, 0 );
    cp = node_as_cstring( node );
-   index = (*node).index;
+   index = index_for_node( node );
    count = (*node).count;
 
    // see if this spot in cable is equal to other
@@ -4687,7 +4639,7 @@ cable_as_upper
          if ( node != NULL )
          {
             cp = node_as_cstring( node );
-            index = (*node).index;
+            index = index_for_node( node );
             count = (*node).count;
          }
       }
@@ -4715,7 +4667,7 @@ cable_put( cable_t *cable, char_t c, int32_t index )
 
    node_t *node = node_for_index( cable, index );
 
-   (*node).str[ index - (*node).index + (*node).start ] = c;
+   (*node).str[ index - index_for_node( node ) + (*node).start ] = c;
 
    INVARIANT( cable );
    UNLOCK( (*cable).mutex );
@@ -5053,14 +5005,12 @@ cable_append( cable_t *cable, cable_t *other )
       // get next node in other
       n = (*n).next;
 
-      // set index, next, prev
-      (*node).index = (*cable).str_count;
+      // set next, prev
       cursor_finish( cursor );
       last = cursor_item( cursor );
       (*last).next = node;
       (*node).prev = last;
 
-      redo_indices( cable );
 
       // put new node into cable
       tree_put( cable, node );
@@ -5100,14 +5050,12 @@ cable_append_destructive( cable_t *cable, cable_t **other )
 
    while( n != NULL )
    {
-      // set index, next, prev
-      (*n).index = (*cable).str_count;
+      // set next, prev
       cursor_finish( cursor );
       last = cursor_item( cursor );
       (*last).next = n;
       (*n).prev = last;
 
-      redo_indices( cable );
 
       // put new node into cable
       tree_put( cable, n );
@@ -5168,15 +5116,13 @@ cable_append_cstring( cable_t *cable, char_t *other_cstring )
       // get next node in other
       n = (*n).next;
 
-      // set index, next, prev
-      (*node).index = (*cable).str_count;
+      // set next, prev
       cursor_finish( cursor );
       last = cursor_item( cursor );
       (*last).next = node;
       (*node).prev = last;
       (*node).next = NULL;
 
-      redo_indices( cable );
 
       // put new node into cable
       tree_put( cable, node );
@@ -5228,8 +5174,7 @@ cable_prepend( cable_t *cable, cable_t *other )
       // get first node in cable
       first = (*cable).first;
 
-      // set index, next, prev
-      (*node).index = 0;
+      // set next, prev
       (*node).next = first;
       (*node).prev = NULL;
       (*first).prev = node;
@@ -5237,7 +5182,6 @@ cable_prepend( cable_t *cable, cable_t *other )
       // put new node into cable
       (*cable).first = node;
 
-      redo_indices( cable );
 
       tree_put( cable, node );
 
@@ -5282,8 +5226,7 @@ cable_prepend_destructive( cable_t *cable, cable_t **other )
       // get first node in cable
       first = (*cable).first;
 
-      // set index, next, prev
-      (*n).index = 0;
+      // set next, prev
       (*n).next = first;
       (*n).prev = NULL;
       (*first).prev = n;
@@ -5291,7 +5234,6 @@ cable_prepend_destructive( cable_t *cable, cable_t **other )
       // put new node into cable
       (*cable).first = n;
 
-      redo_indices( cable );
 
       tree_put( cable, n );
 
@@ -5357,8 +5299,7 @@ cable_prepend_cstring( cable_t *cable, char_t *other_cstring )
       // get first node in cable
       first = (*cable).first;
 
-      // set index, next, prev
-      (*node).index = 0;
+      // set next, prev
       (*node).next = first;
       (*node).prev = NULL;
       (*first).prev = node;
@@ -5366,7 +5307,6 @@ cable_prepend_cstring( cable_t *cable, char_t *other_cstring )
       // put new node into cable
       (*cable).first = node;
 
-      redo_indices( cable );
 
       tree_put( cable, node );
 
@@ -5432,6 +5372,7 @@ cable_insert_destructive( cable_t *cable, cable_t **other, int32_t start_index )
    node_t *first = NULL;
    node_t *last = NULL;
    cable_cursor_t *cursor = NULL;
+   int32_t index = 0;
 
    if ( start_index == 0 )
    {
@@ -5450,8 +5391,7 @@ cable_insert_destructive( cable_t *cable, cable_t **other, int32_t start_index )
          // get first node in cable
          first = (*cable).first;
 
-         // set index, next, prev
-         (*n).index = 0;
+         // set next, prev
          (*n).next = first;
          (*n).prev = NULL;
          (*first).prev = n;
@@ -5459,7 +5399,6 @@ cable_insert_destructive( cable_t *cable, cable_t **other, int32_t start_index )
          // put new node into cable
          (*cable).first = n;
 
-         redo_indices( cable );
 
          tree_put( cable, n );
 
@@ -5488,7 +5427,6 @@ cable_insert_destructive( cable_t *cable, cable_t **other, int32_t start_index )
          (*n).prev = last;
          (*n).next = NULL;
 
-         redo_indices( cable );
 
          // put new node into cable
          tree_put( cable, n );
@@ -5502,7 +5440,8 @@ cable_insert_destructive( cable_t *cable, cable_t **other, int32_t start_index )
    {
       // somewhere in between
       n1 = node_for_index( cable, start_index );
-      if ( (*n1).index == start_index )
+      index = index_for_node( n1 );
+      if ( index == start_index )
       {
          // don't need to split node
          n2 = n1;
@@ -5524,16 +5463,15 @@ cable_insert_destructive( cable_t *cable, cable_t **other, int32_t start_index )
          memcpy
          (
             (*n2).str,
-            &( (*n1).str[start_index - (*n1).index] ),
-            (*n1).count - ( start_index - (*n1).index )
+            &( (*n1).str[ (*n1).start + start_index - index ] ),
+            (*n1).count - ( start_index - index )
          );
 
          // adjust counts
-         (*n2).count = (*n1).count - ( start_index - (*n1).index );
-         (*n1).count = start_index - (*n1).index;
+         (*n2).count = (*n1).count - ( start_index - index );
+         node_set_count( cable, n1, start_index - index );
 
          // put new node into cable
-         redo_indices( cable );
          tree_put( cable, n2 );
 
       }
@@ -5553,7 +5491,6 @@ cable_insert_destructive( cable_t *cable, cable_t **other, int32_t start_index )
          (*n1).next = n;
          (*n2).prev = n;
 
-         redo_indices( cable );
 
          // put new node into cable
          tree_put( cable, n );
@@ -5625,7 +5562,7 @@ cable_append_character( cable_t *cable, char_t c )
 
    // put the character in the new space
    node = node_for_index( cable, index );
-   (*node).str[ index - (*node).index + (*node).start ] = c;
+   (*node).str[ index - index_for_node( node ) + (*node).start ] = c;
 
    INVARIANT( cable );
    UNLOCK( (*cable).mutex );
@@ -5654,7 +5591,7 @@ cable_prepend_character( cable_t *cable, char_t c )
 
    // put the character in the new space
    node = node_for_index( cable, index );
-   (*node).str[ index - (*node).index + (*node).start ] = c;
+   (*node).str[ index - index_for_node( node ) + (*node).start ] = c;
 
    INVARIANT( cable );
    UNLOCK( (*cable).mutex );
@@ -5681,7 +5618,7 @@ cable_insert_character( cable_t *cable, char_t c, int32_t index )
 
    // put the character in the new space
    node = node_for_index( cable, index );
-   (*node).str[ index - (*node).index + (*node).start ] = c;
+   (*node).str[ index - index_for_node( node ) + (*node).start ] = c;
 
    INVARIANT( cable );
    UNLOCK( (*cable).mutex );
@@ -5718,7 +5655,7 @@ cable_to_lower
    // get lower case for each character, replace it
    node = node_for_index( cable, start_index );
    cp = node_as_cstring( node );
-   index = (*node).index;
+   index = index_for_node( node );
    count = (*node).count;
 
    // see if this spot in cable is equal to other
@@ -5736,7 +5673,7 @@ cable_to_lower
          if ( node != NULL )
          {
             cp = node_as_cstring( node );
-            index = (*node).index;
+            index = index_for_node( node );
             count = (*node).count;
          }
       }
@@ -5778,7 +5715,7 @@ cable_to_upper
    // get upper case for each character, replace it
    node = node_for_index( cable, start_index );
    cp = node_as_cstring( node );
-   index = (*node).index;
+   index = index_for_node( node );
    count = (*node).count;
 
    // see if this spot in cable is equal to other
@@ -5796,7 +5733,7 @@ cable_to_upper
          if ( node != NULL )
          {
             cp = node_as_cstring( node );
-            index = (*node).index;
+            index = index_for_node( node );
             count = (*node).count;
          }
       }
@@ -6095,8 +6032,8 @@ cable_reclaim( cable_t *cable )
             );
 
             // update counts
-            (*node).count = (*node).count + (*n1).count;
-            (*n1).count = 0;
+            node_set_count( cable, node, (*node).count + (*n1).count );
+            node_set_count( cable, n1, 0 );
 
             // adjust pointers to eliminate n1 from linked list
             n2 = (*n1).next;
@@ -6108,7 +6045,6 @@ cable_reclaim( cable_t *cable )
             }
 
             // remove n1
-            redo_indices( cable );
             tree_remove( cable, n1 );
 
             // update for next iteration
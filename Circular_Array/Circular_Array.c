@@ -152,6 +152,66 @@ void invariant( Circular_Array_type( Prefix ) *current )
 
 #ifdef PROTOCOLS_ENABLED
 
+/**
+   reverse
+
+   reverse the order of buffer[start] to buffer[end]
+*/
+
+static
+void
+reverse( Type *buffer, int32_t start, int32_t end )
+{
+   Type t;
+
+   while ( start < end )
+   {
+      t = buffer[start];
+      buffer[start] = buffer[end];
+      buffer[end] = t;
+      start = start + 1;
+      end = end - 1;
+   }
+
+   return;
+}
+
+/**
+   span
+
+   returns the item buffer for the P_Indexable protocol, first rotating
+   the buffer in place if the items wrap around its end
+*/
+
+static
+Type *
+span( Circular_Array_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "type ok", ( (*current)._type == CIRCULAR_ARRAY_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t start_index = (*current).start_index;
+   int32_t capacity = (*current).capacity;
+
+   // rotate the buffer left by start_index so that item 0 is buffer[0]
+   if ( start_index != 0 )
+   {
+      reverse( (*current).buffer, 0, start_index - 1 );
+      reverse( (*current).buffer, start_index, capacity - 1 );
+      reverse( (*current).buffer, 0, capacity - 1 );
+      (*current).start_index = 0;
+   }
+
+   Type *result = (*current).buffer;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
 /**
    indexable protocol function array
 */
@@ -183,7 +243,8 @@ p_indexable_table[P_INDEXABLE_FUNCTION_COUNT]
    Circular_Array_count( Prefix ),
    Circular_Array_item( Prefix ),
    Circular_Array_replace( Prefix ),
-   Circular_Array_replace_and_dispose( Prefix )
+   Circular_Array_replace_and_dispose( Prefix ),
+   span
 };
 
 /**
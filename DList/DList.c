@@ -4894,20 +4894,143 @@ DList_swap( Prefix )( DList_type( Prefix ) *current, int32_t i, int32_t j )
    Sorting stuff
 */
 
+#define SORT_BIN_COUNT 32
+
+/**
+   merge_runs
+
+   merge two sorted chains of nodes, taking from a on ties so that the
+   merge is stable
+
+   @param a the chain holding the earlier items
+   @param b the chain holding the later items
+   @param sort_func function to compare two values
+   @param last if not NULL, set to the last node of the merged chain
+   @return the first node of the merged chain
+*/
+
 static
-int32_t ( *value_sort_func_name )( Type v1, Type v2 ) = NULL;
+node_t *
+merge_runs
+(
+   node_t *a,
+   node_t *b,
+   int32_t ( *sort_func )( Type v1, Type v2 ),
+   node_t **last
+)
+{
+   node_t head;
+   node_t *tail = &head;
+
+   while ( ( a != NULL ) && ( b != NULL ) )
+   {
+      if ( sort_func( (*a).value, (*b).value ) <= 0 )
+      {
+         (*tail).next = a;
+         tail = a;
+         a = (*a).next;
+      }
+      else
+      {
+         (*tail).next = b;
+         tail = b;
+         b = (*b).next;
+      }
+   }
+
+   // append what is left of either chain
+   if ( a != NULL )
+   {
+      (*tail).next = a;
+   }
+   else
+   {
+      (*tail).next = b;
+   }
+
+   // find the last node only when the caller wants it
+   if ( last != NULL )
+   {
+      while ( (*tail).next != NULL )
+      {
+         tail = (*tail).next;
+      }
+
+      *last = tail;
+   }
+
+   return head.next;
+}
 
 /**
-   node_sort_func
+   merge_sort
+
+   sort a chain of nodes by relinking them. Runs of 1, 2, 4, ... nodes are
+   kept in bins like the digits of a binary counter and merged as soon as
+   two of the same length exist, so merges work on recently touched nodes.
+   Stable and needs no shared state, so independent lists can be sorted
+   concurrently.
 
-   compare nodes by their value accorting to value_sort_func
+   @param first the first node of a NULL terminated chain, not NULL
+   @param sort_func function to compare two values
+   @param last set to the last node of the sorted chain
+   @return the first node of the sorted chain
 */
 
 static
-int32_t
-node_sort_func( node_t **n1, node_t **n2 )
+node_t *
+merge_sort
+(
+   node_t *first,
+   int32_t ( *sort_func )( Type v1, Type v2 ),
+   node_t **last
+)
 {
-   int32_t result = value_sort_func_name( (**n1).value, (**n2).value );
+   node_t *bin[SORT_BIN_COUNT] = { NULL };
+   node_t *run = NULL;
+   node_t *result = NULL;
+   node_t *tail = NULL;
+   int32_t bin_count = 0;
+   int32_t i = 0;
+
+   while ( first != NULL )
+   {
+      // take the next node as a run of one
+      run = first;
+      first = (*first).next;
+      (*run).next = NULL;
+
+      // carry into higher bins, earlier runs are in the bins
+      i = 0;
+      while ( ( i < bin_count ) && ( bin[i] != NULL ) )
+      {
+         run = merge_runs( bin[i], run, sort_func, NULL );
+         bin[i] = NULL;
+         i = i + 1;
+      }
+
+      bin[i] = run;
+
+      if ( i == bin_count )
+      {
+         bin_count = bin_count + 1;
+      }
+   }
+
+   // merge the bins, higher bins hold earlier items, the highest bin is
+   // never empty so the last merge finds the tail
+   for( i = 0; i < bin_count - 1; i++ )
+   {
+      if ( bin[i] != NULL )
+      {
+         result = merge_runs( bin[i], result, sort_func, NULL );
+      }
+   }
+
+   result = merge_runs( bin[bin_count - 1], result, sort_func, &tail );
+
+   *last = tail;
+
    return result;
 }
 
@@ -4924,63 +5047,28 @@ DList_sort( Prefix )( DList_type( Prefix ) *list, int32_t ( *sort_func )( Type v
    LOCK( (*list).mutex );
    INVARIANT( list );
 
-   // array to use for sorting
-   node_t **array = NULL;
    node_t *node = NULL;
+   node_t *prev = NULL;
    node_t *last_node = NULL;
-   int32_t i = 0;
 
    // only sort if there's enough to sort
    if ( (*list).count > 1 )
    {
-      array = ( node_t ** ) calloc( (*list).count, sizeof( node_t * ) );
-      CHECK( "array allocated correctly", array != NULL );
+      // relink nodes in sorted order
+      (*list).first = merge_sort( (*list).first, sort_func, &last_node );
+      (*list).last = last_node;
 
-      // fill the array
+      // restore prev pointers
       node = (*list).first;
-
-      for( i = 0; i < (*list).count; i++ )
+      while ( node != NULL )
       {
-         array[i] = node;
-         node = (*node).next;
-      }
-
-      // set the sort func
-      value_sort_func_name = sort_func;
-
-      // sort the array
-      qsort( array, (*list).count, sizeof( node_t * ), ( int (*)( const void*, const void* ) ) node_sort_func );
-
-      // put sorted items into list
-      node = array[0];
-      (*list).first = node;
-      (*node).prev = NULL;
-      (*node).next = array[1];
-
-      node = (*node).next;
-
-      for( i = 1; i < (*list).count; i++ )
-      {
-         (*node).prev = array[i - 1];
-
-         if ( i == ( (*list).count - 1 ) )
-         {
-            (*node).next = NULL;
-         }
-         else
-         {
-            (*node).next = array[i + 1];
-         }
-         last_node = node;
+         (*node).prev = prev;
+         prev = node;
          node = (*node).next;
       }
 
-      (*list).last = last_node;
-
       // reset cursors
       move_all_cursors_off( list );
-
-      free( array );
    }
 
    INVARIANT( list );
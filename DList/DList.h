@@ -1288,7 +1288,9 @@ void DList_swap( Prefix )( DList_type( Prefix ) *current, int32_t i, int32_t j )
 /**
    DList_sort
 
-   Sort items in list using sort_func.
+   Sort items in list using sort_func. The sort is stable and relinks the
+   nodes in place, so different lists may be sorted at the same time from
+   different threads.
 
    @param  list DList_t instance
    @param sort_func function compare two list items
@@ -33,6 +33,24 @@
 
  Function definitions for the opaque Fft_t type.
 
+ Lengths whose prime factors are all 2, 3 or 5 are transformed by a mixed
+ radix decimation in time, with radix 4 passes used in preference to
+ radix 2. Other lengths are transformed with Bluestein's algorithm, as a
+ convolution with a chirp done through a power of two transform.
+
+ Fft_real_fft transforms 2 n real samples with a transform of length n,
+ the even samples in the real parts and the odd samples in the imaginary
+ parts, and separates the two spectra afterwards.
+
+ The twiddle factors, factors and Bluestein chirp of a length are held in
+ an Fft_plan_t, which is not changed after it is made. An Fft_t either owns
+ its plan or shares one made with Fft_plan_make, so many Fft_t instances,
+ one per thread for example, can use the same plan.
+
+ Fft_fft_batch transforms the rows of a matrix in groups that fit in
+ cache, interleaved so that the innermost loop of each butterfly runs
+ across the frames of a group with the same twiddle factor.
+
 */
 
 #include "Fft.h"
@@ -57,6 +75,12 @@ extern "C" {
 #define DTOR (M_PI/180.0)
 #define RTOD (180.0/M_PI)
 
+// most radices a length of at most 2^31 can factor into
+#define FFT_MAX_FACTOR_COUNT 32
+
+// items of a group of interleaved frames in a batch, kept within cache
+#define FFT_BATCH_ITEM_COUNT 8192
+
 /**
    Note that this include file does NOT have an include guard - it may
    be included multiple times with different macro defintions.
@@ -89,6 +113,37 @@ extern "C" {
 
 */
 
+/**
+   Fft_plan structure
+
+   Not changed after it is made, so it is read without locking
+*/
+
+struct Fft_plan_struct( Prefix )
+{
+   int32_t _type;
+
+   // length
+   int32_t length;
+
+   // radix and remaining length of each pass, 0 terminated
+   int32_t factors[ 2 * FFT_MAX_FACTOR_COUNT + 2 ];
+
+   // 1 if length has a prime factor greater than five
+   int32_t is_bluestein;
+
+   // twiddle factors, exp( 2 pi i k / length )
+   Type *twiddles;
+
+   // Bluestein convolution plan, chirp and chirp spectrum, when is_bluestein
+   Fft_plan_type( Prefix ) *convolution;
+   Type *chirp;
+   Type *chirp_spectrum;
+
+   // half length plan for real input, when length is even and not two
+   Fft_plan_type( Prefix ) *half;
+};
+
 /**
    Fft structure
 */
@@ -99,7 +154,6 @@ struct Fft_struct( Prefix )
 
    // length
    int32_t length;
-   int32_t log_length;
 
    // flags
    int32_t is_psd_done;
@@ -125,11 +179,19 @@ struct Fft_struct( Prefix )
    // phase degrees vector
    Matvec_type( Matvec_magnitude_prefix ) *phase_degrees;
 
-   // bit reverse array
-   int32_t *bit_reverse;
+   // plan, disposed with the fft if is_plan_owned
+   Fft_plan_type( Prefix ) *plan;
+   int32_t is_plan_owned;
+
+   // work array, length items
+   Type *work;
+
+   // scratch array for Bluestein transforms
+   Type *scratch;
 
-   // coefficients vector
-   Matvec_type( Matvec_prefix ) *coefficients;
+   // work array for batches, batch_work_count items
+   Type *batch_work;
+   int32_t batch_work_count;
 
    // window vector
    Matvec_type( Matvec_magnitude_prefix ) *window;
@@ -163,9 +225,9 @@ fft_done_implies_matrices_not_null( Fft_type( Prefix ) *p )
       &&
       ( (*p).phase_degrees != NULL )
       &&
-      ( (*p).bit_reverse != NULL )
+      ( (*p).work != NULL )
       &&
-      ( (*p).coefficients != NULL )
+      ( (*p).plan != NULL )
       &&
       ( (*p).window != NULL )
    )
@@ -182,7 +244,7 @@ length_positive( Fft_type( Prefix ) *p )
 {
    int32_t result = 0;
 
-   if ( ( (*p).log_length > 0 ) && ( (*p).length > 0 ) )
+   if ( (*p).length > 1 )
    {
       result = 1;
    }
@@ -237,40 +299,60 @@ static void set_window
    Fft_type( Prefix ) *fft
 );
 
-static void set_bit_reverse
+static Fft_plan_type( Prefix ) *plan_make
 (
-   Fft_type( Prefix ) *fft
+   int32_t length,
+   int32_t is_half_needed
 );
 
-static void set_coefficients
+static void plan_dispose
 (
-   Fft_type( Prefix ) *fft
+   Fft_plan_type( Prefix ) *plan
 );
 
-static void bit_reverse
+static int32_t scratch_count
 (
-   Fft_type( Prefix ) *fft,
-   Matvec_type( Matvec_prefix ) *v
+   Fft_plan_type( Prefix ) *plan
 );
 
-static int32_t is_power_of_two
+static void transform
 (
-   int32_t length
+   Fft_plan_type( Prefix ) *plan,
+   Type *in,
+   Type *out,
+   Type *scratch
 );
 
-static int32_t log_2i
+static void mixed_radix
 (
-   int32_t length
+   Type *out,
+   Type *in,
+   int32_t fstride,
+   int32_t *factors,
+   Type *twiddles,
+   int32_t b
 );
 
 /**
-   Fft_make
+   make_from_plan
+
+   make a new fft_t instance that uses plan
+
+   @param plan the plan
+   @param is_plan_owned 1 if the plan is disposed with the fft
+   @return the new fft_t instance
 */
 
+static
 Fft_type( Prefix ) *
-Fft_make( Prefix )( int32_t length )
+make_from_plan
+(
+   Fft_plan_type( Prefix ) *plan,
+   int32_t is_plan_owned
+)
 {
-   PRECONDITION( "length", is_power_of_two( length ) == 1 );
+   int32_t length = (*plan).length;
+   int32_t count = 0;
 
    // allocate result struct
    Fft_type( Prefix ) * result
@@ -280,9 +362,8 @@ Fft_make( Prefix )( int32_t length )
    // set type code
    (*result)._type = FFT_TYPE;
 
-   // set length, log length
+   // set length
    (*result).length = length;
-   (*result).log_length = log_2i( length );
 
    // set flags
    (*result).is_psd_done = 0;
@@ -290,24 +371,41 @@ Fft_make( Prefix )( int32_t length )
    (*result).is_phase_done = 0;
    (*result).is_phase_degrees_done = 0;
 
-   // allocate vectors, array
+   // set plan
+   (*result).plan = plan;
+   (*result).is_plan_owned = is_plan_owned;
+
+   // allocate vectors, arrays
    (*result).input = Matvec_make_column_vector( Matvec_prefix )( length );
    (*result).output = Matvec_make_column_vector( Matvec_prefix )( length );
    (*result).psd = Matvec_make_column_vector( Matvec_magnitude_prefix )( length );
    (*result).log_psd = Matvec_make_column_vector( Matvec_magnitude_prefix )( length );
    (*result).phase = Matvec_make_column_vector( Matvec_magnitude_prefix )( length );
    (*result).phase_degrees = Matvec_make_column_vector( Matvec_magnitude_prefix )( length );
-   
-   (*result).bit_reverse = ( int32_t * ) calloc( length, sizeof( int32_t ) );
-   CHECK( "(*result).bit_reverse allocated_correctly", (*result).bit_reverse != NULL );
 
-   (*result).coefficients = Matvec_make_column_vector( Matvec_prefix )( length );
+   (*result).work = ( Type * ) calloc( length, sizeof( Type ) );
+   CHECK( "(*result).work allocated_correctly", (*result).work != NULL );
+
+   // scratch for the plan and for the half length plan
+   count = scratch_count( plan );
+   if ( ( (*plan).half != NULL ) && ( scratch_count( (*plan).half ) > count ) )
+   {
+      count = scratch_count( (*plan).half );
+   }
+
+   if ( count > 0 )
+   {
+      (*result).scratch = ( Type * ) calloc( count, sizeof( Type ) );
+      CHECK( "(*result).scratch allocated_correctly", (*result).scratch != NULL );
+   }
+
+   (*result).batch_work = NULL;
+   (*result).batch_work_count = 0;
+
    (*result).window = Matvec_make_column_vector( Matvec_magnitude_prefix )( length );
 
-   // set bit reverse, window, coefficients
-   set_bit_reverse( result );
+   // set window
    set_window( result );
-   set_coefficients( result );
 
    MULTITHREAD_MUTEX_INIT( (*result).mutex );
 
@@ -316,6 +414,112 @@ Fft_make( Prefix )( int32_t length )
    return result;
 }
 
+/**
+   dispose_internals
+
+   dispose of the internal only arrays, the window and the plan if owned
+
+   @param current the fft_t instance
+*/
+
+static
+void
+dispose_internals
+(
+   Fft_type( Prefix ) *current
+)
+{
+   free( (*current).work );
+   free( (*current).scratch );
+   free( (*current).batch_work );
+   Matvec_deep_dispose( Matvec_magnitude_prefix )( &(*current).window );
+
+   if ( (*current).is_plan_owned == 1 )
+   {
+      plan_dispose( (*current).plan );
+   }
+
+   return;
+}
+
+/**
+   Fft_plan_make
+*/
+
+Fft_plan_type( Prefix ) *
+Fft_plan_make( Prefix )( int32_t length )
+{
+   PRECONDITION( "length", length > 1 );
+
+   Fft_plan_type( Prefix ) *result = plan_make( length, 1 );
+
+   POSTCONDITION( "result not null", result != NULL );
+
+   return result;
+}
+
+/**
+   Fft_plan_dispose
+*/
+
+void
+Fft_plan_dispose( Prefix )( Fft_plan_type( Prefix ) **plan )
+{
+   PRECONDITION( "plan not null", plan != NULL );
+   PRECONDITION( "plan not null", *plan != NULL );
+   PRECONDITION( "plan type ok", (**plan)._type == FFT_PLAN_TYPE );
+
+   plan_dispose( *plan );
+
+   // set to null
+   *plan = NULL;
+
+   return;
+}
+
+/**
+   Fft_plan_length
+*/
+
+int32_t
+Fft_plan_length( Prefix )( Fft_plan_type( Prefix ) *plan )
+{
+   PRECONDITION( "plan not null", plan != NULL );
+   PRECONDITION( "plan type ok", (*plan)._type == FFT_PLAN_TYPE );
+
+   int32_t result = (*plan).length;
+
+   return result;
+}
+
+/**
+   Fft_make
+*/
+
+Fft_type( Prefix ) *
+Fft_make( Prefix )( int32_t length )
+{
+   PRECONDITION( "length", length > 1 );
+
+   Fft_type( Prefix ) *result = make_from_plan( plan_make( length, 1 ), 1 );
+
+   return result;
+}
+
+/**
+   Fft_make_from_plan
+*/
+
+Fft_type( Prefix ) *
+Fft_make_from_plan( Prefix )( Fft_plan_type( Prefix ) *plan )
+{
+   PRECONDITION( "plan not null", plan != NULL );
+   PRECONDITION( "plan type ok", (*plan)._type == FFT_PLAN_TYPE );
+
+   Fft_type( Prefix ) *result = make_from_plan( plan, 0 );
+
+   return result;
+}
 
 /**
    Fft_dispose
@@ -330,10 +534,8 @@ Fft_dispose( Prefix )( Fft_type( Prefix ) **current )
    LOCK( (**current).mutex );
    INVARIANT(*current);
 
-   // dispose of internal only vectors and array
-   free( (**current).bit_reverse );
-   Matvec_deep_dispose( Matvec_prefix )( &(**current).coefficients );
-   Matvec_deep_dispose( Matvec_magnitude_prefix )( &(**current).window );
+   // dispose of internal only vectors and arrays
+   dispose_internals( *current );
 
    MULTITHREAD_MUTEX_DESTROY( (**current).mutex );
 
@@ -366,9 +568,7 @@ Fft_deep_dispose( Prefix )( Fft_type( Prefix ) **current )
    Matvec_deep_dispose( Matvec_magnitude_prefix )( &(**current).log_psd );
    Matvec_deep_dispose( Matvec_magnitude_prefix )( &(**current).phase );
    Matvec_deep_dispose( Matvec_magnitude_prefix )( &(**current).phase_degrees );
-   free( (**current).bit_reverse );
-   Matvec_deep_dispose( Matvec_prefix )( &(**current).coefficients );
-   Matvec_deep_dispose( Matvec_magnitude_prefix )( &(**current).window );
+   dispose_internals( *current );
 
    MULTITHREAD_MUTEX_DESTROY( (**current).mutex );
 
@@ -573,6 +773,41 @@ Fft_set_output( Prefix )( Fft_type( Prefix ) *current, Matvec_type( Matvec_prefi
    return;
 }
 
+/**
+   Fft_set_real_input
+*/
+
+void
+Fft_set_real_input( Prefix )( Fft_type( Prefix ) *current, Matvec_type( Matvec_magnitude_prefix ) *input )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "fft type ok", (*current)._type == FFT_TYPE );
+   PRECONDITION( "input not null", input != NULL );
+   PRECONDITION( "input right size", Matvec_vector_length( Matvec_magnitude_prefix )( input ) == (*current).length );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t i = 0;
+   int32_t n = (*current).length;
+   Type *pin = Matvec_as_array( Matvec_prefix )( (*current).input );
+   Magnitude_type *pa = Matvec_as_array( Matvec_magnitude_prefix )( input );
+
+   for ( i = 0; i < n; i++ )
+   {
+      pin[i] = ( Type ) pa[i];
+   }
+
+   (*current).is_psd_done = 0;
+   (*current).is_log_psd_done = 0;
+   (*current).is_phase_done = 0;
+   (*current).is_phase_degrees_done = 0;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
 /**
    Fft_fft
 */
@@ -586,77 +821,119 @@ Fft_fft( Prefix )( Fft_type( Prefix ) *current )
    INVARIANT( current );
 
    int32_t i = 0;
-   int32_t j = 0;
-   int32_t jrv = 0;
-   int32_t k = 0;
-   int32_t l = 0;
    int32_t n = 0;
-   int32_t log_length = 0;
-   int32_t n2 = 0;
-   int32_t ibrv = 0;
-   Type cis = DEFAULT_VALUE;
-   Type g = DEFAULT_VALUE;
-   Type g1 = DEFAULT_VALUE;
-   Type g2 = DEFAULT_VALUE;
    Magnitude_type d = 0.0;
-   Matvec_type( Matvec_prefix ) *v1 = NULL;
-   Matvec_type( Matvec_prefix ) *v2 = NULL;
-   Matvec_type( Matvec_magnitude_prefix ) *mv = NULL;
-   int32_t *ia = NULL;
+   Type *pin = NULL;
+   Type *pwork = NULL;
+   Magnitude_type *pwindow = NULL;
 
    n = (*current).length;
-   log_length = (*current).log_length;
 
-   v1 = (*current).input;
-   v2 = (*current).output;
-   mv = (*current).window;
+   pin = Matvec_as_array( Matvec_prefix )( (*current).input );
+   pwindow = Matvec_as_array( Matvec_magnitude_prefix )( (*current).window );
+   pwork = (*current).work;
 
-   // put windowed input into output
+   // window and scale the input, the transform is linear
+   d = 2.0 / n;
    for ( i = 0; i < n; i++ )
    {
-      SET_FROM( g, MULTIPLY_FUNCTION( Matvec_vector_item( Matvec_magnitude_prefix )( mv, i ), Matvec_vector_item( Matvec_prefix )( v1, i ) ) );
-      Matvec_vector_put( Matvec_prefix )( v2, g, i );
+      SET_FROM( pwork[i], MULTIPLY_FUNCTION( d * pwindow[i], pin[i] ) );
    }
 
-   ia = (*current).bit_reverse;
-   v1 = (*current).output;
-   v2 = (*current).coefficients;
+   transform
+   (
+      (*current).plan,
+      pwork,
+      Matvec_as_array( Matvec_prefix )( (*current).output ),
+      (*current).scratch
+   );
 
-   // perform the fft butterflies
-   for ( i = 0, j = 0, l = log_length - 1, n2 = n / 2; i < log_length; i++ )
-   {
-      for ( ; j < n; )
-      {
-         for ( k = 0; k < n2; k++ )
-         {
-            jrv = j >> l;
-            ibrv = ia[jrv];
-            cis = Matvec_vector_item( Matvec_prefix )( v2, ibrv );
-            SET_FROM( g, MULTIPLY_FUNCTION( Matvec_vector_item( Matvec_prefix )( v1, j + n2 ), cis ) );
-            SET_FROM( g1, NEGATE_FUNCTION( g ) );
-            SET_FROM( g1, ADD_FUNCTION( Matvec_vector_item( Matvec_prefix )( v1, j ), g1 ) );
-            SET_FROM( g2, ADD_FUNCTION( Matvec_vector_item( Matvec_prefix )( v1, j ), g ) );
-            Matvec_vector_put( Matvec_prefix )( v1, g1, j + n2 );
-            Matvec_vector_put( Matvec_prefix )( v1, g2, j );
-
-            j = j + 1;
-         }
-         j = j + n2;
-      }
+   (*current).is_psd_done = 0;
+   (*current).is_log_psd_done = 0;
+   (*current).is_phase_done = 0;
+   (*current).is_phase_degrees_done = 0;
 
-      // update offsets
-      j = 0;
-      l = l - 1;
-      n2 = n2 / 2;
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
 
-   }
+   return;
+}
+
+/**
+   Fft_real_fft
+*/
+
+void
+Fft_real_fft( Prefix )( Fft_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "fft type ok", (*current)._type == FFT_TYPE );
+   PRECONDITION( "length even", ( ( (*current).length % 2 ) == 0 ) && ( (*current).length > 2 ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
 
-   // scale and bit reverse output
+   int32_t i = 0;
+   int32_t n = 0;
+   int32_t h = 0;
+   Type e = DEFAULT_VALUE;
+   Type o = DEFAULT_VALUE;
+   Type z1 = DEFAULT_VALUE;
+   Type z2 = DEFAULT_VALUE;
+   Magnitude_type d = 0.0;
+   Type *pin = NULL;
+   Type *pout = NULL;
+   Type *pz = NULL;
+   Type *pw = NULL;
+   Type *ptwiddles = NULL;
+   Magnitude_type *pwindow = NULL;
+
+   n = (*current).length;
+   h = n / 2;
+
+   pin = Matvec_as_array( Matvec_prefix )( (*current).input );
+   pout = Matvec_as_array( Matvec_prefix )( (*current).output );
+   pwindow = Matvec_as_array( Matvec_magnitude_prefix )( (*current).window );
+   ptwiddles = (*(*current).plan).twiddles;
+   pz = (*current).work;
+   pw = (*current).work + h;
+
+   // pack the windowed, scaled even and odd samples into the real and
+   // imaginary parts
    d = 2.0 / n;
-   SET_FROM( g, d );
-   Matvec_scale( Matvec_prefix )( v1, g );
+   for ( i = 0; i < h; i++ )
+   {
+      pz[i]
+         =  ( Type )
+            (
+               d * pwindow[2 * i] * creal( pin[2 * i] )
+               + d * pwindow[2 * i + 1] * creal( pin[2 * i + 1] )*I
+            );
+   }
+
+   transform( (*(*current).plan).half, pz, pw, (*current).scratch );
+
+   // split into the transforms of the even and odd samples and combine them
+   for ( i = 0; i <= h; i++ )
+   {
+      SET_FROM( z1, pw[ i % h ] );
+      SET_FROM( z2, CONJUGATE_FUNCTION( pw[ ( h - i ) % h ] ) );
+      SET_FROM( e, 0.5 * ( z1 + z2 ) );
+      SET_FROM( o, -0.5*I * ( z1 - z2 ) );
+      if ( i < h )
+      {
+         SET_FROM( pout[i], ADD_FUNCTION( e, MULTIPLY_FUNCTION( ptwiddles[i], o ) ) );
+      }
+      else
+      {
+         SET_FROM( pout[i], ADD_FUNCTION( e, NEGATE_FUNCTION( o ) ) );
+      }
+   }
 
-   bit_reverse( current, (*current).output );
+   // the spectrum of real input is conjugate symmetric
+   for ( i = h + 1; i < n; i++ )
+   {
+      SET_FROM( pout[i], CONJUGATE_FUNCTION( pout[n - i] ) );
+   }
 
    (*current).is_psd_done = 0;
    (*current).is_log_psd_done = 0;
@@ -670,87 +947,161 @@ Fft_fft( Prefix )( Fft_type( Prefix ) *current )
 }
 
 /**
-   Fft_inverse_fft
+   Fft_fft_batch
 */
 
 void
-Fft_inverse_fft( Prefix )( Fft_type( Prefix ) *current )
+Fft_fft_batch( Prefix )
+(
+   Fft_type( Prefix ) *current,
+   Matvec_type( Matvec_prefix ) *input,
+   Matvec_type( Matvec_prefix ) *output
+)
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "fft type ok", (*current)._type == FFT_TYPE );
+   PRECONDITION( "input not null", input != NULL );
+   PRECONDITION( "output not null", output != NULL );
+   PRECONDITION( "input columns ok", Matvec_columns( Matvec_prefix )( input ) == (*current).length );
+   PRECONDITION( "output columns ok", Matvec_columns( Matvec_prefix )( output ) == (*current).length );
+   PRECONDITION( "output rows ok", Matvec_rows( Matvec_prefix )( output ) == Matvec_rows( Matvec_prefix )( input ) );
    LOCK( (*current).mutex );
    INVARIANT( current );
 
    int32_t i = 0;
    int32_t j = 0;
-   int32_t jrv = 0;
-   int32_t k = 0;
-   int32_t l = 0;
+   int32_t f = 0;
    int32_t n = 0;
-   int32_t log_length = 0;
-   int32_t n2 = 0;
-   int32_t ibrv = 0;
-   Type cis = DEFAULT_VALUE;
-   Type g = DEFAULT_VALUE;
-   Type g1 = DEFAULT_VALUE;
-   Type g2 = DEFAULT_VALUE;
+   int32_t b = 0;
+   int32_t count = 0;
    Magnitude_type d = 0.0;
-   Matvec_type( Matvec_prefix ) *v1 = NULL;
-   Matvec_type( Matvec_prefix ) *v2 = NULL;
-   int32_t *ia = NULL;
+   Type *pin = NULL;
+   Type *pout = NULL;
+   Type *pa = NULL;
+   Type *pb = NULL;
+   Magnitude_type *pwindow = NULL;
+   Fft_plan_type( Prefix ) *plan = NULL;
 
    n = (*current).length;
-   log_length = (*current).log_length;
+   count = Matvec_rows( Matvec_prefix )( input );
+   plan = (*current).plan;
 
-   v1 = (*current).input;
-   v2 = (*current).output;
+   pin = Matvec_as_array( Matvec_prefix )( input );
+   pout = Matvec_as_array( Matvec_prefix )( output );
+   pwindow = Matvec_as_array( Matvec_magnitude_prefix )( (*current).window );
 
-   // put output into input
-   for ( i = 0; i < n; i++ )
+   d = 2.0 / n;
+
+   // frames per group
+   b = FFT_BATCH_ITEM_COUNT / n;
+   if ( b > count )
    {
-      SET_FROM( g, Matvec_vector_item( Matvec_prefix )( v2, i ) );
-      Matvec_vector_put( Matvec_prefix )( v1, g, i );
+      b = count;
    }
 
-   ia = (*current).bit_reverse;
-   v1 = (*current).input;
-   v2 = (*current).coefficients;
+   if ( ( (*plan).is_bluestein == 1 ) || ( b < 2 ) )
+   {
+      b = 1;
+   }
+
+   // grow the interleaved work arrays if needed, input and output
+   if ( ( b > 1 ) && ( (*current).batch_work_count < 2 * b * n ) )
+   {
+      free( (*current).batch_work );
+      (*current).batch_work_count = 2 * b * n;
+      (*current).batch_work = ( Type * ) calloc( (*current).batch_work_count, sizeof( Type ) );
+      CHECK( "(*current).batch_work allocated_correctly", (*current).batch_work != NULL );
+   }
 
-   // perform the fft butterflies
-   for ( i = 0, j = 0, l = log_length - 1, n2 = n / 2; i < log_length; i++ )
+   for ( j = 0; j < count; j = j + b )
    {
-      for ( ; j < n; )
+      // the last group may be smaller
+      if ( j + b > count )
+      {
+         b = count - j;
+      }
+
+      if ( b == 1 )
       {
-         for ( k = 0; k < n2; k++ )
+         for ( i = 0; i < n; i++ )
          {
-            jrv = j >> l;
-            ibrv = ia[jrv];
-            cis = Matvec_vector_item( Matvec_prefix )( v2, ibrv );
-            SET_FROM( g, MULTIPLY_FUNCTION( Matvec_vector_item( Matvec_prefix )( v1, j + n2 ), CONJUGATE_FUNCTION( cis ) ) );
-            SET_FROM( g1, NEGATE_FUNCTION( g ) );
-            SET_FROM( g1, ADD_FUNCTION( Matvec_vector_item( Matvec_prefix )( v1, j ), g1 ) );
-            SET_FROM( g2, ADD_FUNCTION( Matvec_vector_item( Matvec_prefix )( v1, j ), g ) );
-            Matvec_vector_put( Matvec_prefix )( v1, g1, j + n2 );
-            Matvec_vector_put( Matvec_prefix )( v1, g2, j );
-
-            j = j + 1;
+            SET_FROM( (*current).work[i], MULTIPLY_FUNCTION( d * pwindow[i], pin[j * n + i] ) );
          }
-         j = j + n2;
+
+         transform( plan, (*current).work, pout + j * n, (*current).scratch );
       }
+      else
+      {
+         pa = (*current).batch_work;
+         pb = (*current).batch_work + b * n;
+
+         // window, scale and interleave the frames, item i of frame f at i b + f
+         for ( f = 0; f < b; f++ )
+         {
+            for ( i = 0; i < n; i++ )
+            {
+               SET_FROM( pa[i * b + f], MULTIPLY_FUNCTION( d * pwindow[i], pin[( j + f ) * n + i] ) );
+            }
+         }
 
-      // update offsets
-      j = 0;
-      l = l - 1;
-      n2 = n2 / 2;
+         mixed_radix( pb, pa, 1, (*plan).factors, (*plan).twiddles, b );
 
+         // de-interleave into the output rows
+         for ( f = 0; f < b; f++ )
+         {
+            for ( i = 0; i < n; i++ )
+            {
+               SET_FROM( pout[( j + f ) * n + i], pb[i * b + f] );
+            }
+         }
+      }
    }
 
-   // scale and bit reverse output
-   d = 0.5;
-   SET_FROM( g, d );
-   Matvec_scale( Matvec_prefix )( v1, g );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   Fft_inverse_fft
+*/
+
+void
+Fft_inverse_fft( Prefix )( Fft_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "fft type ok", (*current)._type == FFT_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t i = 0;
+   int32_t n = 0;
+   Magnitude_type d = 0.0;
+   Type *pin = NULL;
+   Type *pout = NULL;
+   Type *pwork = NULL;
+
+   n = (*current).length;
+
+   pin = Matvec_as_array( Matvec_prefix )( (*current).input );
+   pout = Matvec_as_array( Matvec_prefix )( (*current).output );
+   pwork = (*current).work;
+
+   // the inverse transform is the conjugate of the transform of the conjugate
+   for ( i = 0; i < n; i++ )
+   {
+      SET_FROM( pwork[i], CONJUGATE_FUNCTION( pout[i] ) );
+   }
+
+   transform( (*current).plan, pwork, pin, (*current).scratch );
 
-   bit_reverse( current, (*current).input );
+   // conjugate and scale input
+   d = 0.5;
+   for ( i = 0; i < n; i++ )
+   {
+      SET_FROM( pin[i], MULTIPLY_FUNCTION( d, CONJUGATE_FUNCTION( pin[i] ) ) );
+   }
 
    (*current).is_psd_done = 0;
    (*current).is_log_psd_done = 0;
@@ -912,159 +1263,498 @@ void set_phase_degrees
 }
 
 /**
-   set_bit_reverse
+   set_twiddles
 
-   calculate and store the bit reverse coefficients
+   calculate and store the sin cos twiddle factors
 
-   @param current the fft_t instance
+   @param plan the fft_plan_t instance
 */
 
 static
-void set_bit_reverse
+void set_twiddles
 (
-   Fft_type( Prefix ) *current
+   Fft_plan_type( Prefix ) *plan
 )
 {
    int32_t i = 0;
-   int32_t j = 0;
-   int32_t ui = 0;
-   int32_t uj = 0;
    int32_t n = 0;
-   int32_t log_length = 0;
-   int32_t *bit_reverse = NULL;
+   Magnitude_type x = 0.0;
+   Magnitude_type y = 0.0;
+   Type *twiddles = NULL;
 
-   n = (*current).length;
-   log_length = (*current).log_length;
-   bit_reverse = (*current).bit_reverse;
+   n = (*plan).length;
+   twiddles = (*plan).twiddles;
+
+   y = 2.0 * M_PI / ( 1.0 * n );
 
    for ( i = 0; i < n; i++ )
    {
-      ui = 0;
-      uj = i;
-
-      for( j = 0; j < log_length; j++ )
-      {
-         ui = 2 * ui;
-         if ( uj % 2 == 1 )
-         {
-            ui = ui + 1;
-         }
-         uj = uj / 2;
-      }
-      bit_reverse[i] = ui;
-   }
+      x = y * i;
+      SET_FROM( twiddles[i], ( Type ) ( cos( x ) + sin( x )*I ) );
+   }
 
    return;
 }
 
 /**
-   set_coefficients
+   set_window
 
-   calculate and store the sin cos coefficients
+   calculate and store the time series window values
 
    @param current the fft_t instance
 */
 
 static
-void set_coefficients
+void set_window
 (
    Fft_type( Prefix ) *current
 )
 {
    int32_t i = 0;
    int32_t n = 0;
-   Type g = DEFAULT_VALUE;
    Magnitude_type x = 0.0;
    Magnitude_type y = 0.0;
-   Matvec_type( Matvec_prefix ) *coefficients = NULL;
+   Magnitude_type d = 0.0;
+   Matvec_type( Matvec_magnitude_prefix ) *window = NULL;
 
    n = (*current).length;
-   coefficients = (*current).coefficients;
+   window = (*current).window;
 
    y = 2.0 * M_PI / ( 1.0 * n );
 
    for ( i = 0; i < n; i++ )
    {
       x = y * i;
-      SET_FROM( g, ( Type ) ( cos( x ) + sin( x )*I ) );
-      Matvec_vector_put( Matvec_prefix )( coefficients, g, i );
+      d =  WINDOW_FUNCTION( i, n, x );
+      Matvec_vector_put( Matvec_magnitude_prefix )( window, d, i );
    }
 
    return;
 }
 
 /**
-   set_window
+   set_factors
 
-   calculate and store the time series window values
+   factor the length into radices 4, 2, 3 and 5
 
-   @param current the fft_t instance
+   @param plan the fft_plan_t instance
+   @return 1 if the length has no other prime factors, 0 otherwise
 */
 
 static
-void set_window
+int32_t set_factors
 (
-   Fft_type( Prefix ) *current
+   Fft_plan_type( Prefix ) *plan
+)
+{
+   int32_t result = 0;
+   int32_t i = 0;
+   int32_t n = 0;
+   int32_t p = 0;
+   int32_t *factors = NULL;
+
+   n = (*plan).length;
+   factors = (*plan).factors;
+
+   while ( n > 1 )
+   {
+      if ( n % 4 == 0 )
+      {
+         p = 4;
+      }
+      else if ( n % 2 == 0 )
+      {
+         p = 2;
+      }
+      else if ( n % 3 == 0 )
+      {
+         p = 3;
+      }
+      else if ( n % 5 == 0 )
+      {
+         p = 5;
+      }
+      else
+      {
+         break;
+      }
+
+      n = n / p;
+      factors[2 * i] = p;
+      factors[2 * i + 1] = n;
+      i = i + 1;
+   }
+
+   factors[2 * i] = 0;
+   factors[2 * i + 1] = 0;
+
+   if ( n == 1 )
+   {
+      result = 1;
+   }
+
+   return result;
+}
+
+/**
+   set_bluestein
+
+   set up the transform of a length with a prime factor greater than five
+   as a convolution with a chirp, done with an fft of a power of two
+   length
+
+   @param plan the fft_plan_t instance
+*/
+
+static
+void set_bluestein
+(
+   Fft_plan_type( Prefix ) *plan
 )
 {
    int32_t i = 0;
    int32_t n = 0;
+   int32_t m = 0;
+   int64_t k2 = 0;
    Magnitude_type x = 0.0;
-   Magnitude_type y = 0.0;
-   Magnitude_type d = 0.0;
-   Matvec_type( Matvec_magnitude_prefix ) *window = NULL;
+   Type *chirp = NULL;
+   Type *pb = NULL;
 
-   n = (*current).length;
-   window = (*current).window;
+   n = (*plan).length;
 
-   y = 2.0 * M_PI / ( 1.0 * n );
+   // convolution length, a power of two of at least 2 n - 1
+   m = 2;
+   while ( m < 2 * n - 1 )
+   {
+      m = 2 * m;
+   }
+
+   (*plan).is_bluestein = 1;
+   (*plan).convolution = plan_make( m, 0 );
+
+   (*plan).chirp = ( Type * ) calloc( n, sizeof( Type ) );
+   CHECK( "(*plan).chirp allocated_correctly", (*plan).chirp != NULL );
 
+   (*plan).chirp_spectrum = ( Type * ) calloc( m, sizeof( Type ) );
+   CHECK( "(*plan).chirp_spectrum allocated_correctly", (*plan).chirp_spectrum != NULL );
+
+   pb = ( Type * ) calloc( m, sizeof( Type ) );
+   CHECK( "pb allocated_correctly", pb != NULL );
+
+   chirp = (*plan).chirp;
+
+   // chirp[i] = exp( pi i^2 / n ), i^2 reduced modulo 2 n to keep precision
    for ( i = 0; i < n; i++ )
    {
-      x = y * i;
-      d =  WINDOW_FUNCTION( i, n, x );
-      Matvec_vector_put( Matvec_magnitude_prefix )( window, d, i );
+      k2 = ( ( int64_t ) i * i ) % ( 2 * ( int64_t ) n );
+      x = M_PI * k2 / ( 1.0 * n );
+      SET_FROM( chirp[i], ( Type ) ( cos( x ) + sin( x )*I ) );
+   }
+
+   // conjugate chirp, wrapped around so it can be convolved circularly
+   for ( i = 0; i < m; i++ )
+   {
+      SET_FROM( pb[i], DEFAULT_VALUE );
    }
 
+   SET_FROM( pb[0], CONJUGATE_FUNCTION( chirp[0] ) );
+   for ( i = 1; i < n; i++ )
+   {
+      SET_FROM( pb[i], CONJUGATE_FUNCTION( chirp[i] ) );
+      SET_FROM( pb[m - i], CONJUGATE_FUNCTION( chirp[i] ) );
+   }
+
+   transform( (*plan).convolution, pb, (*plan).chirp_spectrum, NULL );
+
+   free( pb );
+
    return;
 }
 
 /**
-   bit_reverse
+   plan_make
 
-   perform the bit reverse function
+   make a plan, with a half length plan for real input if is_half_needed
+   and the length is even and not two
 
-   @param current the fft_t instance
+   @param length the transform length
+   @param is_half_needed 1 to make the half length plan
+   @return the new fft_plan_t instance
 */
 
 static
-void bit_reverse
+Fft_plan_type( Prefix ) *
+plan_make
 (
-   Fft_type( Prefix ) *current,
-   Matvec_type( Matvec_prefix ) *v
+   int32_t length,
+   int32_t is_half_needed
 )
 {
-   int32_t i = 0;
-   int32_t n = 0;
-   int32_t ibrv = 0;
-   Type g1 = DEFAULT_VALUE;
-   Type g2 = DEFAULT_VALUE;
-   int32_t *brv = NULL;
+   // allocate result struct
+   Fft_plan_type( Prefix ) * result
+      = ( Fft_plan_type( Prefix ) * ) calloc( 1, sizeof( Fft_plan_type( Prefix ) ) );
+   CHECK( "result allocated correctly", result != NULL );
 
-   n = (*current).length;
-   brv = (*current).bit_reverse;
+   // set type code
+   (*result)._type = FFT_PLAN_TYPE;
+
+   // set length
+   (*result).length = length;
+
+   (*result).twiddles = ( Type * ) calloc( length, sizeof( Type ) );
+   CHECK( "(*result).twiddles allocated_correctly", (*result).twiddles != NULL );
+
+   set_twiddles( result );
+
+   // factor the length, fall back to Bluestein for large prime factors
+   (*result).is_bluestein = 0;
+   if ( set_factors( result ) == 0 )
+   {
+      set_bluestein( result );
+   }
+
+   if ( ( is_half_needed == 1 ) && ( ( length % 2 ) == 0 ) && ( length > 2 ) )
+   {
+      (*result).half = plan_make( length / 2, 0 );
+   }
+
+   return result;
+}
+
+/**
+   plan_dispose
+
+   dispose of a plan and its helper plans
+
+   @param plan the fft_plan_t instance
+*/
+
+static
+void
+plan_dispose
+(
+   Fft_plan_type( Prefix ) *plan
+)
+{
+   free( (*plan).twiddles );
+
+   if ( (*plan).is_bluestein == 1 )
+   {
+      plan_dispose( (*plan).convolution );
+      free( (*plan).chirp );
+      free( (*plan).chirp_spectrum );
+   }
+
+   if ( (*plan).half != NULL )
+   {
+      plan_dispose( (*plan).half );
+   }
+
+   free( plan );
+
+   return;
+}
+
+/**
+   scratch_count
+
+   @param plan the fft_plan_t instance
+   @return the number of scratch items a transform with the plan needs
+*/
 
-   for( i = 0; i < n; i++ )
+static
+int32_t
+scratch_count
+(
+   Fft_plan_type( Prefix ) *plan
+)
+{
+   int32_t result = 0;
+
+   if ( (*plan).is_bluestein == 1 )
    {
-      ibrv = brv[i];
+      result = 2 * (*(*plan).convolution).length;
+   }
 
-      if ( ibrv > i )
+   return result;
+}
+
+/**
+   butterfly_2
+
+   radix 2 butterflies of a pass, m of them, twiddle stride fstride, on
+   b interleaved frames
+
+   @param out the items, two groups of m
+   @param fstride the stride through the twiddle factors
+   @param twiddles the twiddle factors
+   @param m the length of each group
+   @param b the number of interleaved frames
+*/
+
+static inline
+void butterfly_2
+(
+   Type *out,
+   int32_t fstride,
+   Type *twiddles,
+   int32_t m,
+   int32_t b
+)
+{
+   int32_t k = 0;
+   int32_t f = 0;
+   Type w = DEFAULT_VALUE;
+   Type t = DEFAULT_VALUE;
+   Type *p0 = NULL;
+   Type *p1 = NULL;
+
+   for ( k = 0; k < m; k++ )
+   {
+      SET_FROM( w, twiddles[k * fstride] );
+      p0 = out + k * b;
+      p1 = out + ( k + m ) * b;
+
+      for ( f = 0; f < b; f++ )
+      {
+         SET_FROM( t, MULTIPLY_FUNCTION( p1[f], w ) );
+         SET_FROM( p1[f], ADD_FUNCTION( p0[f], NEGATE_FUNCTION( t ) ) );
+         SET_FROM( p0[f], ADD_FUNCTION( p0[f], t ) );
+      }
+   }
+
+   return;
+}
+
+/**
+   butterfly_4
+
+   radix 4 butterflies of a pass, m of them, twiddle stride fstride, on
+   b interleaved frames
+
+   @param out the items, four groups of m
+   @param fstride the stride through the twiddle factors
+   @param twiddles the twiddle factors
+   @param m the length of each group
+   @param b the number of interleaved frames
+*/
+
+static inline
+void butterfly_4
+(
+   Type *out,
+   int32_t fstride,
+   Type *twiddles,
+   int32_t m,
+   int32_t b
+)
+{
+   int32_t k = 0;
+   int32_t f = 0;
+   Type w1 = DEFAULT_VALUE;
+   Type w2 = DEFAULT_VALUE;
+   Type w3 = DEFAULT_VALUE;
+   Type s0 = DEFAULT_VALUE;
+   Type s1 = DEFAULT_VALUE;
+   Type s2 = DEFAULT_VALUE;
+   Type s3 = DEFAULT_VALUE;
+   Type s4 = DEFAULT_VALUE;
+   Type s5 = DEFAULT_VALUE;
+   Type *p0 = NULL;
+   Type *p1 = NULL;
+   Type *p2 = NULL;
+   Type *p3 = NULL;
+
+   for ( k = 0; k < m; k++ )
+   {
+      SET_FROM( w1, twiddles[k * fstride] );
+      SET_FROM( w2, twiddles[2 * k * fstride] );
+      SET_FROM( w3, twiddles[3 * k * fstride] );
+      p0 = out + k * b;
+      p1 = out + ( k + m ) * b;
+      p2 = out + ( k + 2 * m ) * b;
+      p3 = out + ( k + 3 * m ) * b;
+
+      for ( f = 0; f < b; f++ )
+      {
+         SET_FROM( s0, MULTIPLY_FUNCTION( p1[f], w1 ) );
+         SET_FROM( s1, MULTIPLY_FUNCTION( p2[f], w2 ) );
+         SET_FROM( s2, MULTIPLY_FUNCTION( p3[f], w3 ) );
+
+         SET_FROM( s5, ADD_FUNCTION( p0[f], NEGATE_FUNCTION( s1 ) ) );
+         SET_FROM( s1, ADD_FUNCTION( p0[f], s1 ) );
+         SET_FROM( s3, ADD_FUNCTION( s0, s2 ) );
+         SET_FROM( s4, MULTIPLY_FUNCTION( I, ADD_FUNCTION( s0, NEGATE_FUNCTION( s2 ) ) ) );
+
+         SET_FROM( p0[f], ADD_FUNCTION( s1, s3 ) );
+         SET_FROM( p1[f], ADD_FUNCTION( s5, s4 ) );
+         SET_FROM( p2[f], ADD_FUNCTION( s1, NEGATE_FUNCTION( s3 ) ) );
+         SET_FROM( p3[f], ADD_FUNCTION( s5, NEGATE_FUNCTION( s4 ) ) );
+      }
+   }
+
+   return;
+}
+
+/**
+   butterfly_3
+
+   radix 3 butterflies of a pass, m of them, twiddle stride fstride, on
+   b interleaved frames
+
+   @param out the items, three groups of m
+   @param fstride the stride through the twiddle factors
+   @param twiddles the twiddle factors
+   @param m the length of each group
+   @param b the number of interleaved frames
+*/
+
+static inline
+void butterfly_3
+(
+   Type *out,
+   int32_t fstride,
+   Type *twiddles,
+   int32_t m,
+   int32_t b
+)
+{
+   int32_t k = 0;
+   int32_t f = 0;
+   Type w1 = DEFAULT_VALUE;
+   Type w2 = DEFAULT_VALUE;
+   Type s0 = DEFAULT_VALUE;
+   Type s1 = DEFAULT_VALUE;
+   Type s2 = DEFAULT_VALUE;
+   Type s3 = DEFAULT_VALUE;
+   Type s4 = DEFAULT_VALUE;
+   Type *p0 = NULL;
+   Type *p1 = NULL;
+   Type *p2 = NULL;
+
+   // sin( 2 pi / 3 ) i
+   Type w = ( Type ) ( sqrt( 3.0 ) / 2.0 * I );
+
+   for ( k = 0; k < m; k++ )
+   {
+      SET_FROM( w1, twiddles[k * fstride] );
+      SET_FROM( w2, twiddles[2 * k * fstride] );
+      p0 = out + k * b;
+      p1 = out + ( k + m ) * b;
+      p2 = out + ( k + 2 * m ) * b;
+
+      for ( f = 0; f < b; f++ )
       {
-         g1 = Matvec_vector_item( Matvec_prefix ) ( v, i );
-         g2 = Matvec_vector_item( Matvec_prefix ) ( v, ibrv );
+         SET_FROM( s1, MULTIPLY_FUNCTION( p1[f], w1 ) );
+         SET_FROM( s2, MULTIPLY_FUNCTION( p2[f], w2 ) );
+
+         SET_FROM( s3, ADD_FUNCTION( s1, s2 ) );
+         SET_FROM( s4, MULTIPLY_FUNCTION( w, ADD_FUNCTION( s1, NEGATE_FUNCTION( s2 ) ) ) );
+         SET_FROM( s0, ADD_FUNCTION( p0[f], MULTIPLY_FUNCTION( -0.5, s3 ) ) );
 
-         Matvec_vector_put( Matvec_prefix )( v, g2, i );
-         Matvec_vector_put( Matvec_prefix )( v, g1, ibrv );
+         SET_FROM( p0[f], ADD_FUNCTION( p0[f], s3 ) );
+         SET_FROM( p1[f], ADD_FUNCTION( s0, s4 ) );
+         SET_FROM( p2[f], ADD_FUNCTION( s0, NEGATE_FUNCTION( s4 ) ) );
       }
    }
 
@@ -1072,62 +1762,278 @@ void bit_reverse
 }
 
 /**
-   is_power_of_two
+   butterfly_5
 
-   returns the power of two of the input
+   radix 5 butterflies of a pass, m of them, twiddle stride fstride, on
+   b interleaved frames
 
-   @param length the length of the data
-   @return 1 if length is a power of two, 0 otherwise
+   @param out the items, five groups of m
+   @param fstride the stride through the twiddle factors
+   @param twiddles the twiddle factors
+   @param m the length of each group
+   @param b the number of interleaved frames
+*/
+
+static inline
+void butterfly_5
+(
+   Type *out,
+   int32_t fstride,
+   Type *twiddles,
+   int32_t m,
+   int32_t b
+)
+{
+   int32_t k = 0;
+   int32_t f = 0;
+   Type w1 = DEFAULT_VALUE;
+   Type w2 = DEFAULT_VALUE;
+   Type w3 = DEFAULT_VALUE;
+   Type w4 = DEFAULT_VALUE;
+   Type a1 = DEFAULT_VALUE;
+   Type a2 = DEFAULT_VALUE;
+   Type a3 = DEFAULT_VALUE;
+   Type a4 = DEFAULT_VALUE;
+   Type t1 = DEFAULT_VALUE;
+   Type t2 = DEFAULT_VALUE;
+   Type t3 = DEFAULT_VALUE;
+   Type t4 = DEFAULT_VALUE;
+   Type r1 = DEFAULT_VALUE;
+   Type r2 = DEFAULT_VALUE;
+   Type i1 = DEFAULT_VALUE;
+   Type i2 = DEFAULT_VALUE;
+   Type *p0 = NULL;
+   Type *p1 = NULL;
+   Type *p2 = NULL;
+   Type *p3 = NULL;
+   Type *p4 = NULL;
+
+   // cosines and sines of 2 pi / 5 and 4 pi / 5
+   Magnitude_type c1 = cos( 2.0 * M_PI / 5.0 );
+   Magnitude_type c2 = cos( 4.0 * M_PI / 5.0 );
+   Type s1 = ( Type ) ( sin( 2.0 * M_PI / 5.0 ) * I );
+   Type s2 = ( Type ) ( sin( 4.0 * M_PI / 5.0 ) * I );
+
+   for ( k = 0; k < m; k++ )
+   {
+      SET_FROM( w1, twiddles[k * fstride] );
+      SET_FROM( w2, twiddles[2 * k * fstride] );
+      SET_FROM( w3, twiddles[3 * k * fstride] );
+      SET_FROM( w4, twiddles[4 * k * fstride] );
+      p0 = out + k * b;
+      p1 = out + ( k + m ) * b;
+      p2 = out + ( k + 2 * m ) * b;
+      p3 = out + ( k + 3 * m ) * b;
+      p4 = out + ( k + 4 * m ) * b;
+
+      for ( f = 0; f < b; f++ )
+      {
+         SET_FROM( a1, MULTIPLY_FUNCTION( p1[f], w1 ) );
+         SET_FROM( a2, MULTIPLY_FUNCTION( p2[f], w2 ) );
+         SET_FROM( a3, MULTIPLY_FUNCTION( p3[f], w3 ) );
+         SET_FROM( a4, MULTIPLY_FUNCTION( p4[f], w4 ) );
+
+         SET_FROM( t1, ADD_FUNCTION( a1, a4 ) );
+         SET_FROM( t2, ADD_FUNCTION( a2, a3 ) );
+         SET_FROM( t3, ADD_FUNCTION( a1, NEGATE_FUNCTION( a4 ) ) );
+         SET_FROM( t4, ADD_FUNCTION( a2, NEGATE_FUNCTION( a3 ) ) );
+
+         SET_FROM( r1, ADD_FUNCTION( p0[f], ADD_FUNCTION( MULTIPLY_FUNCTION( c1, t1 ), MULTIPLY_FUNCTION( c2, t2 ) ) ) );
+         SET_FROM( r2, ADD_FUNCTION( p0[f], ADD_FUNCTION( MULTIPLY_FUNCTION( c2, t1 ), MULTIPLY_FUNCTION( c1, t2 ) ) ) );
+         SET_FROM( i1, ADD_FUNCTION( MULTIPLY_FUNCTION( s1, t3 ), MULTIPLY_FUNCTION( s2, t4 ) ) );
+         SET_FROM( i2, ADD_FUNCTION( MULTIPLY_FUNCTION( s2, t3 ), NEGATE_FUNCTION( MULTIPLY_FUNCTION( s1, t4 ) ) ) );
+
+         SET_FROM( p0[f], ADD_FUNCTION( p0[f], ADD_FUNCTION( t1, t2 ) ) );
+         SET_FROM( p1[f], ADD_FUNCTION( r1, i1 ) );
+         SET_FROM( p2[f], ADD_FUNCTION( r2, i2 ) );
+         SET_FROM( p3[f], ADD_FUNCTION( r2, NEGATE_FUNCTION( i2 ) ) );
+         SET_FROM( p4[f], ADD_FUNCTION( r1, NEGATE_FUNCTION( i1 ) ) );
+      }
+   }
+
+   return;
+}
+
+/**
+   mixed_radix
+
+   transform of in, read with stride fstride, into out, one pass per
+   factor, recursing on the remaining factors first. Item i of frame f
+   is at i b + f in both in and out, so the b frames are transformed
+   together with the same twiddle factor in the innermost loop.
+
+   @param out the output items
+   @param in the input items
+   @param fstride the stride through the input and the twiddle factors
+   @param factors the radix and remaining length of each pass
+   @param twiddles the twiddle factors
+   @param b the number of interleaved frames
 */
 
 static
-int32_t is_power_of_two
+void mixed_radix
 (
-   int32_t length
+   Type *out,
+   Type *in,
+   int32_t fstride,
+   int32_t *factors,
+   Type *twiddles,
+   int32_t b
 )
 {
-   int32_t result = 0;
    int32_t i = 0;
-   int32_t m = 0;
+   int32_t f = 0;
+   int32_t p = factors[0];
+   int32_t m = factors[1];
 
-   m = 1;
-   for ( i = 1; i < 65537; i++ )
+   if ( m == 1 )
    {
-      m = 2 * m;
+      for ( i = 0; i < p; i++ )
+      {
+         for ( f = 0; f < b; f++ )
+         {
+            SET_FROM( out[i * b + f], in[i * fstride * b + f] );
+         }
+      }
+   }
+   else
+   {
+      for ( i = 0; i < p; i++ )
+      {
+         mixed_radix( out + i * m * b, in + i * fstride * b, fstride * p, factors + 2, twiddles, b );
+      }
+   }
+
+   // a constant width of one lets the compiler drop the frame loop
+   switch ( p )
+   {
+      case 2:
+      {
+         if ( b == 1 )
+         {
+            butterfly_2( out, fstride, twiddles, m, 1 );
+         }
+         else
+         {
+            butterfly_2( out, fstride, twiddles, m, b );
+         }
+         break;
+      }
 
-      if ( m == length )
+      case 4:
       {
-         result = 1;
+         if ( b == 1 )
+         {
+            butterfly_4( out, fstride, twiddles, m, 1 );
+         }
+         else
+         {
+            butterfly_4( out, fstride, twiddles, m, b );
+         }
+         break;
+      }
+
+      case 3:
+      {
+         if ( b == 1 )
+         {
+            butterfly_3( out, fstride, twiddles, m, 1 );
+         }
+         else
+         {
+            butterfly_3( out, fstride, twiddles, m, b );
+         }
+         break;
+      }
+
+      default:
+      {
+         if ( b == 1 )
+         {
+            butterfly_5( out, fstride, twiddles, m, 1 );
+         }
+         else
+         {
+            butterfly_5( out, fstride, twiddles, m, b );
+         }
          break;
       }
    }
 
-   return result;
+   return;
 }
 
 /**
-   log_2i
+   transform
 
-   returns the log base two of the input to the nearest integer
+   unscaled transform of in into out, out[k] = sum of
+   in[j] exp( 2 pi i j k / length ), in and out distinct
 
-   @param length the input value
-   @return the log base two of length
+   @param plan the fft_plan_t instance
+   @param in the input items
+   @param out the output items
+   @param scratch scratch_count( plan ) items
 */
 
 static
-int32_t log_2i
+void transform
 (
-   int32_t length
+   Fft_plan_type( Prefix ) *plan,
+   Type *in,
+   Type *out,
+   Type *scratch
 )
 {
-   int32_t result = 0;
+   int32_t i = 0;
+   int32_t n = 0;
+   int32_t m = 0;
    Magnitude_type d = 0.0;
+   Type *chirp = NULL;
+   Type *pa = NULL;
+   Type *pb = NULL;
 
-   d = log( 1.0 * length ) / log( 2.0 );
+   n = (*plan).length;
 
-   result = ( int32_t ) floor( ( d + 0.5 ) );
+   if ( (*plan).is_bluestein == 0 )
+   {
+      mixed_radix( out, in, 1, (*plan).factors, (*plan).twiddles, 1 );
+   }
+   else
+   {
+      m = (*(*plan).convolution).length;
+      chirp = (*plan).chirp;
+      pa = scratch;
+      pb = scratch + m;
 
-   return result;
+      // out[k] = chirp[k] ( ( in chirp ) convolved with conj( chirp ) )[k]
+      for ( i = 0; i < n; i++ )
+      {
+         SET_FROM( pa[i], MULTIPLY_FUNCTION( in[i], chirp[i] ) );
+      }
+
+      for ( i = n; i < m; i++ )
+      {
+         SET_FROM( pa[i], DEFAULT_VALUE );
+      }
+
+      transform( (*plan).convolution, pa, pb, NULL );
+
+      // multiply spectra, inverse transform by conjugating before and after
+      for ( i = 0; i < m; i++ )
+      {
+         SET_FROM( pa[i], CONJUGATE_FUNCTION( MULTIPLY_FUNCTION( pb[i], (*plan).chirp_spectrum[i] ) ) );
+      }
+
+      transform( (*plan).convolution, pa, pb, NULL );
+
+      d = 1.0 / m;
+      for ( i = 0; i < n; i++ )
+      {
+         SET_FROM( out[i], MULTIPLY_FUNCTION( d, MULTIPLY_FUNCTION( chirp[i], CONJUGATE_FUNCTION( pb[i] ) ) ) );
+      }
+   }
+
+   return;
 }
 
 /* End of file */
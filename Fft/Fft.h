@@ -66,18 +66,22 @@
 #define Fft_struct( arg ) PRIMITIVE_CAT( arg, _fft_struct )
 #define Fft_type( arg ) PRIMITIVE_CAT( arg, _fft_t )
 #define Fft_name( arg ) PRIMITIVE_CAT( arg, _fft )
+#define Fft_plan_struct( arg ) PRIMITIVE_CAT( arg, _fft_plan_struct )
+#define Fft_plan_type( arg ) PRIMITIVE_CAT( arg, _fft_plan_t )
 
 /**
    Structure declarations
 */
 
 struct Fft_struct( Prefix );
+struct Fft_plan_struct( Prefix );
 
 /**
    Structure typedefs
 */
 
 typedef struct Fft_struct( Prefix ) Fft_type( Prefix );
+typedef struct Fft_plan_struct( Prefix ) Fft_plan_type( Prefix );
 
 
 /*
@@ -89,12 +93,37 @@ typedef struct Fft_struct( Prefix ) Fft_type( Prefix );
 
    Return a new Fft_t instance.
 
-   @param length the length of the fft, must be power of two
+   @param length the length of the fft, at least two
    @return Fft_t instance
 */
 #define Fft_make( arg ) PRIMITIVE_CAT( arg, _fft_make )
 Fft_type( Prefix ) * Fft_make( Prefix )( int32_t length );
 
+/**
+   Fft_plan_make
+
+   Return a new Fft_plan_t instance, the twiddle factors and factors of a
+   length. A plan is not changed after it is made and may be shared by
+   many Fft_t instances and threads.
+
+   @param length the length of the fft, at least two
+   @return Fft_plan_t instance
+*/
+#define Fft_plan_make( arg ) PRIMITIVE_CAT( arg, _fft_plan_make )
+Fft_plan_type( Prefix ) * Fft_plan_make( Prefix )( int32_t length );
+
+/**
+   Fft_make_from_plan
+
+   Return a new Fft_t instance that uses plan. The plan is not disposed
+   with the Fft_t instance and must outlive it.
+
+   @param plan the Fft_plan_t instance
+   @return Fft_t instance
+*/
+#define Fft_make_from_plan( arg ) PRIMITIVE_CAT( arg, _fft_make_from_plan )
+Fft_type( Prefix ) * Fft_make_from_plan( Prefix )( Fft_plan_type( Prefix ) *plan );
+
 /*
    Disposal
 */
@@ -119,10 +148,31 @@ void Fft_dispose( Prefix )( Fft_type( Prefix ) **current );
 #define Fft_deep_dispose( arg ) PRIMITIVE_CAT( arg, _fft_deep_dispose )
 void Fft_deep_dispose( Prefix )( Fft_type( Prefix ) **current );
 
+/**
+   Fft_plan_dispose
+
+   Free a Fft_plan_t instance. No Fft_t instance may still use it.
+
+   @param  plan Fft_plan_t instance
+*/
+#define Fft_plan_dispose( arg ) PRIMITIVE_CAT( arg, _fft_plan_dispose )
+void Fft_plan_dispose( Prefix )( Fft_plan_type( Prefix ) **plan );
+
 /*
    Access
 */
 
+/**
+   Fft_plan_length
+
+   Return the length of the plan.
+
+   @param  plan Fft_plan_t instance
+   @return the length
+*/
+#define Fft_plan_length( arg ) PRIMITIVE_CAT( arg, _fft_plan_length )
+int32_t Fft_plan_length( Prefix )( Fft_plan_type( Prefix ) *plan );
+
 /**
    Fft_input
 
@@ -216,6 +266,17 @@ void Fft_set_input( Prefix )( Fft_type( Prefix ) *current, Matvec_type( Matvec_p
 #define Fft_set_output( arg ) PRIMITIVE_CAT( arg, _fft_set_output )
 void Fft_set_output( Prefix )( Fft_type( Prefix ) *current, Matvec_type( Matvec_prefix ) *output );
 
+/**
+   Fft_set_real_input
+
+   Sets the input to the fft solver from real values
+
+   @param  fft Fft_t instance
+   @param  input the real input to the fft
+*/
+#define Fft_set_real_input( arg ) PRIMITIVE_CAT( arg, _fft_set_real_input )
+void Fft_set_real_input( Prefix )( Fft_type( Prefix ) *current, Matvec_type( Matvec_magnitude_prefix ) *input );
+
 /*
    Transformation
 */
@@ -230,6 +291,40 @@ void Fft_set_output( Prefix )( Fft_type( Prefix ) *current, Matvec_type( Matvec_
 #define Fft_fft( arg ) PRIMITIVE_CAT( arg, _fft_fft )
 void Fft_fft( Prefix )( Fft_type( Prefix ) *current );
 
+/**
+   Fft_real_fft
+
+   Perform the fast fourier transform on the real part of the input, with
+   a complex transform of half the length. The output is the same as from
+   Fft_fft when the input is real. The length must be even and greater
+   than two.
+
+   @param  fft Fft_t instance
+*/
+#define Fft_real_fft( arg ) PRIMITIVE_CAT( arg, _fft_real_fft )
+void Fft_real_fft( Prefix )( Fft_type( Prefix ) *current );
+
+/**
+   Fft_fft_batch
+
+   Perform the fast fourier transform on each row of input, windowed and
+   scaled the same as Fft_fft, into the same row of output. The frames are
+   transformed together. Input and output have length columns and the
+   same number of rows, and may be the same matrix. The input, output and
+   derived vectors of the Fft_t instance are not changed.
+
+   @param  fft Fft_t instance
+   @param  input the frames, one per row
+   @param  output the transformed frames, one per row
+*/
+#define Fft_fft_batch( arg ) PRIMITIVE_CAT( arg, _fft_fft_batch )
+void Fft_fft_batch( Prefix )
+(
+   Fft_type( Prefix ) *current,
+   Matvec_type( Matvec_prefix ) *input,
+   Matvec_type( Matvec_prefix ) *output
+);
+
 /**
    Fft_inverse_fft
 
@@ -356,6 +356,123 @@ make_heap
    return;
 }
 
+/**
+   sift_down_array
+
+   sift_down on the contiguous items of a container
+
+   @param array the data to be sorted
+   @param func the comparison function
+   @param start the index to start
+   @param end the index to stop
+*/
+
+static
+void
+sift_down_array
+(
+   Type *array,
+   int32_t (*func)( Type a, Type b ),
+   int32_t start,
+   int32_t end
+)
+{
+   Type temp;
+
+   int32_t root_index = 0;
+   int32_t swap_index = 0;
+   int32_t child_index = 0;
+
+   root_index = start;
+
+   // continue while heap at root_index has a child
+   while( left_child_index( root_index ) <= end )
+   {
+      child_index = left_child_index( root_index );
+      swap_index = root_index;
+
+      // update the swap_index if left child is out of order
+      if ( func( array[swap_index], array[child_index] ) < 0 )
+      {
+         swap_index = child_index;
+      }
+
+      // update swap index if right child exists and is out of order
+      if ( ( child_index + 1 <= end ) && ( func( array[swap_index], array[child_index + 1] ) < 0 ) )
+      {
+         swap_index = child_index + 1;
+      }
+
+      // if both left and right children are in order
+      if ( swap_index == root_index )
+      {
+         // we're done
+         break;
+      }
+      else
+      {
+         // else, swap items at root_index and swap_index
+         temp = array[root_index];
+         array[root_index] = array[swap_index];
+         array[swap_index] = temp;
+         root_index = swap_index;
+      }
+
+   }
+
+   return;
+}
+
+/**
+   sort_array
+
+   heap sort the contiguous items of a container
+
+   @param array the data to sort
+   @param n the number of items
+   @param func the comparison function
+*/
+static
+void
+sort_array
+(
+   Type *array,
+   int32_t n,
+   int32_t (*func)( Type a, Type b )
+)
+{
+   Type temp;
+
+   int32_t start = 0;
+   int32_t end = 0;
+
+   // make the array into a heap
+   start = parent_index( n - 1 );
+   while( start >= 0 )
+   {
+      sift_down_array( array, func, start, n - 1 );
+      start = start - 1;
+   }
+
+   // construct the sorted array from the heap
+   end = n - 1;
+   while( end > 0 )
+   {
+      // put largest value at index 0
+      temp = array[0];
+      array[0] = array[end];
+      array[end] = temp;
+
+      // update end
+      end = end - 1;
+
+      // restore heap
+      sift_down_array( array, func, 0, end );
+   }
+
+   return;
+}
+
 /**
    sort
 
@@ -378,31 +495,42 @@ sort
 
    int32_t n = 0;
    int32_t end = 0;
-
-   // get direct pointer to item, put functions
-   item = P_Indexable_item( Prefix );
-   put = P_Indexable_put( Prefix );
+   Type *array = NULL;
 
    // get size of indexable
    n = P_Indexable_count( Prefix )( p_indexable );
 
-   // make the indexable into a heap
-   make_heap( p_indexable, func, item, put );
+   // sort in place if the items are held in one array
+   array = P_Indexable_span( Prefix )( p_indexable );
 
-   // construct the sorted indexable from the heap
-   end = n - 1;
-   while( end > 0 )
+   if ( array != NULL )
    {
-      // put largest value at index 0
-      temp = item( p_indexable, 0 );
-      put( p_indexable, item( p_indexable, end ), 0 );
-      put( p_indexable, temp, end );
+      sort_array( array, n, func );
+   }
+   else
+   {
+      // get direct pointer to item, put functions
+      item = P_Indexable_item( Prefix );
+      put = P_Indexable_put( Prefix );
 
-      // update end
-      end = end - 1;
+      // make the indexable into a heap
+      make_heap( p_indexable, func, item, put );
 
-      // restore heap
-      sift_down( p_indexable, func, 0, end, item, put );
+      // construct the sorted indexable from the heap
+      end = n - 1;
+      while( end > 0 )
+      {
+         // put largest value at index 0
+         temp = item( p_indexable, 0 );
+         put( p_indexable, item( p_indexable, end ), 0 );
+         put( p_indexable, temp, end );
+
+         // update end
+         end = end - 1;
+
+         // restore heap
+         sift_down( p_indexable, func, 0, end, item, put );
+      }
    }
 
    return;
@@ -430,19 +558,36 @@ is_sorted
    int32_t i = 0;
    int32_t n = 0;
    int32_t result  = 1;
+   Type *array = NULL;
 
    // get direct pointer to item function
    item = ( *p_indexable ).get_function( P_INDEXABLE_TYPE, P_INDEXABLE_ITEM );
 
    n = P_Indexable_count( Prefix )( p_indexable );
 
-   for ( i = 1; i < n; i++ )
+   array = P_Indexable_span( Prefix )( p_indexable );
+
+   if ( array != NULL )
    {
-      // compare sequential items - if out of order, stop and return 0
-      if ( func( item( p_indexable, i - 1 ), item( p_indexable, i ) ) > 0 )
+      for ( i = 1; i < n; i++ )
       {
-         result = 0;
-         break;
+         if ( func( array[i - 1], array[i] ) > 0 )
+         {
+            result = 0;
+            break;
+         }
+      }
+   }
+   else
+   {
+      for ( i = 1; i < n; i++ )
+      {
+         // compare sequential items - if out of order, stop and return 0
+         if ( func( item( p_indexable, i - 1 ), item( p_indexable, i ) ) > 0 )
+         {
+            result = 0;
+            break;
+         }
       }
    }
 
@@ -63,6 +63,8 @@ extern "C" {
 */
 
 #define DEFAULT_BUCKET_SIZE 13
+#define DEFAULT_MAX_LOAD_FACTOR 1.0
+#define MIGRATION_STEP 4
 
 /**
    Node structure declaration
@@ -102,6 +104,10 @@ struct HTable_struct( Prefix )
    int32_t count;
    node_t **bucket; ///< array of pointers to node_t
    int32_t bucket_count;
+   node_t **old_bucket; ///< bucket array being migrated from, NULL if no resize in progress
+   int32_t old_bucket_count;
+   int32_t migration_index; ///< index of next old bucket to migrate
+   float64_t max_load_factor;
    HTable_cursor_type( Prefix ) *first_cursor;
    HTable_cursor_type( Prefix ) *last_cursor;
 
@@ -161,18 +167,19 @@ node_dispose( node_t **node )
 
 
 /**
-   has
+   find_node
 
-   Return 1 if htable has an item for key, 0 if not
+   Return the node in htable for key, NULL if not present. Looks in the old
+   bucket array too while a resize is in progress.
 
    @param current HTable_t instance
    @param key the key to query for
-   @return 1 if true, 0 otherwise
+   @return the node or NULL
 */
 
 static
-int32_t
-has( HTable_type( Prefix ) *current, Key key )
+node_t *
+find_node( HTable_type( Prefix ) *current, Key key )
 {
    int32_t hash_code = KEY_HASH_FUNCTION( key );
    int32_t i = hash_code % (*current).bucket_count;
@@ -185,12 +192,228 @@ has( HTable_type( Prefix ) *current, Key key )
    {
       if ( KEY_DEEP_EQUAL_FUNCTION( (*node).key, key ) == 1 )
       {
-         return 1;
+         return node;
+      }
+      node = (*node).next;
+   }
+
+   // look through the not yet migrated old bucket, if any
+   if ( (*current).old_bucket != NULL )
+   {
+      i = hash_code % (*current).old_bucket_count;
+
+      if ( i >= (*current).migration_index )
+      {
+         node = (*current).old_bucket[i];
+
+         while ( node != NULL )
+         {
+            if ( KEY_DEEP_EQUAL_FUNCTION( (*node).key, key ) == 1 )
+            {
+               return node;
+            }
+            node = (*node).next;
+         }
+      }
+   }
+
+   return NULL;
+}
+
+/**
+   unlink_node_from_chain
+
+   Remove the node for key from the bucket chain starting at *head. Does not
+   delete node, does not change count, does not change sequence.
+
+   @param head pointer to the first node pointer of the bucket chain
+   @param key the key to remove
+   @return the unlinked node or NULL if not in the chain
+*/
+
+static
+node_t *
+unlink_node_from_chain( node_t **head, Key key )
+{
+   node_t *last_node = NULL;
+   node_t *node = *head;
+
+   while ( node != NULL )
+   {
+      if ( KEY_DEEP_EQUAL_FUNCTION( (*node).key, key ) == 1 )
+      {
+         if ( last_node == NULL )
+         {
+            *head = (*node).next;
+         }
+         else
+         {
+            ( *last_node ).next = (*node).next;
+         }
+         (*node).next = NULL;
+         return node;
       }
+
+      last_node = node;
       node = (*node).next;
    }
 
-   return 0;
+   return NULL;
+}
+
+/**
+   unlink_node
+
+   Remove the node for key from its bucket, in either the current or the old
+   bucket array. Does not delete node, does not change count, does not change
+   sequence.
+
+   @param current HTable_t instance
+   @param key the key to remove
+   @return the unlinked node or NULL if not present
+*/
+
+static
+node_t *
+unlink_node( HTable_type( Prefix ) *current, Key key )
+{
+   int32_t hash_code = KEY_HASH_FUNCTION( key );
+   int32_t i = hash_code % (*current).bucket_count;
+
+   node_t *result = unlink_node_from_chain( &( (*current).bucket[i] ), key );
+
+   if ( ( result == NULL ) && ( (*current).old_bucket != NULL ) )
+   {
+      i = hash_code % (*current).old_bucket_count;
+
+      if ( i >= (*current).migration_index )
+      {
+         result = unlink_node_from_chain( &( (*current).old_bucket[i] ), key );
+      }
+   }
+
+   return result;
+}
+
+/**
+   migrate_buckets
+
+   Move the nodes of up to n buckets from the old bucket array into the
+   current bucket array. Frees the old bucket array when the last of its
+   buckets has been moved.
+
+   @param current HTable_t instance
+   @param n the number of old buckets to migrate
+*/
+
+static
+void
+migrate_buckets( HTable_type( Prefix ) *current, int32_t n )
+{
+   int32_t k = 0;
+   int32_t i = 0;
+   int32_t hash_code = 0;
+   node_t *node = NULL;
+   node_t *next = NULL;
+
+   if ( (*current).old_bucket == NULL )
+   {
+      return;
+   }
+
+   for (  k = 0;
+          ( k < n ) && ( (*current).migration_index < (*current).old_bucket_count );
+          k++
+       )
+   {
+      node = (*current).old_bucket[ (*current).migration_index ];
+
+      while ( node != NULL )
+      {
+         next = (*node).next;
+         hash_code = KEY_HASH_FUNCTION( (*node).key );
+         i = hash_code % (*current).bucket_count;
+         (*node).next = (*current).bucket[i];
+         (*current).bucket[i] = node;
+         node = next;
+      }
+
+      (*current).old_bucket[ (*current).migration_index ] = NULL;
+      (*current).migration_index = (*current).migration_index + 1;
+   }
+
+   // if all old buckets moved, resize is complete
+   if ( (*current).migration_index >= (*current).old_bucket_count )
+   {
+      free( (*current).old_bucket );
+      (*current).old_bucket = NULL;
+      (*current).old_bucket_count = 0;
+      (*current).migration_index = 0;
+   }
+
+   return;
+}
+
+/**
+   grow_if_needed
+
+   Start an incremental resize of the bucket array if the load factor is
+   above the max load factor. The nodes are moved to the new bucket array
+   a few buckets at a time by subsequent calls to migrate_buckets.
+
+   @param current HTable_t instance
+*/
+
+static
+void
+grow_if_needed( HTable_type( Prefix ) *current )
+{
+   // wait for any resize in progress to finish
+   if ( (*current).old_bucket != NULL )
+   {
+      return;
+   }
+
+   if (
+         ( (*current).count > (*current).max_load_factor * (*current).bucket_count )
+         &&
+         ( (*current).bucket_count < ( INT32_MAX - 1 ) / 2 )
+      )
+   {
+      (*current).old_bucket = (*current).bucket;
+      (*current).old_bucket_count = (*current).bucket_count;
+      (*current).migration_index = 0;
+
+      (*current).bucket_count = 2 * (*current).bucket_count + 1;
+      (*current).bucket = ( node_t ** ) calloc( (*current).bucket_count, sizeof( node_t * ) );
+      CHECK( "(*current).bucket allocated correctly", (*current).bucket != NULL );
+   }
+
+   return;
+}
+
+/**
+   has
+
+   Return 1 if htable has an item for key, 0 if not
+
+   @param current HTable_t instance
+   @param key the key to query for
+   @return 1 if true, 0 otherwise
+*/
+
+static
+int32_t
+has( HTable_type( Prefix ) *current, Key key )
+{
+   int32_t result = 0;
+
+   if ( find_node( current, key ) != NULL )
+   {
+      result = 1;
+   }
+
+   return result;
 }
 
 /**
@@ -207,33 +430,23 @@ static
 Type
 item( HTable_type( Prefix ) *current, Key key )
 {
-   int32_t hash_code = KEY_HASH_FUNCTION( key );
-   int32_t i = hash_code % (*current).bucket_count;
-
-   // get first of bucket's nodes
-   node_t *node = (*current).bucket[i];
+   node_t *node = find_node( current, key );
 
    Type value = ( *(*current).first_in_sequence ).value;
 
-   // look through nodes in bucket for match to key
-   while ( node != NULL )
+   if ( node != NULL )
    {
-      if ( KEY_DEEP_EQUAL_FUNCTION( (*node).key, key ) == 1 )
-      {
-         value = (*node).value;
-         break;
-      }
-      node = (*node).next;
+      value = (*node).value;
    }
 
    return value;
 }
 
 /**
-   put
+   put_new_node
 
-   insert a value in the htable for the given key if key not present,
-   replace the value if key present. do not dispose the existing value
+   insert a new node for key and value in the htable. key must not already
+   be present.
 
    @param current the htable
    @param value the value to put in the htable
@@ -242,59 +455,68 @@ item( HTable_type( Prefix ) *current, Key key )
 
 static
 void
-put( HTable_type( Prefix ) *current, Type value, Key key )
+put_new_node( HTable_type( Prefix ) *current, Type value, Key key )
 {
    int32_t hash_code = KEY_HASH_FUNCTION( key );
    int32_t i = hash_code % (*current).bucket_count;
 
-   // get node for new value
-   node_t *new_node = NULL;
+   // get new node and put new value at head of bucket
+   node_t *new_node = node_make();
+   ( *new_node ).value = value;
+   ( *new_node ).key = key;
+   ( *new_node ).next = (*current).bucket[i];
+   ( *new_node ).next_in_sequence = NULL;
+   (*current).bucket[i] = new_node;
 
-   // get first of bucket's nodes
-   node_t *node = (*current).bucket[i];
-
-   // see if node with this key already exists
-   int32_t flag = 0;
-
-   // look through nodes in bucket for match to key
-   while ( ( node != NULL ) && ( flag == 0 ) )
+   // place new node in node sequence
+   if ( (*current).last_in_sequence == NULL )
    {
-      if ( KEY_DEEP_EQUAL_FUNCTION( (*node).key, key ) == 1 )
-      {
-         flag = 1;
-         new_node = node;
-      }
-      node = (*node).next;
+      (*current).first_in_sequence = new_node;
+      (*current).last_in_sequence = new_node;
+   }
+   else
+   {
+      ( *(*current).last_in_sequence ).next_in_sequence = new_node;
+      (*current).last_in_sequence = new_node;
    }
 
+   (*current).count = (*current).count + 1;
+
+   grow_if_needed( current );
+
+   return;
+}
+
+/**
+   put
+
+   insert a value in the htable for the given key if key not present,
+   replace the value if key present. do not dispose the existing value
+
+   @param current the htable
+   @param value the value to put in the htable
+   @param key the key for the value
+*/
+
+static
+void
+put( HTable_type( Prefix ) *current, Type value, Key key )
+{
+   // move a few buckets along if a resize is in progress
+   migrate_buckets( current, MIGRATION_STEP );
+
+   // see if node with this key already exists
+   node_t *node = find_node( current, key );
+
    // if node exists in htable, replace value with new value
-   if ( new_node != NULL )
+   if ( node != NULL )
    {
-      ( *new_node ).value = value;
-      ( *new_node ).key = key;
+      (*node).value = value;
+      (*node).key = key;
    }
    else
    {
-      // else get new node and put new value at head of bucket
-      new_node = node_make();
-      ( *new_node ).value = value;
-      ( *new_node ).key = key;
-      ( *new_node ).next = (*current).bucket[i];
-      (*current).bucket[i] = new_node;
-
-      // place new node in node sequence
-      if ( (*current).last_in_sequence == NULL )
-      {
-         (*current).first_in_sequence = new_node;
-         (*current).last_in_sequence = new_node;
-      }
-      else
-      {
-         ( *(*current).last_in_sequence ).next_in_sequence = new_node;
-         (*current).last_in_sequence = new_node;
-      }
-
-      (*current).count = (*current).count + 1;
+      put_new_node( current, value, key );
    }
 
    return;
@@ -703,11 +925,36 @@ valid_bucket_count( HTable_type( Prefix ) *current )
       }
    }
 
+   if ( (*current).old_bucket != NULL )
+   {
+      for ( i = 0; i < (*current).old_bucket_count; i ++ )
+      {
+         node = (*current).old_bucket[i];
+
+         while( node != NULL )
+         {
+            n = n + 1;
+            node = (*node).next;
+         }
+      }
+   }
+
    result = ( n == (*current).count );
 
    return result;
 }
 
+static
+int32_t
+positive_max_load_factor( HTable_type( Prefix ) *current )
+{
+   int32_t result = 1;
+
+   result = ( (*current).max_load_factor > 0.0 );
+
+   return result;
+}
+
 static
 int32_t
 first_cursor_not_null( HTable_type( Prefix ) *current )
@@ -772,6 +1019,7 @@ void invariant( HTable_type( Prefix ) *current )
    assert( ( ( void ) "last in sequence OK", last_in_sequence_ok( current ) ) );
    assert( ( ( void ) "valid sequence count", valid_sequence_count( current ) ) );
    assert( ( ( void ) "valid bucket count", valid_bucket_count( current ) ) );
+   assert( ( ( void ) "positive max load factor", positive_max_load_factor( current ) ) );
    assert( ( ( void ) "first cursor not null", first_cursor_not_null( current ) ) );
    assert( ( ( void ) "last cursor next null", last_cursor_next_null( current ) ) );
    assert( ( ( void ) "last cursor null if one cursor", last_cursor_null_if_one_cursor( current ) ) );
@@ -940,6 +1188,7 @@ HTable_make( Prefix )( void )
    CHECK( "(*result).bucket allocated correctly", (*result).bucket != NULL );
 
    (*result).bucket_count = DEFAULT_BUCKET_SIZE;
+   (*result).max_load_factor = DEFAULT_MAX_LOAD_FACTOR;
 
    // set built-in cursor
    // allocate cursor struct
@@ -996,6 +1245,7 @@ HTable_make_n( Prefix )( int32_t bucket_count )
    CHECK( "(*result).bucket allocated correctly", (*result).bucket != NULL );
 
    (*result).bucket_count = bucket_count;
+   (*result).max_load_factor = DEFAULT_MAX_LOAD_FACTOR;
 
    // set built-in cursor
    // allocate cursor struct
@@ -1151,6 +1401,7 @@ HTable_clone( Prefix )( HTable_type( Prefix ) *current )
    CHECK( "(*result).bucket allocated correctly", (*result).bucket != NULL );
 
    (*result).bucket_count = (*current).bucket_count;
+   (*result).max_load_factor = (*current).max_load_factor;
 
    // set built-in cursor
    // allocate cursor struct
@@ -1226,6 +1477,7 @@ HTable_deep_clone( Prefix )( HTable_type( Prefix ) *current )
    CHECK( "(*result).bucket allocated correctly", (*result).bucket != NULL );
 
    (*result).bucket_count = (*current).bucket_count;
+   (*result).max_load_factor = (*current).max_load_factor;
 
    // set built-in cursor
    // allocate cursor struct
@@ -1518,6 +1770,7 @@ HTable_dispose( Prefix )( HTable_type( Prefix ) **current )
 
    // delete bucket array
    free( (**current).bucket );
+   free( (**current).old_bucket );
 
    MULTITHREAD_MUTEX_DESTROY( (**current).mutex );
 
@@ -1567,6 +1820,7 @@ HTable_deep_dispose( Prefix )( HTable_type( Prefix ) **current )
 
    // delete bucket array
    free( (**current).bucket );
+   free( (**current).old_bucket );
 
    MULTITHREAD_MUTEX_DESTROY( (**current).mutex );
 
@@ -2260,59 +2514,21 @@ HTable_replace( Prefix )( HTable_type( Prefix ) *current, Type value, Key key )
    // PRECONDITION( "has item", has( current, key ) );
    POSTCONDITION_VARIABLE_DEFINE( int32_t count_pc = has( current, key ) == 1 ? (*current).count : (*current).count + 1; );
 
-   int32_t hash_code = KEY_HASH_FUNCTION( key );
-   int32_t i = hash_code % (*current).bucket_count;
-
-   // get node for new value
-   node_t *new_node = NULL;
-
-   // get first of bucket's nodes
-   node_t *node = (*current).bucket[i];
+   // move a few buckets along if a resize is in progress
+   migrate_buckets( current, MIGRATION_STEP );
 
    // see if node with this key already exists
-   int32_t flag = 0;
-
-   // look through nodes in bucket for match to key
-   while ( ( node != NULL ) && ( flag == 0 ) )
-   {
-      if ( KEY_DEEP_EQUAL_FUNCTION( (*node).key, key ) == 1 )
-      {
-         flag = 1;
-         new_node = node;
-      }
-      node = (*node).next;
-   }
+   node_t *node = find_node( current, key );
 
    // if node exists in htable, replace value with new value
-   if ( new_node != NULL )
+   if ( node != NULL )
    {
-      ( *new_node ).value = value;
-      ( *new_node ).key = key;
+      (*node).value = value;
+      (*node).key = key;
    }
    else
    {
-      // else get new node and put new value at head of bucket
-      new_node = node_make();
-      ( *new_node ).value = value;
-      ( *new_node ).key = key;
-      ( *new_node ).next = (*current).bucket[i];
-      ( *new_node ).next_in_sequence = NULL;
-
-      // put in sequence
-      if ( (*current).last_in_sequence == NULL )
-      {
-         (*current).first_in_sequence = new_node;
-         (*current).last_in_sequence = new_node;
-      }
-      else
-      {
-         ( *(*current).last_in_sequence ).next_in_sequence = new_node;
-         (*current).last_in_sequence = new_node;
-      }
-
-      // put in bucket
-      (*current).bucket[i] = new_node;
-      (*current).count = (*current).count + 1;
+      put_new_node( current, value, key );
    }
 
    POSTCONDITION( "count unchanged", (*current).count == count_pc );
@@ -2339,69 +2555,31 @@ HTable_replace_and_dispose( Prefix )( HTable_type( Prefix ) *current, Type value
    // PRECONDITION( "has item", has( current, key ) );
    POSTCONDITION_VARIABLE_DEFINE( int32_t count_pc = has( current, key ) == 1 ? (*current).count : (*current).count + 1; );
 
-   int32_t hash_code = KEY_HASH_FUNCTION( key );
-   int32_t i = hash_code % (*current).bucket_count;
-
-   // get node for new value
-   node_t *new_node = NULL;
-
-   // get first of bucket's nodes
-   node_t *node = (*current).bucket[i];
+   // move a few buckets along if a resize is in progress
+   migrate_buckets( current, MIGRATION_STEP );
 
    // see if node with this key already exists
-   int32_t flag = 0;
-
-   // look through nodes in bucket for match to key
-   while ( ( node != NULL ) && ( flag == 0 ) )
-   {
-      if ( KEY_DEEP_EQUAL_FUNCTION( (*node).key, key ) == 1 )
-      {
-         flag = 1;
-         new_node = node;
-      }
-      node = (*node).next;
-   }
+   node_t *node = find_node( current, key );
 
    // if node exists in htable, replace value with new value
    // delete previous key unless it is the same as the new key
    // delete previous value unless it is the same as the new value
-   if ( new_node != NULL )
+   if ( node != NULL )
    {
-      if ( ( *new_node ).key != key )
+      if ( (*node).key != key )
       {
-         KEY_DEEP_DISPOSE_FUNCTION( ( *new_node ).key );
+         KEY_DEEP_DISPOSE_FUNCTION( (*node).key );
       }
-      if ( ( *new_node ).value != value )
+      if ( (*node).value != value )
       {
-         VALUE_DEEP_DISPOSE_FUNCTION( ( *new_node ).value );
+         VALUE_DEEP_DISPOSE_FUNCTION( (*node).value );
       }
-      ( *new_node ).key = key;
-      ( *new_node ).value = value;
+      (*node).key = key;
+      (*node).value = value;
    }
    else
    {
-      // else get new node and put new value at head of bucket
-      new_node = node_make();
-      ( *new_node ).value = value;
-      ( *new_node ).key = key;
-      ( *new_node ).next = (*current).bucket[i];
-      ( *new_node ).next_in_sequence = NULL;
-
-      // put in sequence
-      if ( (*current).last_in_sequence == NULL )
-      {
-         (*current).first_in_sequence = new_node;
-         (*current).last_in_sequence = new_node;
-      }
-      else
-      {
-         ( *(*current).last_in_sequence ).next_in_sequence = new_node;
-         (*current).last_in_sequence = new_node;
-      }
-
-      // put in bucket
-      (*current).bucket[i] = new_node;
-      (*current).count = (*current).count + 1;
+      put_new_node( current, value, key );
    }
 
    POSTCONDITION( "count unchanged", (*current).count == count_pc );
@@ -2425,47 +2603,19 @@ HTable_remove( Prefix )( HTable_type( Prefix ) *current, Key key )
    PRECONDITION( "has key", has( current, key ) );
    POSTCONDITION_VARIABLE_DEFINE( int32_t count_pc = has( current, key ) ? (*current).count - 1 : (*current).count; );
 
-   int32_t hash_code = KEY_HASH_FUNCTION( key );
-   int32_t i = hash_code % (*current).bucket_count;
-
-   // get node for search
-   node_t *last_node = NULL;
+   // move a few buckets along if a resize is in progress
+   migrate_buckets( current, MIGRATION_STEP );
 
-   // get first of bucket's nodes
-   node_t *node = (*current).bucket[i];
+   // take node out of its bucket
+   node_t *node = unlink_node( current, key );
 
-   // see if first node in bucket matches
-   if ( KEY_DEEP_EQUAL_FUNCTION( (*node).key, key ) == 1 )
+   if ( node != NULL )
    {
-      // remove first node
-      (*current).bucket[i] = (*node).next;
       move_all_cursors_forth_after_node_removal( current, node );
       remove_node_from_sequence( current, node );
       node_dispose( &node );
       (*current).count = (*current).count - 1;
    }
-   else
-   {
-      last_node = node;
-      node = (*node).next;
-
-      // if not, look through rest of nodes in bucket for match to key
-      while ( node != NULL )
-      {
-         if ( KEY_DEEP_EQUAL_FUNCTION( (*node).key, key ) == 1 )
-         {
-            ( *last_node ).next = (*node).next;
-            move_all_cursors_forth_after_node_removal( current, node );
-            remove_node_from_sequence( current, node );
-            node_dispose( &node );
-            (*current).count = (*current).count - 1;
-            break;
-         }
-
-         last_node = node;
-         node = (*node).next;
-      }
-   }
 
    // if count now zero, set first and last in sequence to  NULL
    if ( (*current).count == 0 )
@@ -2495,20 +2645,14 @@ HTable_remove_and_dispose( Prefix )( HTable_type( Prefix ) *current, Key key )
    PRECONDITION( "has key", has( current, key ) );
    POSTCONDITION_VARIABLE_DEFINE( int32_t count_pc = has( current, key ) ? (*current).count - 1 : (*current).count; );
 
-   int32_t hash_code = KEY_HASH_FUNCTION( key );
-   int32_t i = hash_code % (*current).bucket_count;
+   // move a few buckets along if a resize is in progress
+   migrate_buckets( current, MIGRATION_STEP );
 
-   // get node for search
-   node_t *last_node = NULL;
+   // take node out of its bucket
+   node_t *node = unlink_node( current, key );
 
-   // get first of bucket's nodes
-   node_t *node = (*current).bucket[i];
-
-   // see if first node in bucket matches
-   if ( KEY_DEEP_EQUAL_FUNCTION( (*node).key, key ) == 1 )
+   if ( node != NULL )
    {
-      // remove first node
-      (*current).bucket[i] = (*node).next;
       KEY_DEEP_DISPOSE_FUNCTION( (*node).key );
       VALUE_DEEP_DISPOSE_FUNCTION( (*node).value );
       move_all_cursors_forth_after_node_removal( current, node );
@@ -2516,30 +2660,6 @@ HTable_remove_and_dispose( Prefix )( HTable_type( Prefix ) *current, Key key )
       node_dispose( &node );
       (*current).count = (*current).count - 1;
    }
-   else
-   {
-      last_node = node;
-      node = (*node).next;
-
-      // if not, look through rest of nodes in bucket for match to key
-      while ( node != NULL )
-      {
-         if ( KEY_DEEP_EQUAL_FUNCTION( (*node).key, key ) == 1 )
-         {
-            ( *last_node ).next = (*node).next;
-            KEY_DEEP_DISPOSE_FUNCTION( (*node).key );
-            VALUE_DEEP_DISPOSE_FUNCTION( (*node).value );
-            move_all_cursors_forth_after_node_removal( current, node );
-            remove_node_from_sequence( current, node );
-            node_dispose( &node );
-            (*current).count = (*current).count - 1;
-            break;
-         }
-
-         last_node = node;
-         node = (*node).next;
-      }
-   }
 
    // if count now zero, set first and last in sequence to  NULL
    if ( (*current).count == 0 )
@@ -2597,6 +2717,12 @@ HTable_wipe_out( Prefix )( HTable_type( Prefix ) *current )
    // clear out buckets
    memset( (*current).bucket, 0, (*current).bucket_count * sizeof( node_t * ) );
 
+   // abandon any resize in progress
+   free( (*current).old_bucket );
+   (*current).old_bucket = NULL;
+   (*current).old_bucket_count = 0;
+   (*current).migration_index = 0;
+
    // set count to zero
    (*current).count = 0;
    (*current).first_in_sequence = NULL;
@@ -2648,6 +2774,12 @@ HTable_wipe_out_and_dispose( Prefix )( HTable_type( Prefix ) *current )
    // clear out buckets
    memset( (*current).bucket, 0, (*current).bucket_count * sizeof( node_t * ) );
 
+   // abandon any resize in progress
+   free( (*current).old_bucket );
+   (*current).old_bucket = NULL;
+   (*current).old_bucket_count = 0;
+   (*current).migration_index = 0;
+
    // set count to zero
    (*current).count = 0;
    (*current).first_in_sequence = NULL;
@@ -2673,6 +2805,12 @@ HTable_set_bucket_count( Prefix )( HTable_type( Prefix ) *current, int32_t new_b
    LOCK( (*current).mutex );
    INVARIANT( current );
 
+   // abandon any resize in progress, all nodes are rehashed below
+   free( (*current).old_bucket );
+   (*current).old_bucket = NULL;
+   (*current).old_bucket_count = 0;
+   (*current).migration_index = 0;
+
    // change size of bucket array
    (*current).bucket
       = ( node_t ** ) realloc( (*current).bucket, new_bucket_count * sizeof( node_t * ) );
@@ -2708,6 +2846,51 @@ HTable_set_bucket_count( Prefix )( HTable_type( Prefix ) *current, int32_t new_b
    return;
 }
 
+/**
+   HTable_max_load_factor
+*/
+
+float64_t
+HTable_max_load_factor( Prefix )( HTable_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_TYPE ) && ( (*current)._key_type = Key_Code ) && ( (*current)._item_type = Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   float64_t result = (*current).max_load_factor;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   HTable_set_max_load_factor
+*/
+
+void
+HTable_set_max_load_factor( Prefix )( HTable_type( Prefix ) *current, float64_t max_load_factor )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_TYPE ) && ( (*current)._key_type = Key_Code ) && ( (*current)._item_type = Type_Code ) );
+   PRECONDITION( "max load factor ok", max_load_factor > 0.0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   (*current).max_load_factor = max_load_factor;
+
+   // start growing now if already over the new limit
+   grow_if_needed( current );
+
+   POSTCONDITION( "max load factor set", (*current).max_load_factor == max_load_factor );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
 
 #ifdef __cplusplus
 }
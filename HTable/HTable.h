@@ -647,13 +647,40 @@ void HTable_wipe_out_and_dispose( Prefix )( HTable_type( Prefix ) *current );
 /**
    HTable_set_bucket_count
 
-   Adjust the number of buckets in the htable.
+   Adjust the number of buckets in the htable. All items are rehashed
+   immediately.
 
    @param  current HTable_t instance
 */
 #define HTable_set_bucket_count( arg ) PRIMITIVE_CAT( arg, _htable_set_bucket_count )
 void HTable_set_bucket_count( Prefix )( HTable_type( Prefix ) *current, int32_t new_bucket_count );
 
+/**
+   HTable_max_load_factor
+
+   Returns the maximum ratio of items to buckets before the htable grows its
+   bucket array.
+
+   @param  current HTable_t instance
+   @return the max load factor
+*/
+#define HTable_max_load_factor( arg ) PRIMITIVE_CAT( arg, _htable_max_load_factor )
+float64_t HTable_max_load_factor( Prefix )( HTable_type( Prefix ) *current );
+
+/**
+   HTable_set_max_load_factor
+
+   Set the maximum ratio of items to buckets. When a put takes the htable
+   over this ratio, the bucket array is doubled in size and the items are
+   moved into the new bucket array a few buckets at a time during later puts
+   and removes.
+
+   @param  current HTable_t instance
+   @param  max_load_factor the new max load factor, must be positive
+*/
+#define HTable_set_max_load_factor( arg ) PRIMITIVE_CAT( arg, _htable_set_max_load_factor )
+void HTable_set_max_load_factor( Prefix )( HTable_type( Prefix ) *current, float64_t max_load_factor );
+
 
 #ifdef __cplusplus
 }
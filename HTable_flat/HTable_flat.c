@@ -0,0 +1,1599 @@
+/**
+ @file HTable_flat.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "Open Addressing Hash Tables"
+
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0):
+
+ 1. Permission is hereby granted to use, copy, modify and/or
+    distribute this package, provided that:
+       * copyright notices are retained unchanged,
+       * any distribution of this package, whether modified or not,
+         includes this license text.
+ 2. Permission is hereby also granted to distribute binary programs
+    which depend on this package. If the binary program depends on a
+    modified version of this package, you are encouraged to publicly
+    release the modified version of this package.
+
+ THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT WARRANTY. ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE AUTHORS BE LIABLE TO ANY PARTY FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES ARISING IN ANY WAY OUT OF THE USE OF THIS PACKAGE.
+
+ @section Description
+
+ Function definitions for the opaque HTable_flat_t type.
+
+ Keys and values are held in one array of slots. Collisions are resolved
+ by linear probing with Robin Hood insertion - an item being inserted
+ takes the slot of any item that is closer to its home slot - and removals
+ shift the following items back one slot, so no tombstones are needed.
+ Each slot keeps its probe distance and the mixed hash code of its key so
+ that searches can stop early and skip most key comparisons.
+
+*/
+
+#include "HTable_flat.h"
+
+#include "protocol.h"
+
+#ifdef PROTOCOLS_ENABLED
+#include "Protocol_Base.h"
+#include "Protocol_Base.ph"
+#include "P_Basic.ph"
+#include "P_Iterable_kv.ph"
+#endif // PROTOCOLS_ENABLED
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <string.h>
+#include <stdlib.h>
+#ifdef MULTITHREADED
+#include MULTITHREAD_INCLUDE
+#endif
+
+#include "dbc.h"
+
+/**
+   defines
+*/
+
+#define DEFAULT_CAPACITY 16
+#define MINIMUM_CAPACITY 8
+#define MINIMUM_SHIFT 3
+
+// max load factor is 7/8
+#define MAX_LOAD_NUMERATOR 7
+#define MAX_LOAD_DENOMINATOR 8
+
+#define FIBONACCI_MULTIPLIER 2654435769u
+
+/**
+   Slot structure definition. Holds a key and a value. distance is 0 for an
+   empty slot, otherwise one more than the distance from the key's home slot.
+*/
+
+struct slot
+{
+   Key key;
+   Type value;
+   uint32_t hash;
+   int32_t distance;
+};
+
+typedef struct slot slot_t;
+
+/**
+   Hash table structure definition.
+*/
+
+struct HTable_flat_struct( Prefix )
+{
+
+   PROTOCOLS_DEFINITION;
+
+   int32_t _type;
+   int32_t _key_type;
+   int32_t _item_type;
+
+   slot_t *slot; ///< array of slots
+   int32_t capacity; ///< number of slots, a power of two
+   int32_t shift; ///< 32 - log2( capacity )
+   int32_t count;
+   int32_t cursor; ///< slot index of internal cursor, capacity if off
+
+   MULTITHREAD_MUTEX_DEFINITION( mutex );
+};
+
+/**
+   mixed_hash
+
+   Spread the bits of a key's hash code. Keys whose hash codes differ only
+   in their high bits would otherwise all land in the same few slots.
+
+   @param key the key
+   @return the mixed hash code
+*/
+
+static
+uint32_t
+mixed_hash( Key key )
+{
+   uint32_t result = ( uint32_t ) KEY_HASH_FUNCTION( key );
+
+   result = result * FIBONACCI_MULTIPLIER;
+
+   return result;
+}
+
+/**
+   capacity_for_count
+
+   Return the smallest power of two slot count that holds count items
+   without going over the max load factor.
+
+   @param count the number of items
+   @param shift returns 32 - log2 of the capacity
+   @return the capacity
+*/
+
+static
+int32_t
+capacity_for_count( int32_t count, int32_t *shift )
+{
+   int32_t result = MINIMUM_CAPACITY;
+   int32_t s = 32 - MINIMUM_SHIFT;
+
+   while ( ( int64_t ) count * MAX_LOAD_DENOMINATOR > ( int64_t ) result * MAX_LOAD_NUMERATOR )
+   {
+      result = result * 2;
+      s = s - 1;
+   }
+
+   *shift = s;
+
+   return result;
+}
+
+/**
+   find_index
+
+   Return the slot index holding key, -1 if key is not present.
+
+   @param current HTable_flat_t instance
+   @param key the key to look for
+   @param hash the mixed hash code of the key
+   @return the slot index or -1
+*/
+
+static
+int32_t
+find_index( HTable_flat_type( Prefix ) *current, Key key, uint32_t hash )
+{
+   int32_t mask = (*current).capacity - 1;
+   int32_t i = ( int32_t ) ( hash >> (*current).shift );
+   int32_t distance = 1;
+   slot_t *slot = (*current).slot;
+
+   // an item further along would have displaced a slot closer to home
+   while ( slot[i].distance >= distance )
+   {
+      if (
+            ( slot[i].hash == hash )
+            &&
+            ( KEY_DEEP_EQUAL_FUNCTION( slot[i].key, key ) == 1 )
+         )
+      {
+         return i;
+      }
+
+      i = ( i + 1 ) & mask;
+      distance = distance + 1;
+   }
+
+   return -1;
+}
+
+/**
+   insert_new
+
+   Put key and value into the slot array. key must not be present and there
+   must be at least one empty slot.
+
+   @param slot the slot array
+   @param capacity the number of slots
+   @param shift 32 - log2( capacity )
+   @param key the key
+   @param value the value
+   @param hash the mixed hash code of key
+*/
+
+static
+void
+insert_new
+(
+   slot_t *slot,
+   int32_t capacity,
+   int32_t shift,
+   Key key,
+   Type value,
+   uint32_t hash
+)
+{
+   int32_t mask = capacity - 1;
+   int32_t i = ( int32_t ) ( hash >> shift );
+   slot_t entry;
+   slot_t temp;
+
+   entry.key = key;
+   entry.value = value;
+   entry.hash = hash;
+   entry.distance = 1;
+
+   while ( slot[i].distance != 0 )
+   {
+      // take the slot from an item that is closer to its home slot
+      if ( slot[i].distance < entry.distance )
+      {
+         temp = slot[i];
+         slot[i] = entry;
+         entry = temp;
+      }
+
+      i = ( i + 1 ) & mask;
+      entry.distance = entry.distance + 1;
+   }
+
+   slot[i] = entry;
+
+   return;
+}
+
+/**
+   resize
+
+   Move all items into a new slot array with new_capacity slots.
+
+   @param current HTable_flat_t instance
+   @param new_capacity the new number of slots, a power of two
+   @param new_shift 32 - log2( new_capacity )
+*/
+
+static
+void
+resize( HTable_flat_type( Prefix ) *current, int32_t new_capacity, int32_t new_shift )
+{
+   int32_t i = 0;
+   slot_t *old_slot = (*current).slot;
+
+   slot_t *slot = ( slot_t * ) calloc( new_capacity, sizeof( slot_t ) );
+   CHECK( "slot allocated correctly", slot != NULL );
+
+   for ( i = 0; i < (*current).capacity; i++ )
+   {
+      if ( old_slot[i].distance != 0 )
+      {
+         insert_new( slot, new_capacity, new_shift, old_slot[i].key, old_slot[i].value, old_slot[i].hash );
+      }
+   }
+
+   free( old_slot );
+
+   (*current).slot = slot;
+   (*current).capacity = new_capacity;
+   (*current).shift = new_shift;
+   (*current).cursor = new_capacity;
+
+   return;
+}
+
+/**
+   put
+
+   Insert a value in the htable for the given key if key not present,
+   replace the value if key present. Do not dispose the existing value.
+
+   @param current HTable_flat_t instance
+   @param value the value to put in the htable
+   @param key the key for the value
+*/
+
+static
+void
+put( HTable_flat_type( Prefix ) *current, Type value, Key key )
+{
+   uint32_t hash = mixed_hash( key );
+   int32_t i = find_index( current, key, hash );
+   int32_t new_capacity = 0;
+   int32_t new_shift = 0;
+
+   if ( i >= 0 )
+   {
+      (*current).slot[i].key = key;
+      (*current).slot[i].value = value;
+   }
+   else
+   {
+      // grow if the new item would take the htable over the max load factor
+      new_capacity = capacity_for_count( (*current).count + 1, &new_shift );
+      if ( new_capacity > (*current).capacity )
+      {
+         resize( current, new_capacity, new_shift );
+      }
+
+      insert_new( (*current).slot, (*current).capacity, (*current).shift, key, value, hash );
+      (*current).count = (*current).count + 1;
+      (*current).cursor = (*current).capacity;
+   }
+
+   return;
+}
+
+/**
+   remove_index
+
+   Empty the slot at index i and shift the items that follow it back one
+   slot until an empty slot or an item in its home slot is reached.
+
+   @param current HTable_flat_t instance
+   @param i the slot index to empty
+*/
+
+static
+void
+remove_index( HTable_flat_type( Prefix ) *current, int32_t i )
+{
+   int32_t mask = (*current).capacity - 1;
+   int32_t j = ( i + 1 ) & mask;
+   slot_t *slot = (*current).slot;
+
+   while ( slot[j].distance > 1 )
+   {
+      slot[i] = slot[j];
+      slot[i].distance = slot[i].distance - 1;
+      i = j;
+      j = ( j + 1 ) & mask;
+   }
+
+   memset( &slot[i], 0, sizeof( slot_t ) );
+
+   (*current).count = (*current).count - 1;
+   (*current).cursor = (*current).capacity;
+
+   return;
+}
+
+/**
+   next_occupied
+
+   Return index of the first occupied slot at or after i, capacity if none.
+
+   @param current HTable_flat_t instance
+   @param i the slot index to start from
+   @return the slot index
+*/
+
+static
+int32_t
+next_occupied( HTable_flat_type( Prefix ) *current, int32_t i )
+{
+   while ( ( i < (*current).capacity ) && ( (*current).slot[i].distance == 0 ) )
+   {
+      i = i + 1;
+   }
+
+   return i;
+}
+
+/**
+   dispose_all
+
+   Dispose of all keys and values in the slot array.
+
+   @param current HTable_flat_t instance
+*/
+
+static
+void
+dispose_all( HTable_flat_type( Prefix ) *current )
+{
+   int32_t i = 0;
+
+   for ( i = 0; i < (*current).capacity; i++ )
+   {
+      if ( (*current).slot[i].distance != 0 )
+      {
+         KEY_DEEP_DISPOSE_FUNCTION( (*current).slot[i].key );
+         VALUE_DEEP_DISPOSE_FUNCTION( (*current).slot[i].value );
+      }
+   }
+
+   return;
+}
+
+/**
+   copy_items
+
+   Put the items of other into current, deep cloning them if deep is 1.
+
+   @param current HTable_flat_t instance to put into
+   @param other HTable_flat_t instance to copy from
+   @param deep 1 to deep clone the keys and values, 0 otherwise
+*/
+
+static
+void
+copy_items( HTable_flat_type( Prefix ) *current, HTable_flat_type( Prefix ) *other, int32_t deep )
+{
+   int32_t i = 0;
+   int32_t new_capacity = 0;
+   int32_t new_shift = 0;
+   Key k;
+   Type v;
+
+   new_capacity = capacity_for_count( (*current).count + (*other).count, &new_shift );
+   if ( new_capacity > (*current).capacity )
+   {
+      resize( current, new_capacity, new_shift );
+   }
+
+   for ( i = 0; i < (*other).capacity; i++ )
+   {
+      if ( (*other).slot[i].distance != 0 )
+      {
+         k = (*other).slot[i].key;
+         v = (*other).slot[i].value;
+
+         if ( deep == 1 )
+         {
+            k = KEY_DEEP_CLONE_FUNCTION( k );
+            v = VALUE_DEEP_CLONE_FUNCTION( v );
+         }
+
+         put( current, v, k );
+      }
+   }
+
+   return;
+}
+
+/**
+   compare_items
+
+   Return 1 if current and other have the same keys with equal values.
+
+   @param current HTable_flat_t instance
+   @param other HTable_flat_t instance
+   @param deep 1 to compare values with VALUE_DEEP_EQUAL_FUNCTION, 0 to compare with ==
+   @return 1 if equal, 0 otherwise
+*/
+
+static
+int32_t
+compare_items( HTable_flat_type( Prefix ) *current, HTable_flat_type( Prefix ) *other, int32_t deep )
+{
+   int32_t result = 1;
+   int32_t i = 0;
+   int32_t j = 0;
+
+   if ( (*current).count != (*other).count )
+   {
+      result = 0;
+   }
+
+   for ( i = 0; ( i < (*other).capacity ) && ( result == 1 ); i++ )
+   {
+      if ( (*other).slot[i].distance != 0 )
+      {
+         j = find_index( current, (*other).slot[i].key, (*other).slot[i].hash );
+
+         if ( j < 0 )
+         {
+            result = 0;
+         }
+         else if ( deep == 1 )
+         {
+            result = VALUE_DEEP_EQUAL_FUNCTION( (*current).slot[j].value, (*other).slot[i].value );
+         }
+         else
+         {
+            result = ( (*current).slot[j].value == (*other).slot[i].value );
+         }
+      }
+   }
+
+   return result;
+}
+
+
+/**
+   Invariant
+*/
+
+#if INVARIANT_CONDITIONAL != 0
+
+static
+int32_t
+nonnegative_count( HTable_flat_type( Prefix ) *current )
+{
+   int32_t result = 1;
+
+   result = ( (*current).count >= 0 );
+
+   return result;
+}
+
+static
+int32_t
+capacity_power_of_two( HTable_flat_type( Prefix ) *current )
+{
+   int32_t result = 1;
+
+   result
+      =  ( (*current).capacity >= MINIMUM_CAPACITY )
+         &&
+         ( ( (*current).capacity & ( (*current).capacity - 1 ) ) == 0 )
+         &&
+         ( ( ( uint64_t ) 1 << ( 32 - (*current).shift ) ) == ( uint64_t ) (*current).capacity );
+
+   return result;
+}
+
+static
+int32_t
+load_factor_ok( HTable_flat_type( Prefix ) *current )
+{
+   int32_t result = 1;
+
+   result = ( ( int64_t ) (*current).count * MAX_LOAD_DENOMINATOR <= ( int64_t ) (*current).capacity * MAX_LOAD_NUMERATOR );
+
+   return result;
+}
+
+static
+int32_t
+valid_slot_count( HTable_flat_type( Prefix ) *current )
+{
+   int32_t result = 1;
+   int32_t i = 0;
+   int32_t n = 0;
+
+   for ( i = 0; i < (*current).capacity; i++ )
+   {
+      if ( (*current).slot[i].distance != 0 )
+      {
+         n = n + 1;
+      }
+   }
+
+   result = ( n == (*current).count );
+
+   return result;
+}
+
+static
+int32_t
+valid_distances( HTable_flat_type( Prefix ) *current )
+{
+   int32_t result = 1;
+   int32_t i = 0;
+   int32_t home = 0;
+   int32_t mask = (*current).capacity - 1;
+   slot_t *slot = (*current).slot;
+
+   for ( i = 0; ( i < (*current).capacity ) && ( result == 1 ); i++ )
+   {
+      if ( slot[i].distance != 0 )
+      {
+         home = ( int32_t ) ( slot[i].hash >> (*current).shift );
+         result = ( ( ( i - home ) & mask ) == slot[i].distance - 1 );
+      }
+   }
+
+   return result;
+}
+
+static
+int32_t
+cursor_ok( HTable_flat_type( Prefix ) *current )
+{
+   int32_t result = 1;
+
+   result
+      =  ( (*current).cursor == (*current).capacity )
+         ||
+         (
+            ( (*current).cursor >= 0 )
+            &&
+            ( (*current).cursor < (*current).capacity )
+            &&
+            ( (*current).slot[ (*current).cursor ].distance != 0 )
+         );
+
+   return result;
+}
+
+static
+void invariant( HTable_flat_type( Prefix ) *current )
+{
+   assert( ( ( void ) "nonnegative count", nonnegative_count( current ) ) );
+   assert( ( ( void ) "capacity power of two", capacity_power_of_two( current ) ) );
+   assert( ( ( void ) "load factor ok", load_factor_ok( current ) ) );
+   assert( ( ( void ) "valid slot count", valid_slot_count( current ) ) );
+   assert( ( ( void ) "valid distances", valid_distances( current ) ) );
+   assert( ( ( void ) "cursor ok", cursor_ok( current ) ) );
+   return;
+}
+
+#endif
+
+/**
+   Protocol stuff
+*/
+
+#ifdef PROTOCOLS_ENABLED
+
+/**
+   basic protocol function array
+*/
+
+static
+void *
+p_basic_table[P_BASIC_FUNCTION_COUNT]
+=
+{
+   HTable_flat_dispose( Prefix ),
+   HTable_flat_deep_dispose( Prefix ),
+   HTable_flat_is_equal( Prefix ),
+   HTable_flat_is_deep_equal( Prefix ),
+   HTable_flat_copy( Prefix ),
+   HTable_flat_deep_copy( Prefix ),
+   HTable_flat_clone( Prefix ),
+   HTable_flat_deep_clone( Prefix )
+};
+
+/**
+   iterable_kv protocol function array
+*/
+
+static
+void *
+p_iterable_kv_table[P_ITERABLE_KV_FUNCTION_COUNT]
+=
+{
+   HTable_flat_count( Prefix ),
+   HTable_flat_key_at( Prefix ),
+   HTable_flat_item_at( Prefix ),
+   HTable_flat_off( Prefix ),
+   HTable_flat_is_empty( Prefix ),
+   HTable_flat_start( Prefix ),
+   HTable_flat_forth( Prefix )
+};
+
+/**
+   protocol get_function
+
+   returns function pointer for requested protocol function
+
+   @param protocol_id which protocol
+   @param function_id which function
+   @return function pointer if found, NULL otherwise
+*/
+
+static
+void *
+get_function
+(
+   int32_t protocol_id,
+   int32_t function_id
+)
+{
+   PRECONDITION( "protocol id is ok", protocol_base_is_valid_protocol( protocol_id ) == 1 );
+
+   void *result = NULL;
+
+   switch ( protocol_id )
+   {
+      case P_BASIC_TYPE:
+      {
+         if ( ( function_id >= 0 ) && ( function_id <= P_BASIC_FUNCTION_MAX ) )
+         {
+            result = p_basic_table[ function_id ];
+         }
+         break;
+      }
+
+      case P_ITERABLE_KV_TYPE:
+      {
+         if ( ( function_id >= 0 ) && ( function_id <= P_ITERABLE_KV_FUNCTION_MAX ) )
+         {
+            result = p_iterable_kv_table[ function_id ];
+         }
+         break;
+      }
+
+   }
+
+   return result;
+}
+
+/**
+   protocol supports_protocol
+
+   returns 1 if this class supports the specified protocol
+
+   @param protocol_id which protocol
+   @return 1 if protocol supported, 0 otherwise
+*/
+
+static
+int32_t
+supports_protocol
+(
+   int32_t protocol_id
+)
+{
+   PRECONDITION( "protocol id is ok", protocol_base_is_valid_protocol( protocol_id ) == 1 );
+
+   int32_t result = 0;
+
+   switch ( protocol_id )
+   {
+      case P_BASIC_TYPE:
+      {
+         result = 1;
+         break;
+      }
+
+      case P_ITERABLE_KV_TYPE:
+      {
+         result = 1;
+         break;
+      }
+
+   }
+
+   return result;
+}
+
+#endif // PROTOCOLS_ENABLED
+
+
+/**
+   make_with_capacity
+
+   Allocate and initialize a new empty htable.
+
+   @param capacity number of slots, a power of two
+   @param shift 32 - log2( capacity )
+   @return the new htable
+*/
+
+static
+HTable_flat_type( Prefix ) *
+make_with_capacity( int32_t capacity, int32_t shift )
+{
+   // allocate htable struct
+   HTable_flat_type( Prefix ) *result
+      = ( HTable_flat_type( Prefix ) * ) calloc( 1, sizeof( HTable_flat_type( Prefix ) ) );
+   CHECK( "result allocated correctly", result != NULL );
+
+   // initialize protocol functions if protocols enabled
+   PROTOCOLS_INIT( result );
+
+   // set type codes
+   (*result)._type = HTABLE_FLAT_TYPE;
+   (*result)._key_type = Key_Code;
+   (*result)._item_type = Type_Code;
+
+   (*result).count = 0;
+
+   // allocate slot array
+   (*result).slot = ( slot_t * ) calloc( capacity, sizeof( slot_t ) );
+   CHECK( "(*result).slot allocated correctly", (*result).slot != NULL );
+
+   (*result).capacity = capacity;
+   (*result).shift = shift;
+
+   // internal cursor is off
+   (*result).cursor = capacity;
+
+   MULTITHREAD_MUTEX_INIT( (*result).mutex );
+
+   return result;
+}
+
+/**
+   HTable_flat_make
+*/
+
+HTable_flat_type( Prefix ) *
+HTable_flat_make( Prefix )( void )
+{
+   int32_t shift = 0;
+   int32_t capacity = capacity_for_count( DEFAULT_CAPACITY * MAX_LOAD_NUMERATOR / MAX_LOAD_DENOMINATOR, &shift );
+
+   HTable_flat_type( Prefix ) *result = make_with_capacity( capacity, shift );
+
+   POSTCONDITION( "new htable is empty", (*result).count == 0 );
+   POSTCONDITION( "new htable cursor is off", (*result).cursor == (*result).capacity );
+
+   INVARIANT( result );
+
+   return result;
+}
+
+/**
+   HTable_flat_make_n
+*/
+
+HTable_flat_type( Prefix ) *
+HTable_flat_make_n( Prefix )( int32_t count )
+{
+   PRECONDITION( "count ok", count >= 0 );
+
+   int32_t shift = 0;
+   int32_t capacity = capacity_for_count( count, &shift );
+
+   HTable_flat_type( Prefix ) *result = make_with_capacity( capacity, shift );
+
+   POSTCONDITION( "new htable is empty", (*result).count == 0 );
+   POSTCONDITION( "new htable cursor is off", (*result).cursor == (*result).capacity );
+   POSTCONDITION( "capacity ok", ( int64_t ) (*result).capacity * MAX_LOAD_NUMERATOR >= ( int64_t ) count * MAX_LOAD_DENOMINATOR );
+
+   INVARIANT( result );
+
+   return result;
+}
+
+/**
+   HTable_flat_make_from_array
+*/
+
+HTable_flat_type( Prefix ) *
+HTable_flat_make_from_array( Prefix )( Key *key_array, Type *value_array, int32_t count )
+{
+   PRECONDITION( "key_array not null", key_array != NULL );
+   PRECONDITION( "value_array not null", value_array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+
+   int32_t i = 0;
+   int32_t shift = 0;
+   int32_t capacity = capacity_for_count( count, &shift );
+
+   HTable_flat_type( Prefix ) *result = make_with_capacity( capacity, shift );
+
+   // put key-values from arrays into result
+   for ( i = 0; i < count; i++ )
+   {
+      put( result, value_array[i], key_array[i] );
+   }
+
+   POSTCONDITION( "new htable cursor is off", (*result).cursor == (*result).capacity );
+
+   INVARIANT( result );
+
+   return result;
+}
+
+/**
+   HTable_flat_clone
+*/
+
+HTable_flat_type( Prefix ) *
+HTable_flat_clone( Prefix )( HTable_flat_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   HTable_flat_type( Prefix ) *result = make_with_capacity( (*current).capacity, (*current).shift );
+
+   copy_items( result, current, 0 );
+
+   POSTCONDITION( "new htable has count items", (*result).count == (*current).count );
+   POSTCONDITION( "new htable clone is equal to original", compare_items( result, current, 0 ) == 1 );
+
+   INVARIANT( result );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   HTable_flat_deep_clone
+*/
+
+HTable_flat_type( Prefix ) *
+HTable_flat_deep_clone( Prefix )( HTable_flat_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   HTable_flat_type( Prefix ) *result = make_with_capacity( (*current).capacity, (*current).shift );
+
+   copy_items( result, current, 1 );
+
+   POSTCONDITION( "new htable has count items", (*result).count == (*current).count );
+   POSTCONDITION( "new htable clone is equal to original", compare_items( result, current, 1 ) == 1 );
+
+   INVARIANT( result );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   HTable_flat_is_equal
+*/
+
+int32_t
+HTable_flat_is_equal( Prefix )( HTable_flat_type( Prefix ) *current, HTable_flat_type( Prefix ) *other )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   PRECONDITION( "other not null", other != NULL );
+   PRECONDITION( "other type ok", ( (*other)._type == HTABLE_FLAT_TYPE ) && ( (*other)._key_type == Key_Code ) && ( (*other)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 1;
+
+   if ( current != other )
+   {
+      LOCK( (*other).mutex );
+      result = compare_items( current, other, 0 );
+      UNLOCK( (*other).mutex );
+   }
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   HTable_flat_is_deep_equal
+*/
+
+int32_t
+HTable_flat_is_deep_equal( Prefix )( HTable_flat_type( Prefix ) *current, HTable_flat_type( Prefix ) *other )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   PRECONDITION( "other not null", other != NULL );
+   PRECONDITION( "other type ok", ( (*other)._type == HTABLE_FLAT_TYPE ) && ( (*other)._key_type == Key_Code ) && ( (*other)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 1;
+
+   if ( current != other )
+   {
+      LOCK( (*other).mutex );
+      result = compare_items( current, other, 1 );
+      UNLOCK( (*other).mutex );
+   }
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   HTable_flat_copy
+*/
+
+void
+HTable_flat_copy( Prefix )( HTable_flat_type( Prefix ) *current, HTable_flat_type( Prefix ) *other )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   PRECONDITION( "other not null", other != NULL );
+   PRECONDITION( "other type ok", ( (*other)._type == HTABLE_FLAT_TYPE ) && ( (*other)._key_type == Key_Code ) && ( (*other)._item_type == Type_Code ) );
+   PRECONDITION( "current not other", current != other );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   // empty current
+   dispose_all( current );
+   memset( (*current).slot, 0, (*current).capacity * sizeof( slot_t ) );
+   (*current).count = 0;
+   (*current).cursor = (*current).capacity;
+
+   // put key-values from other into current
+   LOCK( (*other).mutex );
+   copy_items( current, other, 0 );
+   UNLOCK( (*other).mutex );
+
+   POSTCONDITION( "new htable copy is equal to original", compare_items( current, other, 0 ) == 1 );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   HTable_flat_deep_copy
+*/
+
+void
+HTable_flat_deep_copy( Prefix )( HTable_flat_type( Prefix ) *current, HTable_flat_type( Prefix ) *other )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   PRECONDITION( "other not null", other != NULL );
+   PRECONDITION( "other type ok", ( (*other)._type == HTABLE_FLAT_TYPE ) && ( (*other)._key_type == Key_Code ) && ( (*other)._item_type == Type_Code ) );
+   PRECONDITION( "current not other", current != other );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   // empty current
+   dispose_all( current );
+   memset( (*current).slot, 0, (*current).capacity * sizeof( slot_t ) );
+   (*current).count = 0;
+   (*current).cursor = (*current).capacity;
+
+   // put key-values from other into current
+   LOCK( (*other).mutex );
+   copy_items( current, other, 1 );
+   UNLOCK( (*other).mutex );
+
+   POSTCONDITION( "new htable copy is equal to original", compare_items( current, other, 1 ) == 1 );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   HTable_flat_dispose
+*/
+
+void
+HTable_flat_dispose( Prefix )( HTable_flat_type( Prefix ) **current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "*current not null", *current != NULL );
+   PRECONDITION( "current type ok", ( (**current)._type == HTABLE_FLAT_TYPE ) && ( (**current)._key_type == Key_Code ) && ( (**current)._item_type == Type_Code ) );
+   LOCK( (**current).mutex );
+   INVARIANT(*current);
+
+   // delete slot array
+   free( (**current).slot );
+
+   MULTITHREAD_MUTEX_DESTROY( (**current).mutex );
+
+   // delete htable struct
+   free(*current);
+
+   // set to NULL
+   *current = NULL;
+
+   return;
+}
+
+/**
+   HTable_flat_deep_dispose
+*/
+
+void
+HTable_flat_deep_dispose( Prefix )( HTable_flat_type( Prefix ) **current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "*current not null", *current != NULL );
+   PRECONDITION( "current type ok", ( (**current)._type == HTABLE_FLAT_TYPE ) && ( (**current)._key_type == Key_Code ) && ( (**current)._item_type == Type_Code ) );
+   LOCK( (**current).mutex );
+   INVARIANT(*current);
+
+   // delete keys and values
+   dispose_all( *current );
+
+   // delete slot array
+   free( (**current).slot );
+
+   MULTITHREAD_MUTEX_DESTROY( (**current).mutex );
+
+   // delete htable struct
+   free(*current);
+
+   // set to NULL
+   *current = NULL;
+
+   return;
+}
+
+/**
+   HTable_flat_keys_as_array
+*/
+
+Key *
+HTable_flat_keys_as_array( Prefix )( HTable_flat_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t i = 0;
+   int32_t j = 0;
+
+   Key *result = ( Key * ) calloc( (*current).count + 1, sizeof( Key ) );
+   CHECK( "result allocated correctly", result != NULL );
+
+   for ( i = 0; i < (*current).capacity; i++ )
+   {
+      if ( (*current).slot[i].distance != 0 )
+      {
+         result[j] = (*current).slot[i].key;
+         j = j + 1;
+      }
+   }
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   HTable_flat_values_as_array
+*/
+
+Type *
+HTable_flat_values_as_array( Prefix )( HTable_flat_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t i = 0;
+   int32_t j = 0;
+
+   Type *result = ( Type * ) calloc( (*current).count + 1, sizeof( Type ) );
+   CHECK( "result allocated correctly", result != NULL );
+
+   for ( i = 0; i < (*current).capacity; i++ )
+   {
+      if ( (*current).slot[i].distance != 0 )
+      {
+         result[j] = (*current).slot[i].value;
+         j = j + 1;
+      }
+   }
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   HTable_flat_item_at
+*/
+
+Type
+HTable_flat_item_at( Prefix )( HTable_flat_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+   PRECONDITION( "not off", (*current).cursor < (*current).capacity );
+
+   Type value = (*current).slot[ (*current).cursor ].value;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return value;
+}
+
+/**
+   HTable_flat_key_at
+*/
+
+Key
+HTable_flat_key_at( Prefix )( HTable_flat_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+   PRECONDITION( "not off", (*current).cursor < (*current).capacity );
+
+   Key key = (*current).slot[ (*current).cursor ].key;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return key;
+}
+
+/**
+   HTable_flat_item
+*/
+
+Type
+HTable_flat_item( Prefix )( HTable_flat_type( Prefix ) *current, Key key )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t i = find_index( current, key, mixed_hash( key ) );
+
+   PRECONDITION( "has key", i >= 0 );
+
+   Type value = (*current).slot[i].value;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return value;
+}
+
+/**
+   HTable_flat_count
+*/
+
+int32_t
+HTable_flat_count( Prefix )( HTable_flat_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t count = (*current).count;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return count;
+}
+
+/**
+   HTable_flat_capacity
+*/
+
+int32_t
+HTable_flat_capacity( Prefix )( HTable_flat_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t capacity = (*current).capacity;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return capacity;
+}
+
+/**
+   HTable_flat_off
+*/
+
+int32_t
+HTable_flat_off( Prefix )( HTable_flat_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = ( (*current).cursor == (*current).capacity );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   HTable_flat_is_empty
+*/
+
+int32_t
+HTable_flat_is_empty( Prefix )( HTable_flat_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = ( (*current).count == 0 );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   HTable_flat_has
+*/
+
+int32_t
+HTable_flat_has( Prefix )( HTable_flat_type( Prefix ) *current, Key key )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = ( find_index( current, key, mixed_hash( key ) ) >= 0 );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   HTable_flat_forth
+*/
+
+void
+HTable_flat_forth( Prefix )( HTable_flat_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+   PRECONDITION( "not off", (*current).cursor < (*current).capacity );
+
+   (*current).cursor = next_occupied( current, (*current).cursor + 1 );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   HTable_flat_start
+*/
+
+void
+HTable_flat_start( Prefix )( HTable_flat_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   (*current).cursor = next_occupied( current, 0 );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   HTable_flat_put
+*/
+
+void
+HTable_flat_put( Prefix )( HTable_flat_type( Prefix ) *current, Type value, Key key )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+   POSTCONDITION_VARIABLE_DEFINE( int32_t count_pc = ( find_index( current, key, mixed_hash( key ) ) >= 0 ) ? (*current).count : (*current).count + 1; );
+
+   put( current, value, key );
+
+   POSTCONDITION( "count incremented", (*current).count == count_pc );
+   POSTCONDITION( "item added", find_index( current, key, mixed_hash( key ) ) >= 0 );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   HTable_flat_replace_and_dispose
+*/
+
+void
+HTable_flat_replace_and_dispose( Prefix )( HTable_flat_type( Prefix ) *current, Type value, Key key )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+   POSTCONDITION_VARIABLE_DEFINE( int32_t count_pc = ( find_index( current, key, mixed_hash( key ) ) >= 0 ) ? (*current).count : (*current).count + 1; );
+
+   int32_t i = find_index( current, key, mixed_hash( key ) );
+
+   // delete previous key unless it is the same as the new key
+   // delete previous value unless it is the same as the new value
+   if ( i >= 0 )
+   {
+      if ( (*current).slot[i].key != key )
+      {
+         KEY_DEEP_DISPOSE_FUNCTION( (*current).slot[i].key );
+      }
+      if ( (*current).slot[i].value != value )
+      {
+         VALUE_DEEP_DISPOSE_FUNCTION( (*current).slot[i].value );
+      }
+      (*current).slot[i].key = key;
+      (*current).slot[i].value = value;
+   }
+   else
+   {
+      put( current, value, key );
+   }
+
+   POSTCONDITION( "count ok", (*current).count == count_pc );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   HTable_flat_remove
+*/
+
+void
+HTable_flat_remove( Prefix )( HTable_flat_type( Prefix ) *current, Key key )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t i = find_index( current, key, mixed_hash( key ) );
+
+   PRECONDITION( "has key", i >= 0 );
+   POSTCONDITION_VARIABLE_DEFINE( int32_t count_pc = (*current).count - 1; );
+
+   remove_index( current, i );
+
+   POSTCONDITION( "count decremented", (*current).count == count_pc );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   HTable_flat_remove_and_dispose
+*/
+
+void
+HTable_flat_remove_and_dispose( Prefix )( HTable_flat_type( Prefix ) *current, Key key )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t i = find_index( current, key, mixed_hash( key ) );
+
+   PRECONDITION( "has key", i >= 0 );
+   POSTCONDITION_VARIABLE_DEFINE( int32_t count_pc = (*current).count - 1; );
+
+   KEY_DEEP_DISPOSE_FUNCTION( (*current).slot[i].key );
+   VALUE_DEEP_DISPOSE_FUNCTION( (*current).slot[i].value );
+
+   remove_index( current, i );
+
+   POSTCONDITION( "count decremented", (*current).count == count_pc );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   HTable_flat_wipe_out
+*/
+
+void
+HTable_flat_wipe_out( Prefix )( HTable_flat_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   // clear out slots
+   memset( (*current).slot, 0, (*current).capacity * sizeof( slot_t ) );
+
+   (*current).count = 0;
+   (*current).cursor = (*current).capacity;
+
+   POSTCONDITION( "is empty", (*current).count == 0 );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   HTable_flat_wipe_out_and_dispose
+*/
+
+void
+HTable_flat_wipe_out_and_dispose( Prefix )( HTable_flat_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   // delete keys and values
+   dispose_all( current );
+
+   // clear out slots
+   memset( (*current).slot, 0, (*current).capacity * sizeof( slot_t ) );
+
+   (*current).count = 0;
+   (*current).cursor = (*current).capacity;
+
+   POSTCONDITION( "is empty", (*current).count == 0 );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   HTable_flat_set_capacity
+*/
+
+void
+HTable_flat_set_capacity( Prefix )( HTable_flat_type( Prefix ) *current, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == HTABLE_FLAT_TYPE ) && ( (*current)._key_type == Key_Code ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+   PRECONDITION( "count ok", count >= (*current).count );
+
+   int32_t shift = 0;
+   int32_t capacity = capacity_for_count( count, &shift );
+
+   resize( current, capacity, shift );
+
+   POSTCONDITION( "capacity ok", ( int64_t ) (*current).capacity * MAX_LOAD_NUMERATOR >= ( int64_t ) count * MAX_LOAD_DENOMINATOR );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
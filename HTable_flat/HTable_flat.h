@@ -0,0 +1,517 @@
+/**
+ @file HTable_flat.h
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "Open Addressing Hash Tables"
+
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0):
+
+ 1. Permission is hereby granted to use, copy, modify and/or
+    distribute this package, provided that:
+       * copyright notices are retained unchanged,
+       * any distribution of this package, whether modified or not,
+         includes this license text.
+ 2. Permission is hereby also granted to distribute binary programs
+    which depend on this package. If the binary program depends on a
+    modified version of this package, you are encouraged to publicly
+    release the modified version of this package.
+
+ THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT WARRANTY. ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE AUTHORS BE LIABLE TO ANY PARTY FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES ARISING IN ANY WAY OUT OF THE USE OF THIS PACKAGE.
+
+ @section Description
+
+ Function declarations for the opaque HTable_flat_t type.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+   Version
+*/
+
+#define HTABLE_FLAT_VERSION_MAJOR 2
+#define HTABLE_FLAT_VERSION_MINOR 0
+#define HTABLE_FLAT_VERSION_PATCH 0
+
+#define HTABLE_FLAT_MAKE_VERSION( major, minor, patch ) \
+   ( (major)*10000 + (minor)*100 + (patch) )
+
+#define HTABLE_FLAT_VERSION \
+   HTABLE_FLAT_MAKE_VERSION( HTABLE_FLAT_VERSION_MAJOR, \
+                       HTABLE_FLAT_VERSION_MINOR, \
+                       HTABLE_FLAT_VERSION_PATCH )
+
+/**
+   Includes
+*/
+
+#include "base.h"
+
+/**
+   Note that this include file does NOT have an include guard - it may
+   be included multiple times with different macro defintions.
+
+   Defines that must be present (external to this file):
+
+   Prefix - string used to name this container type
+   Key    - the type of the key
+   Type   - the type of the value
+
+   Macros that must be present (external to this file):
+
+   KEY_HASH_FUNCTION           -  takes a key instance as an argument and returns an
+                                  integer hash code
+   KEY_DEEP_EQUAL_FUNCTION     -  compares two key instances for equality
+   KEY_DEEP_DISPOSE_FUNCTION   -  frees a key instance
+   KEY_DEEP_CLONE_FUNCTION     -  returns a copy of a key instance
+   VALUE_DEEP_DISPOSE_FUNCTION -  frees a value instance
+   VALUE_DEEP_CLONE_FUNCTION   -  returns a copy of a value instance
+   VALUE_DEEP_EQUAL_FUNCTION   -  compares two value instances for equality
+
+   Unlike HTable_t, the keys and values are stored directly in a single array
+   of slots (open addressing with Robin Hood probing), so there is no
+   per-item allocation. Items are iterated in slot order, not in insertion
+   order. Putting a new key or removing a key may move other items, so these
+   operations set the internal cursor off.
+
+*/
+
+/**
+   Macro definitions
+*/
+
+#define PRIMITIVE_CAT(arg, ...) arg ## __VA_ARGS__
+
+#define HTable_flat_struct( arg ) PRIMITIVE_CAT( arg, _htable_flat_struct )
+#define HTable_flat_type( arg ) PRIMITIVE_CAT( arg, _htable_flat_t )
+#define HTable_flat_name( arg ) PRIMITIVE_CAT( arg, _htable_flat )
+
+/**
+   Structure declarations
+*/
+
+struct HTable_flat_struct( Prefix );
+
+/**
+   Structure typedefs
+*/
+
+typedef struct HTable_flat_struct( Prefix ) HTable_flat_type( Prefix );
+
+/**
+   Function names below are prepended with "Prefix_".
+*/
+
+/*
+   Initialization
+*/
+
+/**
+   HTable_flat_make
+
+   Return a new HTable_flat_t instance with a default capacity.
+
+   @return HTable_flat_t instance
+*/
+#define HTable_flat_make( arg ) PRIMITIVE_CAT( arg, _htable_flat_make )
+HTable_flat_type( Prefix ) * HTable_flat_make( Prefix )( void );
+
+/**
+   HTable_flat_make_n
+
+   Return a new HTable_flat_t instance that can hold at least count items
+   before it has to grow.
+
+   @param  count the number of items to size the hash table for
+   @return HTable_flat_t instance
+*/
+#define HTable_flat_make_n( arg ) PRIMITIVE_CAT( arg, _htable_flat_make_n )
+HTable_flat_type( Prefix ) * HTable_flat_make_n( Prefix )( int32_t count );
+
+/**
+   HTable_flat_make_from_array
+
+   Return a new HTable_flat_t instance that has the same content as array.
+   The key and value items in array are not copied.
+
+   @param  key_array the array of keys to copy from
+   @param  value_array the array of values to copy from
+   @param  count the number of items to copy
+   @return HTable_flat_t instance
+*/
+#define HTable_flat_make_from_array( arg ) PRIMITIVE_CAT( arg, _htable_flat_make_from_array )
+HTable_flat_type( Prefix ) * HTable_flat_make_from_array( Prefix )( Key *key_array, Type *value_array, int32_t count );
+
+
+/*
+   Basic
+*/
+
+/**
+   HTable_flat_clone
+
+   Return a new HTable_flat_t instance that has the same content as current.
+   The key and value items in current are not copied.
+
+   @param  current the HTable_flat_t instance to copy from
+   @return HTable_flat_t instance
+*/
+#define HTable_flat_clone( arg ) PRIMITIVE_CAT( arg, _htable_flat_clone )
+HTable_flat_type( Prefix ) * HTable_flat_clone( Prefix )( HTable_flat_type( Prefix ) *current );
+
+/**
+   HTable_flat_deep_clone
+
+   Return a new HTable_flat_t instance that has the same content as current.
+   The key and value items in current are copied.
+
+   @param  current the HTable_flat_t instance to copy from
+   @return HTable_flat_t instance
+*/
+#define HTable_flat_deep_clone( arg ) PRIMITIVE_CAT( arg, _htable_flat_deep_clone )
+HTable_flat_type( Prefix ) * HTable_flat_deep_clone( Prefix )( HTable_flat_type( Prefix ) *current );
+
+/**
+   HTable_flat_is_equal
+
+   Return 1 if current has the same (shallow) content as other.
+
+   @param  current the HTable_flat_t instance to compare to
+   @param  other the HTable_flat_t instance to compare from
+   @return 1 if true, 0 otherwise
+*/
+#define HTable_flat_is_equal( arg ) PRIMITIVE_CAT( arg, _htable_flat_is_equal )
+int32_t HTable_flat_is_equal( Prefix )( HTable_flat_type( Prefix ) *current, HTable_flat_type( Prefix ) *other );
+
+/**
+   HTable_flat_is_deep_equal
+
+   Return 1 if current has the same (deep) content as other.
+
+   @param  current the HTable_flat_t instance to compare to
+   @param  other the HTable_flat_t instance to compare from
+   @return 1 if true, 0 otherwise
+*/
+#define HTable_flat_is_deep_equal( arg ) PRIMITIVE_CAT( arg, _htable_flat_is_deep_equal )
+int32_t HTable_flat_is_deep_equal( Prefix )( HTable_flat_type( Prefix ) *current, HTable_flat_type( Prefix ) *other );
+
+/**
+   HTable_flat_copy
+
+   Copy (shallow) other into current. Items in current are disposed.
+
+   @param  current the HTable_flat_t instance to copy into
+   @param  other the HTable_flat_t instance to copy from
+*/
+#define HTable_flat_copy( arg ) PRIMITIVE_CAT( arg, _htable_flat_copy )
+void HTable_flat_copy( Prefix )( HTable_flat_type( Prefix ) *current, HTable_flat_type( Prefix ) *other );
+
+/**
+   HTable_flat_deep_copy
+
+   Copy (deep) other into current. Items in current are disposed.
+
+   @param  current the HTable_flat_t instance to copy into
+   @param  other the HTable_flat_t instance to copy from
+*/
+#define HTable_flat_deep_copy( arg ) PRIMITIVE_CAT( arg, _htable_flat_deep_copy )
+void HTable_flat_deep_copy( Prefix )( HTable_flat_type( Prefix ) *current, HTable_flat_type( Prefix ) *other );
+
+/*
+   Disposal
+*/
+
+/**
+   HTable_flat_dispose
+
+   Frees a HTable_flat_t instance without freeing its contained keys and values.
+
+   @param current pointer to HTable_flat_t instance
+*/
+#define HTable_flat_dispose( arg ) PRIMITIVE_CAT( arg, _htable_flat_dispose )
+void HTable_flat_dispose( Prefix )( HTable_flat_type( Prefix ) **current );
+
+/**
+   HTable_flat_deep_dispose
+
+   Frees a HTable_flat_t instance and its contained keys and values.
+
+   @param current pointer to HTable_flat_t instance
+*/
+#define HTable_flat_deep_dispose( arg ) PRIMITIVE_CAT( arg, _htable_flat_deep_dispose )
+void HTable_flat_deep_dispose( Prefix )( HTable_flat_type( Prefix ) **current );
+
+/**
+   HTable_flat_keys_as_array
+
+   Returns the keys as an array, in slot order.
+
+   @param  current HTable_flat_t instance
+   @return array of Key values
+*/
+#define HTable_flat_keys_as_array( arg ) PRIMITIVE_CAT( arg, _htable_flat_keys_as_array )
+Key *HTable_flat_keys_as_array( Prefix )( HTable_flat_type( Prefix ) *current );
+
+/**
+   HTable_flat_values_as_array
+
+   Returns the values as an array, in slot order.
+
+   @param  current HTable_flat_t instance
+   @return array of Type values
+*/
+#define HTable_flat_values_as_array( arg ) PRIMITIVE_CAT( arg, _htable_flat_values_as_array )
+Type *HTable_flat_values_as_array( Prefix )( HTable_flat_type( Prefix ) *current );
+
+/*
+   Access
+*/
+
+/**
+   HTable_flat_item_at
+
+   Returns the value of the item that the HTable_flat_t instance's internal
+   cursor is pointing to.
+
+   @param  current HTable_flat_t instance
+   @return a Type value
+*/
+#define HTable_flat_item_at( arg ) PRIMITIVE_CAT( arg, _htable_flat_item_at )
+Type HTable_flat_item_at( Prefix )( HTable_flat_type( Prefix ) *current );
+
+/**
+   HTable_flat_key_at
+
+   Returns the key of the item that the HTable_flat_t instance's internal
+   cursor is pointing to.
+
+   @param  current HTable_flat_t instance
+   @return a Key value
+*/
+#define HTable_flat_key_at( arg ) PRIMITIVE_CAT( arg, _htable_flat_key_at )
+Key HTable_flat_key_at( Prefix )( HTable_flat_type( Prefix ) *current );
+
+/**
+   HTable_flat_item
+
+   Returns the value of the item in the HTable_flat_t instance associated
+   with key.
+
+   @param  current HTable_flat_t instance
+   @param  key the key to look for
+   @return a Type value
+*/
+#define HTable_flat_item( arg ) PRIMITIVE_CAT( arg, _htable_flat_item )
+Type HTable_flat_item( Prefix )( HTable_flat_type( Prefix ) *current, Key key );
+
+
+/*
+   Measurement
+*/
+
+/**
+   HTable_flat_count
+
+   Returns the number of items in the HTable_flat_t instance.
+
+   @param  current HTable_flat_t instance
+   @return number of items in HTable_flat instance
+*/
+#define HTable_flat_count( arg ) PRIMITIVE_CAT( arg, _htable_flat_count )
+int32_t HTable_flat_count( Prefix )( HTable_flat_type( Prefix ) *current );
+
+/**
+   HTable_flat_capacity
+
+   Returns the number of slots in the HTable_flat_t instance.
+
+   @param  current HTable_flat_t instance
+   @return number of slots in HTable_flat instance
+*/
+#define HTable_flat_capacity( arg ) PRIMITIVE_CAT( arg, _htable_flat_capacity )
+int32_t HTable_flat_capacity( Prefix )( HTable_flat_type( Prefix ) *current );
+
+
+/*
+   Status report
+*/
+
+/**
+   HTable_flat_off
+
+   Returns 1 if the HTable_flat_t instance's internal cursor is off, otherwise 0.
+
+   @param  current HTable_flat_t instance
+   @return 1 if internal cursor is off, otherwise 0
+*/
+#define HTable_flat_off( arg ) PRIMITIVE_CAT( arg, _htable_flat_off )
+int32_t HTable_flat_off( Prefix )( HTable_flat_type( Prefix ) *current );
+
+/**
+   HTable_flat_is_empty
+
+   Returns 1 if the HTable_flat_t instance contains no items, otherwise 0.
+
+   @param  current HTable_flat_t instance
+   @return 1 if empty, otherwise 0
+*/
+#define HTable_flat_is_empty( arg ) PRIMITIVE_CAT( arg, _htable_flat_is_empty )
+int32_t HTable_flat_is_empty( Prefix )( HTable_flat_type( Prefix ) *current );
+
+/**
+   HTable_flat_has
+
+   Returns 1 if the HTable_flat_t instance contains the key, otherwise 0.
+
+   @param  current HTable_flat_t instance
+   @param  key the key to look for
+   @return 1 if htable has key, otherwise 0
+*/
+#define HTable_flat_has( arg ) PRIMITIVE_CAT( arg, _htable_flat_has )
+int32_t HTable_flat_has( Prefix )( HTable_flat_type( Prefix ) *current, Key key );
+
+
+/*
+   Cursor movement
+*/
+
+/**
+   HTable_flat_forth
+
+   Moves the HTable_flat_t instance internal cursor to the next item or off.
+
+   @param  current HTable_flat_t instance
+*/
+#define HTable_flat_forth( arg ) PRIMITIVE_CAT( arg, _htable_flat_forth )
+void HTable_flat_forth( Prefix )( HTable_flat_type( Prefix ) *current );
+
+/**
+   HTable_flat_start
+
+   Moves the HTable_flat_t instance's internal cursor to the first item or
+   off if the htable is empty.
+
+   @param  current HTable_flat_t instance
+*/
+#define HTable_flat_start( arg ) PRIMITIVE_CAT( arg, _htable_flat_start )
+void HTable_flat_start( Prefix )( HTable_flat_type( Prefix ) *current );
+
+
+/*
+   Element change
+*/
+
+/**
+   HTable_flat_put
+
+   Put the key-value pair into the HTable_flat_t instance. Replace any
+   existing item that has the same key. If the key is new, the internal
+   cursor is set off.
+
+   @param  current HTable_flat_t instance
+   @param  value the value to insert
+   @param  key the key for the value
+*/
+#define HTable_flat_put( arg ) PRIMITIVE_CAT( arg, _htable_flat_put )
+void HTable_flat_put( Prefix )( HTable_flat_type( Prefix ) *current, Type value, Key key );
+
+/**
+   HTable_flat_replace_and_dispose
+
+   Put the key-value pair into the HTable_flat_t instance. Dispose of the
+   original key and value if they are replaced.
+
+   @param  current HTable_flat_t instance
+   @param  value the value to replace with
+   @param  key the key for the value
+*/
+#define HTable_flat_replace_and_dispose( arg ) PRIMITIVE_CAT( arg, _htable_flat_replace_and_dispose )
+void HTable_flat_replace_and_dispose( Prefix )( HTable_flat_type( Prefix ) *current, Type value, Key key );
+
+
+/*
+   Removal
+*/
+
+/**
+   HTable_flat_remove
+
+   Remove the item in the HTable_flat_t instance that has the key. The
+   internal cursor is set off.
+
+   @param  current HTable_flat_t instance
+   @param  key the key for the value
+*/
+#define HTable_flat_remove( arg ) PRIMITIVE_CAT( arg, _htable_flat_remove )
+void HTable_flat_remove( Prefix )( HTable_flat_type( Prefix ) *current, Key key );
+
+/**
+   HTable_flat_remove_and_dispose
+
+   Remove the item in the HTable_flat_t instance that has the key and dispose
+   of the key and the value. The internal cursor is set off.
+
+   @param  current HTable_flat_t instance
+   @param  key the key for the value
+*/
+#define HTable_flat_remove_and_dispose( arg ) PRIMITIVE_CAT( arg, _htable_flat_remove_and_dispose )
+void HTable_flat_remove_and_dispose( Prefix )( HTable_flat_type( Prefix ) *current, Key key );
+
+/**
+   HTable_flat_wipe_out
+
+   Remove all items in the HTable_flat_t instance.
+
+   @param  current HTable_flat_t instance
+*/
+#define HTable_flat_wipe_out( arg ) PRIMITIVE_CAT( arg, _htable_flat_wipe_out )
+void HTable_flat_wipe_out( Prefix )( HTable_flat_type( Prefix ) *current );
+
+/**
+   HTable_flat_wipe_out_and_dispose
+
+   Remove all items in the HTable_flat_t instance. Dispose of all keys and
+   values.
+
+   @param  current HTable_flat_t instance
+*/
+#define HTable_flat_wipe_out_and_dispose( arg ) PRIMITIVE_CAT( arg, _htable_flat_wipe_out_and_dispose )
+void HTable_flat_wipe_out_and_dispose( Prefix )( HTable_flat_type( Prefix ) *current );
+
+
+/*
+   Resize
+*/
+
+/**
+   HTable_flat_set_capacity
+
+   Resize the slot array so it can hold at least count items before it has
+   to grow. The internal cursor is set off.
+
+   @param  current HTable_flat_t instance
+   @param  count the number of items to size the hash table for
+*/
+#define HTable_flat_set_capacity( arg ) PRIMITIVE_CAT( arg, _htable_flat_set_capacity )
+void HTable_flat_set_capacity( Prefix )( HTable_flat_type( Prefix ) *current, int32_t count );
+
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
@@ -47,18 +47,62 @@ extern "C" {
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #ifdef MULTITHREADED
 #include MULTITHREAD_INCLUDE
 #endif
 
 struct input_file_reader_struct;
 
+#include "pool.h"
 #include "dbc.h"
 
 /**
    defines
 */
 
+/**
+   slice_list_t - a growable array of token slices
+*/
+
+typedef struct
+{
+   ifr_slice_t *items;
+   int32_t count;
+   int32_t capacity;
+} slice_list_t;
+
+/**
+   batch_line_t - a line with tokens of a batch, its line number counted
+   from the start of the chunk and its first token and count of tokens in
+   the slices of the batch
+*/
+
+typedef struct
+{
+   int64_t line_number;
+   int32_t first;
+   int32_t count;
+   ifr_slice_t line;
+} batch_line_t;
+
+/**
+   batch_t - the lines with tokens of one chunk of a parallel reader, chunk
+   is -1 if the batch is free
+*/
+
+typedef struct
+{
+   int32_t chunk;
+   int32_t is_done;
+   int32_t is_skip_comments;
+   slice_list_t slices;
+   batch_line_t *lines;
+   int32_t line_count;
+   int32_t line_capacity;
+} batch_t;
+
 /**
    Input file reader structure
 */
@@ -71,9 +115,43 @@ struct input_file_reader_struct
    FILE *fp;
    s_dlist_t *tokens;
    string_t *line;
-   int32_t line_number;
+   int64_t line_number;
    int32_t is_skip_comments;
 
+   // slice reader
+   int32_t is_slices;
+   int32_t is_mapped;
+   int32_t is_exhausted;
+   int32_t is_at_end;
+   char_t *buffer;
+   int64_t buffer_size;
+   int64_t start;
+   int64_t end;
+   slice_list_t slices;
+   ifr_slice_t *line_tokens;
+   int32_t line_token_count;
+   ifr_slice_t line_slice;
+
+   // parallel reader
+   int32_t is_parallel;
+   int32_t is_ordered;
+   int32_t is_started;
+   int32_t chunk_count;
+   int32_t chunk_next;
+   int32_t chunk_delivered;
+   int32_t chunk_counted;
+   int64_t *chunk_starts;
+   int64_t *chunk_lines;
+   int64_t *chunk_bases;
+   int64_t line_total;
+   batch_t *batches;
+   int32_t batch_count;
+   batch_t *batch;
+   int32_t batch_line;
+   int32_t quit;
+   pool_t pool;
+
+   MULTITHREAD_COND_DEFINITION( work_done );
    MULTITHREAD_MUTEX_DEFINITION( mutex );
 };
 
@@ -99,10 +177,38 @@ members_ok( ifr_t *p )
    return result;
 }
 
+static
+int32_t
+slices_ok( ifr_t *p )
+{
+   int32_t result = 1;
+
+   if ( (*p).is_slices == 1 )
+   {
+      result
+         =  ( (*p).slices.items != NULL )
+            &&
+            ( (*p).slices.count >= 0 )
+            &&
+            ( (*p).slices.count <= (*p).slices.capacity )
+            &&
+            ( (*p).line_token_count >= 0 )
+            &&
+            ( (*p).start >= 0 )
+            &&
+            ( (*p).start <= (*p).end )
+            &&
+            ( (*p).end <= (*p).buffer_size );
+   }
+
+   return result;
+}
+
 static
 void invariant( ifr_t *p )
 {
    assert( ( ( void ) "members ok", members_ok( p ) ) );
+   assert( ( ( void ) "slices ok", slices_ok( p ) ) );
    return;
 }
 
@@ -220,39 +326,858 @@ get_string_tokens
             t = string_make_n( 12 );
             token_flag = 1;
 
-            // and we're inside quotes
-            quote_flag = 1;
-         }
-      }
-      // for any other character
-      else
-      {
-         // if we're not parsing a token
-         if ( token_flag == 0 )
-         {
-            // start a new token
-            t = string_make_n( 12 );
+            // and we're inside quotes
+            quote_flag = 1;
+         }
+      }
+      // for any other character
+      else
+      {
+         // if we're not parsing a token
+         if ( token_flag == 0 )
+         {
+            // start a new token
+            t = string_make_n( 12 );
+
+            // now parsing a token
+            token_flag = 1;
+         }
+         // append c to the end of the token
+         string_append_character( t, c );
+      }
+
+   }
+
+   // at end of line and parsing a token
+   if ( token_flag == 1 )
+   {
+      // finish the token, put the token in the list
+      s_dlist_put_last( list, t );
+      t = NULL;
+   }
+
+}
+
+/**
+   put_slice
+
+   append a token slice to a slice list, growing the array if full
+*/
+static
+void
+put_slice( slice_list_t *list, char_t *base, int32_t count )
+{
+   if ( (*list).count == (*list).capacity )
+   {
+      (*list).capacity = 2 * (*list).capacity;
+      (*list).items
+         = ( ifr_slice_t * ) realloc( (*list).items, (*list).capacity * sizeof( ifr_slice_t ) );
+      CHECK( "(*list).items allocated correctly", (*list).items != NULL );
+   }
+
+   (*list).items[ (*list).count ].base = base;
+   (*list).items[ (*list).count ].count = count;
+   (*list).count = (*list).count + 1;
+
+   return;
+}
+
+/**
+   is_comment
+
+   Return 1 if the token starts with a comment string, "//" or "--"
+*/
+static
+int32_t
+is_comment( char_t *base, int32_t count )
+{
+   int32_t result = 0;
+
+   if ( count >= 2 )
+   {
+      result
+         =  ( ( base[0] == '/' ) && ( base[1] == '/' ) )
+            ||
+            ( ( base[0] == '-' ) && ( base[1] == '-' ) );
+   }
+
+   return result;
+}
+
+/**
+   get_slice_tokens
+
+   Parse a line into token slices with the same rules as get_string_tokens.
+   Every token is a run of characters of the line, either up to whitespace
+   or, for a token that starts with double quotes, up to the closing double
+   quotes, so no characters are copied. If comments are skipped, the scan
+   stops at the first token that starts with a comment string.
+
+   @param list slice list to append the slices to
+   @param is_skip_comments 1 to drop comments
+   @param line first character of the line
+   @param n number of characters in the line
+*/
+static
+void
+get_slice_tokens
+(
+   slice_list_t *list,
+   int32_t is_skip_comments,
+   char_t *line,
+   int64_t n
+)
+{
+   int64_t i = 0;
+   int64_t j = 0;
+   char_t c = 0;
+   int32_t is_done = 0;
+
+   while ( ( i < n ) && ( is_done == 0 ) )
+   {
+      c = line[i];
+
+      // skip whitespace
+      if ( ( c == ' ' ) || ( c == '\t' ) || ( c == '\n' ) || ( c == '\r' ) )
+      {
+         i = i + 1;
+      }
+      else
+      {
+         // a quoted token runs to the closing quotes or the end of line
+         if ( c == '\"' )
+         {
+            i = i + 1;
+            j = i;
+            while
+            (
+               ( j < n )
+               && ( line[j] != '\"' )
+               && ( line[j] != '\n' )
+               && ( line[j] != '\r' )
+            )
+            {
+               j = j + 1;
+            }
+         }
+         // any other token runs to whitespace
+         else
+         {
+            j = i;
+            while
+            (
+               ( j < n )
+               && ( line[j] != ' ' )
+               && ( line[j] != '\t' )
+               && ( line[j] != '\n' )
+               && ( line[j] != '\r' )
+            )
+            {
+               j = j + 1;
+            }
+         }
+
+         if ( ( is_skip_comments == 1 ) && ( is_comment( &line[i], ( int32_t ) ( j - i ) ) == 1 ) )
+         {
+            // the rest of the line is a comment
+            is_done = 1;
+         }
+         else
+         {
+            put_slice( list, &line[i], ( int32_t ) ( j - i ) );
+         }
+
+         // step past the closing quotes
+         i = ( c == '\"' ) ? j + 1 : j;
+      }
+   }
+
+   return;
+}
+
+/**
+   get_slice_line
+
+   Find the next line in the read buffer or the mapped file, reading more of
+   the file into the buffer as needed. Returns 0 at end of file, like
+   getline returning -1, and sets is_at_end when the end of file is found,
+   which is after a last line with no end of line.
+
+   @param ifr ifr_t instance
+   @param line receives the first character of the line
+   @param n receives the number of characters in the line
+   @return 1 if a line was found, 0 otherwise
+*/
+static
+int32_t
+get_slice_line
+(
+   ifr_t *ifr,
+   char_t **line,
+   int64_t *n
+)
+{
+   int32_t result = 0;
+   int64_t scanned = 0;
+   int64_t count = 0;
+   char_t *p = NULL;
+
+   if ( (*ifr).end > (*ifr).start )
+   {
+      p = memchr( &(*ifr).buffer[ (*ifr).start ], '\n', (*ifr).end - (*ifr).start );
+   }
+
+   while ( ( p == NULL ) && ( (*ifr).is_exhausted == 0 ) )
+   {
+      // move the partial line to the front of the buffer
+      if ( (*ifr).start > 0 )
+      {
+         memmove( (*ifr).buffer, &(*ifr).buffer[ (*ifr).start ], (*ifr).end - (*ifr).start );
+         (*ifr).end = (*ifr).end - (*ifr).start;
+         (*ifr).start = 0;
+      }
+
+      // a line longer than the buffer doubles it
+      if ( (*ifr).end == (*ifr).buffer_size )
+      {
+         (*ifr).buffer_size = 2 * (*ifr).buffer_size;
+         (*ifr).buffer = ( char_t * ) realloc( (*ifr).buffer, (*ifr).buffer_size );
+         CHECK( "(*ifr).buffer allocated correctly", (*ifr).buffer != NULL );
+      }
+
+      scanned = (*ifr).end;
+      count = ( int64_t ) fread( &(*ifr).buffer[ (*ifr).end ], 1, (*ifr).buffer_size - (*ifr).end, (*ifr).fp );
+      (*ifr).end = (*ifr).end + count;
+
+      if ( count == 0 )
+      {
+         (*ifr).is_exhausted = 1;
+      }
+      else
+      {
+         p = memchr( &(*ifr).buffer[ scanned ], '\n', count );
+      }
+   }
+
+   if ( p != NULL )
+   {
+      *line = &(*ifr).buffer[ (*ifr).start ];
+      *n = p - *line + 1;
+      (*ifr).start = (*ifr).start + *n;
+      result = 1;
+   }
+   else if ( (*ifr).end > (*ifr).start )
+   {
+      // last line has no end of line
+      *line = &(*ifr).buffer[ (*ifr).start ];
+      *n = (*ifr).end - (*ifr).start;
+      (*ifr).start = (*ifr).end;
+      (*ifr).is_at_end = 1;
+      result = 1;
+   }
+   else
+   {
+      (*ifr).is_at_end = 1;
+   }
+
+   return result;
+}
+
+#define DEFAULT_LINE_SIZE 120
+#define DEFAULT_BUFFER_SIZE ( 1 << 20 )
+#define DEFAULT_SLICE_CAPACITY 16
+
+/**
+   make_slices
+
+   Return a new slice reader of file_name, with the file mapped if is_mapped
+   is 1 and it can be, and with a read buffer otherwise
+*/
+
+static
+ifr_t *
+make_slices( char_t *file_name, int32_t is_mapped )
+{
+   struct stat st;
+   void *p = MAP_FAILED;
+
+   // allocate list struct
+   ifr_t * result = ( ifr_t * ) calloc( 1, sizeof( ifr_t ) );
+   CHECK( "result allocated_correctly", result != NULL );
+
+   // set type code
+   (*result)._type = INPUT_FILE_READER_TYPE;
+
+   // open the file
+   (*result).fp = fopen( file_name, "r" );
+
+   (*result).file_name = string_make_from_cstring( file_name );
+   (*result).tokens = s_dlist_make();
+   (*result).line = string_make_n( DEFAULT_LINE_SIZE );
+   (*result).line_number = 0;
+   (*result).is_skip_comments = 0;
+
+   (*result).is_slices = 1;
+   (*result).slices.items = ( ifr_slice_t * ) calloc( DEFAULT_SLICE_CAPACITY, sizeof( ifr_slice_t ) );
+   CHECK( "(*result).slices.items allocated correctly", (*result).slices.items != NULL );
+   (*result).slices.capacity = DEFAULT_SLICE_CAPACITY;
+   (*result).line_tokens = (*result).slices.items;
+
+   // map the whole file if asked to, an empty file cannot be mapped
+   if ( ( is_mapped == 1 ) && ( fstat( fileno( (*result).fp ), &st ) == 0 ) && ( st.st_size > 0 ) )
+   {
+      p = mmap( NULL, st.st_size, PROT_READ, MAP_PRIVATE, fileno( (*result).fp ), 0 );
+   }
+
+   if ( p != MAP_FAILED )
+   {
+      madvise( p, st.st_size, MADV_SEQUENTIAL );
+      (*result).is_mapped = 1;
+      (*result).is_exhausted = 1;
+      (*result).buffer = ( char_t * ) p;
+      (*result).buffer_size = st.st_size;
+      (*result).end = st.st_size;
+   }
+   else
+   {
+      (*result).buffer = ( char_t * ) malloc( DEFAULT_BUFFER_SIZE );
+      CHECK( "(*result).buffer allocated correctly", (*result).buffer != NULL );
+      (*result).buffer_size = DEFAULT_BUFFER_SIZE;
+   }
+
+   MULTITHREAD_MUTEX_INIT( (*result).mutex );
+
+   INVARIANT( result );
+
+   return result;
+}
+
+/**
+   dispose_slices
+
+   free the read buffer or unmap the file of a slice reader
+*/
+
+static
+void
+dispose_slices( ifr_t *ifr )
+{
+   if ( (*ifr).is_mapped == 1 )
+   {
+      munmap( (*ifr).buffer, (*ifr).buffer_size );
+   }
+   else
+   {
+      free( (*ifr).buffer );
+   }
+
+   free( (*ifr).slices.items );
+
+   return;
+}
+
+#define DEFAULT_CHUNK_SIZE ( 1 << 20 )
+#define DEFAULT_BATCH_LINE_CAPACITY 1024
+
+/**
+   take_chunk
+
+   Return a free batch given the next chunk to tokenize, or NULL if every
+   chunk is taken, every batch is in use or reading has not started. Called
+   with the mutex locked.
+*/
+
+static
+batch_t *
+take_chunk( ifr_t *ifr )
+{
+   int32_t i = 0;
+   batch_t *result = NULL;
+
+   if ( ( (*ifr).is_started == 1 ) && ( (*ifr).chunk_next < (*ifr).chunk_count ) )
+   {
+      for ( i = 0; ( i < (*ifr).batch_count ) && ( result == NULL ); i++ )
+      {
+         if ( (*ifr).batches[i].chunk == -1 )
+         {
+            result = &(*ifr).batches[i];
+         }
+      }
+
+      if ( result != NULL )
+      {
+         (*result).chunk = (*ifr).chunk_next;
+         (*result).is_done = 0;
+         (*result).is_skip_comments = (*ifr).is_skip_comments;
+         (*result).slices.count = 0;
+         (*result).line_count = 0;
+         (*ifr).chunk_next = (*ifr).chunk_next + 1;
+      }
+   }
+
+   return result;
+}
+
+/**
+   count_lines
+
+   Return the number of end of lines in a chunk
+*/
+
+static
+int64_t
+count_lines( ifr_t *ifr, int32_t chunk )
+{
+   int64_t result = 0;
+   char_t *p = &(*ifr).buffer[ (*ifr).chunk_starts[chunk] ];
+   char_t *end = &(*ifr).buffer[ (*ifr).chunk_starts[chunk + 1] ];
+
+   p = memchr( p, '\n', end - p );
+   while ( p != NULL )
+   {
+      result = result + 1;
+      p = p + 1;
+      p = ( p < end ) ? memchr( p, '\n', end - p ) : NULL;
+   }
+
+   return result;
+}
+
+/**
+   put_chunk_lines
+
+   Record the number of lines of a chunk, and the first line number of
+   every chunk whose earlier chunks are all counted. Called with the mutex
+   locked.
+*/
+
+static
+void
+put_chunk_lines( ifr_t *ifr, int32_t chunk, int64_t count )
+{
+   (*ifr).chunk_lines[chunk] = count;
+
+   while
+   (
+      ( (*ifr).chunk_counted < (*ifr).chunk_count )
+      &&
+      ( (*ifr).chunk_lines[ (*ifr).chunk_counted ] >= 0 )
+   )
+   {
+      (*ifr).chunk_bases[ (*ifr).chunk_counted ] = (*ifr).line_total;
+      (*ifr).line_total = (*ifr).line_total + (*ifr).chunk_lines[ (*ifr).chunk_counted ];
+      (*ifr).chunk_counted = (*ifr).chunk_counted + 1;
+   }
+
+   return;
+}
+
+/**
+   tokenize_chunk
+
+   Split the chunk of a batch into lines and the lines into token slices,
+   keeping the lines that have tokens
+*/
+
+static
+void
+tokenize_chunk( ifr_t *ifr, batch_t *batch )
+{
+   int32_t first = 0;
+   int64_t n = 0;
+   int64_t line_number = 0;
+   char_t *p = &(*ifr).buffer[ (*ifr).chunk_starts[ (*batch).chunk ] ];
+   char_t *end = &(*ifr).buffer[ (*ifr).chunk_starts[ (*batch).chunk + 1 ] ];
+   char_t *q = NULL;
+   batch_line_t *line = NULL;
+
+   while ( p < end )
+   {
+      q = memchr( p, '\n', end - p );
+      n = ( q != NULL ) ? q - p + 1 : end - p;
+      line_number = line_number + 1;
+
+      first = (*batch).slices.count;
+      get_slice_tokens( &(*batch).slices, (*batch).is_skip_comments, p, n );
+
+      if ( (*batch).slices.count > first )
+      {
+         if ( (*batch).line_count == (*batch).line_capacity )
+         {
+            (*batch).line_capacity = 2 * (*batch).line_capacity;
+            (*batch).lines
+               = ( batch_line_t * ) realloc( (*batch).lines, (*batch).line_capacity * sizeof( batch_line_t ) );
+            CHECK( "(*batch).lines allocated correctly", (*batch).lines != NULL );
+         }
+
+         line = &(*batch).lines[ (*batch).line_count ];
+         (*line).line_number = line_number;
+         (*line).first = first;
+         (*line).count = (*batch).slices.count - first;
+         (*line).line.base = p;
+         (*line).line.count = ( int32_t ) n;
+         (*batch).line_count = (*batch).line_count + 1;
+      }
+
+      p = p + n;
+   }
+
+   return;
+}
+
+/**
+   run_chunk
+
+   count the lines of the chunk of a batch, then tokenize it. Called with
+   the mutex locked, which is released while the chunk is worked on if
+   is_unlocked is 1.
+*/
+
+static
+void
+run_chunk( ifr_t *ifr, batch_t *batch, int32_t is_unlocked )
+{
+   int64_t count = 0;
+
+   if ( is_unlocked == 1 )
+   {
+      UNLOCK( (*ifr).mutex );
+   }
+
+   // the lines are counted first so that line numbers are known early
+   count = count_lines( ifr, (*batch).chunk );
+
+   if ( is_unlocked == 1 )
+   {
+      LOCK( (*ifr).mutex );
+   }
+
+   put_chunk_lines( ifr, (*batch).chunk, count );
+
+   if ( is_unlocked == 1 )
+   {
+      UNLOCK( (*ifr).mutex );
+   }
+
+   tokenize_chunk( ifr, batch );
+
+   if ( is_unlocked == 1 )
+   {
+      LOCK( (*ifr).mutex );
+   }
+
+   (*batch).is_done = 1;
+
+   return;
+}
+
+/**
+   chunk_job
+
+   pool job that counts and tokenizes the chunk of batch index, unless the
+   reader is being disposed
+
+   @param arg the ifr_t instance
+   @param index the batch
+*/
+
+static
+void
+chunk_job( void *arg, int32_t index )
+{
+   ifr_t *ifr = ( ifr_t * ) arg;
+
+   LOCK( (*ifr).mutex );
+
+   if ( (*ifr).quit == 0 )
+   {
+      run_chunk( ifr, &(*ifr).batches[index], 1 );
+      MULTITHREAD_COND_BROADCAST( (*ifr).work_done );
+   }
+
+   UNLOCK( (*ifr).mutex );
+
+   return;
+}
+
+/**
+   feed_pool
+
+   hand every chunk that has a free batch to the pool. Called with the
+   mutex locked.
+*/
+
+static
+void
+feed_pool( ifr_t *ifr )
+{
+   batch_t *batch = take_chunk( ifr );
+
+   while ( batch != NULL )
+   {
+      pool_submit( &(*ifr).pool, chunk_job, ifr, ( int32_t ) ( batch - (*ifr).batches ) );
+      batch = take_chunk( ifr );
+   }
+
+   return;
+}
+
+/**
+   next_batch
+
+   Return the done batch to deliver next, the batch of the next chunk if
+   ordered and any batch whose first line number is known otherwise, or
+   NULL if there is none yet. Called with the mutex locked.
+*/
+
+static
+batch_t *
+next_batch( ifr_t *ifr )
+{
+   int32_t i = 0;
+   batch_t *result = NULL;
+   batch_t *batch = NULL;
+
+   for ( i = 0; ( i < (*ifr).batch_count ) && ( result == NULL ); i++ )
+   {
+      batch = &(*ifr).batches[i];
+
+      if ( ( (*batch).chunk >= 0 ) && ( (*batch).is_done == 1 ) )
+      {
+         if ( (*ifr).is_ordered == 1 )
+         {
+            if ( (*batch).chunk == (*ifr).chunk_delivered )
+            {
+               result = batch;
+            }
+         }
+         else if ( (*batch).chunk < (*ifr).chunk_counted )
+         {
+            result = batch;
+         }
+      }
+   }
+
+   return result;
+}
+
+/**
+   forth_parallel
+
+   Deliver the next line with tokens of a parallel reader from the current
+   batch, moving to the next batch when it is used up. As for a sequential
+   slice reader, the end of file comes with the last line if it has no end
+   of line, and the line number at end of file is one past the last line.
+   Called with the mutex locked.
+*/
+
+static
+void
+forth_parallel( ifr_t *ifr )
+{
+   int32_t is_found = 0;
+   batch_t *batch = NULL;
+   batch_line_t *line = NULL;
+
+   // chunks are tokenized from the first call, after comments are set
+   if ( (*ifr).is_started == 0 )
+   {
+      (*ifr).is_started = 1;
+
+      if ( (*ifr).pool.worker_count > 0 )
+      {
+         feed_pool( ifr );
+      }
+   }
+
+   while ( ( is_found == 0 ) && ( (*ifr).is_at_end == 0 ) )
+   {
+      batch = (*ifr).batch;
+
+      if ( ( batch != NULL ) && ( (*ifr).batch_line < (*batch).line_count ) )
+      {
+         line = &(*batch).lines[ (*ifr).batch_line ];
+         (*ifr).batch_line = (*ifr).batch_line + 1;
+
+         (*ifr).line_tokens = &(*batch).slices.items[ (*line).first ];
+         (*ifr).line_token_count = (*line).count;
+         (*ifr).line_slice = (*line).line;
+         (*ifr).line_number = (*ifr).chunk_bases[ (*batch).chunk ] + (*line).line_number;
+         is_found = 1;
+
+         if
+         (
+            ( (*ifr).batch_line == (*batch).line_count )
+            &&
+            ( (*ifr).chunk_delivered + 1 == (*ifr).chunk_count )
+            &&
+            ( (*line).line.base[ (*line).line.count - 1 ] != '\n' )
+         )
+         {
+            (*ifr).is_at_end = 1;
+         }
+      }
+      else if ( batch != NULL )
+      {
+         // free the used up batch for the workers
+         (*batch).chunk = -1;
+         (*ifr).batch = NULL;
+         (*ifr).chunk_delivered = (*ifr).chunk_delivered + 1;
+
+         if ( (*ifr).pool.worker_count > 0 )
+         {
+            feed_pool( ifr );
+         }
+      }
+      else if ( (*ifr).chunk_delivered == (*ifr).chunk_count )
+      {
+         (*ifr).is_at_end = 1;
+         (*ifr).line_number = (*ifr).line_total + 1;
+      }
+      else
+      {
+         (*ifr).batch = next_batch( ifr );
+         (*ifr).batch_line = 0;
+
+         if ( (*ifr).batch == NULL )
+         {
+            if ( (*ifr).pool.worker_count == 0 )
+            {
+               // no workers, tokenize the next chunk here
+               run_chunk( ifr, take_chunk( ifr ), 0 );
+            }
+            else
+            {
+               MULTITHREAD_COND_WAIT( (*ifr).work_done, (*ifr).mutex );
+            }
+         }
+      }
+   }
+
+   return;
+}
+
+/**
+   make_parallel
+
+   Return a new parallel reader of file_name, with thread_count workers
+*/
+
+static
+ifr_t *
+make_parallel( char_t *file_name, int32_t thread_count, int32_t is_ordered )
+{
+   int32_t i = 0;
+   int64_t n = 0;
+   char_t *p = NULL;
+   ifr_t *result = make_slices( file_name, 1 );
+
+   // a file that cannot be mapped is read whole
+   if ( ( (*result).is_mapped == 0 ) && ( fseek( (*result).fp, 0, SEEK_END ) == 0 ) && ( ftell( (*result).fp ) > 0 ) )
+   {
+      n = ftell( (*result).fp );
+      rewind( (*result).fp );
+      (*result).buffer = ( char_t * ) realloc( (*result).buffer, n );
+      CHECK( "(*result).buffer allocated correctly", (*result).buffer != NULL );
+      (*result).buffer_size = n;
+      (*result).end = ( int64_t ) fread( (*result).buffer, 1, n, (*result).fp );
+      (*result).is_exhausted = 1;
+   }
+
+   (*result).is_parallel = 1;
+   (*result).is_ordered = is_ordered;
+
+   // split the file into chunks that start after an end of line
+   n = (*result).end / DEFAULT_CHUNK_SIZE + 2;
+   (*result).chunk_starts = ( int64_t * ) calloc( n, sizeof( int64_t ) );
+   CHECK( "(*result).chunk_starts allocated correctly", (*result).chunk_starts != NULL );
+
+   (*result).chunk_count = 0;
+   while ( (*result).chunk_starts[ (*result).chunk_count ] < (*result).end )
+   {
+      n = (*result).chunk_starts[ (*result).chunk_count ] + DEFAULT_CHUNK_SIZE;
+      p = NULL;
+
+      if ( n < (*result).end )
+      {
+         p = memchr( &(*result).buffer[n], '\n', (*result).end - n );
+      }
+
+      (*result).chunk_count = (*result).chunk_count + 1;
+      (*result).chunk_starts[ (*result).chunk_count ] = ( p != NULL ) ? p - (*result).buffer + 1 : (*result).end;
+   }
+
+   (*result).chunk_lines = ( int64_t * ) calloc( (*result).chunk_count + 1, sizeof( int64_t ) );
+   CHECK( "(*result).chunk_lines allocated correctly", (*result).chunk_lines != NULL );
+   (*result).chunk_bases = ( int64_t * ) calloc( (*result).chunk_count + 1, sizeof( int64_t ) );
+   CHECK( "(*result).chunk_bases allocated correctly", (*result).chunk_bases != NULL );
+
+   for ( i = 0; i < (*result).chunk_count; i++ )
+   {
+      (*result).chunk_lines[i] = -1;
+   }
+
+   // two batches per worker keep the workers busy while one is delivered
+   (*result).batch_count = ( thread_count > 0 ) ? 2 * thread_count : 1;
+   (*result).batches = ( batch_t * ) calloc( (*result).batch_count, sizeof( batch_t ) );
+   CHECK( "(*result).batches allocated correctly", (*result).batches != NULL );
+
+   for ( i = 0; i < (*result).batch_count; i++ )
+   {
+      (*result).batches[i].chunk = -1;
+      (*result).batches[i].slices.items = ( ifr_slice_t * ) calloc( DEFAULT_SLICE_CAPACITY, sizeof( ifr_slice_t ) );
+      CHECK( "slices allocated correctly", (*result).batches[i].slices.items != NULL );
+      (*result).batches[i].slices.capacity = DEFAULT_SLICE_CAPACITY;
+      (*result).batches[i].lines = ( batch_line_t * ) calloc( DEFAULT_BATCH_LINE_CAPACITY, sizeof( batch_line_t ) );
+      CHECK( "lines allocated correctly", (*result).batches[i].lines != NULL );
+      (*result).batches[i].line_capacity = DEFAULT_BATCH_LINE_CAPACITY;
+   }
+
+   MULTITHREAD_COND_INIT( (*result).work_done );
+
+   pool_start( &(*result).pool, thread_count );
+
+   INVARIANT( result );
+
+   return result;
+}
+
+/**
+   dispose_parallel
+
+   stop and join the workers of a parallel reader and free its chunks and
+   batches. Called with the mutex locked, which is released while the
+   workers finish.
+*/
+
+static
+void
+dispose_parallel( ifr_t *ifr )
+{
+   int32_t i = 0;
+
+   // the chunks still queued are skipped
+   (*ifr).quit = 1;
 
-            // now parsing a token
-            token_flag = 1;
-         }
-         // append c to the end of the token
-         string_append_character( t, c );
-      }
+   UNLOCK( (*ifr).mutex );
+   pool_stop( &(*ifr).pool );
+   LOCK( (*ifr).mutex );
 
-   }
+   MULTITHREAD_COND_DESTROY( (*ifr).work_done );
 
-   // at end of line and parsing a token
-   if ( token_flag == 1 )
+   for ( i = 0; i < (*ifr).batch_count; i++ )
    {
-      // finish the token, put the token in the list
-      s_dlist_put_last( list, t );
-      t = NULL;
+      free( (*ifr).batches[i].slices.items );
+      free( (*ifr).batches[i].lines );
    }
 
-}
+   free( (*ifr).batches );
+   free( (*ifr).chunk_starts );
+   free( (*ifr).chunk_lines );
+   free( (*ifr).chunk_bases );
 
-#define DEFAULT_LINE_SIZE 120
+   return;
+}
 
 /**
    ifr_make
@@ -324,6 +1249,100 @@ ifr_make_cstring( char_t *file_name )
    return result;
 }
 
+/**
+   ifr_make_slices
+*/
+
+ifr_t *
+ifr_make_slices( string_t *file_name )
+{
+   PRECONDITION( "file_name not null", file_name != NULL );
+   PRECONDITION( "file exists", file_exists( file_name ) == 1 );
+
+   ifr_t *result = make_slices( string_as_cstring( file_name ), 0 );
+
+   return result;
+}
+
+/**
+   ifr_make_slices_cstring
+*/
+
+ifr_t *
+ifr_make_slices_cstring( char_t *file_name )
+{
+   PRECONDITION( "file_name not null", file_name != NULL );
+   PRECONDITION( "file exists", file_exists_cstring( file_name ) == 1 );
+
+   ifr_t *result = make_slices( file_name, 0 );
+
+   return result;
+}
+
+/**
+   ifr_make_mmap
+*/
+
+ifr_t *
+ifr_make_mmap( string_t *file_name )
+{
+   PRECONDITION( "file_name not null", file_name != NULL );
+   PRECONDITION( "file exists", file_exists( file_name ) == 1 );
+
+   ifr_t *result = make_slices( string_as_cstring( file_name ), 1 );
+
+   return result;
+}
+
+/**
+   ifr_make_mmap_cstring
+*/
+
+ifr_t *
+ifr_make_mmap_cstring( char_t *file_name )
+{
+   PRECONDITION( "file_name not null", file_name != NULL );
+   PRECONDITION( "file exists", file_exists_cstring( file_name ) == 1 );
+
+   ifr_t *result = make_slices( file_name, 1 );
+
+   return result;
+}
+
+/**
+   ifr_make_parallel
+*/
+
+ifr_t *
+ifr_make_parallel( string_t *file_name, int32_t thread_count, int32_t is_ordered )
+{
+   PRECONDITION( "file_name not null", file_name != NULL );
+   PRECONDITION( "file exists", file_exists( file_name ) == 1 );
+   PRECONDITION( "thread_count ok", thread_count >= 0 );
+   PRECONDITION( "is_ordered ok", ( is_ordered == 0 ) || ( is_ordered == 1 ) );
+
+   ifr_t *result = make_parallel( string_as_cstring( file_name ), thread_count, is_ordered );
+
+   return result;
+}
+
+/**
+   ifr_make_parallel_cstring
+*/
+
+ifr_t *
+ifr_make_parallel_cstring( char_t *file_name, int32_t thread_count, int32_t is_ordered )
+{
+   PRECONDITION( "file_name not null", file_name != NULL );
+   PRECONDITION( "file exists", file_exists_cstring( file_name ) == 1 );
+   PRECONDITION( "thread_count ok", thread_count >= 0 );
+   PRECONDITION( "is_ordered ok", ( is_ordered == 0 ) || ( is_ordered == 1 ) );
+
+   ifr_t *result = make_parallel( file_name, thread_count, is_ordered );
+
+   return result;
+}
+
 /**
    ifr_clone
 */
@@ -333,6 +1352,7 @@ ifr_clone( ifr_t *current )
 {
    PRECONDITION( "ifr not null", current != NULL );
    PRECONDITION( "current type OK", (*current)._type == INPUT_FILE_READER_TYPE );
+   PRECONDITION( "current not slices", (*current).is_slices == 0 );
 
    // allocate ifr struct
    ifr_t * result = ( ifr_t * ) calloc( 1, sizeof( ifr_t ) );
@@ -371,6 +1391,7 @@ ifr_deep_clone( ifr_t *current )
 {
    PRECONDITION( "ifr not null", current != NULL );
    PRECONDITION( "current type OK", (*current)._type == INPUT_FILE_READER_TYPE );
+   PRECONDITION( "current not slices", (*current).is_slices == 0 );
 
    // allocate ifr struct
    ifr_t * result = ( ifr_t * ) calloc( 1, sizeof( ifr_t ) );
@@ -537,6 +1558,8 @@ ifr_copy( ifr_t *current, ifr_t *other )
    PRECONDITION( "current type OK", (*current)._type == INPUT_FILE_READER_TYPE );
    PRECONDITION( "other not null", other != NULL );
    PRECONDITION( "other type OK", (*other)._type == INPUT_FILE_READER_TYPE );
+   PRECONDITION( "current not slices", (*current).is_slices == 0 );
+   PRECONDITION( "other not slices", (*other).is_slices == 0 );
 
    INVARIANT( current );
    INVARIANT( other );
@@ -575,6 +1598,8 @@ ifr_deep_copy( ifr_t *current, ifr_t *other )
    PRECONDITION( "current type OK", (*current)._type == INPUT_FILE_READER_TYPE );
    PRECONDITION( "other not null", other != NULL );
    PRECONDITION( "other type OK", (*other)._type == INPUT_FILE_READER_TYPE );
+   PRECONDITION( "current not slices", (*current).is_slices == 0 );
+   PRECONDITION( "other not slices", (*other).is_slices == 0 );
 
    INVARIANT( current );
    INVARIANT( other );
@@ -620,6 +1645,16 @@ ifr_dispose( ifr_t **ifr )
    s_dlist_dispose( &(**ifr).tokens );
    string_dispose( &(**ifr).line );
 
+   if ( (**ifr).is_parallel == 1 )
+   {
+      dispose_parallel( *ifr );
+   }
+
+   if ( (**ifr).is_slices == 1 )
+   {
+      dispose_slices( *ifr );
+   }
+
    // close the file
    fclose( (**ifr).fp );
 
@@ -652,6 +1687,16 @@ ifr_deep_dispose( ifr_t **ifr )
    s_dlist_deep_dispose( &(**ifr).tokens );
    string_deep_dispose( &(**ifr).line );
 
+   if ( (**ifr).is_parallel == 1 )
+   {
+      dispose_parallel( *ifr );
+   }
+
+   if ( (**ifr).is_slices == 1 )
+   {
+      dispose_slices( *ifr );
+   }
+
    // close the file
    fclose( (**ifr).fp );
 
@@ -706,19 +1751,103 @@ ifr_line( ifr_t *ifr )
    return( result );
 }
 
+/**
+   ifr_slices
+*/
+
+ifr_slice_t *
+ifr_slices( ifr_t *ifr )
+{
+   PRECONDITION( "ifr not null", ifr != NULL );
+   PRECONDITION( "ifr type OK", (*ifr)._type == INPUT_FILE_READER_TYPE );
+   PRECONDITION( "ifr is slices", (*ifr).is_slices == 1 );
+   LOCK( (*ifr).mutex );
+   INVARIANT( ifr );
+
+   ifr_slice_t *result = (*ifr).line_tokens;
+
+   INVARIANT( ifr );
+   UNLOCK( (*ifr).mutex );
+
+   return( result );
+}
+
+/**
+   ifr_slice_count
+*/
+
+int32_t
+ifr_slice_count( ifr_t *ifr )
+{
+   PRECONDITION( "ifr not null", ifr != NULL );
+   PRECONDITION( "ifr type OK", (*ifr)._type == INPUT_FILE_READER_TYPE );
+   PRECONDITION( "ifr is slices", (*ifr).is_slices == 1 );
+   LOCK( (*ifr).mutex );
+   INVARIANT( ifr );
+
+   int32_t result = (*ifr).line_token_count;
+
+   INVARIANT( ifr );
+   UNLOCK( (*ifr).mutex );
+
+   return( result );
+}
+
+/**
+   ifr_line_slice
+*/
+
+ifr_slice_t
+ifr_line_slice( ifr_t *ifr )
+{
+   PRECONDITION( "ifr not null", ifr != NULL );
+   PRECONDITION( "ifr type OK", (*ifr)._type == INPUT_FILE_READER_TYPE );
+   PRECONDITION( "ifr is slices", (*ifr).is_slices == 1 );
+   LOCK( (*ifr).mutex );
+   INVARIANT( ifr );
+
+   ifr_slice_t result = (*ifr).line_slice;
+
+   INVARIANT( ifr );
+   UNLOCK( (*ifr).mutex );
+
+   return( result );
+}
+
 /**
    ifr_line_number
 */
 
 int32_t
 ifr_line_number( ifr_t *ifr )
+{
+   PRECONDITION( "ifr not null", ifr != NULL );
+   PRECONDITION( "ifr type OK", (*ifr)._type == INPUT_FILE_READER_TYPE );
+   LOCK( (*ifr).mutex );
+   PRECONDITION( "line number fits", (*ifr).line_number <= INT32_MAX );
+   INVARIANT( ifr );
+
+   int32_t result = ( int32_t ) (*ifr).line_number;
+
+   INVARIANT( ifr );
+   UNLOCK( (*ifr).mutex );
+
+   return( result );
+}
+
+/**
+   ifr_line_number_64
+*/
+
+int64_t
+ifr_line_number_64( ifr_t *ifr )
 {
    PRECONDITION( "ifr not null", ifr != NULL );
    PRECONDITION( "ifr type OK", (*ifr)._type == INPUT_FILE_READER_TYPE );
    LOCK( (*ifr).mutex );
    INVARIANT( ifr );
 
-   int32_t result = (*ifr).line_number;
+   int64_t result = (*ifr).line_number;
 
    INVARIANT( ifr );
    UNLOCK( (*ifr).mutex );
@@ -758,7 +1887,16 @@ ifr_eof( ifr_t *ifr )
    LOCK( (*ifr).mutex );
    INVARIANT( ifr );
 
-   int32_t result = feof( (*ifr).fp );
+   int32_t result = 0;
+
+   if ( (*ifr).is_slices == 1 )
+   {
+      result = (*ifr).is_at_end;
+   }
+   else
+   {
+      result = feof( (*ifr).fp );
+   }
 
    INVARIANT( ifr );
    UNLOCK( (*ifr).mutex );
@@ -786,6 +1924,46 @@ ifr_is_skip_comments( ifr_t *ifr )
    return( result );
 }
 
+/**
+   ifr_is_slices
+*/
+
+int32_t
+ifr_is_slices( ifr_t *ifr )
+{
+   PRECONDITION( "ifr not null", ifr != NULL );
+   PRECONDITION( "ifr type OK", (*ifr)._type == INPUT_FILE_READER_TYPE );
+   LOCK( (*ifr).mutex );
+   INVARIANT( ifr );
+
+   int32_t result = (*ifr).is_slices;
+
+   INVARIANT( ifr );
+   UNLOCK( (*ifr).mutex );
+
+   return( result );
+}
+
+/**
+   ifr_is_parallel
+*/
+
+int32_t
+ifr_is_parallel( ifr_t *ifr )
+{
+   PRECONDITION( "ifr not null", ifr != NULL );
+   PRECONDITION( "ifr type OK", (*ifr)._type == INPUT_FILE_READER_TYPE );
+   LOCK( (*ifr).mutex );
+   INVARIANT( ifr );
+
+   int32_t result = (*ifr).is_parallel;
+
+   INVARIANT( ifr );
+   UNLOCK( (*ifr).mutex );
+
+   return( result );
+}
+
 /**
    ifr_put_is_skip_comments
 */
@@ -815,6 +1993,7 @@ ifr_forth( ifr_t *ifr )
 {
    PRECONDITION( "ifr not null", ifr != NULL );
    PRECONDITION( "ifr type OK", (*ifr)._type == INPUT_FILE_READER_TYPE );
+   PRECONDITION( "ifr not slices", (*ifr).is_slices == 0 );
    LOCK( (*ifr).mutex );
    INVARIANT( ifr );
 
@@ -916,6 +2095,68 @@ ifr_forth( ifr_t *ifr )
    return;
 }
 
+/**
+   ifr_forth_slices
+*/
+
+void
+ifr_forth_slices( ifr_t *ifr )
+{
+   PRECONDITION( "ifr not null", ifr != NULL );
+   PRECONDITION( "ifr type OK", (*ifr)._type == INPUT_FILE_READER_TYPE );
+   PRECONDITION( "ifr is slices", (*ifr).is_slices == 1 );
+   LOCK( (*ifr).mutex );
+   INVARIANT( ifr );
+
+   char_t *line = NULL;
+   int64_t count = 0;
+
+   // clear out slices and line
+   (*ifr).slices.count = 0;
+   (*ifr).line_tokens = (*ifr).slices.items;
+   (*ifr).line_token_count = 0;
+   (*ifr).line_slice.base = NULL;
+   (*ifr).line_slice.count = 0;
+
+   if ( (*ifr).is_parallel == 1 )
+   {
+      forth_parallel( ifr );
+   }
+   else
+   {
+      // keep getting lines to skip blank and comment lines
+      // return non empty slices or at eof
+      while ( ( (*ifr).is_at_end == 0 ) && ( (*ifr).slices.count == 0 ) )
+      {
+         // get the next line, counted even at end of file as by ifr_forth
+         (*ifr).line_number = (*ifr).line_number + 1;
+
+         if ( get_slice_line( ifr, &line, &count ) == 1 )
+         {
+            (*ifr).line_slice.base = line;
+            (*ifr).line_slice.count = ( int32_t ) count;
+
+            // parse the line into token slices, dropping comments
+            get_slice_tokens( &(*ifr).slices, (*ifr).is_skip_comments, line, count );
+         }
+         else
+         {
+            (*ifr).line_slice.base = NULL;
+            (*ifr).line_slice.count = 0;
+         }
+      }
+
+      // the slices may have been moved by a realloc while scanning
+      (*ifr).line_tokens = (*ifr).slices.items;
+      (*ifr).line_token_count = (*ifr).slices.count;
+   }
+
+   INVARIANT( ifr );
+   UNLOCK( (*ifr).mutex );
+
+   return;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -34,6 +34,17 @@
  Function declarations for the opaque ifr_t type.
  Parses a text file line by line into tokens
 
+ A reader made with ifr_make_slices or ifr_make_mmap is processed with
+ ifr_forth_slices instead of ifr_forth. Its tokens are slices of a reusable
+ read buffer or of the mapped file, found in one scan of each line that
+ also drops comments, so that no memory is allocated per line or token.
+
+ A reader made with ifr_make_parallel is a slice reader that maps the file,
+ splits it into chunks that start after an end of line, and tokenizes the
+ chunks on worker threads. ifr_forth_slices delivers the lines of each
+ chunk in turn, with their line numbers in the file, taking the chunks in
+ order or, if asked, in the order they finish.
+
 */
 
 #ifndef INPUT_FILE_READER_H
@@ -79,6 +90,19 @@ struct input_file_reader_struct;
 
 typedef struct input_file_reader_struct ifr_t;
 
+/**
+   ifr_slice_t
+
+   a token or line of a slice reader - the address of its first character
+   and its number of characters. It is not null terminated.
+*/
+
+typedef struct
+{
+   char_t *base;
+   int32_t count;
+} ifr_slice_t;
+
 
 /*
    Initialization
@@ -106,6 +130,96 @@ ifr_t *ifr_make( string_t *file_name );
 */
 ifr_t *ifr_make_cstring( char_t *file_name );
 
+/**
+   ifr_make_slices
+
+   Return a new input_file_reader_t instance focused on "file_name" that
+   reads the file in large blocks into a reusable buffer and is processed
+   with ifr_forth_slices. First line is NOT processed.
+
+   @param  file_name fully qualified file name as a string_t
+   @return input_file_reader_t instance
+*/
+ifr_t *ifr_make_slices( string_t *file_name );
+
+/**
+   ifr_make_slices_cstring
+
+   Return a new input_file_reader_t instance focused on "file_name" that
+   reads the file in large blocks into a reusable buffer and is processed
+   with ifr_forth_slices. First line is NOT processed.
+
+   @param  file_name fully qualified file name as a C character string
+   @return input_file_reader_t instance
+*/
+ifr_t *ifr_make_slices_cstring( char_t *file_name );
+
+/**
+   ifr_make_mmap
+
+   Return a new input_file_reader_t instance focused on "file_name" that
+   maps the file into memory and is processed with ifr_forth_slices. Reads
+   into a reusable buffer if the file cannot be mapped. First line is NOT
+   processed.
+
+   @param  file_name fully qualified file name as a string_t
+   @return input_file_reader_t instance
+*/
+ifr_t *ifr_make_mmap( string_t *file_name );
+
+/**
+   ifr_make_mmap_cstring
+
+   Return a new input_file_reader_t instance focused on "file_name" that
+   maps the file into memory and is processed with ifr_forth_slices. Reads
+   into a reusable buffer if the file cannot be mapped. First line is NOT
+   processed.
+
+   @param  file_name fully qualified file name as a C character string
+   @return input_file_reader_t instance
+*/
+ifr_t *ifr_make_mmap_cstring( char_t *file_name );
+
+/**
+   ifr_make_parallel
+
+   Return a new input_file_reader_t instance focused on "file_name" that
+   maps the file into memory, or reads it whole if it cannot be mapped, and
+   tokenizes it in chunks on thread_count worker threads. Processed with
+   ifr_forth_slices. If is_ordered is 0, the lines of a chunk are delivered
+   together and in order, but the chunks are delivered as they finish.
+   Comments are skipped as set when ifr_forth_slices is first called. First
+   line is NOT processed.
+
+   @param  file_name fully qualified file name as a string_t
+   @param  thread_count number of worker threads, 0 to tokenize on the
+           calling thread
+   @param  is_ordered 1 to deliver the lines in file order, 0 otherwise
+   @return input_file_reader_t instance
+*/
+ifr_t *
+ifr_make_parallel( string_t *file_name, int32_t thread_count, int32_t is_ordered );
+
+/**
+   ifr_make_parallel_cstring
+
+   Return a new input_file_reader_t instance focused on "file_name" that
+   maps the file into memory, or reads it whole if it cannot be mapped, and
+   tokenizes it in chunks on thread_count worker threads. Processed with
+   ifr_forth_slices. If is_ordered is 0, the lines of a chunk are delivered
+   together and in order, but the chunks are delivered as they finish.
+   Comments are skipped as set when ifr_forth_slices is first called. First
+   line is NOT processed.
+
+   @param  file_name fully qualified file name as a C character string
+   @param  thread_count number of worker threads, 0 to tokenize on the
+           calling thread
+   @param  is_ordered 1 to deliver the lines in file order, 0 otherwise
+   @return input_file_reader_t instance
+*/
+ifr_t *
+ifr_make_parallel_cstring( char_t *file_name, int32_t thread_count, int32_t is_ordered );
+
 /*
    Basic
 */
@@ -113,7 +227,8 @@ ifr_t *ifr_make_cstring( char_t *file_name );
 /**
    ifr_clone
 
-   Create and initialize a clone of a ifr_t instance.
+   Create and initialize a clone of a ifr_t instance. Not for a slice
+   reader.
 
    @param current the ifr_t instance to initialize from
    @return pointer to the new data structure
@@ -124,7 +239,8 @@ ifr_clone( ifr_t *current );
 /**
    ifr_deep_clone
 
-   Create and initialize a deep clone of a ifr_t instance.
+   Create and initialize a deep clone of a ifr_t instance. Not for a slice
+   reader.
 
    @param current the ifr_t instance to initialize from
    @return pointer to the new data structure
@@ -157,7 +273,7 @@ int32_t ifr_is_deep_equal( ifr_t *current, ifr_t *other );
 /**
    ifr_copy
 
-   Puts contents of other into current
+   Puts contents of other into current. Not for slice readers.
 
    @param current the ifr_t instance to copy into
    @param other the ifr_t to copy from
@@ -167,7 +283,7 @@ void ifr_copy( ifr_t *current, ifr_t *other );
 /**
    ifr_deep_copy
 
-   Puts contents of other into current
+   Puts contents of other into current. Not for slice readers.
 
    @param current the ifr_t instance to copy into
    @param other the ifr_t to copy from
@@ -224,17 +340,65 @@ s_dlist_t *ifr_tokens( ifr_t *ifr );
 */
 string_t *ifr_line( ifr_t *ifr );
 
+/**
+   ifr_slices
+
+   Return the token slices of the most recently processed line of a slice
+   reader, ifr_slice_count of them. Slices are valid until next call of
+   ifr_forth_slices or dispose on ifr instance.
+
+   @param  ifr ifr_t instance
+   @return array of token slices
+*/
+ifr_slice_t *ifr_slices( ifr_t *ifr );
+
+/**
+   ifr_slice_count
+
+   Return the number of token slices of the most recently processed line
+   of a slice reader.
+
+   @param  ifr ifr_t instance
+   @return number of token slices
+*/
+int32_t ifr_slice_count( ifr_t *ifr );
+
+/**
+   ifr_line_slice
+
+   Return the most recently processed line of a slice reader, including
+   its end of line characters. The slice is valid until next call of
+   ifr_forth_slices or dispose on ifr instance.
+
+   @param  ifr ifr_t instance
+   @return last line processed
+*/
+ifr_slice_t ifr_line_slice( ifr_t *ifr );
+
 /**
    ifr_line_number
 
    Return the number of the most recently processed line.
    Line number is valid until next call of forth or dispose on ifr instance.
+   The line number must fit in an int32_t, use ifr_line_number_64 for
+   files of more lines.
 
    @param  ifr ifr_t instance
    @return number of last line processed
 */
 int32_t ifr_line_number( ifr_t *ifr );
 
+/**
+   ifr_line_number_64
+
+   Return the number of the most recently processed line, of any size.
+   Line number is valid until next call of forth or dispose on ifr instance.
+
+   @param  ifr ifr_t instance
+   @return number of last line processed
+*/
+int64_t ifr_line_number_64( ifr_t *ifr );
+
 /**
    ifr_file_name
    Return the file_name being processed.
@@ -269,6 +433,28 @@ int32_t ifr_eof( ifr_t *ifr );
 */
 int32_t ifr_is_skip_comments( ifr_t *ifr );
 
+/**
+   ifr_is_slices
+
+   Return 1 if ifr is a slice reader, made with ifr_make_slices,
+   ifr_make_mmap or ifr_make_parallel, 0 otherwise
+
+   @param  ifr ifr_t instance
+   @return 1 if slice reader, 0 otherwise
+*/
+int32_t ifr_is_slices( ifr_t *ifr );
+
+/**
+   ifr_is_parallel
+
+   Return 1 if ifr is a parallel reader, made with ifr_make_parallel, 0
+   otherwise
+
+   @param  ifr ifr_t instance
+   @return 1 if parallel reader, 0 otherwise
+*/
+int32_t ifr_is_parallel( ifr_t *ifr );
+
 
 /*
    Element Change
@@ -292,12 +478,24 @@ void ifr_put_is_skip_comments( ifr_t *ifr, int32_t flag );
 /**
    ifr_forth
 
-   processes next line of input file, results accesed by tokens and line
+   processes next line of input file, results accesed by tokens and line.
+   Not for a slice reader.
 
    @param  ifr ifr_t instance
 */
 void ifr_forth( ifr_t *ifr );
 
+/**
+   ifr_forth_slices
+
+   processes next line of input file of a slice reader, results accessed
+   by slices, slice_count and line_slice. Blank lines, and comment lines
+   if comments are skipped, are passed over as by ifr_forth.
+
+   @param  ifr ifr_t instance
+*/
+void ifr_forth_slices( ifr_t *ifr );
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,990 @@
+/**
+ @file Lsqline_multi.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "Lsqlines of many series"
+
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0):
+
+ 1. Permission is hereby granted to use, copy, modify and/or
+    distribute this package, provided that:
+       * copyright notices are retained unchanged,
+       * any distribution of this package, whether modified or not,
+         includes this license text.
+ 2. Permission is hereby also granted to distribute binary programs
+    which depend on this package. If the binary program depends on a
+    modified version of this package, you are encouraged to publicly
+    release the modified version of this package.
+
+ THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT WARRANTY. ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE AUTHORS BE LIABLE TO ANY PARTY FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES ARISING IN ANY WAY OUT OF THE USE OF THIS PACKAGE.
+
+
+ @section Description
+
+ Function definitions for the opaque lsqline_multi_t type.
+
+ The windows of all the series are held in one ring of window rows, each
+ row holding the x or y values of one point of every series. The running
+ sums are held as five arrays indexed by series: the x mean, the y mean,
+ and the centered sums of x squared, y squared and x times y. The arrays
+ are padded to a multiple of LANE_COUNT series, and each put works through
+ them LANE_COUNT series at a time in fixed length loops over local
+ copies, which the compiler turns into SIMD instructions.
+
+*/
+
+#include "Lsqline_multi.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <string.h>
+#include <stdlib.h>
+#ifdef MULTITHREADED
+#include MULTITHREAD_INCLUDE
+#endif
+
+#include "dbc.h"
+
+/**
+   defines
+*/
+
+/**
+   LANE_COUNT - the number of series updated together
+*/
+
+#define LANE_COUNT 8
+
+/**
+   indices of the sum arrays
+*/
+
+#define X_MEAN 0
+#define Y_MEAN 1
+#define X_SS 2
+#define Y_SS 3
+#define XY_SS 4
+#define SUM_COUNT 5
+
+/**
+   Lsqline_multi structure
+*/
+
+struct lsqline_multi_struct
+{
+   int32_t _type;
+
+   int32_t series_count;
+   int32_t padded_count;
+   int32_t window;
+   int32_t index;
+   int32_t count;
+   int32_t is_float64;
+
+   // ring of window rows of padded_count values
+   float32_t *x;
+   float32_t *y;
+
+   // the new row, padded
+   float32_t *x_new;
+   float32_t *y_new;
+
+   // SUM_COUNT arrays of padded_count sums, one of these is NULL
+   float32_t *f_sums;
+   float64_t *d_sums;
+
+   int32_t *is_output_valid;
+
+   float32_t *slope;
+   float32_t *y_intercept;
+   float32_t *fit;
+};
+
+/**
+   Invariant
+*/
+
+#if INVARIANT_CONDITIONAL != 0
+
+static
+int32_t
+storage_not_null( lsqline_multi_t *p )
+{
+   int32_t result = 1;
+
+   if (
+      ( (*p).x == NULL )
+      ||
+      ( (*p).y == NULL )
+      ||
+      ( (*p).x_new == NULL )
+      ||
+      ( (*p).y_new == NULL )
+      ||
+      ( ( (*p).f_sums == NULL ) && ( (*p).d_sums == NULL ) )
+   )
+   {
+      result = 0;
+   }
+
+   return result;
+}
+
+static
+int32_t
+count_ok( lsqline_multi_t *p )
+{
+   int32_t result = 1;
+
+   result = ( ( (*p).count >= 0 ) && ( (*p).count <= (*p).window ) );
+
+   return result;
+}
+
+static
+int32_t
+index_ok( lsqline_multi_t *p )
+{
+   int32_t result = 1;
+
+   result = ( ( (*p).index >= 0 ) && ( (*p).index < (*p).window ) );
+
+   return result;
+}
+
+static
+void invariant( lsqline_multi_t *p )
+{
+   assert( ( ( void ) "storage_not_null", storage_not_null( p ) ) );
+   assert( ( ( void ) "count_ok", count_ok( p ) ) );
+   assert( ( ( void ) "index_ok", index_ok( p ) ) );
+   return;
+}
+
+#endif
+
+/**
+   make
+
+   allocate a new instance with float32_t or float64_t sums
+*/
+
+static
+lsqline_multi_t *
+make( int32_t series_count, int32_t window, int32_t is_float64 )
+{
+   int32_t padded_count = 0;
+
+   // allocate Lsqline_multi struct
+   lsqline_multi_t * result
+      = ( lsqline_multi_t * ) calloc( 1, sizeof( lsqline_multi_t ) );
+   CHECK( "result allocated correctly", result != NULL );
+
+   padded_count = ( ( series_count + LANE_COUNT - 1 ) / LANE_COUNT ) * LANE_COUNT;
+
+   // set type
+   (*result)._type = LSQLINE_MULTI_TYPE;
+
+   // set sizes
+   (*result).series_count = series_count;
+   (*result).padded_count = padded_count;
+   (*result).window = window;
+   (*result).is_float64 = is_float64;
+
+   // set index and count
+   (*result).index = 0;
+   (*result).count = 0;
+
+   // allocate storage
+   (*result).x = ( float32_t * ) calloc( window * padded_count, sizeof( float32_t ) );
+   CHECK( "(*result).x allocated correctly", (*result).x != NULL );
+
+   (*result).y = ( float32_t * ) calloc( window * padded_count, sizeof( float32_t ) );
+   CHECK( "(*result).y allocated correctly", (*result).y != NULL );
+
+   (*result).x_new = ( float32_t * ) calloc( padded_count, sizeof( float32_t ) );
+   CHECK( "(*result).x_new allocated correctly", (*result).x_new != NULL );
+
+   (*result).y_new = ( float32_t * ) calloc( padded_count, sizeof( float32_t ) );
+   CHECK( "(*result).y_new allocated correctly", (*result).y_new != NULL );
+
+   if ( is_float64 == 1 )
+   {
+      (*result).d_sums = ( float64_t * ) calloc( SUM_COUNT * padded_count, sizeof( float64_t ) );
+      CHECK( "(*result).d_sums allocated correctly", (*result).d_sums != NULL );
+   }
+   else
+   {
+      (*result).f_sums = ( float32_t * ) calloc( SUM_COUNT * padded_count, sizeof( float32_t ) );
+      CHECK( "(*result).f_sums allocated correctly", (*result).f_sums != NULL );
+   }
+
+   (*result).is_output_valid = ( int32_t * ) calloc( series_count, sizeof( int32_t ) );
+   CHECK( "(*result).is_output_valid allocated correctly", (*result).is_output_valid != NULL );
+
+   (*result).slope = ( float32_t * ) calloc( series_count, sizeof( float32_t ) );
+   CHECK( "(*result).slope allocated correctly", (*result).slope != NULL );
+
+   (*result).y_intercept = ( float32_t * ) calloc( series_count, sizeof( float32_t ) );
+   CHECK( "(*result).y_intercept allocated correctly", (*result).y_intercept != NULL );
+
+   (*result).fit = ( float32_t * ) calloc( series_count, sizeof( float32_t ) );
+   CHECK( "(*result).fit allocated correctly", (*result).fit != NULL );
+
+   return result;
+}
+
+/**
+   put_f32
+
+   add the point in x_new, y_new to the float32_t sums of every series,
+   replacing the point in xo, yo if the window is full
+*/
+
+static
+void
+put_f32( lsqline_multi_t *current, float32_t *xo, float32_t *yo )
+{
+   int32_t i = 0;
+   int32_t k = 0;
+   int32_t n = (*current).padded_count;
+   int32_t is_full = ( (*current).count == (*current).window );
+   float32_t *sums = (*current).f_sums;
+   float32_t n_inverse = 0.0;
+   float32_t xn[LANE_COUNT];
+   float32_t yn[LANE_COUNT];
+   float32_t x_old[LANE_COUNT];
+   float32_t y_old[LANE_COUNT];
+   float32_t mx[LANE_COUNT];
+   float32_t my[LANE_COUNT];
+   float32_t sxx[LANE_COUNT];
+   float32_t syy[LANE_COUNT];
+   float32_t sxy[LANE_COUNT];
+   float32_t mx1[LANE_COUNT];
+   float32_t my1[LANE_COUNT];
+
+   if ( is_full == 1 )
+   {
+      n_inverse = 1.0f / ( float32_t ) (*current).window;
+   }
+   else
+   {
+      n_inverse = 1.0f / ( float32_t ) ( (*current).count + 1 );
+   }
+
+   for ( i = 0; i < n; i = i + LANE_COUNT )
+   {
+      memcpy( xn, &(*current).x_new[i], sizeof( xn ) );
+      memcpy( yn, &(*current).y_new[i], sizeof( yn ) );
+      memcpy( x_old, &xo[i], sizeof( x_old ) );
+      memcpy( y_old, &yo[i], sizeof( y_old ) );
+      memcpy( mx, &sums[X_MEAN * n + i], sizeof( mx ) );
+      memcpy( my, &sums[Y_MEAN * n + i], sizeof( my ) );
+      memcpy( sxx, &sums[X_SS * n + i], sizeof( sxx ) );
+      memcpy( syy, &sums[Y_SS * n + i], sizeof( syy ) );
+      memcpy( sxy, &sums[XY_SS * n + i], sizeof( sxy ) );
+
+      if ( is_full == 1 )
+      {
+         // replace the oldest point, the count stays the same
+         for ( k = 0; k < LANE_COUNT; k++ )
+         {
+            mx1[k] = mx[k] + ( xn[k] - x_old[k] ) * n_inverse;
+            my1[k] = my[k] + ( yn[k] - y_old[k] ) * n_inverse;
+            sxx[k] = sxx[k] + ( xn[k] - x_old[k] ) * ( xn[k] - mx1[k] + x_old[k] - mx[k] );
+            syy[k] = syy[k] + ( yn[k] - y_old[k] ) * ( yn[k] - my1[k] + y_old[k] - my[k] );
+            sxy[k] = sxy[k] + ( xn[k] - mx[k] ) * ( yn[k] - my1[k] ) - ( x_old[k] - mx[k] ) * ( y_old[k] - my1[k] );
+         }
+      }
+      else
+      {
+         // add a point, Welford's update
+         for ( k = 0; k < LANE_COUNT; k++ )
+         {
+            mx1[k] = mx[k] + ( xn[k] - mx[k] ) * n_inverse;
+            my1[k] = my[k] + ( yn[k] - my[k] ) * n_inverse;
+            sxx[k] = sxx[k] + ( xn[k] - mx[k] ) * ( xn[k] - mx1[k] );
+            syy[k] = syy[k] + ( yn[k] - my[k] ) * ( yn[k] - my1[k] );
+            sxy[k] = sxy[k] + ( xn[k] - mx[k] ) * ( yn[k] - my1[k] );
+         }
+      }
+
+      memcpy( &sums[X_MEAN * n + i], mx1, sizeof( mx1 ) );
+      memcpy( &sums[Y_MEAN * n + i], my1, sizeof( my1 ) );
+      memcpy( &sums[X_SS * n + i], sxx, sizeof( sxx ) );
+      memcpy( &sums[Y_SS * n + i], syy, sizeof( syy ) );
+      memcpy( &sums[XY_SS * n + i], sxy, sizeof( sxy ) );
+   }
+
+   return;
+}
+
+/**
+   put_f64
+
+   add the point in x_new, y_new to the float64_t sums of every series,
+   replacing the point in xo, yo if the window is full
+*/
+
+static
+void
+put_f64( lsqline_multi_t *current, float32_t *xo, float32_t *yo )
+{
+   int32_t i = 0;
+   int32_t k = 0;
+   int32_t n = (*current).padded_count;
+   int32_t is_full = ( (*current).count == (*current).window );
+   float64_t *sums = (*current).d_sums;
+   float64_t n_inverse = 0.0;
+   float64_t xn[LANE_COUNT];
+   float64_t yn[LANE_COUNT];
+   float64_t x_old[LANE_COUNT];
+   float64_t y_old[LANE_COUNT];
+   float64_t mx[LANE_COUNT];
+   float64_t my[LANE_COUNT];
+   float64_t sxx[LANE_COUNT];
+   float64_t syy[LANE_COUNT];
+   float64_t sxy[LANE_COUNT];
+   float64_t mx1[LANE_COUNT];
+   float64_t my1[LANE_COUNT];
+
+   if ( is_full == 1 )
+   {
+      n_inverse = 1.0 / ( float64_t ) (*current).window;
+   }
+   else
+   {
+      n_inverse = 1.0 / ( float64_t ) ( (*current).count + 1 );
+   }
+
+   for ( i = 0; i < n; i = i + LANE_COUNT )
+   {
+      for ( k = 0; k < LANE_COUNT; k++ )
+      {
+         xn[k] = (*current).x_new[i + k];
+         yn[k] = (*current).y_new[i + k];
+         x_old[k] = xo[i + k];
+         y_old[k] = yo[i + k];
+      }
+
+      memcpy( mx, &sums[X_MEAN * n + i], sizeof( mx ) );
+      memcpy( my, &sums[Y_MEAN * n + i], sizeof( my ) );
+      memcpy( sxx, &sums[X_SS * n + i], sizeof( sxx ) );
+      memcpy( syy, &sums[Y_SS * n + i], sizeof( syy ) );
+      memcpy( sxy, &sums[XY_SS * n + i], sizeof( sxy ) );
+
+      if ( is_full == 1 )
+      {
+         // replace the oldest point, the count stays the same
+         for ( k = 0; k < LANE_COUNT; k++ )
+         {
+            mx1[k] = mx[k] + ( xn[k] - x_old[k] ) * n_inverse;
+            my1[k] = my[k] + ( yn[k] - y_old[k] ) * n_inverse;
+            sxx[k] = sxx[k] + ( xn[k] - x_old[k] ) * ( xn[k] - mx1[k] + x_old[k] - mx[k] );
+            syy[k] = syy[k] + ( yn[k] - y_old[k] ) * ( yn[k] - my1[k] + y_old[k] - my[k] );
+            sxy[k] = sxy[k] + ( xn[k] - mx[k] ) * ( yn[k] - my1[k] ) - ( x_old[k] - mx[k] ) * ( y_old[k] - my1[k] );
+         }
+      }
+      else
+      {
+         // add a point, Welford's update
+         for ( k = 0; k < LANE_COUNT; k++ )
+         {
+            mx1[k] = mx[k] + ( xn[k] - mx[k] ) * n_inverse;
+            my1[k] = my[k] + ( yn[k] - my[k] ) * n_inverse;
+            sxx[k] = sxx[k] + ( xn[k] - mx[k] ) * ( xn[k] - mx1[k] );
+            syy[k] = syy[k] + ( yn[k] - my[k] ) * ( yn[k] - my1[k] );
+            sxy[k] = sxy[k] + ( xn[k] - mx[k] ) * ( yn[k] - my1[k] );
+         }
+      }
+
+      memcpy( &sums[X_MEAN * n + i], mx1, sizeof( mx1 ) );
+      memcpy( &sums[Y_MEAN * n + i], my1, sizeof( my1 ) );
+      memcpy( &sums[X_SS * n + i], sxx, sizeof( sxx ) );
+      memcpy( &sums[Y_SS * n + i], syy, sizeof( syy ) );
+      memcpy( &sums[XY_SS * n + i], sxy, sizeof( sxy ) );
+   }
+
+   return;
+}
+
+/**
+   resync_f32
+
+   recompute the float32_t sums of every series from the window, the means
+   first and then the centered sums
+*/
+
+static
+void
+resync_f32( lsqline_multi_t *current )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t n = (*current).padded_count;
+   float32_t *sums = (*current).f_sums;
+   float32_t *x = NULL;
+   float32_t *y = NULL;
+   float32_t *mx = &sums[X_MEAN * n];
+   float32_t *my = &sums[Y_MEAN * n];
+   float32_t *sxx = &sums[X_SS * n];
+   float32_t *syy = &sums[Y_SS * n];
+   float32_t *sxy = &sums[XY_SS * n];
+   float32_t n_inverse = 1.0f / ( float32_t ) (*current).count;
+
+   memset( sums, 0, SUM_COUNT * n * sizeof( float32_t ) );
+
+   for ( j = 0; j < (*current).count; j++ )
+   {
+      x = &(*current).x[j * n];
+      y = &(*current).y[j * n];
+      for ( i = 0; i < n; i++ )
+      {
+         mx[i] = mx[i] + x[i];
+         my[i] = my[i] + y[i];
+      }
+   }
+
+   for ( i = 0; i < n; i++ )
+   {
+      mx[i] = mx[i] * n_inverse;
+      my[i] = my[i] * n_inverse;
+   }
+
+   for ( j = 0; j < (*current).count; j++ )
+   {
+      x = &(*current).x[j * n];
+      y = &(*current).y[j * n];
+      for ( i = 0; i < n; i++ )
+      {
+         sxx[i] = sxx[i] + ( x[i] - mx[i] ) * ( x[i] - mx[i] );
+         syy[i] = syy[i] + ( y[i] - my[i] ) * ( y[i] - my[i] );
+         sxy[i] = sxy[i] + ( x[i] - mx[i] ) * ( y[i] - my[i] );
+      }
+   }
+
+   return;
+}
+
+/**
+   resync_f64
+
+   recompute the float64_t sums of every series from the window, the means
+   first and then the centered sums
+*/
+
+static
+void
+resync_f64( lsqline_multi_t *current )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t n = (*current).padded_count;
+   float64_t *sums = (*current).d_sums;
+   float32_t *x = NULL;
+   float32_t *y = NULL;
+   float64_t *mx = &sums[X_MEAN * n];
+   float64_t *my = &sums[Y_MEAN * n];
+   float64_t *sxx = &sums[X_SS * n];
+   float64_t *syy = &sums[Y_SS * n];
+   float64_t *sxy = &sums[XY_SS * n];
+   float64_t n_inverse = 1.0 / ( float64_t ) (*current).count;
+
+   memset( sums, 0, SUM_COUNT * n * sizeof( float64_t ) );
+
+   for ( j = 0; j < (*current).count; j++ )
+   {
+      x = &(*current).x[j * n];
+      y = &(*current).y[j * n];
+      for ( i = 0; i < n; i++ )
+      {
+         mx[i] = mx[i] + x[i];
+         my[i] = my[i] + y[i];
+      }
+   }
+
+   for ( i = 0; i < n; i++ )
+   {
+      mx[i] = mx[i] * n_inverse;
+      my[i] = my[i] * n_inverse;
+   }
+
+   for ( j = 0; j < (*current).count; j++ )
+   {
+      x = &(*current).x[j * n];
+      y = &(*current).y[j * n];
+      for ( i = 0; i < n; i++ )
+      {
+         sxx[i] = sxx[i] + ( x[i] - mx[i] ) * ( x[i] - mx[i] );
+         syy[i] = syy[i] + ( y[i] - my[i] ) * ( y[i] - my[i] );
+         sxy[i] = sxy[i] + ( x[i] - mx[i] ) * ( y[i] - my[i] );
+      }
+   }
+
+   return;
+}
+
+/**
+   compute_series
+
+   compute the line of one series from its centered sums
+*/
+
+static
+void
+compute_series
+(
+   lsqline_multi_t *current,
+   int32_t i,
+   float64_t mx,
+   float64_t my,
+   float64_t sxx,
+   float64_t syy,
+   float64_t sxy
+)
+{
+   if ( ( sxx == 0.0 ) || ( (*current).count <= 1 ) )
+   {
+      // output is not valid, will have division by zero down the line
+      // or too few data points
+      (*current).is_output_valid[i] = 0;
+      (*current).slope[i] = 0.0;
+      (*current).y_intercept[i] = 0.0;
+      (*current).fit[i] = 0.0;
+   }
+   else
+   {
+      // output will be valid
+      (*current).is_output_valid[i] = 1;
+
+      // slope
+      (*current).slope[i] = sxy / sxx;
+
+      // y intercept
+      (*current).y_intercept[i] = my - ( sxy / sxx ) * mx;
+
+      // fit
+      (*current).fit[i] = syy - ( sxy / sxx ) * sxy;
+   }
+
+   return;
+}
+
+/**
+   lsqline_multi_make
+*/
+
+lsqline_multi_t *
+lsqline_multi_make( int32_t series_count, int32_t window )
+{
+   PRECONDITION( "series_count ok", series_count > 0 );
+   PRECONDITION( "window ok", window > 0 );
+
+   lsqline_multi_t *result = make( series_count, window, 0 );
+
+   INVARIANT( result );
+
+   return result;
+}
+
+/**
+   lsqline_multi_make_float64
+*/
+
+lsqline_multi_t *
+lsqline_multi_make_float64( int32_t series_count, int32_t window )
+{
+   PRECONDITION( "series_count ok", series_count > 0 );
+   PRECONDITION( "window ok", window > 0 );
+
+   lsqline_multi_t *result = make( series_count, window, 1 );
+
+   INVARIANT( result );
+
+   return result;
+}
+
+/**
+   lsqline_multi_dispose
+*/
+
+void
+lsqline_multi_dispose( lsqline_multi_t **current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "*current not null", *current != NULL );
+   PRECONDITION( "current type OK", (**current)._type == LSQLINE_MULTI_TYPE );
+   INVARIANT(*current);
+
+   // delete
+   free( (**current).x );
+   free( (**current).y );
+   free( (**current).x_new );
+   free( (**current).y_new );
+   free( (**current).f_sums );
+   free( (**current).d_sums );
+   free( (**current).is_output_valid );
+   free( (**current).slope );
+   free( (**current).y_intercept );
+   free( (**current).fit );
+
+   // delete Lsqline_multi struct
+   free(*current);
+
+   // set to NULL
+   *current = NULL;
+
+   return;
+}
+
+/**
+   lsqline_multi_deep_dispose
+*/
+
+void
+lsqline_multi_deep_dispose( lsqline_multi_t **current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "*current not null", *current != NULL );
+   PRECONDITION( "current type OK", (**current)._type == LSQLINE_MULTI_TYPE );
+   INVARIANT(*current);
+
+   // no value items to dispose
+   lsqline_multi_dispose( current );
+
+   return;
+}
+
+/**
+   lsqline_multi_slope
+*/
+
+float32_t
+lsqline_multi_slope( lsqline_multi_t *current, int32_t series )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == LSQLINE_MULTI_TYPE );
+   PRECONDITION( "series ok", ( series >= 0 ) && ( series < (*current).series_count ) );
+   INVARIANT( current );
+
+   float32_t result = 0.0;
+
+   result = (*current).slope[series];
+
+   INVARIANT( current );
+
+   return result;
+}
+
+/**
+   lsqline_multi_y_intercept
+*/
+
+float32_t
+lsqline_multi_y_intercept( lsqline_multi_t *current, int32_t series )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == LSQLINE_MULTI_TYPE );
+   PRECONDITION( "series ok", ( series >= 0 ) && ( series < (*current).series_count ) );
+   INVARIANT( current );
+
+   float32_t result = 0.0;
+
+   result = (*current).y_intercept[series];
+
+   INVARIANT( current );
+
+   return result;
+}
+
+/**
+   lsqline_multi_fit
+*/
+
+float32_t
+lsqline_multi_fit( lsqline_multi_t *current, int32_t series )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == LSQLINE_MULTI_TYPE );
+   PRECONDITION( "series ok", ( series >= 0 ) && ( series < (*current).series_count ) );
+   INVARIANT( current );
+
+   float32_t result = 0.0;
+
+   result = (*current).fit[series];
+
+   INVARIANT( current );
+
+   return result;
+}
+
+/**
+   lsqline_multi_series_count
+*/
+
+int32_t
+lsqline_multi_series_count( lsqline_multi_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == LSQLINE_MULTI_TYPE );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = (*current).series_count;
+
+   INVARIANT( current );
+
+   return result;
+}
+
+/**
+   lsqline_multi_window
+*/
+
+int32_t
+lsqline_multi_window( lsqline_multi_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == LSQLINE_MULTI_TYPE );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = (*current).window;
+
+   INVARIANT( current );
+
+   return result;
+}
+
+/**
+   lsqline_multi_count
+*/
+
+int32_t
+lsqline_multi_count( lsqline_multi_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == LSQLINE_MULTI_TYPE );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = (*current).count;
+
+   INVARIANT( current );
+
+   return result;
+}
+
+/**
+   lsqline_multi_is_float64
+*/
+
+int32_t
+lsqline_multi_is_float64( lsqline_multi_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == LSQLINE_MULTI_TYPE );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = (*current).is_float64;
+
+   INVARIANT( current );
+
+   return result;
+}
+
+/**
+   lsqline_multi_is_output_valid
+*/
+
+int32_t
+lsqline_multi_is_output_valid( lsqline_multi_t *current, int32_t series )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == LSQLINE_MULTI_TYPE );
+   PRECONDITION( "series ok", ( series >= 0 ) && ( series < (*current).series_count ) );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   result = (*current).is_output_valid[series];
+
+   INVARIANT( current );
+
+   return result;
+}
+
+/**
+   lsqline_multi_compute
+*/
+
+void
+lsqline_multi_compute( lsqline_multi_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == LSQLINE_MULTI_TYPE );
+   INVARIANT( current );
+
+   int32_t i = 0;
+   int32_t n = (*current).padded_count;
+   float32_t *fs = (*current).f_sums;
+   float64_t *ds = (*current).d_sums;
+
+   for ( i = 0; i < (*current).series_count; i++ )
+   {
+      if ( (*current).is_float64 == 1 )
+      {
+         compute_series
+         (
+            current,
+            i,
+            ds[X_MEAN * n + i],
+            ds[Y_MEAN * n + i],
+            ds[X_SS * n + i],
+            ds[Y_SS * n + i],
+            ds[XY_SS * n + i]
+         );
+      }
+      else
+      {
+         compute_series
+         (
+            current,
+            i,
+            fs[X_MEAN * n + i],
+            fs[Y_MEAN * n + i],
+            fs[X_SS * n + i],
+            fs[Y_SS * n + i],
+            fs[XY_SS * n + i]
+         );
+      }
+   }
+
+   INVARIANT( current );
+
+   return;
+}
+
+/**
+   lsqline_multi_put
+*/
+
+void
+lsqline_multi_put( lsqline_multi_t *current, float32_t *x, float32_t *y )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == LSQLINE_MULTI_TYPE );
+   PRECONDITION( "x not null", x != NULL );
+   PRECONDITION( "y not null", y != NULL );
+   INVARIANT( current );
+
+   int32_t n = (*current).padded_count;
+   float32_t *xo = &(*current).x[ (*current).index * n ];
+   float32_t *yo = &(*current).y[ (*current).index * n ];
+
+   // copy the new point into the padded row
+   memcpy( (*current).x_new, x, (*current).series_count * sizeof( float32_t ) );
+   memcpy( (*current).y_new, y, (*current).series_count * sizeof( float32_t ) );
+
+   // update the sums, dropping the oldest point if the window is full
+   if ( (*current).is_float64 == 1 )
+   {
+      put_f64( current, xo, yo );
+   }
+   else
+   {
+      put_f32( current, xo, yo );
+   }
+
+   // the new point takes the place of the oldest in the ring
+   memcpy( xo, (*current).x_new, n * sizeof( float32_t ) );
+   memcpy( yo, (*current).y_new, n * sizeof( float32_t ) );
+
+   if ( (*current).count < (*current).window )
+   {
+      (*current).count = (*current).count + 1;
+   }
+
+   (*current).index = (*current).index + 1;
+
+   // once around the ring, recompute the sums to clear rounding errors
+   if ( (*current).index == (*current).window )
+   {
+      (*current).index = 0;
+
+      if ( (*current).is_float64 == 1 )
+      {
+         resync_f64( current );
+      }
+      else
+      {
+         resync_f32( current );
+      }
+   }
+
+   INVARIANT( current );
+
+   return;
+}
+
+/**
+   lsqline_multi_reset
+*/
+
+void
+lsqline_multi_reset( lsqline_multi_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == LSQLINE_MULTI_TYPE );
+   INVARIANT( current );
+
+   int32_t n = (*current).padded_count;
+
+   // clear current index and count
+   (*current).index = 0;
+   (*current).count = 0;
+
+   // set internal variables to zero
+   memset( (*current).x, 0, (*current).window * n * sizeof( float32_t ) );
+   memset( (*current).y, 0, (*current).window * n * sizeof( float32_t ) );
+
+   if ( (*current).is_float64 == 1 )
+   {
+      memset( (*current).d_sums, 0, SUM_COUNT * n * sizeof( float64_t ) );
+   }
+   else
+   {
+      memset( (*current).f_sums, 0, SUM_COUNT * n * sizeof( float32_t ) );
+   }
+
+   memset( (*current).is_output_valid, 0, (*current).series_count * sizeof( int32_t ) );
+
+   INVARIANT( current );
+
+   return;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
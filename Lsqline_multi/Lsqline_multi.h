@@ -0,0 +1,279 @@
+/**
+ @file Lsqline_multi.h
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "Lsqlines of many series"
+
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2022 Greg Lee
+
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0):
+
+ 1. Permission is hereby granted to use, copy, modify and/or
+    distribute this package, provided that:
+       * copyright notices are retained unchanged,
+       * any distribution of this package, whether modified or not,
+         includes this license text.
+ 2. Permission is hereby also granted to distribute binary programs
+    which depend on this package. If the binary program depends on a
+    modified version of this package, you are encouraged to publicly
+    release the modified version of this package.
+
+ THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT WARRANTY. ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE AUTHORS BE LIABLE TO ANY PARTY FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES ARISING IN ANY WAY OUT OF THE USE OF THIS PACKAGE.
+
+
+ @section Description
+
+ Function declarations for the opaque lsqline_multi_t type.
+
+ An lsqline_multi_t instance fits a least squares line to each of many
+ series of x-y points at once. Each series keeps a sliding window of the
+ latest points. One put adds a point to every series, updating the sums of
+ all the series in one pass over arrays laid out by series, so that the
+ loop runs across SIMD lanes.
+
+ The sums are kept as Welford running means and centered sums of squares
+ and products, which do not lose precision to cancellation the way raw
+ sums of x, x squared and so on do. They are recomputed exactly from the
+ window each time the window wraps around, so rounding errors do not pile
+ up over millions of puts. They are float32_t sums by default, or float64_t
+ sums for an instance made with lsqline_multi_make_float64.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef LSQLINE_MULTI_T_H
+#define LSQLINE_MULTI_T_H
+
+
+/**
+   Version
+*/
+
+#define LSQLINE_MULTI_VERSION_MAJOR 2
+#define LSQLINE_MULTI_VERSION_MINOR 0
+#define LSQLINE_MULTI_VERSION_PATCH 0
+
+#define LSQLINE_MULTI_MAKE_VERSION( major, minor, patch ) \
+   ( (major)*10000 + (minor)*100 + (patch) )
+
+#define LSQLINE_MULTI_VERSION \
+   LSQLINE_MULTI_MAKE_VERSION( LSQLINE_MULTI_VERSION_MAJOR, \
+                       LSQLINE_MULTI_VERSION_MINOR, \
+                       LSQLINE_MULTI_VERSION_PATCH )
+
+/**
+   Includes
+*/
+
+#include "base.h"
+
+/**
+   Structure declarations
+*/
+
+struct lsqline_multi_struct;
+
+/**
+   Structure typedefs
+*/
+
+typedef struct lsqline_multi_struct lsqline_multi_t;
+
+/*
+   Initialization
+*/
+
+/**
+   lsqline_multi_make
+
+   Return a new empty lsqline_multi_t instance with float32_t sums.
+
+   @param  series_count number of series to fit
+   @param  window number of the latest points of each series to fit
+   @return lsqline_multi_t instance
+*/
+lsqline_multi_t * lsqline_multi_make( int32_t series_count, int32_t window );
+
+/**
+   lsqline_multi_make_float64
+
+   Return a new empty lsqline_multi_t instance with float64_t sums.
+
+   @param  series_count number of series to fit
+   @param  window number of the latest points of each series to fit
+   @return lsqline_multi_t instance
+*/
+lsqline_multi_t * lsqline_multi_make_float64( int32_t series_count, int32_t window );
+
+/*
+   Disposal
+*/
+
+/**
+   lsqline_multi_dispose
+
+   Free a lsqline_multi_t instance.
+
+   @param  current lsqline_multi_t instance
+*/
+void lsqline_multi_dispose( lsqline_multi_t **current );
+
+/**
+   lsqline_multi_deep_dispose
+
+   Free a lsqline_multi_t instance. The value items are disposed.
+
+   @param  current lsqline_multi_t instance
+*/
+void lsqline_multi_deep_dispose( lsqline_multi_t **current );
+
+/*
+   Access
+*/
+
+/**
+   lsqline_multi_slope
+
+   Return last computed line slope of a series.
+
+   @param  current lsqline_multi_t instance
+   @param  series the index of the series
+   @return slope
+*/
+float32_t lsqline_multi_slope( lsqline_multi_t *current, int32_t series );
+
+/**
+   lsqline_multi_y_intercept
+
+   Return last computed y intercept of a series.
+
+   @param  current lsqline_multi_t instance
+   @param  series the index of the series
+   @return y intercept
+*/
+float32_t lsqline_multi_y_intercept( lsqline_multi_t *current, int32_t series );
+
+/**
+   lsqline_multi_fit
+
+   Return last computed line fit of a series ( lower number is better fit).
+
+   @param  current lsqline_multi_t instance
+   @param  series the index of the series
+   @return fit
+*/
+float32_t lsqline_multi_fit( lsqline_multi_t *current, int32_t series );
+
+/*
+   Measurement
+*/
+
+/**
+   lsqline_multi_series_count
+
+   Return number of series.
+
+   @param  current lsqline_multi_t instance
+   @return number of series
+*/
+int32_t lsqline_multi_series_count( lsqline_multi_t *current );
+
+/**
+   lsqline_multi_window
+
+   Return number of the latest points of each series that are fitted.
+
+   @param  current lsqline_multi_t instance
+   @return window length
+*/
+int32_t lsqline_multi_window( lsqline_multi_t *current );
+
+/**
+   lsqline_multi_count
+
+   Return number of points in the window of each series, at most the
+   window length.
+
+   @param  current lsqline_multi_t instance
+   @return number of input points
+*/
+int32_t lsqline_multi_count( lsqline_multi_t *current );
+
+/**
+   lsqline_multi_is_float64
+
+   Return 1 if the sums are float64_t, 0 if they are float32_t.
+
+   @param  current lsqline_multi_t instance
+   @return is_float64 flag
+*/
+int32_t lsqline_multi_is_float64( lsqline_multi_t *current );
+
+/**
+   lsqline_multi_is_output_valid
+
+   Return is_output_valid flag of a series. False if computation would
+   divide by zero or there are insufficient data points in the window.
+
+   @param  current lsqline_multi_t instance
+   @param  series the index of the series
+   @return is_output_valid flag
+*/
+int32_t lsqline_multi_is_output_valid( lsqline_multi_t *current, int32_t series );
+
+/*
+   Basic Operations
+*/
+
+/**
+   lsqline_multi_compute
+
+   Compute the linear regression of every series for the data in the
+   windows.
+
+   @param  current lsqline_multi_t instance
+*/
+void lsqline_multi_compute( lsqline_multi_t *current );
+
+/**
+   lsqline_multi_put
+
+   Insert a new point into every series. If the windows are full, the
+   oldest point of every series drops out.
+
+   @param  current lsqline_multi_t instance
+   @param  x the x values of the new points, one per series
+   @param  y the y values of the new points, one per series
+*/
+void lsqline_multi_put( lsqline_multi_t *current, float32_t *x, float32_t *y );
+
+/**
+   lsqline_multi_reset
+
+   Reset internal state to re-start data input and computation
+
+   @param  current lsqline_multi_t instance
+*/
+void lsqline_multi_reset( lsqline_multi_t *current );
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LSQLINE_MULTI_T_H */
+
+/* End of file */
+
@@ -43,6 +43,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <math.h>
 
@@ -327,6 +328,133 @@ split_merge
    return;
 }
 
+/**
+   merge_array
+
+   merge two sorted runs of a contiguous array into a single sorted run
+
+   @param array holds two input sorted runs in sequence
+   @param array1 receives the merged run
+   @param func the comparison function
+   @param i_start the index of the first input run
+   @param i_middle the index of the start of the second input run
+   @param i_end one past the last item in the second input run
+*/
+static
+void
+merge_array
+(
+   Type *array,
+   Type *array1,
+   int32_t (*func)( Type a, Type b ),
+   int32_t i_start,
+   int32_t i_middle,
+   int32_t i_end
+)
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+
+   i = i_start;
+   j = i_middle;
+
+   for( k = i_start; k < i_end; k++ )
+   {
+
+      if ( ( i < i_middle ) && ( ( j >= i_end ) || ( func( array[i], array[j] ) <= 0 ) ) )
+      {
+         array1[k] = array[i];
+         i = i + 1;
+      }
+      else
+      {
+         array1[k] = array[j];
+         j = j + 1;
+      }
+   }
+
+   return;
+}
+
+/**
+   split_merge_array
+
+   split_merge on contiguous arrays
+
+   @param array1 working array, starts as a copy of array
+   @param array input data array
+   @param func the comparison function
+   @param i_start the index of the data array
+   @param i_end one past the last item of the data array
+*/
+static
+void
+split_merge_array
+(
+   Type *array1,
+   Type *array,
+   int32_t (*func)( Type a, Type b ),
+   int32_t i_start,
+   int32_t i_end
+)
+{
+   int32_t i_middle = 0;
+
+   // only sort if working with more than 1 item
+   if ( ( i_end - i_start ) >= 2 )
+   {
+      // get index for split
+      i_middle = ( int32_t ) ( ( i_end + i_start ) / 2 );
+
+      // recursively sort both split halves into array1
+      split_merge_array( array, array1, func, i_start, i_middle );
+      split_merge_array( array, array1, func, i_middle, i_end );
+
+      // merge the splits in array1 back into array
+      merge_array( array1, array, func, i_start, i_middle, i_end );
+   }
+
+   return;
+}
+
+/**
+   sort_array
+
+   sort the contiguous items of a container using a plain temp buffer
+
+   @param array the items to sort
+   @param n the number of items
+   @param func the comparison function
+*/
+static
+void
+sort_array
+(
+   Type *array,
+   int32_t n,
+   int32_t (*func)( Type a, Type b )
+)
+{
+   Type *array1 = NULL;
+
+   if ( n >= 2 )
+   {
+      // make temp buffer
+      array1 = ( Type * ) calloc( n, sizeof( Type ) );
+      CHECK( "array1 allocated correctly", array1 != NULL );
+
+      memcpy( array1, array, n * sizeof( Type ) );
+
+      // sort the items
+      split_merge_array( array1, array, func, 0, n );
+
+      free( array1 );
+   }
+
+   return;
+}
+
 #define Base_Prefix p
 
 /**
@@ -349,22 +477,33 @@ sort
    void (*put)( protocol_base_t *p_indexable, Type value, int32_t index ) = NULL;
 
    int32_t n = 0;
-
-   // get direct pointer to item, put functions
-   item = P_Indexable_item( Prefix );
-   put = P_Indexable_put( Prefix );
+   Type *array = NULL;
 
    // get size of indexable
    n = P_Indexable_count( Prefix )( p_indexable );
 
-   // make second indexable for temp buffer
-   protocol_base_t *p_indexable1 = ( P_Basic_clone( Prefix ) )( p_indexable );
+   // sort in place if the items are held in one array
+   array = P_Indexable_span( Prefix )( p_indexable );
+
+   if ( array != NULL )
+   {
+      sort_array( array, n, func );
+   }
+   else
+   {
+      // get direct pointer to item, put functions
+      item = P_Indexable_item( Prefix );
+      put = P_Indexable_put( Prefix );
 
-   // sort the indexable
-   split_merge( p_indexable1, p_indexable, func, item, put, 0, n );
+      // make second indexable for temp buffer
+      protocol_base_t *p_indexable1 = ( P_Basic_clone( Prefix ) )( p_indexable );
 
-   // dispose of temp buffer
-   ( P_Basic_dispose( Prefix ) )( &p_indexable1 );
+      // sort the indexable
+      split_merge( p_indexable1, p_indexable, func, item, put, 0, n );
+
+      // dispose of temp buffer
+      ( P_Basic_dispose( Prefix ) )( &p_indexable1 );
+   }
 
    return;
 }
@@ -391,19 +530,36 @@ is_sorted
    int32_t i = 0;
    int32_t n = 0;
    int32_t result  = 1;
+   Type *array = NULL;
 
    // get direct pointer to item function
    item = ( *p_indexable ).get_function( P_INDEXABLE_TYPE, P_INDEXABLE_ITEM );
 
    n = P_Indexable_count( Prefix )( p_indexable );
 
-   for ( i = 1; i < n; i++ )
+   array = P_Indexable_span( Prefix )( p_indexable );
+
+   if ( array != NULL )
    {
-      // compare sequential items - if out of order, stop and return 0
-      if ( func( item( p_indexable, i - 1 ), item( p_indexable, i ) ) > 0 )
+      for ( i = 1; i < n; i++ )
       {
-         result = 0;
-         break;
+         if ( func( array[i - 1], array[i] ) > 0 )
+         {
+            result = 0;
+            break;
+         }
+      }
+   }
+   else
+   {
+      for ( i = 1; i < n; i++ )
+      {
+         // compare sequential items - if out of order, stop and return 0
+         if ( func( item( p_indexable, i - 1 ), item( p_indexable, i ) ) > 0 )
+         {
+            result = 0;
+            break;
+         }
       }
    }
 
@@ -44,10 +44,14 @@ extern "C" {
 #include <string.h>
 #include <stdlib.h>
 #include <math.h>
+#if defined( __AVX2__ ) || defined( __AVX512F__ )
+#include <immintrin.h>
+#endif
 #ifdef MULTITHREADED
 #include MULTITHREAD_INCLUDE
 #endif
 
+#include "pool.h"
 #include "dbc.h"
 
 /**
@@ -60,103 +64,1174 @@ extern "C" {
 
    Defines that must be present (external to this file):
 
-   Prefix - string used to name this container type
-   Type   - the type of the value
-   Magnitude_type - the type of the magnitude or precision of Type
-   Va_type - type returned from call to va_arg function (floats promoted to double, etc. )
+   Prefix - string used to name this container type
+   Type   - the type of the value
+   Magnitude_type - the type of the magnitude or precision of Type
+   Va_type - type returned from call to va_arg function (floats promoted to double, etc. )
+
+   Macros that must be present (external to this file):
+
+   DEFAULT_VALUE              -  constant that is the default value for type (zero)
+   ONE_VALUE                  -  constant that is the "one" value for type
+   IS_INVERTIBLE              -  constant 0 if not or 1 if type is invertible
+   NEGATE_FUNCTION            -  additive inverse of type value
+   ADD_FUNCTION               -  adds two type values
+   SQUARED_MAGNITUDE_FUNCTION -  squared magnitude of type value
+   MULTIPLY_FUNCTION          -  multiplies two type values
+   INVERSE_FUNCTION           -  multiplicative inverse of type value
+   CONJUGATE_FUNCTION         -  complex conjugate of type value
+   EQUAL_FUNCTION             -  1 if items are equal, 0 otherwise
+   DUPLICATE_FUNCTION         -  makes duplicate of a type value
+   SET_FROM                   -  sets value from another
+   DISPOSE_FUNCTION           -  frees a type value
+
+*/
+
+#define MATVEC_DEFAULT_THREAD_THRESHOLD 65536
+#define MATVEC_PANELS_PER_THREAD 4
+
+/**
+   work structure
+
+   shared arguments of the jobs of one parallel step. Each job works on
+   one panel of the rows from first_row to rows - 1.
+*/
+
+typedef struct
+{
+   Type *pa;
+   Type *pa_other;
+   Type *pa_result;
+   int32_t rows;
+   int32_t columns;
+   int32_t other_columns;
+   int32_t first_row;
+   int32_t pivot;
+   int32_t panel_count;
+} work_t;
+
+/**
+   Matvec structure
+*/
+
+struct Matvec_struct( Prefix )
+{
+   int32_t _type;
+   int32_t _item_type;
+
+   // number of columns
+   int32_t n_columns;
+
+   // number of rows
+   int32_t n_rows;
+
+   // number of threads used by operations, including the caller
+   int32_t thread_count;
+
+   // smallest number of items for which operations use the threads
+   int32_t thread_threshold;
+
+   // worker threads, started when thread_count is more than one
+   pool_t pool;
+
+   // multithread values if we include threading support
+   MULTITHREAD_MUTEX_DEFINITION( mutex );
+   // the array of data
+   Type *a;
+
+};
+
+/**
+   Invariant
+*/
+
+#if INVARIANT_CONDITIONAL != 0
+
+static
+int32_t
+num_rows_and_num_columns_positive( Matvec_type( Prefix ) *p )
+{
+   int32_t result = 0;
+
+   if ( ( (*p).n_rows > 0 ) && ( (*p).n_columns > 0 ) )
+   {
+      result = 1;
+   }
+
+   return result;
+}
+
+static
+int32_t
+array_is_not_null( Matvec_type( Prefix ) *p )
+{
+   int32_t result = 0;
+
+   if ( (*p).a != NULL )
+   {
+      result = 1;
+   }
+
+   return result;
+}
+
+static
+int32_t
+thread_count_positive( Matvec_type( Prefix ) *p )
+{
+   int32_t result = 0;
+
+   if ( (*p).thread_count > 0 )
+   {
+      result = 1;
+   }
+
+   return result;
+}
+
+static
+void invariant( Matvec_type( Prefix ) *p )
+{
+   assert( ( ( void ) "num rows and num columns positive", num_rows_and_num_columns_positive( p ) ) );
+   assert( ( ( void ) "array is not null", array_is_not_null( p ) ) );
+   assert( ( ( void ) "thread count positive", thread_count_positive( p ) ) );
+   return;
+}
+
+#else
+
+static
+void invariant( p )
+{
+   return;
+}
+
+#endif
+
+/**
+   Matrix multiply kernel
+
+   multiply_block computes C += alpha * A * B on real Magnitude_type items.
+   Each matrix is passed as a pointer to its first item and its row and
+   column strides, counted in items, so that the real and imaginary parts
+   of a complex matrix can be used as two real matrices.
+
+   The loops follow the usual blocked GEMM order: a block of MATVEC_KC rows
+   and MATVEC_NC columns of B is packed into strips of MATVEC_NR columns,
+   then a block of MATVEC_MC rows of A is packed into strips of MATVEC_MR
+   rows, and the micro kernel multiplies one strip of A by one strip of B
+   into a MATVEC_MR by MATVEC_NR block of accumulators held in registers.
+   Short edge strips are padded with zeros when packed.
+*/
+
+// the AVX kernels in micro_kernel are written out for 6 by 8 strips
+#define MATVEC_MR 6
+#define MATVEC_NR 8
+#define MATVEC_MC 96
+#define MATVEC_KC 256
+#define MATVEC_NC 1024
+
+/**
+   pack_a
+
+   copy rows [ic, ic + mc) and columns [pc, pc + kc) of A into strips of
+   MATVEC_MR rows, each strip stored column by column
+*/
+
+static
+void
+pack_a
+(
+   Magnitude_type *pack,
+   Magnitude_type *a,
+   int32_t a_rs,
+   int32_t a_cs,
+   int32_t mc,
+   int32_t kc
+)
+{
+   int32_t i = 0;
+   int32_t ir = 0;
+   int32_t p = 0;
+
+   for ( ir = 0; ir < mc; ir = ir + MATVEC_MR )
+   {
+      for ( p = 0; p < kc; p++ )
+      {
+         for ( i = 0; i < MATVEC_MR; i++ )
+         {
+            if ( ir + i < mc )
+            {
+               pack[i] = a[ ( ir + i ) * a_rs + p * a_cs ];
+            }
+            else
+            {
+               pack[i] = 0;
+            }
+         }
+         pack = pack + MATVEC_MR;
+      }
+   }
+
+   return;
+}
+
+/**
+   pack_b
+
+   copy rows [pc, pc + kc) and columns [jc, jc + nc) of B into strips of
+   MATVEC_NR columns, each strip stored row by row
+*/
+
+static
+void
+pack_b
+(
+   Magnitude_type *pack,
+   Magnitude_type *b,
+   int32_t b_rs,
+   int32_t b_cs,
+   int32_t kc,
+   int32_t nc
+)
+{
+   int32_t j = 0;
+   int32_t jr = 0;
+   int32_t p = 0;
+
+   for ( jr = 0; jr < nc; jr = jr + MATVEC_NR )
+   {
+      for ( p = 0; p < kc; p++ )
+      {
+         for ( j = 0; j < MATVEC_NR; j++ )
+         {
+            if ( jr + j < nc )
+            {
+               pack[j] = b[ p * b_rs + ( jr + j ) * b_cs ];
+            }
+            else
+            {
+               pack[j] = 0;
+            }
+         }
+         pack = pack + MATVEC_NR;
+      }
+   }
+
+   return;
+}
+
+/**
+   micro_kernel_c
+
+   acc = ap * bp for one packed strip of A and one packed strip of B,
+   in plain C that compilers can vectorize for the target
+*/
+
+static
+void
+micro_kernel_c
+(
+   int32_t kc,
+   Magnitude_type *ap,
+   Magnitude_type *bp,
+   Magnitude_type *acc
+)
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t p = 0;
+   Magnitude_type a_item = 0;
+
+   for ( i = 0; i < MATVEC_MR * MATVEC_NR; i++ )
+   {
+      acc[i] = 0;
+   }
+
+   for ( p = 0; p < kc; p++ )
+   {
+      for ( i = 0; i < MATVEC_MR; i++ )
+      {
+         a_item = ap[ p * MATVEC_MR + i ];
+         for ( j = 0; j < MATVEC_NR; j++ )
+         {
+            acc[ i * MATVEC_NR + j ] = acc[ i * MATVEC_NR + j ] + a_item * bp[ p * MATVEC_NR + j ];
+         }
+      }
+   }
+
+   return;
+}
+
+/**
+   micro_kernel
+
+   acc = ap * bp for one packed strip of A and one packed strip of B
+
+   The AVX-512 and AVX2 versions are compiled in when the compiler is
+   asked for those instruction sets (for example with -march=native).
+   AVX-512 is used for float64 items, AVX2 with FMA for float64 and
+   float32 items, and micro_kernel_c otherwise. Each keeps twelve
+   independent sums in registers, one or two vectors per row of the strip,
+   so that the fused multiply adds do not wait on each other.
+*/
+
+static
+void
+micro_kernel
+(
+   int32_t kc,
+   Magnitude_type *ap,
+   Magnitude_type *bp,
+   Magnitude_type *acc
+)
+{
+   if ( sizeof( Magnitude_type ) == sizeof( double ) )
+   {
+#if defined( __AVX512F__ )
+
+      int32_t p = 0;
+      double *a = ( double * ) ap;
+      double *b = ( double * ) bp;
+      __m512d b0;
+      __m512d b1;
+      __m512d c00 = _mm512_setzero_pd();
+      __m512d c10 = _mm512_setzero_pd();
+      __m512d c20 = _mm512_setzero_pd();
+      __m512d c30 = _mm512_setzero_pd();
+      __m512d c40 = _mm512_setzero_pd();
+      __m512d c50 = _mm512_setzero_pd();
+      __m512d c01 = _mm512_setzero_pd();
+      __m512d c11 = _mm512_setzero_pd();
+      __m512d c21 = _mm512_setzero_pd();
+      __m512d c31 = _mm512_setzero_pd();
+      __m512d c41 = _mm512_setzero_pd();
+      __m512d c51 = _mm512_setzero_pd();
+
+      // even and odd steps of p go to separate sums
+      for ( p = 0; p + 1 < kc; p = p + 2 )
+      {
+         b0 = _mm512_loadu_pd( &b[ p * MATVEC_NR ] );
+         b1 = _mm512_loadu_pd( &b[ ( p + 1 ) * MATVEC_NR ] );
+         c00 = _mm512_fmadd_pd( _mm512_set1_pd( a[ p * MATVEC_MR + 0 ] ), b0, c00 );
+         c01 = _mm512_fmadd_pd( _mm512_set1_pd( a[ ( p + 1 ) * MATVEC_MR + 0 ] ), b1, c01 );
+         c10 = _mm512_fmadd_pd( _mm512_set1_pd( a[ p * MATVEC_MR + 1 ] ), b0, c10 );
+         c11 = _mm512_fmadd_pd( _mm512_set1_pd( a[ ( p + 1 ) * MATVEC_MR + 1 ] ), b1, c11 );
+         c20 = _mm512_fmadd_pd( _mm512_set1_pd( a[ p * MATVEC_MR + 2 ] ), b0, c20 );
+         c21 = _mm512_fmadd_pd( _mm512_set1_pd( a[ ( p + 1 ) * MATVEC_MR + 2 ] ), b1, c21 );
+         c30 = _mm512_fmadd_pd( _mm512_set1_pd( a[ p * MATVEC_MR + 3 ] ), b0, c30 );
+         c31 = _mm512_fmadd_pd( _mm512_set1_pd( a[ ( p + 1 ) * MATVEC_MR + 3 ] ), b1, c31 );
+         c40 = _mm512_fmadd_pd( _mm512_set1_pd( a[ p * MATVEC_MR + 4 ] ), b0, c40 );
+         c41 = _mm512_fmadd_pd( _mm512_set1_pd( a[ ( p + 1 ) * MATVEC_MR + 4 ] ), b1, c41 );
+         c50 = _mm512_fmadd_pd( _mm512_set1_pd( a[ p * MATVEC_MR + 5 ] ), b0, c50 );
+         c51 = _mm512_fmadd_pd( _mm512_set1_pd( a[ ( p + 1 ) * MATVEC_MR + 5 ] ), b1, c51 );
+      }
+
+      if ( p < kc )
+      {
+         b0 = _mm512_loadu_pd( &b[ p * MATVEC_NR ] );
+         c00 = _mm512_fmadd_pd( _mm512_set1_pd( a[ p * MATVEC_MR + 0 ] ), b0, c00 );
+         c10 = _mm512_fmadd_pd( _mm512_set1_pd( a[ p * MATVEC_MR + 1 ] ), b0, c10 );
+         c20 = _mm512_fmadd_pd( _mm512_set1_pd( a[ p * MATVEC_MR + 2 ] ), b0, c20 );
+         c30 = _mm512_fmadd_pd( _mm512_set1_pd( a[ p * MATVEC_MR + 3 ] ), b0, c30 );
+         c40 = _mm512_fmadd_pd( _mm512_set1_pd( a[ p * MATVEC_MR + 4 ] ), b0, c40 );
+         c50 = _mm512_fmadd_pd( _mm512_set1_pd( a[ p * MATVEC_MR + 5 ] ), b0, c50 );
+      }
+
+      _mm512_storeu_pd( ( double * ) &acc[ 0 * MATVEC_NR ], _mm512_add_pd( c00, c01 ) );
+      _mm512_storeu_pd( ( double * ) &acc[ 1 * MATVEC_NR ], _mm512_add_pd( c10, c11 ) );
+      _mm512_storeu_pd( ( double * ) &acc[ 2 * MATVEC_NR ], _mm512_add_pd( c20, c21 ) );
+      _mm512_storeu_pd( ( double * ) &acc[ 3 * MATVEC_NR ], _mm512_add_pd( c30, c31 ) );
+      _mm512_storeu_pd( ( double * ) &acc[ 4 * MATVEC_NR ], _mm512_add_pd( c40, c41 ) );
+      _mm512_storeu_pd( ( double * ) &acc[ 5 * MATVEC_NR ], _mm512_add_pd( c50, c51 ) );
+
+#elif defined( __AVX2__ ) && defined( __FMA__ )
+
+      int32_t p = 0;
+      double *a = ( double * ) ap;
+      double *b = ( double * ) bp;
+      __m256d a0;
+      __m256d b0;
+      __m256d b1;
+      __m256d c00 = _mm256_setzero_pd();
+      __m256d c10 = _mm256_setzero_pd();
+      __m256d c20 = _mm256_setzero_pd();
+      __m256d c30 = _mm256_setzero_pd();
+      __m256d c40 = _mm256_setzero_pd();
+      __m256d c50 = _mm256_setzero_pd();
+      __m256d c01 = _mm256_setzero_pd();
+      __m256d c11 = _mm256_setzero_pd();
+      __m256d c21 = _mm256_setzero_pd();
+      __m256d c31 = _mm256_setzero_pd();
+      __m256d c41 = _mm256_setzero_pd();
+      __m256d c51 = _mm256_setzero_pd();
+
+      // left and right halves of the strip go to separate sums
+      for ( p = 0; p < kc; p++ )
+      {
+         b0 = _mm256_loadu_pd( &b[ p * MATVEC_NR ] );
+         b1 = _mm256_loadu_pd( &b[ p * MATVEC_NR + 4 ] );
+         a0 = _mm256_set1_pd( a[ p * MATVEC_MR + 0 ] );
+         c00 = _mm256_fmadd_pd( a0, b0, c00 );
+         c01 = _mm256_fmadd_pd( a0, b1, c01 );
+         a0 = _mm256_set1_pd( a[ p * MATVEC_MR + 1 ] );
+         c10 = _mm256_fmadd_pd( a0, b0, c10 );
+         c11 = _mm256_fmadd_pd( a0, b1, c11 );
+         a0 = _mm256_set1_pd( a[ p * MATVEC_MR + 2 ] );
+         c20 = _mm256_fmadd_pd( a0, b0, c20 );
+         c21 = _mm256_fmadd_pd( a0, b1, c21 );
+         a0 = _mm256_set1_pd( a[ p * MATVEC_MR + 3 ] );
+         c30 = _mm256_fmadd_pd( a0, b0, c30 );
+         c31 = _mm256_fmadd_pd( a0, b1, c31 );
+         a0 = _mm256_set1_pd( a[ p * MATVEC_MR + 4 ] );
+         c40 = _mm256_fmadd_pd( a0, b0, c40 );
+         c41 = _mm256_fmadd_pd( a0, b1, c41 );
+         a0 = _mm256_set1_pd( a[ p * MATVEC_MR + 5 ] );
+         c50 = _mm256_fmadd_pd( a0, b0, c50 );
+         c51 = _mm256_fmadd_pd( a0, b1, c51 );
+      }
+
+      _mm256_storeu_pd( ( double * ) &acc[ 0 * MATVEC_NR ], c00 );
+      _mm256_storeu_pd( ( double * ) &acc[ 0 * MATVEC_NR + 4 ], c01 );
+      _mm256_storeu_pd( ( double * ) &acc[ 1 * MATVEC_NR ], c10 );
+      _mm256_storeu_pd( ( double * ) &acc[ 1 * MATVEC_NR + 4 ], c11 );
+      _mm256_storeu_pd( ( double * ) &acc[ 2 * MATVEC_NR ], c20 );
+      _mm256_storeu_pd( ( double * ) &acc[ 2 * MATVEC_NR + 4 ], c21 );
+      _mm256_storeu_pd( ( double * ) &acc[ 3 * MATVEC_NR ], c30 );
+      _mm256_storeu_pd( ( double * ) &acc[ 3 * MATVEC_NR + 4 ], c31 );
+      _mm256_storeu_pd( ( double * ) &acc[ 4 * MATVEC_NR ], c40 );
+      _mm256_storeu_pd( ( double * ) &acc[ 4 * MATVEC_NR + 4 ], c41 );
+      _mm256_storeu_pd( ( double * ) &acc[ 5 * MATVEC_NR ], c50 );
+      _mm256_storeu_pd( ( double * ) &acc[ 5 * MATVEC_NR + 4 ], c51 );
+
+#else
+
+      micro_kernel_c( kc, ap, bp, acc );
+
+#endif
+   }
+   else if ( sizeof( Magnitude_type ) == sizeof( float ) )
+   {
+#if defined( __AVX2__ ) && defined( __FMA__ )
+
+      int32_t p = 0;
+      float *a = ( float * ) ap;
+      float *b = ( float * ) bp;
+      __m256 b0;
+      __m256 b1;
+      __m256 c00 = _mm256_setzero_ps();
+      __m256 c10 = _mm256_setzero_ps();
+      __m256 c20 = _mm256_setzero_ps();
+      __m256 c30 = _mm256_setzero_ps();
+      __m256 c40 = _mm256_setzero_ps();
+      __m256 c50 = _mm256_setzero_ps();
+      __m256 c01 = _mm256_setzero_ps();
+      __m256 c11 = _mm256_setzero_ps();
+      __m256 c21 = _mm256_setzero_ps();
+      __m256 c31 = _mm256_setzero_ps();
+      __m256 c41 = _mm256_setzero_ps();
+      __m256 c51 = _mm256_setzero_ps();
+
+      // even and odd steps of p go to separate sums
+      for ( p = 0; p + 1 < kc; p = p + 2 )
+      {
+         b0 = _mm256_loadu_ps( &b[ p * MATVEC_NR ] );
+         b1 = _mm256_loadu_ps( &b[ ( p + 1 ) * MATVEC_NR ] );
+         c00 = _mm256_fmadd_ps( _mm256_set1_ps( a[ p * MATVEC_MR + 0 ] ), b0, c00 );
+         c01 = _mm256_fmadd_ps( _mm256_set1_ps( a[ ( p + 1 ) * MATVEC_MR + 0 ] ), b1, c01 );
+         c10 = _mm256_fmadd_ps( _mm256_set1_ps( a[ p * MATVEC_MR + 1 ] ), b0, c10 );
+         c11 = _mm256_fmadd_ps( _mm256_set1_ps( a[ ( p + 1 ) * MATVEC_MR + 1 ] ), b1, c11 );
+         c20 = _mm256_fmadd_ps( _mm256_set1_ps( a[ p * MATVEC_MR + 2 ] ), b0, c20 );
+         c21 = _mm256_fmadd_ps( _mm256_set1_ps( a[ ( p + 1 ) * MATVEC_MR + 2 ] ), b1, c21 );
+         c30 = _mm256_fmadd_ps( _mm256_set1_ps( a[ p * MATVEC_MR + 3 ] ), b0, c30 );
+         c31 = _mm256_fmadd_ps( _mm256_set1_ps( a[ ( p + 1 ) * MATVEC_MR + 3 ] ), b1, c31 );
+         c40 = _mm256_fmadd_ps( _mm256_set1_ps( a[ p * MATVEC_MR + 4 ] ), b0, c40 );
+         c41 = _mm256_fmadd_ps( _mm256_set1_ps( a[ ( p + 1 ) * MATVEC_MR + 4 ] ), b1, c41 );
+         c50 = _mm256_fmadd_ps( _mm256_set1_ps( a[ p * MATVEC_MR + 5 ] ), b0, c50 );
+         c51 = _mm256_fmadd_ps( _mm256_set1_ps( a[ ( p + 1 ) * MATVEC_MR + 5 ] ), b1, c51 );
+      }
+
+      if ( p < kc )
+      {
+         b0 = _mm256_loadu_ps( &b[ p * MATVEC_NR ] );
+         c00 = _mm256_fmadd_ps( _mm256_set1_ps( a[ p * MATVEC_MR + 0 ] ), b0, c00 );
+         c10 = _mm256_fmadd_ps( _mm256_set1_ps( a[ p * MATVEC_MR + 1 ] ), b0, c10 );
+         c20 = _mm256_fmadd_ps( _mm256_set1_ps( a[ p * MATVEC_MR + 2 ] ), b0, c20 );
+         c30 = _mm256_fmadd_ps( _mm256_set1_ps( a[ p * MATVEC_MR + 3 ] ), b0, c30 );
+         c40 = _mm256_fmadd_ps( _mm256_set1_ps( a[ p * MATVEC_MR + 4 ] ), b0, c40 );
+         c50 = _mm256_fmadd_ps( _mm256_set1_ps( a[ p * MATVEC_MR + 5 ] ), b0, c50 );
+      }
+
+      _mm256_storeu_ps( ( float * ) &acc[ 0 * MATVEC_NR ], _mm256_add_ps( c00, c01 ) );
+      _mm256_storeu_ps( ( float * ) &acc[ 1 * MATVEC_NR ], _mm256_add_ps( c10, c11 ) );
+      _mm256_storeu_ps( ( float * ) &acc[ 2 * MATVEC_NR ], _mm256_add_ps( c20, c21 ) );
+      _mm256_storeu_ps( ( float * ) &acc[ 3 * MATVEC_NR ], _mm256_add_ps( c30, c31 ) );
+      _mm256_storeu_ps( ( float * ) &acc[ 4 * MATVEC_NR ], _mm256_add_ps( c40, c41 ) );
+      _mm256_storeu_ps( ( float * ) &acc[ 5 * MATVEC_NR ], _mm256_add_ps( c50, c51 ) );
+
+#else
+
+      micro_kernel_c( kc, ap, bp, acc );
+
+#endif
+   }
+   else
+   {
+      micro_kernel_c( kc, ap, bp, acc );
+   }
+
+   return;
+}
+
+/**
+   multiply_block
+
+   C += alpha * A * B, A is m by k, B is k by n, C is m by n
+*/
+
+static
+void
+multiply_block
+(
+   int32_t m,
+   int32_t n,
+   int32_t k,
+   Magnitude_type alpha,
+   Magnitude_type *a,
+   int32_t a_rs,
+   int32_t a_cs,
+   Magnitude_type *b,
+   int32_t b_rs,
+   int32_t b_cs,
+   Magnitude_type *c,
+   int32_t c_rs,
+   int32_t c_cs
+)
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t ic = 0;
+   int32_t ir = 0;
+   int32_t jc = 0;
+   int32_t jr = 0;
+   int32_t pc = 0;
+   int32_t mc = 0;
+   int32_t nc = 0;
+   int32_t kc = 0;
+   Magnitude_type *pack_a_buffer = NULL;
+   Magnitude_type *pack_b_buffer = NULL;
+   Magnitude_type *pc_item = NULL;
+   Magnitude_type acc[ MATVEC_MR * MATVEC_NR ];
+
+   pack_a_buffer
+      = ( Magnitude_type * ) calloc( ( MATVEC_MC + MATVEC_MR ) * MATVEC_KC, sizeof( Magnitude_type ) );
+   CHECK( "pack_a_buffer allocated correctly", pack_a_buffer != NULL );
+
+   pack_b_buffer
+      = ( Magnitude_type * ) calloc( ( MATVEC_NC + MATVEC_NR ) * MATVEC_KC, sizeof( Magnitude_type ) );
+   CHECK( "pack_b_buffer allocated correctly", pack_b_buffer != NULL );
+
+   for ( jc = 0; jc < n; jc = jc + MATVEC_NC )
+   {
+      nc = ( n - jc < MATVEC_NC ) ? n - jc : MATVEC_NC;
+
+      for ( pc = 0; pc < k; pc = pc + MATVEC_KC )
+      {
+         kc = ( k - pc < MATVEC_KC ) ? k - pc : MATVEC_KC;
+
+         pack_b( pack_b_buffer, &b[ pc * b_rs + jc * b_cs ], b_rs, b_cs, kc, nc );
+
+         for ( ic = 0; ic < m; ic = ic + MATVEC_MC )
+         {
+            mc = ( m - ic < MATVEC_MC ) ? m - ic : MATVEC_MC;
+
+            pack_a( pack_a_buffer, &a[ ic * a_rs + pc * a_cs ], a_rs, a_cs, mc, kc );
+
+            for ( jr = 0; jr < nc; jr = jr + MATVEC_NR )
+            {
+               for ( ir = 0; ir < mc; ir = ir + MATVEC_MR )
+               {
+                  micro_kernel( kc, &pack_a_buffer[ ir * kc ], &pack_b_buffer[ jr * kc ], acc );
+
+                  // add the block into C, leaving out the padding
+                  for ( i = 0; ( i < MATVEC_MR ) && ( ir + i < mc ); i++ )
+                  {
+                     pc_item = &c[ ( ic + ir + i ) * c_rs + ( jc + jr ) * c_cs ];
+                     for ( j = 0; ( j < MATVEC_NR ) && ( jr + j < nc ); j++ )
+                     {
+                        pc_item[ j * c_cs ] = pc_item[ j * c_cs ] + alpha * acc[ i * MATVEC_NR + j ];
+                     }
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   free( pack_a_buffer );
+   free( pack_b_buffer );
+
+   return;
+}
+
+/**
+   multiply
+
+   pa_result = pa * pa_other, pa is rows by columns, pa_other is columns
+   by other_columns, pa_result must hold rows by other_columns zeros
+
+   Real items are multiplied with multiply_block. Complex items are
+   multiplied as four real products of their real and imaginary parts,
+   which are read in place from the interleaved items. Items of any other
+   type use the item functions.
+*/
+
+static
+void
+multiply
+(
+   Type *pa,
+   Type *pa_other,
+   Type *pa_result,
+   int32_t rows,
+   int32_t columns,
+   int32_t other_columns
+)
+{
+   Type item = DEFAULT_VALUE;
+   Type item1 = DEFAULT_VALUE;
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+   Magnitude_type *ma = ( Magnitude_type * ) pa;
+   Magnitude_type *mb = ( Magnitude_type * ) pa_other;
+   Magnitude_type *mc = ( Magnitude_type * ) pa_result;
+
+   switch ( Type_Code )
+   {
+      case float32_type_code:
+      case float64_type_code:
+      {
+         multiply_block
+         (
+            rows, other_columns, columns, 1,
+            ma, columns, 1,
+            mb, other_columns, 1,
+            mc, other_columns, 1
+         );
+         break;
+      }
+
+      case complex64_type_code:
+      case complex128_type_code:
+      {
+         // real part: re( a ) * re( b ) - im( a ) * im( b )
+         multiply_block
+         (
+            rows, other_columns, columns, 1,
+            ma, 2 * columns, 2,
+            mb, 2 * other_columns, 2,
+            mc, 2 * other_columns, 2
+         );
+         multiply_block
+         (
+            rows, other_columns, columns, -1,
+            ma + 1, 2 * columns, 2,
+            mb + 1, 2 * other_columns, 2,
+            mc, 2 * other_columns, 2
+         );
+
+         // imaginary part: re( a ) * im( b ) + im( a ) * re( b )
+         multiply_block
+         (
+            rows, other_columns, columns, 1,
+            ma, 2 * columns, 2,
+            mb + 1, 2 * other_columns, 2,
+            mc + 1, 2 * other_columns, 2
+         );
+         multiply_block
+         (
+            rows, other_columns, columns, 1,
+            ma + 1, 2 * columns, 2,
+            mb, 2 * other_columns, 2,
+            mc + 1, 2 * other_columns, 2
+         );
+         break;
+      }
+
+      default:
+      {
+         for ( i = 0; i < rows; i++ )
+         {
+            for ( j = 0; j < other_columns; j++ )
+            {
+               item = DEFAULT_VALUE;
+               for( k = 0; k < columns; k++ )
+               {
+                  item1 = MULTIPLY_FUNCTION( pa[i * columns + k], pa_other[k * other_columns + j] );
+                  item = ADD_FUNCTION( item, item1 );
+                  DISPOSE_FUNCTION( item1 );
+               }
+               pa_result[i * other_columns + j] = item;
+            }
+         }
+         break;
+      }
+   }
+
+   return;
+}
+
+/**
+   Thread pool
+
+   An operation on a Matvec with thread_count above one and at least
+   thread_threshold items splits its rows into panels and runs one job per
+   panel on the pool. Every job computes each of its items with the same
+   arithmetic, in the same order, as the single threaded loop, so the
+   results do not depend on the number of threads or on how the rows are
+   split.
+*/
+
+/**
+   panel_bounds
+
+   compute the rows [*start, *end) of panel index of a step. Panel starts
+   are multiples of unit rows after first_row.
+
+   @param work the shared arguments of the step
+   @param index the panel index
+   @param unit the rows in a panel are a multiple of unit, except the last
+   @param start the first row of the panel
+   @param end one more than the last row of the panel
+*/
+
+static
+void
+panel_bounds( work_t *work, int32_t index, int32_t unit, int32_t *start, int32_t *end )
+{
+   int64_t count = (*work).rows - (*work).first_row;
+
+   *start = ( int32_t ) ( ( count * index / (*work).panel_count ) / unit * unit );
+
+   if ( index == (*work).panel_count - 1 )
+   {
+      *end = ( int32_t ) count;
+   }
+   else
+   {
+      *end = ( int32_t ) ( ( count * ( index + 1 ) / (*work).panel_count ) / unit * unit );
+   }
+
+   *start = *start + (*work).first_row;
+   *end = *end + (*work).first_row;
+
+   return;
+}
+
+/**
+   run_panels
+
+   run job on the panels of the rows from first_row to rows - 1 of work,
+   on the pool of current when it has enough items, otherwise as a single
+   panel on the calling thread
+
+   @param current the Matvec whose threads and threshold are used
+   @param job the job function
+   @param work the shared arguments of the step
+   @param panels_per_thread the number of panels to make per thread
+*/
+
+static
+void
+run_panels
+(
+   Matvec_type( Prefix ) *current,
+   void (*job)( void *arg, int32_t index ),
+   work_t *work,
+   int32_t panels_per_thread
+)
+{
+   int32_t count = (*work).rows - (*work).first_row;
+
+   (*work).panel_count = 1;
+
+   if
+   (
+      ( (*current).thread_count > 1 )
+      &&
+      ( ( int64_t ) (*current).n_rows * (*current).n_columns >= (*current).thread_threshold )
+   )
+   {
+      (*work).panel_count = (*current).thread_count * panels_per_thread;
+
+      if ( (*work).panel_count > count )
+      {
+         (*work).panel_count = count;
+      }
+
+      if ( (*work).panel_count < 1 )
+      {
+         (*work).panel_count = 1;
+      }
+   }
+
+   pool_run( &(*current).pool, job, work, (*work).panel_count );
+
+   return;
+}
+
+/**
+   add_job
+
+   pa = pa + pa_other on the rows of one panel
+*/
+
+static
+void
+add_job( void *arg, int32_t index )
+{
+   work_t *work = ( work_t * ) arg;
+   int32_t start = 0;
+   int32_t end = 0;
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t columns = (*work).columns;
+   Type *pa = (*work).pa;
+   Type *pa_other = (*work).pa_other;
+
+   panel_bounds( work, index, 1, &start, &end );
+
+   for ( i = start; i < end; i++ )
+   {
+      for ( j = 0; j < columns; j++ )
+      {
+         SET_FROM( pa[i * columns + j], ADD_FUNCTION( pa[i * columns + j], pa_other[i * columns + j] ) );
+      }
+   }
+
+   return;
+}
+
+/**
+   added_job
+
+   pa_result = pa + pa_other on the rows of one panel
+*/
+
+static
+void
+added_job( void *arg, int32_t index )
+{
+   work_t *work = ( work_t * ) arg;
+   int32_t start = 0;
+   int32_t end = 0;
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t columns = (*work).columns;
+   Type *pa = (*work).pa;
+   Type *pa_other = (*work).pa_other;
+   Type *pa_result = (*work).pa_result;
+
+   panel_bounds( work, index, 1, &start, &end );
+
+   for ( i = start; i < end; i++ )
+   {
+      for ( j = 0; j < columns; j++ )
+      {
+         pa_result[i * columns + j] = ADD_FUNCTION( pa[i * columns + j], pa_other[i * columns + j] );
+      }
+   }
+
+   return;
+}
+
+/**
+   multiply_job
+
+   pa_result = pa * pa_other on the rows of one panel. Panels are a
+   multiple of MATVEC_MR rows so that only the last one has a short strip.
+*/
+
+static
+void
+multiply_job( void *arg, int32_t index )
+{
+   work_t *work = ( work_t * ) arg;
+   int32_t start = 0;
+   int32_t end = 0;
+
+   panel_bounds( work, index, MATVEC_MR, &start, &end );
+
+   if ( end > start )
+   {
+      multiply
+      (
+         (*work).pa + start * (*work).columns,
+         (*work).pa_other,
+         (*work).pa_result + start * (*work).other_columns,
+         end - start,
+         (*work).columns,
+         (*work).other_columns
+      );
+   }
+
+   return;
+}
+
+/**
+   item_by_item_multiply_job
+
+   pa = pa * pa_other item by item on the rows of one panel
+*/
+
+static
+void
+item_by_item_multiply_job( void *arg, int32_t index )
+{
+   work_t *work = ( work_t * ) arg;
+   Type item = DEFAULT_VALUE;
+   int32_t start = 0;
+   int32_t end = 0;
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t columns = (*work).columns;
+   Type *pa = (*work).pa;
+   Type *pa_other = (*work).pa_other;
 
-   Macros that must be present (external to this file):
+   panel_bounds( work, index, 1, &start, &end );
 
-   DEFAULT_VALUE              -  constant that is the default value for type (zero)
-   ONE_VALUE                  -  constant that is the "one" value for type
-   IS_INVERTIBLE              -  constant 0 if not or 1 if type is invertible
-   NEGATE_FUNCTION            -  additive inverse of type value
-   ADD_FUNCTION               -  adds two type values
-   SQUARED_MAGNITUDE_FUNCTION -  squared magnitude of type value
-   MULTIPLY_FUNCTION          -  multiplies two type values
-   INVERSE_FUNCTION           -  multiplicative inverse of type value
-   CONJUGATE_FUNCTION         -  complex conjugate of type value
-   EQUAL_FUNCTION             -  1 if items are equal, 0 otherwise
-   DUPLICATE_FUNCTION         -  makes duplicate of a type value
-   SET_FROM                   -  sets value from another
-   DISPOSE_FUNCTION           -  frees a type value
+   for ( i = start; i < end; i++ )
+   {
+      for ( j = 0; j < columns; j++ )
+      {
+         item = MULTIPLY_FUNCTION( pa[i * columns + j], pa_other[i * columns + j ] );
+         SET_FROM( pa[i * columns + j], item );
+         DISPOSE_FUNCTION( item );
+      }
+   }
 
-*/
+   return;
+}
 
 /**
-   Matvec structure
+   item_by_item_multiplied_job
+
+   pa_result = pa * pa_other item by item on the rows of one panel
 */
 
-struct Matvec_struct( Prefix )
+static
+void
+item_by_item_multiplied_job( void *arg, int32_t index )
 {
-   int32_t _type;
-   int32_t _item_type;
-
-   // number of columns
-   int32_t n_columns;
+   work_t *work = ( work_t * ) arg;
+   int32_t start = 0;
+   int32_t end = 0;
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t columns = (*work).columns;
+   Type *pa = (*work).pa;
+   Type *pa_other = (*work).pa_other;
+   Type *pa_result = (*work).pa_result;
 
-   // number of rows
-   int32_t n_rows;
+   panel_bounds( work, index, 1, &start, &end );
 
-   // multithread values if we include threading support
-   MULTITHREAD_MUTEX_DEFINITION( mutex );
-   // the array of data
-   Type *a;
+   for ( i = start; i < end; i++ )
+   {
+      for ( j = 0; j < columns; j++ )
+      {
+         pa_result[i * columns + j] = MULTIPLY_FUNCTION( pa[i * columns + j], pa_other[i * columns + j ] );
+      }
+   }
 
-};
+   return;
+}
 
 /**
-   Invariant
-*/
+   transpose_job
 
-#if INVARIANT_CONDITIONAL != 0
+   swap the items of the rows of one panel on and above the diagonal with
+   their mirror images below it
+*/
 
 static
-int32_t
-num_rows_and_num_columns_positive( Matvec_type( Prefix ) *p )
+void
+transpose_job( void *arg, int32_t index )
 {
-   int32_t result = 0;
+   work_t *work = ( work_t * ) arg;
+   Type item1 = DEFAULT_VALUE;
+   Type item2 = DEFAULT_VALUE;
+   int32_t start = 0;
+   int32_t end = 0;
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t columns = (*work).columns;
+   Type *pa = (*work).pa;
 
-   if ( ( (*p).n_rows > 0 ) && ( (*p).n_columns > 0 ) )
+   panel_bounds( work, index, 1, &start, &end );
+
+   for ( i = start; i < end; i++ )
    {
-      result = 1;
+      for ( j = i; j < columns; j++ )
+      {
+         item1 = pa[i * columns + j];
+         item2 = pa[j * columns + i];
+         pa[i * columns + j] = item2;
+         pa[j * columns + i] = item1;
+      }
    }
 
-   return result;
+   return;
 }
 
+/**
+   transposed_job
+
+   copy the rows of one panel of pa into the columns of pa_result
+*/
+
 static
-int32_t
-array_is_not_null( Matvec_type( Prefix ) *p )
+void
+transposed_job( void *arg, int32_t index )
 {
-   int32_t result = 0;
+   work_t *work = ( work_t * ) arg;
+   Type item = DEFAULT_VALUE;
+   int32_t start = 0;
+   int32_t end = 0;
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t rows = (*work).rows;
+   int32_t columns = (*work).columns;
+   Type *pa = (*work).pa;
+   Type *pa_result = (*work).pa_result;
 
-   if ( (*p).a != NULL )
+   panel_bounds( work, index, 1, &start, &end );
+
+   for ( i = start; i < end; i++ )
    {
-      result = 1;
+      for ( j = 0; j < columns; j++ )
+      {
+         item = pa[i * columns + j];
+         pa_result[j * rows + i] = DUPLICATE_FUNCTION( item );
+      }
    }
 
-   return result;
+   return;
 }
 
+/**
+   invert_job
+
+   one elimination step of Matvec_invert and Matvec_inverse: subtract
+   multiples of the pivot row of pa and pa_other from the other rows of
+   one panel to make their items in the pivot column zero
+*/
+
 static
-void invariant( Matvec_type( Prefix ) *p )
+void
+invert_job( void *arg, int32_t index )
 {
-   assert( ( ( void ) "num rows and num columns positive", num_rows_and_num_columns_positive( p ) ) );
-   assert( ( ( void ) "array is not null", array_is_not_null( p ) ) );
+   work_t *work = ( work_t * ) arg;
+   Type item1 = DEFAULT_VALUE;
+   Type item2 = DEFAULT_VALUE;
+   Type item3 = DEFAULT_VALUE;
+   Type item4 = DEFAULT_VALUE;
+   int32_t start = 0;
+   int32_t end = 0;
+   int32_t i = (*work).pivot;
+   int32_t j = 0;
+   int32_t k = 0;
+   int32_t columns = (*work).columns;
+   Type *pa = (*work).pa;
+   Type *pb = (*work).pa_other;
+
+   panel_bounds( work, index, 1, &start, &end );
+
+   for ( k = start; k < end; k++ )
+   {
+      if ( k != i )
+      {
+         item1 = pa[k * columns + i];
+
+         for( j = 0; j < columns; j++ )
+         {
+            item2 = MULTIPLY_FUNCTION( pa[i * columns + j], item1 );
+            item3 = NEGATE_FUNCTION( item2 );
+            item4 = ADD_FUNCTION( pa[k * columns + j], item3 );
+            SET_FROM( pa[k * columns + j], item4 );
+            DISPOSE_FUNCTION( item2 );
+            DISPOSE_FUNCTION( item3 );
+            DISPOSE_FUNCTION( item4 );
+
+            item2 = MULTIPLY_FUNCTION( pb[i * columns + j], item1 );
+            item3 = NEGATE_FUNCTION( item2 );
+            item4 = ADD_FUNCTION( pb[k * columns + j], item3 );
+            SET_FROM( pb[k * columns + j], item4 );
+            DISPOSE_FUNCTION( item2 );
+            DISPOSE_FUNCTION( item3 );
+            DISPOSE_FUNCTION( item4 );
+
+         }
+
+         DISPOSE_FUNCTION( item1 );
+      }
+   }
+
    return;
 }
 
-#else
+/**
+   determinant_job
+
+   one elimination step of Matvec_determinant: subtract multiples of the
+   pivot row from the rows of one panel below it to make their items in
+   the pivot column zero
+*/
 
 static
-void invariant( p )
+void
+determinant_job( void *arg, int32_t index )
 {
+   work_t *work = ( work_t * ) arg;
+   Type factor = DEFAULT_VALUE;
+   Type item1 = DEFAULT_VALUE;
+   Type item2 = DEFAULT_VALUE;
+   Type item3 = DEFAULT_VALUE;
+   int32_t start = 0;
+   int32_t end = 0;
+   int32_t i = (*work).pivot;
+   int32_t j = 0;
+   int32_t k = 0;
+   int32_t rows = (*work).rows;
+   int32_t columns = (*work).columns;
+   Type *pa = (*work).pa;
+
+   panel_bounds( work, index, 1, &start, &end );
+
+   for( j = start; j < end; j++ )
+   {
+      if ( EQUAL_FUNCTION( pa[j * columns + i], DEFAULT_VALUE ) == 0 )
+      {
+         item1 = INVERSE_FUNCTION( pa[i * columns + i] );
+         factor = MULTIPLY_FUNCTION( pa[j * columns + i], item1 );
+         DISPOSE_FUNCTION( item1 );
+         for( k = 0; k < rows; k++ )
+         {
+            item1 = MULTIPLY_FUNCTION( factor, pa[i * columns + k] );
+            item2 = NEGATE_FUNCTION( item1 );
+            item3 = ADD_FUNCTION( pa[j * columns + k], item2 );
+            SET_FROM( pa[j * columns + k], item3 );
+            DISPOSE_FUNCTION( item1 );
+            DISPOSE_FUNCTION( item2 );
+            DISPOSE_FUNCTION( item3 );
+         }
+         DISPOSE_FUNCTION( factor );
+      }
+   }
+
    return;
 }
 
-#endif
-
 /**
    Matvec_make
 */
@@ -184,6 +1259,10 @@ Matvec_make( Prefix )( int32_t rows, int32_t columns )
    (*result).n_rows = rows;
    (*result).n_columns = columns;
 
+   // operations run on the calling thread until set_thread_count
+   (*result).thread_count = 1;
+   (*result).thread_threshold = MATVEC_DEFAULT_THREAD_THRESHOLD;
+
    MULTITHREAD_MUTEX_INIT( (*result).mutex );
 
    // allocate array
@@ -232,6 +1311,10 @@ Matvec_make_row_vector( Prefix )( int32_t columns )
    (*result).n_rows = rows;
    (*result).n_columns = columns;
 
+   // operations run on the calling thread until set_thread_count
+   (*result).thread_count = 1;
+   (*result).thread_threshold = MATVEC_DEFAULT_THREAD_THRESHOLD;
+
    MULTITHREAD_MUTEX_INIT( (*result).mutex );
 
    // allocate array
@@ -280,6 +1363,10 @@ Matvec_make_column_vector( Prefix )( int32_t rows )
    (*result).n_rows = rows;
    (*result).n_columns = columns;
 
+   // operations run on the calling thread until set_thread_count
+   (*result).thread_count = 1;
+   (*result).thread_threshold = MATVEC_DEFAULT_THREAD_THRESHOLD;
+
    MULTITHREAD_MUTEX_INIT( (*result).mutex );
 
    // allocate array
@@ -331,6 +1418,10 @@ Matvec_make_from( Prefix )( Matvec_type( Prefix ) *other )
    (*result).n_rows = rows;
    (*result).n_columns = columns;
 
+   // operations run on the calling thread until set_thread_count
+   (*result).thread_count = 1;
+   (*result).thread_threshold = MATVEC_DEFAULT_THREAD_THRESHOLD;
+
    MULTITHREAD_MUTEX_INIT( (*result).mutex );
 
    // allocate array
@@ -383,6 +1474,10 @@ Matvec_make_from_args( Prefix )( int32_t n_rows, int32_t n_columns, int32_t coun
    (*result).n_rows = rows;
    (*result).n_columns = columns;
 
+   // operations run on the calling thread until set_thread_count
+   (*result).thread_count = 1;
+   (*result).thread_threshold = MATVEC_DEFAULT_THREAD_THRESHOLD;
+
    MULTITHREAD_MUTEX_INIT( (*result).mutex );
 
    // allocate array
@@ -410,71 +1505,179 @@ Matvec_make_from_args( Prefix )( int32_t n_rows, int32_t n_columns, int32_t coun
 }
 
 /**
-   Matvec_dispose
+   Matvec_dispose
+*/
+
+void
+Matvec_dispose( Prefix )( Matvec_type( Prefix ) **current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current not null", *current != NULL );
+   PRECONDITION( "current type OK", ( (**current)._type == MATVEC_TYPE ) && ( (**current)._item_type == Type_Code ) );
+   LOCK( (**current).mutex );
+   INVARIANT(*current);
+
+   // delete current array
+   free( (**current).a );
+   (**current).a = NULL;
+
+   if ( (**current).thread_count > 1 )
+   {
+      pool_stop( &(**current).pool );
+   }
+
+   MULTITHREAD_MUTEX_DESTROY( (**current).mutex );
+
+   // delete current struct
+   free(*current);
+
+   // set current to NULL
+   *current = NULL;
+
+   return;
+}
+
+/**
+   Matvec_deep_dispose
+*/
+
+void
+Matvec_deep_dispose( Prefix )( Matvec_type( Prefix ) **current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current not null", *current != NULL );
+   PRECONDITION( "current type OK", ( (**current)._type == MATVEC_TYPE ) && ( (**current)._item_type == Type_Code ) );
+   LOCK( (**current).mutex );
+   INVARIANT(*current);
+
+   int32_t rows = (**current).n_rows;
+   int32_t columns = (**current).n_columns;
+   int32_t i = 0;
+   int32_t j = 0;
+
+   // delete current items
+   for ( i = 0; i < rows; i++ )
+   {
+      for ( j = 0; j < columns; j++ )
+      {
+         DISPOSE_FUNCTION( (**current).a[ i * columns + j ] );
+      }
+   }
+
+   // delete current array
+   free( (**current).a );
+   (**current).a = NULL;
+
+   if ( (**current).thread_count > 1 )
+   {
+      pool_stop( &(**current).pool );
+   }
+
+   MULTITHREAD_MUTEX_DESTROY( (**current).mutex );
+
+   // delete current struct
+   free(*current);
+
+   // set current to NULL
+   *current = NULL;
+
+   return;
+}
+
+/**
+   Matvec_thread_count
+*/
+
+int32_t
+Matvec_thread_count( Prefix )( Matvec_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", ( (*current)._type == MATVEC_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = (*current).thread_count;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   Matvec_thread_threshold
 */
 
-void
-Matvec_dispose( Prefix )( Matvec_type( Prefix ) **current )
+int32_t
+Matvec_thread_threshold( Prefix )( Matvec_type( Prefix ) *current )
 {
    PRECONDITION( "current not null", current != NULL );
-   PRECONDITION( "current not null", *current != NULL );
-   PRECONDITION( "current type OK", ( (**current)._type == MATVEC_TYPE ) && ( (**current)._item_type == Type_Code ) );
-   LOCK( (**current).mutex );
-   INVARIANT(*current);
-
-   // delete current array
-   free( (**current).a );
-   (**current).a = NULL;
-
-   MULTITHREAD_MUTEX_DESTROY( (**current).mutex );
+   PRECONDITION( "current type OK", ( (*current)._type == MATVEC_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
 
-   // delete current struct
-   free(*current);
+   int32_t result = (*current).thread_threshold;
 
-   // set current to NULL
-   *current = NULL;
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
 
-   return;
+   return result;
 }
 
 /**
-   Matvec_deep_dispose
+   Matvec_set_thread_count
 */
 
 void
-Matvec_deep_dispose( Prefix )( Matvec_type( Prefix ) **current )
+Matvec_set_thread_count( Prefix )( Matvec_type( Prefix ) *current, int32_t thread_count )
 {
    PRECONDITION( "current not null", current != NULL );
-   PRECONDITION( "current not null", *current != NULL );
-   PRECONDITION( "current type OK", ( (**current)._type == MATVEC_TYPE ) && ( (**current)._item_type == Type_Code ) );
-   LOCK( (**current).mutex );
-   INVARIANT(*current);
-
-   int32_t rows = (**current).n_rows;
-   int32_t columns = (**current).n_columns;
-   int32_t i = 0;
-   int32_t j = 0;
+   PRECONDITION( "current type OK", ( (*current)._type == MATVEC_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   PRECONDITION( "thread_count positive", thread_count > 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
 
-   // delete current items
-   for ( i = 0; i < rows; i++ )
+   if ( thread_count != (*current).thread_count )
    {
-      for ( j = 0; j < columns; j++ )
+      // restart the worker threads
+      if ( (*current).thread_count > 1 )
       {
-         DISPOSE_FUNCTION( (**current).a[ i * columns + j ] );
+         pool_stop( &(*current).pool );
+      }
+
+      (*current).thread_count = thread_count;
+
+      if ( (*current).thread_count > 1 )
+      {
+         pool_start( &(*current).pool, (*current).thread_count - 1 );
       }
    }
 
-   // delete current array
-   free( (**current).a );
-   (**current).a = NULL;
+   POSTCONDITION( "thread_count set", (*current).thread_count == thread_count );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
 
-   MULTITHREAD_MUTEX_DESTROY( (**current).mutex );
+   return;
+}
 
-   // delete current struct
-   free(*current);
+/**
+   Matvec_set_thread_threshold
+*/
 
-   // set current to NULL
-   *current = NULL;
+void
+Matvec_set_thread_threshold( Prefix )( Matvec_type( Prefix ) *current, int32_t thread_threshold )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", ( (*current)._type == MATVEC_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   PRECONDITION( "thread_threshold not negative", thread_threshold >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   (*current).thread_threshold = thread_threshold;
+
+   POSTCONDITION( "thread_threshold set", (*current).thread_threshold == thread_threshold );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
 
    return;
 }
@@ -2439,20 +3642,15 @@ Matvec_add( Prefix )( Matvec_type( Prefix ) *current, Matvec_type( Prefix ) *oth
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   int32_t i = 0;
-   int32_t j = 0;
-   int32_t rows = (*current).n_rows;
-   int32_t columns = (*current).n_columns;
-   Type *pa = (*current).a;
-   Type *pa_other = (*other).a;
+   work_t work;
 
-   for ( i = 0; i < rows; i++ )
-   {
-      for ( j = 0; j < columns; j++ )
-      {
-         SET_FROM( pa[i * columns + j], ADD_FUNCTION( pa[i * columns + j], pa_other[i * columns + j] ) );
-      }
-   }
+   memset( &work, 0, sizeof( work ) );
+   work.pa = (*current).a;
+   work.pa_other = (*other).a;
+   work.rows = (*current).n_rows;
+   work.columns = (*current).n_columns;
+
+   run_panels( current, add_job, &work, MATVEC_PANELS_PER_THREAD );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -2476,24 +3674,18 @@ Matvec_added( Prefix )( Matvec_type( Prefix ) *current, Matvec_type( Prefix ) *o
    INVARIANT( current );
 
    Matvec_type( Prefix ) *result = NULL;
-   int32_t i = 0;
-   int32_t j = 0;
-   int32_t rows = (*current).n_rows;
-   int32_t columns = (*current).n_columns;
-   Type *pa = (*current).a;
-   Type *pa_other = (*other).a;
-   Type *pa_result = NULL;
+   work_t work;
 
    result = Matvec_make( Prefix )( (*current).n_rows, (*current).n_columns );
-   pa_result = (*result).a;
 
-   for ( i = 0; i < rows; i++ )
-   {
-      for ( j = 0; j < columns; j++ )
-      {
-         pa_result[i * columns + j] = ADD_FUNCTION( pa[i * columns + j], pa_other[i * columns + j] );
-      }
-   }
+   memset( &work, 0, sizeof( work ) );
+   work.pa = (*current).a;
+   work.pa_other = (*other).a;
+   work.pa_result = (*result).a;
+   work.rows = (*current).n_rows;
+   work.columns = (*current).n_columns;
+
+   run_panels( current, added_job, &work, MATVEC_PANELS_PER_THREAD );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -2605,44 +3797,25 @@ Matvec_multiply( Prefix )( Matvec_type( Prefix ) *current, Matvec_type( Prefix )
    INVARIANT( current );
 
    Matvec_type( Prefix ) *temp = NULL;
-   Type item1 = DEFAULT_VALUE;
-   int32_t i = 0;
-   int32_t j = 0;
-   int32_t k = 0;
-   int32_t rows = (*current).n_rows;
-   int32_t columns = (*current).n_columns;
-   int32_t other_rows = (*other).n_rows;
-   int32_t other_columns = (*other).n_columns;
-   Type item = DEFAULT_VALUE;
-   Type *pa = (*current).a;
-   Type *pa_other = (*other).a;
-   Type *pa_temp = NULL;
+   Type *pa = NULL;
+   work_t work;
 
    temp = Matvec_make( Prefix )( (*current).n_rows, (*current).n_columns );
-   pa_temp = (*temp).a;
 
-   for ( i = 0; i < rows; i++ )
-   {
-      for ( j = 0; j < other_columns; j++ )
-      {
-         item = DEFAULT_VALUE;
-         for( k = 0; k < columns; k++ )
-         {
-            item1 = MULTIPLY_FUNCTION( pa[i * columns + k], pa_other[k * columns + j] );
-            item = ADD_FUNCTION( item, item1 );
-            DISPOSE_FUNCTION( item1 );
-         }
-         pa_temp[i * columns + j] = item;
-      }
-   }
+   memset( &work, 0, sizeof( work ) );
+   work.pa = (*current).a;
+   work.pa_other = (*other).a;
+   work.pa_result = (*temp).a;
+   work.rows = (*current).n_rows;
+   work.columns = (*current).n_columns;
+   work.other_columns = (*other).n_columns;
 
-   for ( i = 0; i < rows; i++ )
-   {
-      for ( j = 0; j < other_rows; j++ )
-      {
-         SET_FROM( pa[i * columns + j], pa_temp[i * columns + j] );
-      }
-   }
+   run_panels( current, multiply_job, &work, 1 );
+
+   // swap the product into current, the old items are disposed with temp
+   pa = (*current).a;
+   (*current).a = (*temp).a;
+   (*temp).a = pa;
 
    Matvec_deep_dispose( Prefix )( &temp );
 
@@ -2668,35 +3841,19 @@ Matvec_multiplied( Prefix )( Matvec_type( Prefix ) *current, Matvec_type( Prefix
    INVARIANT( current );
 
    Matvec_type( Prefix ) *result = NULL;
-   Type item1 = DEFAULT_VALUE;
-   int32_t i = 0;
-   int32_t j = 0;
-   int32_t k = 0;
-   int32_t rows = (*current).n_rows;
-   int32_t columns = (*current).n_columns;
-   int32_t other_columns = (*other).n_columns;
-   Type item = DEFAULT_VALUE;
-   Type *pa = (*current).a;
-   Type *pa_other = (*other).a;
-   Type *pa_result = NULL;
+   work_t work;
 
-   result  = Matvec_make( Prefix )( (*current).n_rows, (*other).n_columns );
-   pa_result = (*result).a;
+   result = Matvec_make( Prefix )( (*current).n_rows, (*other).n_columns );
 
-   for ( i = 0; i < rows; i++ )
-   {
-      for ( j = 0; j < other_columns; j++ )
-      {
-         item = DEFAULT_VALUE;
-         for( k = 0; k < columns; k++ )
-         {
-            item1 = MULTIPLY_FUNCTION( pa[i * columns + k], pa_other[k * other_columns + j] );
-            item = ADD_FUNCTION( item, item1 );
-            DISPOSE_FUNCTION( item1 );
-         }
-         pa_result[i * other_columns + j] = item;
-      }
-   }
+   memset( &work, 0, sizeof( work ) );
+   work.pa = (*current).a;
+   work.pa_other = (*other).a;
+   work.pa_result = (*result).a;
+   work.rows = (*current).n_rows;
+   work.columns = (*current).n_columns;
+   work.other_columns = (*other).n_columns;
+
+   run_panels( current, multiply_job, &work, 1 );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -3018,23 +4175,15 @@ Matvec_item_by_item_multiply( Prefix )( Matvec_type( Prefix ) *current, Matvec_t
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   Type item = DEFAULT_VALUE;
-   int32_t i = 0;
-   int32_t j = 0;
-   int32_t rows = (*current).n_rows;
-   int32_t columns = (*current).n_columns;
-   Type *pa = (*current).a;
-   Type *pa_other = (*other).a;
+   work_t work;
 
-   for ( i = 0; i < rows; i++ )
-   {
-      for ( j = 0; j < columns; j++ )
-      {
-         item = MULTIPLY_FUNCTION( pa[i * columns + j], pa_other[i * columns + j ] );
-         SET_FROM( pa[i * columns + j], item );
-         DISPOSE_FUNCTION( item );
-      }
-   }
+   memset( &work, 0, sizeof( work ) );
+   work.pa = (*current).a;
+   work.pa_other = (*other).a;
+   work.rows = (*current).n_rows;
+   work.columns = (*current).n_columns;
+
+   run_panels( current, item_by_item_multiply_job, &work, MATVEC_PANELS_PER_THREAD );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -3058,26 +4207,18 @@ Matvec_item_by_item_multiplied( Prefix )( Matvec_type( Prefix ) *current, Matvec
    INVARIANT( current );
 
    Matvec_type( Prefix ) *result = NULL;
-   Type item = DEFAULT_VALUE;
-   int32_t i = 0;
-   int32_t j = 0;
-   int32_t rows = (*current).n_rows;
-   int32_t columns = (*current).n_columns;
-   Type *pa = (*current).a;
-   Type *pa_other = (*other).a;
-   Type *pa_result = NULL;
+   work_t work;
 
    result = Matvec_make( Prefix )( (*current).n_rows, (*current).n_columns );
-   pa_result = (*result).a;
 
-   for ( i = 0; i < rows; i++ )
-   {
-      for ( j = 0; j < columns; j++ )
-      {
-         item = MULTIPLY_FUNCTION( pa[i * columns + j], pa_other[i * columns + j ] );
-         pa_result[i * columns + j] =  item ;
-      }
-   }
+   memset( &work, 0, sizeof( work ) );
+   work.pa = (*current).a;
+   work.pa_other = (*other).a;
+   work.pa_result = (*result).a;
+   work.rows = (*current).n_rows;
+   work.columns = (*current).n_columns;
+
+   run_panels( current, item_by_item_multiplied_job, &work, MATVEC_PANELS_PER_THREAD );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -3246,24 +4387,14 @@ Matvec_transpose( Prefix )( Matvec_type( Prefix ) *current )
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   Type item1 = DEFAULT_VALUE;
-   Type item2 = DEFAULT_VALUE;
-   int32_t i = 0;
-   int32_t j = 0;
-   int32_t rows = (*current).n_rows;
-   int32_t columns = (*current).n_columns;
-   Type *pa = (*current).a;
+   work_t work;
 
-   for ( i = 0; i < rows; i++ )
-   {
-      for ( j = i; j < columns; j++ )
-      {
-         item1 = pa[i * columns + j];
-         item2 = pa[j * columns + i];
-         pa[i * columns + j] = item2;
-         pa[j * columns + i] = item1;
-      }
-   }
+   memset( &work, 0, sizeof( work ) );
+   work.pa = (*current).a;
+   work.rows = (*current).n_rows;
+   work.columns = (*current).n_columns;
+
+   run_panels( current, transpose_job, &work, MATVEC_PANELS_PER_THREAD );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -3284,25 +4415,17 @@ Matvec_transposed( Prefix )( Matvec_type( Prefix ) *current )
    INVARIANT( current );
 
    Matvec_type( Prefix ) *result = NULL;
-   Type item = DEFAULT_VALUE;
-   int32_t i = 0;
-   int32_t j = 0;
-   int32_t rows = (*current).n_rows;
-   int32_t columns = (*current).n_columns;
-   Type *pa = (*current).a;
-   Type *pa_result = NULL;
+   work_t work;
 
    result = Matvec_make( Prefix )( (*current).n_columns, (*current).n_rows );
-   pa_result = (*result).a;
 
-   for ( i = 0; i < rows; i++ )
-   {
-      for ( j = 0; j < columns; j++ )
-      {
-         item = pa[i * columns + j];
-         pa_result[j * rows + i] = DUPLICATE_FUNCTION( item );
-      }
-   }
+   memset( &work, 0, sizeof( work ) );
+   work.pa = (*current).a;
+   work.pa_result = (*result).a;
+   work.rows = (*current).n_rows;
+   work.columns = (*current).n_columns;
+
+   run_panels( current, transposed_job, &work, MATVEC_PANELS_PER_THREAD );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -3481,8 +4604,6 @@ Matvec_invert( Prefix )( Matvec_type( Prefix ) *current )
    Type item = DEFAULT_VALUE;
    Type item1 = DEFAULT_VALUE;
    Type item2 = DEFAULT_VALUE;
-   Type item3 = DEFAULT_VALUE;
-   Type item4 = DEFAULT_VALUE;
    int32_t flag = 0;
    int32_t i = 0;
    int32_t j = 0;
@@ -3492,6 +4613,7 @@ Matvec_invert( Prefix )( Matvec_type( Prefix ) *current )
    Type *pa_current = (*current).a;
    Type *pa = NULL;
    Type *pb = NULL;
+   work_t work;
 
 
    a = Matvec_make_from( Prefix )( current );
@@ -3500,6 +4622,12 @@ Matvec_invert( Prefix )( Matvec_type( Prefix ) *current )
    b = Matvec_make( Prefix )( (*current).n_columns, (*current).n_rows );
    pb = (*b).a;
 
+   memset( &work, 0, sizeof( work ) );
+   work.pa = pa;
+   work.pa_other = pb;
+   work.rows = rows;
+   work.columns = columns;
+
    // set b to identity matrix
    for ( i = 0; i < rows; i++ )
    {
@@ -3558,35 +4686,8 @@ Matvec_invert( Prefix )( Matvec_type( Prefix ) *current )
       DISPOSE_FUNCTION( item1 );
 
       // now subtract multiple of row i to make other elements in column i zero
-      for ( k = 0; k < rows; k++ )
-      {
-         if ( k != i )
-         {
-            item1 = pa[k * columns + i];
-
-            for( j = 0; j < columns; j++ )
-            {
-               item2 = MULTIPLY_FUNCTION( pa[i * columns + j], item1 );
-               item3 = NEGATE_FUNCTION( item2 );
-               item4 = ADD_FUNCTION( pa[k * columns + j], item3 );
-               SET_FROM( pa[k * columns + j], item4 );
-               DISPOSE_FUNCTION( item2 );
-               DISPOSE_FUNCTION( item3 );
-               DISPOSE_FUNCTION( item4 );
-
-               item2 = MULTIPLY_FUNCTION( pb[i * columns + j], item1 );
-               item3 = NEGATE_FUNCTION( item2 );
-               item4 = ADD_FUNCTION( pb[k * columns + j], item3 );
-               SET_FROM( pb[k * columns + j], item4 );
-               DISPOSE_FUNCTION( item2 );
-               DISPOSE_FUNCTION( item3 );
-               DISPOSE_FUNCTION( item4 );
-
-            }
-
-            DISPOSE_FUNCTION( item1 );
-         }
-      }
+      work.pivot = i;
+      run_panels( current, invert_job, &work, MATVEC_PANELS_PER_THREAD );
 
    }
 
@@ -3626,8 +4727,6 @@ Matvec_inverse( Prefix )( Matvec_type( Prefix ) *current )
    Type item = DEFAULT_VALUE;
    Type item1 = DEFAULT_VALUE;
    Type item2 = DEFAULT_VALUE;
-   Type item3 = DEFAULT_VALUE;
-   Type item4 = DEFAULT_VALUE;
    int32_t flag = 0;
    int32_t i = 0;
    int32_t j = 0;
@@ -3637,6 +4736,7 @@ Matvec_inverse( Prefix )( Matvec_type( Prefix ) *current )
    Type *pa_current = (*current).a;
    Type *pa = NULL;
    Type *pb = NULL;
+   work_t work;
 
    a = Matvec_make_from( Prefix )( current );
    pa = (*a).a;
@@ -3644,6 +4744,12 @@ Matvec_inverse( Prefix )( Matvec_type( Prefix ) *current )
    b = Matvec_make( Prefix )( (*current).n_columns, (*current).n_rows );
    pb = (*b).a;
 
+   memset( &work, 0, sizeof( work ) );
+   work.pa = pa;
+   work.pa_other = pb;
+   work.rows = rows;
+   work.columns = columns;
+
    // set b to identity matrix
    for ( i = 0; i < rows; i++ )
    {
@@ -3700,35 +4806,8 @@ Matvec_inverse( Prefix )( Matvec_type( Prefix ) *current )
 
       DISPOSE_FUNCTION( item1 );
 
-      for ( k = 0; k < rows; k++ )
-      {
-         if ( k != i )
-         {
-            item1 = pa[k * columns + i];
-
-            for( j = 0; j < columns; j++ )
-            {
-               item2 = MULTIPLY_FUNCTION( pa[i * columns + j], item1 );
-               item3 = NEGATE_FUNCTION( item2 );
-               item4 = ADD_FUNCTION( pa[k * columns + j], item3 );
-               SET_FROM( pa[k * columns + j], item4 );
-               DISPOSE_FUNCTION( item2 );
-               DISPOSE_FUNCTION( item3 );
-               DISPOSE_FUNCTION( item4 );
-
-               item2 = MULTIPLY_FUNCTION( pb[i * columns + j], item1 );
-               item3 = NEGATE_FUNCTION( item2 );
-               item4 = ADD_FUNCTION( pb[k * columns + j], item3 );
-               SET_FROM( pb[k * columns + j], item4 );
-               DISPOSE_FUNCTION( item2 );
-               DISPOSE_FUNCTION( item3 );
-               DISPOSE_FUNCTION( item4 );
-
-            }
-
-            DISPOSE_FUNCTION( item1 );
-         }
-      }
+      work.pivot = i;
+      run_panels( current, invert_job, &work, MATVEC_PANELS_PER_THREAD );
 
    }
 
@@ -3755,11 +4834,8 @@ Matvec_determinant( Prefix )( Matvec_type( Prefix ) *current )
 
    Matvec_type( Prefix ) *a = NULL;
    Type result = ONE_VALUE;
-   Type factor = DEFAULT_VALUE;
    Type item = DEFAULT_VALUE;
    Type item1 = DEFAULT_VALUE;
-   Type item2 = DEFAULT_VALUE;
-   Type item3 = DEFAULT_VALUE;
    int32_t i = 0;
    int32_t j = 0;
    int32_t k = 0;
@@ -3768,6 +4844,7 @@ Matvec_determinant( Prefix )( Matvec_type( Prefix ) *current )
    int32_t flag = 0;
    Type *pa_current = (*current).a;
    Type *pa = NULL;
+   work_t work;
 
    // Use Gauss-Jordan elimination to transform the matrix into
    // an upper-triangular form (all matrix entries below the main
@@ -3778,6 +4855,11 @@ Matvec_determinant( Prefix )( Matvec_type( Prefix ) *current )
    a = Matvec_make_from( Prefix )( current );
    pa = (*a).a;
 
+   memset( &work, 0, sizeof( work ) );
+   work.pa = pa;
+   work.rows = rows;
+   work.columns = columns;
+
    for ( i = 0; ( ( i < rows ) && ( EQUAL_FUNCTION( result, DEFAULT_VALUE ) == 0 ) ); i++ )
    {
 
@@ -3812,26 +4894,9 @@ Matvec_determinant( Prefix )( Matvec_type( Prefix ) *current )
       {
          // eliminate the items below the main diagonal to transform
          // to upper triangular form
-         for( j = i + 1; j < rows; j++ )
-         {
-            if ( EQUAL_FUNCTION( pa[j * columns + i], DEFAULT_VALUE ) == 0 )
-            {
-               item1 = INVERSE_FUNCTION( pa[i * columns + i] );
-               factor = MULTIPLY_FUNCTION( pa[j * columns + i], item1 );
-               DISPOSE_FUNCTION( item1 );
-               for( k = 0; k < rows; k++ )
-               {
-                  item1 = MULTIPLY_FUNCTION( factor, pa[i * columns + k] );
-                  item2 = NEGATE_FUNCTION( item1 );
-                  item3 = ADD_FUNCTION( pa[j * columns + k], item2 );
-                  SET_FROM( pa[j * columns + k], item3 );
-                  DISPOSE_FUNCTION( item1 );
-                  DISPOSE_FUNCTION( item2 );
-                  DISPOSE_FUNCTION( item3 );
-               }
-               DISPOSE_FUNCTION( factor );
-            }
-         }
+         work.pivot = i;
+         work.first_row = i + 1;
+         run_panels( current, determinant_job, &work, MATVEC_PANELS_PER_THREAD );
       }
       else
       {
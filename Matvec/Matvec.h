@@ -193,6 +193,63 @@ void Matvec_dispose( Prefix )( Matvec_type( Prefix ) **matvec );
 #define Matvec_deep_dispose( arg ) PRIMITIVE_CAT( arg, _matvec_deep_dispose )
 void Matvec_deep_dispose( Prefix )( Matvec_type( Prefix ) **matvec );
 
+/*
+   Threading
+*/
+
+/**
+   Matvec_thread_count
+
+   Return the number of threads used by operations on the matvec,
+   including the calling thread. A new matvec uses one thread.
+
+   @param  matvec Matvec_t instance
+   @return the thread count
+*/
+#define Matvec_thread_count( arg ) PRIMITIVE_CAT( arg, _matvec_thread_count )
+int32_t Matvec_thread_count( Prefix )( Matvec_type( Prefix ) *matvec );
+
+/**
+   Matvec_thread_threshold
+
+   Return the smallest number of items of the matvec for which operations
+   use more than one thread.
+
+   @param  matvec Matvec_t instance
+   @return the thread threshold
+*/
+#define Matvec_thread_threshold( arg ) PRIMITIVE_CAT( arg, _matvec_thread_threshold )
+int32_t Matvec_thread_threshold( Prefix )( Matvec_type( Prefix ) *matvec );
+
+/**
+   Matvec_set_thread_count
+
+   Set the number of threads used by operations on the matvec, including
+   the calling thread. Worker threads are started when the count is more
+   than one and stopped when the matvec is disposed. Multiply, add,
+   item_by_item_multiply, transpose, invert, determinant and their
+   variants that return a new matvec split the rows of the matvec among
+   the threads. Results are identical to the single threaded results. The
+   thread count is not copied to matvecs made from this one.
+
+   @param  matvec Matvec_t instance
+   @param  thread_count the number of threads
+*/
+#define Matvec_set_thread_count( arg ) PRIMITIVE_CAT( arg, _matvec_set_thread_count )
+void Matvec_set_thread_count( Prefix )( Matvec_type( Prefix ) *matvec, int32_t thread_count );
+
+/**
+   Matvec_set_thread_threshold
+
+   Set the smallest number of items (rows times columns) of the matvec for
+   which operations use more than one thread.
+
+   @param  matvec Matvec_t instance
+   @param  thread_threshold the number of items
+*/
+#define Matvec_set_thread_threshold( arg ) PRIMITIVE_CAT( arg, _matvec_set_thread_threshold )
+void Matvec_set_thread_threshold( Prefix )( Matvec_type( Prefix ) *matvec, int32_t thread_threshold );
+
 /*
    Access
 */
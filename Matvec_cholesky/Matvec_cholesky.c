@@ -0,0 +1,593 @@
+/**
+ @file Matvec_cholesky.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "Cholesky factorization of matrices"
+
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0):
+
+ 1. Permission is hereby granted to use, copy, modify and/or
+    distribute this package, provided that:
+       * copyright notices are retained unchanged,
+       * any distribution of this package, whether modified or not,
+         includes this license text.
+ 2. Permission is hereby also granted to distribute binary programs
+    which depend on this package. If the binary program depends on a
+    modified version of this package, you are encouraged to publicly
+    release the modified version of this package.
+
+ THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT WARRANTY. ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE AUTHORS BE LIABLE TO ANY PARTY FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES ARISING IN ANY WAY OUT OF THE USE OF THIS PACKAGE.
+
+ @section Description
+
+ Function definitions for the opaque Matvec_cholesky_t type.
+
+ L is computed row by row: item ( i, j ) of L, j <= i, is item ( i, j ) of
+ the input less the dot product of rows i and j of L to the left of column
+ j, divided by item ( j, j ) of L, or its square root when i == j. Both
+ rows are read in storage order.
+
+ Only the lower triangle of the input is read, so an input that is
+ hermitian up to rounding, like a product A^H A, is factored as the
+ hermitian matrix with that lower triangle.
+
+ The diagonal items are real. Their real part is taken by converting Type
+ to Magnitude_type, so Type must be a real or complex float type.
+
+*/
+
+#include "Matvec_cholesky.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <float.h>
+#ifdef MULTITHREADED
+#include MULTITHREAD_INCLUDE
+#endif
+
+#include "dbc.h"
+
+/**
+   defines
+*/
+
+/**
+   Note that this include file does NOT have an include guard - it may
+   be included multiple times with different macro defintions.
+
+   Defines that must be present (external to this file):
+
+   Prefix - string used to name this container type
+   Matvec_prefix - string used to name the matrix type
+   Type   - the type of the value
+   Magnitude_type - the type of the magnitude or precision of Type
+
+   Macros that must be present (external to this file):
+
+   DEFAULT_VALUE              -  constant that is the default value for type (zero)
+   ONE_VALUE                  -  constant that is the "one" value for type
+   NEGATE_FUNCTION            -  additive inverse of type value
+   ADD_FUNCTION               -  adds two type values
+   MULTIPLY_FUNCTION          -  multiplies two type values
+   INVERSE_FUNCTION           -  multiplicative inverse of type value
+   CONJUGATE_FUNCTION         -  complex conjugate of type value
+   EQUAL_FUNCTION             -  1 if items are equal, 0 otherwise
+   DUPLICATE_FUNCTION         -  makes duplicate of a type value
+   SET_FROM                   -  sets value from another
+   DISPOSE_FUNCTION           -  frees a type value
+
+   Defines that may be present (external to this file):
+
+   HERMITIAN_PRECISION - how far apart, relative to the largest item of
+                         the input, item ( i, j ) and the conjugate of
+                         item ( j, i ) may be
+
+*/
+
+#ifndef HERMITIAN_PRECISION
+#define HERMITIAN_PRECISION ( 256.0*( ( sizeof( Magnitude_type ) == sizeof( float ) ) ? FLT_EPSILON : DBL_EPSILON ) )
+#endif
+
+/**
+   Matvec_cholesky structure
+*/
+
+struct Matvec_cholesky_struct( Prefix )
+{
+   int32_t _type;
+   int32_t _item_type;
+
+   // number of rows and columns of the factored matrix
+   int32_t n;
+
+   // L, with zeros above the diagonal
+   Matvec_type( Matvec_prefix ) *lower;
+
+   // flags
+   int32_t is_positive_definite;
+
+   // multithread values if we include threading support
+   MULTITHREAD_MUTEX_DEFINITION( mutex );
+};
+
+/**
+   Invariant
+*/
+
+#if INVARIANT_CONDITIONAL != 0
+
+static
+int32_t
+lower_not_null( Matvec_cholesky_type( Prefix ) *p )
+{
+   int32_t result = 0;
+
+   if ( (*p).lower != NULL )
+   {
+      result = 1;
+   }
+
+   return result;
+}
+
+static
+int32_t
+n_positive( Matvec_cholesky_type( Prefix ) *p )
+{
+   int32_t result = 0;
+
+   if ( (*p).n > 0 )
+   {
+      result = 1;
+   }
+
+   return result;
+}
+
+static
+void invariant( Matvec_cholesky_type( Prefix ) *p )
+{
+   assert( ( ( void ) "lower not null", lower_not_null( p ) ) );
+   assert( ( ( void ) "n positive", n_positive( p ) ) );
+   return;
+}
+
+#endif
+
+/**
+   Internal routines
+*/
+
+/**
+   factor
+
+   compute L from the input pa, stop at a diagonal item that is not
+   positive
+*/
+
+static
+void
+factor( Matvec_cholesky_type( Prefix ) *cholesky, Type *pa )
+{
+   Type sum = DEFAULT_VALUE;
+   Type inverse = DEFAULT_VALUE;
+   Type item1 = DEFAULT_VALUE;
+   Type item2 = DEFAULT_VALUE;
+   Type item3 = DEFAULT_VALUE;
+   Magnitude_type d = 0.0;
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+   int32_t n = (*cholesky).n;
+   Type *pl = Matvec_as_array( Matvec_prefix )( (*cholesky).lower );
+
+   (*cholesky).is_positive_definite = 1;
+
+   for ( i = 0; ( ( i < n ) && ( (*cholesky).is_positive_definite == 1 ) ); i++ )
+   {
+      for ( j = 0; ( ( j <= i ) && ( (*cholesky).is_positive_definite == 1 ) ); j++ )
+      {
+         // sum = a( i, j ) - sum over k < j of l( i, k ) * conj( l( j, k ) )
+         sum = DUPLICATE_FUNCTION( pa[i * n + j] );
+
+         for ( k = 0; k < j; k++ )
+         {
+            item1 = CONJUGATE_FUNCTION( pl[j * n + k] );
+            item2 = MULTIPLY_FUNCTION( pl[i * n + k], item1 );
+            DISPOSE_FUNCTION( item1 );
+            item1 = NEGATE_FUNCTION( item2 );
+            item3 = ADD_FUNCTION( sum, item1 );
+            SET_FROM( sum, item3 );
+            DISPOSE_FUNCTION( item1 );
+            DISPOSE_FUNCTION( item2 );
+            DISPOSE_FUNCTION( item3 );
+         }
+
+         if ( i == j )
+         {
+            // real part of the diagonal item
+            d = ( Magnitude_type ) sum;
+
+            if ( d > 0.0 )
+            {
+               pl[i * n + i] = ( Type ) sqrt( d );
+            }
+            else
+            {
+               (*cholesky).is_positive_definite = 0;
+            }
+         }
+         else
+         {
+            inverse = INVERSE_FUNCTION( pl[j * n + j] );
+            pl[i * n + j] = MULTIPLY_FUNCTION( sum, inverse );
+            DISPOSE_FUNCTION( inverse );
+         }
+
+         DISPOSE_FUNCTION( sum );
+      }
+   }
+
+   return;
+}
+
+/**
+   solve
+
+   px = A^-1 pb where pb and px are n by m, rows stored one after the
+   other, and px holds m times n default values
+*/
+
+static
+void
+solve( Matvec_cholesky_type( Prefix ) *cholesky, Type *pb, Type *px, int32_t m )
+{
+   Type inverse = DEFAULT_VALUE;
+   Type l = DEFAULT_VALUE;
+   Type item1 = DEFAULT_VALUE;
+   Type item2 = DEFAULT_VALUE;
+   Type item3 = DEFAULT_VALUE;
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+   int32_t n = (*cholesky).n;
+   Type *pl = Matvec_as_array( Matvec_prefix )( (*cholesky).lower );
+
+   for ( i = 0; i < n; i++ )
+   {
+      for ( j = 0; j < m; j++ )
+      {
+         px[i * m + j] = DUPLICATE_FUNCTION( pb[i * m + j] );
+      }
+   }
+
+   // forward substitution with L
+   for ( i = 0; i < n; i++ )
+   {
+      for ( k = 0; k < i; k++ )
+      {
+         l = pl[i * n + k];
+
+         if ( EQUAL_FUNCTION( l, DEFAULT_VALUE ) == 0 )
+         {
+            for ( j = 0; j < m; j++ )
+            {
+               item1 = MULTIPLY_FUNCTION( l, px[k * m + j] );
+               item2 = NEGATE_FUNCTION( item1 );
+               item3 = ADD_FUNCTION( px[i * m + j], item2 );
+               SET_FROM( px[i * m + j], item3 );
+               DISPOSE_FUNCTION( item1 );
+               DISPOSE_FUNCTION( item2 );
+               DISPOSE_FUNCTION( item3 );
+            }
+         }
+      }
+
+      inverse = INVERSE_FUNCTION( pl[i * n + i] );
+
+      for ( j = 0; j < m; j++ )
+      {
+         item1 = MULTIPLY_FUNCTION( px[i * m + j], inverse );
+         SET_FROM( px[i * m + j], item1 );
+         DISPOSE_FUNCTION( item1 );
+      }
+
+      DISPOSE_FUNCTION( inverse );
+   }
+
+   // back substitution with L^H, item ( i, k ) of L^H is conj( l( k, i ) )
+   for ( i = n - 1; i >= 0; i-- )
+   {
+      for ( k = i + 1; k < n; k++ )
+      {
+         l = CONJUGATE_FUNCTION( pl[k * n + i] );
+
+         if ( EQUAL_FUNCTION( l, DEFAULT_VALUE ) == 0 )
+         {
+            for ( j = 0; j < m; j++ )
+            {
+               item1 = MULTIPLY_FUNCTION( l, px[k * m + j] );
+               item2 = NEGATE_FUNCTION( item1 );
+               item3 = ADD_FUNCTION( px[i * m + j], item2 );
+               SET_FROM( px[i * m + j], item3 );
+               DISPOSE_FUNCTION( item1 );
+               DISPOSE_FUNCTION( item2 );
+               DISPOSE_FUNCTION( item3 );
+            }
+         }
+
+         DISPOSE_FUNCTION( l );
+      }
+
+      // the diagonal is real, its conjugate is itself
+      inverse = INVERSE_FUNCTION( pl[i * n + i] );
+
+      for ( j = 0; j < m; j++ )
+      {
+         item1 = MULTIPLY_FUNCTION( px[i * m + j], inverse );
+         SET_FROM( px[i * m + j], item1 );
+         DISPOSE_FUNCTION( item1 );
+      }
+
+      DISPOSE_FUNCTION( inverse );
+   }
+
+   return;
+}
+
+/**
+   Matvec_cholesky_make
+*/
+
+Matvec_cholesky_type( Prefix ) *
+Matvec_cholesky_make( Prefix )( Matvec_type( Matvec_prefix ) *input )
+{
+   PRECONDITION( "input not null", input != NULL );
+   PRECONDITION( "input is square", Matvec_rows( Matvec_prefix )( input ) == Matvec_columns( Matvec_prefix )( input ) );
+   PRECONDITION( "input is hermitian symmetric", Matvec_is_approximately_hermitian_symmetric( Matvec_prefix )( input, HERMITIAN_PRECISION ) == 1 );
+
+   // allocate cholesky struct
+   Matvec_cholesky_type( Prefix ) * result
+      = ( Matvec_cholesky_type( Prefix ) * ) calloc( 1, sizeof( Matvec_cholesky_type( Prefix ) ) );
+   CHECK( "result allocated correctly", result != NULL );
+
+   // set type
+   (*result)._type = MATVEC_CHOLESKY_TYPE;
+   (*result)._item_type = Type_Code;
+
+   (*result).n = Matvec_rows( Matvec_prefix )( input );
+   (*result).lower = Matvec_make( Matvec_prefix )( (*result).n, (*result).n );
+
+   factor( result, Matvec_as_array( Matvec_prefix )( input ) );
+
+   MULTITHREAD_MUTEX_INIT( (*result).mutex );
+
+   INVARIANT( result );
+
+   return result;
+}
+
+/**
+   Matvec_cholesky_dispose
+*/
+
+void
+Matvec_cholesky_dispose( Prefix )( Matvec_cholesky_type( Prefix ) **cholesky )
+{
+   PRECONDITION( "cholesky not null", cholesky != NULL );
+   PRECONDITION( "cholesky not null", *cholesky != NULL );
+   PRECONDITION( "cholesky type OK", ( (**cholesky)._type == MATVEC_CHOLESKY_TYPE ) && ( (**cholesky)._item_type == Type_Code ) );
+   LOCK( (**cholesky).mutex );
+   INVARIANT(*cholesky);
+
+   Matvec_dispose( Matvec_prefix )( &(**cholesky).lower );
+
+   MULTITHREAD_MUTEX_DESTROY( (**cholesky).mutex );
+
+   // delete cholesky struct
+   free(*cholesky);
+
+   // set to NULL
+   *cholesky = NULL;
+
+   return;
+}
+
+/**
+   Matvec_cholesky_deep_dispose
+*/
+
+void
+Matvec_cholesky_deep_dispose( Prefix )( Matvec_cholesky_type( Prefix ) **cholesky )
+{
+   PRECONDITION( "cholesky not null", cholesky != NULL );
+   PRECONDITION( "cholesky not null", *cholesky != NULL );
+   PRECONDITION( "cholesky type OK", ( (**cholesky)._type == MATVEC_CHOLESKY_TYPE ) && ( (**cholesky)._item_type == Type_Code ) );
+   LOCK( (**cholesky).mutex );
+   INVARIANT(*cholesky);
+
+   Matvec_deep_dispose( Matvec_prefix )( &(**cholesky).lower );
+
+   MULTITHREAD_MUTEX_DESTROY( (**cholesky).mutex );
+
+   // delete cholesky struct
+   free(*cholesky);
+
+   // set to NULL
+   *cholesky = NULL;
+
+   return;
+}
+
+/**
+   Matvec_cholesky_size
+*/
+
+int32_t
+Matvec_cholesky_size( Prefix )( Matvec_cholesky_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", ( (*current)._type == MATVEC_CHOLESKY_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = (*current).n;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   Matvec_cholesky_is_positive_definite
+*/
+
+int32_t
+Matvec_cholesky_is_positive_definite( Prefix )( Matvec_cholesky_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", ( (*current)._type == MATVEC_CHOLESKY_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = (*current).is_positive_definite;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   Matvec_cholesky_determinant
+*/
+
+Type
+Matvec_cholesky_determinant( Prefix )( Matvec_cholesky_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", ( (*current)._type == MATVEC_CHOLESKY_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   PRECONDITION( "current is positive definite", (*current).is_positive_definite == 1 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   Type result = ONE_VALUE;
+   Type item = DEFAULT_VALUE;
+   int32_t i = 0;
+   int32_t n = (*current).n;
+   Type *pl = Matvec_as_array( Matvec_prefix )( (*current).lower );
+
+   // det( A ) = det( L ) det( L^H ), the product of the squared diagonal
+   for ( i = 0; i < n; i++ )
+   {
+      item = MULTIPLY_FUNCTION( result, pl[i * n + i] );
+      SET_FROM( result, item );
+      DISPOSE_FUNCTION( item );
+      item = MULTIPLY_FUNCTION( result, pl[i * n + i] );
+      SET_FROM( result, item );
+      DISPOSE_FUNCTION( item );
+   }
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   Matvec_cholesky_solve
+*/
+
+Matvec_type( Matvec_prefix ) *
+Matvec_cholesky_solve( Prefix )( Matvec_cholesky_type( Prefix ) *current, Matvec_type( Matvec_prefix ) *b )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", ( (*current)._type == MATVEC_CHOLESKY_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   PRECONDITION( "current is positive definite", (*current).is_positive_definite == 1 );
+   PRECONDITION( "b not null", b != NULL );
+   PRECONDITION( "b is vector", ( Matvec_rows( Matvec_prefix )( b ) == 1 ) || ( Matvec_columns( Matvec_prefix )( b ) == 1 ) );
+   PRECONDITION( "b length OK", Matvec_rows( Matvec_prefix )( b ) * Matvec_columns( Matvec_prefix )( b ) == (*current).n );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   Matvec_type( Matvec_prefix ) *result = NULL;
+
+   result
+      =  Matvec_make( Matvec_prefix )
+         (
+            Matvec_rows( Matvec_prefix )( b ),
+            Matvec_columns( Matvec_prefix )( b )
+         );
+
+   // a row vector has the same layout as a column vector
+   solve
+   (
+      current,
+      Matvec_as_array( Matvec_prefix )( b ),
+      Matvec_as_array( Matvec_prefix )( result ),
+      1
+   );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   Matvec_cholesky_solve_many
+*/
+
+Matvec_type( Matvec_prefix ) *
+Matvec_cholesky_solve_many( Prefix )( Matvec_cholesky_type( Prefix ) *current, Matvec_type( Matvec_prefix ) *b )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", ( (*current)._type == MATVEC_CHOLESKY_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   PRECONDITION( "current is positive definite", (*current).is_positive_definite == 1 );
+   PRECONDITION( "b not null", b != NULL );
+   PRECONDITION( "b rows OK", Matvec_rows( Matvec_prefix )( b ) == (*current).n );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   Matvec_type( Matvec_prefix ) *result = NULL;
+   int32_t m = Matvec_columns( Matvec_prefix )( b );
+
+   result = Matvec_make( Matvec_prefix )( (*current).n, m );
+
+   solve
+   (
+      current,
+      Matvec_as_array( Matvec_prefix )( b ),
+      Matvec_as_array( Matvec_prefix )( result ),
+      m
+   );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,211 @@
+/**
+ @file Matvec_cholesky.h
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "Cholesky factorization of matrices"
+
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0):
+
+ 1. Permission is hereby granted to use, copy, modify and/or
+    distribute this package, provided that:
+       * copyright notices are retained unchanged,
+       * any distribution of this package, whether modified or not,
+         includes this license text.
+ 2. Permission is hereby also granted to distribute binary programs
+    which depend on this package. If the binary program depends on a
+    modified version of this package, you are encouraged to publicly
+    release the modified version of this package.
+
+ THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT WARRANTY. ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE AUTHORS BE LIABLE TO ANY PARTY FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES ARISING IN ANY WAY OUT OF THE USE OF THIS PACKAGE.
+
+ @section Description
+
+ Function declarations for the opaque Matvec_cholesky_t type.
+
+ A Matvec_cholesky_t holds the Cholesky factorization A = L L^H of a
+ hermitian (for real items, symmetric) positive definite matrix, where L is
+ lower triangular with a real, positive diagonal. It takes about half the
+ work of an LU factorization. The factor is computed once, when the
+ Matvec_cholesky_t is made, and is then used for any number of solves and
+ for the determinant.
+
+*/
+
+/**
+   includes
+*/
+
+#include "base.h"
+#include "Matvec.h"
+#include <stdarg.h>
+
+/**
+   Note that this include file does NOT have an include guard - it may
+   be included multiple times with different macro defintions.
+
+   Defines that must be present (external to this file):
+
+   Prefix - string used to name this container type
+   Matvec_prefix - string used to name the matrix type
+   Type   - the type of the value
+   Magnitude_type - the type of the magnitude or precision of Type
+
+*/
+
+/**
+   Macro definitions
+*/
+
+#define PRIMITIVE_CAT(arg, ...) arg ## __VA_ARGS__
+
+#define Matvec_cholesky_struct( arg ) PRIMITIVE_CAT( arg, _matvec_cholesky_struct )
+#define Matvec_cholesky_type( arg ) PRIMITIVE_CAT( arg, _matvec_cholesky_t )
+#define Matvec_cholesky_name( arg ) PRIMITIVE_CAT( arg, _matvec_cholesky )
+
+/**
+   Structure declarations
+*/
+
+struct Matvec_cholesky_struct( Prefix );
+
+/**
+   Structure typedefs
+*/
+
+typedef struct Matvec_cholesky_struct( Prefix ) Matvec_cholesky_type( Prefix );
+
+
+/*
+   Initialization
+*/
+
+/**
+   Matvec_cholesky_make
+
+   Return a new Matvec_cholesky_t instance holding the Cholesky
+   factorization of input. Input is not changed and is not kept. Input
+   need only be hermitian symmetric to within rounding, its lower
+   triangle is what is factored.
+
+   @param  input the hermitian symmetric matrix to factor
+   @return Matvec_cholesky_t instance
+*/
+#define Matvec_cholesky_make( arg ) PRIMITIVE_CAT( arg, _matvec_cholesky_make )
+Matvec_cholesky_type( Prefix ) * Matvec_cholesky_make( Prefix )( Matvec_type( Matvec_prefix ) *input );
+
+/*
+   Disposal
+*/
+
+/**
+   Matvec_cholesky_dispose
+
+   Free a Matvec_cholesky_t instance. The value items are not disposed.
+
+   @param  cholesky Matvec_cholesky_t instance
+*/
+#define Matvec_cholesky_dispose( arg ) PRIMITIVE_CAT( arg, _matvec_cholesky_dispose )
+void Matvec_cholesky_dispose( Prefix )( Matvec_cholesky_type( Prefix ) **cholesky );
+
+/**
+   Matvec_cholesky_deep_dispose
+
+   Free a Matvec_cholesky_t instance. The value items are disposed.
+
+   @param  cholesky Matvec_cholesky_t instance
+*/
+#define Matvec_cholesky_deep_dispose( arg ) PRIMITIVE_CAT( arg, _matvec_cholesky_deep_dispose )
+void Matvec_cholesky_deep_dispose( Prefix )( Matvec_cholesky_type( Prefix ) **cholesky );
+
+/*
+   Access
+*/
+
+/**
+   Matvec_cholesky_size
+
+   Return the number of rows (and columns) of the factored matrix.
+
+   @param  cholesky Matvec_cholesky_t instance
+   @return the size of the matrix
+*/
+#define Matvec_cholesky_size( arg ) PRIMITIVE_CAT( arg, _matvec_cholesky_size )
+int32_t Matvec_cholesky_size( Prefix )( Matvec_cholesky_type( Prefix ) *cholesky );
+
+/*
+   Status report
+*/
+
+/**
+   Matvec_cholesky_is_positive_definite
+
+   Return 1 if the factorization succeeded. It fails when the input is not
+   positive definite, and then cannot be used to solve or for the
+   determinant.
+
+   @param  cholesky Matvec_cholesky_t instance
+   @return 1 if the matrix is positive definite, 0 otherwise
+*/
+#define Matvec_cholesky_is_positive_definite( arg ) PRIMITIVE_CAT( arg, _matvec_cholesky_is_positive_definite )
+int32_t Matvec_cholesky_is_positive_definite( Prefix )( Matvec_cholesky_type( Prefix ) *cholesky );
+
+/*
+   Measurement
+*/
+
+/**
+   Matvec_cholesky_determinant
+
+   Return the determinant of the factored matrix, the square of the
+   product of the diagonal of L.
+
+   @param  cholesky Matvec_cholesky_t instance
+   @return the determinant
+*/
+#define Matvec_cholesky_determinant( arg ) PRIMITIVE_CAT( arg, _matvec_cholesky_determinant )
+Type Matvec_cholesky_determinant( Prefix )( Matvec_cholesky_type( Prefix ) *cholesky );
+
+/*
+   Transformation
+*/
+
+/**
+   Matvec_cholesky_solve
+
+   Return the vector x for which A x = b, where A is the factored matrix.
+   The result is a new vector of the same shape as b.
+
+   @param  cholesky Matvec_cholesky_t instance
+   @param  b a row or column vector with one item per row of A
+   @return the solution vector
+*/
+#define Matvec_cholesky_solve( arg ) PRIMITIVE_CAT( arg, _matvec_cholesky_solve )
+Matvec_type( Matvec_prefix ) * Matvec_cholesky_solve( Prefix )( Matvec_cholesky_type( Prefix ) *cholesky, Matvec_type( Matvec_prefix ) *b );
+
+/**
+   Matvec_cholesky_solve_many
+
+   Return the matrix X for which A X = B, where A is the factored matrix.
+   Each column of B is a right hand side. The result is a new matrix of
+   the same size as B.
+
+   @param  cholesky Matvec_cholesky_t instance
+   @param  b a matrix with as many rows as A
+   @return the solution matrix
+*/
+#define Matvec_cholesky_solve_many( arg ) PRIMITIVE_CAT( arg, _matvec_cholesky_solve_many )
+Matvec_type( Matvec_prefix ) * Matvec_cholesky_solve_many( Prefix )( Matvec_cholesky_type( Prefix ) *cholesky, Matvec_type( Matvec_prefix ) *b );
+
+
+/* End of file */
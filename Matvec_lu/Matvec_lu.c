@@ -0,0 +1,617 @@
+/**
+ @file Matvec_lu.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "LU factorization of matrices"
+
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0):
+
+ 1. Permission is hereby granted to use, copy, modify and/or
+    distribute this package, provided that:
+       * copyright notices are retained unchanged,
+       * any distribution of this package, whether modified or not,
+         includes this license text.
+ 2. Permission is hereby also granted to distribute binary programs
+    which depend on this package. If the binary program depends on a
+    modified version of this package, you are encouraged to publicly
+    release the modified version of this package.
+
+ THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT WARRANTY. ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE AUTHORS BE LIABLE TO ANY PARTY FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES ARISING IN ANY WAY OUT OF THE USE OF THIS PACKAGE.
+
+ @section Description
+
+ Function definitions for the opaque Matvec_lu_t type.
+
+ The factorization is the usual right looking elimination with partial
+ pivoting: at step k the row with the largest item in column k, on or
+ below the diagonal, is swapped into row k, the items below the pivot are
+ divided by it to give column k of L, and the outer product of that column
+ with row k of U is subtracted from the rows below. L (without its unit
+ diagonal) and U are kept together in one matrix.
+
+*/
+
+#include "Matvec_lu.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#ifdef MULTITHREADED
+#include MULTITHREAD_INCLUDE
+#endif
+
+#include "dbc.h"
+
+/**
+   defines
+*/
+
+/**
+   Note that this include file does NOT have an include guard - it may
+   be included multiple times with different macro defintions.
+
+   Defines that must be present (external to this file):
+
+   Prefix - string used to name this container type
+   Matvec_prefix - string used to name the matrix type
+   Type   - the type of the value
+   Magnitude_type - the type of the magnitude or precision of Type
+
+   Macros that must be present (external to this file):
+
+   DEFAULT_VALUE              -  constant that is the default value for type (zero)
+   ONE_VALUE                  -  constant that is the "one" value for type
+   NEGATE_FUNCTION            -  additive inverse of type value
+   ADD_FUNCTION               -  adds two type values
+   SQUARED_MAGNITUDE_FUNCTION -  squared magnitude of type value
+   MULTIPLY_FUNCTION          -  multiplies two type values
+   INVERSE_FUNCTION           -  multiplicative inverse of type value
+   EQUAL_FUNCTION             -  1 if items are equal, 0 otherwise
+   DUPLICATE_FUNCTION         -  makes duplicate of a type value
+   SET_FROM                   -  sets value from another
+   DISPOSE_FUNCTION           -  frees a type value
+
+*/
+
+/**
+   Matvec_lu structure
+*/
+
+struct Matvec_lu_struct( Prefix )
+{
+   int32_t _type;
+   int32_t _item_type;
+
+   // number of rows and columns of the factored matrix
+   int32_t n;
+
+   // L below the diagonal and U on and above it
+   Matvec_type( Matvec_prefix ) *factors;
+
+   // row i of the factors comes from row permutation[i] of the input
+   int32_t *permutation;
+
+   // number of row swaps, the determinant sign
+   int32_t swap_count;
+
+   // flags
+   int32_t is_singular;
+
+   // multithread values if we include threading support
+   MULTITHREAD_MUTEX_DEFINITION( mutex );
+};
+
+/**
+   Invariant
+*/
+
+#if INVARIANT_CONDITIONAL != 0
+
+static
+int32_t
+factors_not_null( Matvec_lu_type( Prefix ) *p )
+{
+   int32_t result = 0;
+
+   if ( ( (*p).factors != NULL ) && ( (*p).permutation != NULL ) )
+   {
+      result = 1;
+   }
+
+   return result;
+}
+
+static
+int32_t
+n_positive( Matvec_lu_type( Prefix ) *p )
+{
+   int32_t result = 0;
+
+   if ( (*p).n > 0 )
+   {
+      result = 1;
+   }
+
+   return result;
+}
+
+static
+void invariant( Matvec_lu_type( Prefix ) *p )
+{
+   assert( ( ( void ) "factors not null", factors_not_null( p ) ) );
+   assert( ( ( void ) "n positive", n_positive( p ) ) );
+   return;
+}
+
+#endif
+
+/**
+   Internal routines
+*/
+
+/**
+   factor
+
+   compute the factors of the input copied into (*lu).factors
+*/
+
+static
+void
+factor( Matvec_lu_type( Prefix ) *lu )
+{
+   Type inverse = DEFAULT_VALUE;
+   Type l = DEFAULT_VALUE;
+   Type item = DEFAULT_VALUE;
+   Type item1 = DEFAULT_VALUE;
+   Type item2 = DEFAULT_VALUE;
+   Type item3 = DEFAULT_VALUE;
+   Magnitude_type max = 0.0;
+   Magnitude_type m = 0.0;
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+   int32_t p = 0;
+   int32_t n = (*lu).n;
+   Type *pa = Matvec_as_array( Matvec_prefix )( (*lu).factors );
+
+   for ( k = 0; k < n; k++ )
+   {
+      // find the pivot, the largest item in column k on or below the diagonal
+      p = k;
+      max = SQUARED_MAGNITUDE_FUNCTION( pa[k * n + k] );
+      for ( i = k + 1; i < n; i++ )
+      {
+         m = SQUARED_MAGNITUDE_FUNCTION( pa[i * n + k] );
+         if ( m > max )
+         {
+            max = m;
+            p = i;
+         }
+      }
+
+      if ( max == 0.0 )
+      {
+         // nothing to eliminate, U has a zero on its diagonal
+         (*lu).is_singular = 1;
+      }
+      else
+      {
+         // swap the pivot row into row k
+         if ( p != k )
+         {
+            for ( j = 0; j < n; j++ )
+            {
+               item = pa[k * n + j];
+               pa[k * n + j] = pa[p * n + j];
+               pa[p * n + j] = item;
+            }
+
+            i = (*lu).permutation[k];
+            (*lu).permutation[k] = (*lu).permutation[p];
+            (*lu).permutation[p] = i;
+
+            (*lu).swap_count = (*lu).swap_count + 1;
+         }
+
+         inverse = INVERSE_FUNCTION( pa[k * n + k] );
+
+         // subtract multiples of row k from the rows below it
+         for ( i = k + 1; i < n; i++ )
+         {
+            l = MULTIPLY_FUNCTION( pa[i * n + k], inverse );
+            SET_FROM( pa[i * n + k], l );
+
+            if ( EQUAL_FUNCTION( l, DEFAULT_VALUE ) == 0 )
+            {
+               for ( j = k + 1; j < n; j++ )
+               {
+                  item1 = MULTIPLY_FUNCTION( l, pa[k * n + j] );
+                  item2 = NEGATE_FUNCTION( item1 );
+                  item3 = ADD_FUNCTION( pa[i * n + j], item2 );
+                  SET_FROM( pa[i * n + j], item3 );
+                  DISPOSE_FUNCTION( item1 );
+                  DISPOSE_FUNCTION( item2 );
+                  DISPOSE_FUNCTION( item3 );
+               }
+            }
+
+            DISPOSE_FUNCTION( l );
+         }
+
+         DISPOSE_FUNCTION( inverse );
+      }
+   }
+
+   return;
+}
+
+/**
+   solve
+
+   px = A^-1 pb where pb and px are n by m, rows stored one after the
+   other, and px holds m times n default values
+*/
+
+static
+void
+solve( Matvec_lu_type( Prefix ) *lu, Type *pb, Type *px, int32_t m )
+{
+   Type inverse = DEFAULT_VALUE;
+   Type l = DEFAULT_VALUE;
+   Type item1 = DEFAULT_VALUE;
+   Type item2 = DEFAULT_VALUE;
+   Type item3 = DEFAULT_VALUE;
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+   int32_t n = (*lu).n;
+   Type *pa = Matvec_as_array( Matvec_prefix )( (*lu).factors );
+
+   // permute the rows of b
+   for ( i = 0; i < n; i++ )
+   {
+      for ( j = 0; j < m; j++ )
+      {
+         px[i * m + j] = DUPLICATE_FUNCTION( pb[(*lu).permutation[i] * m + j] );
+      }
+   }
+
+   // forward substitution with L, whose diagonal is one
+   for ( i = 1; i < n; i++ )
+   {
+      for ( k = 0; k < i; k++ )
+      {
+         l = pa[i * n + k];
+
+         if ( EQUAL_FUNCTION( l, DEFAULT_VALUE ) == 0 )
+         {
+            for ( j = 0; j < m; j++ )
+            {
+               item1 = MULTIPLY_FUNCTION( l, px[k * m + j] );
+               item2 = NEGATE_FUNCTION( item1 );
+               item3 = ADD_FUNCTION( px[i * m + j], item2 );
+               SET_FROM( px[i * m + j], item3 );
+               DISPOSE_FUNCTION( item1 );
+               DISPOSE_FUNCTION( item2 );
+               DISPOSE_FUNCTION( item3 );
+            }
+         }
+      }
+   }
+
+   // back substitution with U
+   for ( i = n - 1; i >= 0; i-- )
+   {
+      for ( k = i + 1; k < n; k++ )
+      {
+         l = pa[i * n + k];
+
+         if ( EQUAL_FUNCTION( l, DEFAULT_VALUE ) == 0 )
+         {
+            for ( j = 0; j < m; j++ )
+            {
+               item1 = MULTIPLY_FUNCTION( l, px[k * m + j] );
+               item2 = NEGATE_FUNCTION( item1 );
+               item3 = ADD_FUNCTION( px[i * m + j], item2 );
+               SET_FROM( px[i * m + j], item3 );
+               DISPOSE_FUNCTION( item1 );
+               DISPOSE_FUNCTION( item2 );
+               DISPOSE_FUNCTION( item3 );
+            }
+         }
+      }
+
+      inverse = INVERSE_FUNCTION( pa[i * n + i] );
+
+      for ( j = 0; j < m; j++ )
+      {
+         item1 = MULTIPLY_FUNCTION( px[i * m + j], inverse );
+         SET_FROM( px[i * m + j], item1 );
+         DISPOSE_FUNCTION( item1 );
+      }
+
+      DISPOSE_FUNCTION( inverse );
+   }
+
+   return;
+}
+
+/**
+   Matvec_lu_make
+*/
+
+Matvec_lu_type( Prefix ) *
+Matvec_lu_make( Prefix )( Matvec_type( Matvec_prefix ) *input )
+{
+   PRECONDITION( "input not null", input != NULL );
+   PRECONDITION( "input is square", Matvec_rows( Matvec_prefix )( input ) == Matvec_columns( Matvec_prefix )( input ) );
+
+   int32_t i = 0;
+
+   // allocate lu struct
+   Matvec_lu_type( Prefix ) * result
+      = ( Matvec_lu_type( Prefix ) * ) calloc( 1, sizeof( Matvec_lu_type( Prefix ) ) );
+   CHECK( "result allocated correctly", result != NULL );
+
+   // set type
+   (*result)._type = MATVEC_LU_TYPE;
+   (*result)._item_type = Type_Code;
+
+   (*result).n = Matvec_rows( Matvec_prefix )( input );
+
+   // start from a copy of the input and the identity permutation
+   (*result).factors = Matvec_make_from( Matvec_prefix )( input );
+
+   (*result).permutation = ( int32_t * ) calloc( (*result).n, sizeof( int32_t ) );
+   CHECK( "(*result).permutation allocated correctly", (*result).permutation != NULL );
+
+   for ( i = 0; i < (*result).n; i++ )
+   {
+      (*result).permutation[i] = i;
+   }
+
+   factor( result );
+
+   MULTITHREAD_MUTEX_INIT( (*result).mutex );
+
+   INVARIANT( result );
+
+   return result;
+}
+
+/**
+   Matvec_lu_dispose
+*/
+
+void
+Matvec_lu_dispose( Prefix )( Matvec_lu_type( Prefix ) **lu )
+{
+   PRECONDITION( "lu not null", lu != NULL );
+   PRECONDITION( "lu not null", *lu != NULL );
+   PRECONDITION( "lu type OK", ( (**lu)._type == MATVEC_LU_TYPE ) && ( (**lu)._item_type == Type_Code ) );
+   LOCK( (**lu).mutex );
+   INVARIANT(*lu);
+
+   Matvec_dispose( Matvec_prefix )( &(**lu).factors );
+   free( (**lu).permutation );
+
+   MULTITHREAD_MUTEX_DESTROY( (**lu).mutex );
+
+   // delete lu struct
+   free(*lu);
+
+   // set to NULL
+   *lu = NULL;
+
+   return;
+}
+
+/**
+   Matvec_lu_deep_dispose
+*/
+
+void
+Matvec_lu_deep_dispose( Prefix )( Matvec_lu_type( Prefix ) **lu )
+{
+   PRECONDITION( "lu not null", lu != NULL );
+   PRECONDITION( "lu not null", *lu != NULL );
+   PRECONDITION( "lu type OK", ( (**lu)._type == MATVEC_LU_TYPE ) && ( (**lu)._item_type == Type_Code ) );
+   LOCK( (**lu).mutex );
+   INVARIANT(*lu);
+
+   Matvec_deep_dispose( Matvec_prefix )( &(**lu).factors );
+   free( (**lu).permutation );
+
+   MULTITHREAD_MUTEX_DESTROY( (**lu).mutex );
+
+   // delete lu struct
+   free(*lu);
+
+   // set to NULL
+   *lu = NULL;
+
+   return;
+}
+
+/**
+   Matvec_lu_size
+*/
+
+int32_t
+Matvec_lu_size( Prefix )( Matvec_lu_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", ( (*current)._type == MATVEC_LU_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = (*current).n;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   Matvec_lu_is_singular
+*/
+
+int32_t
+Matvec_lu_is_singular( Prefix )( Matvec_lu_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", ( (*current)._type == MATVEC_LU_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = (*current).is_singular;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   Matvec_lu_determinant
+*/
+
+Type
+Matvec_lu_determinant( Prefix )( Matvec_lu_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", ( (*current)._type == MATVEC_LU_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   Type result = ONE_VALUE;
+   Type item = DEFAULT_VALUE;
+   int32_t i = 0;
+   int32_t n = (*current).n;
+   Type *pa = Matvec_as_array( Matvec_prefix )( (*current).factors );
+
+   if ( (*current).is_singular == 1 )
+   {
+      result = DEFAULT_VALUE;
+   }
+   else
+   {
+      // product of the diagonal of U
+      for ( i = 0; i < n; i++ )
+      {
+         item = MULTIPLY_FUNCTION( result, pa[i * n + i] );
+         SET_FROM( result, item );
+         DISPOSE_FUNCTION( item );
+      }
+
+      // each row swap changes the sign
+      if ( ( (*current).swap_count % 2 ) == 1 )
+      {
+         item = NEGATE_FUNCTION( result );
+         SET_FROM( result, item );
+         DISPOSE_FUNCTION( item );
+      }
+   }
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   Matvec_lu_solve
+*/
+
+Matvec_type( Matvec_prefix ) *
+Matvec_lu_solve( Prefix )( Matvec_lu_type( Prefix ) *current, Matvec_type( Matvec_prefix ) *b )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", ( (*current)._type == MATVEC_LU_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   PRECONDITION( "current not singular", (*current).is_singular == 0 );
+   PRECONDITION( "b not null", b != NULL );
+   PRECONDITION( "b is vector", ( Matvec_rows( Matvec_prefix )( b ) == 1 ) || ( Matvec_columns( Matvec_prefix )( b ) == 1 ) );
+   PRECONDITION( "b length OK", Matvec_rows( Matvec_prefix )( b ) * Matvec_columns( Matvec_prefix )( b ) == (*current).n );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   Matvec_type( Matvec_prefix ) *result = NULL;
+
+   result
+      =  Matvec_make( Matvec_prefix )
+         (
+            Matvec_rows( Matvec_prefix )( b ),
+            Matvec_columns( Matvec_prefix )( b )
+         );
+
+   // a row vector has the same layout as a column vector
+   solve
+   (
+      current,
+      Matvec_as_array( Matvec_prefix )( b ),
+      Matvec_as_array( Matvec_prefix )( result ),
+      1
+   );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   Matvec_lu_solve_many
+*/
+
+Matvec_type( Matvec_prefix ) *
+Matvec_lu_solve_many( Prefix )( Matvec_lu_type( Prefix ) *current, Matvec_type( Matvec_prefix ) *b )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", ( (*current)._type == MATVEC_LU_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   PRECONDITION( "current not singular", (*current).is_singular == 0 );
+   PRECONDITION( "b not null", b != NULL );
+   PRECONDITION( "b rows OK", Matvec_rows( Matvec_prefix )( b ) == (*current).n );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   Matvec_type( Matvec_prefix ) *result = NULL;
+   int32_t m = Matvec_columns( Matvec_prefix )( b );
+
+   result = Matvec_make( Matvec_prefix )( (*current).n, m );
+
+   solve
+   (
+      current,
+      Matvec_as_array( Matvec_prefix )( b ),
+      Matvec_as_array( Matvec_prefix )( result ),
+      m
+   );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,207 @@
+/**
+ @file Matvec_lu.h
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "LU factorization of matrices"
+
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0):
+
+ 1. Permission is hereby granted to use, copy, modify and/or
+    distribute this package, provided that:
+       * copyright notices are retained unchanged,
+       * any distribution of this package, whether modified or not,
+         includes this license text.
+ 2. Permission is hereby also granted to distribute binary programs
+    which depend on this package. If the binary program depends on a
+    modified version of this package, you are encouraged to publicly
+    release the modified version of this package.
+
+ THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT WARRANTY. ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE AUTHORS BE LIABLE TO ANY PARTY FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES ARISING IN ANY WAY OUT OF THE USE OF THIS PACKAGE.
+
+ @section Description
+
+ Function declarations for the opaque Matvec_lu_t type.
+
+ A Matvec_lu_t holds the LU factorization with partial pivoting of a
+ square matrix, P A = L U, where P is a row permutation, L is lower
+ triangular with ones on the diagonal and U is upper triangular. The
+ factors are computed once, when the Matvec_lu_t is made, and are then
+ used for any number of solves and for the determinant.
+
+*/
+
+/**
+   includes
+*/
+
+#include "base.h"
+#include "Matvec.h"
+#include <stdarg.h>
+
+/**
+   Note that this include file does NOT have an include guard - it may
+   be included multiple times with different macro defintions.
+
+   Defines that must be present (external to this file):
+
+   Prefix - string used to name this container type
+   Matvec_prefix - string used to name the matrix type
+   Type   - the type of the value
+   Magnitude_type - the type of the magnitude or precision of Type
+
+*/
+
+/**
+   Macro definitions
+*/
+
+#define PRIMITIVE_CAT(arg, ...) arg ## __VA_ARGS__
+
+#define Matvec_lu_struct( arg ) PRIMITIVE_CAT( arg, _matvec_lu_struct )
+#define Matvec_lu_type( arg ) PRIMITIVE_CAT( arg, _matvec_lu_t )
+#define Matvec_lu_name( arg ) PRIMITIVE_CAT( arg, _matvec_lu )
+
+/**
+   Structure declarations
+*/
+
+struct Matvec_lu_struct( Prefix );
+
+/**
+   Structure typedefs
+*/
+
+typedef struct Matvec_lu_struct( Prefix ) Matvec_lu_type( Prefix );
+
+
+/*
+   Initialization
+*/
+
+/**
+   Matvec_lu_make
+
+   Return a new Matvec_lu_t instance holding the LU factorization of
+   input. Input is not changed and is not kept.
+
+   @param  input the square matrix to factor
+   @return Matvec_lu_t instance
+*/
+#define Matvec_lu_make( arg ) PRIMITIVE_CAT( arg, _matvec_lu_make )
+Matvec_lu_type( Prefix ) * Matvec_lu_make( Prefix )( Matvec_type( Matvec_prefix ) *input );
+
+/*
+   Disposal
+*/
+
+/**
+   Matvec_lu_dispose
+
+   Free a Matvec_lu_t instance. The value items are not disposed.
+
+   @param  lu Matvec_lu_t instance
+*/
+#define Matvec_lu_dispose( arg ) PRIMITIVE_CAT( arg, _matvec_lu_dispose )
+void Matvec_lu_dispose( Prefix )( Matvec_lu_type( Prefix ) **lu );
+
+/**
+   Matvec_lu_deep_dispose
+
+   Free a Matvec_lu_t instance. The value items are disposed.
+
+   @param  lu Matvec_lu_t instance
+*/
+#define Matvec_lu_deep_dispose( arg ) PRIMITIVE_CAT( arg, _matvec_lu_deep_dispose )
+void Matvec_lu_deep_dispose( Prefix )( Matvec_lu_type( Prefix ) **lu );
+
+/*
+   Access
+*/
+
+/**
+   Matvec_lu_size
+
+   Return the number of rows (and columns) of the factored matrix.
+
+   @param  lu Matvec_lu_t instance
+   @return the size of the matrix
+*/
+#define Matvec_lu_size( arg ) PRIMITIVE_CAT( arg, _matvec_lu_size )
+int32_t Matvec_lu_size( Prefix )( Matvec_lu_type( Prefix ) *lu );
+
+/*
+   Status report
+*/
+
+/**
+   Matvec_lu_is_singular
+
+   Return 1 if a pivot of the factorization was zero. A singular
+   factorization has a zero determinant and cannot be used to solve.
+
+   @param  lu Matvec_lu_t instance
+   @return 1 if the matrix is singular, 0 otherwise
+*/
+#define Matvec_lu_is_singular( arg ) PRIMITIVE_CAT( arg, _matvec_lu_is_singular )
+int32_t Matvec_lu_is_singular( Prefix )( Matvec_lu_type( Prefix ) *lu );
+
+/*
+   Measurement
+*/
+
+/**
+   Matvec_lu_determinant
+
+   Return the determinant of the factored matrix, the product of the
+   diagonal of U with the sign of the row permutation.
+
+   @param  lu Matvec_lu_t instance
+   @return the determinant
+*/
+#define Matvec_lu_determinant( arg ) PRIMITIVE_CAT( arg, _matvec_lu_determinant )
+Type Matvec_lu_determinant( Prefix )( Matvec_lu_type( Prefix ) *lu );
+
+/*
+   Transformation
+*/
+
+/**
+   Matvec_lu_solve
+
+   Return the vector x for which A x = b, where A is the factored matrix.
+   The result is a new vector of the same shape as b.
+
+   @param  lu Matvec_lu_t instance
+   @param  b a row or column vector with one item per row of A
+   @return the solution vector
+*/
+#define Matvec_lu_solve( arg ) PRIMITIVE_CAT( arg, _matvec_lu_solve )
+Matvec_type( Matvec_prefix ) * Matvec_lu_solve( Prefix )( Matvec_lu_type( Prefix ) *lu, Matvec_type( Matvec_prefix ) *b );
+
+/**
+   Matvec_lu_solve_many
+
+   Return the matrix X for which A X = B, where A is the factored matrix.
+   Each column of B is a right hand side. The result is a new matrix of
+   the same size as B.
+
+   @param  lu Matvec_lu_t instance
+   @param  b a matrix with as many rows as A
+   @return the solution matrix
+*/
+#define Matvec_lu_solve_many( arg ) PRIMITIVE_CAT( arg, _matvec_lu_solve_many )
+Matvec_type( Matvec_prefix ) * Matvec_lu_solve_many( Prefix )( Matvec_lu_type( Prefix ) *lu, Matvec_type( Matvec_prefix ) *b );
+
+
+/* End of file */
@@ -53,22 +53,47 @@ extern "C" {
    defines
 */
 
-struct node;
+#define PQUEUE_MIN_CAPACITY 16
 
 /**
-   Node structure. Holds a value
+   Parent and child index relationships
 */
 
-struct node
+/**
+   parent_index
+
+   @param index the index of an item
+   @return the index of the parent
+*/
+
+static
+int32_t
+parent_index( int32_t index )
 {
-   struct node *next;
-   Type value;
-};
+   return ( index - 1 ) / 2;
+}
+
+/**
+   left_child_index
 
-typedef struct node node_t;
+   @param index the index of an item
+   @return the index of the item's left child
+*/
+
+static
+int32_t
+left_child_index( int32_t index )
+{
+   return 2 * index + 1;
+}
 
 /**
    PQueue structure
+
+   The items are kept in a binary heap in array, the item at index 0 is the
+   top of the PQueue. sequence[i] is the number of the put that added
+   array[i]. Every item comes before its children by is_before, so items
+   of equal priority come out in the order they were put.
 */
 
 struct PQueue_struct( Prefix )
@@ -76,74 +101,235 @@ struct PQueue_struct( Prefix )
    int32_t _type;
    int32_t _item_type;
 
-   node_t *first;
-   node_t *last;
+   Type *array;
+   int64_t *sequence;
    int32_t count;
+   int32_t capacity;
+   int64_t next_sequence;
 
    MULTITHREAD_MUTEX_DEFINITION( mutex );
 };
 
 /**
-   node_make
+   ensure_capacity
+
+   grow the array to hold at least count items
+
+   @param current the PQueue
+   @param count the number of items the array must hold
 */
 
 static
-node_t *
-node_make( void )
+void
+ensure_capacity( PQueue_type( Prefix ) *current, int32_t count )
 {
-   node_t *node = ( node_t * ) calloc( 1, sizeof( node_t ) );
-   CHECK( "node not null", node != NULL );
+   int32_t capacity = (*current).capacity;
+
+   if ( count > capacity )
+   {
+      while ( capacity < count )
+      {
+         capacity = 2 * capacity;
+      }
+
+      (*current).array = ( Type * ) realloc( (*current).array, capacity * sizeof( Type ) );
+      CHECK( "(*current).array allocated correctly", (*current).array != NULL );
+
+      (*current).sequence = ( int64_t * ) realloc( (*current).sequence, capacity * sizeof( int64_t ) );
+      CHECK( "(*current).sequence allocated correctly", (*current).sequence != NULL );
 
-   return node;
+      (*current).capacity = capacity;
+   }
+
+   return;
 }
 
 /**
-   node_dispose
+   is_before
+
+   1 if the item a put by put number a_sequence comes out before the item b
+   put by put number b_sequence. Items that VALUE_ORDER_FUNCTION orders both
+   ways have equal priority and come out in put order.
+
+   @param a the first item
+   @param a_sequence the put number of a
+   @param b the second item
+   @param b_sequence the put number of b
+   @return 1 if a comes before b, 0 otherwise
+*/
+
+static
+int32_t
+is_before( Type a, int64_t a_sequence, Type b, int64_t b_sequence )
+{
+   int32_t result = 0;
+
+   if ( VALUE_ORDER_FUNCTION( a, b ) == 1 )
+   {
+      result = ( ( VALUE_ORDER_FUNCTION( b, a ) == 0 ) || ( a_sequence < b_sequence ) );
+   }
+
+   return result;
+}
+
+/**
+   sift_up
+
+   move the item at index toward the top until its parent comes before it.
+   The item is held aside and parents are moved down into the hole, so
+   each level costs one comparison and one copy.
+
+   @param array the heap array
+   @param sequence the put numbers of the items in array
+   @param index the index of the item to move
 */
 
 static
 void
-node_dispose( node_t **node )
+sift_up( Type *array, int64_t *sequence, int32_t index )
 {
-   PRECONDITION( "node not null", node != NULL );
-   PRECONDITION( "node not null", *node != NULL );
+   int32_t parent_i = 0;
+   Type value = array[index];
+   int64_t value_sequence = sequence[index];
+
+   while ( index > 0 )
+   {
+      parent_i = parent_index( index );
 
-   free(*node);
-   *node = NULL;
+      if ( is_before( array[parent_i], sequence[parent_i], value, value_sequence ) == 1 )
+      {
+         break;
+      }
+
+      array[index] = array[parent_i];
+      sequence[index] = sequence[parent_i];
+      index = parent_i;
+   }
+
+   array[index] = value;
+   sequence[index] = value_sequence;
 
    return;
 }
 
 /**
-   Invariant
+   sift_down
+
+   move the item at index toward the bottom until it comes before its
+   children. The item is held aside and children are moved up into the hole.
+
+   @param array the heap array
+   @param sequence the put numbers of the items in array
+   @param count the number of items in the heap
+   @param index the index of the item to move
 */
 
-#if INVARIANT_CONDITIONAL != 0
+static
+void
+sift_down( Type *array, int64_t *sequence, int32_t count, int32_t index )
+{
+   int32_t child_i = 0;
+   Type value = array[index];
+   int64_t value_sequence = sequence[index];
+
+   child_i = left_child_index( index );
+
+   while ( child_i < count )
+   {
+      // pick the child that comes first
+      if (
+         ( child_i + 1 < count )
+         &&
+         ( is_before( array[child_i + 1], sequence[child_i + 1], array[child_i], sequence[child_i] ) == 1 )
+      )
+      {
+         child_i = child_i + 1;
+      }
+
+      if ( is_before( value, value_sequence, array[child_i], sequence[child_i] ) == 1 )
+      {
+         break;
+      }
+
+      array[index] = array[child_i];
+      sequence[index] = sequence[child_i];
+      index = child_i;
+      child_i = left_child_index( index );
+   }
+
+   array[index] = value;
+   sequence[index] = value_sequence;
+
+   return;
+}
+
+/**
+   heapify
+
+   restore heap order for the whole array, bottom up
+
+   @param array the heap array
+   @param sequence the put numbers of the items in array
+   @param count the number of items in the heap
+*/
 
 static
-int32_t
-is_empty_implies_first_and_last_null( PQueue_type( Prefix ) *p )
+void
+heapify( Type *array, int64_t *sequence, int32_t count )
 {
-   int32_t result = 1;
+   int32_t i = 0;
 
-   if ( (*p).count == 0 )
+   for ( i = count / 2 - 1; i >= 0; i-- )
    {
-      result = ( ( (*p).first == NULL ) && ( (*p).last == NULL ) );
+      sift_down( array, sequence, count, i );
+   }
+
+   return;
+}
+
+/**
+   remove_top
+
+   remove the item at the top of the PQueue
+
+   @param current the PQueue
+   @return the removed item
+*/
+
+static
+Type
+remove_top( PQueue_type( Prefix ) *current )
+{
+   Type *array = (*current).array;
+   int64_t *sequence = (*current).sequence;
+   Type result = array[0];
+
+   (*current).count = (*current).count - 1;
+
+   // move last item to top and restore order
+   if ( (*current).count > 0 )
+   {
+      array[0] = array[ (*current).count ];
+      sequence[0] = sequence[ (*current).count ];
+      sift_down( array, sequence, (*current).count, 0 );
    }
 
    return result;
 }
 
+/**
+   Invariant
+*/
+
+#if INVARIANT_CONDITIONAL != 0
+
 static
 int32_t
-last_next_is_null( PQueue_type( Prefix ) *p )
+array_not_null( PQueue_type( Prefix ) *p )
 {
    int32_t result = 1;
 
-   if ( (*p).last != NULL )
-   {
-      result = ( ( *(*p).last ).next == NULL ) ;
-   }
+   result = ( (*p).array != NULL );
 
    return result;
 }
@@ -164,17 +350,8 @@ int32_t
 valid_count( PQueue_type( Prefix ) *p )
 {
    int32_t result = 1;
-   int32_t n = 0;
 
-   node_t *node = (*p).first;
-
-   while( node != NULL )
-   {
-      n = n + 1;
-      node = (*node).next;
-   }
-
-   result = ( n == (*p).count );
+   result = ( (*p).count <= (*p).capacity );
 
    return result;
 }
@@ -184,20 +361,11 @@ int32_t
 is_in_order( PQueue_type( Prefix ) *p )
 {
    int32_t result = 1;
-   node_t *n1 = (*p).first;
-   node_t *n2 = NULL;
-
-   if ( n1 != NULL )
-   {
-      n2 = (*n1).next;
-   }
+   int32_t i = 0;
 
-   while( ( n2 != NULL ) && ( result == 1 ) )
+   for( i = 1; ( i < (*p).count ) && ( result == 1 ); i++ )
    {
-      result = VALUE_ORDER_FUNCTION( (*n1).value, (*n2).value );
-
-      n1 = n2;
-      n2 = (*n2).next;
+      result = is_before( (*p).array[ parent_index( i ) ], (*p).sequence[ parent_index( i ) ], (*p).array[i], (*p).sequence[i] );
    }
 
    return result;
@@ -206,8 +374,7 @@ is_in_order( PQueue_type( Prefix ) *p )
 static
 void invariant( PQueue_type( Prefix ) *p )
 {
-   assert( ( ( void ) "empty implies first and last null", is_empty_implies_first_and_last_null( p ) ) );
-   assert( ( ( void ) "last next is null", last_next_is_null( p ) ) );
+   assert( ( ( void ) "array not null", array_not_null( p ) ) );
    assert( ( ( void ) "nonnegative count", nonnegative_count( p ) ) );
    assert( ( ( void ) "valid count", valid_count( p ) ) );
    assert( ( ( void ) "elements in order", is_in_order( p ) ) );
@@ -232,6 +399,17 @@ PQueue_make( Prefix )( void )
    (*result)._type = PQUEUE_TYPE;
    (*result)._item_type = Type_Code;
 
+   // allocate array
+   (*result).array = ( Type * ) calloc( PQUEUE_MIN_CAPACITY, sizeof( Type ) );
+   CHECK( "(*result).array allocated correctly", (*result).array != NULL );
+
+   (*result).sequence = ( int64_t * ) calloc( PQUEUE_MIN_CAPACITY, sizeof( int64_t ) );
+   CHECK( "(*result).sequence allocated correctly", (*result).sequence != NULL );
+
+   (*result).count = 0;
+   (*result).capacity = PQUEUE_MIN_CAPACITY;
+   (*result).next_sequence = 0;
+
    MULTITHREAD_MUTEX_INIT( (*result).mutex );
 
    INVARIANT( result );
@@ -253,14 +431,8 @@ PQueue_dispose( Prefix )( PQueue_type( Prefix ) **current )
    INVARIANT(*current);
 
    // delete PQueue items
-   node_t *item = (**current).first;
-   node_t *next = NULL;
-   while( item != NULL )
-   {
-      next = (*item).next;
-      node_dispose( &item );
-      item = next;
-   }
+   free( (**current).array );
+   free( (**current).sequence );
 
    MULTITHREAD_MUTEX_DESTROY( (**current).mutex );
 
@@ -286,17 +458,17 @@ PQueue_deep_dispose( Prefix )( PQueue_type( Prefix ) **current )
    LOCK( (**current).mutex );
    INVARIANT(*current);
 
+   int32_t i = 0;
+
    // delete PQueue items
-   node_t *item = (**current).first;
-   node_t *next = NULL;
-   while( item != NULL )
+   for( i = 0; i < (**current).count; i++ )
    {
-      next = (*item).next;
-      VALUE_DISPOSE_FUNCTION( (*item).value );
-      node_dispose( &item );
-      item = next;
+      VALUE_DISPOSE_FUNCTION( (**current).array[i] );
    }
 
+   free( (**current).array );
+   free( (**current).sequence );
+
    MULTITHREAD_MUTEX_DESTROY( (**current).mutex );
 
    // delete PQueue struct
@@ -321,7 +493,7 @@ PQueue_item( Prefix )( PQueue_type( Prefix ) *current )
    INVARIANT( current );
    PRECONDITION( "current not empty", (*current).count > 0 );
 
-   Type value = ( *(*current).first ).value;
+   Type value = (*current).array[0];
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -381,85 +553,67 @@ PQueue_put( Prefix )( PQueue_type( Prefix ) *current, Type value )
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   int32_t flag = 0;
-   int32_t completed_flag = 0;
-   node_t *n = NULL;
-   node_t *n1 = NULL;
-   node_t *new_node = node_make();
-   ( *new_node ).value = value;
+   ensure_capacity( current, (*current).count + 1 );
 
-   if ( (*current).count == 0 )
+   // put value at end of array and move it up to its place
+   (*current).array[ (*current).count ] = value;
+   (*current).sequence[ (*current).count ] = (*current).next_sequence;
+   (*current).next_sequence = (*current).next_sequence + 1;
+   (*current).count = (*current).count + 1;
+
+   sift_up( (*current).array, (*current).sequence, (*current).count - 1 );
+
+   INVARIANT( current );
+   POSTCONDITION( "PQueue not empty", (*current).count > 0 );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   PQueue_put_many
+*/
+
+void
+PQueue_put_many( Prefix )( PQueue_type( Prefix ) *current, Type *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", ( (*current)._type == PQUEUE_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+
+   int32_t i = 0;
+   int32_t old_count = (*current).count;
+
+   ensure_capacity( current, old_count + count );
+
+   // append the new values, numbered as if put one by one
+   memcpy( &( (*current).array[old_count] ), array, count * sizeof( Type ) );
+   for( i = old_count; i < old_count + count; i++ )
    {
-      // PQueue is empty, make this the first item
-      (*current).first = new_node;
-      (*current).last = new_node;
-      (*current).count = 1;
+      (*current).sequence[i] = (*current).next_sequence;
+      (*current).next_sequence = (*current).next_sequence + 1;
+   }
+   (*current).count = old_count + count;
+
+   if ( count > old_count )
+   {
+      // many new values, rebuild the heap bottom up in linear time
+      heapify( (*current).array, (*current).sequence, (*current).count );
    }
    else
    {
-      // otherwise start with first node
-      n = (*current).first;
-      flag = VALUE_ORDER_FUNCTION( (*n).value, ( *new_node ).value );
-
-      // if new_node does not come before n, increment n
-      if ( flag == 1 )
-      {
-         n1 = n;
-         n = (*n).next;
-      }
-      // if new_node comes before n, it is now the first element
-      else
+      // few new values, move each one up to its place
+      for( i = old_count; i < (*current).count; i++ )
       {
-         ( *new_node ).next = n;
-         (*current).first = new_node;
-         (*current).count = (*current).count + 1;
-         completed_flag = 1;
-      }
-
-      // if not complete, loop through elements until we find where new_node
-      // should be inserted
-      if ( completed_flag == 0 )
-      {
-         while( n != NULL )
-         {
-            flag = VALUE_ORDER_FUNCTION( (*n).value, ( *new_node ).value );
-
-            if ( flag == 1 )
-            {
-               // if new_node comes after n, increment n
-               n1 = n;
-               n = (*n).next;
-            }
-            else
-            {
-               // if new node comes before n, insert new_node before n
-               (*n1).next = new_node;
-               ( *new_node ).next = n;
-               (*current).count = (*current).count + 1;
-               completed_flag = 1;
-
-               // exit loop
-               break;
-            }
-         }
-
-         // last possiblity is that new_node is the new last element
-         if ( completed_flag == 0 )
-         {
-            (*n1).next = new_node;
-            (*current).last = new_node;
-            (*current).count = (*current).count + 1;
-            completed_flag = 1;
-         }
-
+         sift_up( (*current).array, (*current).sequence, i );
       }
    }
 
-   // make sure last element's next is null
-   ( *(*current).last ).next = NULL;
-
    INVARIANT( current );
-   POSTCONDITION( "PQueue not empty", (*current).count > 0 );
+   POSTCONDITION( "count ok", (*current).count == old_count + count );
    UNLOCK( (*current).mutex );
 
    return;
@@ -478,21 +632,8 @@ PQueue_remove( Prefix )( PQueue_type( Prefix ) *current )
    INVARIANT( current );
    PRECONDITION( "current not empty", (*current).count > 0 );
 
-   node_t *node = (*current).first;
-
-   // remove the node
-   if ( node != NULL )
-   {
-      (*current).first = (*node).next;
-      (*current).count = (*current).count - 1;
-      node_dispose( &node );
-
-      // if PQueue is now empty, set last to NULL
-      if ( (*current).count == 0 )
-      {
-         (*current).last = NULL;
-      }
-   }
+   // remove the top item
+   remove_top( current );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -513,22 +654,9 @@ PQueue_remove_and_dispose( Prefix )( PQueue_type( Prefix ) *current )
    INVARIANT( current );
    PRECONDITION( "current not empty", (*current).count > 0 );
 
-   node_t *node = (*current).first;
-
-   // remove the node
-   if ( node != NULL )
-   {
-      (*current).first = (*node).next;
-      (*current).count = (*current).count - 1;
-      VALUE_DISPOSE_FUNCTION( (*node).value );
-      node_dispose( &node );
-
-      // if PQueue is now empty, set last to NULL
-      if ( (*current).count == 0 )
-      {
-         (*current).last = NULL;
-      }
-   }
+   // dispose of the top item and remove it
+   VALUE_DISPOSE_FUNCTION( (*current).array[0] );
+   remove_top( current );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -550,25 +678,11 @@ PQueue_prune( Prefix )( PQueue_type( Prefix ) *current, int32_t count )
    PRECONDITION( "PQueue has enough items", (*current).count >= count );
 
    int32_t i = 0;
-   node_t *node = NULL;
 
-   // remove the node
+   // remove count items from the top
    for( i = 0; i < count; i++ )
    {
-      node = (*current).first;
-
-      if ( node != NULL )
-      {
-         (*current).first = (*node).next;
-         (*current).count = (*current).count - 1;
-         node_dispose( &node );
-      }
-   }
-
-   // if PQueue is now empty, set last to NULL
-   if ( (*current).count == 0 )
-   {
-      (*current).last = NULL;
+      remove_top( current );
    }
 
    INVARIANT( current );
@@ -591,26 +705,12 @@ PQueue_prune_and_dispose( Prefix )( PQueue_type( Prefix ) *current, int32_t coun
    PRECONDITION( "PQueue has enough items", (*current).count >= count );
 
    int32_t i = 0;
-   node_t *node = NULL;
 
-   // remove the node
+   // remove count items from the top
    for( i = 0; i < count; i++ )
    {
-      node = (*current).first;
-
-      if ( node != NULL )
-      {
-         (*current).first = (*node).next;
-         (*current).count = (*current).count - 1;
-         VALUE_DISPOSE_FUNCTION( (*node).value );
-         node_dispose( &node );
-      }
-   }
-
-   // if PQueue is now empty, set last to NULL
-   if ( (*current).count == 0 )
-   {
-      (*current).last = NULL;
+      VALUE_DISPOSE_FUNCTION( (*current).array[0] );
+      remove_top( current );
    }
 
    INVARIANT( current );
@@ -635,25 +735,10 @@ PQueue_keep( Prefix )( PQueue_type( Prefix ) *current, int32_t count )
    int32_t i = 0;
    int32_t n = (*current).count - count;
 
-   node_t *node = NULL;
-
-   // remove n nodes
+   // remove n items from the top
    for( i = 0; i < n; i++ )
    {
-      node = (*current).first;
-
-      if ( node != NULL )
-      {
-         (*current).first = (*node).next;
-         (*current).count = (*current).count - 1;
-         node_dispose( &node );
-      }
-   }
-
-   // if PQueue is now empty, set last to NULL
-   if ( (*current).count == 0 )
-   {
-      (*current).last = NULL;
+      remove_top( current );
    }
 
    INVARIANT( current );
@@ -678,26 +763,11 @@ PQueue_keep_and_dispose( Prefix )( PQueue_type( Prefix ) *current, int32_t count
    int32_t i = 0;
    int32_t n = (*current).count - count;
 
-   node_t *node = NULL;
-
-   // remove n nodes
+   // remove n items from the top
    for( i = 0; i < n; i++ )
    {
-      node = (*current).first;
-
-      if ( node != NULL )
-      {
-         (*current).first = (*node).next;
-         (*current).count = (*current).count - 1;
-         VALUE_DISPOSE_FUNCTION( (*node).value );
-         node_dispose( &node );
-      }
-   }
-
-   // if PQueue is now empty, set last to NULL
-   if ( (*current).count == 0 )
-   {
-      (*current).last = NULL;
+      VALUE_DISPOSE_FUNCTION( (*current).array[0] );
+      remove_top( current );
    }
 
    INVARIANT( current );
@@ -718,20 +788,8 @@ PQueue_wipe_out( Prefix )( PQueue_type( Prefix ) *current )
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   node_t *node = (*current).first;
-   node_t *next = NULL;
-
-   // remove all nodes
-   while ( node != NULL )
-   {
-      next = (*node).next;
-      node_dispose( &node );
-      node = next;
-   }
-
+   // remove all items
    (*current).count = 0;
-   (*current).first = NULL;
-   (*current).last = NULL;
 
    INVARIANT( current );
    POSTCONDITION( "PQueue is empty", (*current).count == 0 );
@@ -752,21 +810,15 @@ PQueue_wipe_out_and_dispose( Prefix )( PQueue_type( Prefix ) *current )
    LOCK( (*current).mutex );
    INVARIANT( current );
 
-   node_t *node = (*current).first;
-   node_t *next = NULL;
+   int32_t i = 0;
 
-   // remove all nodes
-   while ( node != NULL )
+   // dispose of all items
+   for( i = 0; i < (*current).count; i++ )
    {
-      next = (*node).next;
-      VALUE_DISPOSE_FUNCTION( (*node).value );
-      node_dispose( &node );
-      node = next;
+      VALUE_DISPOSE_FUNCTION( (*current).array[i] );
    }
 
    (*current).count = 0;
-   (*current).first = NULL;
-   (*current).last = NULL;
 
    INVARIANT( current );
    POSTCONDITION( "PQueue is empty", (*current).count == 0 );
@@ -777,4 +829,3 @@ PQueue_wipe_out_and_dispose( Prefix )( PQueue_type( Prefix ) *current )
 
 
 /* End of file */
-
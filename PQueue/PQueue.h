@@ -33,6 +33,9 @@
 
  Function declarations for the opaque PQueue_t type.
 
+ The PQueue is an array based binary heap. Put and remove are O(log n).
+ Items with equal priority come out in the order they were put.
+
 */
 
 /**
@@ -184,6 +187,20 @@ int32_t PQueue_is_empty( Prefix )( PQueue_type( Prefix ) *current );
 #define PQueue_put( arg ) PRIMITIVE_CAT( arg, _pqueue_put )
 void PQueue_put( Prefix )( PQueue_type( Prefix ) *current, Type value );
 
+/**
+   PQueue_put_many
+
+   Insert count values from array into PQueue. When count is larger than the
+   number of items already in the PQueue, the PQueue is rebuilt in one pass,
+   which is faster than count calls to PQueue_put.
+
+   @param  PQueue PQueue_t instance
+   @param  array the values to insert
+   @param  count the number of values in array
+*/
+#define PQueue_put_many( arg ) PRIMITIVE_CAT( arg, _pqueue_put_many )
+void PQueue_put_many( Prefix )( PQueue_type( Prefix ) *current, Type *array, int32_t count );
+
 /**
    Removal
 */
@@ -0,0 +1,1350 @@
+/**
+ @file PSorter.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "Parallel Sorter"
+
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0):
+
+ 1. Permission is hereby granted to use, copy, modify and/or
+    distribute this package, provided that:
+       * copyright notices are retained unchanged,
+       * any distribution of this package, whether modified or not,
+         includes this license text.
+ 2. Permission is hereby also granted to distribute binary programs
+    which depend on this package. If the binary program depends on a
+    modified version of this package, you are encouraged to publicly
+    release the modified version of this package.
+
+ THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT WARRANTY. ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE AUTHORS BE LIABLE TO ANY PARTY FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES ARISING IN ANY WAY OUT OF THE USE OF THIS PACKAGE.
+
+ @section Description
+
+ Function definitions for the opaque PSorter_t type.
+
+ The sort is a stable merge sort shared among a pool of worker threads
+ owned by the psorter. The items are cut into one run per thread, each
+ thread sorts its run, then runs are merged in pairs until one is left.
+ Every merge is cut into pieces of equal output length by a binary search
+ for the matching split points in the two input runs ("merge path"), so
+ all threads stay busy in the last merges too.
+
+*/
+
+#include "PSorter.h"
+
+/**
+   Includes
+*/
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#ifdef PROTOCOLS_ENABLED
+#include "Protocol_Base.h"
+#include "Protocol_Base.ph"
+#include "P_Indexable.ph"
+#include "P_Basic.ph"
+#include "P_Sorter.ph"
+#endif // PROTOCOLS_ENABLED
+
+#include "P_Indexable.h"
+
+#ifdef MULTITHREADED
+#include MULTITHREAD_INCLUDE
+#endif
+
+#include "pool.h"
+#include "dbc.h"
+
+/**
+   defines
+*/
+
+#define PSORTER_DEFAULT_GRAIN_SIZE 16384
+#define PSORTER_INSERTION_SORT_SIZE 16
+
+/**
+   work structure
+
+   shared arguments of the jobs of one parallel step
+*/
+
+typedef struct
+{
+   Type *src;
+   Type *dst;
+   Type *array;
+   Type *temp;
+   int32_t (*func)( Type a, Type b );
+   int32_t *bounds;
+   int32_t run_count;
+   int32_t piece_count;
+   int32_t *results;
+} work_t;
+
+/**
+   PSorter structure
+*/
+
+struct PSorter_struct( Prefix )
+{
+
+   PROTOCOLS_DEFINITION;
+
+   int32_t _type;
+
+   int32_t (*func)( Type a, Type b );
+
+   int32_t thread_count;
+   int32_t grain_size;
+
+   pool_t pool;
+
+   MULTITHREAD_MUTEX_DEFINITION( mutex );
+};
+
+/**
+   Invariant
+*/
+
+#if INVARIANT_CONDITIONAL != 0
+
+static
+int32_t
+struct_ok( PSorter_type( Prefix ) *p )
+{
+   int32_t result = 1;
+
+   result = ( (*p).func != NULL );
+
+   return result;
+}
+
+static
+int32_t
+settings_ok( PSorter_type( Prefix ) *p )
+{
+   int32_t result = 1;
+
+   result = ( ( (*p).thread_count >= 1 ) && ( (*p).grain_size >= 1 ) );
+
+   return result;
+}
+
+static
+void invariant( PSorter_type( Prefix ) *p )
+{
+   assert( ( ( void ) "struct ok count", struct_ok( p ) ) );
+   assert( ( ( void ) "settings ok", settings_ok( p ) ) );
+   return;
+}
+
+#else
+
+static
+void invariant( p )
+{
+   return;
+}
+
+#endif
+
+#ifdef PROTOCOLS_ENABLED
+
+/**
+   basic protocol function array
+*/
+
+static
+void *
+p_basic_table[P_BASIC_FUNCTION_COUNT]
+=
+{
+   PSorter_dispose( Prefix ),
+   PSorter_deep_dispose( Prefix ),
+   PSorter_is_equal( Prefix ),
+   PSorter_is_deep_equal( Prefix ),
+   PSorter_copy( Prefix ),
+   PSorter_deep_copy( Prefix ),
+   PSorter_clone( Prefix ),
+   PSorter_deep_clone( Prefix )
+};
+
+/**
+   sorter protocol function array
+*/
+
+static
+void *
+p_sorter_table[P_SORTER_FUNCTION_COUNT]
+=
+{
+   PSorter_sort_predefined_comparison_function( Prefix ),
+   PSorter_is_sorted_predefined_comparison_function( Prefix )
+
+};
+
+/**
+   protocol get_function
+*/
+
+static
+void *
+get_function
+(
+   int32_t protocol_id,
+   int32_t function_id
+)
+{
+   PRECONDITION( "protocol id is ok", protocol_base_is_valid_protocol( protocol_id ) == 1 );
+
+   void *result = NULL;
+
+   switch ( protocol_id )
+   {
+      case P_BASIC_TYPE:
+      {
+         if ( ( function_id >= 0 ) && ( function_id <= P_BASIC_FUNCTION_MAX ) )
+         {
+            result = p_basic_table[ function_id ];
+         }
+         break;
+      }
+
+      case P_SORTER_TYPE:
+      {
+         if ( ( function_id >= 0 ) && ( function_id <= P_SORTER_FUNCTION_MAX ) )
+         {
+            result = p_sorter_table[ function_id ];
+         }
+      }
+
+   }
+
+   return result;
+}
+
+/**
+   protocol supports_protocol
+*/
+
+static
+int32_t
+supports_protocol
+(
+   int32_t protocol_id
+)
+{
+   PRECONDITION( "protocol id is ok", protocol_base_is_valid_protocol( protocol_id ) == 1 );
+
+   int32_t result = 0;
+
+   switch ( protocol_id )
+   {
+      case P_BASIC_TYPE:
+      {
+         result = 1;
+         break;
+      }
+
+      case P_SORTER_TYPE:
+      {
+         result = 1;
+      }
+
+   }
+
+   return result;
+}
+
+#endif // PROTOCOLS_ENABLED
+
+/**
+   default_thread_count
+
+   @return the number of online processors, at least 1
+*/
+
+static
+int32_t
+default_thread_count( void )
+{
+   int32_t result = ( int32_t ) sysconf( _SC_NPROCESSORS_ONLN );
+
+   if ( result < 1 )
+   {
+      result = 1;
+   }
+
+   return result;
+}
+
+/**
+   insertion_sort
+
+   stable insertion sort of array[i_start] to array[i_end - 1]
+*/
+
+static
+void
+insertion_sort
+(
+   Type *array,
+   int32_t (*func)( Type a, Type b ),
+   int32_t i_start,
+   int32_t i_end
+)
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   Type value;
+
+   for ( i = i_start + 1; i < i_end; i++ )
+   {
+      value = array[i];
+      j = i;
+
+      while ( ( j > i_start ) && ( func( array[j - 1], value ) > 0 ) )
+      {
+         array[j] = array[j - 1];
+         j = j - 1;
+      }
+
+      array[j] = value;
+   }
+
+   return;
+}
+
+/**
+   merge
+
+   stable merge of a[0..na) and b[0..nb) into out
+
+   @param a the first sorted input
+   @param na the number of items in a
+   @param b the second sorted input
+   @param nb the number of items in b
+   @param out receives na + nb items
+   @param func the comparison function
+*/
+
+static
+void
+merge
+(
+   Type *a,
+   int32_t na,
+   Type *b,
+   int32_t nb,
+   Type *out,
+   int32_t (*func)( Type a, Type b )
+)
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+
+   while ( ( i < na ) && ( j < nb ) )
+   {
+      if ( func( a[i], b[j] ) <= 0 )
+      {
+         out[k] = a[i];
+         i = i + 1;
+      }
+      else
+      {
+         out[k] = b[j];
+         j = j + 1;
+      }
+
+      k = k + 1;
+   }
+
+   if ( i < na )
+   {
+      memcpy( &out[k], &a[i], ( na - i ) * sizeof( Type ) );
+   }
+
+   if ( j < nb )
+   {
+      memcpy( &out[k], &b[j], ( nb - j ) * sizeof( Type ) );
+   }
+
+   return;
+}
+
+/**
+   split_merge
+
+   stable merge sort of array[i_start] to array[i_end - 1]. array1 holds
+   the same items on entry and is used as working space.
+
+   @param array1 working array
+   @param array receives the sorted items
+   @param func the comparison function
+   @param i_start the index of the first item
+   @param i_end one past the index of the last item
+*/
+
+static
+void
+split_merge
+(
+   Type *array1,
+   Type *array,
+   int32_t (*func)( Type a, Type b ),
+   int32_t i_start,
+   int32_t i_end
+)
+{
+   int32_t i_middle = 0;
+
+   if ( ( i_end - i_start ) <= PSORTER_INSERTION_SORT_SIZE )
+   {
+      insertion_sort( array, func, i_start, i_end );
+   }
+   else
+   {
+      i_middle = i_start + ( i_end - i_start ) / 2;
+
+      // sort both halves into array1, then merge them back into array
+      split_merge( array, array1, func, i_start, i_middle );
+      split_merge( array, array1, func, i_middle, i_end );
+
+      merge
+      (
+         &array1[i_start],
+         i_middle - i_start,
+         &array1[i_middle],
+         i_end - i_middle,
+         &array[i_start],
+         func
+      );
+   }
+
+   return;
+}
+
+/**
+   co_rank
+
+   find how many of the first k items of the stable merge of a and b come
+   from a
+
+   @param a the first sorted input
+   @param na the number of items in a
+   @param b the second sorted input
+   @param nb the number of items in b
+   @param k the number of merged items
+   @param func the comparison function
+   @return the number of the k items taken from a
+*/
+
+static
+int32_t
+co_rank
+(
+   Type *a,
+   int32_t na,
+   Type *b,
+   int32_t nb,
+   int32_t k,
+   int32_t (*func)( Type a, Type b )
+)
+{
+   int32_t lo = 0;
+   int32_t hi = 0;
+   int32_t i = 0;
+
+   lo = ( k > nb ) ? k - nb : 0;
+   hi = ( k < na ) ? k : na;
+
+   // find the first i for which a[i] is merged after b[k - i - 1]
+   while ( lo < hi )
+   {
+      i = lo + ( hi - lo ) / 2;
+
+      if ( func( a[i], b[k - i - 1] ) <= 0 )
+      {
+         lo = i + 1;
+      }
+      else
+      {
+         hi = i;
+      }
+   }
+
+   return lo;
+}
+
+/**
+   sort_run_job
+
+   sort run index of (*work).array, leave the result in (*work).dst
+*/
+
+static
+void
+sort_run_job( void *arg, int32_t index )
+{
+   work_t *work = ( work_t * ) arg;
+   int32_t i_start = (*work).bounds[index];
+   int32_t i_end = (*work).bounds[index + 1];
+   Type *other = NULL;
+
+   // both arrays must hold the items before split_merge
+   memcpy( &(*work).temp[i_start], &(*work).array[i_start], ( i_end - i_start ) * sizeof( Type ) );
+
+   other = ( (*work).dst == (*work).array ) ? (*work).temp : (*work).array;
+
+   split_merge( other, (*work).dst, (*work).func, i_start, i_end );
+
+   return;
+}
+
+/**
+   merge_piece_job
+
+   merge one piece of a pair of runs from (*work).src into (*work).dst
+*/
+
+static
+void
+merge_piece_job( void *arg, int32_t index )
+{
+   work_t *work = ( work_t * ) arg;
+   int32_t pair = index / (*work).piece_count;
+   int32_t piece = index % (*work).piece_count;
+   int32_t run = 2 * pair;
+   int32_t i_start = 0;
+   int32_t i_middle = 0;
+   int32_t i_end = 0;
+   int32_t na = 0;
+   int32_t nb = 0;
+   int32_t k1 = 0;
+   int32_t k2 = 0;
+   int32_t i1 = 0;
+   int32_t i2 = 0;
+   Type *a = NULL;
+   Type *b = NULL;
+
+   // a run without a partner is merged with an empty run, i.e. copied
+   i_start = (*work).bounds[run];
+   i_middle = (*work).bounds[ ( run + 1 < (*work).run_count ) ? run + 1 : (*work).run_count ];
+   i_end = (*work).bounds[ ( run + 2 < (*work).run_count ) ? run + 2 : (*work).run_count ];
+
+   a = &(*work).src[i_start];
+   b = &(*work).src[i_middle];
+   na = i_middle - i_start;
+   nb = i_end - i_middle;
+
+   // this piece writes merged items k1 to k2 - 1 of the pair
+   k1 = ( int32_t ) ( ( ( int64_t ) ( na + nb ) * piece ) / (*work).piece_count );
+   k2 = ( int32_t ) ( ( ( int64_t ) ( na + nb ) * ( piece + 1 ) ) / (*work).piece_count );
+
+   i1 = co_rank( a, na, b, nb, k1, (*work).func );
+   i2 = co_rank( a, na, b, nb, k2, (*work).func );
+
+   merge
+   (
+      &a[i1],
+      i2 - i1,
+      &b[k1 - i1],
+      ( k2 - i2 ) - ( k1 - i1 ),
+      &(*work).dst[i_start + k1],
+      (*work).func
+   );
+
+   return;
+}
+
+/**
+   is_sorted_job
+
+   check that a chunk of (*work).src is in order, including its first
+   item against the last item of the previous chunk
+*/
+
+static
+void
+is_sorted_job( void *arg, int32_t index )
+{
+   work_t *work = ( work_t * ) arg;
+   int32_t i = 0;
+   int32_t i_start = (*work).bounds[index];
+   int32_t i_end = (*work).bounds[index + 1];
+
+   (*work).results[index] = 1;
+
+   if ( i_start == 0 )
+   {
+      i_start = 1;
+   }
+
+   for ( i = i_start; i < i_end; i++ )
+   {
+      if ( (*work).func( (*work).src[i - 1], (*work).src[i] ) > 0 )
+      {
+         (*work).results[index] = 0;
+         break;
+      }
+   }
+
+   return;
+}
+
+/**
+   chunk_count
+
+   number of chunks of at least grain_size items for up to thread_count
+   threads
+*/
+
+static
+int32_t
+chunk_count( PSorter_type( Prefix ) *current, int32_t n )
+{
+   int32_t result = (*current).thread_count;
+
+   if ( n / (*current).grain_size < result )
+   {
+      result = n / (*current).grain_size;
+   }
+
+   if ( result < 1 )
+   {
+      result = 1;
+   }
+
+   return result;
+}
+
+/**
+   make_bounds
+
+   split n items into count chunks of nearly equal size
+
+   @return array of count + 1 chunk boundaries
+*/
+
+static
+int32_t *
+make_bounds( int32_t n, int32_t count )
+{
+   int32_t i = 0;
+   int32_t *result = ( int32_t * ) calloc( count + 1, sizeof( int32_t ) );
+   CHECK( "result allocated correctly", result != NULL );
+
+   for ( i = 0; i <= count; i++ )
+   {
+      result[i] = ( int32_t ) ( ( ( int64_t ) n * i ) / count );
+   }
+
+   return result;
+}
+
+/**
+   sort_array
+
+   parallel stable merge sort of array[0] to array[n - 1]
+
+   @param current the psorter
+   @param array the items
+   @param n the number of items
+   @param func the comparison function
+*/
+
+static
+void
+sort_array
+(
+   PSorter_type( Prefix ) *current,
+   Type *array,
+   int32_t n,
+   int32_t (*func)( Type a, Type b )
+)
+{
+   int32_t i = 0;
+   int32_t pass_count = 0;
+   int32_t pair_count = 0;
+   work_t work;
+
+   if ( n >= 2 )
+   {
+      memset( &work, 0, sizeof( work_t ) );
+
+      work.array = array;
+      work.func = func;
+      work.run_count = chunk_count( current, n );
+      work.bounds = make_bounds( n, work.run_count );
+
+      work.temp = ( Type * ) calloc( n, sizeof( Type ) );
+      CHECK( "temp allocated correctly", work.temp != NULL );
+
+      // count merge passes so the last one writes into array
+      for ( i = 1; i < work.run_count; i = 2 * i )
+      {
+         pass_count = pass_count + 1;
+      }
+
+      // sort one run per thread
+      work.dst = ( ( pass_count & 1 ) == 0 ) ? array : work.temp;
+      pool_run( &(*current).pool, sort_run_job, &work, work.run_count );
+
+      // merge pairs of runs until one is left
+      while ( work.run_count > 1 )
+      {
+         work.src = work.dst;
+         work.dst = ( work.src == array ) ? work.temp : array;
+
+         pair_count = ( work.run_count + 1 ) / 2;
+
+         work.piece_count = ( (*current).thread_count + pair_count - 1 ) / pair_count;
+         if ( work.piece_count > ( n / pair_count ) / (*current).grain_size )
+         {
+            work.piece_count = ( n / pair_count ) / (*current).grain_size;
+         }
+         if ( work.piece_count < 1 )
+         {
+            work.piece_count = 1;
+         }
+
+         pool_run( &(*current).pool, merge_piece_job, &work, pair_count * work.piece_count );
+
+         // keep the boundaries of the merged runs
+         for ( i = 0; i < pair_count; i++ )
+         {
+            work.bounds[i] = work.bounds[2 * i];
+         }
+         work.bounds[pair_count] = n;
+         work.run_count = pair_count;
+      }
+
+      free( work.temp );
+      free( work.bounds );
+   }
+
+   return;
+}
+
+/**
+   is_sorted_array
+
+   parallel check that array[0] to array[n - 1] is in order
+
+   @param current the psorter
+   @param array the items
+   @param n the number of items
+   @param func the comparison function
+   @return 1 if sorted, 0 otherwise
+*/
+
+static
+int32_t
+is_sorted_array
+(
+   PSorter_type( Prefix ) *current,
+   Type *array,
+   int32_t n,
+   int32_t (*func)( Type a, Type b )
+)
+{
+   int32_t result = 1;
+   int32_t i = 0;
+   work_t work;
+
+   if ( n >= 2 )
+   {
+      memset( &work, 0, sizeof( work_t ) );
+
+      work.src = array;
+      work.func = func;
+      work.run_count = chunk_count( current, n );
+      work.bounds = make_bounds( n, work.run_count );
+
+      work.results = ( int32_t * ) calloc( work.run_count, sizeof( int32_t ) );
+      CHECK( "results allocated correctly", work.results != NULL );
+
+      pool_run( &(*current).pool, is_sorted_job, &work, work.run_count );
+
+      for ( i = 0; i < work.run_count; i++ )
+      {
+         result = result & work.results[i];
+      }
+
+      free( work.results );
+      free( work.bounds );
+   }
+
+   return result;
+}
+
+/**
+   sort
+
+   sort the items of p_indexable, in place if they are held in one array,
+   otherwise through a copy
+
+   @param current the psorter
+   @param p_indexable the items
+   @param func the comparison function
+*/
+
+static
+void
+sort
+(
+   PSorter_type( Prefix ) *current,
+   protocol_base_t *p_indexable,
+   int32_t (*func)( Type a, Type b )
+)
+{
+   int32_t i = 0;
+   int32_t n = 0;
+   Type *array = NULL;
+
+   n = P_Indexable_count( Prefix )( p_indexable );
+
+   array = P_Indexable_span( Prefix )( p_indexable );
+
+   if ( array != NULL )
+   {
+      sort_array( current, array, n, func );
+   }
+   else if ( n >= 2 )
+   {
+      array = ( Type * ) calloc( n, sizeof( Type ) );
+      CHECK( "array allocated correctly", array != NULL );
+
+      for ( i = 0; i < n; i++ )
+      {
+         array[i] = P_Indexable_item( Prefix )( p_indexable, i );
+      }
+
+      sort_array( current, array, n, func );
+
+      for ( i = 0; i < n; i++ )
+      {
+         P_Indexable_put( Prefix )( p_indexable, array[i], i );
+      }
+
+      free( array );
+   }
+
+   return;
+}
+
+/**
+   is_sorted
+
+   returns 1 if the data is sorted according to comparison function
+
+   @param current the psorter
+   @param p_indexable the data
+   @param func the comparison function
+   @return 1 if data is sorted, 0 otherwise
+*/
+
+static
+int32_t
+is_sorted
+(
+   PSorter_type( Prefix ) *current,
+   protocol_base_t *p_indexable,
+   int32_t (*func)( Type a, Type b )
+)
+{
+   int32_t i = 0;
+   int32_t n = 0;
+   int32_t result = 1;
+   Type *array = NULL;
+
+   n = P_Indexable_count( Prefix )( p_indexable );
+
+   array = P_Indexable_span( Prefix )( p_indexable );
+
+   if ( array != NULL )
+   {
+      result = is_sorted_array( current, array, n, func );
+   }
+   else
+   {
+      for ( i = 1; i < n; i++ )
+      {
+         // compare sequential items - if out of order, stop and return 0
+         if ( func( P_Indexable_item( Prefix )( p_indexable, i - 1 ), P_Indexable_item( Prefix )( p_indexable, i ) ) > 0 )
+         {
+            result = 0;
+            break;
+         }
+      }
+   }
+
+   return result;
+}
+
+/**
+   PSorter_make
+*/
+
+PSorter_type( Prefix ) *
+PSorter_make( Prefix )( void )
+{
+   PSorter_type( Prefix ) * result
+      = PSorter_make_n( Prefix )( default_thread_count(), PSORTER_DEFAULT_GRAIN_SIZE );
+
+   return result;
+}
+
+/**
+   PSorter_make_n
+*/
+
+PSorter_type( Prefix ) *
+PSorter_make_n( Prefix )( int32_t thread_count, int32_t grain_size )
+{
+   PRECONDITION( "thread_count ok", thread_count >= 1 );
+   PRECONDITION( "grain_size ok", grain_size >= 1 );
+
+   // allocate result struct
+   PSorter_type( Prefix ) * result
+      = ( PSorter_type( Prefix ) * ) calloc( 1, sizeof( PSorter_type( Prefix ) ) );
+   CHECK( "result allocated correctly", result != NULL );
+
+   // initialize protocol functions if protocols enabled
+   PROTOCOLS_INIT( result );
+
+   // set type code
+   (*result)._type = PSORTER_TYPE;
+
+   (*result).func = SORT_FUNCTION_NAME;
+
+   (*result).thread_count = thread_count;
+   (*result).grain_size = grain_size;
+
+   pool_start( &(*result).pool, thread_count - 1 );
+
+   MULTITHREAD_MUTEX_INIT( (*result).mutex );
+
+   INVARIANT( result );
+
+   return result;
+}
+
+/**
+   PSorter_clone
+*/
+
+PSorter_type( Prefix ) *
+PSorter_clone( Prefix )( PSorter_type( Prefix ) *other )
+{
+   PRECONDITION( "other not null", other != NULL );
+   PRECONDITION( "other type OK", (*other)._type == PSORTER_TYPE );
+   LOCK( (*other).mutex );
+   INVARIANT( other );
+
+   // allocate other struct
+   PSorter_type( Prefix ) * current
+      = ( PSorter_type( Prefix ) * ) calloc( 1, sizeof( PSorter_type( Prefix ) ) );
+   CHECK( "current allocated correctly", current != NULL );
+
+   // initialize protocol functions if protocols enabled
+   PROTOCOLS_INIT( current );
+
+   // set type codes
+   (*current)._type = PSORTER_TYPE;
+
+   (*current).func = (*other).func;
+
+   (*current).thread_count = (*other).thread_count;
+   (*current).grain_size = (*other).grain_size;
+
+   // the clone has its own threads
+   pool_start( &(*current).pool, (*current).thread_count - 1 );
+
+   MULTITHREAD_MUTEX_INIT( (*current).mutex );
+
+   INVARIANT( current );
+   UNLOCK( (*other).mutex );
+
+   return current;
+}
+
+/**
+   PSorter_deep_clone
+*/
+
+PSorter_type( Prefix ) *
+PSorter_deep_clone( Prefix )( PSorter_type( Prefix ) *other )
+{
+   PRECONDITION( "other not null", other != NULL );
+   PRECONDITION( "other type OK", (*other)._type == PSORTER_TYPE );
+
+   PSorter_type( Prefix ) *current = PSorter_clone( Prefix )( other );
+
+   return current;
+}
+
+/**
+   PSorter_is_equal
+*/
+
+int32_t
+PSorter_is_equal( Prefix )( PSorter_type( Prefix ) *current, PSorter_type( Prefix ) *other )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == PSORTER_TYPE );
+   PRECONDITION( "other not null", other != NULL );
+   PRECONDITION( "other type OK", (*other)._type == PSORTER_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   if ( current == other )
+   {
+      result = 1;
+   }
+   else
+   {
+      LOCK( (*other).mutex );
+
+      result
+         =  ( (*current).func == (*other).func )
+            &&
+            ( (*current).thread_count == (*other).thread_count )
+            &&
+            ( (*current).grain_size == (*other).grain_size );
+
+      UNLOCK( (*other).mutex );
+   }
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   PSorter_is_deep_equal
+*/
+
+int32_t
+PSorter_is_deep_equal( Prefix )( PSorter_type( Prefix ) *current, PSorter_type( Prefix ) *other )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == PSORTER_TYPE );
+   PRECONDITION( "other not null", other != NULL );
+   PRECONDITION( "other type OK", (*other)._type == PSORTER_TYPE );
+
+   int32_t result = PSorter_is_equal( Prefix )( current, other );
+
+   return result;
+}
+
+/**
+   PSorter_copy
+*/
+
+void
+PSorter_copy( Prefix )( PSorter_type( Prefix ) *current, PSorter_type( Prefix ) *other )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == PSORTER_TYPE );
+   PRECONDITION( "other not null", other != NULL );
+   PRECONDITION( "other type OK", (*other)._type == PSORTER_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   if ( current != other )
+   {
+      LOCK( (*other).mutex );
+
+      (*current).func = (*other).func;
+      (*current).grain_size = (*other).grain_size;
+
+      if ( (*current).thread_count != (*other).thread_count )
+      {
+         pool_stop( &(*current).pool );
+         (*current).thread_count = (*other).thread_count;
+         pool_start( &(*current).pool, (*current).thread_count - 1 );
+      }
+
+      UNLOCK( (*other).mutex );
+      INVARIANT( current );
+   }
+
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   PSorter_deep_copy
+*/
+
+void
+PSorter_deep_copy( Prefix )( PSorter_type( Prefix ) *current, PSorter_type( Prefix ) *other )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == PSORTER_TYPE );
+   PRECONDITION( "other not null", other != NULL );
+   PRECONDITION( "other type OK", (*other)._type == PSORTER_TYPE );
+
+   PSorter_copy( Prefix )( current, other );
+
+   return;
+}
+
+/**
+   PSorter_dispose
+*/
+
+void
+PSorter_dispose( Prefix )( PSorter_type( Prefix ) **current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current not null", *current != NULL );
+   PRECONDITION( "current type OK", (**current)._type == PSORTER_TYPE );
+   LOCK( (**current).mutex );
+   INVARIANT(*current);
+
+   // stop the worker threads
+   pool_stop( &(**current).pool );
+
+   MULTITHREAD_MUTEX_DESTROY( (**current).mutex );
+
+   // delete current struct
+   free(*current);
+
+   // set to null
+   *current = NULL;
+
+   return;
+}
+
+/**
+   PSorter_deep_dispose
+*/
+
+void
+PSorter_deep_dispose( Prefix )( PSorter_type( Prefix ) **current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current not null", *current != NULL );
+   PRECONDITION( "current type OK", (**current)._type == PSORTER_TYPE );
+
+   PSorter_dispose( Prefix )( current );
+
+   return;
+}
+
+/**
+   PSorter_thread_count
+*/
+
+int32_t
+PSorter_thread_count( Prefix )( PSorter_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == PSORTER_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = (*current).thread_count;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   PSorter_grain_size
+*/
+
+int32_t
+PSorter_grain_size( Prefix )( PSorter_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == PSORTER_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = (*current).grain_size;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   PSorter_set_thread_count
+*/
+
+void
+PSorter_set_thread_count( Prefix )( PSorter_type( Prefix ) *current, int32_t thread_count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == PSORTER_TYPE );
+   PRECONDITION( "thread_count ok", thread_count >= 1 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   if ( (*current).thread_count != thread_count )
+   {
+      pool_stop( &(*current).pool );
+      (*current).thread_count = thread_count;
+      pool_start( &(*current).pool, thread_count - 1 );
+   }
+
+   POSTCONDITION( "thread_count set", (*current).thread_count == thread_count );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   PSorter_set_grain_size
+*/
+
+void
+PSorter_set_grain_size( Prefix )( PSorter_type( Prefix ) *current, int32_t grain_size )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == PSORTER_TYPE );
+   PRECONDITION( "grain_size ok", grain_size >= 1 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   (*current).grain_size = grain_size;
+
+   POSTCONDITION( "grain_size set", (*current).grain_size == grain_size );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   PSorter_sort_predefined_comparison_function
+*/
+
+void
+PSorter_sort_predefined_comparison_function( Prefix )
+(
+   PSorter_type( Prefix ) *psorter,
+   protocol_base_t *p_indexable
+)
+{
+   PRECONDITION( "psorter not null", psorter != NULL );
+   PRECONDITION( "psorter type OK", (*psorter)._type == PSORTER_TYPE );
+   PRECONDITION( "p_indexable not null", p_indexable != NULL );
+   PRECONDITION( "p_indexable is object", protocol_base_is_valid_object( p_indexable ) == 1 );
+   PRECONDITION( "p_indexable supports protocol", protocol_base_supports_protocol( p_indexable, P_INDEXABLE_TYPE ) == 1 );
+   LOCK( (*psorter).mutex );
+   INVARIANT( psorter );
+
+   sort( psorter, p_indexable, (*psorter).func );
+
+   INVARIANT( psorter );
+   UNLOCK( (*psorter).mutex );
+
+   return;
+}
+
+/**
+   PSorter_sort
+*/
+
+void
+PSorter_sort( Prefix )
+(
+   protocol_base_t *p_indexable,
+   int32_t (*func)( Type a, Type b )
+)
+{
+   PRECONDITION( "p_indexable not null", p_indexable != NULL );
+   PRECONDITION( "p_indexable is object", protocol_base_is_valid_object( p_indexable ) == 1 );
+   PRECONDITION( "p_indexable supports protocol", protocol_base_supports_protocol( p_indexable, P_INDEXABLE_TYPE ) == 1 );
+
+   PSorter_type( Prefix ) *psorter = PSorter_make( Prefix )();
+
+   sort( psorter, p_indexable, func );
+
+   PSorter_dispose( Prefix )( &psorter );
+
+   return;
+}
+
+/**
+   PSorter_is_sorted_predefined_comparison_function
+*/
+
+int32_t
+PSorter_is_sorted_predefined_comparison_function( Prefix )
+(
+   PSorter_type( Prefix ) *current,
+   protocol_base_t *p_indexable
+)
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == PSORTER_TYPE );
+   PRECONDITION( "p_indexable not null", p_indexable != NULL );
+   PRECONDITION( "p_indexable is object", protocol_base_is_valid_object( p_indexable ) == 1 );
+   PRECONDITION( "p_indexable supports protocol", protocol_base_supports_protocol( p_indexable, P_INDEXABLE_TYPE ) == 1 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = is_sorted( current, p_indexable, (*current).func );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   PSorter_is_sorted
+*/
+
+int32_t
+PSorter_is_sorted( Prefix )
+(
+   protocol_base_t *p_indexable,
+   int32_t (*func)( Type a, Type b )
+)
+{
+   PRECONDITION( "p_indexable not null", p_indexable != NULL );
+   PRECONDITION( "p_indexable is object", protocol_base_is_valid_object( p_indexable ) == 1 );
+   PRECONDITION( "p_indexable supports protocol", protocol_base_supports_protocol( p_indexable, P_INDEXABLE_TYPE ) == 1 );
+
+   PSorter_type( Prefix ) *psorter = PSorter_make( Prefix )();
+
+   int32_t result = is_sorted( psorter, p_indexable, func );
+
+   PSorter_dispose( Prefix )( &psorter );
+
+   return result;
+}
+
+/* End of file */
+
+
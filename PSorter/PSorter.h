@@ -0,0 +1,318 @@
+/**
+ @file PSorter.h
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "Parallel Sorter"
+
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0):
+
+ 1. Permission is hereby granted to use, copy, modify and/or
+    distribute this package, provided that:
+       * copyright notices are retained unchanged,
+       * any distribution of this package, whether modified or not,
+         includes this license text.
+ 2. Permission is hereby also granted to distribute binary programs
+    which depend on this package. If the binary program depends on a
+    modified version of this package, you are encouraged to publicly
+    release the modified version of this package.
+
+ THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT WARRANTY. ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE AUTHORS BE LIABLE TO ANY PARTY FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES ARISING IN ANY WAY OUT OF THE USE OF THIS PACKAGE.
+
+ @section Description
+
+ Function declarations for the opaque PSorter_t type.
+
+*/
+
+/**
+   Includes
+*/
+
+#include "base.h"
+#include "Protocol_Base.h"
+
+/**
+   Note that this include file does NOT have an include guard - it may
+   be included multiple times with different macro defintions.
+
+   Defines that must be present (external to this file):
+
+   Prefix - string used to name this container type
+   Type   - the type of the value
+
+*/
+
+/**
+   Macro definitions
+*/
+
+#define PRIMITIVE_CAT(arg, ...) arg ## __VA_ARGS__
+
+#define PSorter_struct( arg ) PRIMITIVE_CAT( arg, _psorter_struct )
+#define PSorter_type( arg ) PRIMITIVE_CAT( arg, _psorter_t )
+#define PSorter_name( arg ) PRIMITIVE_CAT( arg, _psorter )
+
+/**
+   Structure declarations
+*/
+
+struct PSorter_struct( Prefix );
+
+/**
+   Structure typedefs
+*/
+
+typedef struct PSorter_struct( Prefix ) PSorter_type( Prefix );
+
+/**
+   (Some) Function names below are prepended with "Prefix_".
+*/
+
+/*
+   Function
+*/
+
+/**
+   PSorter_make
+
+   make a PSorter with one thread per online processor and the default
+   grain size
+
+   @return the psorter
+*/
+#define PSorter_make( arg ) PRIMITIVE_CAT( arg, _psorter_make )
+PSorter_type( Prefix ) *
+PSorter_make( Prefix )( void );
+
+/**
+   PSorter_make_n
+
+   make a PSorter with the given thread count and grain size
+
+   @param thread_count the number of threads that sort, including the caller
+   @param grain_size the smallest number of items handed to one thread
+   @return the psorter
+*/
+#define PSorter_make_n( arg ) PRIMITIVE_CAT( arg, _psorter_make_n )
+PSorter_type( Prefix ) *
+PSorter_make_n( Prefix )( int32_t thread_count, int32_t grain_size );
+
+/**
+   PSorter_clone
+
+   clone a PSorter
+
+   @return the psorter
+*/
+#define PSorter_clone( arg ) PRIMITIVE_CAT( arg, _psorter_clone )
+PSorter_type( Prefix ) *
+PSorter_clone( Prefix )( PSorter_type( Prefix ) *other );
+
+/**
+   PSorter_deep_clone
+
+   deep_clone a PSorter
+
+   @return the psorter
+*/
+#define PSorter_deep_clone( arg ) PRIMITIVE_CAT( arg, _psorter_deep_clone )
+PSorter_type( Prefix ) *
+PSorter_deep_clone( Prefix )( PSorter_type( Prefix ) *other );
+
+/**
+   PSorter_is_equal
+
+   check is_equal for two PSorters
+
+   @return 1 if equal, 0 otherwise
+*/
+#define PSorter_is_equal( arg ) PRIMITIVE_CAT( arg, _psorter_is_equal )
+int32_t
+PSorter_is_equal( Prefix )( PSorter_type( Prefix ) *current, PSorter_type( Prefix ) *other );
+
+/**
+   PSorter_is_deep_equal
+
+   check is_deep_equal for two PSorters
+
+   @return 1 if equal, 0 otherwise
+*/
+#define PSorter_is_deep_equal( arg ) PRIMITIVE_CAT( arg, _psorter_is_deep_equal )
+int32_t
+PSorter_is_deep_equal( Prefix )( PSorter_type( Prefix ) *current, PSorter_type( Prefix ) *other );
+
+/**
+   PSorter_copy
+
+   copy a PSorter into another
+
+   @param current the psorter to copy into
+   @param other the psorter to copy from
+*/
+#define PSorter_copy( arg ) PRIMITIVE_CAT( arg, _psorter_copy )
+void
+PSorter_copy( Prefix )( PSorter_type( Prefix ) *current, PSorter_type( Prefix ) *other );
+
+/**
+   PSorter_deep_copy
+
+   deep_copy a PSorter into another
+
+   @param current the psorter to copy into
+   @param other the psorter to copy from
+*/
+#define PSorter_deep_copy( arg ) PRIMITIVE_CAT( arg, _psorter_deep_copy )
+void
+PSorter_deep_copy( Prefix )( PSorter_type( Prefix ) *current, PSorter_type( Prefix ) *other );
+
+/**
+   PSorter_dispose
+
+   dispose a PSorter, stops its threads
+
+   @param the psorter
+*/
+#define PSorter_dispose( arg ) PRIMITIVE_CAT( arg, _psorter_dispose )
+void
+PSorter_dispose( Prefix )( PSorter_type( Prefix ) **psorter );
+
+/**
+   PSorter_deep_dispose
+
+   deep dispose a PSorter, stops its threads
+
+   @param the psorter
+*/
+#define PSorter_deep_dispose( arg ) PRIMITIVE_CAT( arg, _psorter_deep_dispose )
+void
+PSorter_deep_dispose( Prefix )( PSorter_type( Prefix ) **current );
+
+/**
+   PSorter_thread_count
+
+   return the number of threads that sort, including the caller
+
+   @param current the psorter
+   @return the thread count
+*/
+#define PSorter_thread_count( arg ) PRIMITIVE_CAT( arg, _psorter_thread_count )
+int32_t
+PSorter_thread_count( Prefix )( PSorter_type( Prefix ) *current );
+
+/**
+   PSorter_grain_size
+
+   return the smallest number of items handed to one thread
+
+   @param current the psorter
+   @return the grain size
+*/
+#define PSorter_grain_size( arg ) PRIMITIVE_CAT( arg, _psorter_grain_size )
+int32_t
+PSorter_grain_size( Prefix )( PSorter_type( Prefix ) *current );
+
+/**
+   PSorter_set_thread_count
+
+   set the number of threads that sort, including the caller. The worker
+   threads are restarted.
+
+   @param current the psorter
+   @param thread_count the new thread count
+*/
+#define PSorter_set_thread_count( arg ) PRIMITIVE_CAT( arg, _psorter_set_thread_count )
+void
+PSorter_set_thread_count( Prefix )( PSorter_type( Prefix ) *current, int32_t thread_count );
+
+/**
+   PSorter_set_grain_size
+
+   set the smallest number of items handed to one thread
+
+   @param current the psorter
+   @param grain_size the new grain size
+*/
+#define PSorter_set_grain_size( arg ) PRIMITIVE_CAT( arg, _psorter_set_grain_size )
+void
+PSorter_set_grain_size( Prefix )( PSorter_type( Prefix ) *current, int32_t grain_size );
+
+/**
+   PSorter_sort_predefined_comparison_function
+
+   sort an entire p_indexable with the predefined comparison function
+
+   @param psorter the psorter
+   @param p_indexable the pointer to the p_indexable
+*/
+#define PSorter_sort_predefined_comparison_function( arg ) PRIMITIVE_CAT( arg, _psorter_sort_predefined_comparison_function )
+void
+PSorter_sort_predefined_comparison_function( Prefix )
+(
+   PSorter_type( Prefix ) *psorter,
+   protocol_base_t *p_indexable
+);
+
+/**
+   PSorter_sort
+
+   sort an entire p_indexable
+   note that this function can be called without making a psorter, it
+   starts and stops a default set of threads for the one sort
+
+   @param p_indexable the pointer to the p_indexable
+   @param func function to compare two items in p_indexable
+*/
+#define PSorter_sort( arg ) PRIMITIVE_CAT( arg, _psorter_sort )
+void
+PSorter_sort( Prefix )
+(
+   protocol_base_t *p_indexable,
+   int32_t (*func)( Type a, Type b )
+);
+
+/**
+   PSorter_is_sorted_predefined_comparison_function
+
+   return 1 if p_indexable is in order
+
+   @param current the psorter
+   @param p_indexable the pointer to the p_indexable
+*/
+#define PSorter_is_sorted_predefined_comparison_function( arg ) PRIMITIVE_CAT( arg, _psorter_is_sorted_predefined_comparison_function )
+int32_t
+PSorter_is_sorted_predefined_comparison_function( Prefix )
+(
+   PSorter_type( Prefix ) *current,
+   protocol_base_t *p_indexable
+);
+
+/**
+   PSorter_is_sorted
+
+   return 1 if p_indexable is in order
+   note that this function can be called without making a psorter
+
+   @param p_indexable the pointer to the p_indexable
+   @param func function to compare two items in p_indexable
+*/
+#define PSorter_is_sorted( arg ) PRIMITIVE_CAT( arg, _psorter_is_sorted )
+int32_t
+PSorter_is_sorted( Prefix )
+(
+   protocol_base_t *p_indexable,
+   int32_t (*func)( Type a, Type b )
+);
+
+/* End of file */
+
@@ -149,6 +149,34 @@ P_Indexable_put_and_dispose( Prefix )
    return;
 }
 
+/**
+   p_indexable_span
+*/
+
+Type *
+P_Indexable_span( Prefix )
+(
+   protocol_base_t *p_indexable
+)
+{
+   PRECONDITION( "p_indexable not null", p_indexable != NULL );
+   PRECONDITION( "p_indexable is object", protocol_base_is_valid_object( p_indexable ) == 1 );
+   PRECONDITION( "p_indexable supports protocol", protocol_base_supports_protocol( p_indexable, P_INDEXABLE_TYPE ) == 1 );
+
+   Type *result = NULL;
+
+   // containers without a contiguous array leave this function out
+   Type * (*span)( protocol_base_t * )
+      = ( *p_indexable ).get_function( P_INDEXABLE_TYPE, P_INDEXABLE_SPAN );
+
+   if ( span != NULL )
+   {
+      result = span( p_indexable );
+   }
+
+   return result;
+}
+
 /* End of file */
 
 
@@ -129,6 +129,24 @@ P_Indexable_put_and_dispose( Prefix )
    int32_t index
 );
 
+/**
+   p_indexable_span
+
+   returns a pointer to the items of p_indexable when they are held in a
+   single contiguous array in index order, NULL otherwise. The pointer is
+   valid until p_indexable is next changed by anything other than writes
+   through the pointer itself.
+
+   @param p_indexable the pointer to the protocol base struct
+   @return pointer to item 0 of a contiguous array, or NULL if none
+*/
+#define P_Indexable_span( arg ) PRIMITIVE_CAT( arg, _indexable_span )
+Type *
+P_Indexable_span( Prefix )
+(
+   protocol_base_t *p_indexable
+);
+
 /* End of file */
 
 
@@ -364,6 +364,128 @@ is_sorted
    return result;
 }
 
+/**
+   sort_array
+
+   performs a quicksort directly on the contiguous items of a container
+   using the func comparison function. Same algorithm as sort.
+
+   @param array the items to sort
+   @param func the comparison function
+   @param start the index of the start of the data in array
+   @param stop the index of the end of the data in array
+*/
+static
+void
+sort_array
+(
+   Type *array,
+   int32_t (*func)( Type a, Type b ),
+   int32_t start,
+   int32_t stop
+)
+{
+   Type pivot;
+   Type temp;
+
+   int32_t left = 0;
+   int32_t right = 0;
+   int32_t p = 0;
+
+   while ( start < stop )
+   {
+      left = start;
+      p = start + ( stop - start ) / 2;
+      right = stop;
+
+      pivot = array[p];
+
+      while ( 1 )
+      {
+         while ( ( left <= right ) && ( func( array[left], pivot ) <= 0 ) )
+         {
+            left++;
+         }
+
+         while ( ( left <= right ) && ( func( array[right], pivot ) > 0 ) )
+         {
+            right--;
+         }
+
+         if ( left > right )
+         {
+            break;
+         }
+
+         temp = array[left];
+         array[left] = array[right];
+         array[right] = temp;
+
+         if ( p == right )
+         {
+            p = left;
+         }
+
+         left++;
+         right--;
+      }
+
+      array[p] = array[right];
+      array[right] = pivot;
+      right--;
+
+      // Recursion on the shorter side & loop (with new indexes) on the longer
+      if ( ( right - start ) < ( stop - left ) )
+      {
+         sort_array( array, func, start, right );
+         start = left;
+      }
+      else
+      {
+         sort_array( array, func, left, stop );
+         stop = right;
+      }
+   }
+
+   return;
+}
+
+/**
+   is_sorted_array
+
+   returns 1 if the contiguous items are sorted according to comparison function
+   @param array the data
+   @param func the comparison function
+   @param start the index of the start of the data in array
+   @param stop the index of the end of the data in array
+   @return 1 if data is sorted, 0 otherwise
+*/
+
+static
+int32_t
+is_sorted_array
+(
+   Type *array,
+   int32_t (*func)( Type a, Type b ),
+   int32_t start,
+   int32_t stop
+)
+{
+   int32_t result = 1;
+   int32_t i = 0;
+
+   for ( i = start; i < stop; i++ )
+   {
+      if ( func( array[i], array[i + 1] ) > 0 )
+      {
+         result = 0;
+         break;
+      }
+   }
+
+   return result;
+}
+
 /**
    QSorter_make
 */
@@ -646,11 +768,22 @@ QSorter_sort_predefined_comparison_function( Prefix )
 
    int32_t start = 0;
    int32_t stop = 0;
+   Type *array = NULL;
 
    start = 0;
    stop = P_Indexable_count( Prefix )( p_indexable ) - 1;
 
-   sort( p_indexable, (*qsorter).func, start, stop );
+   // sort in place if the items are held in one array
+   array = P_Indexable_span( Prefix )( p_indexable );
+
+   if ( array != NULL )
+   {
+      sort_array( array, (*qsorter).func, start, stop );
+   }
+   else
+   {
+      sort( p_indexable, (*qsorter).func, start, stop );
+   }
 
    INVARIANT( qsorter );
    UNLOCK( (*qsorter).mutex );
@@ -675,11 +808,22 @@ QSorter_sort( Prefix )
 
    int32_t start = 0;
    int32_t stop = 0;
+   Type *array = NULL;
 
    start = 0;
    stop = P_Indexable_count( Prefix )( p_indexable ) - 1;
 
-   sort( p_indexable, func, start, stop );
+   // sort in place if the items are held in one array
+   array = P_Indexable_span( Prefix )( p_indexable );
+
+   if ( array != NULL )
+   {
+      sort_array( array, func, start, stop );
+   }
+   else
+   {
+      sort( p_indexable, func, start, stop );
+   }
 
    return;
 }
@@ -706,11 +850,21 @@ QSorter_is_sorted_predefined_comparison_function( Prefix )
    int32_t result = 0;
    int32_t start = 0;
    int32_t stop = 0;
+   Type *array = NULL;
 
    start = 0;
    stop = P_Indexable_count( Prefix )( p_indexable ) - 1;
 
-   result = is_sorted( p_indexable, (*current).func, start, stop );
+   array = P_Indexable_span( Prefix )( p_indexable );
+
+   if ( array != NULL )
+   {
+      result = is_sorted_array( array, (*current).func, start, stop );
+   }
+   else
+   {
+      result = is_sorted( p_indexable, (*current).func, start, stop );
+   }
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -736,11 +890,21 @@ QSorter_is_sorted( Prefix )
    int32_t result = 0;
    int32_t start = 0;
    int32_t stop = 0;
+   Type *array = NULL;
 
    start = 0;
    stop = P_Indexable_count( Prefix )( p_indexable ) - 1;
 
-   result = is_sorted( p_indexable, func, start, stop );
+   array = P_Indexable_span( Prefix )( p_indexable );
+
+   if ( array != NULL )
+   {
+      result = is_sorted_array( array, func, start, stop );
+   }
+   else
+   {
+      result = is_sorted( p_indexable, func, start, stop );
+   }
 
    return result;
 }
@@ -44,6 +44,9 @@ extern "C" {
 #include <string.h>
 #include <stdlib.h>
 #include <math.h>
+#if defined( __AVX2__ ) && defined( __FMA__ )
+#include <immintrin.h>
+#endif
 #ifdef MULTITHREADED
 #include MULTITHREAD_INCLUDE
 #endif
@@ -57,6 +60,9 @@ extern "C" {
 #define DTOR (M_PI/180.0)
 #define RTOD (180.0/M_PI)
 
+// dot product above which slerp falls back to normalized linear interpolation
+#define SLERP_LINEAR_THRESHOLD 0.9995
+
 /**
    Note that this include file does NOT have an include guard - it may
    be included multiple times with different macro defintions.
@@ -1706,6 +1712,89 @@ Quaternion_interpolated( Prefix )
    return result;
 }
 
+/**
+   Quaternion_slerp_batch
+*/
+
+void
+Quaternion_slerp_batch( Prefix )
+(
+   Type *q0,
+   Type *q1,
+   Type *q2,
+   Type *q3,
+   Type *o0,
+   Type *o1,
+   Type *o2,
+   Type *o3,
+   Type t,
+   int32_t count
+)
+{
+   PRECONDITION( "q not null", ( q0 != NULL ) && ( q1 != NULL ) && ( q2 != NULL ) && ( q3 != NULL ) );
+   PRECONDITION( "o not null", ( o0 != NULL ) && ( o1 != NULL ) && ( o2 != NULL ) && ( o3 != NULL ) );
+   PRECONDITION( "count ok", count >= 0 );
+
+   int32_t i = 0;
+   Type d = 0;
+   Type sign = 0;
+   Type a = 0;
+   Type b = 0;
+   Type theta = 0;
+   Type sin_theta = 0;
+   Type r0 = 0;
+   Type r1 = 0;
+   Type r2 = 0;
+   Type r3 = 0;
+
+   for ( i = 0; i < count; i++ )
+   {
+      d = q0[i] * o0[i] + q1[i] * o1[i] + q2[i] * o2[i] + q3[i] * o3[i];
+
+      // take the shorter arc, o and -o are the same rotation
+      sign = 1;
+      if ( d < 0 )
+      {
+         d = -d;
+         sign = -1;
+      }
+
+      if ( d > SLERP_LINEAR_THRESHOLD )
+      {
+         a = 1 - t;
+         b = sign * t;
+      }
+      else
+      {
+         theta = acos( d );
+         sin_theta = sin( theta );
+         a = sin( ( 1 - t ) * theta ) / sin_theta;
+         b = sign * sin( t * theta ) / sin_theta;
+      }
+
+      r0 = a * q0[i] + b * o0[i];
+      r1 = a * q1[i] + b * o1[i];
+      r2 = a * q2[i] + b * o2[i];
+      r3 = a * q3[i] + b * o3[i];
+
+      if ( d > SLERP_LINEAR_THRESHOLD )
+      {
+         d = sqrt( r0 * r0 + r1 * r1 + r2 * r2 + r3 * r3 );
+         r0 = r0 / d;
+         r1 = r1 / d;
+         r2 = r2 / d;
+         r3 = r3 / d;
+      }
+
+      q0[i] = r0;
+      q1[i] = r1;
+      q2[i] = r2;
+      q3[i] = r3;
+   }
+
+   return;
+}
+
 /**
    Quaternion_get_roll_pitch_yaw
 */
@@ -2090,6 +2179,154 @@ Quaternion_rotate_xyz( Prefix )( Quaternion_type( Prefix ) *current, Type x, Typ
    return result;
 }
 
+/**
+   rotate_xyz_simd
+
+   rotate points by the 3x3 matrix m, held by rows, a vector of points at
+   a time. Compiled in when the compiler is asked for AVX2 and FMA (for
+   example with -march=native).
+
+   @return the number of points rotated, a multiple of the vector width
+*/
+
+static
+int32_t
+rotate_xyz_simd( Type *m, Type *x, Type *y, Type *z, int32_t count )
+{
+   int32_t result = 0;
+
+#if defined( __AVX2__ ) && defined( __FMA__ )
+
+   if ( sizeof( Type ) == sizeof( double ) )
+   {
+      double *md = ( double * ) m;
+      double *xd = ( double * ) x;
+      double *yd = ( double * ) y;
+      double *zd = ( double * ) z;
+      __m256d xv;
+      __m256d yv;
+      __m256d zv;
+
+      for ( result = 0; result + 4 <= count; result = result + 4 )
+      {
+         xv = _mm256_loadu_pd( &xd[result] );
+         yv = _mm256_loadu_pd( &yd[result] );
+         zv = _mm256_loadu_pd( &zd[result] );
+
+         _mm256_storeu_pd
+         (
+            &xd[result],
+            _mm256_fmadd_pd( _mm256_set1_pd( md[0] ), xv, _mm256_fmadd_pd( _mm256_set1_pd( md[1] ), yv, _mm256_mul_pd( _mm256_set1_pd( md[2] ), zv ) ) )
+         );
+         _mm256_storeu_pd
+         (
+            &yd[result],
+            _mm256_fmadd_pd( _mm256_set1_pd( md[3] ), xv, _mm256_fmadd_pd( _mm256_set1_pd( md[4] ), yv, _mm256_mul_pd( _mm256_set1_pd( md[5] ), zv ) ) )
+         );
+         _mm256_storeu_pd
+         (
+            &zd[result],
+            _mm256_fmadd_pd( _mm256_set1_pd( md[6] ), xv, _mm256_fmadd_pd( _mm256_set1_pd( md[7] ), yv, _mm256_mul_pd( _mm256_set1_pd( md[8] ), zv ) ) )
+         );
+      }
+   }
+   else if ( sizeof( Type ) == sizeof( float ) )
+   {
+      float *mf = ( float * ) m;
+      float *xf = ( float * ) x;
+      float *yf = ( float * ) y;
+      float *zf = ( float * ) z;
+      __m256 xv;
+      __m256 yv;
+      __m256 zv;
+
+      for ( result = 0; result + 8 <= count; result = result + 8 )
+      {
+         xv = _mm256_loadu_ps( &xf[result] );
+         yv = _mm256_loadu_ps( &yf[result] );
+         zv = _mm256_loadu_ps( &zf[result] );
+
+         _mm256_storeu_ps
+         (
+            &xf[result],
+            _mm256_fmadd_ps( _mm256_set1_ps( mf[0] ), xv, _mm256_fmadd_ps( _mm256_set1_ps( mf[1] ), yv, _mm256_mul_ps( _mm256_set1_ps( mf[2] ), zv ) ) )
+         );
+         _mm256_storeu_ps
+         (
+            &yf[result],
+            _mm256_fmadd_ps( _mm256_set1_ps( mf[3] ), xv, _mm256_fmadd_ps( _mm256_set1_ps( mf[4] ), yv, _mm256_mul_ps( _mm256_set1_ps( mf[5] ), zv ) ) )
+         );
+         _mm256_storeu_ps
+         (
+            &zf[result],
+            _mm256_fmadd_ps( _mm256_set1_ps( mf[6] ), xv, _mm256_fmadd_ps( _mm256_set1_ps( mf[7] ), yv, _mm256_mul_ps( _mm256_set1_ps( mf[8] ), zv ) ) )
+         );
+      }
+   }
+
+#endif
+
+   return result;
+}
+
+/**
+   Quaternion_rotate_xyz_batch
+*/
+
+void
+Quaternion_rotate_xyz_batch( Prefix )( Quaternion_type( Prefix ) *current, Type *x, Type *y, Type *z, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", ( (*current)._type == QUATERNION_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   PRECONDITION( "x not null", x != NULL );
+   PRECONDITION( "y not null", y != NULL );
+   PRECONDITION( "z not null", z != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t i = 0;
+   Type s = 0;
+   Type m[9] = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+   Type xi = 0;
+   Type yi = 0;
+   Type zi = 0;
+
+   // rotation matrix of q v q^-1, which does not depend on the magnitude of q
+   s =   (*current).q0 * (*current).q0 + (*current).q1 * (*current).q1
+       + (*current).q2 * (*current).q2 + (*current).q3 * (*current).q3;
+   s = 2 / s;
+
+   m[0] = 1 - s * ( (*current).q2 * (*current).q2 + (*current).q3 * (*current).q3 );
+   m[1] = s * ( (*current).q1 * (*current).q2 - (*current).q0 * (*current).q3 );
+   m[2] = s * ( (*current).q1 * (*current).q3 + (*current).q0 * (*current).q2 );
+   m[3] = s * ( (*current).q1 * (*current).q2 + (*current).q0 * (*current).q3 );
+   m[4] = 1 - s * ( (*current).q1 * (*current).q1 + (*current).q3 * (*current).q3 );
+   m[5] = s * ( (*current).q2 * (*current).q3 - (*current).q0 * (*current).q1 );
+   m[6] = s * ( (*current).q1 * (*current).q3 - (*current).q0 * (*current).q2 );
+   m[7] = s * ( (*current).q2 * (*current).q3 + (*current).q0 * (*current).q1 );
+   m[8] = 1 - s * ( (*current).q1 * (*current).q1 + (*current).q2 * (*current).q2 );
+
+   // vector kernel for most of the points, scalar loop for the rest
+   i = rotate_xyz_simd( m, x, y, z, count );
+
+   for ( ; i < count; i++ )
+   {
+      xi = x[i];
+      yi = y[i];
+      zi = z[i];
+
+      x[i] = m[0] * xi + m[1] * yi + m[2] * zi;
+      y[i] = m[3] * xi + m[4] * yi + m[5] * zi;
+      z[i] = m[6] * xi + m[7] * yi + m[8] * zi;
+   }
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
 /**
    Quaternion_scale
 */
@@ -2496,5 +2733,154 @@ Quaternion_multiplied( Prefix )( Quaternion_type( Prefix ) *current, Quaternion_
    return result;
 }
 
+/**
+   multiply_simd
+
+   multiply quaternions q by o, result in q, a vector of quaternions at a
+   time. Compiled in when the compiler is asked for AVX2 and FMA.
+
+   @return the number of quaternions multiplied, a multiple of the vector width
+*/
+
+static
+int32_t
+multiply_simd( Type **q, Type **o, int32_t count )
+{
+   int32_t result = 0;
+
+#if defined( __AVX2__ ) && defined( __FMA__ )
+
+   int32_t j = 0;
+
+   if ( sizeof( Type ) == sizeof( double ) )
+   {
+      double *qd[4] = { ( double * ) q[0], ( double * ) q[1], ( double * ) q[2], ( double * ) q[3] };
+      double *od[4] = { ( double * ) o[0], ( double * ) o[1], ( double * ) o[2], ( double * ) o[3] };
+      __m256d a[4];
+      __m256d b[4];
+
+      for ( result = 0; result + 4 <= count; result = result + 4 )
+      {
+         for ( j = 0; j < 4; j++ )
+         {
+            a[j] = _mm256_loadu_pd( &qd[j][result] );
+            b[j] = _mm256_loadu_pd( &od[j][result] );
+         }
+
+         _mm256_storeu_pd
+         (
+            &qd[0][result],
+            _mm256_fnmadd_pd( a[3], b[3], _mm256_fnmadd_pd( a[2], b[2], _mm256_fmsub_pd( a[0], b[0], _mm256_mul_pd( a[1], b[1] ) ) ) )
+         );
+         _mm256_storeu_pd
+         (
+            &qd[1][result],
+            _mm256_fnmadd_pd( a[3], b[2], _mm256_fmadd_pd( a[2], b[3], _mm256_fmadd_pd( a[0], b[1], _mm256_mul_pd( a[1], b[0] ) ) ) )
+         );
+         _mm256_storeu_pd
+         (
+            &qd[2][result],
+            _mm256_fmadd_pd( a[3], b[1], _mm256_fmadd_pd( a[2], b[0], _mm256_fmsub_pd( a[0], b[2], _mm256_mul_pd( a[1], b[3] ) ) ) )
+         );
+         _mm256_storeu_pd
+         (
+            &qd[3][result],
+            _mm256_fmadd_pd( a[3], b[0], _mm256_fnmadd_pd( a[2], b[1], _mm256_fmadd_pd( a[0], b[3], _mm256_mul_pd( a[1], b[2] ) ) ) )
+         );
+      }
+   }
+   else if ( sizeof( Type ) == sizeof( float ) )
+   {
+      float *qf[4] = { ( float * ) q[0], ( float * ) q[1], ( float * ) q[2], ( float * ) q[3] };
+      float *of[4] = { ( float * ) o[0], ( float * ) o[1], ( float * ) o[2], ( float * ) o[3] };
+      __m256 a[4];
+      __m256 b[4];
+
+      for ( result = 0; result + 8 <= count; result = result + 8 )
+      {
+         for ( j = 0; j < 4; j++ )
+         {
+            a[j] = _mm256_loadu_ps( &qf[j][result] );
+            b[j] = _mm256_loadu_ps( &of[j][result] );
+         }
+
+         _mm256_storeu_ps
+         (
+            &qf[0][result],
+            _mm256_fnmadd_ps( a[3], b[3], _mm256_fnmadd_ps( a[2], b[2], _mm256_fmsub_ps( a[0], b[0], _mm256_mul_ps( a[1], b[1] ) ) ) )
+         );
+         _mm256_storeu_ps
+         (
+            &qf[1][result],
+            _mm256_fnmadd_ps( a[3], b[2], _mm256_fmadd_ps( a[2], b[3], _mm256_fmadd_ps( a[0], b[1], _mm256_mul_ps( a[1], b[0] ) ) ) )
+         );
+         _mm256_storeu_ps
+         (
+            &qf[2][result],
+            _mm256_fmadd_ps( a[3], b[1], _mm256_fmadd_ps( a[2], b[0], _mm256_fmsub_ps( a[0], b[2], _mm256_mul_ps( a[1], b[3] ) ) ) )
+         );
+         _mm256_storeu_ps
+         (
+            &qf[3][result],
+            _mm256_fmadd_ps( a[3], b[0], _mm256_fnmadd_ps( a[2], b[1], _mm256_fmadd_ps( a[0], b[3], _mm256_mul_ps( a[1], b[2] ) ) ) )
+         );
+      }
+   }
+
+#endif
+
+   return result;
+}
+
+/**
+   Quaternion_multiply_batch
+*/
+
+void
+Quaternion_multiply_batch( Prefix )
+(
+   Type *q0,
+   Type *q1,
+   Type *q2,
+   Type *q3,
+   Type *o0,
+   Type *o1,
+   Type *o2,
+   Type *o3,
+   int32_t count
+)
+{
+   PRECONDITION( "q not null", ( q0 != NULL ) && ( q1 != NULL ) && ( q2 != NULL ) && ( q3 != NULL ) );
+   PRECONDITION( "o not null", ( o0 != NULL ) && ( o1 != NULL ) && ( o2 != NULL ) && ( o3 != NULL ) );
+   PRECONDITION( "count ok", count >= 0 );
+
+   int32_t i = 0;
+   Type r0 = 0;
+   Type r1 = 0;
+   Type r2 = 0;
+   Type r3 = 0;
+   Type *q[4] = { q0, q1, q2, q3 };
+   Type *o[4] = { o0, o1, o2, o3 };
+
+   // vector kernel for most of the quaternions, then the products of
+   // Quaternion_multiply for the rest
+   i = multiply_simd( q, o, count );
+
+   for ( ; i < count; i++ )
+   {
+      r0 = q0[i] * o0[i] - q1[i] * o1[i] - q2[i] * o2[i] - q3[i] * o3[i];
+      r1 = q0[i] * o1[i] + q1[i] * o0[i] + q2[i] * o3[i] - q3[i] * o2[i];
+      r2 = q0[i] * o2[i] - q1[i] * o3[i] + q2[i] * o0[i] + q3[i] * o1[i];
+      r3 = q0[i] * o3[i] + q1[i] * o2[i] - q2[i] * o1[i] + q3[i] * o0[i];
+
+      q0[i] = r0;
+      q1[i] = r1;
+      q2[i] = r2;
+      q3[i] = r3;
+   }
+
+   return;
+}
+
 /* End of file */
 
@@ -723,6 +723,30 @@ void Quaternion_interpolate( Prefix )( Quaternion_type( Prefix ) *quaternion, Qu
 #define Quaternion_interpolated( arg ) PRIMITIVE_CAT( arg, _quaternion_interpolated )
 Quaternion_type( Prefix ) * Quaternion_interpolated( Prefix )( Quaternion_type( Prefix ) *quaternion, Quaternion_type( Prefix ) *other, Type current_weight, Type other_weight );
 
+/**
+   Quaternion_slerp_batch
+
+   Set each of count quaternions to the spherical linear interpolation
+   from it to the matching other quaternion, a fraction t of the way.
+   Quaternions are given as structure of arrays, one array per component,
+   and are expected to be of unit magnitude. The shorter of the two arcs
+   is taken. Nearly equal pairs are interpolated linearly and normalized.
+
+   @param  q0 array of q0 components, holds result
+   @param  q1 array of q1 components, holds result
+   @param  q2 array of q2 components, holds result
+   @param  q3 array of q3 components, holds result
+   @param  o0 array of other q0 components
+   @param  o1 array of other q1 components
+   @param  o2 array of other q2 components
+   @param  o3 array of other q3 components
+   @param  t fraction of the way from q to o, 0 to 1
+   @param  count number of quaternions
+
+*/
+#define Quaternion_slerp_batch( arg ) PRIMITIVE_CAT( arg, _quaternion_slerp_batch )
+void Quaternion_slerp_batch( Prefix )( Type *q0, Type *q1, Type *q2, Type *q3, Type *o0, Type *o1, Type *o2, Type *o3, Type t, int32_t count );
+
 /*
    Conversion
 */
@@ -867,6 +891,23 @@ Matvec_type( Mv_Prefix ) * Quaternion_rotated_vector( Prefix )( Quaternion_type(
 #define Quaternion_rotate_xyz( arg ) PRIMITIVE_CAT( arg, _quaternion_rotate_xyz )
 Type * Quaternion_rotate_xyz( Prefix )( Quaternion_type( Prefix ) *quaternion, Type x, Type y, Type z );
 
+/**
+   Quaternion_rotate_xyz_batch
+
+   Rotate count 3D points in place. Points are given as structure of
+   arrays, one array per coordinate. The rotation is the same as that of
+   Quaternion_rotate_xyz, applied as a 3x3 matrix.
+
+   @param  quaternion Quaternion_t instance
+   @param  x array of x coordinates
+   @param  y array of y coordinates
+   @param  z array of z coordinates
+   @param  count number of points
+
+*/
+#define Quaternion_rotate_xyz_batch( arg ) PRIMITIVE_CAT( arg, _quaternion_rotate_xyz_batch )
+void Quaternion_rotate_xyz_batch( Prefix )( Quaternion_type( Prefix ) *quaternion, Type *x, Type *y, Type *z, int32_t count );
+
 
 /*
    Basic operations
@@ -1028,6 +1069,26 @@ void Quaternion_multiply( Prefix )( Quaternion_type( Prefix ) *quaternion, Quate
 #define Quaternion_multiplied( arg ) PRIMITIVE_CAT( arg, _quaternion_multiplied )
 Quaternion_type( Prefix ) * Quaternion_multiplied( Prefix )( Quaternion_type( Prefix ) *quaternion, Quaternion_type( Prefix ) *other );
 
+/**
+   Quaternion_multiply_batch
+
+   Multiply each of count quaternions by the matching other quaternion,
+   result in the first. Quaternions are given as structure of arrays, one
+   array per component.
+
+   @param  q0 array of q0 components, holds result
+   @param  q1 array of q1 components, holds result
+   @param  q2 array of q2 components, holds result
+   @param  q3 array of q3 components, holds result
+   @param  o0 array of other q0 components
+   @param  o1 array of other q1 components
+   @param  o2 array of other q2 components
+   @param  o3 array of other q3 components
+   @param  count number of quaternions
+*/
+#define Quaternion_multiply_batch( arg ) PRIMITIVE_CAT( arg, _quaternion_multiply_batch )
+void Quaternion_multiply_batch( Prefix )( Type *q0, Type *q1, Type *q2, Type *q3, Type *o0, Type *o1, Type *o2, Type *o3, int32_t count );
+
 
 /* End of file */
 
@@ -88,6 +88,7 @@ struct node
 {
    Type value;
    rbcolor_t color;
+   int32_t size;
    struct node *parent;
    struct node *left;
    struct node *right;
@@ -319,6 +320,7 @@ node_make( void )
    (*node).left = &null_node;
    (*node).right = &null_node;
    (*node).color = black;
+   (*node).size = 1;
 
    POSTCONDITION( "node not null", node != NULL );
    POSTCONDITION( "node parent null", (*node).parent == &null_node );
@@ -355,6 +357,46 @@ node_dispose( node_t **node )
    return;
 }
 
+/**
+   update_size
+
+   recompute the subtree size of a node from its children, null_node has
+   size 0
+
+   @param node the node to update
+*/
+
+static
+void
+update_size( node_t *node )
+{
+   (*node).size = 1 + ( *(*node).left ).size + ( *(*node).right ).size;
+
+   return;
+}
+
+/**
+   update_sizes_to_root
+
+   recompute the subtree sizes of a node and all of its ancestors
+
+   @param current the tree
+   @param node the lowest node whose subtree changed
+*/
+
+static
+void
+update_sizes_to_root( RBTree_type( Prefix ) *current, node_t *node )
+{
+   while ( ( node != &null_node ) && ( node != &(*current).root ) )
+   {
+      update_size( node );
+      node = (*node).parent;
+   }
+
+   return;
+}
+
 /**
    has_recurse
 
@@ -654,37 +696,34 @@ static
 node_t *
 node_for_index( RBTree_type( Prefix ) *current, int32_t index )
 {
-   int32_t i = 0;
    node_t *result = &null_node;
+   int32_t left_size = 0;
 
-   // get cursor
-   RBTree_cursor_type( Prefix ) *c
-      =  ( RBTree_cursor_type( Prefix ) * )
-         calloc( 1, sizeof( RBTree_cursor_type( Prefix ) ) );
-   CHECK( "c allocated correctly", c != NULL );
-
-   // set rbtree in cursor
-   (*c).rbtree = current;
-
-   if ( ( index < 0 ) || ( index >= (*current).count ) )
-   {
-      result = &null_node;
-   }
-   else
+   if ( ( index >= 0 ) && ( index < (*current).count ) )
    {
-      // iterate to index
-      cursor_start( c );
-      result = (*c).item;
+      // descend using subtree sizes
+      result = (*current).root.left;
 
-      for( i = 1; i <= index; i++ )
+      while ( result != &null_node )
       {
-         cursor_forth( c );
-         result = (*c).item;
+         left_size = ( *(*result).left ).size;
+
+         if ( index < left_size )
+         {
+            result = (*result).left;
+         }
+         else if ( index == left_size )
+         {
+            break;
+         }
+         else
+         {
+            index = index - left_size - 1;
+            result = (*result).right;
+         }
       }
    }
 
-   free( c );
-
    return result;
 }
 
@@ -695,47 +734,97 @@ node_for_index( RBTree_type( Prefix ) *current, int32_t index )
 
    @param current the tree
    @param node the desired node
-   @return the index of the desired node
+   @return the index of the desired node, -1 if cursor is off
 */
 static
 int32_t
 index_for_node( RBTree_type( Prefix ) *current, node_t *node )
 {
-   int32_t result = 0;
-   int32_t flag = 0;
-
-   // get cursor
-   RBTree_cursor_type( Prefix ) *c
-      =  ( RBTree_cursor_type( Prefix ) * )
-         calloc( 1, sizeof( RBTree_cursor_type( Prefix ) ) );
-   CHECK( "c allocated correctly", c != NULL );
-
-   // set rbtree in cursor
-   (*c).rbtree = current;
+   int32_t result = -1;
+   node_t *parent = NULL;
 
-   if ( (*current).count > 0 )
+   // cursor is off if its item is null_node or the pseudo root
+   if ( ( node != &null_node ) && ( node != &(*current).root ) )
    {
-      cursor_start( c );
+      // count nodes to the left of node on the way up to the root
+      result = ( *(*node).left ).size;
+      parent = (*node).parent;
 
-      while ( cursor_off( c ) == 0 )
+      while ( parent != &(*current).root )
       {
-         if ( (*c).item == node )
+         if ( (*parent).right == node )
          {
-            flag = 1;
-            break;
+            result = result + ( *(*parent).left ).size + 1;
          }
-         result = result + 1;
-         cursor_forth( c );
+
+         node = parent;
+         parent = (*node).parent;
       }
    }
 
-   if ( flag == 0 )
+   return result;
+}
+
+/**
+   count_less_than
+
+   return the number of items ordered before value
+
+   @param current the tree
+   @param value the value to compare to
+   @return the number of items less than value
+*/
+static
+int32_t
+count_less_than( RBTree_type( Prefix ) *current, Type value )
+{
+   int32_t result = 0;
+   node_t *node = (*current).root.left;
+
+   while ( node != &null_node )
    {
-      result = -1;
+      if ( ORDER_FUNCTION( value, (*node).value ) == 1 )
+      {
+         node = (*node).left;
+      }
+      else
+      {
+         result = result + ( *(*node).left ).size + 1;
+         node = (*node).right;
+      }
    }
 
-   // free c
-   free( c );
+   return result;
+}
+
+/**
+   count_less_than_or_equal
+
+   return the number of items not ordered after value
+
+   @param current the tree
+   @param value the value to compare to
+   @return the number of items less than or equal to value
+*/
+static
+int32_t
+count_less_than_or_equal( RBTree_type( Prefix ) *current, Type value )
+{
+   int32_t result = 0;
+   node_t *node = (*current).root.left;
+
+   while ( node != &null_node )
+   {
+      if ( ORDER_FUNCTION( (*node).value, value ) == 1 )
+      {
+         result = result + ( *(*node).left ).size + 1;
+         node = (*node).right;
+      }
+      else
+      {
+         node = (*node).left;
+      }
+   }
 
    return result;
 }
@@ -857,6 +946,9 @@ rotate_left( RBTree_type( Prefix ) *current, node_t *node )
 
       (*child).left = node;
       (*node).parent = child;
+
+      update_size( node );
+      update_size( child );
    }
 
    return;
@@ -901,6 +993,9 @@ rotate_right( RBTree_type( Prefix ) *current, node_t *node )
 
       (*child).right = node;
       (*node).parent = child;
+
+      update_size( node );
+      update_size( child );
    }
 
    return;
@@ -1147,11 +1242,13 @@ put( RBTree_type( Prefix ) *current, Type value )
    )
    {
       (*parent).left = node;
+      update_sizes_to_root( current, parent );
       repair_put( current, node );
    }
    else
    {
       (*parent).right = node;
+      update_sizes_to_root( current, parent );
       repair_put( current, node );
    }
 
@@ -1520,12 +1617,14 @@ remove( RBTree_type( Prefix ) *current, node_t *node )
             // eliminate node parent's left
             ( *(*node).parent ).left = pull_up;
             ( *pull_up ).parent = (*node).parent;
+            update_sizes_to_root( current, (*node).parent );
          }
          else
          {
             // eliminate node parent's right
             ( *(*node).parent ).right = pull_up;
             ( *pull_up ).parent = (*node).parent;
+            update_sizes_to_root( current, (*node).parent );
          }
 
          if ( (*node).color == black )
@@ -1557,6 +1656,7 @@ remove( RBTree_type( Prefix ) *current, node_t *node )
             {
                ( *(*node).parent ).right = &null_node;
             }
+            update_sizes_to_root( current, (*node).parent );
             (*node).parent = &null_node;
          }
       }
@@ -2479,6 +2579,54 @@ node_pointers_consistent( RBTree_type( Prefix ) *current )
    return result;
 }
 
+static
+int32_t
+sizes_ok_recurse( node_t *node )
+{
+   int32_t result = 1;
+
+   result = ( (*node).size == 1 + ( *(*node).left ).size + ( *(*node).right ).size );
+
+   if ( result == 1 )
+   {
+      if ( (*node).left != &null_node )
+      {
+         result = sizes_ok_recurse( (*node).left );
+      }
+   }
+
+   if ( result == 1 )
+   {
+      if ( (*node).right != &null_node )
+      {
+         result = sizes_ok_recurse( (*node).right );
+      }
+   }
+
+   return result;
+}
+
+static
+int32_t
+sizes_ok( RBTree_type( Prefix ) *current )
+{
+   int32_t result = 1;
+
+   result = ( null_node.size == 0 );
+
+   if ( result == 1 )
+   {
+      result = ( ( *(*current).root.left ).size == (*current).count );
+   }
+
+   if ( ( result == 1 ) && ( (*current).root.left != &null_node ) )
+   {
+      result = sizes_ok_recurse( (*current).root.left );
+   }
+
+   return result;
+}
+
 static
 void invariant( RBTree_type( Prefix ) *current )
 {
@@ -2496,6 +2644,7 @@ void invariant( RBTree_type( Prefix ) *current )
    assert( ( ( void ) "null node ok", null_node_ok( current ) ) );
    assert( ( ( void ) "cursors off or valid", cursors_off_or_valid( current ) ) );
    assert( ( ( void ) "node pointers consistent", node_pointers_consistent( current ) ) );
+   assert( ( ( void ) "subtree sizes ok", sizes_ok( current ) ) );
    return;
 }
 
@@ -3844,6 +3993,55 @@ RBTree_occurrences_eq_fn( Prefix )
    return result;
 }
 
+/**
+   RBTree_rank
+*/
+
+int32_t
+RBTree_rank( Prefix )( RBTree_type( Prefix ) *current, Type value )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == RBTREE_TYPE ) && ( (*current)._item_type = Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = count_less_than( current, value );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   POSTCONDITION( "result ok", ( result >= 0 ) && ( result <= (*current).count ) );
+
+   return result;
+}
+
+/**
+   RBTree_count_in_range
+*/
+
+int32_t
+RBTree_count_in_range( Prefix )( RBTree_type( Prefix ) *current, Type lo, Type hi )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", ( (*current)._type == RBTREE_TYPE ) && ( (*current)._item_type = Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   if ( ORDER_FUNCTION( lo, hi ) == 1 )
+   {
+      result = count_less_than_or_equal( current, hi ) - count_less_than( current, lo );
+   }
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   POSTCONDITION( "result ok", ( result >= 0 ) && ( result <= (*current).count ) );
+
+   return result;
+}
+
 /**
    RBTree_search_forth
 */
@@ -4019,13 +4217,7 @@ RBTree_cursor_go( Prefix )( RBTree_cursor_type( Prefix ) *cursor, int32_t index
    INVARIANT( (*cursor).rbtree );
    PRECONDITION( "index ok", ( ( index >= 0 ) && ( index < ( *(*cursor).rbtree ).count ) ) );
 
-   int32_t i = 0;
-   cursor_start( cursor );
-
-   for( i = 1; i <= index; i++ )
-   {
-      cursor_forth( cursor );
-   }
+   (*cursor).item = node_for_index( (*cursor).rbtree, index );
 
    INVARIANT( (*cursor).rbtree );
    UNLOCK( ( *(*cursor).rbtree ).mutex );
@@ -4330,13 +4522,7 @@ RBTree_go( Prefix )( RBTree_type( Prefix ) *current, int32_t index )
    INVARIANT( current );
    PRECONDITION( "index ok", ( ( index >= 0 ) && ( index < (*current).count ) ) );
 
-   int32_t i = 0;
-   cursor_start( (*current).first_cursor );
-
-   for( i = 1; i <= index; i++ )
-   {
-      cursor_forth( (*current).first_cursor );
-   }
+   ( *(*current).first_cursor ).item = node_for_index( current, index );
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
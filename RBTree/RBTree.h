@@ -574,6 +574,33 @@ int32_t RBTree_occurrences_eq_fn( Prefix )
    int32_t ( *equality_test_func )( Type v1, Type v2 )
 );
 
+/**
+   RBTree_rank
+
+   Returns the number of items in the RBTree_t instance that are ordered
+   before value. This is the index of the first value equal to value, if any.
+
+   @param  current RBTree_t instance
+   @param  value the value to rank
+   @return count of items less than value
+*/
+#define RBTree_rank( arg ) PRIMITIVE_CAT( arg, _rbtree_rank )
+int32_t RBTree_rank( Prefix )( RBTree_type( Prefix ) *current, Type value );
+
+/**
+   RBTree_count_in_range
+
+   Returns the number of items in the RBTree_t instance that are ordered
+   between lo and hi, inclusive. Returns 0 if hi is ordered before lo.
+
+   @param  current RBTree_t instance
+   @param  lo the lowest value of the range
+   @param  hi the highest value of the range
+   @return count of items in range
+*/
+#define RBTree_count_in_range( arg ) PRIMITIVE_CAT( arg, _rbtree_count_in_range )
+int32_t RBTree_count_in_range( Prefix )( RBTree_type( Prefix ) *current, Type lo, Type hi );
+
 /**
    RBTree_search_forth
 
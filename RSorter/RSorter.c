@@ -0,0 +1,1144 @@
+/**
+ @file RSorter.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "Radix Sorter"
+
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0):
+
+ 1. Permission is hereby granted to use, copy, modify and/or
+    distribute this package, provided that:
+       * copyright notices are retained unchanged,
+       * any distribution of this package, whether modified or not,
+         includes this license text.
+ 2. Permission is hereby also granted to distribute binary programs
+    which depend on this package. If the binary program depends on a
+    modified version of this package, you are encouraged to publicly
+    release the modified version of this package.
+
+ THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT WARRANTY. ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE AUTHORS BE LIABLE TO ANY PARTY FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES ARISING IN ANY WAY OUT OF THE USE OF THIS PACKAGE.
+
+ @section Description
+
+ Function definitions for the opaque RSorter_t type.
+
+*/
+
+#include "RSorter.h"
+
+/**
+   Includes
+*/
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <math.h>
+#include <limits.h>
+
+#ifdef PROTOCOLS_ENABLED
+#include "Protocol_Base.h"
+#include "Protocol_Base.ph"
+#include "P_Indexable.ph"
+#include "P_Basic.ph"
+#include "P_Sorter.ph"
+#endif // PROTOCOLS_ENABLED   
+
+#include "P_Basic.h"
+#include "P_Indexable.h"
+
+#ifdef MULTITHREADED
+#include MULTITHREAD_INCLUDE
+#endif
+
+#include "dbc.h"
+
+/**
+   defines
+*/
+
+/**
+   RSorter structure
+*/
+
+struct RSorter_struct( Prefix )
+{
+
+   PROTOCOLS_DEFINITION;
+
+   int32_t _type;
+
+   int32_t (*func)( Type a, Type b );
+
+   MULTITHREAD_MUTEX_DEFINITION( mutex );
+};
+
+/**
+   Invariant
+*/
+
+#if INVARIANT_CONDITIONAL != 0
+
+static
+int32_t
+struct_ok( RSorter_type( Prefix ) *p )
+{
+   int32_t result = 1;
+
+   result = ( (*p).func != NULL );
+
+   return result;
+}
+
+static
+void invariant( RSorter_type( Prefix ) *p )
+{
+   assert( ( ( void ) "struct ok count", struct_ok( p ) ) );
+   return;
+}
+
+#else
+
+static
+void invariant( p )
+{
+   return;
+}
+
+#endif
+
+#ifdef PROTOCOLS_ENABLED
+
+/**
+   basic protocol function array
+*/
+
+static
+void *
+p_basic_table[P_BASIC_FUNCTION_COUNT]
+=
+{
+   RSorter_dispose( Prefix ),
+   RSorter_deep_dispose( Prefix ),
+   RSorter_is_equal( Prefix ),
+   RSorter_is_deep_equal( Prefix ),
+   RSorter_copy( Prefix ),
+   RSorter_deep_copy( Prefix ),
+   RSorter_clone( Prefix ),
+   RSorter_deep_clone( Prefix )
+};
+
+/**
+   sorter protocol function array
+*/
+
+static
+void *
+p_sorter_table[P_SORTER_FUNCTION_COUNT]
+=
+{
+   RSorter_sort_predefined_comparison_function( Prefix ),
+   RSorter_is_sorted_predefined_comparison_function( Prefix )
+
+};
+
+/**
+   protocol get_function
+*/
+
+static
+void *
+get_function
+(
+   int32_t protocol_id,
+   int32_t function_id
+)
+{
+   PRECONDITION( "protocol id is ok", protocol_base_is_valid_protocol( protocol_id ) == 1 );
+
+   void *result = NULL;
+
+   switch ( protocol_id )
+   {
+      case P_BASIC_TYPE:
+      {
+         if ( ( function_id >= 0 ) && ( function_id <= P_BASIC_FUNCTION_MAX ) )
+         {
+            result = p_basic_table[ function_id ];
+         }
+         break;
+      }
+
+      case P_SORTER_TYPE:
+      {
+         if ( ( function_id >= 0 ) && ( function_id <= P_SORTER_FUNCTION_MAX ) )
+         {
+            result = p_sorter_table[ function_id ];
+         }
+      }
+
+   }
+
+   return result;
+}
+
+/**
+   protocol supports_protocol
+*/
+
+static
+int32_t
+supports_protocol
+(
+   int32_t protocol_id
+)
+{
+   PRECONDITION( "protocol id is ok", protocol_base_is_valid_protocol( protocol_id ) == 1 );
+
+   int32_t result = 0;
+
+   switch ( protocol_id )
+   {
+      case P_BASIC_TYPE:
+      {
+         result = 1;
+         break;
+      }
+
+      case P_SORTER_TYPE:
+      {
+         result = 1;
+      }
+
+   }
+
+   return result;
+}
+
+#endif // PROTOCOLS_ENABLED   
+
+
+/**
+   merge_array
+
+   merge two sorted runs of a contiguous array into a single sorted run
+
+   @param array holds two input sorted runs in sequence
+   @param array1 receives the merged run
+   @param func the comparison function
+   @param i_start the index of the first input run
+   @param i_middle the index of the start of the second input run
+   @param i_end one past the last item in the second input run
+*/
+static
+void
+merge_array
+(
+   Type *array,
+   Type *array1,
+   int32_t (*func)( Type a, Type b ),
+   int32_t i_start,
+   int32_t i_middle,
+   int32_t i_end
+)
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+
+   i = i_start;
+   j = i_middle;
+
+   for( k = i_start; k < i_end; k++ )
+   {
+
+      if ( ( i < i_middle ) && ( ( j >= i_end ) || ( func( array[i], array[j] ) <= 0 ) ) )
+      {
+         array1[k] = array[i];
+         i = i + 1;
+      }
+      else
+      {
+         array1[k] = array[j];
+         j = j + 1;
+      }
+   }
+
+   return;
+}
+
+/**
+   split_merge_array
+
+   split_merge on contiguous arrays
+
+   @param array1 working array, starts as a copy of array
+   @param array input data array
+   @param func the comparison function
+   @param i_start the index of the data array
+   @param i_end one past the last item of the data array
+*/
+static
+void
+split_merge_array
+(
+   Type *array1,
+   Type *array,
+   int32_t (*func)( Type a, Type b ),
+   int32_t i_start,
+   int32_t i_end
+)
+{
+   int32_t i_middle = 0;
+
+   // only sort if working with more than 1 item
+   if ( ( i_end - i_start ) >= 2 )
+   {
+      // get index for split
+      i_middle = ( int32_t ) ( ( i_end + i_start ) / 2 );
+
+      // recursively sort both split halves into array1
+      split_merge_array( array, array1, func, i_start, i_middle );
+      split_merge_array( array, array1, func, i_middle, i_end );
+
+      // merge the splits in array1 back into array
+      merge_array( array1, array, func, i_start, i_middle, i_end );
+   }
+
+   return;
+}
+
+/**
+   sort_array
+
+   sort the contiguous items of a container using a plain temp buffer
+
+   @param array the items to sort
+   @param n the number of items
+   @param func the comparison function
+*/
+static
+void
+sort_array
+(
+   Type *array,
+   int32_t n,
+   int32_t (*func)( Type a, Type b )
+)
+{
+   Type *array1 = NULL;
+
+   if ( n >= 2 )
+   {
+      // make temp buffer
+      array1 = ( Type * ) calloc( n, sizeof( Type ) );
+      CHECK( "array1 allocated correctly", array1 != NULL );
+
+      memcpy( array1, array, n * sizeof( Type ) );
+
+      // sort the items
+      split_merge_array( array1, array, func, 0, n );
+
+      free( array1 );
+   }
+
+   return;
+}
+
+/**
+   radix sort parameters
+*/
+
+#define RADIX_BITS 11
+#define RADIX_SIZE 2048
+#define RADIX_MASK 0x7FF
+#define RADIX_MAX_PASSES 6
+
+/**
+   is_radix_type
+
+   returns 1 if Type_Code names a fixed width primitive type whose bytes
+   can be turned into an unsigned key that sorts in numeric order
+
+   @return 1 if items can be radix sorted, 0 otherwise
+*/
+static
+int32_t
+is_radix_type( void )
+{
+   int32_t result = 0;
+
+   switch ( Type_Code )
+   {
+      case char_type_code:
+      case int8_type_code:
+      case int16_type_code:
+      case int32_type_code:
+      case int64_type_code:
+      case uint8_type_code:
+      case octet_type_code:
+      case uint16_type_code:
+      case uint32_type_code:
+      case uint64_type_code:
+      case float32_type_code:
+      case float64_type_code:
+      {
+         result = 1;
+         break;
+      }
+   }
+
+   // the key is built from at most 64 bits
+   if (
+         ( sizeof( Type ) != 1 )
+         && ( sizeof( Type ) != 2 )
+         && ( sizeof( Type ) != 4 )
+         && ( sizeof( Type ) != 8 )
+      )
+   {
+      result = 0;
+   }
+
+   return result;
+}
+
+/**
+   is_predefined_function
+
+   returns 1 if comparison_function is SORT_FUNCTION_NAME, the function the
+   radix key order stands in for. Kept at file scope so that the name is not
+   shadowed by a parameter called func.
+
+   @param comparison_function the comparison function
+   @return 1 if comparison_function is the predefined one, 0 otherwise
+*/
+static
+int32_t
+is_predefined_function( int32_t (*comparison_function)( Type a, Type b ) )
+{
+   int32_t result = 0;
+
+   result = ( comparison_function == SORT_FUNCTION_NAME );
+
+   return result;
+}
+
+/**
+   radix_key
+
+   map an item to an unsigned key whose unsigned order is the numeric order
+   of the item. Signed integers have their sign bit flipped. Floats with the
+   sign bit set have all bits flipped, other floats have the sign bit set.
+
+   @param value the item
+   @return the key
+*/
+static
+uint64_t
+radix_key( Type value )
+{
+   uint64_t result = 0;
+   uint64_t sign = 0;
+   uint8_t u8 = 0;
+   uint16_t u16 = 0;
+   uint32_t u32 = 0;
+   uint64_t u64 = 0;
+
+   // copy the bytes of value into an unsigned integer of the same width
+   switch ( sizeof( Type ) )
+   {
+      case 1:
+      {
+         memcpy( &u8, &value, 1 );
+         result = u8;
+         break;
+      }
+
+      case 2:
+      {
+         memcpy( &u16, &value, 2 );
+         result = u16;
+         break;
+      }
+
+      case 4:
+      {
+         memcpy( &u32, &value, 4 );
+         result = u32;
+         break;
+      }
+
+      default:
+      {
+         memcpy( &u64, &value, 8 );
+         result = u64;
+         break;
+      }
+   }
+
+   sign = ( ( uint64_t ) 1 ) << ( 8 * sizeof( Type ) - 1 );
+
+   switch ( Type_Code )
+   {
+      case char_type_code:
+      {
+         if ( CHAR_MIN < 0 )
+         {
+            result = result ^ sign;
+         }
+         break;
+      }
+
+      case int8_type_code:
+      case int16_type_code:
+      case int32_type_code:
+      case int64_type_code:
+      {
+         result = result ^ sign;
+         break;
+      }
+
+      case float32_type_code:
+      case float64_type_code:
+      {
+         if ( ( result & sign ) != 0 )
+         {
+            // keep only the bits of the item
+            result = ( ~result ) & ( sign | ( sign - 1 ) );
+         }
+         else
+         {
+            result = result ^ sign;
+         }
+         break;
+      }
+   }
+
+   return result;
+}
+
+/**
+   radix_sort_array
+
+   LSD radix sort of a contiguous array, 11 bits of the key per pass.
+   The digit counts for every pass are gathered in one read of the items,
+   and passes in which every item has the same digit are skipped.
+
+   @param array the items to sort
+   @param n the number of items
+*/
+static
+void
+radix_sort_array
+(
+   Type *array,
+   int32_t n
+)
+{
+   int32_t i = 0;
+   int32_t pass = 0;
+   int32_t pass_count = ( int32_t ) ( 8 * sizeof( Type ) + RADIX_BITS - 1 ) / RADIX_BITS;
+   int32_t digit = 0;
+   int32_t offset = 0;
+   int32_t count = 0;
+   int32_t shift = 0;
+   uint64_t key = 0;
+   Type *array1 = NULL;
+   Type *src = NULL;
+   Type *dst = NULL;
+   Type *temp = NULL;
+   int32_t counts[RADIX_MAX_PASSES][RADIX_SIZE];
+
+   if ( n >= 2 )
+   {
+      memset( counts, 0, sizeof( counts ) );
+
+      // count the digits of every pass
+      for ( i = 0; i < n; i++ )
+      {
+         key = radix_key( array[i] );
+
+         for ( pass = 0; pass < pass_count; pass++ )
+         {
+            counts[pass][ ( key >> ( pass * RADIX_BITS ) ) & RADIX_MASK ]++;
+         }
+      }
+
+      // make temp buffer
+      array1 = ( Type * ) calloc( n, sizeof( Type ) );
+      CHECK( "array1 allocated correctly", array1 != NULL );
+
+      src = array;
+      dst = array1;
+
+      for ( pass = 0; pass < pass_count; pass++ )
+      {
+         shift = pass * RADIX_BITS;
+
+         // skip the pass if every item has the same digit
+         digit = ( int32_t ) ( ( radix_key( src[0] ) >> shift ) & RADIX_MASK );
+
+         if ( counts[pass][digit] != n )
+         {
+            // turn the counts into starting offsets
+            offset = 0;
+            for ( digit = 0; digit < RADIX_SIZE; digit++ )
+            {
+               count = counts[pass][digit];
+               counts[pass][digit] = offset;
+               offset = offset + count;
+            }
+
+            // scatter the items, keeping equal digits in order
+            for ( i = 0; i < n; i++ )
+            {
+               digit = ( int32_t ) ( ( radix_key( src[i] ) >> shift ) & RADIX_MASK );
+               dst[ counts[pass][digit] ] = src[i];
+               counts[pass][digit]++;
+            }
+
+            temp = src;
+            src = dst;
+            dst = temp;
+         }
+      }
+
+      // an odd number of passes leaves the result in the temp buffer
+      if ( src != array )
+      {
+         memcpy( array, src, n * sizeof( Type ) );
+      }
+
+      free( array1 );
+   }
+
+   return;
+}
+
+/**
+   sort_items
+
+   sort a contiguous array, radix sort for primitive keys when func is the
+   predefined comparison function SORT_FUNCTION_NAME, merge sort with func
+   otherwise. The radix key only gives ascending numeric order, so any other
+   comparison function, such as a descending one, must be honored by the
+   merge sort.
+
+   @param array the items to sort
+   @param n the number of items
+   @param func the comparison function
+*/
+static
+void
+sort_items
+(
+   Type *array,
+   int32_t n,
+   int32_t (*func)( Type a, Type b )
+)
+{
+   if ( ( is_radix_type() == 1 ) && ( is_predefined_function( func ) == 1 ) )
+   {
+      radix_sort_array( array, n );
+   }
+   else
+   {
+      sort_array( array, n, func );
+   }
+
+   return;
+}
+
+#define Base_Prefix p
+
+/**
+   sort
+
+   sort the input data array, radix sort for primitive keys when func is
+   the predefined comparison function, merge sort using func otherwise
+
+   @param p_indexable the input data array
+   @param func the comparison function
+*/
+static
+void
+sort
+(
+   protocol_base_t *p_indexable,
+   int32_t (*func)( Type a, Type b )
+)
+{
+   Type (*item)( protocol_base_t *p_indexable, int32_t index ) = NULL;
+   void (*put)( protocol_base_t *p_indexable, Type value, int32_t index ) = NULL;
+
+   int32_t i = 0;
+   int32_t n = 0;
+   Type *array = NULL;
+
+   // get size of indexable
+   n = P_Indexable_count( Prefix )( p_indexable );
+
+   // sort in place if the items are held in one array
+   array = P_Indexable_span( Prefix )( p_indexable );
+
+   if ( array != NULL )
+   {
+      sort_items( array, n, func );
+   }
+   else
+   {
+      // get direct pointer to item, put functions
+      item = P_Indexable_item( Prefix );
+      put = P_Indexable_put( Prefix );
+
+      // copy the items out, sort them and put them back
+      array = ( Type * ) calloc( n + 1, sizeof( Type ) );
+      CHECK( "array allocated correctly", array != NULL );
+
+      for ( i = 0; i < n; i++ )
+      {
+         array[i] = item( p_indexable, i );
+      }
+
+      sort_items( array, n, func );
+
+      for ( i = 0; i < n; i++ )
+      {
+         put( p_indexable, array[i], i );
+      }
+
+      free( array );
+   }
+
+   return;
+}
+
+/**
+   is_sorted
+
+   returns 1 if the data is sorted according to comparison function
+   @param p_indexable the data
+   @param func the comparison function
+   @return 1 if data is sorted, 0 otherwise
+*/
+
+static
+int32_t
+is_sorted
+(
+   protocol_base_t *p_indexable,
+   int32_t (*func)( Type a, Type b )
+)
+{
+   Type (*item)( protocol_base_t *p_indexable, int32_t index ) = NULL;
+
+   int32_t i = 0;
+   int32_t n = 0;
+   int32_t result  = 1;
+   Type *array = NULL;
+
+   // get direct pointer to item function
+   item = ( *p_indexable ).get_function( P_INDEXABLE_TYPE, P_INDEXABLE_ITEM );
+
+   n = P_Indexable_count( Prefix )( p_indexable );
+
+   array = P_Indexable_span( Prefix )( p_indexable );
+
+   if ( array != NULL )
+   {
+      for ( i = 1; i < n; i++ )
+      {
+         if ( func( array[i - 1], array[i] ) > 0 )
+         {
+            result = 0;
+            break;
+         }
+      }
+   }
+   else
+   {
+      for ( i = 1; i < n; i++ )
+      {
+         // compare sequential items - if out of order, stop and return 0
+         if ( func( item( p_indexable, i - 1 ), item( p_indexable, i ) ) > 0 )
+         {
+            result = 0;
+            break;
+         }
+      }
+   }
+
+   return result;
+}
+
+/**
+   RSorter_make
+*/
+
+RSorter_type( Prefix ) *
+RSorter_make( Prefix )( void )
+{
+   // allocate result struct
+   RSorter_type( Prefix ) * result
+      = ( RSorter_type( Prefix ) * ) calloc( 1, sizeof( RSorter_type( Prefix ) ) );
+   CHECK( "result allocated correctly", result != NULL );
+
+   // initialize protocol functions if protocols enabled
+   PROTOCOLS_INIT( result );
+
+   // set type code
+   (*result)._type = RSORTER_TYPE;
+
+   (*result).func = SORT_FUNCTION_NAME;
+
+   MULTITHREAD_MUTEX_INIT( (*result).mutex );
+
+   INVARIANT( result );
+
+   return result;
+}
+
+/**
+   RSorter_clone
+*/
+
+RSorter_type( Prefix ) *
+RSorter_clone( Prefix )( RSorter_type( Prefix ) *other )
+{
+   PRECONDITION( "other not null", other != NULL );
+   PRECONDITION( "other type OK", (*other)._type == RSORTER_TYPE );
+   LOCK( (*other).mutex );
+   INVARIANT( other );
+
+   // allocate other struct
+   RSorter_type( Prefix ) * current
+      = ( RSorter_type( Prefix ) * ) calloc( 1, sizeof( RSorter_type( Prefix ) ) );
+   CHECK( "current allocated correctly", current != NULL );
+
+   // initialize protocol functions if protocols enabled
+   PROTOCOLS_INIT( current );
+
+   // set type codes
+   (*current)._type = RSORTER_TYPE;
+
+   (*current).func = (*other).func;
+
+   MULTITHREAD_MUTEX_INIT( (*current).mutex );
+
+   INVARIANT( current );
+   UNLOCK( (*other).mutex );
+
+   return current;
+}
+
+/**
+   RSorter_deep_clone
+*/
+
+RSorter_type( Prefix ) *
+RSorter_deep_clone( Prefix )( RSorter_type( Prefix ) *other )
+{
+   PRECONDITION( "other not null", other != NULL );
+   PRECONDITION( "other type OK", (*other)._type == RSORTER_TYPE );
+   LOCK( (*other).mutex );
+   INVARIANT( other );
+
+   // allocate other struct
+   RSorter_type( Prefix ) * current
+      = ( RSorter_type( Prefix ) * ) calloc( 1, sizeof( RSorter_type( Prefix ) ) );
+   CHECK( "current allocated correctly", current != NULL );
+
+   // initialize protocol functions if protocols enabled
+   PROTOCOLS_INIT( current );
+
+   // set type codes
+   (*current)._type = RSORTER_TYPE;
+
+   (*current).func = (*other).func;
+
+   MULTITHREAD_MUTEX_INIT( (*current).mutex );
+
+   INVARIANT( current );
+   UNLOCK( (*other).mutex );
+
+   return current;
+}
+
+/**
+   RSorter_is_equal
+*/
+
+int32_t
+RSorter_is_equal( Prefix )( RSorter_type( Prefix ) *current, RSorter_type( Prefix ) *other )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == RSORTER_TYPE );
+   PRECONDITION( "other not null", other != NULL );
+   PRECONDITION( "other type OK", (*other)._type == RSORTER_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   if ( current == other )
+   {
+      result = 1;
+   }
+   else
+   {
+      LOCK( (*other).mutex );
+      result = ( (*current).func == (*other).func );
+      UNLOCK( (*other).mutex );
+   }
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   RSorter_is_deep_equal
+*/
+
+int32_t
+RSorter_is_deep_equal( Prefix )( RSorter_type( Prefix ) *current, RSorter_type( Prefix ) *other )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == RSORTER_TYPE );
+   PRECONDITION( "other not null", other != NULL );
+   PRECONDITION( "other type OK", (*other)._type == RSORTER_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = 0;
+
+   if ( current == other )
+   {
+      result = 1;
+   }
+   else
+   {
+      LOCK( (*other).mutex );
+      result = ( (*current).func == (*other).func );
+      UNLOCK( (*other).mutex );
+   }
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   RSorter_copy
+*/
+
+void
+RSorter_copy( Prefix )( RSorter_type( Prefix ) *current, RSorter_type( Prefix ) *other )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == RSORTER_TYPE );
+   PRECONDITION( "other not null", other != NULL );
+   PRECONDITION( "other type OK", (*other)._type == RSORTER_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   if ( current != other )
+   {
+      LOCK( (*other).mutex );
+      (*current).func = (*other).func;
+      UNLOCK( (*other).mutex );
+      INVARIANT( current );
+   }
+
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   RSorter_deep_copy
+*/
+
+void
+RSorter_deep_copy( Prefix )( RSorter_type( Prefix ) *current, RSorter_type( Prefix ) *other )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == RSORTER_TYPE );
+   PRECONDITION( "other not null", other != NULL );
+   PRECONDITION( "other type OK", (*other)._type == RSORTER_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   if ( current != other )
+   {
+      LOCK( (*other).mutex );
+      (*current).func = (*other).func;
+      UNLOCK( (*other).mutex );
+      INVARIANT( current );
+   }
+
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   RSorter_dispose
+*/
+
+void
+RSorter_dispose( Prefix )( RSorter_type( Prefix ) **current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current not null", *current != NULL );
+   PRECONDITION( "current type OK", (**current)._type == RSORTER_TYPE );
+   LOCK( (**current).mutex );
+   INVARIANT(*current);
+
+   MULTITHREAD_MUTEX_DESTROY( (**current).mutex );
+
+   // delete current struct
+   free(*current);
+
+   // set to null
+   *current = NULL;
+
+   return;
+}
+
+/**
+   RSorter_deep_dispose
+*/
+
+void
+RSorter_deep_dispose( Prefix )( RSorter_type( Prefix ) **current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current not null", *current != NULL );
+   PRECONDITION( "current type OK", (**current)._type == RSORTER_TYPE );
+   LOCK( (**current).mutex );
+   INVARIANT(*current);
+
+   MULTITHREAD_MUTEX_DESTROY( (**current).mutex );
+
+   // delete current struct
+   free(*current);
+
+   // set to null
+   *current = NULL;
+
+   return;
+}
+
+/**
+   RSorter_sort_predefined_comparison_function
+*/
+
+void
+RSorter_sort_predefined_comparison_function( Prefix )
+(
+   RSorter_type( Prefix ) *rsorter,
+   protocol_base_t *p_indexable
+)
+{
+   PRECONDITION( "rsorter not null", rsorter != NULL );
+   PRECONDITION( "rsorter type OK", (*rsorter)._type == RSORTER_TYPE );
+   PRECONDITION( "p_indexable not null", p_indexable != NULL );
+   PRECONDITION( "p_indexable is object", protocol_base_is_valid_object( p_indexable ) == 1 );
+   PRECONDITION( "p_indexable supports protocol", protocol_base_supports_protocol( p_indexable, P_INDEXABLE_TYPE ) == 1 );
+   PRECONDITION( "p_indexable supports basic protocol", protocol_base_supports_protocol( p_indexable, P_BASIC_TYPE ) == 1 );
+   LOCK( (*rsorter).mutex );
+   INVARIANT( rsorter );
+
+   sort( p_indexable, (*rsorter).func );
+
+   INVARIANT( rsorter );
+   UNLOCK( (*rsorter).mutex );
+
+   return;
+}
+
+/**
+   RSorter_sort
+*/
+
+void
+RSorter_sort( Prefix )
+(
+   protocol_base_t *p_indexable,
+   int32_t (*func)( Type a, Type b )
+)
+{
+   PRECONDITION( "p_indexable not null", p_indexable != NULL );
+   PRECONDITION( "p_indexable is object", protocol_base_is_valid_object( p_indexable ) == 1 );
+   PRECONDITION( "p_indexable supports protocol", protocol_base_supports_protocol( p_indexable, P_INDEXABLE_TYPE ) == 1 );
+   PRECONDITION( "p_indexable supports basic protocol", protocol_base_supports_protocol( p_indexable, P_BASIC_TYPE ) == 1 );
+
+   sort( p_indexable, func );
+
+   return;
+}
+
+/**
+   RSorter_is_sorted_predefined_comparison_function
+*/
+
+int32_t
+RSorter_is_sorted_predefined_comparison_function( Prefix )
+(
+   RSorter_type( Prefix ) *current,
+   protocol_base_t *p_indexable
+)
+{
+   PRECONDITION( "p_indexable not null", p_indexable != NULL );
+   PRECONDITION( "p_indexable is object", protocol_base_is_valid_object( p_indexable ) == 1 );
+   PRECONDITION( "p_indexable supports protocol", protocol_base_supports_protocol( p_indexable, P_INDEXABLE_TYPE ) == 1 );
+
+   int32_t result = 0;
+
+   result = is_sorted( p_indexable, (*current).func );
+
+   return result;
+}
+
+/**
+   RSorter_is_sorted
+*/
+
+int32_t
+RSorter_is_sorted( Prefix )
+(
+   protocol_base_t *p_indexable,
+   int32_t (*func)( Type a, Type b )
+)
+{
+   PRECONDITION( "p_indexable not null", p_indexable != NULL );
+   PRECONDITION( "p_indexable is object", protocol_base_is_valid_object( p_indexable ) == 1 );
+   PRECONDITION( "p_indexable supports protocol", protocol_base_supports_protocol( p_indexable, P_INDEXABLE_TYPE ) == 1 );
+
+   int32_t result = 0;
+
+   result = is_sorted( p_indexable, func );
+
+   return result;
+}
+
+/* End of file */
+
+
+
+
@@ -0,0 +1,284 @@
+/**
+ @file RSorter.h
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "Radix Sorter"
+
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0):
+
+ 1. Permission is hereby granted to use, copy, modify and/or
+    distribute this package, provided that:
+       * copyright notices are retained unchanged,
+       * any distribution of this package, whether modified or not,
+         includes this license text.
+ 2. Permission is hereby also granted to distribute binary programs
+    which depend on this package. If the binary program depends on a
+    modified version of this package, you are encouraged to publicly
+    release the modified version of this package.
+
+ THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT WARRANTY. ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE AUTHORS BE LIABLE TO ANY PARTY FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES ARISING IN ANY WAY OUT OF THE USE OF THIS PACKAGE.
+
+ @section Description
+
+ Function declarations for the opaque RSorter_t type.
+
+ RSorter sorts items whose Type_Code names a fixed width integer, character
+ or floating point type with an LSD radix sort, 11 bits per pass, when
+ they are sorted with the predefined comparison function SORT_FUNCTION_NAME,
+ which must order items in ascending numeric order. Any other comparison
+ function, and any other type code, is handled by a stable comparison
+ (merge) sort.
+
+*/
+
+/**
+   Includes
+*/
+
+#include "base.h"
+#include "Protocol_Base.h"
+
+/**
+   Note that this include file does NOT have an include guard - it may
+   be included multiple times with different macro defintions.
+
+   Defines that must be present (external to this file):
+
+   Prefix    - string used to name this container type
+   Type      - the type of the value
+   Type_Code - the type code of the value, from base.h
+
+*/
+
+/**
+   Macro definitions
+*/
+
+#define PRIMITIVE_CAT(arg, ...) arg ## __VA_ARGS__
+
+#define RSorter_struct( arg ) PRIMITIVE_CAT( arg, _rsorter_struct )
+#define RSorter_type( arg ) PRIMITIVE_CAT( arg, _rsorter_t )
+#define RSorter_name( arg ) PRIMITIVE_CAT( arg, _rsorter )
+
+/**
+   Structure declarations
+*/
+
+struct RSorter_struct( Prefix );
+
+/**
+   Structure typedefs
+*/
+
+typedef struct RSorter_struct( Prefix ) RSorter_type( Prefix );
+
+/**
+   (Some) Function names below are prepended with "Prefix_".
+*/
+
+/*
+   Function
+*/
+
+/**
+   RSorter_make
+
+   make a RSorter
+
+   @return the rsorter
+*/
+#define RSorter_make( arg ) PRIMITIVE_CAT( arg, _rsorter_make )
+RSorter_type( Prefix ) *
+RSorter_make( Prefix )( void );
+
+/**
+   RSorter_clone
+
+   clone a RSorter
+
+   @return the rsorter
+*/
+#define RSorter_clone( arg ) PRIMITIVE_CAT( arg, _rsorter_clone )
+RSorter_type( Prefix ) *
+RSorter_clone( Prefix )( RSorter_type( Prefix ) *other );
+
+/**
+   RSorter_deep_clone
+
+   deep_clone a RSorter
+
+   @return the rsorter
+*/
+#define RSorter_deep_clone( arg ) PRIMITIVE_CAT( arg, _rsorter_deep_clone )
+RSorter_type( Prefix ) *
+RSorter_deep_clone( Prefix )( RSorter_type( Prefix ) *other );
+
+/**
+   RSorter_is_equal
+
+   is_equal a RSorter
+
+   @return the rsorter
+*/
+#define RSorter_is_equal( arg ) PRIMITIVE_CAT( arg, _rsorter_is_equal )
+int32_t
+RSorter_is_equal( Prefix )( RSorter_type( Prefix ) *current, RSorter_type( Prefix ) *other );
+
+/**
+   RSorter_is_equal
+
+   check is_equal for two RSorters
+
+   @return the rsorter
+*/
+#define RSorter_is_equal( arg ) PRIMITIVE_CAT( arg, _rsorter_is_equal )
+int32_t
+RSorter_is_equal( Prefix )( RSorter_type( Prefix ) *current, RSorter_type( Prefix ) *other );
+
+/**
+   RSorter_is_deep_equal
+
+   check is_deep_equal for two RSorters
+
+   @return the rsorter
+*/
+#define RSorter_is_deep_equal( arg ) PRIMITIVE_CAT( arg, _rsorter_is_deep_equal )
+int32_t
+RSorter_is_deep_equal( Prefix )( RSorter_type( Prefix ) *current, RSorter_type( Prefix ) *other );
+
+/**
+   RSorter_copy
+
+   copy a RSorter into another
+
+   @return the rsorter
+*/
+#define RSorter_copy( arg ) PRIMITIVE_CAT( arg, _rsorter_copy )
+void
+RSorter_copy( Prefix )( RSorter_type( Prefix ) *current, RSorter_type( Prefix ) *other );
+
+/**
+   RSorter_deep_copy
+
+   deep_copy a RSorter into another
+
+   @return the rsorter
+*/
+#define RSorter_deep_copy( arg ) PRIMITIVE_CAT( arg, _rsorter_deep_copy )
+void
+RSorter_deep_copy( Prefix )( RSorter_type( Prefix ) *current, RSorter_type( Prefix ) *other );
+
+/**
+   RSorter_dispose
+
+   dispose a RSorter
+
+   @param the rsorter
+*/
+#define RSorter_dispose( arg ) PRIMITIVE_CAT( arg, _rsorter_dispose )
+void
+RSorter_dispose( Prefix )( RSorter_type( Prefix ) **rsorter );
+
+/**
+   RSorter_deep_dispose
+
+   deep dispose a RSorter
+
+   @param the rsorter
+*/
+#define RSorter_deep_dispose( arg ) PRIMITIVE_CAT( arg, _rsorter_deep_dispose )
+void
+RSorter_deep_dispose( Prefix )( RSorter_type( Prefix ) **current );
+
+/**
+   RSorter_sort_predefined_comparison_function
+
+   sort an entire p_indexable with the predefined coomparison function
+   items with a fixed width primitive type code are radix sorted into
+   ascending numeric order, which the comparison function must agree with
+
+   @param rsorter the rsorter
+   @param p_indexable the pointer to the p_indexable
+*/
+#define RSorter_sort_predefined_comparison_function( arg ) PRIMITIVE_CAT( arg, _rsorter_sort_predefined_comparison_function )
+void
+RSorter_sort_predefined_comparison_function( Prefix )
+(
+   RSorter_type( Prefix ) *rsorter,
+   protocol_base_t *p_indexable
+);
+
+/**
+   RSorter_sort
+
+   sort an entire p_indexable
+   note that this function can be called without making a rsorter
+
+   when func is the predefined comparison function, items with a fixed
+   width primitive type code are radix sorted into ascending numeric order
+   and func is not called. Floating point -0.0 sorts before +0.0, NaNs with
+   the sign bit set sort first and other NaNs sort last. With any other
+   func, for example a descending one, or any other type code, the items
+   are merge sorted with func. Both sorts are stable.
+
+   @param p_indexable the pointer to the p_indexable
+   @param func function to compare two items in p_indexable
+*/
+#define RSorter_sort( arg ) PRIMITIVE_CAT( arg, _rsorter_sort )
+void
+RSorter_sort( Prefix )
+(
+   protocol_base_t *p_indexable,
+   int32_t (*func)( Type a, Type b )
+);
+
+/**
+   RSorter_is_sorted_predefined_comparison_function
+
+   return 1 if p_indexable is in order
+   note that this function can be called without making a rsorter
+
+   @param p_indexable the pointer to the p_indexable
+   @param func function to compare two items in p_indexable
+*/
+#define RSorter_is_sorted_predefined_comparison_function( arg ) PRIMITIVE_CAT( arg, _rsorter_is_sorted_predefined_comparison_function )
+int32_t
+RSorter_is_sorted_predefined_comparison_function( Prefix )
+(
+   RSorter_type( Prefix ) *current,
+   protocol_base_t *p_indexable
+);
+
+/**
+   RSorter_is_sorted
+
+   return 1 if p_indexable is in order
+   note that this function can be called without making a rsorter
+
+   @param p_indexable the pointer to the p_indexable
+   @param func function to compare two items in p_indexable
+*/
+#define RSorter_is_sorted( arg ) PRIMITIVE_CAT( arg, _rsorter_is_sorted )
+int32_t
+RSorter_is_sorted( Prefix )
+(
+   protocol_base_t *p_indexable,
+   int32_t (*func)( Type a, Type b )
+);
+
+/* End of file */
+
+
+
+
@@ -93,6 +93,7 @@ struct raw_buffer_struct
 
    int32_t count;
    uint8_t *buffer;
+   int32_t is_borrowed;
 
    MULTITHREAD_MUTEX_DEFINITION( mutex );
 };
@@ -209,6 +210,40 @@ raw_buffer_make_from_pointer( uint8_t *p, int32_t n )
    return result;
 }
 
+/**
+   raw_buffer_make_borrowed
+*/
+
+raw_buffer_t *
+raw_buffer_make_borrowed( uint8_t *p, int32_t n )
+{
+   PRECONDITION( "pointer ok", p != NULL );
+   PRECONDITION( "n ok", n >= 0 );
+
+   // allocate raw_buffer struct
+   raw_buffer_t * result
+      = ( raw_buffer_t * ) calloc( 1, sizeof( raw_buffer_t ) );
+   CHECK( "result allocated correctly", result != NULL );
+
+   // set type
+   (*result)._type = RAW_BUFFER_TYPE;
+
+   // set buffer, which belongs to someone else
+   (*result).buffer = p;
+   (*result).is_borrowed = 1;
+
+   // set count
+   (*result).count = n;
+
+   MULTITHREAD_MUTEX_INIT( (*result).mutex );
+
+   INVARIANT( result );
+   POSTCONDITION( "count set", (*result).count == n );
+   POSTCONDITION( "buffer set", (*result).buffer == p );
+
+   return result;
+}
+
 /**
    raw_buffer_clone
 */
@@ -380,6 +415,7 @@ raw_buffer_copy( raw_buffer_t *current, raw_buffer_t *other )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "current type OK", (*current)._type == RAW_BUFFER_TYPE );
+   PRECONDITION( "current not borrowed", (*current).is_borrowed == 0 );
    PRECONDITION( "other not null", other != NULL );
    PRECONDITION( "other type OK", (*other)._type == RAW_BUFFER_TYPE );
 
@@ -408,6 +444,7 @@ raw_buffer_deep_copy( raw_buffer_t *current, raw_buffer_t *other )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "current type OK", (*current)._type == RAW_BUFFER_TYPE );
+   PRECONDITION( "current not borrowed", (*current).is_borrowed == 0 );
    PRECONDITION( "other not null", other != NULL );
    PRECONDITION( "other type OK", (*other)._type == RAW_BUFFER_TYPE );
 
@@ -464,8 +501,11 @@ raw_buffer_deep_dispose( raw_buffer_t **current )
    LOCK( (**current).mutex );
    INVARIANT(*current);
 
-   // delete buffer
-   free( (**current).buffer );
+   // delete buffer, unless it is borrowed
+   if ( (**current).is_borrowed == 0 )
+   {
+      free( (**current).buffer );
+   }
 
    MULTITHREAD_MUTEX_DESTROY( (**current).mutex );
 
@@ -548,6 +588,7 @@ raw_buffer_append( raw_buffer_t *current, raw_buffer_t *other )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "current type OK", (*current)._type == RAW_BUFFER_TYPE );
+   PRECONDITION( "current not borrowed", (*current).is_borrowed == 0 );
    PRECONDITION( "other not null", other != NULL );
    PRECONDITION( "other type OK", (*other)._type == RAW_BUFFER_TYPE );
    LOCK( (*current).mutex );
@@ -584,6 +625,7 @@ raw_buffer_resize( raw_buffer_t *current, int32_t count )
 {
    PRECONDITION( "current not null", current != NULL );
    PRECONDITION( "current type OK", (*current)._type == RAW_BUFFER_TYPE );
+   PRECONDITION( "current not borrowed", (*current).is_borrowed == 0 );
    PRECONDITION( "count ok", count >= 0 );
    LOCK( (*current).mutex );
    INVARIANT( current );
@@ -653,6 +695,26 @@ raw_buffer_count( raw_buffer_t *current )
    return result;
 }
 
+/**
+   raw_buffer_is_borrowed
+*/
+
+int32_t
+raw_buffer_is_borrowed( raw_buffer_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == RAW_BUFFER_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = (*current).is_borrowed;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
 /**
    raw_buffer_read_char
 */
@@ -94,6 +94,27 @@ raw_buffer_t *
 raw_buffer_make_from_pointer( uint8_t *p, int32_t n );
 
 
+/**
+   raw_buffer_make_borrowed
+
+   Returns pointer to newly created raw_buffer_t that views memory owned
+   by someone else, such as a region of a file mapped by Binary_File. The
+   contents are not copied and are not freed when the raw buffer is
+   disposed. The raw buffer cannot be resized, appended to or copied
+   into, and must be disposed before the memory goes away. Its bytes can
+   be changed with the put functions, so the memory must be writable; the
+   views from Binary_File are of a copy on write mapping, so puts into
+   them do not change the file.
+
+   @param p pointer to the borrowed memory
+   @param n the size of the raw buffer
+   @return pointer to raw buffer
+*/
+
+raw_buffer_t *
+raw_buffer_make_borrowed( uint8_t *p, int32_t n );
+
+
 /**
    raw_buffer_clone
 
@@ -285,6 +306,18 @@ raw_buffer_base( raw_buffer_t *current );
 int32_t
 raw_buffer_count( raw_buffer_t *current );
 
+/**
+   raw_buffer_is_borrowed
+
+   Return 1 if the raw buffer views borrowed memory
+
+   @param current the raw buffer
+   @return 1 if borrowed, 0 otherwise
+*/
+
+int32_t
+raw_buffer_is_borrowed( raw_buffer_t *current );
+
 
 /**
    read primitive data item - platform specific
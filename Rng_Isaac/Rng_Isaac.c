@@ -364,6 +364,48 @@ static void isaac64( rng_isaac_t *current )
    return;
 }
 
+/**
+   block_count
+
+   @param current the rng
+   @param count the number of numbers wanted
+   @return the number of those that are left in the current buffer
+*/
+
+static int32_t block_count( rng_isaac_t *current, int32_t count )
+{
+   int32_t result = (*current).length - (*current).index;
+
+   if ( result > count )
+   {
+      result = count;
+   }
+
+   return result;
+}
+
+/**
+   block_forth
+
+   move forth past count numbers of the current buffer, computing the next
+   buffer when they were the last ones
+
+   @param current the rng
+   @param count the number of numbers
+*/
+
+static void block_forth( rng_isaac_t *current, int32_t count )
+{
+   (*current).index = (*current).index + count;
+
+   if ( (*current).index == (*current).length )
+   {
+      isaac64( current );
+   }
+
+   return;
+}
+
 /**
    Invariant
 */
@@ -394,11 +436,15 @@ void invariant( rng_isaac_t *p )
 #endif
 
 /**
-   rng_isaac_make
+   make_unseeded
+
+   @return a new rng_isaac_t instance with a zeroed random number buffer,
+   ready for randinit
 */
 
+static
 rng_isaac_t *
-rng_isaac_make( void )
+make_unseeded( void )
 {
    // allocate rng struct
    rng_isaac_t * result
@@ -425,6 +471,18 @@ rng_isaac_make( void )
 
    MULTITHREAD_MUTEX_INIT( (*result).mutex );
 
+   return result;
+}
+
+/**
+   rng_isaac_make
+*/
+
+rng_isaac_t *
+rng_isaac_make( void )
+{
+   rng_isaac_t *result = make_unseeded();
+
    // initialize rng
    randinit( result, GOLDEN_RATIO );
 
@@ -440,30 +498,27 @@ rng_isaac_make( void )
 rng_isaac_t *
 rng_isaac_make_with_seed( uint64_t seed )
 {
-   // allocate rng struct
-   rng_isaac_t * result
-      = ( rng_isaac_t * ) calloc( 1, sizeof( rng_isaac_t ) );
-   CHECK( "result allocated correctly", result != NULL );
+   rng_isaac_t *result = make_unseeded();
 
-   // set type
-   (*result)._type = RNG_ISAAC_TYPE;
+   // initialize rng
+   randinit( result, seed );
 
-   // set values
-   (*result).length = RANDBUF_LENGTH;
-   (*result).offset_mask = RANDBUF_OFFSET_MASK;
-   (*result).index = 0;
-   (*result).aa = 0;
-   (*result).bb = 0;
-   (*result).cc = 0;
+   INVARIANT( result );
 
-   // allocate arrays
-   (*result).randrsl = ( uint64_t * ) calloc( RANDBUF_LENGTH, sizeof( int64_t ) );
-   CHECK( "(*result).randrsl allocated correctly", (*result).randrsl != NULL );
+   return result;
+}
 
-   (*result).mm = ( uint64_t * ) calloc( RANDBUF_LENGTH, sizeof( int64_t ) );
-   CHECK( "(*result).mm allocated correctly", (*result).mm != NULL );
+/**
+   rng_isaac_make_with_stream
+*/
 
-   MULTITHREAD_MUTEX_INIT( (*result).mutex );
+rng_isaac_t *
+rng_isaac_make_with_stream( uint64_t seed, uint64_t stream )
+{
+   rng_isaac_t *result = make_unseeded();
+
+   // randinit mixes the buffer into the state along with the seed
+   (*result).randrsl[0] = stream;
 
    // initialize rng
    randinit( result, seed );
@@ -473,6 +528,40 @@ rng_isaac_make_with_seed( uint64_t seed )
    return result;
 }
 
+/**
+   rng_isaac_split
+*/
+
+rng_isaac_t *
+rng_isaac_split( rng_isaac_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == RNG_ISAAC_TYPE  );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t i = 0;
+   int32_t n = 0;
+   rng_isaac_t *result = make_unseeded();
+
+   // seed the whole buffer of the new rng from this one
+   while ( i < RANDBUF_LENGTH )
+   {
+      n = block_count( current, RANDBUF_LENGTH - i );
+      memcpy( &(*result).randrsl[i], &(*current).randrsl[ (*current).index ], n * sizeof( uint64_t ) );
+      block_forth( current, n );
+      i = i + n;
+   }
+
+   randinit( result, GOLDEN_RATIO );
+
+   INVARIANT( result );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
 
 /**
    rng_isaac_dispose
@@ -651,6 +740,118 @@ rng_isaac_f64_item( rng_isaac_t *current )
    return result;
 }
 
+/**
+   rng_isaac_fill_u32
+*/
+
+void
+rng_isaac_fill_u32( rng_isaac_t *current, uint32_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == RNG_ISAAC_TYPE  );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t n = 0;
+   uint64_t *r = NULL;
+
+   // copy out what is left of each buffer, as u32_item does
+   while ( i < count )
+   {
+      n = block_count( current, count - i );
+      r = &(*current).randrsl[ (*current).index ];
+
+      for ( j = 0; j < n; j++ )
+      {
+         array[ i + j ] = ( uint32_t ) ( r[j] >> RAND_HALF_BITS );
+      }
+
+      block_forth( current, n );
+      i = i + n;
+   }
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   rng_isaac_fill_u64
+*/
+
+void
+rng_isaac_fill_u64( rng_isaac_t *current, uint64_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == RNG_ISAAC_TYPE  );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t i = 0;
+   int32_t n = 0;
+
+   // copy out what is left of each buffer
+   while ( i < count )
+   {
+      n = block_count( current, count - i );
+      memcpy( &array[i], &(*current).randrsl[ (*current).index ], n * sizeof( uint64_t ) );
+      block_forth( current, n );
+      i = i + n;
+   }
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   rng_isaac_fill_f64
+*/
+
+void
+rng_isaac_fill_f64( rng_isaac_t *current, float64_t *array, int32_t count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == RNG_ISAAC_TYPE  );
+   PRECONDITION( "array not null", array != NULL );
+   PRECONDITION( "count ok", count >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t n = 0;
+   uint64_t *r = NULL;
+
+   // copy out what is left of each buffer, as f64_item does
+   while ( i < count )
+   {
+      n = block_count( current, count - i );
+      r = &(*current).randrsl[ (*current).index ];
+
+      for ( j = 0; j < n; j++ )
+      {
+         array[ i + j ] = 1.0 * r[j] / UINT64_MAX;
+      }
+
+      block_forth( current, n );
+      i = i + n;
+   }
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
 /**
    rng_isaac_forth
 */
@@ -80,6 +80,32 @@ rng_isaac_t * rng_isaac_make( void );
 */
 rng_isaac_t * rng_isaac_make_with_seed( uint64_t seed );
 
+/**
+   rng_isaac_make_with_stream
+
+   Return a new rng_isaac_t instance with the specified seed and stream.
+   Each stream of a seed is a separate generator, for example one per
+   worker thread. Stream 0 is the same as rng_isaac_make_with_seed.
+
+   @param seed the seed for the rng
+   @param stream the stream number
+   @return rng_isaac_t instance
+*/
+rng_isaac_t * rng_isaac_make_with_stream( uint64_t seed, uint64_t stream );
+
+/**
+   rng_isaac_split
+
+   Return a new rng_isaac_t instance whose whole internal state is seeded
+   with the next 256 numbers from current, which moves forth past them.
+   Splitting the same generator in the same order always gives the same
+   generators.
+
+   @param  current rng_isaac_t instance
+   @return rng_isaac_t instance
+*/
+rng_isaac_t * rng_isaac_split( rng_isaac_t *current );
+
 /*
    Disposal
 */
@@ -157,6 +183,49 @@ float32_t rng_isaac_f32_item( rng_isaac_t *current );
 */
 float64_t rng_isaac_f64_item( rng_isaac_t *current );
 
+/*
+   Bulk access
+*/
+
+/**
+   rng_isaac_fill_u32
+
+   Put count uint32_t random numbers into array, the same numbers that
+   count calls of rng_isaac_u32_item and rng_isaac_forth would return,
+   and move forth past them.
+
+   @param  current rng_isaac_t instance
+   @param  array the numbers
+   @param  count the number of numbers
+*/
+void rng_isaac_fill_u32( rng_isaac_t *current, uint32_t *array, int32_t count );
+
+/**
+   rng_isaac_fill_u64
+
+   Put count uint64_t random numbers into array, the same numbers that
+   count calls of rng_isaac_u64_item and rng_isaac_forth would return,
+   and move forth past them.
+
+   @param  current rng_isaac_t instance
+   @param  array the numbers
+   @param  count the number of numbers
+*/
+void rng_isaac_fill_u64( rng_isaac_t *current, uint64_t *array, int32_t count );
+
+/**
+   rng_isaac_fill_f64
+
+   Put count float64_t random numbers, [0, 1], into array, the same
+   numbers that count calls of rng_isaac_f64_item and rng_isaac_forth
+   would return, and move forth past them.
+
+   @param  current rng_isaac_t instance
+   @param  array the numbers
+   @param  count the number of numbers
+*/
+void rng_isaac_fill_f64( rng_isaac_t *current, float64_t *array, int32_t count );
+
 /*
    Cursor movement
 */
@@ -1066,7 +1066,9 @@ void SList_swap( Prefix )( SList_type( Prefix ) *current, int32_t i, int32_t j )
 /**
    SList_sort
 
-   Sort items in list using sort_func.
+   Sort items in list using sort_func. The sort is stable and relinks the
+   nodes in place, so different lists may be sorted at the same time from
+   different threads.
 
    @param  list SList_t instance
    @param sort_func function compare two list items
@@ -127,6 +127,30 @@ void invariant( Sequence_type( Prefix ) *current )
 
 #ifdef PROTOCOLS_ENABLED
 
+/**
+   span
+
+   returns the item buffer for the P_Indexable protocol
+*/
+
+static
+Type *
+span( Sequence_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "type ok", ( (*current)._type == SEQUENCE_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   // items are held in index order from the start of the buffer
+   Type *result = (*current).buffer;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
 /**
    indexable protocol function array
 */
@@ -158,7 +182,8 @@ p_indexable_table[P_INDEXABLE_FUNCTION_COUNT]
    Sequence_count( Prefix ),
    Sequence_item( Prefix ),
    Sequence_replace( Prefix ),
-   Sequence_replace_and_dispose( Prefix )
+   Sequence_replace_and_dispose( Prefix ),
+   span
 };
 
 /**
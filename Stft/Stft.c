@@ -0,0 +1,826 @@
+/**
+ @file Stft.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "Streaming Short Time Fourier Transform"
+
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0):
+
+ 1. Permission is hereby granted to use, copy, modify and/or
+    distribute this package, provided that:
+       * copyright notices are retained unchanged,
+       * any distribution of this package, whether modified or not,
+         includes this license text.
+ 2. Permission is hereby also granted to distribute binary programs
+    which depend on this package. If the binary program depends on a
+    modified version of this package, you are encouraged to publicly
+    release the modified version of this package.
+
+ THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT WARRANTY. ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE AUTHORS BE LIABLE TO ANY PARTY FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES ARISING IN ANY WAY OUT OF THE USE OF THIS PACKAGE.
+
+ @section Description
+
+ Function definitions for the opaque Stft_t type.
+
+ The samples of each channel are held in a ring of twice the frame
+ length. A frame is copied from the ring into the input of the channel's
+ Fft_t, transformed, and its power spectral density, log power spectral
+ density and phase are written straight into the caller's arrays. The
+ Fft_t instances of all channels share one Fft_plan_t. Frames of even
+ length greater than two use Fft_real_fft.
+
+ With more than one thread, the channels of a frame are transformed in
+ parallel on a pool of worker threads, one job per channel.
+
+*/
+
+#include "Stft.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#ifdef MULTITHREADED
+#include MULTITHREAD_INCLUDE
+#endif
+
+#include "pool.h"
+#include "dbc.h"
+
+/**
+   Note that this include file does NOT have an include guard - it may
+   be included multiple times with different macro defintions.
+
+   Defines that must be present (external to this file):
+
+   Prefix - string used to name this container type
+   Matvec_prefix - string used to name the vector type
+   Matvec_magnitude_prefix - string used to name the magnitude vector type
+   Type   - the type of the value
+   Magnitude_type - the type of the magnitude or precision of Type
+
+   Macros that must be present (external to this file):
+
+   SQUARED_MAGNITUDE_FUNCTION -  squared magnitude of type value
+   PHASE_FUNCTION             -  computes the phase of Type
+   SET_FROM                   -  sets value from another
+
+*/
+
+/**
+   Stft structure
+*/
+
+struct Stft_struct( Prefix )
+{
+   int32_t _type;
+
+   // frame, hop and ring lengths
+   int32_t frame_length;
+   int32_t hop_length;
+   int32_t capacity;
+
+   // channels
+   int32_t channel_count;
+
+   // ring of samples, capacity items per channel, count held from read_index
+   Magnitude_type *samples;
+   int32_t read_index;
+   int32_t count;
+
+   // plan shared by the fft of each channel
+   Fft_plan_type( Prefix ) *plan;
+   Fft_type( Prefix ) **ffts;
+
+   // 1 if frames are transformed with Fft_real_fft
+   int32_t is_real;
+
+   // outputs of the frame being transformed
+   Magnitude_type **psd;
+   Magnitude_type **log_psd;
+   Magnitude_type **phase;
+
+   // function given each frame consumed by Stft_put, and its outputs
+   void (*frame_function)( void *data, Magnitude_type **psd, Magnitude_type **log_psd, Magnitude_type **phase );
+   void *frame_data;
+   Magnitude_type **frame_psd;
+   Magnitude_type **frame_log_psd;
+   Magnitude_type **frame_phase;
+
+   // worker threads, started when thread_count is more than one
+   int32_t thread_count;
+   pool_t pool;
+
+   // multithread values if we include threading support
+   MULTITHREAD_MUTEX_DEFINITION( mutex );
+};
+
+#if INVARIANT_CONDITIONAL != 0
+
+static
+int32_t
+count_valid( Stft_type( Prefix ) *p )
+{
+   int32_t result = 1;
+
+   result = ( (*p).count >= 0 ) && ( (*p).count <= (*p).capacity );
+
+   return result;
+}
+
+static
+int32_t
+read_index_valid( Stft_type( Prefix ) *p )
+{
+   int32_t result = 1;
+
+   result = ( (*p).read_index >= 0 ) && ( (*p).read_index < (*p).capacity );
+
+   return result;
+}
+
+static
+int32_t
+ffts_not_null( Stft_type( Prefix ) *p )
+{
+   int32_t result = 1;
+
+   result = ( (*p).plan != NULL ) && ( (*p).ffts != NULL ) && ( (*p).samples != NULL );
+
+   return result;
+}
+
+static
+void invariant( Stft_type( Prefix ) *p )
+{
+   assert( ( ( void ) "count valid", count_valid( p ) ) );
+   assert( ( ( void ) "read index valid", read_index_valid( p ) ) );
+   assert( ( ( void ) "ffts not null", ffts_not_null( p ) ) );
+   return;
+}
+
+#endif
+
+/**
+   Thread pool
+
+   Stft_next_frame runs one job per channel on the pool. Each channel has
+   its own fft and output arrays, so the jobs share nothing but the read
+   only samples and plan.
+*/
+
+/**
+   frame_job
+
+   transform the oldest frame of one channel and write its outputs
+
+   @param arg the stft_t instance
+   @param channel the channel
+*/
+
+static
+void
+frame_job( void *arg, int32_t channel )
+{
+   Stft_type( Prefix ) *current = ( Stft_type( Prefix ) * ) arg;
+   int32_t i = 0;
+   int32_t n = 0;
+   int32_t k = 0;
+   Magnitude_type d = 0.0;
+   Magnitude_type *ring = NULL;
+   Magnitude_type *psd = NULL;
+   Magnitude_type *log_psd = NULL;
+   Magnitude_type *phase = NULL;
+   Type *pin = NULL;
+   Type *pout = NULL;
+   Fft_type( Prefix ) *fft = NULL;
+
+   n = (*current).frame_length;
+   fft = (*current).ffts[channel];
+   ring = (*current).samples + channel * (*current).capacity;
+
+   // copy the frame out of the ring, in at most two pieces
+   pin = Matvec_as_array( Matvec_prefix )( Fft_input( Prefix )( fft ) );
+   k = (*current).read_index;
+   for ( i = 0; i < n; i++ )
+   {
+      SET_FROM( pin[i], ring[k] );
+      k = k + 1;
+      if ( k == (*current).capacity )
+      {
+         k = 0;
+      }
+   }
+
+   if ( (*current).is_real == 1 )
+   {
+      Fft_real_fft( Prefix )( fft );
+   }
+   else
+   {
+      Fft_fft( Prefix )( fft );
+   }
+
+   pout = Matvec_as_array( Matvec_prefix )( Fft_output( Prefix )( fft ) );
+
+   // the same values as Fft_psd, Fft_log_psd and Fft_phase
+   if ( (*current).psd != NULL )
+   {
+      psd = (*current).psd[channel];
+      for ( i = 0; i < n; i++ )
+      {
+         d = SQUARED_MAGNITUDE_FUNCTION( pout[i] );
+         psd[i] = sqrt( d );
+      }
+   }
+
+   if ( (*current).log_psd != NULL )
+   {
+      log_psd = (*current).log_psd[channel];
+      for ( i = 0; i < n; i++ )
+      {
+         d = SQUARED_MAGNITUDE_FUNCTION( pout[i] );
+         log_psd[i] = 10.0 * log10( d );
+      }
+   }
+
+   if ( (*current).phase != NULL )
+   {
+      phase = (*current).phase[channel];
+      for ( i = 0; i < n; i++ )
+      {
+         phase[i] = PHASE_FUNCTION( pout[i] );
+      }
+   }
+
+   return;
+}
+
+/**
+   next_frame
+
+   transform the oldest frame of each channel into psd, log_psd and phase,
+   then drop hop_length samples. Called with the mutex locked.
+
+   @param current the stft_t instance
+   @param psd the power spectral density outputs, or NULL
+   @param log_psd the log power spectral density outputs, or NULL
+   @param phase the phase outputs, or NULL
+*/
+
+static
+void
+next_frame
+(
+   Stft_type( Prefix ) *current,
+   Magnitude_type **psd,
+   Magnitude_type **log_psd,
+   Magnitude_type **phase
+)
+{
+   int32_t i = 0;
+
+   (*current).psd = psd;
+   (*current).log_psd = log_psd;
+   (*current).phase = phase;
+
+   if ( (*current).thread_count > 1 )
+   {
+      pool_run( &(*current).pool, frame_job, current, (*current).channel_count );
+   }
+   else
+   {
+      for ( i = 0; i < (*current).channel_count; i++ )
+      {
+         frame_job( current, i );
+      }
+   }
+
+   (*current).psd = NULL;
+   (*current).log_psd = NULL;
+   (*current).phase = NULL;
+
+   // drop a hop of samples
+   (*current).read_index = ( (*current).read_index + (*current).hop_length ) % (*current).capacity;
+   (*current).count = (*current).count - (*current).hop_length;
+
+   return;
+}
+
+/**
+   put_samples
+
+   copy count samples of each channel, starting at start, into the rings.
+   Called with the mutex locked.
+
+   @param current the stft_t instance
+   @param samples the samples, one array per channel
+   @param start the index of the first sample to copy
+   @param count the number of samples to copy, at most the free space
+*/
+
+static
+void
+put_samples
+(
+   Stft_type( Prefix ) *current,
+   Magnitude_type **samples,
+   int32_t start,
+   int32_t count
+)
+{
+   int32_t i = 0;
+   int32_t write_index = 0;
+   int32_t n1 = 0;
+   Magnitude_type *ring = NULL;
+
+   // copy into each ring in at most two pieces
+   write_index = ( (*current).read_index + (*current).count ) % (*current).capacity;
+   n1 = (*current).capacity - write_index;
+   if ( n1 > count )
+   {
+      n1 = count;
+   }
+
+   for ( i = 0; i < (*current).channel_count; i++ )
+   {
+      ring = (*current).samples + i * (*current).capacity;
+      memcpy( ring + write_index, samples[i] + start, n1 * sizeof( Magnitude_type ) );
+      memcpy( ring, samples[i] + start + n1, ( count - n1 ) * sizeof( Magnitude_type ) );
+   }
+
+   (*current).count = (*current).count + count;
+
+   return;
+}
+
+/**
+   Stft_make
+*/
+
+Stft_type( Prefix ) *
+Stft_make( Prefix )
+(
+   int32_t frame_length,
+   int32_t hop_length,
+   int32_t channel_count
+)
+{
+   PRECONDITION( "frame_length ok", frame_length > 1 );
+   PRECONDITION( "hop_length ok", ( hop_length > 0 ) && ( hop_length <= frame_length ) );
+   PRECONDITION( "channel_count ok", channel_count > 0 );
+
+   int32_t i = 0;
+
+   // allocate result struct
+   Stft_type( Prefix ) * result
+      = ( Stft_type( Prefix ) * ) calloc( 1, sizeof( Stft_type( Prefix ) ) );
+   CHECK( "result allocated correctly", result != NULL );
+
+   // set type code
+   (*result)._type = STFT_TYPE;
+
+   // set lengths
+   (*result).frame_length = frame_length;
+   (*result).hop_length = hop_length;
+   (*result).capacity = 2 * frame_length;
+   (*result).channel_count = channel_count;
+
+   // allocate ring
+   (*result).samples
+      = ( Magnitude_type * ) calloc( channel_count * (*result).capacity, sizeof( Magnitude_type ) );
+   CHECK( "(*result).samples allocated correctly", (*result).samples != NULL );
+
+   (*result).read_index = 0;
+   (*result).count = 0;
+
+   // make the plan and the fft of each channel
+   (*result).plan = Fft_plan_make( Prefix )( frame_length );
+
+   (*result).ffts = ( Fft_type( Prefix ) ** ) calloc( channel_count, sizeof( Fft_type( Prefix ) * ) );
+   CHECK( "(*result).ffts allocated correctly", (*result).ffts != NULL );
+
+   for ( i = 0; i < channel_count; i++ )
+   {
+      (*result).ffts[i] = Fft_make_from_plan( Prefix )( (*result).plan );
+   }
+
+   (*result).is_real = ( ( frame_length % 2 ) == 0 ) && ( frame_length > 2 );
+
+   (*result).psd = NULL;
+   (*result).log_psd = NULL;
+   (*result).phase = NULL;
+
+   // frames are taken with Stft_next_frame until a frame function is set
+   (*result).frame_function = NULL;
+   (*result).frame_data = NULL;
+   (*result).frame_psd = NULL;
+   (*result).frame_log_psd = NULL;
+   (*result).frame_phase = NULL;
+
+   // one thread, no workers
+   (*result).thread_count = 1;
+
+   MULTITHREAD_MUTEX_INIT( (*result).mutex );
+
+   INVARIANT( result );
+
+   return result;
+}
+
+/**
+   Stft_dispose
+*/
+
+void
+Stft_dispose( Prefix )( Stft_type( Prefix ) **current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current not null", *current != NULL );
+   PRECONDITION( "current type ok", (**current)._type == STFT_TYPE );
+   LOCK( (**current).mutex );
+   INVARIANT(*current);
+
+   int32_t i = 0;
+
+   if ( (**current).thread_count > 1 )
+   {
+      pool_stop( &(**current).pool );
+   }
+
+   // dispose of the ffts before the plan they share
+   for ( i = 0; i < (**current).channel_count; i++ )
+   {
+      Fft_deep_dispose( Prefix )( &(**current).ffts[i] );
+   }
+   free( (**current).ffts );
+
+   Fft_plan_dispose( Prefix )( &(**current).plan );
+
+   free( (**current).samples );
+
+   MULTITHREAD_MUTEX_DESTROY( (**current).mutex );
+
+   // delete current struct
+   free(*current);
+
+   // set to null
+   *current = NULL;
+
+   return;
+}
+
+/**
+   Stft_deep_dispose
+*/
+
+void
+Stft_deep_dispose( Prefix )( Stft_type( Prefix ) **current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current not null", *current != NULL );
+   PRECONDITION( "current type ok", (**current)._type == STFT_TYPE );
+
+   // an stft holds no items of the caller
+   Stft_dispose( Prefix )( current );
+
+   return;
+}
+
+/**
+   Stft_thread_count
+*/
+
+int32_t
+Stft_thread_count( Prefix )( Stft_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", (*current)._type == STFT_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = (*current).thread_count;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   Stft_set_thread_count
+*/
+
+void
+Stft_set_thread_count( Prefix )( Stft_type( Prefix ) *current, int32_t thread_count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", (*current)._type == STFT_TYPE );
+   PRECONDITION( "thread_count positive", thread_count > 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   if ( thread_count != (*current).thread_count )
+   {
+      // restart the worker threads
+      if ( (*current).thread_count > 1 )
+      {
+         pool_stop( &(*current).pool );
+      }
+
+      (*current).thread_count = thread_count;
+
+      if ( (*current).thread_count > 1 )
+      {
+         pool_start( &(*current).pool, (*current).thread_count - 1 );
+      }
+   }
+
+   POSTCONDITION( "thread_count set", (*current).thread_count == thread_count );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   Stft_set_frame_function
+*/
+
+void
+Stft_set_frame_function( Prefix )
+(
+   Stft_type( Prefix ) *current,
+   void (*frame_function)( void *data, Magnitude_type **psd, Magnitude_type **log_psd, Magnitude_type **phase ),
+   void *data,
+   Magnitude_type **psd,
+   Magnitude_type **log_psd,
+   Magnitude_type **phase
+)
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", (*current)._type == STFT_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   (*current).frame_function = frame_function;
+   (*current).frame_data = data;
+   (*current).frame_psd = psd;
+   (*current).frame_log_psd = log_psd;
+   (*current).frame_phase = phase;
+
+   POSTCONDITION( "frame_function set", (*current).frame_function == frame_function );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   Stft_frame_length
+*/
+
+int32_t
+Stft_frame_length( Prefix )( Stft_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", (*current)._type == STFT_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = (*current).frame_length;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   Stft_hop_length
+*/
+
+int32_t
+Stft_hop_length( Prefix )( Stft_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", (*current)._type == STFT_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = (*current).hop_length;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   Stft_channel_count
+*/
+
+int32_t
+Stft_channel_count( Prefix )( Stft_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", (*current)._type == STFT_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = (*current).channel_count;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   Stft_count
+*/
+
+int32_t
+Stft_count( Prefix )( Stft_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", (*current)._type == STFT_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = (*current).count;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   Stft_space
+*/
+
+int32_t
+Stft_space( Prefix )( Stft_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", (*current)._type == STFT_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = (*current).capacity - (*current).count;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   Stft_is_frame_ready
+*/
+
+int32_t
+Stft_is_frame_ready( Prefix )( Stft_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", (*current)._type == STFT_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = ( (*current).count >= (*current).frame_length );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   Stft_put
+*/
+
+void
+Stft_put( Prefix )
+(
+   Stft_type( Prefix ) *current,
+   Magnitude_type **samples,
+   int32_t count
+)
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", (*current)._type == STFT_TYPE );
+   PRECONDITION( "samples not null", samples != NULL );
+   PRECONDITION( "count not negative", count >= 0 );
+   LOCK( (*current).mutex );
+   PRECONDITION( "count ok", ( (*current).frame_function != NULL ) || ( count <= (*current).capacity - (*current).count ) );
+   INVARIANT( current );
+
+   int32_t start = 0;
+   int32_t n = 0;
+
+   do
+   {
+      // fill the rings as far as they go
+      n = (*current).capacity - (*current).count;
+      if ( n > count - start )
+      {
+         n = count - start;
+      }
+
+      put_samples( current, samples, start, n );
+      start = start + n;
+
+      // then consume them frame by frame
+      if ( (*current).frame_function != NULL )
+      {
+         while ( (*current).count >= (*current).frame_length )
+         {
+            next_frame( current, (*current).frame_psd, (*current).frame_log_psd, (*current).frame_phase );
+            (*current).frame_function
+            (
+               (*current).frame_data,
+               (*current).frame_psd,
+               (*current).frame_log_psd,
+               (*current).frame_phase
+            );
+         }
+      }
+   }
+   while ( start < count );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   Stft_next_frame
+*/
+
+void
+Stft_next_frame( Prefix )
+(
+   Stft_type( Prefix ) *current,
+   Magnitude_type **psd,
+   Magnitude_type **log_psd,
+   Magnitude_type **phase
+)
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", (*current)._type == STFT_TYPE );
+   LOCK( (*current).mutex );
+   PRECONDITION( "frame ready", (*current).count >= (*current).frame_length );
+   INVARIANT( current );
+
+   next_frame( current, psd, log_psd, phase );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   Stft_wipe_out
+*/
+
+void
+Stft_wipe_out( Prefix )( Stft_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type ok", (*current)._type == STFT_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   (*current).read_index = 0;
+   (*current).count = 0;
+
+   POSTCONDITION( "count zero", (*current).count == 0 );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
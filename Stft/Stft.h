@@ -0,0 +1,337 @@
+/**
+ @file Stft.h
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "Streaming Short Time Fourier Transform"
+
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0):
+
+ 1. Permission is hereby granted to use, copy, modify and/or
+    distribute this package, provided that:
+       * copyright notices are retained unchanged,
+       * any distribution of this package, whether modified or not,
+         includes this license text.
+ 2. Permission is hereby also granted to distribute binary programs
+    which depend on this package. If the binary program depends on a
+    modified version of this package, you are encouraged to publicly
+    release the modified version of this package.
+
+ THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT WARRANTY. ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE AUTHORS BE LIABLE TO ANY PARTY FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES ARISING IN ANY WAY OUT OF THE USE OF THIS PACKAGE.
+
+ @section Description
+
+ Function declarations for the opaque Stft_t type.
+
+*/
+
+/**
+   includes
+*/
+
+#include "base.h"
+#include "Matvec.h"
+#include "Fft.h"
+
+/**
+   Note that this include file does NOT have an include guard - it may
+   be included multiple times with different macro defintions.
+
+   Defines that must be present (external to this file):
+
+   Prefix - string used to name this container type
+   Matvec_prefix - string used to name the vector type
+   Matvec_magnitude_prefix - string used to name the magnitude vector type
+   Type   - the type of the value
+   Magnitude_type - the type of the magnitude or precision of Type
+
+*/
+
+/**
+   Macro definitions
+*/
+
+#define PRIMITIVE_CAT(arg, ...) arg ## __VA_ARGS__
+
+#define Stft_struct( arg ) PRIMITIVE_CAT( arg, _stft_struct )
+#define Stft_type( arg ) PRIMITIVE_CAT( arg, _stft_t )
+#define Stft_name( arg ) PRIMITIVE_CAT( arg, _stft )
+
+/**
+   Structure declarations
+*/
+
+struct Stft_struct( Prefix );
+
+/**
+   Structure typedefs
+*/
+
+typedef struct Stft_struct( Prefix ) Stft_type( Prefix );
+
+
+/*
+   Initialization
+*/
+
+/**
+   Stft_make
+
+   Return a new Stft_t instance. Each channel is transformed in frames of
+   frame_length samples, with a new frame every hop_length samples. All
+   channels share one Fft_plan_t.
+
+   @param frame_length the length of a frame, at least two
+   @param hop_length the samples between the starts of frames, from one to frame_length
+   @param channel_count the number of channels, at least one
+   @return Stft_t instance
+*/
+#define Stft_make( arg ) PRIMITIVE_CAT( arg, _stft_make )
+Stft_type( Prefix ) *
+Stft_make( Prefix )
+(
+   int32_t frame_length,
+   int32_t hop_length,
+   int32_t channel_count
+);
+
+/*
+   Disposal
+*/
+
+/**
+   Stft_dispose
+
+   Free a Stft_t instance and stop its worker threads.
+
+   @param  stft Stft_t instance
+*/
+#define Stft_dispose( arg ) PRIMITIVE_CAT( arg, _stft_dispose )
+void Stft_dispose( Prefix )( Stft_type( Prefix ) **current );
+
+/**
+   Stft_deep_dispose
+
+   Free a Stft_t instance and stop its worker threads. A Stft_t holds no
+   items of the caller, so this is the same as Stft_dispose.
+
+   @param  stft Stft_t instance
+*/
+#define Stft_deep_dispose( arg ) PRIMITIVE_CAT( arg, _stft_deep_dispose )
+void Stft_deep_dispose( Prefix )( Stft_type( Prefix ) **current );
+
+/*
+   Threading
+*/
+
+/**
+   Stft_thread_count
+
+   Return the number of threads used to transform the channels of a frame,
+   including the calling thread. A new stft uses one thread.
+
+   @param  stft Stft_t instance
+   @return the thread count
+*/
+#define Stft_thread_count( arg ) PRIMITIVE_CAT( arg, _stft_thread_count )
+int32_t Stft_thread_count( Prefix )( Stft_type( Prefix ) *current );
+
+/**
+   Stft_set_thread_count
+
+   Set the number of threads used to transform the channels of a frame,
+   including the calling thread. Worker threads are started when the count
+   is more than one and stopped when the stft is disposed. Results are
+   identical to the single threaded results.
+
+   @param  stft Stft_t instance
+   @param  thread_count the number of threads
+*/
+#define Stft_set_thread_count( arg ) PRIMITIVE_CAT( arg, _stft_set_thread_count )
+void Stft_set_thread_count( Prefix )( Stft_type( Prefix ) *current, int32_t thread_count );
+
+/*
+   Frame delivery
+*/
+
+/**
+   Stft_set_frame_function
+
+   Set a function that Stft_put gives each frame to. With a frame function
+   Stft_put takes any number of samples and transforms every frame as soon
+   as it is held, as Stft_next_frame would, into psd, log_psd and phase,
+   then calls frame_function( data, psd, log_psd, phase ). No frame is left
+   ready after Stft_put returns. frame_function is called with the stft
+   locked and must not call functions of the same stft. A NULL
+   frame_function restores taking frames with Stft_next_frame.
+
+   @param  stft Stft_t instance
+   @param  frame_function the function given each frame, or NULL
+   @param  data passed to frame_function
+   @param  psd the power spectral density outputs, one array per channel, or NULL
+   @param  log_psd the log power spectral density outputs, one array per channel, or NULL
+   @param  phase the phase outputs, one array per channel, or NULL
+*/
+#define Stft_set_frame_function( arg ) PRIMITIVE_CAT( arg, _stft_set_frame_function )
+void
+Stft_set_frame_function( Prefix )
+(
+   Stft_type( Prefix ) *current,
+   void (*frame_function)( void *data, Magnitude_type **psd, Magnitude_type **log_psd, Magnitude_type **phase ),
+   void *data,
+   Magnitude_type **psd,
+   Magnitude_type **log_psd,
+   Magnitude_type **phase
+);
+
+/*
+   Access
+*/
+
+/**
+   Stft_frame_length
+
+   Return the number of samples in a frame, also the number of items in
+   each output frame.
+
+   @param  stft Stft_t instance
+   @return the frame length
+*/
+#define Stft_frame_length( arg ) PRIMITIVE_CAT( arg, _stft_frame_length )
+int32_t Stft_frame_length( Prefix )( Stft_type( Prefix ) *current );
+
+/**
+   Stft_hop_length
+
+   Return the number of samples between the starts of frames.
+
+   @param  stft Stft_t instance
+   @return the hop length
+*/
+#define Stft_hop_length( arg ) PRIMITIVE_CAT( arg, _stft_hop_length )
+int32_t Stft_hop_length( Prefix )( Stft_type( Prefix ) *current );
+
+/**
+   Stft_channel_count
+
+   Return the number of channels.
+
+   @param  stft Stft_t instance
+   @return the channel count
+*/
+#define Stft_channel_count( arg ) PRIMITIVE_CAT( arg, _stft_channel_count )
+int32_t Stft_channel_count( Prefix )( Stft_type( Prefix ) *current );
+
+/**
+   Stft_count
+
+   Return the number of samples held for each channel.
+
+   @param  stft Stft_t instance
+   @return the sample count
+*/
+#define Stft_count( arg ) PRIMITIVE_CAT( arg, _stft_count )
+int32_t Stft_count( Prefix )( Stft_type( Prefix ) *current );
+
+/**
+   Stft_space
+
+   Return the number of samples per channel that can be put before the
+   next frame must be taken. It is more than the frame length when no
+   frame is ready.
+
+   @param  stft Stft_t instance
+   @return the free space
+*/
+#define Stft_space( arg ) PRIMITIVE_CAT( arg, _stft_space )
+int32_t Stft_space( Prefix )( Stft_type( Prefix ) *current );
+
+/*
+   Status report
+*/
+
+/**
+   Stft_is_frame_ready
+
+   Returns 1 if a frame's worth of samples is held, 0 otherwise.
+
+   @param  stft Stft_t instance
+   @return 1 if a frame is ready, 0 otherwise
+*/
+#define Stft_is_frame_ready( arg ) PRIMITIVE_CAT( arg, _stft_is_frame_ready )
+int32_t Stft_is_frame_ready( Prefix )( Stft_type( Prefix ) *current );
+
+/*
+   Element change
+*/
+
+/**
+   Stft_put
+
+   Append count samples to each channel. samples[i] holds the count
+   samples of channel i. Without a frame function count may not exceed
+   Stft_space. With one, any count is taken: the samples are put as far as
+   the ring holds them and each frame is transformed and given to the
+   frame function before more are put.
+
+   @param  stft Stft_t instance
+   @param  samples the samples, one array per channel
+   @param  count the number of samples per channel
+*/
+#define Stft_put( arg ) PRIMITIVE_CAT( arg, _stft_put )
+void
+Stft_put( Prefix )
+(
+   Stft_type( Prefix ) *current,
+   Magnitude_type **samples,
+   int32_t count
+);
+
+/**
+   Stft_next_frame
+
+   Transform the oldest frame of each channel, windowed and scaled as by
+   Fft_fft, then drop hop_length samples. The power spectral density, log
+   power spectral density and phase of channel i are written to psd[i],
+   log_psd[i] and phase[i], each of frame_length items. Any of psd,
+   log_psd and phase may be NULL to skip that output. Nothing is
+   allocated.
+
+   @param  stft Stft_t instance
+   @param  psd the power spectral density outputs, one array per channel, or NULL
+   @param  log_psd the log power spectral density outputs, one array per channel, or NULL
+   @param  phase the phase outputs, one array per channel, or NULL
+*/
+#define Stft_next_frame( arg ) PRIMITIVE_CAT( arg, _stft_next_frame )
+void
+Stft_next_frame( Prefix )
+(
+   Stft_type( Prefix ) *current,
+   Magnitude_type **psd,
+   Magnitude_type **log_psd,
+   Magnitude_type **phase
+);
+
+/**
+   Stft_wipe_out
+
+   Drop all held samples.
+
+   @param  stft Stft_t instance
+*/
+#define Stft_wipe_out( arg ) PRIMITIVE_CAT( arg, _stft_wipe_out )
+void Stft_wipe_out( Prefix )( Stft_type( Prefix ) *current );
+
+
+/* End of file */
+
@@ -56,20 +56,143 @@ extern "C" {
 
 #define STRING_MIN_SIZE 4
 
-#define HASH_PRIME_NUMBER 8388593U
+/**
+   hash secrets - odd 64 bit constants with well mixed bits
+*/
+
+#define HASH_SECRET_0 0xa0761d6478bd642fULL
+#define HASH_SECRET_1 0xe7037ed1a0b428dbULL
+#define HASH_SECRET_2 0x8ebc6af09c88c6e3ULL
+#define HASH_SECRET_3 0x589965cc75374cc3ULL
 
 /**
-   get_hash
+   hash_multiply
+
+   multiply two 64 bit values into a 128 bit result, returned as low and
+   high halves
+
+   @param a the first value, set to the low half of the product
+   @param b the second value, set to the high half of the product
+*/
+static
+void
+hash_multiply
+(
+   uint64_t *a,
+   uint64_t *b
+)
+{
+#ifdef __SIZEOF_INT128__
+   __uint128_t r = *a;
+   r = r * (*b);
+   *a = ( uint64_t ) r;
+   *b = ( uint64_t ) ( r >> 64 );
+#else
+   uint64_t ha = (*a) >> 32;
+   uint64_t hb = (*b) >> 32;
+   uint64_t la = ( uint32_t ) (*a);
+   uint64_t lb = ( uint32_t ) (*b);
+   uint64_t rh = ha * hb;
+   uint64_t rm0 = ha * lb;
+   uint64_t rm1 = hb * la;
+   uint64_t rl = la * lb;
+   uint64_t t = rl + ( rm0 << 32 );
+   uint64_t c = ( t < rl );
+   uint64_t lo = t + ( rm1 << 32 );
+   c = c + ( lo < t );
+   *a = lo;
+   *b = rh + ( rm0 >> 32 ) + ( rm1 >> 32 ) + c;
+#endif
+   return;
+}
+
+/**
+   hash_mix
+
+   fold the 128 bit product of two 64 bit values into 64 bits
+
+   @param a the first value
+   @param b the second value
+   @return the mixed value
+*/
+static
+uint64_t
+hash_mix
+(
+   uint64_t a,
+   uint64_t b
+)
+{
+   hash_multiply( &a, &b );
+   return a ^ b;
+}
+
+/**
+   hash_read_8
+
+   read 8 bytes as a little endian 64 bit value
+
+   @param p pointer to the bytes
+   @return the value
+*/
+static
+uint64_t
+hash_read_8
+(
+   uint8_t *p
+)
+{
+   uint64_t result = 0;
 
-   get the hash code for a character string
+   memcpy( &result, p, 8 );
+
+#if defined( __BYTE_ORDER__ ) && ( __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__ )
+   result = __builtin_bswap64( result );
+#endif
+
+   return result;
+}
+
+/**
+   hash_read_4
+
+   read 4 bytes as a little endian 32 bit value
+
+   @param p pointer to the bytes
+   @return the value
+*/
+static
+uint64_t
+hash_read_4
+(
+   uint8_t *p
+)
+{
+   uint32_t result = 0;
+
+   memcpy( &result, p, 4 );
+
+#if defined( __BYTE_ORDER__ ) && ( __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__ )
+   result = __builtin_bswap32( result );
+#endif
+
+   return result;
+}
+
+/**
+   get_hash_64
+
+   get the 64 bit hash code for a character string. Reads the string eight
+   or sixteen bytes at a time and mixes with 64x64->128 bit multiplies
+   (the wyhash construction), so every input byte affects every output bit.
 
    @param s the cstring to get the hash of
    @param count the length of the string
    @return the hash value
 */
 static
-int32_t
-get_hash
+uint64_t
+get_hash_64
 (
    char_t *s,
    int32_t count
@@ -78,17 +201,87 @@ get_hash
    PRECONDITION( "s not null", s != NULL );
    PRECONDITION( "count ok", count >= 0 );
 
-   uint32_t result = 0;   // returned hash value
-   int32_t i = 0;             // loop variable
+   uint8_t *p = ( uint8_t * ) s;
+   uint64_t n = ( uint64_t ) count;
+   uint64_t i = n;
+   uint64_t seed = 0;
+   uint64_t a = 0;
+   uint64_t b = 0;
+   uint64_t see1 = 0;
+   uint64_t see2 = 0;
 
-   // loop to compute the hash
-   for( i = 0; i < count; i++ )
+   seed = hash_mix( seed ^ HASH_SECRET_0, HASH_SECRET_1 );
+
+   if ( n <= 16 )
    {
-      result = ( ( result % HASH_PRIME_NUMBER ) << 8 ) + ( uint32_t ) s[i];
+      if ( n >= 4 )
+      {
+         // two overlapping pairs of 4 byte reads cover 4 to 16 bytes
+         a = ( hash_read_4( p ) << 32 ) | hash_read_4( p + ( ( n >> 3 ) << 2 ) );
+         b = ( hash_read_4( p + n - 4 ) << 32 ) | hash_read_4( p + n - 4 - ( ( n >> 3 ) << 2 ) );
+      }
+      else if ( n > 0 )
+      {
+         a = ( ( ( uint64_t ) p[0] ) << 16 ) | ( ( ( uint64_t ) p[n >> 1] ) << 8 ) | p[n - 1];
+         b = 0;
+      }
    }
+   else
+   {
+      // three independent lanes for long strings
+      if ( i > 48 )
+      {
+         see1 = seed;
+         see2 = seed;
 
-   // return result
-   return ( int32_t ) result;
+         do
+         {
+            seed = hash_mix( hash_read_8( p ) ^ HASH_SECRET_1, hash_read_8( p + 8 ) ^ seed );
+            see1 = hash_mix( hash_read_8( p + 16 ) ^ HASH_SECRET_2, hash_read_8( p + 24 ) ^ see1 );
+            see2 = hash_mix( hash_read_8( p + 32 ) ^ HASH_SECRET_3, hash_read_8( p + 40 ) ^ see2 );
+            p = p + 48;
+            i = i - 48;
+         }
+         while ( i > 48 );
+
+         seed = seed ^ see1 ^ see2;
+      }
+
+      while ( i > 16 )
+      {
+         seed = hash_mix( hash_read_8( p ) ^ HASH_SECRET_1, hash_read_8( p + 8 ) ^ seed );
+         i = i - 16;
+         p = p + 16;
+      }
+
+      // last 16 bytes, possibly overlapping bytes already mixed in
+      a = hash_read_8( p + i - 16 );
+      b = hash_read_8( p + i - 8 );
+   }
+
+   a = a ^ HASH_SECRET_1;
+   b = b ^ seed;
+   hash_multiply( &a, &b );
+
+   return hash_mix( a ^ HASH_SECRET_0 ^ n, b ^ HASH_SECRET_1 );
+}
+
+/**
+   hash_32_from_64
+
+   fold a 64 bit hash code into a non-negative 32 bit hash code
+
+   @param hash the 64 bit hash code
+   @return the 32 bit hash value
+*/
+static
+int32_t
+hash_32_from_64
+(
+   uint64_t hash
+)
+{
+   return ( int32_t ) ( ( hash ^ ( hash >> 32 ) ) & 0x7FFFFFFF );
 }
 
 /**
@@ -196,7 +389,7 @@ struct string_struct
    char *area;
    int32_t count;
    int32_t capacity;
-   int32_t hash_code;
+   uint64_t hash_code;
    int32_t hash_code_valid;
 
    MULTITHREAD_MUTEX_DEFINITION( mutex );
@@ -256,7 +449,7 @@ hash_ok( string_t *current )
 
    if ( (*current).hash_code_valid == 1 )
    {
-      result = ( (*current).hash_code == get_hash( (*current).area, (*current).count ) );
+      result = ( (*current).hash_code == get_hash_64( (*current).area, (*current).count ) );
    }
 
    return result;
@@ -987,11 +1180,39 @@ string_hash_code( string_t *current )
 
    if ( (*current).hash_code_valid == 0 )
    {
-      (*current).hash_code = get_hash( (*current).area, (*current).count );
+      (*current).hash_code = get_hash_64( (*current).area, (*current).count );
+      (*current).hash_code_valid = 1;
+   }
+
+   int32_t result = hash_32_from_64( (*current).hash_code );
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   POSTCONDITION( "result non-negative", result >= 0 );
+
+   return result;
+}
+
+/**
+   string_hash_code_64
+*/
+
+uint64_t
+string_hash_code_64( string_t *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", (*current)._type == STRING_TYPE );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   if ( (*current).hash_code_valid == 0 )
+   {
+      (*current).hash_code = get_hash_64( (*current).area, (*current).count );
       (*current).hash_code_valid = 1;
    }
 
-   int32_t result = (*current).hash_code;
+   uint64_t result = (*current).hash_code;
 
    INVARIANT( current );
    UNLOCK( (*current).mutex );
@@ -999,6 +1220,36 @@ string_hash_code( string_t *current )
    return result;
 }
 
+/**
+   string_hash_code_cstring
+*/
+
+int32_t
+string_hash_code_cstring( char_t *cstring )
+{
+   PRECONDITION( "cstring not null", cstring != NULL );
+
+   int32_t result = hash_32_from_64( get_hash_64( cstring, strlen( cstring ) ) );
+
+   POSTCONDITION( "result non-negative", result >= 0 );
+
+   return result;
+}
+
+/**
+   string_hash_code_64_cstring
+*/
+
+uint64_t
+string_hash_code_64_cstring( char_t *cstring )
+{
+   PRECONDITION( "cstring not null", cstring != NULL );
+
+   uint64_t result = get_hash_64( cstring, strlen( cstring ) );
+
+   return result;
+}
+
 /**
    string_is_equal_cstring
 */
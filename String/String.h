@@ -371,7 +371,8 @@ string_is_float64( string_t *current );
 /**
    string_hash_code
 
-   Returns hash code of the string.
+   Returns non-negative 32 bit hash code of the string. Suitable for use as
+   KEY_HASH_FUNCTION in container specializations keyed by string_t.
 
    @param current the string_t instance
    @return hash code
@@ -379,6 +380,42 @@ string_is_float64( string_t *current );
 int32_t
 string_hash_code( string_t *current );
 
+/**
+   string_hash_code_64
+
+   Returns 64 bit hash code of the string. The 32 bit hash code is derived
+   from this value.
+
+   @param current the string_t instance
+   @return hash code
+*/
+uint64_t
+string_hash_code_64( string_t *current );
+
+/**
+   string_hash_code_cstring
+
+   Returns hash code of the cstring, the same value that string_hash_code
+   returns for a string_t with the same contents.
+
+   @param cstring the cstring
+   @return hash code
+*/
+int32_t
+string_hash_code_cstring( char_t *cstring );
+
+/**
+   string_hash_code_64_cstring
+
+   Returns 64 bit hash code of the cstring, the same value that
+   string_hash_code_64 returns for a string_t with the same contents.
+
+   @param cstring the cstring
+   @return hash code
+*/
+uint64_t
+string_hash_code_64_cstring( char_t *cstring );
+
 
 /*
    Comparison
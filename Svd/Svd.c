@@ -48,6 +48,7 @@ extern "C" {
 #include MULTITHREAD_INCLUDE
 #endif
 
+#include "pool.h"
 #include "dbc.h"
 
 /**
@@ -83,6 +84,45 @@ extern "C" {
 
 */
 
+/**
+   SVD_BLOCK_SIZE - the number of vectors in a block of a sweep
+   SVD_MAX_SWEEP_COUNT - the most sweeps made before giving up on convergence
+   SVD_OVERSAMPLE_COUNT - the extra vectors kept by a truncated svd
+   SVD_MAX_ITERATION_COUNT - the most subspace iterations of a truncated svd
+*/
+
+#define SVD_BLOCK_SIZE 16
+#define SVD_MAX_SWEEP_COUNT 64
+#define SVD_OVERSAMPLE_COUNT 8
+#define SVD_MAX_ITERATION_COUNT 64
+
+/**
+   sweep structure
+
+   the vectors of one Jacobi decomposition, shared by the jobs of a sweep.
+   The a vectors are made orthogonal, the b vectors get the same
+   rotations. Vector i of a starts at a[ i*a_length ].
+*/
+
+typedef struct
+{
+   Magnitude_type rotation_error;
+
+   Type *a;
+   int32_t a_count;
+   int32_t a_length;
+
+   Type *b;
+   int32_t b_length;
+
+   int32_t block_count;
+   int32_t pair_block_count;
+   int32_t round;
+
+   // rotations made by each job of a step
+   int32_t *rotation_counts;
+} sweep_t;
+
 /**
    Svd structure
 */
@@ -114,6 +154,13 @@ struct Svd_struct( Prefix )
    // singular values vector
    Matvec_type( Matvec_prefix ) *singular_value;
 
+   // number of leading singular values to compute, 0 for all
+   int32_t truncation;
+
+   // worker threads for the sweeps, started when thread_count is more than one
+   int32_t thread_count;
+   pool_t pool;
+
    // multithread values if we include threading support
    MULTITHREAD_MUTEX_DEFINITION( mutex );
 };
@@ -180,87 +227,70 @@ singular_value_threshold_positive( Svd_type( Prefix ) *p )
    return result;
 }
 
+static
+int32_t
+truncation_not_negative( Svd_type( Prefix ) *p )
+{
+   int32_t result = 0;
+
+   if ( (*p).truncation >= 0 )
+   {
+      result = 1;
+   }
+
+   return result;
+}
+
+static
+int32_t
+thread_count_positive( Svd_type( Prefix ) *p )
+{
+   int32_t result = 0;
+
+   if ( (*p).thread_count > 0 )
+   {
+      result = 1;
+   }
+
+   return result;
+}
+
 static
 void invariant( Svd_type( Prefix ) *p )
 {
    assert( ( ( void ) "svd done implies matrices not null", svd_done_implies_matrices_not_null( p ) ) );
    assert( ( ( void ) "rotation error positive", rotation_error_positive( p ) ) );
    assert( ( ( void ) "singular value threshold positive", singular_value_threshold_positive( p ) ) );
+   assert( ( ( void ) "truncation not negative", truncation_not_negative( p ) ) );
+   assert( ( ( void ) "thread count positive", thread_count_positive( p ) ) );
    return;
 }
 
 #endif
 
 /**
-   Internal routines
-*/
-
-static void row_vector_rotate
-(
-   Svd_type( Prefix ) *svd,
-   Matvec_type( Matvec_prefix ) *a,
-   Matvec_type( Matvec_prefix ) *b,
-   int32_t i1,
-   int32_t i2
-);
-
-static void row_rotation
-(
-   Svd_type( Prefix ) *svd,
-   Matvec_type( Matvec_prefix ) *a,
-   int32_t i1,
-   int32_t i2,
-   Type c,
-   Type s
-);
+   Thread pool
 
-static void row_rotation_with_swap
-(
-   Svd_type( Prefix ) *svd,
-   Matvec_type( Matvec_prefix ) *a,
-   int32_t i1,
-   int32_t i2,
-   Type c,
-   Type s
-);
+   A sweep runs one job per block, then one job per pair of blocks in
+   each round. The blocks of a step are disjoint, so the jobs of a step
+   share no vectors.
+*/
 
-static void column_vector_rotate
-(
-   Svd_type( Prefix ) *svd,
-   Matvec_type( Matvec_prefix ) *a,
-   Matvec_type( Matvec_prefix ) *b,
-   int32_t i1,
-   int32_t i2
-);
+/**
+   Internal routines
+*/
 
-static void column_rotation
+static void full_svd
 (
    Svd_type( Prefix ) *svd,
-   Matvec_type( Matvec_prefix ) *a,
-   int32_t i1,
-   int32_t i2,
-   Type c,
-   Type s
+   int32_t count
 );
 
-static void column_rotation_with_swap
+static void truncated_svd
 (
    Svd_type( Prefix ) *svd,
-   Matvec_type( Matvec_prefix ) *a,
-   int32_t i1,
-   int32_t i2,
-   Type c,
-   Type s
-);
-
-static void row_svd
-(
-   Svd_type( Prefix ) *svd
-);
-
-static void column_svd
-(
-   Svd_type( Prefix ) *svd
+   int32_t count,
+   int32_t width
 );
 
 /**
@@ -283,6 +313,9 @@ Svd_make( Prefix )( void )
    (*result).rotation_error = 0.0000001;
    (*result).singular_value_threshold = 0.0000001;
 
+   // one thread, no workers
+   (*result).thread_count = 1;
+
    MULTITHREAD_MUTEX_INIT( (*result).mutex );
 
    INVARIANT( result );
@@ -304,6 +337,12 @@ Svd_dispose( Prefix )( Svd_type( Prefix ) **svd )
    LOCK( (**svd).mutex );
    INVARIANT(*svd);
 
+   // stop the worker threads
+   if ( (**svd).thread_count > 1 )
+   {
+      pool_stop( &(**svd).pool );
+   }
+
    MULTITHREAD_MUTEX_DESTROY( (**svd).mutex );
 
    // delete svd struct
@@ -353,6 +392,12 @@ Svd_deep_dispose( Prefix )( Svd_type( Prefix ) **svd )
       (**svd).singular_value = NULL;
    }
 
+   // stop the worker threads
+   if ( (**svd).thread_count > 1 )
+   {
+      pool_stop( &(**svd).pool );
+   }
+
    MULTITHREAD_MUTEX_DESTROY( (**svd).mutex );
 
    // delete svd struct
@@ -444,6 +489,46 @@ Svd_right_singular_vectors( Prefix )( Svd_type( Prefix ) *current )
    return result;
 }
 
+/**
+   Svd_truncation
+*/
+
+int32_t
+Svd_truncation( Prefix )( Svd_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", ( (*current)._type == SVD_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = (*current).truncation;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
+/**
+   Svd_thread_count
+*/
+
+int32_t
+Svd_thread_count( Prefix )( Svd_type( Prefix ) *current )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", ( (*current)._type == SVD_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   int32_t result = (*current).thread_count;
+
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return result;
+}
+
 /**
    Svd_reconstructed_input
 */
@@ -493,7 +578,7 @@ Svd_reconstructed_input( Prefix )( Svd_type( Prefix ) *current )
       l = Matvec_copied( Matvec_prefix )( (*current).matrix );
       r = Matvec_copied( Matvec_prefix )( (*current).rotation_matrix );
 
-      n = Matvec_columns( Matvec_prefix )( l );
+      n = Matvec_rows( Matvec_prefix )( l );
 
       for( i = 0; i < n; i++ )
       {
@@ -584,6 +669,64 @@ Svd_set_singular_value_threshold( Prefix )( Svd_type( Prefix ) *current, Magnitu
    return;
 }
 
+/**
+   Svd_set_truncation
+*/
+
+void
+Svd_set_truncation( Prefix )( Svd_type( Prefix ) *current, int32_t truncation )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", ( (*current)._type == SVD_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   PRECONDITION( "truncation not negative", truncation >= 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   (*current).truncation = truncation;
+
+   POSTCONDITION( "truncation set", (*current).truncation == truncation );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
+/**
+   Svd_set_thread_count
+*/
+
+void
+Svd_set_thread_count( Prefix )( Svd_type( Prefix ) *current, int32_t thread_count )
+{
+   PRECONDITION( "current not null", current != NULL );
+   PRECONDITION( "current type OK", ( (*current)._type == SVD_TYPE ) && ( (*current)._item_type == Type_Code ) );
+   PRECONDITION( "thread_count positive", thread_count > 0 );
+   LOCK( (*current).mutex );
+   INVARIANT( current );
+
+   if ( thread_count != (*current).thread_count )
+   {
+      // restart the worker threads
+      if ( (*current).thread_count > 1 )
+      {
+         pool_stop( &(*current).pool );
+      }
+
+      (*current).thread_count = thread_count;
+
+      if ( (*current).thread_count > 1 )
+      {
+         pool_start( &(*current).pool, (*current).thread_count - 1 );
+      }
+   }
+
+   POSTCONDITION( "thread_count set", (*current).thread_count == thread_count );
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
+   return;
+}
+
 /**
    Svd_inverse
 */
@@ -652,7 +795,7 @@ Svd_inverse( Prefix )( Svd_type( Prefix ) *current )
       g = Matvec_vector_item( Matvec_prefix )( (*current).singular_value, 0 );
       s1 = sqrt( SQUARED_MAGNITUDE_FUNCTION( g ) );
 
-      n = Matvec_columns( Matvec_prefix )( l );
+      n = Matvec_rows( Matvec_prefix )( l );
 
       for ( i = 0; i < n; i++ )
       {
@@ -703,42 +846,17 @@ Svd_svd( Prefix )( Svd_type( Prefix ) *current )
 
    int32_t height = 0;
    int32_t width = 0;
+   int32_t n = 0;
+   int32_t count = 0;
+   int32_t subspace_width = 0;
 
    height = Matvec_rows( Matvec_prefix )( (*current).input );
    width = Matvec_columns( Matvec_prefix )( (*current).input );
 
-   if ( height >= width )
-   {
-      column_svd( current );
-   }
-   else
-   {
-      row_svd( current );
-   }
-
-   INVARIANT( current );
-   UNLOCK( (*current).mutex );
-
-   return;
-}
-
-/**
-   column_svd
-*/
-
-static
-void
-column_svd( Svd_type( Prefix ) *current )
-{
-   int32_t i = 0;
-   int32_t j = 0;
-   int32_t k = 0;
-   int32_t n = 0;
-   Type g = DEFAULT_VALUE;
-   Magnitude_type d = 0.0;
-
-   (*current).is_column_svd = 1;
+   // decompose the columns of a tall input, the rows of a wide one
+   (*current).is_column_svd = ( height >= width ) ? 1 : 0;
    (*current).is_svd_done = 1;
+   n = ( height >= width ) ? width : height;
 
    // dispose of previous matrices, if any
    if ( (*current).matrix != NULL )
@@ -756,175 +874,154 @@ column_svd( Svd_type( Prefix ) *current )
       Matvec_dispose( Matvec_prefix )( &(*current).singular_value );
    }
 
-   // get max of input width and height
-   n = Matvec_columns( Matvec_prefix )( (*current).input );
-
-   // set up matrices
-   (*current).matrix = Matvec_copied( Matvec_prefix )( (*current).input );
-
-   (*current).rotation_matrix
-      =  Matvec_make( Matvec_prefix )
-         (
-            Matvec_columns( Matvec_prefix )( (*current).input ),
-            Matvec_columns( Matvec_prefix )( (*current).input )
-         );
-   Matvec_set_to_one( Matvec_prefix )( (*current).rotation_matrix );
+   // number of singular values to keep
+   count = n;
+   if ( ( (*current).truncation > 0 ) && ( (*current).truncation < n ) )
+   {
+      count = (*current).truncation;
+   }
 
-   (*current).singular_value
-      =  Matvec_make_column_vector( Matvec_prefix )
-         (
-            Matvec_columns( Matvec_prefix )( (*current).input )
-         );
+   // a few leading values are found in a subspace, when it is small
+   subspace_width = 2 * count + SVD_OVERSAMPLE_COUNT;
 
-   // compute svd
-   for ( k = 0; k < 2; k++ )
+   if ( ( count < n ) && ( 2 * subspace_width <= n ) )
    {
-      for ( i = 0; i < n; i++ )
-      {
-         for ( j = i + 1; j < n; j++ )
-         {
-            column_vector_rotate( current, (*current).matrix, (*current).rotation_matrix, i, j );
-         }
-      }
+      truncated_svd( current, count, subspace_width );
    }
-
-   // compute singular values
-   for ( i = 0; i < n; i++ )
+   else
    {
-      d = Matvec_column_vector_squared_magnitude( Matvec_prefix )( (*current).matrix, i );
-      d = sqrt( d );
-      SET_FROM( g, d );
-      Matvec_vector_put( Matvec_prefix )( (*current).singular_value, g, i );
-      if ( EQUAL_FUNCTION( g, DEFAULT_VALUE ) == 0 )
-      {
-         g = INVERSE_FUNCTION( g );
-      }
-      else
-      {
-         SET_FROM( g, DEFAULT_VALUE );
-      }
-      Matvec_column_vector_scale( Matvec_prefix )( (*current).matrix, g, i );
+      full_svd( current, count );
    }
 
+   INVARIANT( current );
+   UNLOCK( (*current).mutex );
+
    return;
 }
 
 /**
-   row_svd
+   vectors_rotation
+
+   rotate vectors a1 and a2 using c and s
+
+   @param a1 the first vector
+   @param a2 the second vector
+   @param length the length of the vectors
+   @param c Givens rotation cosine
+   @param s Givens rotation sine
 */
 
 static
 void
-row_svd( Svd_type( Prefix ) *current )
+vectors_rotation
+(
+   Type *a1,
+   Type *a2,
+   int32_t length,
+   Type c,
+   Type s
+)
 {
    int32_t i = 0;
-   int32_t j = 0;
-   int32_t k = 0;
-   int32_t n = 0;
-   Type g = DEFAULT_VALUE;
-   Magnitude_type d = 0.0;
-
-   (*current).is_column_svd = 0;
-   (*current).is_svd_done = 1;
+   Type x = DEFAULT_VALUE;
+   Type y = DEFAULT_VALUE;
+   Type t = DEFAULT_VALUE;
+   Type sc = NEGATE_FUNCTION( CONJUGATE_FUNCTION( s ) );
 
-   // dispose of previous matrices, if any
-   if ( (*current).matrix != NULL )
+   for( i = 0; i < length; i++ )
    {
-      Matvec_dispose( Matvec_prefix )( &(*current).matrix );
-   }
+      t = MULTIPLY_FUNCTION( s, a2[i] );
+      x = MULTIPLY_FUNCTION( c, a1[i] );
+      x = ADD_FUNCTION( x, t );
 
-   if ( (*current).rotation_matrix != NULL )
-   {
-      Matvec_dispose( Matvec_prefix )( &(*current).rotation_matrix );
-   }
+      t = MULTIPLY_FUNCTION( sc, a1[i] );
+      y = MULTIPLY_FUNCTION( c, a2[i] );
+      y = ADD_FUNCTION( t, y );
 
-   if ( (*current).singular_value != NULL )
-   {
-      Matvec_dispose( Matvec_prefix )( &(*current).singular_value );
+      a1[i] = x;
+      a2[i] = y;
    }
 
-   // get max of input width and height
-   n = Matvec_rows( Matvec_prefix )( (*current).input );
+   return;
+}
 
-   // set up matrices
-   (*current).rotation_matrix = Matvec_copied( Matvec_prefix )( (*current).input );
+/**
+   vectors_rotation_with_swap
 
-   (*current).matrix
-      =  Matvec_make( Matvec_prefix )
-         (
-            Matvec_rows( Matvec_prefix )( (*current).input ),
-            Matvec_rows( Matvec_prefix )( (*current).input )
-         );
-   Matvec_set_to_one( Matvec_prefix )( (*current).matrix );
+   rotate vectors a1 and a2 using c and s, and swap the vectors
 
-   (*current).singular_value
-      =  Matvec_make_column_vector( Matvec_prefix )
-         (
-            Matvec_rows( Matvec_prefix )( (*current).input )
-         );
+   @param a1 the first vector
+   @param a2 the second vector
+   @param length the length of the vectors
+   @param c Givens rotation cosine
+   @param s Givens rotation sine
+*/
 
-   // compute current
-   for ( k = 0; k < 2; k++ )
-   {
-      for ( i = 0; i < n; i++ )
-      {
-         for ( j = i + 1; j < n; j++ )
-         {
-            row_vector_rotate( current, (*current).rotation_matrix, (*current).matrix, i, j );
-         }
-      }
-   }
+static
+void
+vectors_rotation_with_swap
+(
+   Type *a1,
+   Type *a2,
+   int32_t length,
+   Type c,
+   Type s
+)
+{
+   int32_t i = 0;
+   Type x = DEFAULT_VALUE;
+   Type y = DEFAULT_VALUE;
+   Type t = DEFAULT_VALUE;
+   Type sc = NEGATE_FUNCTION( CONJUGATE_FUNCTION( s ) );
 
-   // compute singular values
-   for ( i = 0; i < n; i++ )
+   for( i = 0; i < length; i++ )
    {
-      d = Matvec_row_vector_squared_magnitude( Matvec_prefix )( (*current).rotation_matrix, i );
-      d = sqrt( d );
-      SET_FROM( g, d );
-      Matvec_vector_put( Matvec_prefix )( (*current).singular_value, g, i );
-      if ( EQUAL_FUNCTION( g, DEFAULT_VALUE ) == 0 )
-      {
-         g = INVERSE_FUNCTION( g );
-      }
-      else
-      {
-         SET_FROM( g, DEFAULT_VALUE );
-      }
-      Matvec_row_vector_scale( Matvec_prefix )( (*current).rotation_matrix, g, i );
+      t = MULTIPLY_FUNCTION( s, a1[i] );
+      x = MULTIPLY_FUNCTION( c, a2[i] );
+      x = ADD_FUNCTION( x, t );
+
+      t = MULTIPLY_FUNCTION( sc, a2[i] );
+      y = MULTIPLY_FUNCTION( c, a1[i] );
+      y = ADD_FUNCTION( t, y );
+
+      a1[i] = x;
+      a2[i] = y;
    }
 
    return;
 }
 
 /**
-   row_vector_rotate
+   vectors_rotate
 
-   interchange row vectors i1 and i2 in current
+   make vectors i1 and i2 of the sweep orthogonal, leaving the one with
+   the larger magnitude at i1
 
-   @param current the svd instance
-   @param a the input matrix
-   @param b the output matrix
-   @param i1 the index of the first row
-   @param i2 the index of the second row
+   @param sweep the sweep
+   @param i1 the index of the first vector
+   @param i2 the index of the second vector
+   @return 1 if the vectors were rotated, 0 otherwise
 */
 
 static
-void
-row_vector_rotate
+int32_t
+vectors_rotate
 (
-   Svd_type( Prefix ) *current,
-   Matvec_type( Matvec_prefix ) *a,
-   Matvec_type( Matvec_prefix ) *b,
+   sweep_t *sweep,
    int32_t i1,
    int32_t i2
 )
 {
-   PRECONDITION( "current not null", current != NULL );
-   PRECONDITION( "a not null", a != NULL );
-   PRECONDITION( "b not null", b != NULL );
-   PRECONDITION( "i1 OK", ( ( i1 >= 0 ) && ( i1 < Matvec_rows( Matvec_prefix )( a ) ) ) );
-   PRECONDITION( "i2 OK", ( ( i2 >= 0 ) && ( i2 < Matvec_rows( Matvec_prefix )( a ) ) ) );
+   PRECONDITION( "sweep not null", sweep != NULL );
+   PRECONDITION( "i1 OK", ( ( i1 >= 0 ) && ( i1 < (*sweep).a_count ) ) );
+   PRECONDITION( "i2 OK", ( ( i2 >= 0 ) && ( i2 < (*sweep).a_count ) ) );
 
+   int32_t result = 0;
+   int32_t i = 0;
+   Type *a1 = (*sweep).a + i1 * (*sweep).a_length;
+   Type *a2 = (*sweep).a + i2 * (*sweep).a_length;
+   Type *b1 = (*sweep).b + i1 * (*sweep).b_length;
+   Type *b2 = (*sweep).b + i2 * (*sweep).b_length;
    Magnitude_type d = 0.0;
    Type p = DEFAULT_VALUE;
    Magnitude_type q = 0.0;
@@ -935,19 +1032,26 @@ row_vector_rotate
    Type c = DEFAULT_VALUE;
    Type s = DEFAULT_VALUE;
 
-   p = Matvec_row_vector_dot( Matvec_prefix )( a, i1, i2 );
+   // dot product and squared magnitudes in one pass
+   for ( i = 0; i < (*sweep).a_length; i++ )
+   {
+      g = CONJUGATE_FUNCTION( a2[i] );
+      g = MULTIPLY_FUNCTION( a1[i], g );
+      p = ADD_FUNCTION( p, g );
+      q = q + SQUARED_MAGNITUDE_FUNCTION( a1[i] );
+      v = v + SQUARED_MAGNITUDE_FUNCTION( a2[i] );
+   }
 
-   q = Matvec_row_vector_squared_magnitude( Matvec_prefix )( a, i1 );
    SET_FROM( m1, q );
-
-   v = Matvec_row_vector_squared_magnitude( Matvec_prefix )( a, i2 );
    SET_FROM( m2, v );
 
    SET_FROM( c, ONE_VALUE );
    SET_FROM( s, DEFAULT_VALUE );
 
-   if ( SQUARED_MAGNITUDE_FUNCTION( p ) > (*current).rotation_error * ( q * q + v * v ) )
+   if ( SQUARED_MAGNITUDE_FUNCTION( p ) > (*sweep).rotation_error * q * v )
    {
+      result = 1;
+
       q = q - v;
 
       v = sqrt( 4.0 * SQUARED_MAGNITUDE_FUNCTION( p ) + q * q );
@@ -962,8 +1066,8 @@ row_vector_rotate
          g = INVERSE_FUNCTION( g );
          s = MULTIPLY_FUNCTION( p, g );
 
-         row_rotation( current, a, i1, i2, c, s );
-         row_rotation( current, b, i1, i2, c, s );
+         vectors_rotation( a1, a2, (*sweep).a_length, c, s );
+         vectors_rotation( b1, b2, (*sweep).b_length, c, s );
       }
       else
       {
@@ -976,224 +1080,356 @@ row_vector_rotate
          s = MULTIPLY_FUNCTION( p, g );
          s = CONJUGATE_FUNCTION( s );
 
-         row_rotation_with_swap( current, a, i1, i2, c, s );
-         row_rotation_with_swap( current, b, i1, i2, c, s );
+         vectors_rotation_with_swap( a1, a2, (*sweep).a_length, c, s );
+         vectors_rotation_with_swap( b1, b2, (*sweep).b_length, c, s );
       }
    }
    else
    {
       if ( m1 < m2 )
       {
-         row_rotation_with_swap( current, a, i1, i2, c, s );
-         row_rotation_with_swap( current, b, i1, i2, c, s );
+         vectors_rotation_with_swap( a1, a2, (*sweep).a_length, c, s );
+         vectors_rotation_with_swap( b1, b2, (*sweep).b_length, c, s );
       }
    }
 
-   return;
+   return result;
 }
 
 /**
-   row_rotation
+   block_job
 
-   rotate row vectors i1 and i2 in a using c and s
+   rotate every pair of vectors within one block
 
-   @param current the svd instance
-   @param a the matrix
-   @param i1 the index of the first row
-   @param i2 the index of the second row
-   @param c Givens rotation cosine
-   @param s Givens rotation sine
+   @param arg the sweep
+   @param index the block
 */
 
 static
 void
-row_rotation
-(
-   Svd_type( Prefix ) *current,
-   Matvec_type( Matvec_prefix ) *a,
-   int32_t i1,
-   int32_t i2,
-   Type c,
-   Type s
-)
+block_job( void *arg, int32_t index )
 {
-   PRECONDITION( "current not null", current != NULL );
-   PRECONDITION( "a not null", a != NULL );
-   PRECONDITION( "i1 OK", ( ( i1 >= 0 ) && ( i1 < Matvec_rows( Matvec_prefix )( a ) ) ) );
-   PRECONDITION( "i2 OK", ( ( i2 >= 0 ) && ( i2 < Matvec_rows( Matvec_prefix )( a ) ) ) );
-
+   sweep_t *sweep = ( sweep_t * ) arg;
    int32_t i = 0;
-   int32_t n = 0;
-   Type x = DEFAULT_VALUE;
-   Type y = DEFAULT_VALUE;
-   Type t = DEFAULT_VALUE;
+   int32_t j = 0;
+   int32_t start = index * SVD_BLOCK_SIZE;
+   int32_t end = start + SVD_BLOCK_SIZE;
+   int32_t count = 0;
 
-   n = Matvec_columns( Matvec_prefix )( a );
+   if ( end > (*sweep).a_count )
+   {
+      end = (*sweep).a_count;
+   }
 
-   for( i = 0; i < n; i++ )
+   for ( i = start; i < end; i++ )
    {
-      t = MULTIPLY_FUNCTION( s, Matvec_item( Matvec_prefix )( a, i2, i ) );
-      x = MULTIPLY_FUNCTION( c, Matvec_item( Matvec_prefix )( a, i1, i ) );
-      x = ADD_FUNCTION( x, t );
+      for ( j = i + 1; j < end; j++ )
+      {
+         count = count + vectors_rotate( sweep, i, j );
+      }
+   }
 
-      t = NEGATE_FUNCTION( CONJUGATE_FUNCTION( s ) );
-      t = MULTIPLY_FUNCTION( t, Matvec_item( Matvec_prefix )( a, i1, i ) );
-      y = MULTIPLY_FUNCTION( c, Matvec_item( Matvec_prefix )( a, i2, i ) );
-      y = ADD_FUNCTION( t, y );
+   (*sweep).rotation_counts[index] = (*sweep).rotation_counts[index] + count;
+
+   return;
+}
+
+/**
+   pair_job
+
+   rotate every pair of vectors with one in each block of a pair of
+   blocks. The pairs of a round come from the round robin (circle)
+   schedule, so that each block meets each other block once a sweep and
+   the blocks of a round are disjoint. With an odd block count, the pair
+   with the extra block is skipped.
 
-      Matvec_put( Matvec_prefix )( a, x, i1, i );
-      Matvec_put( Matvec_prefix )( a, y, i2, i );
+   @param arg the sweep
+   @param index the pair of blocks in the round
+*/
+
+static
+void
+pair_job( void *arg, int32_t index )
+{
+   sweep_t *sweep = ( sweep_t * ) arg;
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t m = (*sweep).pair_block_count - 1;
+   int32_t block_1 = 0;
+   int32_t block_2 = 0;
+   int32_t end_1 = 0;
+   int32_t end_2 = 0;
+   int32_t count = 0;
+
+   if ( index == 0 )
+   {
+      block_1 = (*sweep).round;
+      block_2 = m;
+   }
+   else
+   {
+      block_1 = ( (*sweep).round + index ) % m;
+      block_2 = ( (*sweep).round - index + m ) % m;
+   }
+
+   if ( block_1 > block_2 )
+   {
+      i = block_1;
+      block_1 = block_2;
+      block_2 = i;
+   }
+
+   if ( block_2 < (*sweep).block_count )
+   {
+      end_1 = ( block_1 + 1 ) * SVD_BLOCK_SIZE;
+      end_2 = ( block_2 + 1 ) * SVD_BLOCK_SIZE;
+      if ( end_2 > (*sweep).a_count )
+      {
+         end_2 = (*sweep).a_count;
+      }
+
+      for ( i = block_1 * SVD_BLOCK_SIZE; i < end_1; i++ )
+      {
+         for ( j = block_2 * SVD_BLOCK_SIZE; j < end_2; j++ )
+         {
+            count = count + vectors_rotate( sweep, i, j );
+         }
+      }
    }
 
+   (*sweep).rotation_counts[index] = (*sweep).rotation_counts[index] + count;
+
    return;
 }
 
 /**
-   row_rotation_with_swap
+   jacobi
 
-   rotate row vectors i1 and i2 in a using c and s, and swap the rows
+   make the a_count vectors in a orthogonal with one sided Jacobi
+   rotations, applying the same rotations to the vectors in b.
+
+   The vectors are taken in blocks of SVD_BLOCK_SIZE. A sweep rotates the
+   pairs within each block, then the pairs across each pair of blocks, so
+   that the vectors of a block are reused while they are in cache. The
+   blocks of each step are disjoint and are run in parallel on the pool.
+   Sweeps stop when one makes no rotation. The result does not depend on
+   the number of threads.
 
    @param current the svd instance
-   @param a the matrix
-   @param i1 the index of the first row
-   @param i2 the index of the second row
-   @param c Givens rotation cosine
-   @param s Givens rotation sine
+   @param a the vectors to make orthogonal
+   @param a_count the number of vectors
+   @param a_length the length of the a vectors
+   @param b the vectors to rotate with a
+   @param b_length the length of the b vectors
 */
 
 static
 void
-row_rotation_with_swap
+jacobi
 (
    Svd_type( Prefix ) *current,
-   Matvec_type( Matvec_prefix ) *a,
-   int32_t i1,
-   int32_t i2,
-   Type c,
-   Type s
+   Type *a,
+   int32_t a_count,
+   int32_t a_length,
+   Type *b,
+   int32_t b_length
 )
 {
-   PRECONDITION( "current not null", current != NULL );
-   PRECONDITION( "a not null", a != NULL );
-   PRECONDITION( "i1 OK", ( ( i1 >= 0 ) && ( i1 < Matvec_rows( Matvec_prefix )( a ) ) ) );
-   PRECONDITION( "i2 OK", ( ( i2 >= 0 ) && ( i2 < Matvec_rows( Matvec_prefix )( a ) ) ) );
-
    int32_t i = 0;
-   int32_t n = 0;
-   Type x = DEFAULT_VALUE;
-   Type y = DEFAULT_VALUE;
-   Type t = DEFAULT_VALUE;
-
-   n = Matvec_columns( Matvec_prefix )( a );
-
-   for( i = 0; i < n; i++ )
+   int32_t k = 0;
+   int32_t rotation_count = 1;
+   sweep_t sweep;
+
+   sweep.rotation_error = (*current).rotation_error;
+   sweep.a = a;
+   sweep.a_count = a_count;
+   sweep.a_length = a_length;
+   sweep.b = b;
+   sweep.b_length = b_length;
+   sweep.block_count = ( a_count + SVD_BLOCK_SIZE - 1 ) / SVD_BLOCK_SIZE;
+   sweep.pair_block_count = sweep.block_count + ( sweep.block_count % 2 );
+   sweep.round = 0;
+   sweep.rotation_counts = ( int32_t * ) calloc( sweep.block_count, sizeof( int32_t ) );
+   CHECK( "sweep.rotation_counts allocated correctly", sweep.rotation_counts != NULL );
+
+   for ( k = 0; ( k < SVD_MAX_SWEEP_COUNT ) && ( rotation_count > 0 ); k++ )
    {
-      t = MULTIPLY_FUNCTION( s, Matvec_item( Matvec_prefix )( a, i1, i ) );
-      x = MULTIPLY_FUNCTION( c, Matvec_item( Matvec_prefix )( a, i2, i ) );
-      x = ADD_FUNCTION( x, t );
+      memset( sweep.rotation_counts, 0, sweep.block_count * sizeof( int32_t ) );
 
-      t = NEGATE_FUNCTION( CONJUGATE_FUNCTION( s ) );
-      t = MULTIPLY_FUNCTION( t, Matvec_item( Matvec_prefix )( a, i2, i ) );
-      y = MULTIPLY_FUNCTION( c, Matvec_item( Matvec_prefix )( a, i1, i ) );
-      y = ADD_FUNCTION( t, y );
+      // pairs within blocks
+      pool_run( &(*current).pool, block_job, &sweep, sweep.block_count );
+
+      // pairs across blocks
+      for ( i = 0; i < sweep.pair_block_count - 1; i++ )
+      {
+         sweep.round = i;
+         pool_run( &(*current).pool, pair_job, &sweep, sweep.pair_block_count / 2 );
+      }
 
-      Matvec_put( Matvec_prefix )( a, x, i1, i );
-      Matvec_put( Matvec_prefix )( a, y, i2, i );
+      rotation_count = 0;
+      for ( i = 0; i < sweep.block_count; i++ )
+      {
+         rotation_count = rotation_count + sweep.rotation_counts[i];
+      }
    }
 
+   free( sweep.rotation_counts );
+
    return;
 }
 
 /**
-   column_vector_rotate
+   sort_by_magnitude
 
-   interchange colums vectors i1 and i2 in current
+   put the indices of the a_count vectors in a in order of decreasing
+   magnitude, keeping the order of equal magnitudes
 
-   @param current the svd instance
-   @param a the input matrix
-   @param b the output matrix
-   @param i1 the index of the first column
-   @param i2 the index of the second column
+   @param a the vectors
+   @param a_count the number of vectors
+   @param a_length the length of the vectors
+   @param order the indices of the vectors, in order
+   @param magnitude the magnitudes of the vectors
 */
 
 static
 void
-column_vector_rotate
+sort_by_magnitude
 (
-   Svd_type( Prefix ) *current,
-   Matvec_type( Matvec_prefix ) *a,
-   Matvec_type( Matvec_prefix ) *b,
-   int32_t i1,
-   int32_t i2
+   Type *a,
+   int32_t a_count,
+   int32_t a_length,
+   int32_t *order,
+   Magnitude_type *magnitude
 )
 {
-   PRECONDITION( "current not null", current != NULL );
-   PRECONDITION( "a not null", a != NULL );
-   PRECONDITION( "b not null", b != NULL );
-   PRECONDITION( "i1 OK", ( ( i1 >= 0 ) && ( i1 < Matvec_columns( Matvec_prefix )( a ) ) ) );
-   PRECONDITION( "i2 OK", ( ( i2 >= 0 ) && ( i2 < Matvec_columns( Matvec_prefix )( a ) ) ) );
-
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
    Magnitude_type d = 0.0;
-   Type p = DEFAULT_VALUE;
-   Magnitude_type q = 0.0;
-   Magnitude_type v = 0.0;
-   Magnitude_type m1 = 0.0;
-   Magnitude_type m2 = 0.0;
-   Type g = DEFAULT_VALUE;
-   Type c = DEFAULT_VALUE;
-   Type s = DEFAULT_VALUE;
 
-   p = Matvec_column_vector_dot( Matvec_prefix )( a, i1, i2 );
+   for ( i = 0; i < a_count; i++ )
+   {
+      d = 0.0;
+      for ( j = 0; j < a_length; j++ )
+      {
+         d = d + SQUARED_MAGNITUDE_FUNCTION( a[ i * a_length + j ] );
+      }
+      magnitude[i] = sqrt( d );
+   }
 
-   q = Matvec_column_vector_squared_magnitude( Matvec_prefix )( a, i1 );
-   SET_FROM( m1, q );
+   // insertion sort, the sweeps leave the vectors nearly in order
+   for ( i = 0; i < a_count; i++ )
+   {
+      k = i;
+      for ( j = i - 1; ( j >= 0 ) && ( magnitude[ order[j] ] < magnitude[i] ); j-- )
+      {
+         order[j + 1] = order[j];
+         k = j;
+      }
+      order[k] = i;
+   }
 
-   v = Matvec_column_vector_squared_magnitude( Matvec_prefix )( a, i2 );
-   SET_FROM( m2, v );
+   return;
+}
 
-   SET_FROM( c, ONE_VALUE );
-   SET_FROM( s, DEFAULT_VALUE );
+/**
+   put_result
 
-   if ( SQUARED_MAGNITUDE_FUNCTION( p ) > (*current).rotation_error * ( q * q + v * v ) )
+   set the singular values and vectors of current from the first count
+   vectors in order. The a vectors are the left (for a column svd) or
+   right (for a row svd) singular vectors, scaled by the singular values.
+   The b vectors are the other singular vectors.
+
+   @param current the svd instance
+   @param a the scaled singular vectors
+   @param a_length the length of the a vectors
+   @param b the other singular vectors
+   @param b_length the length of the b vectors
+   @param order the indices of the vectors, in order
+   @param magnitude the magnitudes of the a vectors
+   @param count the number of singular values
+*/
+
+static
+void
+put_result
+(
+   Svd_type( Prefix ) *current,
+   Type *a,
+   int32_t a_length,
+   Type *b,
+   int32_t b_length,
+   int32_t *order,
+   Magnitude_type *magnitude,
+   int32_t count
+)
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+   Type g = DEFAULT_VALUE;
+   Type *pa = NULL;
+   Type *pb = NULL;
+
+   (*current).singular_value = Matvec_make_column_vector( Matvec_prefix )( count );
+
+   if ( (*current).is_column_svd == 1 )
    {
-      q = q - v;
+      (*current).matrix = Matvec_make( Matvec_prefix )( a_length, count );
+      (*current).rotation_matrix = Matvec_make( Matvec_prefix )( b_length, count );
+   }
+   else
+   {
+      (*current).rotation_matrix = Matvec_make( Matvec_prefix )( count, a_length );
+      (*current).matrix = Matvec_make( Matvec_prefix )( count, b_length );
+   }
 
-      v = sqrt( 4.0 * SQUARED_MAGNITUDE_FUNCTION( p ) + q * q );
+   for ( i = 0; i < count; i++ )
+   {
+      k = order[i];
 
-      if ( q >= 0.0 )
+      SET_FROM( g, magnitude[k] );
+      Matvec_vector_put( Matvec_prefix )( (*current).singular_value, g, i );
+      if ( EQUAL_FUNCTION( g, DEFAULT_VALUE ) == 0 )
       {
-         d = sqrt( ( v + q ) / ( 2.0 * v ) );
-         SET_FROM( c, d );
-
-         d = v * d;
-         SET_FROM( g, d );
          g = INVERSE_FUNCTION( g );
-         s = MULTIPLY_FUNCTION( p, g );
-
-         column_rotation( current, a, i1, i2, c, s );
-         column_rotation( current, b, i1, i2, c, s );
       }
       else
       {
-         d = sqrt( ( v - q ) / ( 2.0 * v ) );
-         SET_FROM( c, d );
+         SET_FROM( g, DEFAULT_VALUE );
+      }
 
-         d = v * d;
-         SET_FROM( g, d );
-         g = INVERSE_FUNCTION( g );
-         s = MULTIPLY_FUNCTION( p, g );
-         s = CONJUGATE_FUNCTION( s );
+      if ( (*current).is_column_svd == 1 )
+      {
+         // vectors are the columns of the results
+         pa = Matvec_as_array( Matvec_prefix )( (*current).matrix );
+         pb = Matvec_as_array( Matvec_prefix )( (*current).rotation_matrix );
+
+         for ( j = 0; j < a_length; j++ )
+         {
+            pa[ j * count + i ] = MULTIPLY_FUNCTION( a[ k * a_length + j ], g );
+         }
 
-         column_rotation_with_swap( current, a, i1, i2, c, s );
-         column_rotation_with_swap( current, b, i1, i2, c, s );
+         for ( j = 0; j < b_length; j++ )
+         {
+            pb[ j * count + i ] = b[ k * b_length + j ];
+         }
       }
-   }
-   else
-   {
-      if ( m1 < m2 )
+      else
       {
-         column_rotation_with_swap( current, a, i1, i2, c, s );
-         column_rotation_with_swap( current, b, i1, i2, c, s );
+         // vectors are the rows of the results
+         pa = Matvec_as_array( Matvec_prefix )( (*current).rotation_matrix );
+         pb = Matvec_as_array( Matvec_prefix )( (*current).matrix );
+
+         for ( j = 0; j < a_length; j++ )
+         {
+            pa[ i * a_length + j ] = MULTIPLY_FUNCTION( a[ k * a_length + j ], g );
+         }
+
+         for ( j = 0; j < b_length; j++ )
+         {
+            pb[ i * b_length + j ] = b[ k * b_length + j ];
+         }
       }
    }
 
@@ -1201,114 +1437,317 @@ column_vector_rotate
 }
 
 /**
-   column_rotation
+   full_svd
 
-   rotate column vectors i1 and i2 in a using c and s
+   decompose the input with one sided Jacobi rotations of its columns (a
+   column svd) or its rows (a row svd), keeping the leading count
+   singular values
 
    @param current the svd instance
-   @param a the matrix
-   @param i1 the index of the first column
-   @param i2 the index of the second column
-   @param c Givens rotation cosine
-   @param s Givens rotation sine
+   @param count the number of singular values kept
 */
 
 static
 void
-column_rotation
-(
-   Svd_type( Prefix ) *current,
-   Matvec_type( Matvec_prefix ) *a,
-   int32_t i1,
-   int32_t i2,
-   Type c,
-   Type s
-)
+full_svd( Svd_type( Prefix ) *current, int32_t count )
 {
-   PRECONDITION( "current not null", current != NULL );
-   PRECONDITION( "a not null", a != NULL );
-   PRECONDITION( "i1 OK", ( ( i1 >= 0 ) && ( i1 < Matvec_columns( Matvec_prefix )( a ) ) ) );
-   PRECONDITION( "i2 OK", ( ( i2 >= 0 ) && ( i2 < Matvec_columns( Matvec_prefix )( a ) ) ) );
-
-   int32_t i = 0;
    int32_t n = 0;
-   Type x = DEFAULT_VALUE;
-   Type y = DEFAULT_VALUE;
-   Type t = DEFAULT_VALUE;
+   int32_t length = 0;
+   Matvec_type( Matvec_prefix ) *a = NULL;
+   Matvec_type( Matvec_prefix ) *b = NULL;
+   int32_t *order = NULL;
+   Magnitude_type *magnitude = NULL;
+
+   // the vectors to make orthogonal are the rows of a
+   if ( (*current).is_column_svd == 1 )
+   {
+      a = Matvec_transposed( Matvec_prefix )( (*current).input );
+   }
+   else
+   {
+      a = Matvec_copied( Matvec_prefix )( (*current).input );
+   }
 
    n = Matvec_rows( Matvec_prefix )( a );
+   length = Matvec_columns( Matvec_prefix )( a );
+
+   b = Matvec_make( Matvec_prefix )( n, n );
+   Matvec_set_to_one( Matvec_prefix )( b );
+
+   jacobi
+   (
+      current,
+      Matvec_as_array( Matvec_prefix )( a ),
+      n,
+      length,
+      Matvec_as_array( Matvec_prefix )( b ),
+      n
+   );
+
+   order = ( int32_t * ) calloc( n, sizeof( int32_t ) );
+   CHECK( "order allocated correctly", order != NULL );
+   magnitude = ( Magnitude_type * ) calloc( n, sizeof( Magnitude_type ) );
+   CHECK( "magnitude allocated correctly", magnitude != NULL );
+
+   sort_by_magnitude( Matvec_as_array( Matvec_prefix )( a ), n, length, order, magnitude );
+
+   put_result
+   (
+      current,
+      Matvec_as_array( Matvec_prefix )( a ),
+      length,
+      Matvec_as_array( Matvec_prefix )( b ),
+      n,
+      order,
+      magnitude,
+      count
+   );
+
+   free( order );
+   free( magnitude );
+   Matvec_dispose( Matvec_prefix )( &a );
+   Matvec_dispose( Matvec_prefix )( &b );
+
+   return;
+}
+
+/**
+   orthonormalize
+
+   make the count vectors in a orthonormal with modified Gram-Schmidt,
+   applied twice. A vector in the span of the ones before it is left zero.
+
+   @param a the vectors
+   @param count the number of vectors
+   @param length the length of the vectors
+*/
+
+static
+void
+orthonormalize( Type *a, int32_t count, int32_t length )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+   int32_t pass = 0;
+   Type *a1 = NULL;
+   Type *a2 = NULL;
+   Type g = DEFAULT_VALUE;
+   Type r = DEFAULT_VALUE;
+   Magnitude_type d = 0.0;
 
-   for( i = 0; i < n; i++ )
+   for ( i = 0; i < count; i++ )
    {
-      t = MULTIPLY_FUNCTION( s, Matvec_item( Matvec_prefix )( a, i, i2 ) );
-      x = MULTIPLY_FUNCTION( c, Matvec_item( Matvec_prefix )( a, i, i1 ) );
-      x = ADD_FUNCTION( x, t );
+      a1 = a + i * length;
 
-      t = NEGATE_FUNCTION( CONJUGATE_FUNCTION( s ) );
-      t = MULTIPLY_FUNCTION( t, Matvec_item( Matvec_prefix )( a, i, i1 ) );
-      y = MULTIPLY_FUNCTION( c, Matvec_item( Matvec_prefix )( a, i, i2 ) );
-      y = ADD_FUNCTION( t, y );
+      for ( pass = 0; pass < 2; pass++ )
+      {
+         for ( j = 0; j < i; j++ )
+         {
+            a2 = a + j * length;
+
+            SET_FROM( r, DEFAULT_VALUE );
+            for ( k = 0; k < length; k++ )
+            {
+               g = CONJUGATE_FUNCTION( a2[k] );
+               g = MULTIPLY_FUNCTION( a1[k], g );
+               r = ADD_FUNCTION( r, g );
+            }
+
+            r = NEGATE_FUNCTION( r );
+            for ( k = 0; k < length; k++ )
+            {
+               g = MULTIPLY_FUNCTION( r, a2[k] );
+               a1[k] = ADD_FUNCTION( a1[k], g );
+            }
+         }
+      }
+
+      d = 0.0;
+      for ( k = 0; k < length; k++ )
+      {
+         d = d + SQUARED_MAGNITUDE_FUNCTION( a1[k] );
+      }
+      d = sqrt( d );
+
+      SET_FROM( g, d );
+      if ( EQUAL_FUNCTION( g, DEFAULT_VALUE ) == 0 )
+      {
+         g = INVERSE_FUNCTION( g );
+      }
 
-      Matvec_put( Matvec_prefix )( a, x, i, i1 );
-      Matvec_put( Matvec_prefix )( a, y, i, i2 );
+      for ( k = 0; k < length; k++ )
+      {
+         a1[k] = MULTIPLY_FUNCTION( a1[k], g );
+      }
    }
 
    return;
 }
 
 /**
-   column_rotation_with_swap
+   truncated_svd
+
+   compute the leading count singular values and vectors by subspace
+   iteration.
 
-   rotate column vectors i1 and i2 in a using c and s, and swap the column
+   Let T be the input for a column svd and its transpose for a row svd,
+   so that T has at least as many rows as columns. The rows of p span a
+   subspace of the rows of T^H T. Each iteration makes the rows of
+   p T^T orthogonal with Jacobi rotations, which gives the singular
+   values and vectors of T in that subspace, then replaces p with the
+   orthonormalized products of the left singular vectors and conj( T ).
+   Iteration stops when the leading singular values change by no more
+   than the rotation error, relative to their size.
 
    @param current the svd instance
-   @param a the matrix
-   @param i1 the index of the first column
-   @param i2 the index of the second column
-   @param c Givens rotation cosine
-   @param s Givens rotation sine
+   @param count the number of singular values kept
+   @param width the number of vectors in the subspace
 */
 
 static
 void
-column_rotation_with_swap
-(
-   Svd_type( Prefix ) *svd,
-   Matvec_type( Matvec_prefix ) *a,
-   int32_t i1,
-   int32_t i2,
-   Type c,
-   Type s
-)
+truncated_svd( Svd_type( Prefix ) *current, int32_t count, int32_t width )
 {
-   PRECONDITION( "svd not null", svd != NULL );
-   PRECONDITION( "a not null", a != NULL );
-   PRECONDITION( "i1 OK", ( ( i1 >= 0 ) && ( i1 < Matvec_columns( Matvec_prefix )( a ) ) ) );
-   PRECONDITION( "i2 OK", ( ( i2 >= 0 ) && ( i2 < Matvec_columns( Matvec_prefix )( a ) ) ) );
-
    int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
    int32_t n = 0;
-   Type x = DEFAULT_VALUE;
-   Type y = DEFAULT_VALUE;
-   Type t = DEFAULT_VALUE;
+   int32_t length = 0;
+   int32_t is_converged = 0;
+   uint32_t seed = 12345u;
+   Magnitude_type d = 0.0;
+   Type g = DEFAULT_VALUE;
+   Matvec_type( Matvec_prefix ) *t_transposed = NULL;
+   Matvec_type( Matvec_prefix ) *t_conjugated = NULL;
+   Matvec_type( Matvec_prefix ) *p = NULL;
+   Matvec_type( Matvec_prefix ) *w = NULL;
+   Matvec_type( Matvec_prefix ) *y = NULL;
+   Matvec_type( Matvec_prefix ) *z = NULL;
+   Type *pa = NULL;
+   int32_t *order = NULL;
+   Magnitude_type *magnitude = NULL;
+   Magnitude_type *previous = NULL;
 
-   n = Matvec_rows( Matvec_prefix )( a );
+   if ( (*current).is_column_svd == 1 )
+   {
+      t_transposed = Matvec_transposed( Matvec_prefix )( (*current).input );
+      t_conjugated = Matvec_conjugated( Matvec_prefix )( (*current).input );
+   }
+   else
+   {
+      t_transposed = Matvec_copied( Matvec_prefix )( (*current).input );
+      t_conjugated = Matvec_hermitian_transposed( Matvec_prefix )( (*current).input );
+   }
+
+   n = Matvec_rows( Matvec_prefix )( t_transposed );
+   length = Matvec_columns( Matvec_prefix )( t_transposed );
+
+   order = ( int32_t * ) calloc( width, sizeof( int32_t ) );
+   CHECK( "order allocated correctly", order != NULL );
+   magnitude = ( Magnitude_type * ) calloc( width, sizeof( Magnitude_type ) );
+   CHECK( "magnitude allocated correctly", magnitude != NULL );
+   previous = ( Magnitude_type * ) calloc( count, sizeof( Magnitude_type ) );
+   CHECK( "previous allocated correctly", previous != NULL );
 
-   for( i = 0; i < n; i++ )
+   // start from pseudo random vectors
+   p = Matvec_make( Matvec_prefix )( width, n );
+   pa = Matvec_as_array( Matvec_prefix )( p );
+   for ( i = 0; i < width * n; i++ )
    {
-      t = MULTIPLY_FUNCTION( s, Matvec_item( Matvec_prefix )( a, i, i1 ) );
-      x = MULTIPLY_FUNCTION( c, Matvec_item( Matvec_prefix )( a, i, i2 ) );
-      x = ADD_FUNCTION( x, t );
+      seed = seed * 1664525u + 1013904223u;
+      d = ( Magnitude_type ) ( seed >> 8 ) / 8388608.0 - 1.0;
+      SET_FROM( pa[i], d );
+   }
+   orthonormalize( pa, width, n );
 
-      t = NEGATE_FUNCTION( CONJUGATE_FUNCTION( s ) );
-      t = MULTIPLY_FUNCTION( t, Matvec_item( Matvec_prefix )( a, i, i2 ) );
-      y = MULTIPLY_FUNCTION( c, Matvec_item( Matvec_prefix )( a, i, i1 ) );
-      y = ADD_FUNCTION( t, y );
+   w = Matvec_make( Matvec_prefix )( width, width );
+
+   for ( k = 0; ( k < SVD_MAX_ITERATION_COUNT ) && ( is_converged == 0 ); k++ )
+   {
+      if ( y != NULL )
+      {
+         Matvec_dispose( Matvec_prefix )( &y );
+      }
+
+      // singular values and vectors of T in the subspace
+      y = Matvec_multiplied( Matvec_prefix )( p, t_transposed );
+      Matvec_set_to_one( Matvec_prefix )( w );
+
+      jacobi
+      (
+         current,
+         Matvec_as_array( Matvec_prefix )( y ),
+         width,
+         length,
+         Matvec_as_array( Matvec_prefix )( w ),
+         width
+      );
+
+      sort_by_magnitude( Matvec_as_array( Matvec_prefix )( y ), width, length, order, magnitude );
+
+      is_converged = 1;
+      for ( i = 0; i < count; i++ )
+      {
+         d = magnitude[ order[i] ];
+         if ( fabs( d - previous[i] ) > (*current).rotation_error * d )
+         {
+            is_converged = 0;
+         }
+         previous[i] = d;
+      }
+
+      if ( ( is_converged == 0 ) && ( k < SVD_MAX_ITERATION_COUNT - 1 ) )
+      {
+         // next subspace from the left singular vectors
+         pa = Matvec_as_array( Matvec_prefix )( y );
+         for ( i = 0; i < width; i++ )
+         {
+            SET_FROM( g, magnitude[i] );
+            if ( EQUAL_FUNCTION( g, DEFAULT_VALUE ) == 0 )
+            {
+               g = INVERSE_FUNCTION( g );
+            }
+
+            for ( j = 0; j < length; j++ )
+            {
+               pa[ i * length + j ] = MULTIPLY_FUNCTION( pa[ i * length + j ], g );
+            }
+         }
+
+         z = Matvec_multiplied( Matvec_prefix )( y, t_conjugated );
+         orthonormalize( Matvec_as_array( Matvec_prefix )( z ), width, n );
 
-      Matvec_put( Matvec_prefix )( a, x, i, i1 );
-      Matvec_put( Matvec_prefix )( a, y, i, i2 );
+         Matvec_dispose( Matvec_prefix )( &p );
+         p = z;
+      }
    }
 
+   // right singular vectors in the subspace
+   z = Matvec_multiplied( Matvec_prefix )( w, p );
+
+   put_result
+   (
+      current,
+      Matvec_as_array( Matvec_prefix )( y ),
+      length,
+      Matvec_as_array( Matvec_prefix )( z ),
+      n,
+      order,
+      magnitude,
+      count
+   );
+
+   free( order );
+   free( magnitude );
+   free( previous );
+   Matvec_dispose( Matvec_prefix )( &t_transposed );
+   Matvec_dispose( Matvec_prefix )( &t_conjugated );
+   Matvec_dispose( Matvec_prefix )( &p );
+   Matvec_dispose( Matvec_prefix )( &w );
+   Matvec_dispose( Matvec_prefix )( &y );
+   Matvec_dispose( Matvec_prefix )( &z );
+
    return;
 }
 
@@ -165,6 +165,29 @@ Matvec_type( Matvec_prefix ) * Svd_left_singular_vectors( Prefix )( Svd_type( Pr
 #define Svd_right_singular_vectors( arg ) PRIMITIVE_CAT( arg, _svd_right_singular_vectors )
 Matvec_type( Matvec_prefix ) * Svd_right_singular_vectors( Prefix )( Svd_type( Prefix ) *svd );
 
+/**
+   Svd_truncation
+
+   Return the number of leading singular values Svd_svd computes, 0 for
+   all of them.
+
+   @param  svd Svd_t instance
+   @return the truncation
+*/
+#define Svd_truncation( arg ) PRIMITIVE_CAT( arg, _svd_truncation )
+int32_t Svd_truncation( Prefix )( Svd_type( Prefix ) *svd );
+
+/**
+   Svd_thread_count
+
+   Return the number of threads Svd_svd runs its sweeps on.
+
+   @param  svd Svd_t instance
+   @return the thread count
+*/
+#define Svd_thread_count( arg ) PRIMITIVE_CAT( arg, _svd_thread_count )
+int32_t Svd_thread_count( Prefix )( Svd_type( Prefix ) *svd );
+
 
 /*
    Measurement
@@ -218,6 +241,34 @@ void Svd_set_rotation_error( Prefix )( Svd_type( Prefix ) *svd, Magnitude_type r
 #define Svd_set_singular_value_threshold( arg ) PRIMITIVE_CAT( arg, _svd_set_singular_value_threshold )
 void Svd_set_singular_value_threshold( Prefix )( Svd_type( Prefix ) *svd, Magnitude_type singular_value_threshold );
 
+/**
+   Svd_set_truncation
+
+   Set the number of leading singular values for Svd_svd to compute, 0
+   for all of them. With a truncation, the singular values vector and the
+   singular vector matrices hold only the leading count values and
+   vectors. A truncation small against the smaller dimension of the input
+   is computed by subspace iteration, without a full decomposition.
+
+   @param  svd Svd_t instance
+   @param  truncation the number of leading singular values, 0 for all
+*/
+#define Svd_set_truncation( arg ) PRIMITIVE_CAT( arg, _svd_set_truncation )
+void Svd_set_truncation( Prefix )( Svd_type( Prefix ) *svd, int32_t truncation );
+
+/**
+   Svd_set_thread_count
+
+   Set the number of threads Svd_svd runs its sweeps on, starting or
+   stopping worker threads as needed. The default is one, which starts no
+   threads. The result does not depend on the thread count.
+
+   @param  svd Svd_t instance
+   @param  thread_count the number of threads
+*/
+#define Svd_set_thread_count( arg ) PRIMITIVE_CAT( arg, _svd_set_thread_count )
+void Svd_set_thread_count( Prefix )( Svd_type( Prefix ) *svd, int32_t thread_count );
+
 /*
    Transformation
 */
@@ -236,7 +287,10 @@ Matvec_type( Matvec_prefix ) * Svd_inverse( Prefix )( Svd_type( Prefix ) *svd );
 /**
    Svd_svd
 
-   Perform the singular value decomposition
+   Perform the singular value decomposition. The vectors of the smaller
+   dimension of the input are made orthogonal by one sided Jacobi
+   rotations, in blocks, until no pair needs a rotation. The singular
+   values are in decreasing order.
 
    @param  svd Svd_t instance
 */
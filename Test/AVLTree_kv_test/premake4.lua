@@ -11,9 +11,9 @@ solution( name )
    project( name )
       kind "ConsoleApp"
       language "C"
-      files { "src/*.c", "../../Protocol_Base/*.c", "../../String/*.c" }
+      files { "src/*.c", "../../Protocol_Base/*.c", "../../String/*.c", "../../Rng_Isaac/Rng_Isaac.c" }
       links { "cunit", "m", "rt", "gc", "gcov", "pthread" }
-      includedirs { "src", "../../base", "../../dbc", "../../AVLTree_kv", "../../Protocol_Base", "../../P_Indexable", "../../P_Iterable", "../../P_Iterable_kv", "../../P_DIterable", "../../P_DIterable_kv", "../../P_Basic", "../../P_Searcher", "../../P_Sorter", "../../String"  }
+      includedirs { "src", "../../base", "../../dbc", "../../Rng_Isaac", "../../AVLTree_kv", "../../Protocol_Base", "../../P_Indexable", "../../P_Iterable", "../../P_Iterable_kv", "../../P_DIterable", "../../P_DIterable_kv", "../../P_Basic", "../../P_Searcher", "../../P_Sorter", "../../String"  }
 
       -- A configuration defines one way a project can be built
       configuration "Debug"
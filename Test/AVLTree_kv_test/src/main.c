@@ -178,6 +178,12 @@ add_test_occurrences_value( void );
 int
 add_test_occurrences_value_eq_fn( void );
 
+int
+add_test_rank( void );
+
+int
+add_test_count_in_range( void );
+
 int
 add_test_item( void );
 
@@ -380,6 +386,8 @@ int main()
    add_test_occurrences_eq_fn();
    add_test_occurrences_value();
    add_test_occurrences_value_eq_fn();
+   add_test_rank();
+   add_test_count_in_range();
    add_test_item();
    add_test_key();
    add_test_cursor_make();
@@ -70,6 +70,12 @@ add_test_occurrences( void );
 int
 add_test_occurrences_eq_fn( void );
 
+int
+add_test_rank( void );
+
+int
+add_test_count_in_range( void );
+
 int
 add_test_count( void );
 
@@ -293,6 +299,8 @@ int main()
    add_test_has_eq_fn();
    add_test_occurrences();
    add_test_occurrences_eq_fn();
+   add_test_rank();
+   add_test_count_in_range();
    add_test_remove();
    add_test_remove_and_dispose();
    add_test_remove_at();
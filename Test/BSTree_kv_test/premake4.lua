@@ -11,9 +11,9 @@ solution( name )
    project( name )
       kind "ConsoleApp"
       language "C"
-      files { "../../base/*.c", "src/*.c", "../../Protocol_Base/*.c", "../../String/*.c", "../../Common/P_Basic/*.c", "../../Common/P_Iterable_kv/*.c", "../../Common/P_DIterable_kv/*.c" }
+      files { "../../base/*.c", "src/*.c", "../../Protocol_Base/*.c", "../../String/*.c", "../../Common/P_Basic/*.c", "../../Common/P_Iterable_kv/*.c", "../../Common/P_DIterable_kv/*.c", "../../Rng_Isaac/Rng_Isaac.c" }
       links { "cunit", "m", "rt", "gc", "gcov", "pthread" }
-      includedirs { "src", "../../base", "../../dbc", "../../BSTree_kv", "../../Protocol_Base", "../../P_Indexable", "../../P_Iterable", "../../P_Iterable_kv", "../../P_DIterable", "../../P_DIterable_kv", "../../P_Basic", "../../P_Searcher", "../../P_Sorter", "../../String", "../../Common/P_Basic", "../../Common/P_Iterable_kv", "../../Common/P_DIterable_kv"  }
+      includedirs { "src", "../../base", "../../dbc", "../../Rng_Isaac", "../../BSTree_kv", "../../Protocol_Base", "../../P_Indexable", "../../P_Iterable", "../../P_Iterable_kv", "../../P_DIterable", "../../P_DIterable_kv", "../../P_Basic", "../../P_Searcher", "../../P_Sorter", "../../String", "../../Common/P_Basic", "../../Common/P_Iterable_kv", "../../Common/P_DIterable_kv"  }
 
       -- A configuration defines one way a project can be built
       configuration "Debug"
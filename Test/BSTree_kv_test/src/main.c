@@ -202,6 +202,12 @@ add_test_occurrences_value( void );
 int
 add_test_occurrences_value_eq_fn( void );
 
+int
+add_test_rank( void );
+
+int
+add_test_count_in_range( void );
+
 int
 add_test_off( void );
 
@@ -405,6 +411,8 @@ int main()
    add_test_off();
    add_test_occurrences_value();
    add_test_occurrences_value_eq_fn();
+   add_test_rank();
+   add_test_count_in_range();
    add_test_remove();
    add_test_remove_and_dispose();
    add_test_remove_by_index();
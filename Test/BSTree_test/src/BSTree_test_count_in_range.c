@@ -0,0 +1,115 @@
+/**
+ @file BSTree_test_count_in_range.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for BSTree_count_in_range"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for BSTree_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "i_BSTree.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_count_in_range_1
+*/
+
+void test_count_in_range_1( void )
+{
+   i_bstree_t *tree = NULL;
+   int32_t i = 0;
+
+   tree = i_bstree_make();
+
+   CU_ASSERT( i_bstree_count_in_range( tree, 0, 10 ) == 0 );
+
+   for ( i = 10; i >= 1; i-- )
+   {
+      i_bstree_put( tree, i );
+   }
+
+   CU_ASSERT( i_bstree_count_in_range( tree, 3, 7 ) == 5 );
+   CU_ASSERT( i_bstree_count_in_range( tree, 0, 100 ) == 10 );
+   CU_ASSERT( i_bstree_count_in_range( tree, 5, 5 ) == 1 );
+   CU_ASSERT( i_bstree_count_in_range( tree, 7, 3 ) == 0 );
+   CU_ASSERT( i_bstree_count_in_range( tree, 11, 20 ) == 0 );
+
+   i_bstree_dispose( &tree );
+
+   return;
+}
+
+/**
+   test_count_in_range_2
+*/
+
+void test_count_in_range_2( void )
+{
+   i_bstree_t *tree = NULL;
+
+   tree = i_bstree_make();
+
+   i_bstree_put( tree, 2 );
+   i_bstree_put( tree, 4 );
+   i_bstree_put( tree, 2 );
+   i_bstree_put( tree, 2 );
+
+   CU_ASSERT( i_bstree_count_in_range( tree, 2, 2 ) == 3 );
+   CU_ASSERT( i_bstree_count_in_range( tree, 3, 4 ) == 1 );
+   CU_ASSERT( i_bstree_count_in_range( tree, 1, 4 ) == 4 );
+
+   i_bstree_dispose( &tree );
+
+   return;
+}
+
+int
+add_test_count_in_range( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_count_in_range", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_count_in_range_1
+   add_test_to_suite( p_suite, test_count_in_range_1, "test_count_in_range_1" );
+
+   // test_count_in_range_2
+   add_test_to_suite( p_suite, test_count_in_range_2, "test_count_in_range_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
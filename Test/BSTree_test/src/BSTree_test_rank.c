@@ -0,0 +1,157 @@
+/**
+ @file BSTree_test_rank.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for BSTree_rank"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for BSTree_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "i_BSTree.h"
+#include "Rng_Isaac.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_rank_1
+*/
+
+void test_rank_1( void )
+{
+   i_bstree_t *tree = NULL;
+
+   tree = i_bstree_make();
+
+   CU_ASSERT( i_bstree_rank( tree, 5 ) == 0 );
+
+   i_bstree_dispose( &tree );
+
+   return;
+}
+
+/**
+   test_rank_2
+*/
+
+void test_rank_2( void )
+{
+   i_bstree_t *tree = NULL;
+
+   tree = i_bstree_make();
+
+   i_bstree_put( tree, 20 );
+   i_bstree_put( tree, 30 );
+   i_bstree_put( tree, 10 );
+   i_bstree_put( tree, 20 );
+
+   CU_ASSERT( i_bstree_rank( tree, 5 ) == 0 );
+   CU_ASSERT( i_bstree_rank( tree, 10 ) == 0 );
+   CU_ASSERT( i_bstree_rank( tree, 15 ) == 1 );
+   CU_ASSERT( i_bstree_rank( tree, 20 ) == 1 );
+   CU_ASSERT( i_bstree_rank( tree, 25 ) == 3 );
+   CU_ASSERT( i_bstree_rank( tree, 30 ) == 3 );
+   CU_ASSERT( i_bstree_rank( tree, 35 ) == 4 );
+
+   i_bstree_dispose( &tree );
+
+   return;
+}
+
+/**
+   test_rank_3
+*/
+
+void test_rank_3( void )
+{
+   i_bstree_t *tree = NULL;
+   int32_t i = 0;
+   int32_t v = 0;
+   rng_isaac_t *rng = NULL;
+
+   tree = i_bstree_make();
+   rng = rng_isaac_make_with_seed( 12345 );
+
+   // many puts and removes, then check index, rank and item agree
+   for ( i = 0; i < 2000; i++ )
+   {
+      v = ( int32_t ) ( rng_isaac_u32_item( rng ) % 500 );
+      rng_isaac_forth( rng );
+      i_bstree_put( tree, v );
+   }
+
+   for ( i = 0; i < 700; i++ )
+   {
+      i_bstree_remove( tree, ( int32_t ) ( rng_isaac_u32_item( rng ) % i_bstree_count( tree ) ) );
+      rng_isaac_forth( rng );
+   }
+
+   CU_ASSERT( i_bstree_count( tree ) == 1300 );
+
+   for ( i = 0; i < i_bstree_count( tree ); i++ )
+   {
+      v = i_bstree_item( tree, i );
+      CU_ASSERT( i_bstree_rank( tree, v ) <= i );
+      CU_ASSERT( i_bstree_rank( tree, v + 1 ) > i );
+
+      i_bstree_go( tree, i );
+      CU_ASSERT( i_bstree_index( tree ) == i );
+   }
+
+   i_bstree_dispose( &tree );
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+int
+add_test_rank( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_rank", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_rank_1
+   add_test_to_suite( p_suite, test_rank_1, "test_rank_1" );
+
+   // test_rank_2
+   add_test_to_suite( p_suite, test_rank_2, "test_rank_2" );
+
+   // test_rank_3
+   add_test_to_suite( p_suite, test_rank_3, "test_rank_3" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
@@ -58,6 +58,12 @@ add_test_occurrences( void );
 int
 add_test_occurrences_eq_fn( void );
 
+int
+add_test_rank( void );
+
+int
+add_test_count_in_range( void );
+
 int
 add_test_search_forth( void );
 
@@ -286,6 +292,8 @@ int main()
    add_test_has_eq_fn();
    add_test_occurrences();
    add_test_occurrences_eq_fn();
+   add_test_rank();
+   add_test_count_in_range();
    add_test_search_forth();
    add_test_search_forth_eq_fn();
    add_test_search_back();
@@ -13,7 +13,7 @@ solution( name )
       language "C"
       files { "src/*.c", "../../Protocol_Base/*.c", "../../Common/Sequence/*.c", "../../Common/P_Indexable/*.c", "../../String/*.c" }
       links { "cunit", "m", "rt", "gc", "gcov", "pthread" }
-      includedirs { "src", "../../base", "../../dbc", "../../BSearcher", "../../Protocol_Base", "../../P_Indexable", "../../P_Iterable", "../../P_Iterable_kv", "../../P_DIterable", "../../P_DIterable_kv", "../../P_Clonable", "../../P_Searcher", "../../P_Sorter", "../../P_Basic", "../../Sequence", "../../Common/Sequence", "../../Common/P_Indexable", "../../String"  }
+      includedirs { "src", "../../base", "../../dbc", "../../BSearcher", "../../Protocol_Base", "../../P_Indexable", "../../P_Iterable", "../../P_Iterable_kv", "../../P_DIterable", "../../P_DIterable_kv", "../../P_Clonable", "../../P_Searcher", "../../P_Sorter", "../../P_Basic", "../../Sequence", "../../DList", "../../Common/Sequence", "../../Common/P_Indexable", "../../String"  }
 
       -- A configuration defines one way a project can be built
       configuration "Debug"
@@ -30,6 +30,7 @@ extern "C" {
 
 #include "Protocol_Base.h"
 #include "i32_Sequence.h"
+#include "i_DList.h"
 #include "i_BSearcher.h"
 
 int
@@ -145,6 +146,37 @@ void test_plain_search_3( void )
    return;
 }
 
+void test_plain_search_4( void )
+{
+   int32_t i = 0;
+   int32_t result = 0;
+
+   // a DList has no item array and is read through item
+   i_dlist_t *list = i_dlist_make();
+   protocol_base_t *pb_list = ( protocol_base_t * ) list;
+
+   for ( i = 0; i < 20; i++ )
+   {
+      i_dlist_put_last( list, 2 * i );
+   }
+
+   result = i_bsearcher_search( pb_list, func, 14 );
+   CU_ASSERT( result == 7 );
+
+   result = i_bsearcher_search( pb_list, func, 0 );
+   CU_ASSERT( result == 0 );
+
+   result = i_bsearcher_search( pb_list, func, 38 );
+   CU_ASSERT( result == 19 );
+
+   result = i_bsearcher_search( pb_list, func, 15 );
+   CU_ASSERT( result == -1 );
+
+   i_dlist_dispose( &list );
+
+   return;
+}
+
 int
 add_test_plain_search( void )
 {
@@ -172,6 +204,9 @@ add_test_plain_search( void )
    // test_plain_search_3
    add_test_to_suite( p_suite, test_plain_search_3, "test_plain_search_3" );
 
+   // test_plain_search_4
+   add_test_to_suite( p_suite, test_plain_search_4, "test_plain_search_4" );
+
 
    return CUE_SUCCESS;
 
@@ -0,0 +1,205 @@
+/**
+ @file Binary_File_async_test_dispose.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Binary_File_async_dispose"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Binary_File_async_dispose.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "Binary_File_async.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   write_test_file
+
+   write count bytes 0, 1, 2, ... to async.bin
+*/
+
+static
+void
+write_test_file( int32_t count )
+{
+   binary_file_t *file = NULL;
+   int32_t i = 0;
+
+   file = binary_file_make_cstring( "async.bin" );
+   binary_file_delete( file );
+
+   binary_file_open_write( file );
+   for ( i = 0; i < count; i++ )
+   {
+      binary_file_put_uint8( file, ( uint8_t ) i );
+   }
+   binary_file_close( file );
+
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   make_async
+
+   make an instance with io_uring if available, or with a thread pool
+*/
+
+static
+binary_file_async_t *
+make_async( int32_t is_thread_pool )
+{
+   binary_file_async_t *result = NULL;
+
+   if ( is_thread_pool == 1 )
+   {
+      result = binary_file_async_make_thread_pool( 8, 2 );
+   }
+   else
+   {
+      result = binary_file_async_make( 8 );
+   }
+
+   return result;
+}
+
+/**
+   dispose_pending
+
+   dispose of an instance with reads submitted and queued
+*/
+
+static
+void
+dispose_pending( int32_t is_thread_pool )
+{
+   binary_file_async_t *async = NULL;
+   binary_file_t *file = NULL;
+   raw_buffer_t *buffer[4] = { NULL, NULL, NULL, NULL };
+   int32_t i = 0;
+
+   write_test_file( 400 );
+
+   file = binary_file_make_open_read_cstring( "async.bin" );
+   async = make_async( is_thread_pool );
+
+   for ( i = 0; i < 4; i++ )
+   {
+      buffer[i] = raw_buffer_make( 100 );
+      binary_file_async_read( async, file, buffer[i], i * 100 );
+      if ( i == 2 )
+      {
+         binary_file_async_submit( async );
+      }
+   }
+
+   // waits for the three submitted reads, drops the last one
+   binary_file_async_dispose( &async );
+
+   CU_ASSERT( async == NULL );
+   CU_ASSERT( raw_buffer_read_uint8( buffer[2], 99 ) == 299 % 256 );
+
+   for ( i = 0; i < 4; i++ )
+   {
+      raw_buffer_deep_dispose( &buffer[i] );
+   }
+
+   binary_file_close( file );
+   binary_file_delete( file );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   test_dispose_1
+*/
+
+void test_dispose_1( void )
+{
+   binary_file_async_t *async = NULL;
+
+   async = binary_file_async_make( 8 );
+   binary_file_async_dispose( &async );
+
+   CU_ASSERT( async == NULL );
+
+   return;
+}
+
+/**
+   test_dispose_2
+*/
+
+void test_dispose_2( void )
+{
+   dispose_pending( 0 );
+
+   return;
+}
+
+/**
+   test_dispose_3
+*/
+
+void test_dispose_3( void )
+{
+   dispose_pending( 1 );
+
+   return;
+}
+
+
+int
+add_test_dispose( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_dispose", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_dispose_1
+   add_test_to_suite( p_suite, test_dispose_1, "test_dispose_1" );
+
+   // test_dispose_2
+   add_test_to_suite( p_suite, test_dispose_2, "test_dispose_2" );
+
+   // test_dispose_3
+   add_test_to_suite( p_suite, test_dispose_3, "test_dispose_3" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,106 @@
+/**
+ @file Binary_File_async_test_make.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Binary_File_async_make"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Binary_File_async_make.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "Binary_File_async.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_make_1
+*/
+
+void test_make_1( void )
+{
+   binary_file_async_t *async = NULL;
+
+   async = binary_file_async_make( 8 );
+
+   CU_ASSERT( async != NULL );
+   CU_ASSERT( binary_file_async_queue_depth( async ) == 8 );
+   CU_ASSERT( binary_file_async_count( async ) == 0 );
+   CU_ASSERT( binary_file_async_queued_count( async ) == 0 );
+   CU_ASSERT( binary_file_async_is_full( async ) == 0 );
+   CU_ASSERT( ( binary_file_async_is_uring( async ) == 0 ) || ( binary_file_async_is_uring( async ) == 1 ) );
+
+   binary_file_async_dispose( &async );
+
+   return;
+}
+
+/**
+   test_make_2
+*/
+
+void test_make_2( void )
+{
+   binary_file_async_t *async = NULL;
+
+   async = binary_file_async_make_thread_pool( 4, 2 );
+
+   CU_ASSERT( async != NULL );
+   CU_ASSERT( binary_file_async_queue_depth( async ) == 4 );
+   CU_ASSERT( binary_file_async_count( async ) == 0 );
+   CU_ASSERT( binary_file_async_is_uring( async ) == 0 );
+
+   binary_file_async_dispose( &async );
+
+   return;
+}
+
+
+int
+add_test_make( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_make", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_make_1
+   add_test_to_suite( p_suite, test_make_1, "test_make_1" );
+
+   // test_make_2
+   add_test_to_suite( p_suite, test_make_2, "test_make_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,211 @@
+/**
+ @file Binary_File_async_test_poll.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Binary_File_async_poll and Binary_File_async_wait"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Binary_File_async_poll and Binary_File_async_wait.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "Binary_File_async.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   write_test_file
+
+   write count bytes 0, 1, 2, ... to async.bin
+*/
+
+static
+void
+write_test_file( int32_t count )
+{
+   binary_file_t *file = NULL;
+   int32_t i = 0;
+
+   file = binary_file_make_cstring( "async.bin" );
+   binary_file_delete( file );
+
+   binary_file_open_write( file );
+   for ( i = 0; i < count; i++ )
+   {
+      binary_file_put_uint8( file, ( uint8_t ) i );
+   }
+   binary_file_close( file );
+
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   make_async
+
+   make an instance with io_uring if available, or with a thread pool
+*/
+
+static
+binary_file_async_t *
+make_async( int32_t is_thread_pool )
+{
+   binary_file_async_t *result = NULL;
+
+   if ( is_thread_pool == 1 )
+   {
+      result = binary_file_async_make_thread_pool( 8, 2 );
+   }
+   else
+   {
+      result = binary_file_async_make( 8 );
+   }
+
+   return result;
+}
+
+/**
+   poll_reads
+
+   submit reads and poll until all have completed
+*/
+
+static
+void
+poll_reads( int32_t is_thread_pool )
+{
+   binary_file_async_t *async = NULL;
+   binary_file_t *file = NULL;
+   raw_buffer_t *buffer[8];
+   binary_file_async_completion_t completions[8];
+   int32_t i = 0;
+   int32_t n = 0;
+   int32_t total = 0;
+   int32_t ok = 1;
+
+   write_test_file( 800 );
+
+   file = binary_file_make_open_read_cstring( "async.bin" );
+   async = make_async( is_thread_pool );
+
+   // nothing in flight
+   CU_ASSERT( binary_file_async_poll( async, completions, 8 ) == 0 );
+   CU_ASSERT( binary_file_async_wait( async, completions, 0, 8 ) == 0 );
+
+   for ( i = 0; i < 8; i++ )
+   {
+      buffer[i] = raw_buffer_make( 100 );
+      binary_file_async_read( async, file, buffer[i], i * 100 );
+   }
+
+   CU_ASSERT( binary_file_async_is_full( async ) == 1 );
+
+   // queued requests do not complete until submitted
+   CU_ASSERT( binary_file_async_poll( async, completions, 8 ) == 0 );
+
+   binary_file_async_submit( async );
+
+   while ( total < 8 )
+   {
+      n = binary_file_async_poll( async, &completions[total], 8 - total );
+      total = total + n;
+   }
+
+   for ( i = 0; i < 8; i++ )
+   {
+      if ( completions[i].result != 100 )
+      {
+         ok = 0;
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+   CU_ASSERT( binary_file_async_count( async ) == 0 );
+   CU_ASSERT( binary_file_async_poll( async, completions, 8 ) == 0 );
+
+   for ( i = 0; i < 8; i++ )
+   {
+      raw_buffer_deep_dispose( &buffer[i] );
+   }
+
+   binary_file_async_dispose( &async );
+
+   binary_file_close( file );
+   binary_file_delete( file );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   test_poll_1
+*/
+
+void test_poll_1( void )
+{
+   poll_reads( 0 );
+
+   return;
+}
+
+/**
+   test_poll_2
+*/
+
+void test_poll_2( void )
+{
+   poll_reads( 1 );
+
+   return;
+}
+
+
+int
+add_test_poll( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_poll", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_poll_1
+   add_test_to_suite( p_suite, test_poll_1, "test_poll_1" );
+
+   // test_poll_2
+   add_test_to_suite( p_suite, test_poll_2, "test_poll_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,308 @@
+/**
+ @file Binary_File_async_test_read.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Binary_File_async_read"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Binary_File_async_read.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "Binary_File_async.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   write_test_file
+
+   write count bytes 0, 1, 2, ... to async.bin
+*/
+
+static
+void
+write_test_file( int32_t count )
+{
+   binary_file_t *file = NULL;
+   int32_t i = 0;
+
+   file = binary_file_make_cstring( "async.bin" );
+   binary_file_delete( file );
+
+   binary_file_open_write( file );
+   for ( i = 0; i < count; i++ )
+   {
+      binary_file_put_uint8( file, ( uint8_t ) i );
+   }
+   binary_file_close( file );
+
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   make_async
+
+   make an instance with io_uring if available, or with a thread pool
+*/
+
+static
+binary_file_async_t *
+make_async( int32_t is_thread_pool )
+{
+   binary_file_async_t *result = NULL;
+
+   if ( is_thread_pool == 1 )
+   {
+      result = binary_file_async_make_thread_pool( 8, 2 );
+   }
+   else
+   {
+      result = binary_file_async_make( 8 );
+   }
+
+   return result;
+}
+
+/**
+   read_blocks
+
+   read ten blocks of 100 bytes in reverse order and check them
+*/
+
+static
+void
+read_blocks( int32_t is_thread_pool )
+{
+   binary_file_async_t *async = NULL;
+   binary_file_t *file = NULL;
+   raw_buffer_t *buffer[10];
+   binary_file_async_completion_t completions[10];
+   int64_t id[10];
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t n = 0;
+   int32_t ok = 1;
+
+   write_test_file( 1000 );
+
+   file = binary_file_make_open_read_cstring( "async.bin" );
+   async = binary_file_async_make_thread_pool( 10, 3 );
+   if ( is_thread_pool == 0 )
+   {
+      binary_file_async_dispose( &async );
+      async = binary_file_async_make( 10 );
+   }
+
+   for ( i = 0; i < 10; i++ )
+   {
+      buffer[i] = raw_buffer_make( 100 );
+      id[i] = binary_file_async_read( async, file, buffer[i], ( 9 - i ) * 100 );
+   }
+
+   CU_ASSERT( binary_file_async_count( async ) == 10 );
+   CU_ASSERT( binary_file_async_queued_count( async ) == 10 );
+   CU_ASSERT( binary_file_async_is_full( async ) == 1 );
+
+   CU_ASSERT( binary_file_async_submit( async ) == 10 );
+   CU_ASSERT( binary_file_async_queued_count( async ) == 0 );
+   CU_ASSERT( binary_file_async_count( async ) == 10 );
+
+   n = binary_file_async_wait( async, completions, 10, 10 );
+
+   CU_ASSERT( n == 10 );
+   CU_ASSERT( binary_file_async_count( async ) == 0 );
+   CU_ASSERT( binary_file_async_is_full( async ) == 0 );
+
+   // completions come in any order, each with its own buffer
+   for ( j = 0; j < n; j++ )
+   {
+      i = ( int32_t ) completions[j].id;
+
+      if (
+         ( completions[j].id != id[i] )
+         ||
+         ( completions[j].buffer != buffer[i] )
+         ||
+         ( completions[j].result != 100 )
+         ||
+         ( raw_buffer_read_uint8( buffer[i], 0 ) != ( uint8_t ) ( ( 9 - i ) * 100 ) )
+         ||
+         ( raw_buffer_read_uint8( buffer[i], 99 ) != ( uint8_t ) ( ( 9 - i ) * 100 + 99 ) )
+      )
+      {
+         ok = 0;
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   // the reads do not move the current position
+   CU_ASSERT( binary_file_position( file ) == 0 );
+
+   for ( i = 0; i < 10; i++ )
+   {
+      raw_buffer_deep_dispose( &buffer[i] );
+   }
+
+   binary_file_async_dispose( &async );
+
+   binary_file_close( file );
+   binary_file_delete( file );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   read_end
+
+   read across and past the end of the file
+*/
+
+static
+void
+read_end( int32_t is_thread_pool )
+{
+   binary_file_async_t *async = NULL;
+   binary_file_t *file = NULL;
+   raw_buffer_t *buffer = NULL;
+   raw_buffer_t *buffer1 = NULL;
+   binary_file_async_completion_t completions[2];
+   int32_t n = 0;
+
+   write_test_file( 1000 );
+
+   file = binary_file_make_open_read_cstring( "async.bin" );
+   async = make_async( is_thread_pool );
+
+   buffer = raw_buffer_make( 100 );
+   buffer1 = raw_buffer_make( 100 );
+
+   binary_file_async_read( async, file, buffer, 950 );
+   binary_file_async_read( async, file, buffer1, 2000 );
+
+   n = binary_file_async_wait( async, completions, 2, 2 );
+
+   CU_ASSERT( n == 2 );
+
+   if ( completions[0].buffer == buffer1 )
+   {
+      completions[1] = completions[0];
+   }
+
+   CU_ASSERT( completions[1].result == 0 );
+   CU_ASSERT( raw_buffer_read_uint8( buffer, 49 ) == ( uint8_t ) 999 );
+
+   raw_buffer_deep_dispose( &buffer );
+   raw_buffer_deep_dispose( &buffer1 );
+
+   binary_file_async_dispose( &async );
+
+   binary_file_close( file );
+   binary_file_delete( file );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   test_read_1
+*/
+
+void test_read_1( void )
+{
+   read_blocks( 0 );
+
+   return;
+}
+
+/**
+   test_read_2
+*/
+
+void test_read_2( void )
+{
+   read_blocks( 1 );
+
+   return;
+}
+
+/**
+   test_read_3
+*/
+
+void test_read_3( void )
+{
+   read_end( 0 );
+
+   return;
+}
+
+/**
+   test_read_4
+*/
+
+void test_read_4( void )
+{
+   read_end( 1 );
+
+   return;
+}
+
+
+int
+add_test_read( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_read", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_read_1
+   add_test_to_suite( p_suite, test_read_1, "test_read_1" );
+
+   // test_read_2
+   add_test_to_suite( p_suite, test_read_2, "test_read_2" );
+
+   // test_read_3
+   add_test_to_suite( p_suite, test_read_3, "test_read_3" );
+
+   // test_read_4
+   add_test_to_suite( p_suite, test_read_4, "test_read_4" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,208 @@
+/**
+ @file Binary_File_async_test_write.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Binary_File_async_write"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Binary_File_async_write.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "Binary_File_async.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   make_async
+
+   make an instance with io_uring if available, or with a thread pool
+*/
+
+static
+binary_file_async_t *
+make_async( int32_t is_thread_pool )
+{
+   binary_file_async_t *result = NULL;
+
+   if ( is_thread_pool == 1 )
+   {
+      result = binary_file_async_make_thread_pool( 8, 2 );
+   }
+   else
+   {
+      result = binary_file_async_make( 8 );
+   }
+
+   return result;
+}
+
+/**
+   write_blocks
+
+   write four blocks of 100 bytes out of order and read them back
+*/
+
+static
+void
+write_blocks( int32_t is_thread_pool )
+{
+   binary_file_async_t *async = NULL;
+   binary_file_t *file = NULL;
+   raw_buffer_t *buffer[4];
+   binary_file_async_completion_t completions[4];
+   uint8_t *bytes = NULL;
+   int32_t order[4] = { 2, 0, 3, 1 };
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t n = 0;
+   int32_t ok = 1;
+
+   file = binary_file_make_cstring( "async.bin" );
+   binary_file_delete( file );
+   binary_file_open_write( file );
+
+   async = make_async( is_thread_pool );
+
+   for ( i = 0; i < 4; i++ )
+   {
+      buffer[i] = raw_buffer_make( 100 );
+      for ( j = 0; j < 100; j++ )
+      {
+         raw_buffer_put_uint8( buffer[i], ( uint8_t ) ( order[i] * 100 + j ), j );
+      }
+      binary_file_async_write( async, file, buffer[i], order[i] * 100 );
+   }
+
+   // collect in two batches
+   n = binary_file_async_wait( async, completions, 2, 2 );
+   CU_ASSERT( n == 2 );
+
+   for ( i = 0; i < n; i++ )
+   {
+      if ( completions[i].result != 100 )
+      {
+         ok = 0;
+      }
+   }
+
+   n = binary_file_async_wait( async, completions, 2, 4 );
+   CU_ASSERT( n == 2 );
+
+   for ( i = 0; i < n; i++ )
+   {
+      if ( completions[i].result != 100 )
+      {
+         ok = 0;
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+   CU_ASSERT( binary_file_async_count( async ) == 0 );
+
+   binary_file_close( file );
+
+   binary_file_open_read( file );
+
+   CU_ASSERT( binary_file_count( file ) == 400 );
+
+   bytes = binary_file_read_bytes( file, 400 );
+
+   ok = 1;
+   for ( i = 0; i < 400; i++ )
+   {
+      if ( bytes[i] != ( uint8_t ) i )
+      {
+         ok = 0;
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   free( bytes );
+
+   for ( i = 0; i < 4; i++ )
+   {
+      raw_buffer_deep_dispose( &buffer[i] );
+   }
+
+   binary_file_async_dispose( &async );
+
+   binary_file_close( file );
+   binary_file_delete( file );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   test_write_1
+*/
+
+void test_write_1( void )
+{
+   write_blocks( 0 );
+
+   return;
+}
+
+/**
+   test_write_2
+*/
+
+void test_write_2( void )
+{
+   write_blocks( 1 );
+
+   return;
+}
+
+
+int
+add_test_write( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_write", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_write_1
+   add_test_to_suite( p_suite, test_write_1, "test_write_1" );
+
+   // test_write_2
+   add_test_to_suite( p_suite, test_write_2, "test_write_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
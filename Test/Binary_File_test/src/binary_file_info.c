@@ -23,6 +23,7 @@ extern "C" {
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/stat.h>
 #include "CUnit/Basic.h"
 
 #include "Binary_File.h"
@@ -248,6 +249,35 @@ void test_info_9( void )
 }
 
 
+/**
+   test_info_10
+*/
+
+void test_info_10( void )
+{
+   binary_file_t *file = NULL;
+   int32_t fd = 0;
+   struct stat st;
+
+   file = binary_file_make_cstring( "src/test/dfile.bin" );
+
+   binary_file_open_write( file );
+   binary_file_put_int32( file, 7 );
+
+   // the descriptor sees the output still in the stdio buffer
+   fd = binary_file_descriptor( file );
+
+   CU_ASSERT( fd >= 0 );
+   CU_ASSERT( fstat( fd, &st ) == 0 );
+   CU_ASSERT( st.st_size == 4 );
+
+   binary_file_close( file );
+   binary_file_delete( file );
+   binary_file_dispose( &file );
+
+   return;
+}
+
 int
 add_test_info( void )
 {
@@ -290,6 +320,9 @@ add_test_info( void )
    // test_info_9
    add_test_to_suite( p_suite, test_info_9, "test_info_9" );
 
+   // test_info_10
+   add_test_to_suite( p_suite, test_info_10, "test_info_10" );
+
    return CUE_SUCCESS;
 
 }
@@ -0,0 +1,309 @@
+/**
+ @file binary_file_mmap.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for binary_file_t mapped reads"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for binary_file_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "Binary_File.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   write_test_file
+
+   write count bytes 0, 1, 2, ... to src/test/mmap.bin
+*/
+
+static
+binary_file_t *
+write_test_file( int32_t count )
+{
+   binary_file_t *result = NULL;
+   int32_t i = 0;
+
+   result = binary_file_make_cstring( "src/test/mmap.bin" );
+   binary_file_delete( result );
+
+   binary_file_open_write( result );
+   for ( i = 0; i < count; i++ )
+   {
+      binary_file_put_uint8( result, ( uint8_t ) i );
+   }
+   binary_file_close( result );
+
+   return result;
+}
+
+/**
+   test_mmap_1
+*/
+
+void test_mmap_1( void )
+{
+   binary_file_t *file = NULL;
+   binary_file_t *file1 = NULL;
+   raw_buffer_t *raw_buffer = NULL;
+
+   file = write_test_file( 1000 );
+
+   file1 = binary_file_make_mmap_read_cstring( "src/test/mmap.bin" );
+
+   CU_ASSERT( file1 != NULL );
+   CU_ASSERT( binary_file_is_open_read( file1 ) == 1 );
+   CU_ASSERT( binary_file_is_mapped( file1 ) == 1 );
+   CU_ASSERT( binary_file_count( file1 ) == 1000 );
+
+   // a view does not move the current position
+   raw_buffer = binary_file_raw_buffer_view( file1, 300, 10 );
+
+   CU_ASSERT( raw_buffer_count( raw_buffer ) == 10 );
+   CU_ASSERT( raw_buffer_is_borrowed( raw_buffer ) == 1 );
+   CU_ASSERT( raw_buffer_read_uint8( raw_buffer, 0 ) == ( uint8_t ) 300 );
+   CU_ASSERT( raw_buffer_read_uint8( raw_buffer, 9 ) == ( uint8_t ) 309 );
+   CU_ASSERT( binary_file_position( file1 ) == 0 );
+
+   raw_buffer_deep_dispose( &raw_buffer );
+
+   // the other reads still work
+   CU_ASSERT( binary_file_read_uint8( file1 ) == 0 );
+   CU_ASSERT( binary_file_read_uint8( file1 ) == 1 );
+
+   binary_file_close( file1 );
+
+   CU_ASSERT( binary_file_is_mapped( file1 ) == 0 );
+
+   binary_file_dispose( &file1 );
+
+   binary_file_delete( file );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   test_mmap_2
+*/
+
+void test_mmap_2( void )
+{
+   binary_file_t *file = NULL;
+   binary_file_t *file1 = NULL;
+   raw_buffer_t *raw_buffer = NULL;
+   string_t *name = NULL;
+
+   file = write_test_file( 1000 );
+
+   name = string_make_from_cstring( "src/test/mmap.bin" );
+   file1 = binary_file_make_mmap_read( name );
+
+   CU_ASSERT( binary_file_is_mapped( file1 ) == 1 );
+
+   binary_file_advise( file1, BINARY_FILE_ADVICE_SEQUENTIAL );
+
+   // a read view moves the current position past the bytes viewed
+   raw_buffer = binary_file_read_raw_buffer_view( file1, 600 );
+
+   CU_ASSERT( raw_buffer_count( raw_buffer ) == 600 );
+   CU_ASSERT( raw_buffer_read_uint8( raw_buffer, 599 ) == ( uint8_t ) 599 );
+   CU_ASSERT( binary_file_position( file1 ) == 600 );
+
+   raw_buffer_deep_dispose( &raw_buffer );
+
+   // at the end of the file the view is short
+   raw_buffer = binary_file_read_raw_buffer_view( file1, 600 );
+
+   CU_ASSERT( raw_buffer_count( raw_buffer ) == 400 );
+   CU_ASSERT( raw_buffer_read_uint8( raw_buffer, 0 ) == ( uint8_t ) 600 );
+   CU_ASSERT( binary_file_position( file1 ) == 1000 );
+
+   raw_buffer_deep_dispose( &raw_buffer );
+
+   raw_buffer = binary_file_read_raw_buffer_view( file1, 600 );
+
+   CU_ASSERT( raw_buffer_count( raw_buffer ) == 0 );
+
+   raw_buffer_deep_dispose( &raw_buffer );
+
+   binary_file_dispose( &file1 );
+   string_deep_dispose( &name );
+
+   binary_file_delete( file );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   test_mmap_3
+*/
+
+void test_mmap_3( void )
+{
+   binary_file_t *file = NULL;
+   raw_buffer_t *raw_buffer = NULL;
+
+   file = write_test_file( 100 );
+
+   binary_file_open_mmap_read( file );
+
+   CU_ASSERT( binary_file_is_mapped( file ) == 1 );
+
+   binary_file_advise( file, BINARY_FILE_ADVICE_RANDOM );
+   binary_file_advise( file, BINARY_FILE_ADVICE_WILLNEED );
+   binary_file_advise( file, BINARY_FILE_ADVICE_NORMAL );
+
+   raw_buffer = binary_file_raw_buffer_view( file, 0, 100 );
+
+   CU_ASSERT( raw_buffer_read_uint8( raw_buffer, 42 ) == 42 );
+
+   raw_buffer_deep_dispose( &raw_buffer );
+
+   binary_file_close( file );
+
+   CU_ASSERT( binary_file_is_mapped( file ) == 0 );
+
+   // a file opened for reading is not mapped, but takes hints
+   binary_file_open_read( file );
+
+   CU_ASSERT( binary_file_is_mapped( file ) == 0 );
+
+   binary_file_advise( file, BINARY_FILE_ADVICE_SEQUENTIAL );
+
+   CU_ASSERT( binary_file_read_uint8( file ) == 0 );
+
+   binary_file_close( file );
+
+   binary_file_delete( file );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   test_mmap_4
+*/
+
+void test_mmap_4( void )
+{
+   binary_file_t *file = NULL;
+
+   file = write_test_file( 0 );
+
+   // an empty file is open for reading but not mapped
+   binary_file_open_mmap_read( file );
+
+   CU_ASSERT( binary_file_is_open_read( file ) == 1 );
+   CU_ASSERT( binary_file_is_mapped( file ) == 0 );
+
+   binary_file_close( file );
+
+   binary_file_delete( file );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   test_mmap_5
+*/
+
+void test_mmap_5( void )
+{
+   binary_file_t *file = NULL;
+   binary_file_t *file1 = NULL;
+   raw_buffer_t *raw_buffer = NULL;
+
+   file = write_test_file( 1000 );
+
+   file1 = binary_file_make_mmap_read_cstring( "src/test/mmap.bin" );
+
+   // a put into a view is copy on write
+   raw_buffer = binary_file_raw_buffer_view( file1, 100, 10 );
+   raw_buffer_put_uint8( raw_buffer, 0xAB, 0 );
+
+   CU_ASSERT( raw_buffer_read_uint8( raw_buffer, 0 ) == 0xAB );
+
+   raw_buffer_deep_dispose( &raw_buffer );
+
+   raw_buffer = binary_file_raw_buffer_view( file1, 100, 10 );
+
+   CU_ASSERT( raw_buffer_read_uint8( raw_buffer, 0 ) == 0xAB );
+
+   raw_buffer_deep_dispose( &raw_buffer );
+   binary_file_dispose( &file1 );
+
+   // the file is unchanged
+   binary_file_open_read( file );
+   binary_file_go( file, 100 );
+
+   CU_ASSERT( binary_file_read_uint8( file ) == 100 );
+
+   binary_file_close( file );
+
+   binary_file_delete( file );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+int
+add_test_mmap( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_mmap", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_mmap_1
+   add_test_to_suite( p_suite, test_mmap_1, "test_mmap_1" );
+
+   // test_mmap_2
+   add_test_to_suite( p_suite, test_mmap_2, "test_mmap_2" );
+
+   // test_mmap_3
+   add_test_to_suite( p_suite, test_mmap_3, "test_mmap_3" );
+
+   // test_mmap_4
+   add_test_to_suite( p_suite, test_mmap_4, "test_mmap_4" );
+
+   // test_mmap_5
+   add_test_to_suite( p_suite, test_mmap_5, "test_mmap_5" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
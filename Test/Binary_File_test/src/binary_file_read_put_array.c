@@ -0,0 +1,1126 @@
+/**
+ @file binary_file_read_put_array.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for binary_file_t array reads and puts"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for binary_file_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "Binary_File.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   ARRAY_COUNT - more than one swap buffer of the largest items
+*/
+
+#define ARRAY_COUNT 3001
+
+/**
+   test_read_put_array_1
+*/
+
+void test_read_put_array_1( void )
+{
+   binary_file_t *file = NULL;
+   int8_t *arg = NULL;
+   int8_t *argx = NULL;
+   int32_t i = 0;
+   int32_t count = 0;
+   int32_t ok = 1;
+
+   arg = ( int8_t * ) calloc( ARRAY_COUNT, sizeof( int8_t ) );
+   argx = ( int8_t * ) calloc( ARRAY_COUNT, sizeof( int8_t ) );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      arg[i] = ( int8_t ) ( i * 7 - 100 );
+   }
+
+   file = binary_file_make_cstring( "src/test/array.bin" );
+   binary_file_delete( file );
+
+   // native, big endian and little endian arrays one after the other
+   binary_file_open_write( file );
+   binary_file_put_int8_array( file, arg, ARRAY_COUNT );
+   binary_file_put_int8_array_be( file, arg, ARRAY_COUNT );
+   binary_file_put_int8_array_le( file, arg, ARRAY_COUNT );
+   binary_file_close( file );
+
+   binary_file_open_read( file );
+
+   CU_ASSERT( binary_file_count( file ) == 3 * ARRAY_COUNT * sizeof( int8_t ) );
+
+   count = binary_file_read_int8_array( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( int8_t ) ) == 0 );
+
+   count = binary_file_read_int8_array_be( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( int8_t ) ) == 0 );
+
+   count = binary_file_read_int8_array_le( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( int8_t ) ) == 0 );
+
+   // at the end of the file nothing more is read
+   count = binary_file_read_int8_array( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == 0 );
+
+   // the arrays read the same as single items
+   binary_file_start( file );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_int8( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_int8_be( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_int8_le( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   binary_file_close( file );
+   binary_file_delete( file );
+
+   free( arg );
+   free( argx );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   test_read_put_array_2
+*/
+
+void test_read_put_array_2( void )
+{
+   binary_file_t *file = NULL;
+   int16_t *arg = NULL;
+   int16_t *argx = NULL;
+   int32_t i = 0;
+   int32_t count = 0;
+   int32_t ok = 1;
+
+   arg = ( int16_t * ) calloc( ARRAY_COUNT, sizeof( int16_t ) );
+   argx = ( int16_t * ) calloc( ARRAY_COUNT, sizeof( int16_t ) );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      arg[i] = ( int16_t ) ( i * 307 - 20000 );
+   }
+
+   file = binary_file_make_cstring( "src/test/array.bin" );
+   binary_file_delete( file );
+
+   // native, big endian and little endian arrays one after the other
+   binary_file_open_write( file );
+   binary_file_put_int16_array( file, arg, ARRAY_COUNT );
+   binary_file_put_int16_array_be( file, arg, ARRAY_COUNT );
+   binary_file_put_int16_array_le( file, arg, ARRAY_COUNT );
+   binary_file_close( file );
+
+   binary_file_open_read( file );
+
+   CU_ASSERT( binary_file_count( file ) == 3 * ARRAY_COUNT * sizeof( int16_t ) );
+
+   count = binary_file_read_int16_array( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( int16_t ) ) == 0 );
+
+   count = binary_file_read_int16_array_be( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( int16_t ) ) == 0 );
+
+   count = binary_file_read_int16_array_le( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( int16_t ) ) == 0 );
+
+   // at the end of the file nothing more is read
+   count = binary_file_read_int16_array( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == 0 );
+
+   // the arrays read the same as single items
+   binary_file_start( file );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_int16( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_int16_be( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_int16_le( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   binary_file_close( file );
+   binary_file_delete( file );
+
+   free( arg );
+   free( argx );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   test_read_put_array_3
+*/
+
+void test_read_put_array_3( void )
+{
+   binary_file_t *file = NULL;
+   int32_t *arg = NULL;
+   int32_t *argx = NULL;
+   int32_t i = 0;
+   int32_t count = 0;
+   int32_t ok = 1;
+
+   arg = ( int32_t * ) calloc( ARRAY_COUNT, sizeof( int32_t ) );
+   argx = ( int32_t * ) calloc( ARRAY_COUNT, sizeof( int32_t ) );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      arg[i] = ( int32_t ) ( i * 1003 - 7 );
+   }
+
+   file = binary_file_make_cstring( "src/test/array.bin" );
+   binary_file_delete( file );
+
+   // native, big endian and little endian arrays one after the other
+   binary_file_open_write( file );
+   binary_file_put_int32_array( file, arg, ARRAY_COUNT );
+   binary_file_put_int32_array_be( file, arg, ARRAY_COUNT );
+   binary_file_put_int32_array_le( file, arg, ARRAY_COUNT );
+   binary_file_close( file );
+
+   binary_file_open_read( file );
+
+   CU_ASSERT( binary_file_count( file ) == 3 * ARRAY_COUNT * sizeof( int32_t ) );
+
+   count = binary_file_read_int32_array( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( int32_t ) ) == 0 );
+
+   count = binary_file_read_int32_array_be( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( int32_t ) ) == 0 );
+
+   count = binary_file_read_int32_array_le( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( int32_t ) ) == 0 );
+
+   // at the end of the file nothing more is read
+   count = binary_file_read_int32_array( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == 0 );
+
+   // the arrays read the same as single items
+   binary_file_start( file );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_int32( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_int32_be( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_int32_le( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   binary_file_close( file );
+   binary_file_delete( file );
+
+   free( arg );
+   free( argx );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   test_read_put_array_4
+*/
+
+void test_read_put_array_4( void )
+{
+   binary_file_t *file = NULL;
+   int64_t *arg = NULL;
+   int64_t *argx = NULL;
+   int32_t i = 0;
+   int32_t count = 0;
+   int32_t ok = 1;
+
+   arg = ( int64_t * ) calloc( ARRAY_COUNT, sizeof( int64_t ) );
+   argx = ( int64_t * ) calloc( ARRAY_COUNT, sizeof( int64_t ) );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      arg[i] = ( int64_t ) i * 0x123456789LL - 5;
+   }
+
+   file = binary_file_make_cstring( "src/test/array.bin" );
+   binary_file_delete( file );
+
+   // native, big endian and little endian arrays one after the other
+   binary_file_open_write( file );
+   binary_file_put_int64_array( file, arg, ARRAY_COUNT );
+   binary_file_put_int64_array_be( file, arg, ARRAY_COUNT );
+   binary_file_put_int64_array_le( file, arg, ARRAY_COUNT );
+   binary_file_close( file );
+
+   binary_file_open_read( file );
+
+   CU_ASSERT( binary_file_count( file ) == 3 * ARRAY_COUNT * sizeof( int64_t ) );
+
+   count = binary_file_read_int64_array( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( int64_t ) ) == 0 );
+
+   count = binary_file_read_int64_array_be( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( int64_t ) ) == 0 );
+
+   count = binary_file_read_int64_array_le( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( int64_t ) ) == 0 );
+
+   // at the end of the file nothing more is read
+   count = binary_file_read_int64_array( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == 0 );
+
+   // the arrays read the same as single items
+   binary_file_start( file );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_int64( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_int64_be( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_int64_le( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   binary_file_close( file );
+   binary_file_delete( file );
+
+   free( arg );
+   free( argx );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   test_read_put_array_5
+*/
+
+void test_read_put_array_5( void )
+{
+   binary_file_t *file = NULL;
+   uint8_t *arg = NULL;
+   uint8_t *argx = NULL;
+   int32_t i = 0;
+   int32_t count = 0;
+   int32_t ok = 1;
+
+   arg = ( uint8_t * ) calloc( ARRAY_COUNT, sizeof( uint8_t ) );
+   argx = ( uint8_t * ) calloc( ARRAY_COUNT, sizeof( uint8_t ) );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      arg[i] = ( uint8_t ) ( i * 7 );
+   }
+
+   file = binary_file_make_cstring( "src/test/array.bin" );
+   binary_file_delete( file );
+
+   // native, big endian and little endian arrays one after the other
+   binary_file_open_write( file );
+   binary_file_put_uint8_array( file, arg, ARRAY_COUNT );
+   binary_file_put_uint8_array_be( file, arg, ARRAY_COUNT );
+   binary_file_put_uint8_array_le( file, arg, ARRAY_COUNT );
+   binary_file_close( file );
+
+   binary_file_open_read( file );
+
+   CU_ASSERT( binary_file_count( file ) == 3 * ARRAY_COUNT * sizeof( uint8_t ) );
+
+   count = binary_file_read_uint8_array( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( uint8_t ) ) == 0 );
+
+   count = binary_file_read_uint8_array_be( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( uint8_t ) ) == 0 );
+
+   count = binary_file_read_uint8_array_le( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( uint8_t ) ) == 0 );
+
+   // at the end of the file nothing more is read
+   count = binary_file_read_uint8_array( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == 0 );
+
+   // the arrays read the same as single items
+   binary_file_start( file );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_uint8( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_uint8_be( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_uint8_le( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   binary_file_close( file );
+   binary_file_delete( file );
+
+   free( arg );
+   free( argx );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   test_read_put_array_6
+*/
+
+void test_read_put_array_6( void )
+{
+   binary_file_t *file = NULL;
+   uint16_t *arg = NULL;
+   uint16_t *argx = NULL;
+   int32_t i = 0;
+   int32_t count = 0;
+   int32_t ok = 1;
+
+   arg = ( uint16_t * ) calloc( ARRAY_COUNT, sizeof( uint16_t ) );
+   argx = ( uint16_t * ) calloc( ARRAY_COUNT, sizeof( uint16_t ) );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      arg[i] = ( uint16_t ) ( i * 307 + 1 );
+   }
+
+   file = binary_file_make_cstring( "src/test/array.bin" );
+   binary_file_delete( file );
+
+   // native, big endian and little endian arrays one after the other
+   binary_file_open_write( file );
+   binary_file_put_uint16_array( file, arg, ARRAY_COUNT );
+   binary_file_put_uint16_array_be( file, arg, ARRAY_COUNT );
+   binary_file_put_uint16_array_le( file, arg, ARRAY_COUNT );
+   binary_file_close( file );
+
+   binary_file_open_read( file );
+
+   CU_ASSERT( binary_file_count( file ) == 3 * ARRAY_COUNT * sizeof( uint16_t ) );
+
+   count = binary_file_read_uint16_array( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( uint16_t ) ) == 0 );
+
+   count = binary_file_read_uint16_array_be( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( uint16_t ) ) == 0 );
+
+   count = binary_file_read_uint16_array_le( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( uint16_t ) ) == 0 );
+
+   // at the end of the file nothing more is read
+   count = binary_file_read_uint16_array( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == 0 );
+
+   // the arrays read the same as single items
+   binary_file_start( file );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_uint16( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_uint16_be( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_uint16_le( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   binary_file_close( file );
+   binary_file_delete( file );
+
+   free( arg );
+   free( argx );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   test_read_put_array_7
+*/
+
+void test_read_put_array_7( void )
+{
+   binary_file_t *file = NULL;
+   uint32_t *arg = NULL;
+   uint32_t *argx = NULL;
+   int32_t i = 0;
+   int32_t count = 0;
+   int32_t ok = 1;
+
+   arg = ( uint32_t * ) calloc( ARRAY_COUNT, sizeof( uint32_t ) );
+   argx = ( uint32_t * ) calloc( ARRAY_COUNT, sizeof( uint32_t ) );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      arg[i] = ( uint32_t ) ( i * 2654435761u );
+   }
+
+   file = binary_file_make_cstring( "src/test/array.bin" );
+   binary_file_delete( file );
+
+   // native, big endian and little endian arrays one after the other
+   binary_file_open_write( file );
+   binary_file_put_uint32_array( file, arg, ARRAY_COUNT );
+   binary_file_put_uint32_array_be( file, arg, ARRAY_COUNT );
+   binary_file_put_uint32_array_le( file, arg, ARRAY_COUNT );
+   binary_file_close( file );
+
+   binary_file_open_read( file );
+
+   CU_ASSERT( binary_file_count( file ) == 3 * ARRAY_COUNT * sizeof( uint32_t ) );
+
+   count = binary_file_read_uint32_array( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( uint32_t ) ) == 0 );
+
+   count = binary_file_read_uint32_array_be( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( uint32_t ) ) == 0 );
+
+   count = binary_file_read_uint32_array_le( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( uint32_t ) ) == 0 );
+
+   // at the end of the file nothing more is read
+   count = binary_file_read_uint32_array( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == 0 );
+
+   // the arrays read the same as single items
+   binary_file_start( file );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_uint32( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_uint32_be( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_uint32_le( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   binary_file_close( file );
+   binary_file_delete( file );
+
+   free( arg );
+   free( argx );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   test_read_put_array_8
+*/
+
+void test_read_put_array_8( void )
+{
+   binary_file_t *file = NULL;
+   uint64_t *arg = NULL;
+   uint64_t *argx = NULL;
+   int32_t i = 0;
+   int32_t count = 0;
+   int32_t ok = 1;
+
+   arg = ( uint64_t * ) calloc( ARRAY_COUNT, sizeof( uint64_t ) );
+   argx = ( uint64_t * ) calloc( ARRAY_COUNT, sizeof( uint64_t ) );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      arg[i] = ( uint64_t ) i * 0x9E3779B97F4A7C15ULL;
+   }
+
+   file = binary_file_make_cstring( "src/test/array.bin" );
+   binary_file_delete( file );
+
+   // native, big endian and little endian arrays one after the other
+   binary_file_open_write( file );
+   binary_file_put_uint64_array( file, arg, ARRAY_COUNT );
+   binary_file_put_uint64_array_be( file, arg, ARRAY_COUNT );
+   binary_file_put_uint64_array_le( file, arg, ARRAY_COUNT );
+   binary_file_close( file );
+
+   binary_file_open_read( file );
+
+   CU_ASSERT( binary_file_count( file ) == 3 * ARRAY_COUNT * sizeof( uint64_t ) );
+
+   count = binary_file_read_uint64_array( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( uint64_t ) ) == 0 );
+
+   count = binary_file_read_uint64_array_be( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( uint64_t ) ) == 0 );
+
+   count = binary_file_read_uint64_array_le( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( uint64_t ) ) == 0 );
+
+   // at the end of the file nothing more is read
+   count = binary_file_read_uint64_array( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == 0 );
+
+   // the arrays read the same as single items
+   binary_file_start( file );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_uint64( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_uint64_be( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_uint64_le( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   binary_file_close( file );
+   binary_file_delete( file );
+
+   free( arg );
+   free( argx );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   test_read_put_array_9
+*/
+
+void test_read_put_array_9( void )
+{
+   binary_file_t *file = NULL;
+   float32_t *arg = NULL;
+   float32_t *argx = NULL;
+   int32_t i = 0;
+   int32_t count = 0;
+   int32_t ok = 1;
+
+   arg = ( float32_t * ) calloc( ARRAY_COUNT, sizeof( float32_t ) );
+   argx = ( float32_t * ) calloc( ARRAY_COUNT, sizeof( float32_t ) );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      arg[i] = ( float32_t ) i * 0.25f - 3.5f;
+   }
+
+   file = binary_file_make_cstring( "src/test/array.bin" );
+   binary_file_delete( file );
+
+   // native, big endian and little endian arrays one after the other
+   binary_file_open_write( file );
+   binary_file_put_float32_array( file, arg, ARRAY_COUNT );
+   binary_file_put_float32_array_be( file, arg, ARRAY_COUNT );
+   binary_file_put_float32_array_le( file, arg, ARRAY_COUNT );
+   binary_file_close( file );
+
+   binary_file_open_read( file );
+
+   CU_ASSERT( binary_file_count( file ) == 3 * ARRAY_COUNT * sizeof( float32_t ) );
+
+   count = binary_file_read_float32_array( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( float32_t ) ) == 0 );
+
+   count = binary_file_read_float32_array_be( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( float32_t ) ) == 0 );
+
+   count = binary_file_read_float32_array_le( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( float32_t ) ) == 0 );
+
+   // at the end of the file nothing more is read
+   count = binary_file_read_float32_array( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == 0 );
+
+   // the arrays read the same as single items
+   binary_file_start( file );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_float32( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_float32_be( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_float32_le( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   binary_file_close( file );
+   binary_file_delete( file );
+
+   free( arg );
+   free( argx );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   test_read_put_array_10
+*/
+
+void test_read_put_array_10( void )
+{
+   binary_file_t *file = NULL;
+   float64_t *arg = NULL;
+   float64_t *argx = NULL;
+   int32_t i = 0;
+   int32_t count = 0;
+   int32_t ok = 1;
+
+   arg = ( float64_t * ) calloc( ARRAY_COUNT, sizeof( float64_t ) );
+   argx = ( float64_t * ) calloc( ARRAY_COUNT, sizeof( float64_t ) );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      arg[i] = ( float64_t ) i * 1.0e-3 + 1.0e10;
+   }
+
+   file = binary_file_make_cstring( "src/test/array.bin" );
+   binary_file_delete( file );
+
+   // native, big endian and little endian arrays one after the other
+   binary_file_open_write( file );
+   binary_file_put_float64_array( file, arg, ARRAY_COUNT );
+   binary_file_put_float64_array_be( file, arg, ARRAY_COUNT );
+   binary_file_put_float64_array_le( file, arg, ARRAY_COUNT );
+   binary_file_close( file );
+
+   binary_file_open_read( file );
+
+   CU_ASSERT( binary_file_count( file ) == 3 * ARRAY_COUNT * sizeof( float64_t ) );
+
+   count = binary_file_read_float64_array( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( float64_t ) ) == 0 );
+
+   count = binary_file_read_float64_array_be( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( float64_t ) ) == 0 );
+
+   count = binary_file_read_float64_array_le( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == ARRAY_COUNT );
+   CU_ASSERT( memcmp( arg, argx, ARRAY_COUNT * sizeof( float64_t ) ) == 0 );
+
+   // at the end of the file nothing more is read
+   count = binary_file_read_float64_array( file, argx, ARRAY_COUNT );
+   CU_ASSERT( count == 0 );
+
+   // the arrays read the same as single items
+   binary_file_start( file );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_float64( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_float64_be( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_float64_le( file ) != arg[i] )
+      {
+         ok = 0;
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   binary_file_close( file );
+   binary_file_delete( file );
+
+   free( arg );
+   free( argx );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   test_read_put_array_11
+*/
+
+void test_read_put_array_11( void )
+{
+   binary_file_t *file = NULL;
+   uint16_t arg[2] = { 0x1234, 0xABCD };
+   uint8_t *bytes = NULL;
+   uint16_t argx[3] = { 0, 0, 0 };
+   int32_t count = 0;
+
+   file = binary_file_make_cstring( "src/test/array.bin" );
+   binary_file_delete( file );
+
+   binary_file_open_write( file );
+   binary_file_put_uint16_array_be( file, arg, 2 );
+   binary_file_put_uint16_array_le( file, arg, 2 );
+   binary_file_close( file );
+
+   // the bytes are in the asked for order
+   binary_file_open_read( file );
+   bytes = binary_file_read_bytes( file, 8 );
+
+   CU_ASSERT( bytes[0] == 0x12 );
+   CU_ASSERT( bytes[1] == 0x34 );
+   CU_ASSERT( bytes[2] == 0xAB );
+   CU_ASSERT( bytes[3] == 0xCD );
+   CU_ASSERT( bytes[4] == 0x34 );
+   CU_ASSERT( bytes[5] == 0x12 );
+   CU_ASSERT( bytes[6] == 0xCD );
+   CU_ASSERT( bytes[7] == 0xAB );
+
+   // a short read returns the items there are
+   binary_file_go( file, 4 );
+   count = binary_file_read_uint16_array_le( file, argx, 3 );
+
+   CU_ASSERT( count == 2 );
+   CU_ASSERT( argx[0] == 0x1234 );
+   CU_ASSERT( argx[1] == 0xABCD );
+
+   // the caller's array is not swapped
+   CU_ASSERT( arg[0] == 0x1234 );
+
+   binary_file_close( file );
+   binary_file_delete( file );
+
+   free( bytes );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+/**
+   test_read_put_array_12
+*/
+
+void test_read_put_array_12( void )
+{
+   binary_file_t *file = NULL;
+   int32_t i = 0;
+   int32_t ok = 1;
+
+   file = binary_file_make_cstring( "src/test/array.bin" );
+   binary_file_delete( file );
+
+   CU_ASSERT( binary_file_buffer_size( file ) == 0 );
+
+   // a buffer set before opening is used by the file when it opens
+   binary_file_set_buffer_size( file, 1 << 20 );
+
+   CU_ASSERT( binary_file_buffer_size( file ) == 1 << 20 );
+
+   binary_file_open_write( file );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      binary_file_put_int32_be( file, i );
+   }
+
+   binary_file_close( file );
+
+   binary_file_open_read( file );
+
+   CU_ASSERT( binary_file_count( file ) == ARRAY_COUNT * sizeof( int32_t ) );
+
+   for ( i = 0; i < ARRAY_COUNT / 2; i++ )
+   {
+      if ( binary_file_read_int32_be( file ) != i )
+      {
+         ok = 0;
+      }
+   }
+
+   binary_file_close( file );
+
+   // a new buffer size is used from the next open
+   binary_file_set_buffer_size( file, 4096 );
+
+   CU_ASSERT( binary_file_buffer_size( file ) == 4096 );
+
+   binary_file_open_read( file );
+
+   for ( i = 0; i < ARRAY_COUNT; i++ )
+   {
+      if ( binary_file_read_int32_be( file ) != i )
+      {
+         ok = 0;
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   binary_file_close( file );
+
+   // back to the stdio default
+   binary_file_set_buffer_size( file, 0 );
+
+   CU_ASSERT( binary_file_buffer_size( file ) == 0 );
+
+   binary_file_delete( file );
+   binary_file_dispose( &file );
+
+   return;
+}
+
+
+int
+add_test_read_put_array( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_read_put_array", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_read_put_array_1
+   add_test_to_suite( p_suite, test_read_put_array_1, "test_read_put_array_1" );
+
+   // test_read_put_array_2
+   add_test_to_suite( p_suite, test_read_put_array_2, "test_read_put_array_2" );
+
+   // test_read_put_array_3
+   add_test_to_suite( p_suite, test_read_put_array_3, "test_read_put_array_3" );
+
+   // test_read_put_array_4
+   add_test_to_suite( p_suite, test_read_put_array_4, "test_read_put_array_4" );
+
+   // test_read_put_array_5
+   add_test_to_suite( p_suite, test_read_put_array_5, "test_read_put_array_5" );
+
+   // test_read_put_array_6
+   add_test_to_suite( p_suite, test_read_put_array_6, "test_read_put_array_6" );
+
+   // test_read_put_array_7
+   add_test_to_suite( p_suite, test_read_put_array_7, "test_read_put_array_7" );
+
+   // test_read_put_array_8
+   add_test_to_suite( p_suite, test_read_put_array_8, "test_read_put_array_8" );
+
+   // test_read_put_array_9
+   add_test_to_suite( p_suite, test_read_put_array_9, "test_read_put_array_9" );
+
+   // test_read_put_array_10
+   add_test_to_suite( p_suite, test_read_put_array_10, "test_read_put_array_10" );
+
+   // test_read_put_array_11
+   add_test_to_suite( p_suite, test_read_put_array_11, "test_read_put_array_11" );
+
+   // test_read_put_array_12
+   add_test_to_suite( p_suite, test_read_put_array_12, "test_read_put_array_12" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
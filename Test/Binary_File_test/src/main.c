@@ -32,6 +32,12 @@ add_test_open( void );
 int
 add_test_read_put( void );
 
+int
+add_test_read_put_array( void );
+
+int
+add_test_mmap( void );
+
 int
 add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name )
 {
@@ -78,6 +84,8 @@ int main(int argc, char *argv[] )
    add_test_info();
    add_test_open();
    add_test_read_put();
+   add_test_read_put_array();
+   add_test_mmap();
 
    // Run all tests using the CUnit Basic interface
 
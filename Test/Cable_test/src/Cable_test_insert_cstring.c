@@ -591,6 +591,88 @@ void test_insert_cstring_26( void )
    return;
 }
 
+/**
+   test_insert_cstring_27
+*/
+
+void test_insert_cstring_27( void )
+{
+   cable_t *cable = NULL;
+   char_t expected[1024] = {0};
+   char_t s[8] = {0};
+   char_t *cp = NULL;
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t n = 0;
+   int32_t index = 0;
+   int32_t length = 0;
+   int32_t ok = 1;
+
+   cable = cable_make_capacity( 4 );
+
+   CU_ASSERT( cable != NULL );
+
+   srand( 17 );
+
+   // random inserts and removes, compared to a plain string
+   for ( i = 0; i < 2000; i++ )
+   {
+      length = strlen( expected );
+
+      if ( ( length < 8 ) || ( ( length < 900 ) && ( rand() % 2 == 0 ) ) )
+      {
+         n = 1 + rand() % 7;
+         for ( j = 0; j < n; j++ )
+         {
+            s[j] = 'a' + rand() % 26;
+         }
+         s[n] = 0;
+         index = rand() % ( length + 1 );
+
+         cable_insert_cstring( cable, s, index );
+
+         memmove( &expected[index + n], &expected[index], length - index + 1 );
+         memcpy( &expected[index], s, n );
+      }
+      else
+      {
+         index = rand() % length;
+         n = 1 + rand() % 9;
+         if ( index + n > length )
+         {
+            n = length - index;
+         }
+
+         cable_remove_substring( cable, index, index + n - 1 );
+
+         memmove( &expected[index], &expected[index + n], length - index - n + 1 );
+      }
+
+      if ( cable_is_equal_cstring( cable, expected ) == 0 )
+      {
+         ok = 0;
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   cable_reclaim( cable );
+
+   cp = cable_as_cstring( cable );
+   CU_ASSERT( strcmp( cp, expected ) == 0 );
+   free( cp );
+
+   length = strlen( expected );
+   for ( i = 0; i < length; i = i + 37 )
+   {
+      CU_ASSERT( cable_item( cable, i ) == expected[i] );
+   }
+
+   cable_dispose( &cable );
+
+   return;
+}
+
 int
 add_test_insert_cstring( void )
 {
@@ -684,6 +766,9 @@ add_test_insert_cstring( void )
    // test_insert_cstring_26
    add_test_to_suite( p_suite, test_insert_cstring_26, "test_insert_cstring_26" );
 
+   // test_insert_cstring_27
+   add_test_to_suite( p_suite, test_insert_cstring_27, "test_insert_cstring_27" );
+
    return CUE_SUCCESS;
 
 }
@@ -197,6 +197,68 @@ void test_sort_5( void )
    return;
 }
 
+/**
+   test_sort_6
+*/
+
+void test_sort_6( void )
+{
+   i_dlist_t *list = NULL;
+   int32_t i = 0;
+   int32_t value = 0;
+   int32_t count = 0;
+   int32_t ok = 1;
+
+   list = i_dlist_make();
+
+   for ( i = 0; i < 1000; i++ )
+   {
+      i_dlist_put_last( list, ( i * 7919 ) % 1009 );
+   }
+
+   i_dlist_sort( list, sort_func );
+
+   CU_ASSERT( i_dlist_count( list ) == 1000 );
+
+   value = i_dlist_first( list );
+
+   i_dlist_start( list );
+   while ( i_dlist_off( list ) == 0 )
+   {
+      if ( i_dlist_item_at( list ) > value )
+      {
+         ok = 0;
+      }
+      value = i_dlist_item_at( list );
+      count = count + 1;
+      i_dlist_forth( list );
+   }
+
+   CU_ASSERT( ok == 1 );
+   CU_ASSERT( count == 1000 );
+   CU_ASSERT( i_dlist_last( list ) == value );
+
+   count = 0;
+   i_dlist_finish( list );
+   while ( i_dlist_off( list ) == 0 )
+   {
+      if ( i_dlist_item_at( list ) < value )
+      {
+         ok = 0;
+      }
+      value = i_dlist_item_at( list );
+      count = count + 1;
+      i_dlist_back( list );
+   }
+
+   CU_ASSERT( ok == 1 );
+   CU_ASSERT( count == 1000 );
+
+   i_dlist_dispose( &list );
+
+   return;
+}
+
 int
 add_test_sort( void )
 {
@@ -227,6 +289,9 @@ add_test_sort( void )
    // test_sort_5
    add_test_to_suite( p_suite, test_sort_5, "test_sort_5" );
 
+   // test_sort_6
+   add_test_to_suite( p_suite, test_sort_6, "test_sort_6" );
+
    return CUE_SUCCESS;
 
 }
@@ -11,9 +11,9 @@ solution( name )
    project( name )
       kind "ConsoleApp"
       language "C"
-      files { "src/*.c", "../../Protocol_Base/*.c" }
+      files { "../../base/*.c", "src/*.c", "../../Protocol_Base/*.c", "../../Rng_Isaac/Rng_Isaac.c" }
       links { "cunit", "m", "rt", "gc", "gcov", "pthread" }
-      includedirs { "src", "../../base", "../../dbc", "../../Fft", "../../Protocol_Base", "../../P_Indexable", "../../P_Iterable", "../../P_Iterable_kv", "../../P_DIterable", "../../P_DIterable_kv", "../../P_Clonable", "../../P_Searcher", "../../P_Sorter", "../../Matvec"  }
+      includedirs { "src", "../../base", "../../dbc", "../../Rng_Isaac", "../../Fft", "../../Protocol_Base", "../../P_Indexable", "../../P_Iterable", "../../P_Iterable_kv", "../../P_DIterable", "../../P_DIterable_kv", "../../P_Clonable", "../../P_Searcher", "../../P_Sorter", "../../Matvec"  }
 
       -- A configuration defines one way a project can be built
       configuration "Debug"
@@ -0,0 +1,321 @@
+/**
+ @file Fft_test_fft_batch.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Fft_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Fft_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+
+#include "cf_Fft.h"
+#include "cd_Fft.h"
+
+#include "Fft_utility.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_fft_batch_1
+*/
+
+void test_fft_batch_1( void )
+{
+   cf_fft_t *fft = NULL;
+   cf_matvec_t *m = NULL;
+   cf_matvec_t *m1 = NULL;
+   cf_matvec_t *v = NULL;
+   int32_t lengths[6] = { 16, 12, 3000, 60, 7, 97 };
+   int32_t counts[3] = { 1, 3, 8 };
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+   int32_t n = 0;
+   int32_t is_equal = 0;
+
+   for ( i=0; i<6; i++ )
+   {
+      n = lengths[i];
+      fft = cf_fft_make( n );
+
+      for ( j=0; j<3; j++ )
+      {
+         m = cf_matvec_make( counts[j], n );
+         m1 = cf_matvec_make( counts[j], n );
+
+         for ( k=0; k<counts[j]; k++ )
+         {
+            v = random_input_f( n, 0 );
+            memcpy( cf_matvec_as_array( m ) + k*n, cf_matvec_as_array( v ), n*sizeof( cf_matvec_as_array( v )[0] ) );
+            cf_matvec_dispose( &v );
+         }
+
+         cf_fft_fft_batch( fft, m, m1 );
+
+         // each row is the same as from fft
+         is_equal = 1;
+         v = cf_matvec_make_column_vector( n );
+         for ( k=0; k<counts[j]; k++ )
+         {
+            memcpy( cf_matvec_as_array( v ), cf_matvec_as_array( m ) + k*n, n*sizeof( cf_matvec_as_array( v )[0] ) );
+            cf_fft_set_input( fft, v );
+            cf_fft_fft( fft );
+            memcpy( cf_matvec_as_array( v ), cf_matvec_as_array( m1 ) + k*n, n*sizeof( cf_matvec_as_array( v )[0] ) );
+            if ( cf_matvec_is_approximately_equal( cf_fft_output( fft ), v, 0.0001 ) == 0 )
+            {
+               is_equal = 0;
+            }
+         }
+
+         CU_ASSERT( is_equal == 1 );
+
+         cf_matvec_dispose( &v );
+         cf_matvec_dispose( &m );
+         cf_matvec_dispose( &m1 );
+      }
+
+      cf_fft_deep_dispose( &fft );
+   }
+
+   return;
+}
+
+/**
+   test_fft_batch_2
+*/
+
+void test_fft_batch_2( void )
+{
+   cd_fft_t *fft = NULL;
+   cd_matvec_t *m = NULL;
+   cd_matvec_t *m1 = NULL;
+   cd_matvec_t *v = NULL;
+   int32_t lengths[6] = { 16, 12, 3000, 60, 7, 97 };
+   int32_t counts[3] = { 1, 3, 8 };
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+   int32_t n = 0;
+   int32_t is_equal = 0;
+
+   for ( i=0; i<6; i++ )
+   {
+      n = lengths[i];
+      fft = cd_fft_make( n );
+
+      for ( j=0; j<3; j++ )
+      {
+         m = cd_matvec_make( counts[j], n );
+         m1 = cd_matvec_make( counts[j], n );
+
+         for ( k=0; k<counts[j]; k++ )
+         {
+            v = random_input_d( n, 0 );
+            memcpy( cd_matvec_as_array( m ) + k*n, cd_matvec_as_array( v ), n*sizeof( cd_matvec_as_array( v )[0] ) );
+            cd_matvec_dispose( &v );
+         }
+
+         cd_fft_fft_batch( fft, m, m1 );
+
+         // each row is the same as from fft
+         is_equal = 1;
+         v = cd_matvec_make_column_vector( n );
+         for ( k=0; k<counts[j]; k++ )
+         {
+            memcpy( cd_matvec_as_array( v ), cd_matvec_as_array( m ) + k*n, n*sizeof( cd_matvec_as_array( v )[0] ) );
+            cd_fft_set_input( fft, v );
+            cd_fft_fft( fft );
+            memcpy( cd_matvec_as_array( v ), cd_matvec_as_array( m1 ) + k*n, n*sizeof( cd_matvec_as_array( v )[0] ) );
+            if ( cd_matvec_is_approximately_equal( cd_fft_output( fft ), v, 0.0000001 ) == 0 )
+            {
+               is_equal = 0;
+            }
+         }
+
+         CU_ASSERT( is_equal == 1 );
+
+         cd_matvec_dispose( &v );
+         cd_matvec_dispose( &m );
+         cd_matvec_dispose( &m1 );
+      }
+
+      cd_fft_deep_dispose( &fft );
+   }
+
+   return;
+}
+
+/**
+   test_fft_batch_3
+*/
+
+void test_fft_batch_3( void )
+{
+   cf_fft_plan_t *plan = NULL;
+   cf_fft_t *fft = NULL;
+   cf_matvec_t *m = NULL;
+   cf_matvec_t *m1 = NULL;
+   cf_matvec_t *v = NULL;
+   cf_matvec_t *v1 = NULL;
+   int32_t lengths[4] = { 12, 3000, 7, 97 };
+   int32_t i = 0;
+   int32_t k = 0;
+   int32_t n = 0;
+   int32_t is_equal = 0;
+
+   for ( i=0; i<4; i++ )
+   {
+      // in place, with a shared plan
+      n = lengths[i];
+      plan = cf_fft_plan_make( n );
+      fft = cf_fft_make_from_plan( plan );
+      m = cf_matvec_make( 4, n );
+      m1 = cf_matvec_make( 4, n );
+
+      for ( k=0; k<4; k++ )
+      {
+         v = random_input_f( n, 0 );
+         memcpy( cf_matvec_as_array( m ) + k*n, cf_matvec_as_array( v ), n*sizeof( cf_matvec_as_array( v )[0] ) );
+         v1 = dft_output_f( v );
+         memcpy( cf_matvec_as_array( m1 ) + k*n, cf_matvec_as_array( v1 ), n*sizeof( cf_matvec_as_array( v1 )[0] ) );
+         cf_matvec_dispose( &v );
+         cf_matvec_dispose( &v1 );
+      }
+
+      cf_fft_fft_batch( fft, m, m );
+
+      is_equal = cf_matvec_is_approximately_equal( m, m1, 0.0001 );
+
+      CU_ASSERT( is_equal == 1 );
+
+      // a second, smaller batch reuses the work arrays
+      cf_fft_fft_batch( fft, m1, m1 );
+
+      CU_ASSERT( cf_matvec_rows( m1 ) == 4 );
+
+      cf_fft_deep_dispose( &fft );
+      cf_fft_plan_dispose( &plan );
+      cf_matvec_dispose( &m );
+      cf_matvec_dispose( &m1 );
+   }
+
+   return;
+}
+
+/**
+   test_fft_batch_4
+*/
+
+void test_fft_batch_4( void )
+{
+   cd_fft_plan_t *plan = NULL;
+   cd_fft_t *fft = NULL;
+   cd_matvec_t *m = NULL;
+   cd_matvec_t *m1 = NULL;
+   cd_matvec_t *v = NULL;
+   cd_matvec_t *v1 = NULL;
+   int32_t lengths[4] = { 12, 3000, 7, 97 };
+   int32_t i = 0;
+   int32_t k = 0;
+   int32_t n = 0;
+   int32_t is_equal = 0;
+
+   for ( i=0; i<4; i++ )
+   {
+      // in place, with a shared plan
+      n = lengths[i];
+      plan = cd_fft_plan_make( n );
+      fft = cd_fft_make_from_plan( plan );
+      m = cd_matvec_make( 4, n );
+      m1 = cd_matvec_make( 4, n );
+
+      for ( k=0; k<4; k++ )
+      {
+         v = random_input_d( n, 0 );
+         memcpy( cd_matvec_as_array( m ) + k*n, cd_matvec_as_array( v ), n*sizeof( cd_matvec_as_array( v )[0] ) );
+         v1 = dft_output_d( v );
+         memcpy( cd_matvec_as_array( m1 ) + k*n, cd_matvec_as_array( v1 ), n*sizeof( cd_matvec_as_array( v1 )[0] ) );
+         cd_matvec_dispose( &v );
+         cd_matvec_dispose( &v1 );
+      }
+
+      cd_fft_fft_batch( fft, m, m );
+
+      is_equal = cd_matvec_is_approximately_equal( m, m1, 0.0000001 );
+
+      CU_ASSERT( is_equal == 1 );
+
+      // a second, smaller batch reuses the work arrays
+      cd_fft_fft_batch( fft, m1, m1 );
+
+      CU_ASSERT( cd_matvec_rows( m1 ) == 4 );
+
+      cd_fft_deep_dispose( &fft );
+      cd_fft_plan_dispose( &plan );
+      cd_matvec_dispose( &m );
+      cd_matvec_dispose( &m1 );
+   }
+
+   return;
+}
+
+int
+add_test_fft_batch( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_fft_batch", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_fft_batch_1
+   add_test_to_suite( p_suite, test_fft_batch_1, "test_fft_batch_1" );
+
+   // test_fft_batch_2
+   add_test_to_suite( p_suite, test_fft_batch_2, "test_fft_batch_2" );
+
+   // test_fft_batch_3
+   add_test_to_suite( p_suite, test_fft_batch_3, "test_fft_batch_3" );
+
+   // test_fft_batch_4
+   add_test_to_suite( p_suite, test_fft_batch_4, "test_fft_batch_4" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -308,6 +308,76 @@ void test_inverse_fft_2( void )
 	   return;
 }
 
+/**
+   test_inverse_fft_3
+
+   lengths with factors 3 and 5, and lengths done with Bluestein
+*/
+
+void test_inverse_fft_3( void )
+{
+   cf_fft_t *cffft = NULL;
+   cf_matvec_t *v = NULL;
+   cf_matvec_t *v1 = NULL;
+   int32_t lengths[12] = { 3, 5, 6, 12, 15, 60, 3000, 7, 14, 17, 97, 1009 };
+   int32_t i = 0;
+
+   for ( i=0; i<12; i++ )
+   {
+      cffft = cf_fft_make( lengths[i] );
+
+      v = random_input_f( lengths[i], 0 );
+      v1 = dft_output_f( v );
+
+      cf_fft_set_output( cffft, v1 );
+      cf_fft_inverse_fft( cffft );
+
+      CU_ASSERT( cffft != NULL );
+      CU_ASSERT( cf_matvec_is_approximately_equal( cf_fft_input( cffft ), v, 0.0001 ) == 1 );
+
+      cf_fft_deep_dispose( &cffft );
+      cf_matvec_dispose( &v );
+      cf_matvec_dispose( &v1 );
+   }
+
+   return;
+}
+
+/**
+   test_inverse_fft_4
+
+   lengths with factors 3 and 5, and lengths done with Bluestein
+*/
+
+void test_inverse_fft_4( void )
+{
+   cd_fft_t *cdfft = NULL;
+   cd_matvec_t *v = NULL;
+   cd_matvec_t *v1 = NULL;
+   int32_t lengths[12] = { 3, 5, 6, 12, 15, 60, 3000, 7, 14, 17, 97, 1009 };
+   int32_t i = 0;
+
+   for ( i=0; i<12; i++ )
+   {
+      cdfft = cd_fft_make( lengths[i] );
+
+      v = random_input_d( lengths[i], 0 );
+      v1 = dft_output_d( v );
+
+      cd_fft_set_output( cdfft, v1 );
+      cd_fft_inverse_fft( cdfft );
+
+      CU_ASSERT( cdfft != NULL );
+      CU_ASSERT( cd_matvec_is_approximately_equal( cd_fft_input( cdfft ), v, 0.0000001 ) == 1 );
+
+      cd_fft_deep_dispose( &cdfft );
+      cd_matvec_dispose( &v );
+      cd_matvec_dispose( &v1 );
+   }
+
+   return;
+}
+
 int
 add_test_inverse_fft( void )
 {
@@ -329,6 +399,12 @@ add_test_inverse_fft( void )
    // test_inverse_fft_2
    add_test_to_suite( p_suite, test_inverse_fft_2, "test_inverse_fft_2" );
 
+   // test_inverse_fft_3
+   add_test_to_suite( p_suite, test_inverse_fft_3, "test_inverse_fft_3" );
+
+   // test_inverse_fft_4
+   add_test_to_suite( p_suite, test_inverse_fft_4, "test_inverse_fft_4" );
+
    return CUE_SUCCESS;
 
 }
@@ -0,0 +1,293 @@
+/**
+ @file Fft_test_make_from_plan.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Fft_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Fft_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+
+#include "cf_Fft.h"
+#include "cd_Fft.h"
+
+#include "Fft_utility.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_make_from_plan_1
+*/
+
+void test_make_from_plan_1( void )
+{
+   cf_fft_plan_t *plan = NULL;
+   cf_fft_t *fft = NULL;
+
+   plan = cf_fft_plan_make( 16 );
+   fft = cf_fft_make_from_plan( plan );
+
+   CU_ASSERT( fft != NULL );
+   CU_ASSERT( cf_matvec_vector_length( cf_fft_input( fft ) ) == 16 );
+
+   cf_fft_deep_dispose( &fft );
+   cf_fft_plan_dispose( &plan );
+
+   return;
+}
+
+/**
+   test_make_from_plan_2
+*/
+
+void test_make_from_plan_2( void )
+{
+   cd_fft_plan_t *plan = NULL;
+   cd_fft_t *fft = NULL;
+
+   plan = cd_fft_plan_make( 16 );
+   fft = cd_fft_make_from_plan( plan );
+
+   CU_ASSERT( fft != NULL );
+   CU_ASSERT( cd_matvec_vector_length( cd_fft_input( fft ) ) == 16 );
+
+   cd_fft_deep_dispose( &fft );
+   cd_fft_plan_dispose( &plan );
+
+   return;
+}
+
+/**
+   test_make_from_plan_3
+*/
+
+void test_make_from_plan_3( void )
+{
+   cf_fft_plan_t *plan = NULL;
+   cf_fft_t *fft1 = NULL;
+   cf_fft_t *fft2 = NULL;
+   cf_matvec_t *v = NULL;
+   cf_matvec_t *v1 = NULL;
+   int32_t lengths[6] = { 16, 12, 3000, 6, 7, 97 };
+   int32_t i = 0;
+
+   for ( i=0; i<6; i++ )
+   {
+      // two instances share one plan
+      plan = cf_fft_plan_make( lengths[i] );
+      fft1 = cf_fft_make_from_plan( plan );
+      fft2 = cf_fft_make_from_plan( plan );
+
+      v = random_input_f( lengths[i], 0 );
+      v1 = dft_output_f( v );
+
+      cf_fft_set_input( fft1, v );
+      cf_fft_fft( fft1 );
+
+      cf_fft_set_input( fft2, v );
+      cf_fft_fft( fft2 );
+
+      CU_ASSERT( cf_matvec_is_approximately_equal( cf_fft_output( fft1 ), v1, 0.0001 ) == 1 );
+      CU_ASSERT( cf_matvec_is_approximately_equal( cf_fft_output( fft2 ), v1, 0.0001 ) == 1 );
+
+      // disposing of one instance leaves the plan for the other
+      cf_fft_deep_dispose( &fft1 );
+
+      cf_fft_inverse_fft( fft2 );
+
+      CU_ASSERT( cf_matvec_is_approximately_equal( cf_fft_input( fft2 ), v, 0.0001 ) == 1 );
+
+      cf_fft_deep_dispose( &fft2 );
+      cf_fft_plan_dispose( &plan );
+      cf_matvec_dispose( &v );
+      cf_matvec_dispose( &v1 );
+   }
+
+   return;
+}
+
+/**
+   test_make_from_plan_4
+*/
+
+void test_make_from_plan_4( void )
+{
+   cd_fft_plan_t *plan = NULL;
+   cd_fft_t *fft1 = NULL;
+   cd_fft_t *fft2 = NULL;
+   cd_matvec_t *v = NULL;
+   cd_matvec_t *v1 = NULL;
+   int32_t lengths[6] = { 16, 12, 3000, 6, 7, 97 };
+   int32_t i = 0;
+
+   for ( i=0; i<6; i++ )
+   {
+      // two instances share one plan
+      plan = cd_fft_plan_make( lengths[i] );
+      fft1 = cd_fft_make_from_plan( plan );
+      fft2 = cd_fft_make_from_plan( plan );
+
+      v = random_input_d( lengths[i], 0 );
+      v1 = dft_output_d( v );
+
+      cd_fft_set_input( fft1, v );
+      cd_fft_fft( fft1 );
+
+      cd_fft_set_input( fft2, v );
+      cd_fft_fft( fft2 );
+
+      CU_ASSERT( cd_matvec_is_approximately_equal( cd_fft_output( fft1 ), v1, 0.0000001 ) == 1 );
+      CU_ASSERT( cd_matvec_is_approximately_equal( cd_fft_output( fft2 ), v1, 0.0000001 ) == 1 );
+
+      // disposing of one instance leaves the plan for the other
+      cd_fft_deep_dispose( &fft1 );
+
+      cd_fft_inverse_fft( fft2 );
+
+      CU_ASSERT( cd_matvec_is_approximately_equal( cd_fft_input( fft2 ), v, 0.0000001 ) == 1 );
+
+      cd_fft_deep_dispose( &fft2 );
+      cd_fft_plan_dispose( &plan );
+      cd_matvec_dispose( &v );
+      cd_matvec_dispose( &v1 );
+   }
+
+   return;
+}
+
+/**
+   test_make_from_plan_5
+*/
+
+void test_make_from_plan_5( void )
+{
+   cf_fft_plan_t *plan = NULL;
+   cf_fft_t *fft = NULL;
+   cf_matvec_t *v = NULL;
+   cf_matvec_t *v1 = NULL;
+   int32_t lengths[4] = { 8, 12, 3000, 14 };
+   int32_t i = 0;
+
+   for ( i=0; i<4; i++ )
+   {
+      plan = cf_fft_plan_make( lengths[i] );
+      fft = cf_fft_make_from_plan( plan );
+
+      v = random_input_f( lengths[i], 1 );
+      v1 = dft_output_f( v );
+
+      cf_fft_set_input( fft, v );
+      cf_fft_real_fft( fft );
+
+      CU_ASSERT( cf_matvec_is_approximately_equal( cf_fft_output( fft ), v1, 0.0001 ) == 1 );
+
+      cf_fft_deep_dispose( &fft );
+      cf_fft_plan_dispose( &plan );
+      cf_matvec_dispose( &v );
+      cf_matvec_dispose( &v1 );
+   }
+
+   return;
+}
+
+/**
+   test_make_from_plan_6
+*/
+
+void test_make_from_plan_6( void )
+{
+   cd_fft_plan_t *plan = NULL;
+   cd_fft_t *fft = NULL;
+   cd_matvec_t *v = NULL;
+   cd_matvec_t *v1 = NULL;
+   int32_t lengths[4] = { 8, 12, 3000, 14 };
+   int32_t i = 0;
+
+   for ( i=0; i<4; i++ )
+   {
+      plan = cd_fft_plan_make( lengths[i] );
+      fft = cd_fft_make_from_plan( plan );
+
+      v = random_input_d( lengths[i], 1 );
+      v1 = dft_output_d( v );
+
+      cd_fft_set_input( fft, v );
+      cd_fft_real_fft( fft );
+
+      CU_ASSERT( cd_matvec_is_approximately_equal( cd_fft_output( fft ), v1, 0.0000001 ) == 1 );
+
+      cd_fft_deep_dispose( &fft );
+      cd_fft_plan_dispose( &plan );
+      cd_matvec_dispose( &v );
+      cd_matvec_dispose( &v1 );
+   }
+
+   return;
+}
+
+int
+add_test_make_from_plan( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_make_from_plan", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_make_from_plan_1
+   add_test_to_suite( p_suite, test_make_from_plan_1, "test_make_from_plan_1" );
+
+   // test_make_from_plan_2
+   add_test_to_suite( p_suite, test_make_from_plan_2, "test_make_from_plan_2" );
+
+   // test_make_from_plan_3
+   add_test_to_suite( p_suite, test_make_from_plan_3, "test_make_from_plan_3" );
+
+   // test_make_from_plan_4
+   add_test_to_suite( p_suite, test_make_from_plan_4, "test_make_from_plan_4" );
+
+   // test_make_from_plan_5
+   add_test_to_suite( p_suite, test_make_from_plan_5, "test_make_from_plan_5" );
+
+   // test_make_from_plan_6
+   add_test_to_suite( p_suite, test_make_from_plan_6, "test_make_from_plan_6" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,119 @@
+/**
+ @file Fft_test_plan_make.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Fft_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Fft_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+
+#include "cf_Fft.h"
+#include "cd_Fft.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_plan_make_1
+*/
+
+void test_plan_make_1( void )
+{
+   cf_fft_plan_t *plan = NULL;
+   int32_t lengths[6] = { 16, 12, 3000, 6, 7, 97 };
+   int32_t i = 0;
+
+   for ( i=0; i<6; i++ )
+   {
+      plan = cf_fft_plan_make( lengths[i] );
+
+      CU_ASSERT( plan != NULL );
+      CU_ASSERT( cf_fft_plan_length( plan ) == lengths[i] );
+
+      cf_fft_plan_dispose( &plan );
+
+      CU_ASSERT( plan == NULL );
+   }
+
+   return;
+}
+
+/**
+   test_plan_make_2
+*/
+
+void test_plan_make_2( void )
+{
+   cd_fft_plan_t *plan = NULL;
+   int32_t lengths[6] = { 16, 12, 3000, 6, 7, 97 };
+   int32_t i = 0;
+
+   for ( i=0; i<6; i++ )
+   {
+      plan = cd_fft_plan_make( lengths[i] );
+
+      CU_ASSERT( plan != NULL );
+      CU_ASSERT( cd_fft_plan_length( plan ) == lengths[i] );
+
+      cd_fft_plan_dispose( &plan );
+
+      CU_ASSERT( plan == NULL );
+   }
+
+   return;
+}
+
+int
+add_test_plan_make( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_plan_make", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_plan_make_1
+   add_test_to_suite( p_suite, test_plan_make_1, "test_plan_make_1" );
+
+   // test_plan_make_2
+   add_test_to_suite( p_suite, test_plan_make_2, "test_plan_make_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
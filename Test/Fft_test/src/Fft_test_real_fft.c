@@ -0,0 +1,147 @@
+/**
+ @file Fft_test_real_fft.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Fft_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Fft_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+
+#include "cf_Fft.h"
+#include "cd_Fft.h"
+
+#include "Fft_utility.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_real_fft_1
+*/
+
+void test_real_fft_1( void )
+{
+   cf_fft_t *cffft = NULL;
+   cf_matvec_t *v = NULL;
+   cf_matvec_t *v1 = NULL;
+   int32_t lengths[8] = { 4, 8, 256, 6, 12, 3000, 14, 34 };
+   int32_t i = 0;
+
+   for ( i=0; i<8; i++ )
+   {
+      cffft = cf_fft_make( lengths[i] );
+
+      v = random_input_f( lengths[i], 1 );
+
+      cf_fft_set_input( cffft, v );
+      cf_fft_real_fft( cffft );
+      v1 = dft_output_f( v );
+
+      CU_ASSERT( cffft != NULL );
+      CU_ASSERT( cf_matvec_is_approximately_equal( cf_fft_output( cffft ), v1, 0.0001 ) == 1 );
+
+      // a second transform reuses the half length fft
+      cf_fft_real_fft( cffft );
+
+      CU_ASSERT( cf_matvec_is_approximately_equal( cf_fft_output( cffft ), v1, 0.0001 ) == 1 );
+
+      cf_fft_deep_dispose( &cffft );
+      cf_matvec_dispose( &v );
+      cf_matvec_dispose( &v1 );
+   }
+
+   return;
+}
+
+/**
+   test_real_fft_2
+*/
+
+void test_real_fft_2( void )
+{
+   cd_fft_t *cdfft = NULL;
+   cd_matvec_t *v = NULL;
+   cd_matvec_t *v1 = NULL;
+   int32_t lengths[8] = { 4, 8, 256, 6, 12, 3000, 14, 34 };
+   int32_t i = 0;
+
+   for ( i=0; i<8; i++ )
+   {
+      cdfft = cd_fft_make( lengths[i] );
+
+      v = random_input_d( lengths[i], 1 );
+
+      cd_fft_set_input( cdfft, v );
+      cd_fft_real_fft( cdfft );
+      v1 = dft_output_d( v );
+
+      CU_ASSERT( cdfft != NULL );
+      CU_ASSERT( cd_matvec_is_approximately_equal( cd_fft_output( cdfft ), v1, 0.0000001 ) == 1 );
+
+      // a second transform reuses the half length fft
+      cd_fft_real_fft( cdfft );
+
+      CU_ASSERT( cd_matvec_is_approximately_equal( cd_fft_output( cdfft ), v1, 0.0000001 ) == 1 );
+
+      cd_fft_deep_dispose( &cdfft );
+      cd_matvec_dispose( &v );
+      cd_matvec_dispose( &v1 );
+   }
+
+   return;
+}
+
+int
+add_test_real_fft( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_real_fft", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_real_fft_1
+   add_test_to_suite( p_suite, test_real_fft_1, "test_real_fft_1" );
+
+   // test_real_fft_2
+   add_test_to_suite( p_suite, test_real_fft_2, "test_real_fft_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
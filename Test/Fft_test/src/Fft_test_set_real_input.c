@@ -0,0 +1,125 @@
+/**
+ @file Fft_test_set_real_input.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Fft_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Fft_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+
+#include "cf_Fft.h"
+#include "cd_Fft.h"
+
+#include "Fft_utility.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_set_real_input_1
+*/
+
+void test_set_real_input_1( void )
+{
+   cf_fft_t *cffft = NULL;
+   f_matvec_t *v = NULL;
+   cf_matvec_t *v1 = NULL;
+
+   cffft = cf_fft_make( 3 );
+
+   v = f_matvec_make_from_args( 3, 1, 3, 1.0, 2.0, -3.0 );
+   v1 = cf_matvec_make_from_args( 3, 1, 3, 1.0 + 0.0*I, 2.0 + 0.0*I, -3.0 + 0.0*I );
+   cf_fft_set_real_input( cffft, v );
+
+   CU_ASSERT( cffft != NULL );
+   CU_ASSERT( v != NULL );
+   CU_ASSERT( cf_matvec_is_approximately_equal( cf_fft_input( cffft ), v1, 0.000001 ) == 1 );
+
+   cf_fft_deep_dispose( &cffft );
+   f_matvec_dispose( &v );
+   cf_matvec_dispose( &v1 );
+
+   return;
+}
+
+/**
+   test_set_real_input_2
+*/
+
+void test_set_real_input_2( void )
+{
+   cd_fft_t *cdfft = NULL;
+   d_matvec_t *v = NULL;
+   cd_matvec_t *v1 = NULL;
+
+   cdfft = cd_fft_make( 3 );
+
+   v = d_matvec_make_from_args( 3, 1, 3, 1.0, 2.0, -3.0 );
+   v1 = cd_matvec_make_from_args( 3, 1, 3, 1.0 + 0.0*I, 2.0 + 0.0*I, -3.0 + 0.0*I );
+   cd_fft_set_real_input( cdfft, v );
+
+   CU_ASSERT( cdfft != NULL );
+   CU_ASSERT( v != NULL );
+   CU_ASSERT( cd_matvec_is_approximately_equal( cd_fft_input( cdfft ), v1, 0.000001 ) == 1 );
+
+   cd_fft_deep_dispose( &cdfft );
+   d_matvec_dispose( &v );
+   cd_matvec_dispose( &v1 );
+
+   return;
+}
+
+int
+add_test_set_real_input( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_set_real_input", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_set_real_input_1
+   add_test_to_suite( p_suite, test_set_real_input_1, "test_set_real_input_1" );
+
+   // test_set_real_input_2
+   add_test_to_suite( p_suite, test_set_real_input_2, "test_set_real_input_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
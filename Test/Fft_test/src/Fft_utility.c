@@ -26,6 +26,7 @@ extern "C" {
 #include <math.h>
 
 #include "Fft_utility.h"
+#include "Rng_Isaac.h"
 
 #define PRE_FILE DBC_YES
 #define POST_FILE DBC_YES
@@ -388,6 +389,148 @@ single_bin_sinusoid_phase_degrees_d( int32_t length, int32_t i_freq, double phas
    return result;
 }
 
+/**
+   random_input_f
+
+   pseudo random values in [-1, 1], with zero imaginary parts if is_real
+*/
+
+cf_matvec_t *
+random_input_f( int32_t length, int32_t is_real )
+{
+   cf_matvec_t *result = NULL;
+   int32_t i = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+   float32_t x = 0.0;
+   float32_t y = 0.0;
+
+   result = cf_matvec_make_column_vector( length );
+
+   for ( i=0; i<length; i++ )
+   {
+      x = 2.0*rng_isaac_f32_item( rng ) - 1.0;
+      rng_isaac_forth( rng );
+      y = 2.0*rng_isaac_f32_item( rng ) - 1.0;
+      rng_isaac_forth( rng );
+
+      if ( is_real == 1 )
+      {
+         y = 0.0;
+      }
+
+      cf_matvec_vector_put( result, x + y*I, i );
+   }
+
+   rng_isaac_dispose( &rng );
+
+   return result;
+}
+
+/**
+   dft_output_f
+
+   the transform of input computed from its definition, scaled as Fft_fft
+*/
+
+cf_matvec_t *
+dft_output_f( cf_matvec_t *input )
+{
+   cf_matvec_t *result = NULL;
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t n = 0;
+   complex128_t c = 0.0;
+   float64_t x = 0.0;
+
+   n = cf_matvec_vector_length( input );
+   result = cf_matvec_make_column_vector( n );
+
+   for ( i=0; i<n; i++ )
+   {
+      c = 0.0;
+      for ( j=0; j<n; j++ )
+      {
+         x = 2.0*M_PI*( ( ( int64_t ) i*j ) % n )/( 1.0*n );
+         c = c + cf_matvec_vector_item( input, j )*( cos( x ) + sin( x )*I );
+      }
+      c = ( 2.0/n )*c;
+      cf_matvec_vector_put( result, ( complex64_t ) c, i );
+   }
+
+   return result;
+}
+
+/**
+   random_input_d
+
+   pseudo random values in [-1, 1], with zero imaginary parts if is_real
+*/
+
+cd_matvec_t *
+random_input_d( int32_t length, int32_t is_real )
+{
+   cd_matvec_t *result = NULL;
+   int32_t i = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+   float64_t x = 0.0;
+   float64_t y = 0.0;
+
+   result = cd_matvec_make_column_vector( length );
+
+   for ( i=0; i<length; i++ )
+   {
+      x = 2.0*rng_isaac_f64_item( rng ) - 1.0;
+      rng_isaac_forth( rng );
+      y = 2.0*rng_isaac_f64_item( rng ) - 1.0;
+      rng_isaac_forth( rng );
+
+      if ( is_real == 1 )
+      {
+         y = 0.0;
+      }
+
+      cd_matvec_vector_put( result, x + y*I, i );
+   }
+
+   rng_isaac_dispose( &rng );
+
+   return result;
+}
+
+/**
+   dft_output_d
+
+   the transform of input computed from its definition, scaled as Fft_fft
+*/
+
+cd_matvec_t *
+dft_output_d( cd_matvec_t *input )
+{
+   cd_matvec_t *result = NULL;
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t n = 0;
+   complex128_t c = 0.0;
+   float64_t x = 0.0;
+
+   n = cd_matvec_vector_length( input );
+   result = cd_matvec_make_column_vector( n );
+
+   for ( i=0; i<n; i++ )
+   {
+      c = 0.0;
+      for ( j=0; j<n; j++ )
+      {
+         x = 2.0*M_PI*( ( ( int64_t ) i*j ) % n )/( 1.0*n );
+         c = c + cd_matvec_vector_item( input, j )*( cos( x ) + sin( x )*I );
+      }
+      c = ( 2.0/n )*c;
+      cd_matvec_vector_put( result, ( complex128_t ) c, i );
+   }
+
+   return result;
+}
+
 #ifdef __cplusplus
 }
 #endif
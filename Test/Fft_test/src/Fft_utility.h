@@ -74,6 +74,19 @@ d_matvec_t *
 single_bin_sinusoid_phase_degrees_d( int32_t length, int32_t i_freq, double phase_fraction );
 
 
+cf_matvec_t *
+random_input_f( int32_t length, int32_t is_real );
+
+cf_matvec_t *
+dft_output_f( cf_matvec_t *input );
+
+cd_matvec_t *
+random_input_d( int32_t length, int32_t is_real );
+
+cd_matvec_t *
+dft_output_d( cd_matvec_t *input );
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -16,6 +16,12 @@ extern "C" {
 int
 add_test_make( void );
 
+int
+add_test_plan_make( void );
+
+int
+add_test_make_from_plan( void );
+
 int
 add_test_dispose( void );
 
@@ -34,12 +40,21 @@ add_test_set_input( void );
 int
 add_test_set_output( void );
 
+int
+add_test_set_real_input( void );
+
 int
 add_test_fft( void );
 
 int
 add_test_inverse_fft( void );
 
+int
+add_test_real_fft( void );
+
+int
+add_test_fft_batch( void );
+
 int
 add_test_psd( void );
 
@@ -93,14 +108,19 @@ int main()
    // add tests for DList_make
 
    add_test_make();
+   add_test_plan_make();
+   add_test_make_from_plan();
    add_test_dispose();
    add_test_deep_dispose();
    add_test_input();
    add_test_output();
    add_test_set_input();
    add_test_set_output();
+   add_test_set_real_input();
    add_test_fft();
    add_test_inverse_fft();
+   add_test_real_fft();
+   add_test_fft_batch();
    add_test_psd();
    add_test_log_psd();
    add_test_phase();
@@ -0,0 +1,28 @@
+#!lua
+
+local name = "HTable_flat_test"
+
+-- A solution contains projects, and defines the available configurations
+solution( name )
+   configurations { "Debug", "Release" }
+   location "build"
+
+   -- A project defines one build target
+   project( name )
+      kind "ConsoleApp"
+      language "C"
+      files { "src/*.c", "../../Protocol_Base/*.c", "../../String/*.c" }
+      links { "cunit", "m", "rt", "gc", "gcov", "pthread" }
+      includedirs { "src", "../../base", "../../dbc", "../../HTable_flat", "../../Protocol_Base", "../../P_Indexable", "../../P_Iterable", "../../P_Iterable_kv", "../../P_DIterable", "../../P_DIterable_kv", "../../P_Basic", "../../P_Searcher", "../../P_Sorter", "../../String"  }
+
+      -- A configuration defines one way a project can be built
+      configuration "Debug"
+         defines { "DEBUG" }
+         flags { "Symbols" }
+         buildoptions { "-O0", "-g3", "-Wall", "-ftest-coverage", "-fprofile-arcs" }
+
+      configuration "Release"
+         defines { "NDEBUG" }
+         flags { "Optimize" }
+
+
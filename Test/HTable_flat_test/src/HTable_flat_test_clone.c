@@ -0,0 +1,114 @@
+/**
+ @file HTable_flat_test_clone.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for HTable_flat_clone"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for HTable_flat_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "ii_HTable_flat.h"
+#include "ss_HTable_flat.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_clone_1
+*/
+
+void test_clone_1( void )
+{
+   ii_htable_flat_t *htable = NULL;
+   ii_htable_flat_t *htable1 = NULL;
+
+   htable = ii_htable_flat_make();
+   ii_htable_flat_put( htable, 10, 1 );
+   ii_htable_flat_put( htable, 20, 2 );
+
+   htable1 = ii_htable_flat_clone( htable );
+
+   CU_ASSERT( ii_htable_flat_count( htable1 ) == 2 );
+   CU_ASSERT( ii_htable_flat_item( htable1, 2 ) == 20 );
+   CU_ASSERT( ii_htable_flat_is_equal( htable, htable1 ) == 1 );
+
+   ii_htable_flat_dispose( &htable );
+   ii_htable_flat_dispose( &htable1 );
+
+   return;
+}
+
+/**
+   test_clone_2
+*/
+
+void test_clone_2( void )
+{
+   ss_htable_flat_t *htable = NULL;
+   ss_htable_flat_t *htable1 = NULL;
+
+   string_t *k1 = string_make_from_cstring( "k1" );
+   string_t *v1 = string_make_from_cstring( "v1" );
+
+   htable = ss_htable_flat_make();
+   ss_htable_flat_put( htable, v1, k1 );
+
+   htable1 = ss_htable_flat_clone( htable );
+
+   CU_ASSERT( ss_htable_flat_count( htable1 ) == 1 );
+   CU_ASSERT( ss_htable_flat_item( htable1, k1 ) == v1 );
+
+   ss_htable_flat_deep_dispose( &htable );
+   ss_htable_flat_dispose( &htable1 );
+
+   return;
+}
+
+int
+add_test_clone( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_clone", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_clone_1
+   add_test_to_suite( p_suite, test_clone_1, "test_clone_1" );
+
+   // test_clone_2
+   add_test_to_suite( p_suite, test_clone_2, "test_clone_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
@@ -0,0 +1,93 @@
+/**
+ @file HTable_flat_test_is_equal.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for HTable_flat_is_equal"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for HTable_flat_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "ii_HTable_flat.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_is_equal_1
+*/
+
+void test_is_equal_1( void )
+{
+   ii_htable_flat_t *htable = NULL;
+   ii_htable_flat_t *htable1 = NULL;
+
+   htable = ii_htable_flat_make();
+   htable1 = ii_htable_flat_make_n( 1000 );
+
+   ii_htable_flat_put( htable, 10, 1 );
+   ii_htable_flat_put( htable, 20, 2 );
+   ii_htable_flat_put( htable1, 20, 2 );
+
+   CU_ASSERT( ii_htable_flat_is_equal( htable, htable1 ) == 0 );
+
+   ii_htable_flat_put( htable1, 10, 1 );
+
+   CU_ASSERT( ii_htable_flat_is_equal( htable, htable1 ) == 1 );
+   CU_ASSERT( ii_htable_flat_is_equal( htable, htable ) == 1 );
+
+   ii_htable_flat_put( htable1, 11, 1 );
+
+   CU_ASSERT( ii_htable_flat_is_equal( htable, htable1 ) == 0 );
+   CU_ASSERT( ii_htable_flat_is_deep_equal( htable, htable1 ) == 0 );
+
+   ii_htable_flat_dispose( &htable );
+   ii_htable_flat_dispose( &htable1 );
+
+   return;
+}
+
+int
+add_test_is_equal( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_is_equal", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_is_equal_1
+   add_test_to_suite( p_suite, test_is_equal_1, "test_is_equal_1" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
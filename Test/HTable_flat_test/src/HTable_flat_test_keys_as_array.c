@@ -0,0 +1,94 @@
+/**
+ @file HTable_flat_test_keys_as_array.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for HTable_flat_keys_as_array"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for HTable_flat_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "ii_HTable_flat.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_keys_as_array_1
+*/
+
+void test_keys_as_array_1( void )
+{
+   ii_htable_flat_t *htable = NULL;
+   int32_t *keys = NULL;
+   int32_t *values = NULL;
+   int32_t i = 0;
+   int32_t sum = 0;
+
+   htable = ii_htable_flat_make();
+   ii_htable_flat_put( htable, 10, 1 );
+   ii_htable_flat_put( htable, 20, 2 );
+   ii_htable_flat_put( htable, 30, 3 );
+
+   keys = ii_htable_flat_keys_as_array( htable );
+   values = ii_htable_flat_values_as_array( htable );
+
+   for ( i = 0; i < 3; i++ )
+   {
+      CU_ASSERT( values[i] == keys[i]*10 );
+      sum = sum + keys[i];
+   }
+
+   CU_ASSERT( sum == 6 );
+
+   free( keys );
+   free( values );
+   ii_htable_flat_dispose( &htable );
+
+   return;
+}
+
+int
+add_test_keys_as_array( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_keys_as_array", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_keys_as_array_1
+   add_test_to_suite( p_suite, test_keys_as_array_1, "test_keys_as_array_1" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
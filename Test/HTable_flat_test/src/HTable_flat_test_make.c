@@ -0,0 +1,79 @@
+/**
+ @file HTable_flat_test_make.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for HTable_flat_make"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for HTable_flat_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "ii_HTable_flat.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_make_1
+*/
+
+void test_make_1( void )
+{
+   ii_htable_flat_t *htable = NULL;
+
+   htable = ii_htable_flat_make();
+
+   CU_ASSERT( htable != NULL );
+   CU_ASSERT( ii_htable_flat_count( htable ) == 0 );
+   CU_ASSERT( ii_htable_flat_capacity( htable ) == 16 );
+   CU_ASSERT( ii_htable_flat_off( htable ) == 1 );
+
+   ii_htable_flat_dispose( &htable );
+
+   return;
+}
+
+int
+add_test_make( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_make", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_make_1
+   add_test_to_suite( p_suite, test_make_1, "test_make_1" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
@@ -0,0 +1,101 @@
+/**
+ @file HTable_flat_test_make_n.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for HTable_flat_make_n"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for HTable_flat_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "ii_HTable_flat.h"
+#include "ss_HTable_flat.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_make_n_1
+*/
+
+void test_make_n_1( void )
+{
+   ii_htable_flat_t *htable = NULL;
+
+   htable = ii_htable_flat_make_n( 100 );
+
+   CU_ASSERT( htable != NULL );
+   CU_ASSERT( ii_htable_flat_count( htable ) == 0 );
+   CU_ASSERT( ii_htable_flat_capacity( htable ) == 128 );
+
+   ii_htable_flat_dispose( &htable );
+
+   return;
+}
+
+/**
+   test_make_n_2
+*/
+
+void test_make_n_2( void )
+{
+   ss_htable_flat_t *htable = NULL;
+
+   htable = ss_htable_flat_make_n( 0 );
+
+   CU_ASSERT( htable != NULL );
+   CU_ASSERT( ss_htable_flat_count( htable ) == 0 );
+   CU_ASSERT( ss_htable_flat_capacity( htable ) == 8 );
+
+   ss_htable_flat_dispose( &htable );
+
+   return;
+}
+
+int
+add_test_make_n( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_make_n", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_make_n_1
+   add_test_to_suite( p_suite, test_make_n_1, "test_make_n_1" );
+
+   // test_make_n_2
+   add_test_to_suite( p_suite, test_make_n_2, "test_make_n_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
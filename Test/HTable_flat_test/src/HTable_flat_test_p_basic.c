@@ -0,0 +1,86 @@
+/**
+ @file HTable_flat_test_p_basic.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for HTable_flat_p_basic"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for HTable_flat_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "ii_HTable_flat.h"
+#include "Protocol_Base.h"
+#include "i_Basic.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_p_basic_1
+*/
+
+void test_p_basic_1( void )
+{
+   ii_htable_flat_t *htable = NULL;
+   protocol_base_t *pb_htable = NULL;
+   protocol_base_t *pb_htable1 = NULL;
+
+   htable = ii_htable_flat_make();
+   ii_htable_flat_put( htable, 10, 1 );
+   pb_htable = ( protocol_base_t * ) htable;
+
+   pb_htable1 = i_basic_clone( pb_htable );
+
+   CU_ASSERT( pb_htable1 != NULL );
+   CU_ASSERT( i_basic_is_equal( pb_htable, pb_htable1 ) == 1 );
+
+   i_basic_dispose( &pb_htable );
+   i_basic_deep_dispose( &pb_htable1 );
+
+   return;
+}
+
+int
+add_test_p_basic( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_p_basic", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_p_basic_1
+   add_test_to_suite( p_suite, test_p_basic_1, "test_p_basic_1" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
@@ -0,0 +1,94 @@
+/**
+ @file HTable_flat_test_p_iterable_kv.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for HTable_flat_p_iterable_kv"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for HTable_flat_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "ii_HTable_flat.h"
+#include "Protocol_Base.h"
+#include "ii_Iterable_kv.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_p_iterable_kv_1
+*/
+
+void test_p_iterable_kv_1( void )
+{
+   ii_htable_flat_t *htable = NULL;
+   protocol_base_t *pb_htable = NULL;
+
+   htable = ii_htable_flat_make();
+   pb_htable = ( protocol_base_t * ) htable;
+
+   CU_ASSERT( ii_iterable_kv_is_empty( pb_htable ) == 1 );
+
+   ii_htable_flat_put( htable, 24, 240 );
+
+   CU_ASSERT( ii_iterable_kv_count( pb_htable ) == 1 );
+   CU_ASSERT( ii_iterable_kv_off( pb_htable ) == 1 );
+
+   ii_iterable_kv_start( pb_htable );
+
+   CU_ASSERT( ii_iterable_kv_key( pb_htable ) == 240 );
+   CU_ASSERT( ii_iterable_kv_value( pb_htable ) == 24 );
+
+   ii_iterable_kv_forth( pb_htable );
+
+   CU_ASSERT( ii_iterable_kv_off( pb_htable ) == 1 );
+
+   ii_htable_flat_dispose( &htable );
+
+   return;
+}
+
+int
+add_test_p_iterable_kv( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_p_iterable_kv", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_p_iterable_kv_1
+   add_test_to_suite( p_suite, test_p_iterable_kv_1, "test_p_iterable_kv_1" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
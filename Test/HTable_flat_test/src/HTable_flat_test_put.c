@@ -0,0 +1,147 @@
+/**
+ @file HTable_flat_test_put.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for HTable_flat_put"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for HTable_flat_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "ii_HTable_flat.h"
+#include "ss_HTable_flat.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_put_1
+*/
+
+void test_put_1( void )
+{
+   ii_htable_flat_t *htable = NULL;
+   int32_t i = 0;
+   int32_t flag = 1;
+
+   htable = ii_htable_flat_make();
+
+   // grow several times, including negative keys
+   for ( i = -500; i < 500; i++ )
+   {
+      ii_htable_flat_put( htable, i*10, i );
+   }
+
+   CU_ASSERT( ii_htable_flat_count( htable ) == 1000 );
+   CU_ASSERT( ii_htable_flat_capacity( htable ) == 2048 );
+
+   for ( i = -500; i < 500; i++ )
+   {
+      if ( ii_htable_flat_item( htable, i ) != i*10 )
+      {
+         flag = 0;
+      }
+   }
+
+   CU_ASSERT( flag == 1 );
+
+   // replace existing value
+   ii_htable_flat_put( htable, 7, 3 );
+
+   CU_ASSERT( ii_htable_flat_count( htable ) == 1000 );
+   CU_ASSERT( ii_htable_flat_item( htable, 3 ) == 7 );
+
+   ii_htable_flat_dispose( &htable );
+
+   return;
+}
+
+/**
+   test_put_2
+*/
+
+void test_put_2( void )
+{
+   ss_htable_flat_t *htable = NULL;
+   int32_t i = 0;
+   int32_t flag = 1;
+   char_t buffer[32] = {0};
+   string_t *k = NULL;
+
+   htable = ss_htable_flat_make();
+
+   for ( i = 0; i < 300; i++ )
+   {
+      sprintf( buffer, "key_%d", i );
+      ss_htable_flat_put( htable, string_make_from_cstring( buffer ), string_make_from_cstring( buffer ) );
+   }
+
+   CU_ASSERT( ss_htable_flat_count( htable ) == 300 );
+
+   for ( i = 0; i < 300; i++ )
+   {
+      sprintf( buffer, "key_%d", i );
+      k = string_make_from_cstring( buffer );
+
+      if ( string_is_deep_equal( ss_htable_flat_item( htable, k ), k ) == 0 )
+      {
+         flag = 0;
+      }
+
+      string_deep_dispose( &k );
+   }
+
+   CU_ASSERT( flag == 1 );
+
+   ss_htable_flat_deep_dispose( &htable );
+
+   return;
+}
+
+int
+add_test_put( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_put", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_put_1
+   add_test_to_suite( p_suite, test_put_1, "test_put_1" );
+
+   // test_put_2
+   add_test_to_suite( p_suite, test_put_2, "test_put_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
@@ -0,0 +1,99 @@
+/**
+ @file HTable_flat_test_remove.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for HTable_flat_remove"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for HTable_flat_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "ii_HTable_flat.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_remove_1
+*/
+
+void test_remove_1( void )
+{
+   ii_htable_flat_t *htable = NULL;
+   int32_t i = 0;
+   int32_t flag = 1;
+
+   htable = ii_htable_flat_make();
+
+   for ( i = 0; i < 1000; i++ )
+   {
+      ii_htable_flat_put( htable, i*10, i );
+   }
+
+   // remove every third item, shifting probe sequences back
+   for ( i = 0; i < 1000; i = i + 3 )
+   {
+      ii_htable_flat_remove( htable, i );
+   }
+
+   CU_ASSERT( ii_htable_flat_count( htable ) == 666 );
+
+   for ( i = 0; i < 1000; i++ )
+   {
+      if ( ii_htable_flat_has( htable, i ) != ( ( i % 3 ) != 0 ) )
+      {
+         flag = 0;
+      }
+   }
+
+   CU_ASSERT( flag == 1 );
+
+   ii_htable_flat_dispose( &htable );
+
+   return;
+}
+
+int
+add_test_remove( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_remove", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_remove_1
+   add_test_to_suite( p_suite, test_remove_1, "test_remove_1" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
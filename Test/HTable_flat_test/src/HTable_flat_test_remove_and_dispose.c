@@ -0,0 +1,88 @@
+/**
+ @file HTable_flat_test_remove_and_dispose.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for HTable_flat_remove_and_dispose"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for HTable_flat_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "ii_HTable_flat.h"
+#include "ss_HTable_flat.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_remove_and_dispose_1
+*/
+
+void test_remove_and_dispose_1( void )
+{
+   ss_htable_flat_t *htable = NULL;
+
+   string_t *k1 = string_make_from_cstring( "k1" );
+   string_t *k2 = string_make_from_cstring( "k2" );
+   string_t *k = string_make_from_cstring( "k1" );
+
+   htable = ss_htable_flat_make();
+   ss_htable_flat_put( htable, string_make_from_cstring( "v1" ), k1 );
+   ss_htable_flat_put( htable, string_make_from_cstring( "v2" ), k2 );
+
+   ss_htable_flat_remove_and_dispose( htable, k );
+
+   CU_ASSERT( ss_htable_flat_count( htable ) == 1 );
+   CU_ASSERT( ss_htable_flat_has( htable, k ) == 0 );
+   CU_ASSERT( ss_htable_flat_has( htable, k2 ) == 1 );
+
+   string_deep_dispose( &k );
+   ss_htable_flat_deep_dispose( &htable );
+
+   return;
+}
+
+int
+add_test_remove_and_dispose( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_remove_and_dispose", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_remove_and_dispose_1
+   add_test_to_suite( p_suite, test_remove_and_dispose_1, "test_remove_and_dispose_1" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
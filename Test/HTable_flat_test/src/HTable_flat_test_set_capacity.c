@@ -0,0 +1,91 @@
+/**
+ @file HTable_flat_test_set_capacity.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for HTable_flat_set_capacity"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for HTable_flat_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "ii_HTable_flat.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_set_capacity_1
+*/
+
+void test_set_capacity_1( void )
+{
+   ii_htable_flat_t *htable = NULL;
+   int32_t i = 0;
+
+   htable = ii_htable_flat_make();
+
+   for ( i = 0; i < 10; i++ )
+   {
+      ii_htable_flat_put( htable, i*10, i );
+   }
+
+   ii_htable_flat_set_capacity( htable, 1000 );
+
+   CU_ASSERT( ii_htable_flat_capacity( htable ) == 2048 );
+   CU_ASSERT( ii_htable_flat_item( htable, 9 ) == 90 );
+
+   ii_htable_flat_set_capacity( htable, 10 );
+
+   CU_ASSERT( ii_htable_flat_capacity( htable ) == 16 );
+   CU_ASSERT( ii_htable_flat_count( htable ) == 10 );
+   CU_ASSERT( ii_htable_flat_item( htable, 9 ) == 90 );
+
+   ii_htable_flat_dispose( &htable );
+
+   return;
+}
+
+int
+add_test_set_capacity( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_set_capacity", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_set_capacity_1
+   add_test_to_suite( p_suite, test_set_capacity_1, "test_set_capacity_1" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
@@ -0,0 +1,103 @@
+/**
+ @file HTable_flat_test_start.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for HTable_flat_start"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for HTable_flat_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "ii_HTable_flat.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_start_1
+*/
+
+void test_start_1( void )
+{
+   ii_htable_flat_t *htable = NULL;
+   int32_t sum = 0;
+   int32_t n = 0;
+
+   htable = ii_htable_flat_make();
+
+   ii_htable_flat_start( htable );
+
+   CU_ASSERT( ii_htable_flat_off( htable ) == 1 );
+
+   ii_htable_flat_put( htable, 10, 1 );
+   ii_htable_flat_put( htable, 20, 2 );
+   ii_htable_flat_put( htable, 30, 3 );
+
+   ii_htable_flat_start( htable );
+
+   while ( ii_htable_flat_off( htable ) == 0 )
+   {
+      CU_ASSERT( ii_htable_flat_item_at( htable ) == ii_htable_flat_key_at( htable )*10 );
+      sum = sum + ii_htable_flat_key_at( htable );
+      n = n + 1;
+      ii_htable_flat_forth( htable );
+   }
+
+   CU_ASSERT( n == 3 );
+   CU_ASSERT( sum == 6 );
+
+   // new key sets the cursor off
+   ii_htable_flat_start( htable );
+   ii_htable_flat_put( htable, 40, 4 );
+
+   CU_ASSERT( ii_htable_flat_off( htable ) == 1 );
+
+   ii_htable_flat_dispose( &htable );
+
+   return;
+}
+
+int
+add_test_start( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_start", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_start_1
+   add_test_to_suite( p_suite, test_start_1, "test_start_1" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
@@ -0,0 +1,105 @@
+/**
+ @file HTable_flat_test_wipe_out.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for HTable_flat_wipe_out"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for HTable_flat_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "ii_HTable_flat.h"
+#include "ss_HTable_flat.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_wipe_out_1
+*/
+
+void test_wipe_out_1( void )
+{
+   ii_htable_flat_t *htable = NULL;
+
+   htable = ii_htable_flat_make();
+   ii_htable_flat_put( htable, 10, 1 );
+   ii_htable_flat_put( htable, 20, 2 );
+
+   ii_htable_flat_wipe_out( htable );
+
+   CU_ASSERT( ii_htable_flat_count( htable ) == 0 );
+   CU_ASSERT( ii_htable_flat_has( htable, 1 ) == 0 );
+
+   ii_htable_flat_dispose( &htable );
+
+   return;
+}
+
+/**
+   test_wipe_out_2
+*/
+
+void test_wipe_out_2( void )
+{
+   ss_htable_flat_t *htable = NULL;
+
+   htable = ss_htable_flat_make();
+   ss_htable_flat_put( htable, string_make_from_cstring( "v1" ), string_make_from_cstring( "k1" ) );
+
+   ss_htable_flat_wipe_out_and_dispose( htable );
+
+   CU_ASSERT( ss_htable_flat_count( htable ) == 0 );
+
+   ss_htable_flat_dispose( &htable );
+
+   return;
+}
+
+int
+add_test_wipe_out( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_wipe_out", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_wipe_out_1
+   add_test_to_suite( p_suite, test_wipe_out_1, "test_wipe_out_1" );
+
+   // test_wipe_out_2
+   add_test_to_suite( p_suite, test_wipe_out_2, "test_wipe_out_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
@@ -0,0 +1,97 @@
+/**
+ @file HTable_test_max_load_factor.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for HTable_max_load_factor"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for HTable_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "ii_HTable.h"
+#include "ss_HTable.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_max_load_factor_1
+*/
+
+void test_max_load_factor_1( void )
+{
+   ii_htable_t *htable = NULL;
+
+   htable = ii_htable_make();
+
+   CU_ASSERT( ii_htable_max_load_factor( htable ) == 1.0 );
+
+   ii_htable_dispose( &htable );
+
+   return;
+}
+
+/**
+   test_max_load_factor_2
+*/
+
+void test_max_load_factor_2( void )
+{
+   ss_htable_t *htable = NULL;
+
+   htable = ss_htable_make_n( 23 );
+
+   CU_ASSERT( ss_htable_max_load_factor( htable ) == 1.0 );
+
+   ss_htable_dispose( &htable );
+
+   return;
+}
+
+int
+add_test_max_load_factor( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_max_load_factor", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_max_load_factor_1
+   add_test_to_suite( p_suite, test_max_load_factor_1, "test_max_load_factor_1" );
+
+   // test_max_load_factor_2
+   add_test_to_suite( p_suite, test_max_load_factor_2, "test_max_load_factor_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
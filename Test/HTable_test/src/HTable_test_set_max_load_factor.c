@@ -0,0 +1,238 @@
+/**
+ @file HTable_test_set_max_load_factor.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for HTable_set_max_load_factor"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for HTable_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "ii_HTable.h"
+#include "ss_HTable.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_set_max_load_factor_1
+*/
+
+void test_set_max_load_factor_1( void )
+{
+   ii_htable_t *htable = NULL;
+
+   htable = ii_htable_make();
+
+   ii_htable_set_max_load_factor( htable, 2.5 );
+
+   CU_ASSERT( ii_htable_max_load_factor( htable ) == 2.5 );
+   CU_ASSERT( ii_htable_bucket_count( htable ) == 13 );
+
+   ii_htable_dispose( &htable );
+
+   return;
+}
+
+/**
+   test_set_max_load_factor_2
+*/
+
+void test_set_max_load_factor_2( void )
+{
+   ii_htable_t *htable = NULL;
+   int32_t i = 0;
+   int32_t flag = 1;
+
+   htable = ii_htable_make();
+
+   // grow automatically, check items while buckets are being migrated
+   for ( i = 0; i < 1000; i++ )
+   {
+      ii_htable_put( htable, i*10, i );
+
+      if ( ( ii_htable_has( htable, i/2 ) == 0 ) || ( ii_htable_item( htable, i/2 ) != (i/2)*10 ) )
+      {
+         flag = 0;
+      }
+   }
+
+   CU_ASSERT( flag == 1 );
+   CU_ASSERT( ii_htable_count( htable ) == 1000 );
+   CU_ASSERT( ii_htable_bucket_count( htable ) > 500 );
+
+   // remove while buckets are being migrated
+   for ( i = 0; i < 1000; i = i + 2 )
+   {
+      ii_htable_remove( htable, i );
+   }
+
+   CU_ASSERT( ii_htable_count( htable ) == 500 );
+
+   flag = 1;
+   for ( i = 0; i < 1000; i++ )
+   {
+      if ( ii_htable_has( htable, i ) != ( i % 2 ) )
+      {
+         flag = 0;
+      }
+   }
+
+   CU_ASSERT( flag == 1 );
+
+   // sequence order is unchanged by growth
+   ii_htable_start( htable );
+   CU_ASSERT( ii_htable_key_at( htable ) == 1 );
+
+   ii_htable_dispose( &htable );
+
+   return;
+}
+
+/**
+   test_set_max_load_factor_3
+*/
+
+void test_set_max_load_factor_3( void )
+{
+   ii_htable_t *htable = NULL;
+   int32_t i = 0;
+
+   htable = ii_htable_make();
+
+   for ( i = 0; i < 20; i++ )
+   {
+      ii_htable_put( htable, i*10, i );
+   }
+
+   ii_htable_set_max_load_factor( htable, 4.0 );
+   ii_htable_set_bucket_count( htable, 5 );
+
+   CU_ASSERT( ii_htable_bucket_count( htable ) == 5 );
+
+   // lower max load factor starts a resize
+   ii_htable_set_max_load_factor( htable, 0.5 );
+
+   CU_ASSERT( ii_htable_bucket_count( htable ) == 11 );
+   CU_ASSERT( ii_htable_item( htable, 7 ) == 70 );
+
+   ii_htable_wipe_out( htable );
+
+   CU_ASSERT( ii_htable_count( htable ) == 0 );
+   CU_ASSERT( ii_htable_has( htable, 7 ) == 0 );
+
+   ii_htable_put( htable, 70, 7 );
+
+   CU_ASSERT( ii_htable_item( htable, 7 ) == 70 );
+
+   ii_htable_dispose( &htable );
+
+   return;
+}
+
+/**
+   test_set_max_load_factor_4
+*/
+
+void test_set_max_load_factor_4( void )
+{
+   ss_htable_t *htable = NULL;
+   int32_t i = 0;
+   int32_t flag = 1;
+   char_t buffer[32] = {0};
+   string_t *k = NULL;
+
+   htable = ss_htable_make();
+
+   for ( i = 0; i < 200; i++ )
+   {
+      sprintf( buffer, "k%d", i );
+      ss_htable_put( htable, string_make_from_cstring( buffer ), string_make_from_cstring( buffer ) );
+   }
+
+   CU_ASSERT( ss_htable_count( htable ) == 200 );
+   CU_ASSERT( ss_htable_bucket_count( htable ) > 100 );
+
+   for ( i = 0; i < 200; i++ )
+   {
+      sprintf( buffer, "k%d", i );
+      k = string_make_from_cstring( buffer );
+
+      if ( ss_htable_has( htable, k ) == 0 )
+      {
+         flag = 0;
+      }
+
+      string_deep_dispose( &k );
+   }
+
+   CU_ASSERT( flag == 1 );
+
+   for ( i = 0; i < 200; i = i + 3 )
+   {
+      sprintf( buffer, "k%d", i );
+      k = string_make_from_cstring( buffer );
+      ss_htable_remove_and_dispose( htable, k );
+      string_deep_dispose( &k );
+   }
+
+   CU_ASSERT( ss_htable_count( htable ) == 133 );
+
+   ss_htable_deep_dispose( &htable );
+
+   return;
+}
+
+int
+add_test_set_max_load_factor( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_set_max_load_factor", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_set_max_load_factor_1
+   add_test_to_suite( p_suite, test_set_max_load_factor_1, "test_set_max_load_factor_1" );
+
+   // test_set_max_load_factor_2
+   add_test_to_suite( p_suite, test_set_max_load_factor_2, "test_set_max_load_factor_2" );
+
+   // test_set_max_load_factor_3
+   add_test_to_suite( p_suite, test_set_max_load_factor_3, "test_set_max_load_factor_3" );
+
+   // test_set_max_load_factor_4
+   add_test_to_suite( p_suite, test_set_max_load_factor_4, "test_set_max_load_factor_4" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
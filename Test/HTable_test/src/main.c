@@ -139,6 +139,12 @@ add_test_wipe_out_and_dispose( void );
 int
 add_test_set_bucket_count( void );
 
+int
+add_test_max_load_factor( void );
+
+int
+add_test_set_max_load_factor( void );
+
 int
 add_test_p_basic( void );
 
@@ -227,6 +233,8 @@ int main()
    add_test_wipe_out();
    add_test_wipe_out_and_dispose();
    add_test_set_bucket_count();
+   add_test_max_load_factor();
+   add_test_set_max_load_factor();
 
    add_test_p_basic();
    add_test_p_iterable_kv();
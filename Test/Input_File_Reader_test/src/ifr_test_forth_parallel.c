@@ -0,0 +1,338 @@
+/**
+ @file ifr_test_forth_parallel.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for ifr_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for ifr_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+ 
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "Input_File_Reader.h"
+#include "String_utilities.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+static char_t *file_names[] =
+{
+   "src/input_files/f_empty.txt",
+   "src/input_files/f_multiline.txt",
+   "src/input_files/f_one_line.txt",
+   "src/input_files/f_one_line_comment.txt",
+   "src/input_files/f_quotes.txt",
+   "src/input_files/f_three_line.txt",
+   "src/input_files/f_two_line.txt"
+};
+
+#define LARGE_FILE_NAME "src/input_files/f_large.txt"
+#define LARGE_LINE_COUNT 200000
+
+/**
+   write_large_file
+
+   write a file of several chunks, with blank lines, comment lines, quoted
+   tokens and a last line with no end of line
+*/
+
+static
+void
+write_large_file( void )
+{
+   int32_t i = 0;
+   FILE *fp = NULL;
+   
+   fp = fopen( LARGE_FILE_NAME, "w" );
+   
+   for ( i = 0; i < LARGE_LINE_COUNT; i++ )
+   {
+      if ( i % 17 == 0 )
+      {
+         fprintf( fp, "-- comment %d\n", i );
+      }
+      else if ( i % 23 == 0 )
+      {
+         fprintf( fp, "\n" );
+      }
+      else
+      {
+         fprintf( fp, "line_%d %d \"quoted %d\" %d // note\n", i, i * 3, i % 7, i % 11 );
+      }
+   }
+   
+   fprintf( fp, "last line" );
+   fclose( fp );
+   
+   return;
+}
+
+/**
+   hash_line
+
+   Return a hash of the token slices of the most recently processed line
+*/
+
+static
+uint32_t
+hash_line( ifr_t *ifr )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   uint32_t result = 2166136261u;
+   ifr_slice_t *slices = ifr_slices( ifr );
+   
+   for ( i = 0; i < ifr_slice_count( ifr ); i++ )
+   {
+      for ( j = 0; j < slices[i].count; j++ )
+      {
+         result = ( result ^ ( uint8_t ) slices[i].base[j] ) * 16777619u;
+      }
+      result = ( result ^ 0xffu ) * 16777619u;
+   }
+   
+   return result;
+}
+
+/**
+   is_same_as_slices
+
+   Return 1 if an ordered parallel reader gives the same tokens, lines, line
+   numbers and end of file as a slice reader, line by line
+*/
+
+static
+int32_t
+is_same_as_slices( char_t *file_name, int32_t thread_count, int32_t is_skip_comments )
+{
+   int32_t result = 1;
+   ifr_t *ifr = NULL;
+   ifr_t *ifr_p = NULL;
+   
+   ifr = ifr_make_slices_cstring( file_name );
+   ifr_put_is_skip_comments( ifr, is_skip_comments );
+   
+   ifr_p = ifr_make_parallel_cstring( file_name, thread_count, 1 );
+   ifr_put_is_skip_comments( ifr_p, is_skip_comments );
+   
+   while ( ( result == 1 ) && ( ifr_eof( ifr ) == 0 ) )
+   {
+      ifr_forth_slices( ifr );
+      ifr_forth_slices( ifr_p );
+      
+      result
+         =  ( ifr_slice_count( ifr ) == ifr_slice_count( ifr_p ) )
+            &&
+            ( hash_line( ifr ) == hash_line( ifr_p ) )
+            &&
+            ( ifr_line_slice( ifr ).count == ifr_line_slice( ifr_p ).count )
+            &&
+            ( ifr_line_number( ifr ) == ifr_line_number( ifr_p ) )
+            &&
+            ( ifr_eof( ifr ) == ifr_eof( ifr_p ) );
+   }
+   
+   ifr_deep_dispose( &ifr );
+   ifr_deep_dispose( &ifr_p );
+   
+   return result;
+}
+
+/**
+   test_forth_parallel_1
+*/
+
+void test_forth_parallel_1( void )
+{
+   ifr_t *ifr = NULL;
+   ifr_slice_t *slices = NULL;
+   
+   ifr = ifr_make_parallel_cstring( "src/input_files/f_multiline.txt", 2, 1 );
+   ifr_put_is_skip_comments( ifr, 1 );
+   
+   ifr_forth_slices( ifr );
+   
+   slices = ifr_slices( ifr );
+   CU_ASSERT( ifr_slice_count( ifr ) == 3 );
+   CU_ASSERT( strncmp( slices[0].base, "one", slices[0].count ) == 0 );
+   CU_ASSERT( ifr_line_number( ifr ) == 1 );
+   
+   ifr_forth_slices( ifr );
+   
+   slices = ifr_slices( ifr );
+   CU_ASSERT( ifr_slice_count( ifr ) == 4 );
+   CU_ASSERT( strncmp( slices[3].base, "yellow", slices[3].count ) == 0 );
+   CU_ASSERT( ifr_line_number( ifr ) == 4 );
+   CU_ASSERT( ifr_eof( ifr ) == 0 );
+   
+   ifr_forth_slices( ifr );
+   
+   CU_ASSERT( ifr_slice_count( ifr ) == 0 );
+   CU_ASSERT( ifr_line_number( ifr ) == 9 );
+   CU_ASSERT( ifr_eof( ifr ) == 1 );
+   
+   ifr_deep_dispose( &ifr );
+   
+   return;
+}
+
+/**
+   test_forth_parallel_2
+*/
+
+void test_forth_parallel_2( void )
+{
+   int32_t i = 0;
+   int32_t thread_count = 0;
+   int32_t is_skip_comments = 0;
+   
+   for ( i = 0; i < ( int32_t ) ( sizeof( file_names ) / sizeof( char_t * ) ); i++ )
+   {
+      for ( thread_count = 0; thread_count <= 2; thread_count++ )
+      {
+         for ( is_skip_comments = 0; is_skip_comments <= 1; is_skip_comments++ )
+         {
+            CU_ASSERT( is_same_as_slices( file_names[i], thread_count, is_skip_comments ) == 1 );
+         }
+      }
+   }
+   
+   return;
+}
+
+/**
+   test_forth_parallel_3
+*/
+
+void test_forth_parallel_3( void )
+{
+   write_large_file();
+   
+   CU_ASSERT( is_same_as_slices( LARGE_FILE_NAME, 0, 1 ) == 1 );
+   CU_ASSERT( is_same_as_slices( LARGE_FILE_NAME, 1, 1 ) == 1 );
+   CU_ASSERT( is_same_as_slices( LARGE_FILE_NAME, 4, 1 ) == 1 );
+   CU_ASSERT( is_same_as_slices( LARGE_FILE_NAME, 4, 0 ) == 1 );
+   
+   remove( LARGE_FILE_NAME );
+   
+   return;
+}
+
+/**
+   test_forth_parallel_4
+*/
+
+void test_forth_parallel_4( void )
+{
+   int32_t n = 0;
+   int32_t line_number = 0;
+   int32_t line_number_last = 0;
+   int32_t is_ok = 1;
+   int32_t line_count = LARGE_LINE_COUNT + 2;
+   uint32_t *hashes = NULL;
+   uint32_t *hashes_p = NULL;
+   ifr_t *ifr = NULL;
+   
+   write_large_file();
+   
+   hashes = ( uint32_t * ) calloc( line_count, sizeof( uint32_t ) );
+   hashes_p = ( uint32_t * ) calloc( line_count, sizeof( uint32_t ) );
+   
+   ifr = ifr_make_slices_cstring( LARGE_FILE_NAME );
+   ifr_put_is_skip_comments( ifr, 1 );
+   
+   while ( ifr_eof( ifr ) == 0 )
+   {
+      ifr_forth_slices( ifr );
+      hashes[ ifr_line_number( ifr ) ] = hash_line( ifr );
+   }
+   
+   ifr_deep_dispose( &ifr );
+   
+   // unordered, each line is delivered once with its line number
+   ifr = ifr_make_parallel_cstring( LARGE_FILE_NAME, 4, 0 );
+   ifr_put_is_skip_comments( ifr, 1 );
+   
+   while ( ifr_eof( ifr ) == 0 )
+   {
+      ifr_forth_slices( ifr );
+      line_number = ifr_line_number( ifr );
+      
+      if ( ifr_slice_count( ifr ) > 0 )
+      {
+         is_ok = is_ok && ( hashes_p[ line_number ] == 0 );
+         hashes_p[ line_number ] = hash_line( ifr );
+         n = n + 1;
+      }
+      
+      line_number_last = line_number;
+   }
+   
+   CU_ASSERT( is_ok == 1 );
+   CU_ASSERT( line_number_last == LARGE_LINE_COUNT + 1 );
+   CU_ASSERT( memcmp( hashes, hashes_p, line_count * sizeof( uint32_t ) ) == 0 );
+   CU_ASSERT( n > LARGE_LINE_COUNT / 2 );
+   
+   ifr_deep_dispose( &ifr );
+   
+   free( hashes );
+   free( hashes_p );
+   
+   remove( LARGE_FILE_NAME );
+   
+   return;
+}
+
+int
+add_test_forth_parallel( void )
+{
+   CU_pSuite p_suite = NULL;
+   
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_forth_parallel", NULL, NULL);
+   if (NULL == p_suite) 
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+   
+   // test_forth_parallel_1
+   add_test_to_suite( p_suite, test_forth_parallel_1, "test_forth_parallel_1" );
+
+   // test_forth_parallel_2
+   add_test_to_suite( p_suite, test_forth_parallel_2, "test_forth_parallel_2" );
+
+   // test_forth_parallel_3
+   add_test_to_suite( p_suite, test_forth_parallel_3, "test_forth_parallel_3" );
+
+   // test_forth_parallel_4
+   add_test_to_suite( p_suite, test_forth_parallel_4, "test_forth_parallel_4" );
+
+   return CUE_SUCCESS;
+   
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,365 @@
+/**
+ @file ifr_test_forth_slices.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for ifr_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for ifr_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+ 
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "Input_File_Reader.h"
+#include "String_utilities.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+static char_t *file_names[] =
+{
+   "src/input_files/f_empty.txt",
+   "src/input_files/f_multiline.txt",
+   "src/input_files/f_one_line.txt",
+   "src/input_files/f_one_line_comment.txt",
+   "src/input_files/f_quotes.txt",
+   "src/input_files/f_three_line.txt",
+   "src/input_files/f_two_line.txt"
+};
+
+/**
+   is_slice_equal
+*/
+
+static
+int32_t
+is_slice_equal( ifr_slice_t slice, char_t *s )
+{
+   int32_t result = 0;
+   
+   result
+      =  ( slice.count == ( int32_t ) strlen( s ) )
+         &&
+         ( strncmp( slice.base, s, slice.count ) == 0 );
+   
+   return result;
+}
+
+/**
+   is_same_as_forth
+
+   Return 1 if a slice reader gives the same tokens, line numbers and end
+   of file as ifr_forth, line by line
+*/
+
+static
+int32_t
+is_same_as_forth( char_t *file_name, int32_t is_mapped, int32_t is_skip_comments )
+{
+   int32_t result = 1;
+   int32_t i = 0;
+   ifr_t *ifr = NULL;
+   ifr_t *ifr_s = NULL;
+   s_dlist_t *list = NULL;
+   ifr_slice_t *slices = NULL;
+   
+   ifr = ifr_make_cstring( file_name );
+   ifr_put_is_skip_comments( ifr, is_skip_comments );
+   
+   if ( is_mapped == 1 )
+   {
+      ifr_s = ifr_make_mmap_cstring( file_name );
+   }
+   else
+   {
+      ifr_s = ifr_make_slices_cstring( file_name );
+   }
+   ifr_put_is_skip_comments( ifr_s, is_skip_comments );
+   
+   while ( ( result == 1 ) && ( ifr_eof( ifr ) == 0 ) )
+   {
+      ifr_forth( ifr );
+      ifr_forth_slices( ifr_s );
+      
+      list = ifr_tokens( ifr );
+      slices = ifr_slices( ifr_s );
+      
+      result
+         =  ( s_dlist_count( list ) == ifr_slice_count( ifr_s ) )
+            &&
+            ( ifr_line_number( ifr ) == ifr_line_number( ifr_s ) )
+            &&
+            ( ifr_eof( ifr ) == ifr_eof( ifr_s ) );
+      
+      i = 0;
+      for
+      (
+         s_dlist_start( list );
+         ( result == 1 ) && ( s_dlist_off( list ) == 0 );
+         s_dlist_forth( list )
+      )
+      {
+         result = is_slice_equal( slices[i], string_as_cstring( s_dlist_item_at( list ) ) );
+         i = i + 1;
+      }
+   }
+   
+   ifr_deep_dispose( &ifr );
+   ifr_deep_dispose( &ifr_s );
+   
+   return result;
+}
+
+/**
+   test_forth_slices_1
+*/
+
+void test_forth_slices_1( void )
+{
+   ifr_t *ifr = NULL;
+   ifr_slice_t *slices = NULL;
+   
+   ifr = ifr_make_slices_cstring( "src/input_files/f_quotes.txt" );
+   
+   ifr_forth_slices( ifr );
+   
+   slices = ifr_slices( ifr );
+   CU_ASSERT( ifr_slice_count( ifr ) == 4 );
+   CU_ASSERT( is_slice_equal( slices[0], "one" ) == 1 );
+   CU_ASSERT( is_slice_equal( slices[1], "two" ) == 1 );
+   CU_ASSERT( is_slice_equal( slices[2], "three four" ) == 1 );
+   CU_ASSERT( is_slice_equal( slices[3], "split\"token" ) == 1 );
+   CU_ASSERT( is_slice_equal( ifr_line_slice( ifr ), "one two \"three four\" split\"token\n" ) == 1 );
+   CU_ASSERT( ifr_line_number( ifr ) == 1 );
+   CU_ASSERT( ifr_eof( ifr ) == 0 );
+   
+   ifr_forth_slices( ifr );
+   
+   CU_ASSERT( ifr_slice_count( ifr ) == 0 );
+   CU_ASSERT( ifr_line_slice( ifr ).count == 0 );
+   CU_ASSERT( ifr_line_number( ifr ) == 3 );
+   CU_ASSERT( ifr_eof( ifr ) == 1 );
+   
+   ifr_deep_dispose( &ifr );
+   
+   return;
+}
+
+/**
+   test_forth_slices_2
+*/
+
+void test_forth_slices_2( void )
+{
+   ifr_t *ifr = NULL;
+   ifr_slice_t *slices = NULL;
+   
+   ifr = ifr_make_mmap_cstring( "src/input_files/f_multiline.txt" );
+   ifr_put_is_skip_comments( ifr, 1 );
+   
+   ifr_forth_slices( ifr );
+   
+   slices = ifr_slices( ifr );
+   CU_ASSERT( ifr_slice_count( ifr ) == 3 );
+   CU_ASSERT( is_slice_equal( slices[2], "three" ) == 1 );
+   CU_ASSERT( ifr_line_number( ifr ) == 1 );
+   
+   // blank and comment lines are passed over
+   ifr_forth_slices( ifr );
+   
+   slices = ifr_slices( ifr );
+   CU_ASSERT( ifr_slice_count( ifr ) == 4 );
+   CU_ASSERT( is_slice_equal( slices[0], "red" ) == 1 );
+   CU_ASSERT( is_slice_equal( slices[3], "yellow" ) == 1 );
+   CU_ASSERT( ifr_line_number( ifr ) == 4 );
+   
+   ifr_forth_slices( ifr );
+   
+   CU_ASSERT( ifr_slice_count( ifr ) == 0 );
+   CU_ASSERT( ifr_eof( ifr ) == 1 );
+   
+   ifr_deep_dispose( &ifr );
+   
+   return;
+}
+
+/**
+   test_forth_slices_3
+*/
+
+void test_forth_slices_3( void )
+{
+   int32_t i = 0;
+   int32_t is_mapped = 0;
+   int32_t is_skip_comments = 0;
+   
+   for ( i = 0; i < ( int32_t ) ( sizeof( file_names ) / sizeof( char_t * ) ); i++ )
+   {
+      for ( is_mapped = 0; is_mapped <= 1; is_mapped++ )
+      {
+         for ( is_skip_comments = 0; is_skip_comments <= 1; is_skip_comments++ )
+         {
+            CU_ASSERT( is_same_as_forth( file_names[i], is_mapped, is_skip_comments ) == 1 );
+         }
+      }
+   }
+   
+   return;
+}
+
+/**
+   test_forth_slices_4
+*/
+
+void test_forth_slices_4( void )
+{
+   int32_t i = 0;
+   int32_t n = 3000000;
+   FILE *fp = NULL;
+   ifr_t *ifr = NULL;
+   ifr_slice_t *slices = NULL;
+   
+   // a line longer than the read buffer
+   fp = fopen( "src/input_files/f_long_line.txt", "w" );
+   fprintf( fp, "first line\n" );
+   for ( i = 0; i < n; i++ )
+   {
+      fputc( 'a' + ( i % 26 ), fp );
+   }
+   fprintf( fp, " last" );
+   fclose( fp );
+   
+   ifr = ifr_make_slices_cstring( "src/input_files/f_long_line.txt" );
+   
+   ifr_forth_slices( ifr );
+   CU_ASSERT( ifr_slice_count( ifr ) == 2 );
+   
+   ifr_forth_slices( ifr );
+   
+   slices = ifr_slices( ifr );
+   CU_ASSERT( ifr_slice_count( ifr ) == 2 );
+   CU_ASSERT( slices[0].count == n );
+   CU_ASSERT( slices[0].base[0] == 'a' );
+   CU_ASSERT( slices[0].base[n - 1] == 'a' + ( ( n - 1 ) % 26 ) );
+   CU_ASSERT( is_slice_equal( slices[1], "last" ) == 1 );
+   CU_ASSERT( ifr_line_number( ifr ) == 2 );
+   
+   // last line has no end of line
+   CU_ASSERT( ifr_eof( ifr ) == 1 );
+   
+   ifr_deep_dispose( &ifr );
+   
+   ifr = ifr_make_mmap_cstring( "src/input_files/f_long_line.txt" );
+   
+   ifr_forth_slices( ifr );
+   ifr_forth_slices( ifr );
+   
+   slices = ifr_slices( ifr );
+   CU_ASSERT( ifr_slice_count( ifr ) == 2 );
+   CU_ASSERT( slices[0].count == n );
+   CU_ASSERT( is_slice_equal( slices[1], "last" ) == 1 );
+   CU_ASSERT( ifr_eof( ifr ) == 1 );
+   
+   ifr_deep_dispose( &ifr );
+   
+   remove( "src/input_files/f_long_line.txt" );
+   
+   return;
+}
+
+/**
+   test_forth_slices_5
+*/
+
+void test_forth_slices_5( void )
+{
+   int32_t i = 0;
+   int32_t n = 40;
+   char_t s[16];
+   FILE *fp = NULL;
+   ifr_t *ifr = NULL;
+   ifr_slice_t *slices = NULL;
+   
+   // more tokens than the initial capacity of the slices
+   fp = fopen( "src/input_files/f_many_tokens.txt", "w" );
+   for ( i = 0; i < n; i++ )
+   {
+      fprintf( fp, "t%d ", i );
+   }
+   fprintf( fp, "\n" );
+   fclose( fp );
+   
+   ifr = ifr_make_slices_cstring( "src/input_files/f_many_tokens.txt" );
+   
+   ifr_forth_slices( ifr );
+   
+   slices = ifr_slices( ifr );
+   CU_ASSERT( ifr_slice_count( ifr ) == n );
+   for ( i = 0; i < n; i++ )
+   {
+      sprintf( s, "t%d", i );
+      CU_ASSERT( is_slice_equal( slices[i], s ) == 1 );
+   }
+   
+   ifr_deep_dispose( &ifr );
+   
+   remove( "src/input_files/f_many_tokens.txt" );
+   
+   return;
+}
+
+int
+add_test_forth_slices( void )
+{
+   CU_pSuite p_suite = NULL;
+   
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_forth_slices", NULL, NULL);
+   if (NULL == p_suite) 
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+   
+   // test_forth_slices_1
+   add_test_to_suite( p_suite, test_forth_slices_1, "test_forth_slices_1" );
+
+   // test_forth_slices_2
+   add_test_to_suite( p_suite, test_forth_slices_2, "test_forth_slices_2" );
+
+   // test_forth_slices_3
+   add_test_to_suite( p_suite, test_forth_slices_3, "test_forth_slices_3" );
+
+   // test_forth_slices_4
+   add_test_to_suite( p_suite, test_forth_slices_4, "test_forth_slices_4" );
+
+   // test_forth_slices_5
+   add_test_to_suite( p_suite, test_forth_slices_5, "test_forth_slices_5" );
+
+   return CUE_SUCCESS;
+   
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
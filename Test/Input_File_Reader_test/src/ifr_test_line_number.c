@@ -78,6 +78,41 @@ void test_line_number_1( void )
    return;
 }
 
+/**
+   test_line_number_2
+*/
+
+void test_line_number_2( void )
+{
+   ifr_t *ifr = NULL;
+   string_t *file_name = NULL;
+
+   file_name = string_make_from_cstring( "src/input_files/f_multiline.txt" );
+
+   ifr = ifr_make_parallel( file_name, 2, 1 );
+   ifr_put_is_skip_comments( ifr, 1 );
+
+   CU_ASSERT( ifr_line_number_64( ifr ) == 0 );
+
+   // first line
+   ifr_forth_slices( ifr );
+   CU_ASSERT( ifr_line_number_64( ifr ) == 1 );
+   CU_ASSERT( ifr_line_number( ifr ) == 1 );
+
+   // fourth line
+   ifr_forth_slices( ifr );
+   CU_ASSERT( ifr_line_number_64( ifr ) == 4 );
+
+   // ninth and last line is eof
+   ifr_forth_slices( ifr );
+   CU_ASSERT( ifr_line_number_64( ifr ) == 9 );
+
+   ifr_dispose( &ifr );
+   string_deep_dispose( &file_name );
+
+   return;
+}
+
 int
 add_test_line_number( void )
 {
@@ -96,6 +131,9 @@ add_test_line_number( void )
    // test_line_number_1
    add_test_to_suite( p_suite, test_line_number_1, "test_line_number_1" );
 
+   // test_line_number_2
+   add_test_to_suite( p_suite, test_line_number_2, "test_line_number_2" );
+
    return CUE_SUCCESS;
    
 }
@@ -0,0 +1,128 @@
+/**
+ @file ifr_test_make_slices.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for ifr_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for ifr_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+ 
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "Input_File_Reader.h"
+#include "String_utilities.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_make_slices_1
+*/
+
+void test_make_slices_1( void )
+{
+   ifr_t *ifr = NULL;
+   string_t *file_name = NULL;
+   
+   file_name = string_make_from_cstring( "src/input_files/f_empty.txt" );
+   
+   ifr = ifr_make_slices( file_name );
+   CU_ASSERT( ifr != NULL );
+   CU_ASSERT( ifr_is_slices( ifr ) == 1 );
+   CU_ASSERT( ifr_slice_count( ifr ) == 0 );
+   CU_ASSERT( ifr_line_number( ifr ) == 0 );
+   ifr_dispose( &ifr );
+   
+   ifr = ifr_make_slices_cstring( "src/input_files/f_three_line.txt" );
+   CU_ASSERT( ifr != NULL );
+   CU_ASSERT( ifr_is_slices( ifr ) == 1 );
+   CU_ASSERT( ifr_slice_count( ifr ) == 0 );
+   CU_ASSERT( ifr_eof( ifr ) == 0 );
+   ifr_deep_dispose( &ifr );
+   
+   ifr = ifr_make_cstring( "src/input_files/f_three_line.txt" );
+   CU_ASSERT( ifr_is_slices( ifr ) == 0 );
+   ifr_dispose( &ifr );
+   
+   string_deep_dispose( &file_name );
+   
+   return;
+}
+
+/**
+   test_make_slices_2
+*/
+
+void test_make_slices_2( void )
+{
+   ifr_t *ifr = NULL;
+   string_t *file_name = NULL;
+   
+   file_name = string_make_from_cstring( "src/input_files/f_three_line.txt" );
+   
+   ifr = ifr_make_mmap( file_name );
+   CU_ASSERT( ifr != NULL );
+   CU_ASSERT( ifr_is_slices( ifr ) == 1 );
+   CU_ASSERT( ifr_slice_count( ifr ) == 0 );
+   CU_ASSERT( ifr_eof( ifr ) == 0 );
+   ifr_dispose( &ifr );
+   
+   // an empty file is read, not mapped
+   ifr = ifr_make_mmap_cstring( "src/input_files/f_empty.txt" );
+   CU_ASSERT( ifr != NULL );
+   CU_ASSERT( ifr_is_slices( ifr ) == 1 );
+   CU_ASSERT( ifr_eof( ifr ) == 0 );
+   ifr_deep_dispose( &ifr );
+   
+   string_deep_dispose( &file_name );
+   
+   return;
+}
+
+int
+add_test_make_slices( void )
+{
+   CU_pSuite p_suite = NULL;
+   
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_make_slices", NULL, NULL);
+   if (NULL == p_suite) 
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+   
+   // test_make_slices_1
+   add_test_to_suite( p_suite, test_make_slices_1, "test_make_slices_1" );
+
+   // test_make_slices_2
+   add_test_to_suite( p_suite, test_make_slices_2, "test_make_slices_2" );
+
+   return CUE_SUCCESS;
+   
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -88,6 +88,18 @@ add_test_multiline( void );
 int
 add_test_quotes( void );
 
+int
+add_test_make_slices( void );
+
+int
+add_test_forth_slices( void );
+
+int
+add_test_make_parallel( void );
+
+int
+add_test_forth_parallel( void );
+
 
 int
 add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name )
@@ -150,6 +162,10 @@ int main(int argc, char *argv[] )
    add_test_three_line();
    add_test_multiline();
    add_test_quotes();
+   add_test_make_slices();
+   add_test_forth_slices();
+   add_test_make_parallel();
+   add_test_forth_parallel();
 
    // Run all tests using the CUnit Basic interface
 
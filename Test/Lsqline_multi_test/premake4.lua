@@ -0,0 +1,28 @@
+#!lua
+
+local name = "Lsqline_multi_test"
+
+-- A solution contains projects, and defines the available configurations
+solution( name )
+   configurations { "Debug", "Release" }
+   location "build"
+
+   -- A project defines one build target
+   project( name )
+      kind "ConsoleApp"
+      language "C"
+      files { "src/*.c", "../../Lsqline_multi/*.c", "../../Rng_Isaac/Rng_Isaac.c" }
+      links { "cunit", "m", "rt", "gc", "gcov", "pthread" }
+      includedirs { "src", "../../base", "../../dbc", "../../Rng_Isaac", "../../Lsqline_multi"  }
+
+      -- A configuration defines one way a project can be built
+      configuration "Debug"
+         defines { "DEBUG" }
+         flags { "Symbols" }
+         buildoptions { "-O0", "-g3", "-Wall", "-ftest-coverage", "-fprofile-arcs" }
+
+      configuration "Release"
+         defines { "NDEBUG" }
+         flags { "Optimize" }
+
+
@@ -0,0 +1,319 @@
+/**
+ @file Lsqline_multi_test_compute.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Lsqline_multi_compute"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Lsqline_multi_compute.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "CUnit/Basic.h"
+
+#include "Lsqline_multi.h"
+#include "Rng_Isaac.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   put_pairs
+
+   put count points into two series, the second one 2x + 1
+*/
+
+static
+void
+put_pairs( lsqline_multi_t *lsqline, float32_t *xs, float32_t *ys, int32_t count )
+{
+   float32_t x[2];
+   float32_t y[2];
+   int32_t i = 0;
+
+   for ( i = 0; i < count; i++ )
+   {
+      x[0] = xs[i];
+      y[0] = ys[i];
+      x[1] = xs[i];
+      y[1] = 2.0 * xs[i] + 1.0;
+      lsqline_multi_put( lsqline, x, y );
+   }
+
+   return;
+}
+
+/**
+   test_compute_1
+*/
+
+void test_compute_1( void )
+{
+   lsqline_multi_t *lsqline = NULL;
+   float32_t xs[4] = { 1.0, 2.0, 3.0, 4.0 };
+   float32_t ys[4] = { 1.0, 2.0, 3.0, 4.1 };
+
+   lsqline = lsqline_multi_make( 2, 4 );
+
+   put_pairs( lsqline, xs, ys, 4 );
+
+   lsqline_multi_compute( lsqline );
+
+   CU_ASSERT( lsqline_multi_is_output_valid( lsqline, 0 ) == 1 );
+
+   CU_ASSERT_DOUBLE_EQUAL( lsqline_multi_slope( lsqline, 0 ), 1.03, 0.00001 );
+   CU_ASSERT_DOUBLE_EQUAL( lsqline_multi_y_intercept( lsqline, 0 ), -0.05, 0.00001 );
+   CU_ASSERT_DOUBLE_EQUAL( lsqline_multi_fit( lsqline, 0 ), 0.002997, 0.00001 );
+
+   CU_ASSERT( lsqline_multi_is_output_valid( lsqline, 1 ) == 1 );
+
+   CU_ASSERT_DOUBLE_EQUAL( lsqline_multi_slope( lsqline, 1 ), 2.0, 0.00001 );
+   CU_ASSERT_DOUBLE_EQUAL( lsqline_multi_y_intercept( lsqline, 1 ), 1.0, 0.00001 );
+   CU_ASSERT_DOUBLE_EQUAL( lsqline_multi_fit( lsqline, 1 ), 0.0, 0.00001 );
+
+   lsqline_multi_dispose( &lsqline );
+
+   return;
+}
+
+/**
+   test_compute_2
+*/
+
+void test_compute_2( void )
+{
+   lsqline_multi_t *lsqline = NULL;
+   float32_t xs[9] = { 1.0, 2.0, 3.0, 4.0, 5.0, 1.0, 2.0, 3.0, 4.0 };
+   float32_t ys[9] = { 5.0, 1.0, 7.0, 2.0, 8.0, 1.0, 2.0, 3.0, 4.1 };
+
+   lsqline = lsqline_multi_make_float64( 2, 4 );
+
+   // only the last four points are in the window
+   put_pairs( lsqline, xs, ys, 9 );
+
+   lsqline_multi_compute( lsqline );
+
+   CU_ASSERT( lsqline_multi_is_output_valid( lsqline, 0 ) == 1 );
+
+   CU_ASSERT_DOUBLE_EQUAL( lsqline_multi_slope( lsqline, 0 ), 1.03, 0.00001 );
+   CU_ASSERT_DOUBLE_EQUAL( lsqline_multi_y_intercept( lsqline, 0 ), -0.05, 0.00001 );
+   CU_ASSERT_DOUBLE_EQUAL( lsqline_multi_fit( lsqline, 0 ), 0.002997, 0.00001 );
+
+   CU_ASSERT_DOUBLE_EQUAL( lsqline_multi_slope( lsqline, 1 ), 2.0, 0.00001 );
+   CU_ASSERT_DOUBLE_EQUAL( lsqline_multi_y_intercept( lsqline, 1 ), 1.0, 0.00001 );
+
+   lsqline_multi_dispose( &lsqline );
+
+   return;
+}
+
+/**
+   test_compute_3
+*/
+
+void test_compute_3( void )
+{
+   lsqline_multi_t *lsqline = NULL;
+   float32_t xs[2] = { 1.0, 1.0 };
+   float32_t ys[2] = { 1.0, 2.0 };
+
+   lsqline = lsqline_multi_make( 2, 4 );
+
+   // too few points
+   put_pairs( lsqline, xs, ys, 1 );
+   lsqline_multi_compute( lsqline );
+
+   CU_ASSERT( lsqline_multi_is_output_valid( lsqline, 0 ) == 0 );
+   CU_ASSERT( lsqline_multi_is_output_valid( lsqline, 1 ) == 0 );
+
+   // x does not vary
+   put_pairs( lsqline, xs, ys, 2 );
+   lsqline_multi_compute( lsqline );
+
+   CU_ASSERT( lsqline_multi_is_output_valid( lsqline, 0 ) == 0 );
+   CU_ASSERT( lsqline_multi_slope( lsqline, 0 ) == 0.0 );
+
+   lsqline_multi_dispose( &lsqline );
+
+   return;
+}
+
+/**
+   test_compute_4
+*/
+
+void test_compute_4( void )
+{
+   lsqline_multi_t *lsqline = NULL;
+   lsqline_multi_t *lsqline64 = NULL;
+   float32_t x[1];
+   float32_t y[1];
+   int32_t i = 0;
+
+   lsqline = lsqline_multi_make( 1, 64 );
+   lsqline64 = lsqline_multi_make_float64( 1, 64 );
+
+   // many points far from the origin, the sums must not drift
+   for ( i = 0; i < 200000; i++ )
+   {
+      x[0] = 100000.0 + ( i % 997 );
+      y[0] = 0.5 * x[0] + 2.0;
+      lsqline_multi_put( lsqline, x, y );
+      lsqline_multi_put( lsqline64, x, y );
+   }
+
+   lsqline_multi_compute( lsqline );
+   lsqline_multi_compute( lsqline64 );
+
+   CU_ASSERT( lsqline_multi_is_output_valid( lsqline, 0 ) == 1 );
+   CU_ASSERT_DOUBLE_EQUAL( lsqline_multi_slope( lsqline, 0 ), 0.5, 0.001 );
+
+   CU_ASSERT( lsqline_multi_is_output_valid( lsqline64, 0 ) == 1 );
+   CU_ASSERT_DOUBLE_EQUAL( lsqline_multi_slope( lsqline64, 0 ), 0.5, 0.000001 );
+   CU_ASSERT_DOUBLE_EQUAL( lsqline_multi_y_intercept( lsqline64, 0 ), 2.0, 0.0001 );
+
+   lsqline_multi_dispose( &lsqline );
+   lsqline_multi_dispose( &lsqline64 );
+
+   return;
+}
+
+/**
+   test_compute_5
+*/
+
+void test_compute_5( void )
+{
+   lsqline_multi_t *lsqline = NULL;
+   lsqline_multi_t *lsqline64 = NULL;
+   float32_t x[20];
+   float32_t y[20];
+   float32_t xs[137][20];
+   float32_t ys[137][20];
+   float64_t mx = 0.0;
+   float64_t my = 0.0;
+   float64_t sxx = 0.0;
+   float64_t sxy = 0.0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t ok = 1;
+   int32_t ok64 = 1;
+
+   lsqline = lsqline_multi_make( 20, 50 );
+   lsqline64 = lsqline_multi_make_float64( 20, 50 );
+
+   for ( i = 0; i < 137; i++ )
+   {
+      for ( j = 0; j < 20; j++ )
+      {
+         x[j] = i + ( rng_isaac_u32_item( rng ) >> 24 ) / 256.0;
+         rng_isaac_forth( rng );
+         y[j] = j * x[j] + ( rng_isaac_u32_item( rng ) >> 24 ) / 64.0;
+         rng_isaac_forth( rng );
+         xs[i][j] = x[j];
+         ys[i][j] = y[j];
+      }
+      lsqline_multi_put( lsqline, x, y );
+      lsqline_multi_put( lsqline64, x, y );
+   }
+
+   lsqline_multi_compute( lsqline );
+   lsqline_multi_compute( lsqline64 );
+
+   // compare with a two pass fit of the last 50 points of each series
+   for ( j = 0; j < 20; j++ )
+   {
+      mx = 0.0;
+      my = 0.0;
+      for ( i = 87; i < 137; i++ )
+      {
+         mx = mx + xs[i][j] / 50.0;
+         my = my + ys[i][j] / 50.0;
+      }
+
+      sxx = 0.0;
+      sxy = 0.0;
+      for ( i = 87; i < 137; i++ )
+      {
+         sxx = sxx + ( xs[i][j] - mx ) * ( xs[i][j] - mx );
+         sxy = sxy + ( xs[i][j] - mx ) * ( ys[i][j] - my );
+      }
+
+      if ( fabs( lsqline_multi_slope( lsqline, j ) - sxy / sxx ) > 0.0001 * ( 1 + j ) )
+      {
+         ok = 0;
+      }
+
+      if ( fabs( lsqline_multi_slope( lsqline64, j ) - sxy / sxx ) > 0.000001 * ( 1 + j ) )
+      {
+         ok64 = 0;
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+   CU_ASSERT( ok64 == 1 );
+
+   lsqline_multi_dispose( &lsqline );
+   lsqline_multi_dispose( &lsqline64 );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+int
+add_test_compute( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_compute", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_compute_1
+   add_test_to_suite( p_suite, test_compute_1, "test_compute_1" );
+
+   // test_compute_2
+   add_test_to_suite( p_suite, test_compute_2, "test_compute_2" );
+
+   // test_compute_3
+   add_test_to_suite( p_suite, test_compute_3, "test_compute_3" );
+
+   // test_compute_4
+   add_test_to_suite( p_suite, test_compute_4, "test_compute_4" );
+
+   // test_compute_5
+   add_test_to_suite( p_suite, test_compute_5, "test_compute_5" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,87 @@
+/**
+ @file Lsqline_multi_test_deep_dispose.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Lsqline_multi_deep_dispose"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Lsqline_multi_deep_dispose.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "CUnit/Basic.h"
+
+#include "Lsqline_multi.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_deep_dispose_1
+*/
+
+void test_deep_dispose_1( void )
+{
+   lsqline_multi_t *lsqline = NULL;
+   float32_t x[2] = { 1.0, 2.0 };
+
+   lsqline = lsqline_multi_make( 2, 4 );
+   lsqline_multi_put( lsqline, x, x );
+
+   lsqline_multi_deep_dispose( &lsqline );
+
+   CU_ASSERT( lsqline == NULL );
+
+   lsqline = lsqline_multi_make_float64( 2, 4 );
+   lsqline_multi_put( lsqline, x, x );
+
+   lsqline_multi_deep_dispose( &lsqline );
+
+   CU_ASSERT( lsqline == NULL );
+
+   return;
+}
+
+int
+add_test_deep_dispose( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_deep_dispose", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_deep_dispose_1
+   add_test_to_suite( p_suite, test_deep_dispose_1, "test_deep_dispose_1" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,109 @@
+/**
+ @file Lsqline_multi_test_make.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Lsqline_multi_make"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Lsqline_multi_make.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "CUnit/Basic.h"
+
+#include "Lsqline_multi.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_make_1
+*/
+
+void test_make_1( void )
+{
+   lsqline_multi_t *lsqline = NULL;
+
+   lsqline = lsqline_multi_make( 3, 4 );
+
+   CU_ASSERT( lsqline != NULL );
+
+   CU_ASSERT( lsqline_multi_series_count( lsqline ) == 3 );
+   CU_ASSERT( lsqline_multi_window( lsqline ) == 4 );
+   CU_ASSERT( lsqline_multi_count( lsqline ) == 0 );
+   CU_ASSERT( lsqline_multi_is_float64( lsqline ) == 0 );
+   CU_ASSERT( lsqline_multi_is_output_valid( lsqline, 2 ) == 0 );
+
+   lsqline_multi_dispose( &lsqline );
+
+   return;
+}
+
+/**
+   test_make_2
+*/
+
+void test_make_2( void )
+{
+   lsqline_multi_t *lsqline = NULL;
+
+   lsqline = lsqline_multi_make_float64( 17, 5 );
+
+   CU_ASSERT( lsqline != NULL );
+
+   CU_ASSERT( lsqline_multi_series_count( lsqline ) == 17 );
+   CU_ASSERT( lsqline_multi_window( lsqline ) == 5 );
+   CU_ASSERT( lsqline_multi_count( lsqline ) == 0 );
+   CU_ASSERT( lsqline_multi_is_float64( lsqline ) == 1 );
+
+   lsqline_multi_dispose( &lsqline );
+
+   return;
+}
+
+int
+add_test_make( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_make", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_make_1
+   add_test_to_suite( p_suite, test_make_1, "test_make_1" );
+
+   // test_make_2
+   add_test_to_suite( p_suite, test_make_2, "test_make_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
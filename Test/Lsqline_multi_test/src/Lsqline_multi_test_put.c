@@ -0,0 +1,134 @@
+/**
+ @file Lsqline_multi_test_put.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Lsqline_multi_put"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Lsqline_multi_put.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "CUnit/Basic.h"
+
+#include "Lsqline_multi.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_put_1
+*/
+
+void test_put_1( void )
+{
+   lsqline_multi_t *lsqline = NULL;
+   float32_t x[3] = { 1.0, 2.0, 3.0 };
+   float32_t y[3] = { 1.0, 2.0, 3.0 };
+   int32_t i = 0;
+
+   lsqline = lsqline_multi_make( 3, 4 );
+
+   // the count grows to the window and stays there
+   for ( i = 0; i < 4; i++ )
+   {
+      lsqline_multi_put( lsqline, x, y );
+      CU_ASSERT( lsqline_multi_count( lsqline ) == i + 1 );
+   }
+
+   for ( i = 0; i < 10; i++ )
+   {
+      lsqline_multi_put( lsqline, x, y );
+      CU_ASSERT( lsqline_multi_count( lsqline ) == 4 );
+   }
+
+   lsqline_multi_dispose( &lsqline );
+
+   return;
+}
+
+/**
+   test_put_2
+*/
+
+void test_put_2( void )
+{
+   lsqline_multi_t *lsqline = NULL;
+   float32_t x[19];
+   float32_t y[19];
+   int32_t i = 0;
+   int32_t j = 0;
+
+   lsqline = lsqline_multi_make( 19, 8 );
+
+   // series j is the line y = j*x - 1, past the last full lane
+   for ( i = 0; i < 21; i++ )
+   {
+      for ( j = 0; j < 19; j++ )
+      {
+         x[j] = i;
+         y[j] = j * i - 1.0;
+      }
+      lsqline_multi_put( lsqline, x, y );
+   }
+
+   lsqline_multi_compute( lsqline );
+
+   for ( j = 0; j < 19; j++ )
+   {
+      CU_ASSERT( lsqline_multi_is_output_valid( lsqline, j ) == 1 );
+      CU_ASSERT_DOUBLE_EQUAL( lsqline_multi_slope( lsqline, j ), j, 0.0001 );
+      CU_ASSERT_DOUBLE_EQUAL( lsqline_multi_y_intercept( lsqline, j ), -1.0, 0.001 );
+   }
+
+   lsqline_multi_dispose( &lsqline );
+
+   return;
+}
+
+int
+add_test_put( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_put", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_put_1
+   add_test_to_suite( p_suite, test_put_1, "test_put_1" );
+
+   // test_put_2
+   add_test_to_suite( p_suite, test_put_2, "test_put_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,109 @@
+/**
+ @file Lsqline_multi_test_reset.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Lsqline_multi_reset"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Lsqline_multi_reset.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "CUnit/Basic.h"
+
+#include "Lsqline_multi.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_reset_1
+*/
+
+void test_reset_1( void )
+{
+   lsqline_multi_t *lsqline = NULL;
+   float32_t x[1];
+   float32_t y[1];
+   int32_t i = 0;
+
+   lsqline = lsqline_multi_make( 1, 4 );
+
+   for ( i = 0; i < 6; i++ )
+   {
+      x[0] = i;
+      y[0] = 5.0 - i;
+      lsqline_multi_put( lsqline, x, y );
+   }
+
+   lsqline_multi_compute( lsqline );
+   CU_ASSERT_DOUBLE_EQUAL( lsqline_multi_slope( lsqline, 0 ), -1.0, 0.00001 );
+
+   lsqline_multi_reset( lsqline );
+
+   CU_ASSERT( lsqline_multi_count( lsqline ) == 0 );
+   CU_ASSERT( lsqline_multi_is_output_valid( lsqline, 0 ) == 0 );
+
+   // the old points play no part after a reset
+   for ( i = 0; i < 3; i++ )
+   {
+      x[0] = i;
+      y[0] = 3.0 * i;
+      lsqline_multi_put( lsqline, x, y );
+   }
+
+   lsqline_multi_compute( lsqline );
+
+   CU_ASSERT( lsqline_multi_count( lsqline ) == 3 );
+   CU_ASSERT( lsqline_multi_is_output_valid( lsqline, 0 ) == 1 );
+   CU_ASSERT_DOUBLE_EQUAL( lsqline_multi_slope( lsqline, 0 ), 3.0, 0.00001 );
+   CU_ASSERT_DOUBLE_EQUAL( lsqline_multi_y_intercept( lsqline, 0 ), 0.0, 0.00001 );
+
+   lsqline_multi_dispose( &lsqline );
+
+   return;
+}
+
+int
+add_test_reset( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_reset", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_reset_1
+   add_test_to_suite( p_suite, test_reset_1, "test_reset_1" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
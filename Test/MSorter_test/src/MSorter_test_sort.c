@@ -30,7 +30,9 @@ extern "C" {
 
 #include "Protocol_Base.h"
 #include "i_Sequence.h"
+#include "i_DList.h"
 #include "i_MSorter.h"
+#include "Rng_Isaac.h"
 
 int
 add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
@@ -341,6 +343,45 @@ void test_sort_5( void )
    return;
 }
 
+/**
+   test_sort_6
+
+   sort a DList, which has no item array and is sorted through item and put
+*/
+
+void test_sort_6( void )
+{
+   int32_t i = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+
+   i_dlist_t *list = i_dlist_make();
+   protocol_base_t *pb_list = ( protocol_base_t * ) list;
+
+   for ( i = 0; i < 50; i++ )
+   {
+      i_dlist_put_last( list, ( int32_t ) ( rng_isaac_u32_item( rng ) >> 24 ) );
+      rng_isaac_forth( rng );
+   }
+
+   CU_ASSERT( i_msorter_is_sorted( pb_list, func ) == 0 );
+
+   i_msorter_sort( pb_list, func );
+
+   CU_ASSERT( i_msorter_is_sorted( pb_list, func ) == 1 );
+   CU_ASSERT( i_dlist_count( list ) == 50 );
+
+   for ( i = 1; i < 50; i++ )
+   {
+      CU_ASSERT( i_dlist_item( list, i - 1 ) <= i_dlist_item( list, i ) );
+   }
+
+   i_dlist_dispose( &list );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
 int
 add_test_sort( void )
 {
@@ -389,6 +430,9 @@ add_test_sort( void )
    // test_sort_5
    add_test_to_suite( p_suite, test_sort_5, "test_sort_5" );
 
+   // test_sort_6
+   add_test_to_suite( p_suite, test_sort_6, "test_sort_6" );
+
 
    return CUE_SUCCESS;
 
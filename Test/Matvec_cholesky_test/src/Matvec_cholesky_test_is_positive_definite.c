@@ -0,0 +1,192 @@
+/**
+ @file Matvec_cholesky_test_is_positive_definite.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Matvec_cholesky_is_positive_definite"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Matvec_cholesky_is_positive_definite.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+#include "CUnit/Basic.h"
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+
+#include "f_Matvec_cholesky.h"
+#include "d_Matvec_cholesky.h"
+#include "cf_Matvec_cholesky.h"
+#include "cd_Matvec_cholesky.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_is_positive_definite_1
+*/
+
+void test_is_positive_definite_1( void )
+{
+   f_matvec_cholesky_t *x = NULL;
+   f_matvec_t *m = NULL;
+
+   m = f_matvec_make_from_args( 3, 3, 9, 4.0, 2.0, 2.0, 2.0, 5.0, 3.0, 2.0, 3.0, 6.0 );
+   x = f_matvec_cholesky_make( m );
+
+   CU_ASSERT( f_matvec_cholesky_is_positive_definite( x ) == 1 );
+
+   f_matvec_cholesky_dispose( &x );
+   f_matvec_dispose( &m );
+
+   m = f_matvec_make_from_args( 2, 2, 4, 1.0, 2.0, 2.0, 1.0 );
+   x = f_matvec_cholesky_make( m );
+
+   CU_ASSERT( f_matvec_cholesky_is_positive_definite( x ) == 0 );
+
+   f_matvec_cholesky_dispose( &x );
+   f_matvec_dispose( &m );
+
+   return;
+}
+
+/**
+   test_is_positive_definite_2
+*/
+
+void test_is_positive_definite_2( void )
+{
+   d_matvec_cholesky_t *x = NULL;
+   d_matvec_t *m = NULL;
+
+   m = d_matvec_make_from_args( 3, 3, 9, 4.0, 2.0, 2.0, 2.0, 5.0, 3.0, 2.0, 3.0, 6.0 );
+   x = d_matvec_cholesky_make( m );
+
+   CU_ASSERT( d_matvec_cholesky_is_positive_definite( x ) == 1 );
+
+   d_matvec_cholesky_dispose( &x );
+   d_matvec_dispose( &m );
+
+   m = d_matvec_make_from_args( 2, 2, 4, 1.0, 2.0, 2.0, 1.0 );
+   x = d_matvec_cholesky_make( m );
+
+   CU_ASSERT( d_matvec_cholesky_is_positive_definite( x ) == 0 );
+
+   d_matvec_cholesky_dispose( &x );
+   d_matvec_dispose( &m );
+
+   return;
+}
+
+/**
+   test_is_positive_definite_3
+*/
+
+void test_is_positive_definite_3( void )
+{
+   cf_matvec_cholesky_t *x = NULL;
+   cf_matvec_t *m = NULL;
+
+   m = cf_matvec_make_from_args( 3, 3, 9, 4.0 + 0.0*I, 1.0 + 1.0*I, 0.0 + 0.0*I, 1.0 - 1.0*I, 5.0 + 0.0*I, 0.0 + 2.0*I, 0.0 + 0.0*I, 0.0 - 2.0*I, 6.0 + 0.0*I );
+   x = cf_matvec_cholesky_make( m );
+
+   CU_ASSERT( cf_matvec_cholesky_is_positive_definite( x ) == 1 );
+
+   cf_matvec_cholesky_dispose( &x );
+   cf_matvec_dispose( &m );
+
+   m = cf_matvec_make_from_args( 2, 2, 4, 1.0 + 0.0*I, 0.0 + 2.0*I, 0.0 - 2.0*I, 1.0 + 0.0*I );
+   x = cf_matvec_cholesky_make( m );
+
+   CU_ASSERT( cf_matvec_cholesky_is_positive_definite( x ) == 0 );
+
+   cf_matvec_cholesky_dispose( &x );
+   cf_matvec_dispose( &m );
+
+   return;
+}
+
+/**
+   test_is_positive_definite_4
+*/
+
+void test_is_positive_definite_4( void )
+{
+   cd_matvec_cholesky_t *x = NULL;
+   cd_matvec_t *m = NULL;
+
+   m = cd_matvec_make_from_args( 3, 3, 9, 4.0 + 0.0*I, 1.0 + 1.0*I, 0.0 + 0.0*I, 1.0 - 1.0*I, 5.0 + 0.0*I, 0.0 + 2.0*I, 0.0 + 0.0*I, 0.0 - 2.0*I, 6.0 + 0.0*I );
+   x = cd_matvec_cholesky_make( m );
+
+   CU_ASSERT( cd_matvec_cholesky_is_positive_definite( x ) == 1 );
+
+   cd_matvec_cholesky_dispose( &x );
+   cd_matvec_dispose( &m );
+
+   m = cd_matvec_make_from_args( 2, 2, 4, 1.0 + 0.0*I, 0.0 + 2.0*I, 0.0 - 2.0*I, 1.0 + 0.0*I );
+   x = cd_matvec_cholesky_make( m );
+
+   CU_ASSERT( cd_matvec_cholesky_is_positive_definite( x ) == 0 );
+
+   cd_matvec_cholesky_dispose( &x );
+   cd_matvec_dispose( &m );
+
+   return;
+}
+
+int
+add_test_is_positive_definite( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_is_positive_definite", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_is_positive_definite_1
+   add_test_to_suite( p_suite, test_is_positive_definite_1, "test_is_positive_definite_1" );
+
+   // test_is_positive_definite_2
+   add_test_to_suite( p_suite, test_is_positive_definite_2, "test_is_positive_definite_2" );
+
+   // test_is_positive_definite_3
+   add_test_to_suite( p_suite, test_is_positive_definite_3, "test_is_positive_definite_3" );
+
+   // test_is_positive_definite_4
+   add_test_to_suite( p_suite, test_is_positive_definite_4, "test_is_positive_definite_4" );
+
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,222 @@
+/**
+ @file Matvec_cholesky_test_make.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Matvec_cholesky_make"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Matvec_cholesky_make.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+#include "CUnit/Basic.h"
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+
+#include "f_Matvec_cholesky.h"
+#include "d_Matvec_cholesky.h"
+#include "cf_Matvec_cholesky.h"
+#include "cd_Matvec_cholesky.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_make_1
+*/
+
+void test_make_1( void )
+{
+   f_matvec_cholesky_t *x = NULL;
+   f_matvec_t *m = NULL;
+
+   m = f_matvec_make_from_args( 3, 3, 9, 4.0, 2.0, 2.0, 2.0, 5.0, 3.0, 2.0, 3.0, 6.0 );
+   x = f_matvec_cholesky_make( m );
+
+   CU_ASSERT( x != NULL );
+
+   f_matvec_cholesky_dispose( &x );
+   f_matvec_dispose( &m );
+
+   return;
+}
+
+/**
+   test_make_2
+*/
+
+void test_make_2( void )
+{
+   d_matvec_cholesky_t *x = NULL;
+   d_matvec_t *m = NULL;
+
+   m = d_matvec_make_from_args( 3, 3, 9, 4.0, 2.0, 2.0, 2.0, 5.0, 3.0, 2.0, 3.0, 6.0 );
+   x = d_matvec_cholesky_make( m );
+
+   CU_ASSERT( x != NULL );
+
+   d_matvec_cholesky_dispose( &x );
+   d_matvec_dispose( &m );
+
+   return;
+}
+
+/**
+   test_make_3
+*/
+
+void test_make_3( void )
+{
+   cf_matvec_cholesky_t *x = NULL;
+   cf_matvec_t *m = NULL;
+
+   m = cf_matvec_make_from_args( 3, 3, 9, 4.0 + 0.0*I, 1.0 + 1.0*I, 0.0 + 0.0*I, 1.0 - 1.0*I, 5.0 + 0.0*I, 0.0 + 2.0*I, 0.0 + 0.0*I, 0.0 - 2.0*I, 6.0 + 0.0*I );
+   x = cf_matvec_cholesky_make( m );
+
+   CU_ASSERT( x != NULL );
+
+   cf_matvec_cholesky_dispose( &x );
+   cf_matvec_dispose( &m );
+
+   return;
+}
+
+/**
+   test_make_4
+*/
+
+void test_make_4( void )
+{
+   cd_matvec_cholesky_t *x = NULL;
+   cd_matvec_t *m = NULL;
+
+   m = cd_matvec_make_from_args( 3, 3, 9, 4.0 + 0.0*I, 1.0 + 1.0*I, 0.0 + 0.0*I, 1.0 - 1.0*I, 5.0 + 0.0*I, 0.0 + 2.0*I, 0.0 + 0.0*I, 0.0 - 2.0*I, 6.0 + 0.0*I );
+   x = cd_matvec_cholesky_make( m );
+
+   CU_ASSERT( x != NULL );
+
+   cd_matvec_cholesky_dispose( &x );
+   cd_matvec_dispose( &m );
+
+   return;
+}
+
+/**
+   test_make_5
+*/
+
+void test_make_5( void )
+{
+   d_matvec_cholesky_t *x = NULL;
+   d_matvec_t *m = NULL;
+   d_matvec_t *b = NULL;
+   d_matvec_t *v = NULL;
+   d_matvec_t *r = NULL;
+
+   // symmetric only to within rounding
+   m = d_matvec_make_from_args( 3, 3, 9, 4.0, 2.0 + 1.0e-15, 2.0, 2.0, 5.0, 3.0, 2.0, 3.0 - 1.0e-15, 6.0 );
+   b = d_matvec_make_from_args( 3, 1, 3, 8.0, 10.0, 11.0 );
+   x = d_matvec_cholesky_make( m );
+
+   CU_ASSERT( x != NULL );
+   CU_ASSERT( d_matvec_cholesky_is_positive_definite( x ) == 1 );
+
+   v = d_matvec_cholesky_solve( x, b );
+   r = d_matvec_multiplied( m, v );
+
+   CU_ASSERT( d_matvec_is_approximately_equal( r, b, 1.0e-12 ) == 1 );
+
+   d_matvec_cholesky_dispose( &x );
+   d_matvec_dispose( &m );
+   d_matvec_dispose( &b );
+   d_matvec_dispose( &v );
+   d_matvec_dispose( &r );
+
+   return;
+}
+
+/**
+   test_make_6
+*/
+
+void test_make_6( void )
+{
+   cf_matvec_cholesky_t *x = NULL;
+   cf_matvec_t *m = NULL;
+
+   // hermitian only to within rounding
+   m = cf_matvec_make_from_args( 3, 3, 9, 4.0 + 0.0*I, 1.0 + 1.0*I, 0.0 + 0.0*I, 1.0 - 1.0000001*I, 5.0 + 0.0*I, 0.0 + 2.0*I, 0.0 + 0.0*I, 0.0 - 2.0*I, 6.0 + 0.0*I );
+   x = cf_matvec_cholesky_make( m );
+
+   CU_ASSERT( x != NULL );
+   CU_ASSERT( cf_matvec_cholesky_is_positive_definite( x ) == 1 );
+
+   cf_matvec_cholesky_dispose( &x );
+   cf_matvec_dispose( &m );
+
+   return;
+}
+
+int
+add_test_make( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_make", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_make_1
+   add_test_to_suite( p_suite, test_make_1, "test_make_1" );
+
+   // test_make_2
+   add_test_to_suite( p_suite, test_make_2, "test_make_2" );
+
+   // test_make_3
+   add_test_to_suite( p_suite, test_make_3, "test_make_3" );
+
+   // test_make_4
+   add_test_to_suite( p_suite, test_make_4, "test_make_4" );
+
+   // test_make_5
+   add_test_to_suite( p_suite, test_make_5, "test_make_5" );
+
+   // test_make_6
+   add_test_to_suite( p_suite, test_make_6, "test_make_6" );
+
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,260 @@
+/**
+ @file Matvec_cholesky_test_solve.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Matvec_cholesky_solve"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Matvec_cholesky_solve.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+#include "CUnit/Basic.h"
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+
+#include "f_Matvec_cholesky.h"
+#include "d_Matvec_cholesky.h"
+#include "cf_Matvec_cholesky.h"
+#include "cd_Matvec_cholesky.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_solve_1
+*/
+
+void test_solve_1( void )
+{
+   f_matvec_cholesky_t *x = NULL;
+   f_matvec_t *m = NULL;
+   f_matvec_t *b = NULL;
+   f_matvec_t *v = NULL;
+   f_matvec_t *v1 = NULL;
+   f_matvec_t *r = NULL;
+
+   m = f_matvec_make_from_args( 3, 3, 9, 4.0, 2.0, 2.0, 2.0, 5.0, 3.0, 2.0, 3.0, 6.0 );
+   b = f_matvec_make_from_args( 3, 1, 3, 1.0, 2.0, 3.0 );
+   x = f_matvec_cholesky_make( m );
+   v = f_matvec_cholesky_solve( x, b );
+   r = f_matvec_multiplied( m, v );
+
+   CU_ASSERT( f_matvec_rows( v ) == 3 );
+   CU_ASSERT( f_matvec_columns( v ) == 1 );
+   CU_ASSERT( f_matvec_is_approximately_equal( r, b, 0.0001 ) == 1 );
+
+   f_matvec_dispose( &b );
+   f_matvec_dispose( &r );
+
+   // a row vector gives the same solution as a column vector
+   b = f_matvec_make_from_args( 1, 3, 3, 1.0, 2.0, 3.0 );
+   v1 = f_matvec_cholesky_solve( x, b );
+   r = f_matvec_transposed( v1 );
+
+   CU_ASSERT( f_matvec_rows( v1 ) == 1 );
+   CU_ASSERT( f_matvec_columns( v1 ) == 3 );
+   CU_ASSERT( f_matvec_is_approximately_equal( r, v, 0.000001 ) == 1 );
+
+   f_matvec_cholesky_dispose( &x );
+   f_matvec_dispose( &m );
+   f_matvec_dispose( &b );
+   f_matvec_dispose( &v );
+   f_matvec_dispose( &v1 );
+   f_matvec_dispose( &r );
+
+   return;
+}
+
+/**
+   test_solve_2
+*/
+
+void test_solve_2( void )
+{
+   d_matvec_cholesky_t *x = NULL;
+   d_matvec_t *m = NULL;
+   d_matvec_t *b = NULL;
+   d_matvec_t *v = NULL;
+   d_matvec_t *v1 = NULL;
+   d_matvec_t *r = NULL;
+
+   m = d_matvec_make_from_args( 3, 3, 9, 4.0, 2.0, 2.0, 2.0, 5.0, 3.0, 2.0, 3.0, 6.0 );
+   b = d_matvec_make_from_args( 3, 1, 3, 1.0, 2.0, 3.0 );
+   x = d_matvec_cholesky_make( m );
+   v = d_matvec_cholesky_solve( x, b );
+   r = d_matvec_multiplied( m, v );
+
+   CU_ASSERT( d_matvec_rows( v ) == 3 );
+   CU_ASSERT( d_matvec_columns( v ) == 1 );
+   CU_ASSERT( d_matvec_is_approximately_equal( r, b, 0.0001 ) == 1 );
+
+   d_matvec_dispose( &b );
+   d_matvec_dispose( &r );
+
+   // a row vector gives the same solution as a column vector
+   b = d_matvec_make_from_args( 1, 3, 3, 1.0, 2.0, 3.0 );
+   v1 = d_matvec_cholesky_solve( x, b );
+   r = d_matvec_transposed( v1 );
+
+   CU_ASSERT( d_matvec_rows( v1 ) == 1 );
+   CU_ASSERT( d_matvec_columns( v1 ) == 3 );
+   CU_ASSERT( d_matvec_is_approximately_equal( r, v, 0.000001 ) == 1 );
+
+   d_matvec_cholesky_dispose( &x );
+   d_matvec_dispose( &m );
+   d_matvec_dispose( &b );
+   d_matvec_dispose( &v );
+   d_matvec_dispose( &v1 );
+   d_matvec_dispose( &r );
+
+   return;
+}
+
+/**
+   test_solve_3
+*/
+
+void test_solve_3( void )
+{
+   cf_matvec_cholesky_t *x = NULL;
+   cf_matvec_t *m = NULL;
+   cf_matvec_t *b = NULL;
+   cf_matvec_t *v = NULL;
+   cf_matvec_t *v1 = NULL;
+   cf_matvec_t *r = NULL;
+
+   m = cf_matvec_make_from_args( 3, 3, 9, 4.0 + 0.0*I, 1.0 + 1.0*I, 0.0 + 0.0*I, 1.0 - 1.0*I, 5.0 + 0.0*I, 0.0 + 2.0*I, 0.0 + 0.0*I, 0.0 - 2.0*I, 6.0 + 0.0*I );
+   b = cf_matvec_make_from_args( 3, 1, 3, 1.0 + 1.0*I, 2.0 + 0.0*I, 3.0 - 1.0*I );
+   x = cf_matvec_cholesky_make( m );
+   v = cf_matvec_cholesky_solve( x, b );
+   r = cf_matvec_multiplied( m, v );
+
+   CU_ASSERT( cf_matvec_rows( v ) == 3 );
+   CU_ASSERT( cf_matvec_columns( v ) == 1 );
+   CU_ASSERT( cf_matvec_is_approximately_equal( r, b, 0.0001 ) == 1 );
+
+   cf_matvec_dispose( &b );
+   cf_matvec_dispose( &r );
+
+   // a row vector gives the same solution as a column vector
+   b = cf_matvec_make_from_args( 1, 3, 3, 1.0 + 1.0*I, 2.0 + 0.0*I, 3.0 - 1.0*I );
+   v1 = cf_matvec_cholesky_solve( x, b );
+   r = cf_matvec_transposed( v1 );
+
+   CU_ASSERT( cf_matvec_rows( v1 ) == 1 );
+   CU_ASSERT( cf_matvec_columns( v1 ) == 3 );
+   CU_ASSERT( cf_matvec_is_approximately_equal( r, v, 0.000001 ) == 1 );
+
+   cf_matvec_cholesky_dispose( &x );
+   cf_matvec_dispose( &m );
+   cf_matvec_dispose( &b );
+   cf_matvec_dispose( &v );
+   cf_matvec_dispose( &v1 );
+   cf_matvec_dispose( &r );
+
+   return;
+}
+
+/**
+   test_solve_4
+*/
+
+void test_solve_4( void )
+{
+   cd_matvec_cholesky_t *x = NULL;
+   cd_matvec_t *m = NULL;
+   cd_matvec_t *b = NULL;
+   cd_matvec_t *v = NULL;
+   cd_matvec_t *v1 = NULL;
+   cd_matvec_t *r = NULL;
+
+   m = cd_matvec_make_from_args( 3, 3, 9, 4.0 + 0.0*I, 1.0 + 1.0*I, 0.0 + 0.0*I, 1.0 - 1.0*I, 5.0 + 0.0*I, 0.0 + 2.0*I, 0.0 + 0.0*I, 0.0 - 2.0*I, 6.0 + 0.0*I );
+   b = cd_matvec_make_from_args( 3, 1, 3, 1.0 + 1.0*I, 2.0 + 0.0*I, 3.0 - 1.0*I );
+   x = cd_matvec_cholesky_make( m );
+   v = cd_matvec_cholesky_solve( x, b );
+   r = cd_matvec_multiplied( m, v );
+
+   CU_ASSERT( cd_matvec_rows( v ) == 3 );
+   CU_ASSERT( cd_matvec_columns( v ) == 1 );
+   CU_ASSERT( cd_matvec_is_approximately_equal( r, b, 0.0001 ) == 1 );
+
+   cd_matvec_dispose( &b );
+   cd_matvec_dispose( &r );
+
+   // a row vector gives the same solution as a column vector
+   b = cd_matvec_make_from_args( 1, 3, 3, 1.0 + 1.0*I, 2.0 + 0.0*I, 3.0 - 1.0*I );
+   v1 = cd_matvec_cholesky_solve( x, b );
+   r = cd_matvec_transposed( v1 );
+
+   CU_ASSERT( cd_matvec_rows( v1 ) == 1 );
+   CU_ASSERT( cd_matvec_columns( v1 ) == 3 );
+   CU_ASSERT( cd_matvec_is_approximately_equal( r, v, 0.000001 ) == 1 );
+
+   cd_matvec_cholesky_dispose( &x );
+   cd_matvec_dispose( &m );
+   cd_matvec_dispose( &b );
+   cd_matvec_dispose( &v );
+   cd_matvec_dispose( &v1 );
+   cd_matvec_dispose( &r );
+
+   return;
+}
+
+int
+add_test_solve( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_solve", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_solve_1
+   add_test_to_suite( p_suite, test_solve_1, "test_solve_1" );
+
+   // test_solve_2
+   add_test_to_suite( p_suite, test_solve_2, "test_solve_2" );
+
+   // test_solve_3
+   add_test_to_suite( p_suite, test_solve_3, "test_solve_3" );
+
+   // test_solve_4
+   add_test_to_suite( p_suite, test_solve_4, "test_solve_4" );
+
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,252 @@
+/**
+ @file Matvec_cholesky_test_solve_many.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Matvec_cholesky_solve_many"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Matvec_cholesky_solve_many.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+#include "CUnit/Basic.h"
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+
+#include "f_Matvec_cholesky.h"
+#include "d_Matvec_cholesky.h"
+#include "cf_Matvec_cholesky.h"
+#include "cd_Matvec_cholesky.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_solve_many_1
+*/
+
+void test_solve_many_1( void )
+{
+   f_matvec_cholesky_t *x = NULL;
+   f_matvec_t *m = NULL;
+   f_matvec_t *b = NULL;
+   f_matvec_t *v = NULL;
+   f_matvec_t *r = NULL;
+   f_matvec_t *one = NULL;
+
+   m = f_matvec_make_from_args( 3, 3, 9, 4.0, 2.0, 2.0, 2.0, 5.0, 3.0, 2.0, 3.0, 6.0 );
+   b = f_matvec_make_from_args( 3, 2, 6, 1.0, 0.0, 2.0, 1.0, 3.0, 4.0 );
+   x = f_matvec_cholesky_make( m );
+   v = f_matvec_cholesky_solve_many( x, b );
+   r = f_matvec_multiplied( m, v );
+
+   CU_ASSERT( f_matvec_rows( v ) == 3 );
+   CU_ASSERT( f_matvec_columns( v ) == 2 );
+   CU_ASSERT( f_matvec_is_approximately_equal( r, b, 0.0001 ) == 1 );
+
+   f_matvec_dispose( &v );
+   f_matvec_dispose( &r );
+
+   // solving for the identity gives the inverse
+   one = f_matvec_one( m );
+   v = f_matvec_cholesky_solve_many( x, one );
+   r = f_matvec_multiplied( m, v );
+
+   CU_ASSERT( f_matvec_is_approximately_equal( r, one, 0.0001 ) == 1 );
+
+   f_matvec_cholesky_dispose( &x );
+   f_matvec_dispose( &m );
+   f_matvec_dispose( &b );
+   f_matvec_dispose( &v );
+   f_matvec_dispose( &r );
+   f_matvec_dispose( &one );
+
+   return;
+}
+
+/**
+   test_solve_many_2
+*/
+
+void test_solve_many_2( void )
+{
+   d_matvec_cholesky_t *x = NULL;
+   d_matvec_t *m = NULL;
+   d_matvec_t *b = NULL;
+   d_matvec_t *v = NULL;
+   d_matvec_t *r = NULL;
+   d_matvec_t *one = NULL;
+
+   m = d_matvec_make_from_args( 3, 3, 9, 4.0, 2.0, 2.0, 2.0, 5.0, 3.0, 2.0, 3.0, 6.0 );
+   b = d_matvec_make_from_args( 3, 2, 6, 1.0, 0.0, 2.0, 1.0, 3.0, 4.0 );
+   x = d_matvec_cholesky_make( m );
+   v = d_matvec_cholesky_solve_many( x, b );
+   r = d_matvec_multiplied( m, v );
+
+   CU_ASSERT( d_matvec_rows( v ) == 3 );
+   CU_ASSERT( d_matvec_columns( v ) == 2 );
+   CU_ASSERT( d_matvec_is_approximately_equal( r, b, 0.0001 ) == 1 );
+
+   d_matvec_dispose( &v );
+   d_matvec_dispose( &r );
+
+   // solving for the identity gives the inverse
+   one = d_matvec_one( m );
+   v = d_matvec_cholesky_solve_many( x, one );
+   r = d_matvec_multiplied( m, v );
+
+   CU_ASSERT( d_matvec_is_approximately_equal( r, one, 0.0001 ) == 1 );
+
+   d_matvec_cholesky_dispose( &x );
+   d_matvec_dispose( &m );
+   d_matvec_dispose( &b );
+   d_matvec_dispose( &v );
+   d_matvec_dispose( &r );
+   d_matvec_dispose( &one );
+
+   return;
+}
+
+/**
+   test_solve_many_3
+*/
+
+void test_solve_many_3( void )
+{
+   cf_matvec_cholesky_t *x = NULL;
+   cf_matvec_t *m = NULL;
+   cf_matvec_t *b = NULL;
+   cf_matvec_t *v = NULL;
+   cf_matvec_t *r = NULL;
+   cf_matvec_t *one = NULL;
+
+   m = cf_matvec_make_from_args( 3, 3, 9, 4.0 + 0.0*I, 1.0 + 1.0*I, 0.0 + 0.0*I, 1.0 - 1.0*I, 5.0 + 0.0*I, 0.0 + 2.0*I, 0.0 + 0.0*I, 0.0 - 2.0*I, 6.0 + 0.0*I );
+   b = cf_matvec_make_from_args( 3, 2, 6, 1.0 + 1.0*I, 0.0 + 0.0*I, 2.0 + 0.0*I, 1.0 - 2.0*I, 3.0 - 1.0*I, 4.0 + 0.0*I );
+   x = cf_matvec_cholesky_make( m );
+   v = cf_matvec_cholesky_solve_many( x, b );
+   r = cf_matvec_multiplied( m, v );
+
+   CU_ASSERT( cf_matvec_rows( v ) == 3 );
+   CU_ASSERT( cf_matvec_columns( v ) == 2 );
+   CU_ASSERT( cf_matvec_is_approximately_equal( r, b, 0.0001 ) == 1 );
+
+   cf_matvec_dispose( &v );
+   cf_matvec_dispose( &r );
+
+   // solving for the identity gives the inverse
+   one = cf_matvec_one( m );
+   v = cf_matvec_cholesky_solve_many( x, one );
+   r = cf_matvec_multiplied( m, v );
+
+   CU_ASSERT( cf_matvec_is_approximately_equal( r, one, 0.0001 ) == 1 );
+
+   cf_matvec_cholesky_dispose( &x );
+   cf_matvec_dispose( &m );
+   cf_matvec_dispose( &b );
+   cf_matvec_dispose( &v );
+   cf_matvec_dispose( &r );
+   cf_matvec_dispose( &one );
+
+   return;
+}
+
+/**
+   test_solve_many_4
+*/
+
+void test_solve_many_4( void )
+{
+   cd_matvec_cholesky_t *x = NULL;
+   cd_matvec_t *m = NULL;
+   cd_matvec_t *b = NULL;
+   cd_matvec_t *v = NULL;
+   cd_matvec_t *r = NULL;
+   cd_matvec_t *one = NULL;
+
+   m = cd_matvec_make_from_args( 3, 3, 9, 4.0 + 0.0*I, 1.0 + 1.0*I, 0.0 + 0.0*I, 1.0 - 1.0*I, 5.0 + 0.0*I, 0.0 + 2.0*I, 0.0 + 0.0*I, 0.0 - 2.0*I, 6.0 + 0.0*I );
+   b = cd_matvec_make_from_args( 3, 2, 6, 1.0 + 1.0*I, 0.0 + 0.0*I, 2.0 + 0.0*I, 1.0 - 2.0*I, 3.0 - 1.0*I, 4.0 + 0.0*I );
+   x = cd_matvec_cholesky_make( m );
+   v = cd_matvec_cholesky_solve_many( x, b );
+   r = cd_matvec_multiplied( m, v );
+
+   CU_ASSERT( cd_matvec_rows( v ) == 3 );
+   CU_ASSERT( cd_matvec_columns( v ) == 2 );
+   CU_ASSERT( cd_matvec_is_approximately_equal( r, b, 0.0001 ) == 1 );
+
+   cd_matvec_dispose( &v );
+   cd_matvec_dispose( &r );
+
+   // solving for the identity gives the inverse
+   one = cd_matvec_one( m );
+   v = cd_matvec_cholesky_solve_many( x, one );
+   r = cd_matvec_multiplied( m, v );
+
+   CU_ASSERT( cd_matvec_is_approximately_equal( r, one, 0.0001 ) == 1 );
+
+   cd_matvec_cholesky_dispose( &x );
+   cd_matvec_dispose( &m );
+   cd_matvec_dispose( &b );
+   cd_matvec_dispose( &v );
+   cd_matvec_dispose( &r );
+   cd_matvec_dispose( &one );
+
+   return;
+}
+
+int
+add_test_solve_many( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_solve_many", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_solve_many_1
+   add_test_to_suite( p_suite, test_solve_many_1, "test_solve_many_1" );
+
+   // test_solve_many_2
+   add_test_to_suite( p_suite, test_solve_many_2, "test_solve_many_2" );
+
+   // test_solve_many_3
+   add_test_to_suite( p_suite, test_solve_many_3, "test_solve_many_3" );
+
+   // test_solve_many_4
+   add_test_to_suite( p_suite, test_solve_many_4, "test_solve_many_4" );
+
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,54 @@
+/**
+ @file cd_Matvec_cholesky.h
+ @author Greg Lee
+ @version 0.0
+ @brief: "include file for Cholesky factorization of matrices of complex doubles"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Defines to make a Matvec_cholesky into a cd_matvec_cholesky.
+
+*/
+
+#ifndef COMPLEX_DOUBLE_MATVEC_CHOLESKY_H_
+#define COMPLEX_DOUBLE_MATVEC_CHOLESKY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PROTOCOLS_ENABLED
+
+#include "base.h"
+#include "protocol.h"
+
+#include <complex.h>
+
+#define Prefix cd
+#define Matvec_prefix cd
+#define Type complex double
+#define Magnitude_type double
+
+#include "Matvec_cholesky.h"
+
+#undef Prefix
+#undef Matvec_prefix
+#undef Type
+#undef Magnitude_type
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COMPLEX_DOUBLE_MATVEC_CHOLESKY_H_ */
+
+/* End of file */
+
+
+
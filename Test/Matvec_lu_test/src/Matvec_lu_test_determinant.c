@@ -0,0 +1,222 @@
+/**
+ @file Matvec_lu_test_determinant.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Matvec_lu_determinant"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Matvec_lu_determinant.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+#include "CUnit/Basic.h"
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+
+#include "f_Matvec_lu.h"
+#include "d_Matvec_lu.h"
+#include "cf_Matvec_lu.h"
+#include "cd_Matvec_lu.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_determinant_1
+*/
+
+void test_determinant_1( void )
+{
+   f_matvec_lu_t *x = NULL;
+   f_matvec_t *m = NULL;
+   float d = 0.0;
+
+   m = f_matvec_make_from_args( 2, 2, 4, 4.0, 3.0, 6.0, 3.0 );
+   x = f_matvec_lu_make( m );
+   d = f_matvec_lu_determinant( x );
+
+   CU_ASSERT( fabsf( d - ( -6.0 ) ) < 0.0001 );
+
+   f_matvec_lu_dispose( &x );
+   f_matvec_dispose( &m );
+
+   m = f_matvec_make_from_args( 3, 3, 9, 2.0, 1.0, 1.0, 4.0, 3.0, 3.0, 8.0, 7.0, 9.0 );
+   x = f_matvec_lu_make( m );
+   d = f_matvec_lu_determinant( x );
+
+   CU_ASSERT( fabsf( d - ( 4.0 ) ) < 0.0001 );
+
+   f_matvec_lu_dispose( &x );
+   f_matvec_dispose( &m );
+
+   m = f_matvec_make_from_args( 2, 2, 4, 1.0, 2.0, 2.0, 4.0 );
+   x = f_matvec_lu_make( m );
+   d = f_matvec_lu_determinant( x );
+
+   CU_ASSERT( fabsf( d ) == 0.0 );
+
+   f_matvec_lu_dispose( &x );
+   f_matvec_dispose( &m );
+
+   return;
+}
+
+/**
+   test_determinant_2
+*/
+
+void test_determinant_2( void )
+{
+   d_matvec_lu_t *x = NULL;
+   d_matvec_t *m = NULL;
+   double d = 0.0;
+
+   m = d_matvec_make_from_args( 2, 2, 4, 4.0, 3.0, 6.0, 3.0 );
+   x = d_matvec_lu_make( m );
+   d = d_matvec_lu_determinant( x );
+
+   CU_ASSERT( fabs( d - ( -6.0 ) ) < 0.0001 );
+
+   d_matvec_lu_dispose( &x );
+   d_matvec_dispose( &m );
+
+   m = d_matvec_make_from_args( 3, 3, 9, 2.0, 1.0, 1.0, 4.0, 3.0, 3.0, 8.0, 7.0, 9.0 );
+   x = d_matvec_lu_make( m );
+   d = d_matvec_lu_determinant( x );
+
+   CU_ASSERT( fabs( d - ( 4.0 ) ) < 0.0001 );
+
+   d_matvec_lu_dispose( &x );
+   d_matvec_dispose( &m );
+
+   m = d_matvec_make_from_args( 2, 2, 4, 1.0, 2.0, 2.0, 4.0 );
+   x = d_matvec_lu_make( m );
+   d = d_matvec_lu_determinant( x );
+
+   CU_ASSERT( fabs( d ) == 0.0 );
+
+   d_matvec_lu_dispose( &x );
+   d_matvec_dispose( &m );
+
+   return;
+}
+
+/**
+   test_determinant_3
+*/
+
+void test_determinant_3( void )
+{
+   cf_matvec_lu_t *x = NULL;
+   cf_matvec_t *m = NULL;
+   float complex d = 0.0;
+
+   m = cf_matvec_make_from_args( 2, 2, 4, 1.0 + 1.0*I, 2.0 + 0.0*I, 3.0 + 0.0*I, 4.0 - 1.0*I );
+   x = cf_matvec_lu_make( m );
+   d = cf_matvec_lu_determinant( x );
+
+   CU_ASSERT( cabsf( d - ( -1.0 + 3.0*I ) ) < 0.0001 );
+
+   cf_matvec_lu_dispose( &x );
+   cf_matvec_dispose( &m );
+
+   m = cf_matvec_make_from_args( 2, 2, 4, 1.0 + 1.0*I, 0.0 + 0.0*I, 2.0 + 0.0*I, 0.0 + 0.0*I );
+   x = cf_matvec_lu_make( m );
+   d = cf_matvec_lu_determinant( x );
+
+   CU_ASSERT( cabsf( d ) == 0.0 );
+
+   cf_matvec_lu_dispose( &x );
+   cf_matvec_dispose( &m );
+
+   return;
+}
+
+/**
+   test_determinant_4
+*/
+
+void test_determinant_4( void )
+{
+   cd_matvec_lu_t *x = NULL;
+   cd_matvec_t *m = NULL;
+   double complex d = 0.0;
+
+   m = cd_matvec_make_from_args( 2, 2, 4, 1.0 + 1.0*I, 2.0 + 0.0*I, 3.0 + 0.0*I, 4.0 - 1.0*I );
+   x = cd_matvec_lu_make( m );
+   d = cd_matvec_lu_determinant( x );
+
+   CU_ASSERT( cabs( d - ( -1.0 + 3.0*I ) ) < 0.0001 );
+
+   cd_matvec_lu_dispose( &x );
+   cd_matvec_dispose( &m );
+
+   m = cd_matvec_make_from_args( 2, 2, 4, 1.0 + 1.0*I, 0.0 + 0.0*I, 2.0 + 0.0*I, 0.0 + 0.0*I );
+   x = cd_matvec_lu_make( m );
+   d = cd_matvec_lu_determinant( x );
+
+   CU_ASSERT( cabs( d ) == 0.0 );
+
+   cd_matvec_lu_dispose( &x );
+   cd_matvec_dispose( &m );
+
+   return;
+}
+
+int
+add_test_determinant( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_determinant", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_determinant_1
+   add_test_to_suite( p_suite, test_determinant_1, "test_determinant_1" );
+
+   // test_determinant_2
+   add_test_to_suite( p_suite, test_determinant_2, "test_determinant_2" );
+
+   // test_determinant_3
+   add_test_to_suite( p_suite, test_determinant_3, "test_determinant_3" );
+
+   // test_determinant_4
+   add_test_to_suite( p_suite, test_determinant_4, "test_determinant_4" );
+
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
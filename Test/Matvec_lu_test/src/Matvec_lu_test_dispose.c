@@ -0,0 +1,172 @@
+/**
+ @file Matvec_lu_test_dispose.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Matvec_lu_dispose"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Matvec_lu_dispose.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+#include "CUnit/Basic.h"
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+
+#include "f_Matvec_lu.h"
+#include "d_Matvec_lu.h"
+#include "cf_Matvec_lu.h"
+#include "cd_Matvec_lu.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_dispose_1
+*/
+
+void test_dispose_1( void )
+{
+   f_matvec_lu_t *x = NULL;
+   f_matvec_t *m = NULL;
+
+   m = f_matvec_make_from_args( 2, 2, 4, 4.0, 3.0, 6.0, 3.0 );
+   x = f_matvec_lu_make( m );
+
+   CU_ASSERT( x != NULL );
+
+   f_matvec_lu_dispose( &x );
+
+   CU_ASSERT( x == NULL );
+
+   f_matvec_dispose( &m );
+
+   return;
+}
+
+/**
+   test_dispose_2
+*/
+
+void test_dispose_2( void )
+{
+   d_matvec_lu_t *x = NULL;
+   d_matvec_t *m = NULL;
+
+   m = d_matvec_make_from_args( 2, 2, 4, 4.0, 3.0, 6.0, 3.0 );
+   x = d_matvec_lu_make( m );
+
+   CU_ASSERT( x != NULL );
+
+   d_matvec_lu_dispose( &x );
+
+   CU_ASSERT( x == NULL );
+
+   d_matvec_dispose( &m );
+
+   return;
+}
+
+/**
+   test_dispose_3
+*/
+
+void test_dispose_3( void )
+{
+   cf_matvec_lu_t *x = NULL;
+   cf_matvec_t *m = NULL;
+
+   m = cf_matvec_make_from_args( 2, 2, 4, 1.0 + 1.0*I, 2.0 + 0.0*I, 3.0 + 0.0*I, 4.0 - 1.0*I );
+   x = cf_matvec_lu_make( m );
+
+   CU_ASSERT( x != NULL );
+
+   cf_matvec_lu_dispose( &x );
+
+   CU_ASSERT( x == NULL );
+
+   cf_matvec_dispose( &m );
+
+   return;
+}
+
+/**
+   test_dispose_4
+*/
+
+void test_dispose_4( void )
+{
+   cd_matvec_lu_t *x = NULL;
+   cd_matvec_t *m = NULL;
+
+   m = cd_matvec_make_from_args( 2, 2, 4, 1.0 + 1.0*I, 2.0 + 0.0*I, 3.0 + 0.0*I, 4.0 - 1.0*I );
+   x = cd_matvec_lu_make( m );
+
+   CU_ASSERT( x != NULL );
+
+   cd_matvec_lu_dispose( &x );
+
+   CU_ASSERT( x == NULL );
+
+   cd_matvec_dispose( &m );
+
+   return;
+}
+
+int
+add_test_dispose( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_dispose", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_dispose_1
+   add_test_to_suite( p_suite, test_dispose_1, "test_dispose_1" );
+
+   // test_dispose_2
+   add_test_to_suite( p_suite, test_dispose_2, "test_dispose_2" );
+
+   // test_dispose_3
+   add_test_to_suite( p_suite, test_dispose_3, "test_dispose_3" );
+
+   // test_dispose_4
+   add_test_to_suite( p_suite, test_dispose_4, "test_dispose_4" );
+
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,52 @@
+/**
+ @file f_Matvec_lu.h
+ @author Greg Lee
+ @version 0.0
+ @brief: "include file for LU factorization of matrices of floats"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Defines to make a Matvec_lu into a f_matvec_lu.
+
+*/
+
+#ifndef FLOAT_MATVEC_LU_H_
+#define FLOAT_MATVEC_LU_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PROTOCOLS_ENABLED
+
+#include "base.h"
+#include "protocol.h"
+
+#define Prefix f
+#define Matvec_prefix f
+#define Type float
+#define Magnitude_type float
+
+#include "Matvec_lu.h"
+
+#undef Prefix
+#undef Matvec_prefix
+#undef Type
+#undef Magnitude_type
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FLOAT_MATVEC_LU_H_ */
+
+/* End of file */
+
+
+
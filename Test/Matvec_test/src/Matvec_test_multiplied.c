@@ -29,6 +29,7 @@ extern "C" {
 #include "d_Matvec.h"
 #include "cf_Matvec.h"
 #include "cd_Matvec.h"
+#include "Rng_Isaac.h"
 
 int
 add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
@@ -187,6 +188,292 @@ void test_multiplied_4( void )
    return;
 }
 
+/**
+   small_integer
+
+   pseudo random small integer, so that products of matrices are exact
+   whatever the order of the sums
+*/
+
+static
+int32_t
+small_integer( rng_isaac_t *rng )
+{
+   int32_t result = ( int32_t ) ( rng_isaac_u32_item( rng ) % 17 ) - 8;
+
+   rng_isaac_forth( rng );
+
+   return result;
+}
+
+/**
+   d_multiplied_ok
+
+   compare d_matvec_multiplied with a plain triple loop for the given sizes
+*/
+
+static
+void
+d_multiplied_ok( int32_t rows, int32_t columns, int32_t other_columns )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+   int32_t ok = 1;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+   double item = 0.0;
+   d_matvec_t *dm = NULL;
+   d_matvec_t *dm1 = d_matvec_make( rows, columns );
+   d_matvec_t *dm2 = d_matvec_make( columns, other_columns );
+
+   for ( i = 0; i < rows; i++ )
+   {
+      for ( j = 0; j < columns; j++ )
+      {
+         d_matvec_put( dm1, small_integer( rng ), i, j );
+      }
+   }
+
+   for ( i = 0; i < columns; i++ )
+   {
+      for ( j = 0; j < other_columns; j++ )
+      {
+         d_matvec_put( dm2, small_integer( rng ), i, j );
+      }
+   }
+
+   dm = d_matvec_multiplied( dm1, dm2 );
+
+   CU_ASSERT( d_matvec_rows( dm ) == rows );
+   CU_ASSERT( d_matvec_columns( dm ) == other_columns );
+
+   for ( i = 0; i < rows; i++ )
+   {
+      for ( j = 0; j < other_columns; j++ )
+      {
+         item = 0.0;
+         for ( k = 0; k < columns; k++ )
+         {
+            item = item + d_matvec_item( dm1, i, k ) * d_matvec_item( dm2, k, j );
+         }
+
+         if ( d_matvec_item( dm, i, j ) != item )
+         {
+            ok = 0;
+         }
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   d_matvec_dispose( &dm );
+   d_matvec_dispose( &dm1 );
+   d_matvec_dispose( &dm2 );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+/**
+   test_multiplied_5
+
+   float64 products that cross the register and cache block edges
+*/
+
+void test_multiplied_5( void )
+{
+   d_multiplied_ok( 1, 1, 1 );
+   d_multiplied_ok( 7, 9, 5 );
+   d_multiplied_ok( 101, 300, 37 );
+   d_multiplied_ok( 3, 5, 1030 );
+   d_multiplied_ok( 200, 13, 17 );
+
+   return;
+}
+
+/**
+   test_multiplied_6
+
+   float32 product that crosses the register and cache block edges
+*/
+
+void test_multiplied_6( void )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+   int32_t ok = 1;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 4321 );
+   float item = 0.0;
+   f_matvec_t *fm = NULL;
+   f_matvec_t *fm1 = f_matvec_make( 45, 263 );
+   f_matvec_t *fm2 = f_matvec_make( 263, 19 );
+
+   for ( i = 0; i < 45; i++ )
+   {
+      for ( j = 0; j < 263; j++ )
+      {
+         f_matvec_put( fm1, small_integer( rng ), i, j );
+      }
+   }
+
+   for ( i = 0; i < 263; i++ )
+   {
+      for ( j = 0; j < 19; j++ )
+      {
+         f_matvec_put( fm2, small_integer( rng ), i, j );
+      }
+   }
+
+   fm = f_matvec_multiplied( fm1, fm2 );
+
+   for ( i = 0; i < 45; i++ )
+   {
+      for ( j = 0; j < 19; j++ )
+      {
+         item = 0.0;
+         for ( k = 0; k < 263; k++ )
+         {
+            item = item + f_matvec_item( fm1, i, k ) * f_matvec_item( fm2, k, j );
+         }
+
+         if ( f_matvec_item( fm, i, j ) != item )
+         {
+            ok = 0;
+         }
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   f_matvec_dispose( &fm );
+   f_matvec_dispose( &fm1 );
+   f_matvec_dispose( &fm2 );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+/**
+   test_multiplied_7
+
+   complex128 product that crosses the register and cache block edges
+*/
+
+void test_multiplied_7( void )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+   int32_t ok = 1;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 777 );
+   double complex item = 0.0;
+   cd_matvec_t *cdm = NULL;
+   cd_matvec_t *cdm1 = cd_matvec_make( 67, 270 );
+   cd_matvec_t *cdm2 = cd_matvec_make( 270, 29 );
+
+   for ( i = 0; i < 67; i++ )
+   {
+      for ( j = 0; j < 270; j++ )
+      {
+         cd_matvec_put( cdm1, small_integer( rng ) + small_integer( rng )*I, i, j );
+      }
+   }
+
+   for ( i = 0; i < 270; i++ )
+   {
+      for ( j = 0; j < 29; j++ )
+      {
+         cd_matvec_put( cdm2, small_integer( rng ) + small_integer( rng )*I, i, j );
+      }
+   }
+
+   cdm = cd_matvec_multiplied( cdm1, cdm2 );
+
+   for ( i = 0; i < 67; i++ )
+   {
+      for ( j = 0; j < 29; j++ )
+      {
+         item = 0.0;
+         for ( k = 0; k < 270; k++ )
+         {
+            item = item + cd_matvec_item( cdm1, i, k ) * cd_matvec_item( cdm2, k, j );
+         }
+
+         if ( cd_matvec_item( cdm, i, j ) != item )
+         {
+            ok = 0;
+         }
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   cd_matvec_dispose( &cdm );
+   cd_matvec_dispose( &cdm1 );
+   cd_matvec_dispose( &cdm2 );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+/**
+   test_multiplied_8
+
+   complex64 product of a row vector and a matrix
+*/
+
+void test_multiplied_8( void )
+{
+   int32_t j = 0;
+   int32_t k = 0;
+   int32_t ok = 1;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 999 );
+   float complex item = 0.0;
+   cf_matvec_t *cfm = NULL;
+   cf_matvec_t *cfm1 = cf_matvec_make_row_vector( 33 );
+   cf_matvec_t *cfm2 = cf_matvec_make( 33, 11 );
+
+   for ( k = 0; k < 33; k++ )
+   {
+      cf_matvec_put( cfm1, small_integer( rng ) + small_integer( rng )*I, 0, k );
+
+      for ( j = 0; j < 11; j++ )
+      {
+         cf_matvec_put( cfm2, small_integer( rng ) + small_integer( rng )*I, k, j );
+      }
+   }
+
+   cfm = cf_matvec_multiplied( cfm1, cfm2 );
+
+   for ( j = 0; j < 11; j++ )
+   {
+      item = 0.0;
+      for ( k = 0; k < 33; k++ )
+      {
+         item = item + cf_matvec_item( cfm1, 0, k ) * cf_matvec_item( cfm2, k, j );
+      }
+
+      if ( cf_matvec_item( cfm, 0, j ) != item )
+      {
+         ok = 0;
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   cf_matvec_dispose( &cfm );
+   cf_matvec_dispose( &cfm1 );
+   cf_matvec_dispose( &cfm2 );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
 int
 add_test_multiplied( void )
 {
@@ -214,6 +501,18 @@ add_test_multiplied( void )
    // test_multiplied_4
    add_test_to_suite( p_suite, test_multiplied_4, "test_multiplied_4" );
 
+   // test_multiplied_5
+   add_test_to_suite( p_suite, test_multiplied_5, "test_multiplied_5" );
+
+   // test_multiplied_6
+   add_test_to_suite( p_suite, test_multiplied_6, "test_multiplied_6" );
+
+   // test_multiplied_7
+   add_test_to_suite( p_suite, test_multiplied_7, "test_multiplied_7" );
+
+   // test_multiplied_8
+   add_test_to_suite( p_suite, test_multiplied_8, "test_multiplied_8" );
+
    return CUE_SUCCESS;
 
 }
@@ -135,6 +135,63 @@ void test_multiply_4( void )
    return;
 }
 
+/**
+   test_multiply_5
+
+   square float64 product that crosses the register and cache block edges
+*/
+
+void test_multiply_5( void )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+   int32_t n = 130;
+   int32_t ok = 1;
+   double item = 0.0;
+   d_matvec_t *dm = d_matvec_make( n, n );
+   d_matvec_t *dm1 = d_matvec_make( n, n );
+   d_matvec_t *dm2 = NULL;
+
+   for ( i = 0; i < n; i++ )
+   {
+      for ( j = 0; j < n; j++ )
+      {
+         d_matvec_put( dm, ( ( i * 7 + j * 3 ) % 11 ) - 5, i, j );
+         d_matvec_put( dm1, ( ( i * 5 + j * 2 ) % 13 ) - 6, i, j );
+      }
+   }
+
+   dm2 = d_matvec_make_from( dm );
+
+   d_matvec_multiply( dm, dm1 );
+
+   for ( i = 0; i < n; i++ )
+   {
+      for ( j = 0; j < n; j++ )
+      {
+         item = 0.0;
+         for ( k = 0; k < n; k++ )
+         {
+            item = item + d_matvec_item( dm2, i, k ) * d_matvec_item( dm1, k, j );
+         }
+
+         if ( d_matvec_item( dm, i, j ) != item )
+         {
+            ok = 0;
+         }
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   d_matvec_dispose( &dm );
+   d_matvec_dispose( &dm1 );
+   d_matvec_dispose( &dm2 );
+
+   return;
+}
+
 int
 add_test_multiply( void )
 {
@@ -162,6 +219,9 @@ add_test_multiply( void )
    // test_multiply_4
    add_test_to_suite( p_suite, test_multiply_4, "test_multiply_4" );
 
+   // test_multiply_5
+   add_test_to_suite( p_suite, test_multiply_5, "test_multiply_5" );
+
    return CUE_SUCCESS;
 
 }
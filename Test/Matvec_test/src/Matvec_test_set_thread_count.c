@@ -0,0 +1,409 @@
+/**
+ @file Matvec_test_set_thread_count.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Matvec_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Matvec_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+#include "Rng_Isaac.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   d_fill, cd_fill
+
+   fill a matvec with pseudo random values in [-1, 1]
+*/
+
+static
+void
+d_fill( d_matvec_t *dm, uint64_t seed )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( seed );
+
+   for ( i = 0; i < d_matvec_rows( dm ); i++ )
+   {
+      for ( j = 0; j < d_matvec_columns( dm ); j++ )
+      {
+         d_matvec_put( dm, 2.0*rng_isaac_f64_item( rng ) - 1.0, i, j );
+         rng_isaac_forth( rng );
+      }
+   }
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+static
+void
+cd_fill( cd_matvec_t *cdm, uint64_t seed )
+{
+   int32_t i = 0;
+   int32_t j = 0;
+   double re = 0.0;
+   double im = 0.0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( seed );
+
+   for ( i = 0; i < cd_matvec_rows( cdm ); i++ )
+   {
+      for ( j = 0; j < cd_matvec_columns( cdm ); j++ )
+      {
+         re = 2.0*rng_isaac_f64_item( rng ) - 1.0;
+         rng_isaac_forth( rng );
+         im = 2.0*rng_isaac_f64_item( rng ) - 1.0;
+         rng_isaac_forth( rng );
+         cd_matvec_put( cdm, re + im*I, i, j );
+      }
+   }
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+/**
+   d_same, cd_same
+
+   1 if the items of the two matvecs have identical bits
+*/
+
+static
+int32_t
+d_same( d_matvec_t *dm1, d_matvec_t *dm2 )
+{
+   int32_t result = 0;
+   int32_t count = d_matvec_rows( dm1 ) * d_matvec_columns( dm1 );
+
+   if
+   (
+      ( d_matvec_rows( dm1 ) == d_matvec_rows( dm2 ) )
+      &&
+      ( d_matvec_columns( dm1 ) == d_matvec_columns( dm2 ) )
+      &&
+      ( memcmp( d_matvec_as_array( dm1 ), d_matvec_as_array( dm2 ), count * sizeof( double ) ) == 0 )
+   )
+   {
+      result = 1;
+   }
+
+   return result;
+}
+
+static
+int32_t
+cd_same( cd_matvec_t *cdm1, cd_matvec_t *cdm2 )
+{
+   int32_t result = 0;
+   int32_t count = cd_matvec_rows( cdm1 ) * cd_matvec_columns( cdm1 );
+
+   if
+   (
+      ( cd_matvec_rows( cdm1 ) == cd_matvec_rows( cdm2 ) )
+      &&
+      ( cd_matvec_columns( cdm1 ) == cd_matvec_columns( cdm2 ) )
+      &&
+      ( memcmp( cd_matvec_as_array( cdm1 ), cd_matvec_as_array( cdm2 ), count * sizeof( complex double ) ) == 0 )
+   )
+   {
+      result = 1;
+   }
+
+   return result;
+}
+
+/**
+   test_set_thread_count_1
+*/
+
+void test_set_thread_count_1( void )
+{
+   f_matvec_t *fm = NULL;
+
+   fm = f_matvec_make( 3, 3 );
+
+   CU_ASSERT( f_matvec_thread_count( fm ) == 1 );
+
+   f_matvec_set_thread_count( fm, 4 );
+
+   CU_ASSERT( f_matvec_thread_count( fm ) == 4 );
+
+   f_matvec_set_thread_count( fm, 2 );
+
+   CU_ASSERT( f_matvec_thread_count( fm ) == 2 );
+
+   f_matvec_set_thread_count( fm, 1 );
+
+   CU_ASSERT( f_matvec_thread_count( fm ) == 1 );
+
+   f_matvec_set_thread_count( fm, 3 );
+
+   f_matvec_dispose( &fm );
+
+   return;
+}
+
+/**
+   test_set_thread_count_2
+
+   float64 operations on four threads give the same bits as on one
+*/
+
+void test_set_thread_count_2( void )
+{
+   int32_t n = 101;
+   d_matvec_t *dm1 = d_matvec_make( n, n );
+   d_matvec_t *dm2 = d_matvec_make( n, n );
+   d_matvec_t *dm3 = d_matvec_make( n, n );
+   d_matvec_t *dm4 = d_matvec_make( n, n + 7 );
+   d_matvec_t *dm = NULL;
+   d_matvec_t *dmt = NULL;
+   d_matvec_t *dmp = NULL;
+   d_matvec_t *dmpt = NULL;
+   double det = 0.0;
+   double det_t = 0.0;
+
+   d_fill( dm1, 1u );
+   d_fill( dm2, 2u );
+   d_fill( dm4, 4u );
+
+   // dm3 is the threaded copy of dm1
+   d_matvec_set_from( dm3, dm1 );
+   d_matvec_set_thread_count( dm3, 4 );
+   d_matvec_set_thread_threshold( dm3, 0 );
+
+   // products
+   dm = d_matvec_multiplied( dm1, dm4 );
+   dmt = d_matvec_multiplied( dm3, dm4 );
+   CU_ASSERT( d_same( dm, dmt ) == 1 );
+   d_matvec_dispose( &dm );
+   d_matvec_dispose( &dmt );
+
+   d_matvec_multiply( dm1, dm2 );
+   d_matvec_multiply( dm3, dm2 );
+   CU_ASSERT( d_same( dm1, dm3 ) == 1 );
+
+   // sums and item by item products
+   dm = d_matvec_added( dm1, dm2 );
+   dmt = d_matvec_added( dm3, dm2 );
+   CU_ASSERT( d_same( dm, dmt ) == 1 );
+   d_matvec_dispose( &dm );
+   d_matvec_dispose( &dmt );
+
+   d_matvec_add( dm1, dm2 );
+   d_matvec_add( dm3, dm2 );
+   CU_ASSERT( d_same( dm1, dm3 ) == 1 );
+
+   dm = d_matvec_item_by_item_multiplied( dm1, dm2 );
+   dmt = d_matvec_item_by_item_multiplied( dm3, dm2 );
+   CU_ASSERT( d_same( dm, dmt ) == 1 );
+   d_matvec_dispose( &dm );
+   d_matvec_dispose( &dmt );
+
+   d_matvec_item_by_item_multiply( dm1, dm2 );
+   d_matvec_item_by_item_multiply( dm3, dm2 );
+   CU_ASSERT( d_same( dm1, dm3 ) == 1 );
+
+   // transposes
+   d_matvec_transpose( dm1 );
+   d_matvec_transpose( dm3 );
+   CU_ASSERT( d_same( dm1, dm3 ) == 1 );
+
+   dmp = d_matvec_transposed( dm4 );
+   d_matvec_set_thread_count( dm4, 3 );
+   d_matvec_set_thread_threshold( dm4, 0 );
+   dmpt = d_matvec_transposed( dm4 );
+   CU_ASSERT( d_same( dmp, dmpt ) == 1 );
+   CU_ASSERT( d_matvec_item( dmpt, n + 6, n - 1 ) == d_matvec_item( dm4, n - 1, n + 6 ) );
+   d_matvec_dispose( &dmp );
+   d_matvec_dispose( &dmpt );
+
+   // inverses and determinants
+   det = d_matvec_determinant( dm1 );
+   det_t = d_matvec_determinant( dm3 );
+   CU_ASSERT( memcmp( &det, &det_t, sizeof( double ) ) == 0 );
+
+   dm = d_matvec_inverse( dm1 );
+   dmt = d_matvec_inverse( dm3 );
+   CU_ASSERT( d_same( dm, dmt ) == 1 );
+   d_matvec_dispose( &dm );
+   d_matvec_dispose( &dmt );
+
+   d_matvec_invert( dm1 );
+   d_matvec_invert( dm3 );
+   CU_ASSERT( d_same( dm1, dm3 ) == 1 );
+
+   d_matvec_dispose( &dm1 );
+   d_matvec_dispose( &dm2 );
+   d_matvec_dispose( &dm3 );
+   d_matvec_dispose( &dm4 );
+
+   return;
+}
+
+/**
+   test_set_thread_count_3
+
+   complex128 operations on three threads give the same bits as on one
+*/
+
+void test_set_thread_count_3( void )
+{
+   int32_t n = 67;
+   cd_matvec_t *cdm1 = cd_matvec_make( n, n );
+   cd_matvec_t *cdm2 = cd_matvec_make( n, n );
+   cd_matvec_t *cdm3 = cd_matvec_make( n, n );
+   cd_matvec_t *cdm = NULL;
+   cd_matvec_t *cdmt = NULL;
+   complex double det = 0.0;
+   complex double det_t = 0.0;
+
+   cd_fill( cdm1, 5u );
+   cd_fill( cdm2, 6u );
+
+   cd_matvec_set_from( cdm3, cdm1 );
+   cd_matvec_set_thread_count( cdm3, 3 );
+   cd_matvec_set_thread_threshold( cdm3, 0 );
+
+   cdm = cd_matvec_multiplied( cdm1, cdm2 );
+   cdmt = cd_matvec_multiplied( cdm3, cdm2 );
+   CU_ASSERT( cd_same( cdm, cdmt ) == 1 );
+   cd_matvec_dispose( &cdm );
+   cd_matvec_dispose( &cdmt );
+
+   cd_matvec_add( cdm1, cdm2 );
+   cd_matvec_add( cdm3, cdm2 );
+   CU_ASSERT( cd_same( cdm1, cdm3 ) == 1 );
+
+   cd_matvec_item_by_item_multiply( cdm1, cdm2 );
+   cd_matvec_item_by_item_multiply( cdm3, cdm2 );
+   CU_ASSERT( cd_same( cdm1, cdm3 ) == 1 );
+
+   det = cd_matvec_determinant( cdm1 );
+   det_t = cd_matvec_determinant( cdm3 );
+   CU_ASSERT( memcmp( &det, &det_t, sizeof( complex double ) ) == 0 );
+
+   cd_matvec_invert( cdm1 );
+   cd_matvec_invert( cdm3 );
+   CU_ASSERT( cd_same( cdm1, cdm3 ) == 1 );
+
+   cd_matvec_dispose( &cdm1 );
+   cd_matvec_dispose( &cdm2 );
+   cd_matvec_dispose( &cdm3 );
+
+   return;
+}
+
+/**
+   test_set_thread_count_4
+
+   small float32 and complex64 results on more threads than rows
+*/
+
+void test_set_thread_count_4( void )
+{
+   f_matvec_t *fm = NULL;
+   f_matvec_t *fm1 = NULL;
+   cf_matvec_t *cfm = NULL;
+   cf_matvec_t *cfm1 = NULL;
+
+   fm = f_matvec_make_from_args( 2, 2, 4, 1.0, 2.0, 3.0, 4.0 );
+   fm1 = f_matvec_make_from_args( 2, 2, 4, 5.0, 7.0, 9.0, 11.0 );
+   f_matvec_set_thread_count( fm, 8 );
+   f_matvec_set_thread_threshold( fm, 0 );
+
+   f_matvec_multiply( fm, fm1 );
+
+   CU_ASSERT( f_matvec_item( fm, 0, 0 ) == 23.0 );
+   CU_ASSERT( f_matvec_item( fm, 0, 1 ) == 29.0 );
+   CU_ASSERT( f_matvec_item( fm, 1, 0 ) == 51.0 );
+   CU_ASSERT( f_matvec_item( fm, 1, 1 ) == 65.0 );
+
+   f_matvec_transpose( fm );
+
+   CU_ASSERT( f_matvec_item( fm, 0, 1 ) == 51.0 );
+   CU_ASSERT( f_matvec_item( fm, 1, 0 ) == 29.0 );
+
+   cfm = cf_matvec_make_from_args( 2, 2, 4, 1.0 + 1.0*I, 2.0 + 0.0*I, 3.0 + 0.0*I, 4.0 - 1.0*I );
+   cfm1 = cf_matvec_make_from_args( 2, 2, 4, 1.0 + 0.0*I, 0.0*I, 0.0*I, 1.0*I );
+   cf_matvec_set_thread_count( cfm, 8 );
+   cf_matvec_set_thread_threshold( cfm, 0 );
+
+   cf_matvec_multiply( cfm, cfm1 );
+
+   CU_ASSERT( cf_matvec_item( cfm, 0, 0 ) == 1.0 + 1.0*I );
+   CU_ASSERT( cf_matvec_item( cfm, 0, 1 ) == 2.0*I );
+   CU_ASSERT( cf_matvec_item( cfm, 1, 0 ) == 3.0 );
+   CU_ASSERT( cf_matvec_item( cfm, 1, 1 ) == 1.0 + 4.0*I );
+
+   f_matvec_dispose( &fm );
+   f_matvec_dispose( &fm1 );
+   cf_matvec_dispose( &cfm );
+   cf_matvec_dispose( &cfm1 );
+
+   return;
+}
+
+int
+add_test_set_thread_count( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_set_thread_count", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_set_thread_count_1
+   add_test_to_suite( p_suite, test_set_thread_count_1, "test_set_thread_count_1" );
+
+   // test_set_thread_count_2
+   add_test_to_suite( p_suite, test_set_thread_count_2, "test_set_thread_count_2" );
+
+   // test_set_thread_count_3
+   add_test_to_suite( p_suite, test_set_thread_count_3, "test_set_thread_count_3" );
+
+   // test_set_thread_count_4
+   add_test_to_suite( p_suite, test_set_thread_count_4, "test_set_thread_count_4" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
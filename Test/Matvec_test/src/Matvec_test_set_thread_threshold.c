@@ -0,0 +1,131 @@
+/**
+ @file Matvec_test_set_thread_threshold.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Matvec_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Matvec_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_set_thread_threshold_1
+*/
+
+void test_set_thread_threshold_1( void )
+{
+   d_matvec_t *dm = NULL;
+
+   dm = d_matvec_make( 3, 3 );
+
+   CU_ASSERT( d_matvec_thread_threshold( dm ) > 0 );
+
+   d_matvec_set_thread_threshold( dm, 100 );
+
+   CU_ASSERT( d_matvec_thread_threshold( dm ) == 100 );
+
+   d_matvec_set_thread_threshold( dm, 0 );
+
+   CU_ASSERT( d_matvec_thread_threshold( dm ) == 0 );
+
+   d_matvec_dispose( &dm );
+
+   return;
+}
+
+/**
+   test_set_thread_threshold_2
+
+   operations below and above the threshold
+*/
+
+void test_set_thread_threshold_2( void )
+{
+   d_matvec_t *dm = NULL;
+   d_matvec_t *dm1 = NULL;
+   d_matvec_t *dm2 = NULL;
+
+   dm = d_matvec_make_from_args( 3, 3, 9, 2.0, 0.0, 0.0, 0.0, 4.0, 0.0, 1.0, 0.0, 8.0 );
+   dm1 = d_matvec_make_from_args( 3, 3, 9, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 );
+   d_matvec_set_thread_count( dm, 2 );
+
+   // 9 items, below the threshold
+   d_matvec_set_thread_threshold( dm, 10 );
+   dm2 = d_matvec_added( dm, dm1 );
+
+   CU_ASSERT( d_matvec_item( dm2, 0, 0 ) == 3.0 );
+   CU_ASSERT( d_matvec_item( dm2, 2, 2 ) == 9.0 );
+
+   d_matvec_dispose( &dm2 );
+
+   // at the threshold
+   d_matvec_set_thread_threshold( dm, 9 );
+   dm2 = d_matvec_added( dm, dm1 );
+
+   CU_ASSERT( d_matvec_item( dm2, 0, 0 ) == 3.0 );
+   CU_ASSERT( d_matvec_item( dm2, 2, 2 ) == 9.0 );
+   CU_ASSERT( d_matvec_determinant( dm ) == 64.0 );
+
+   d_matvec_dispose( &dm2 );
+
+   d_matvec_dispose( &dm );
+   d_matvec_dispose( &dm1 );
+
+   return;
+}
+
+int
+add_test_set_thread_threshold( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_set_thread_threshold", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_set_thread_threshold_1
+   add_test_to_suite( p_suite, test_set_thread_threshold_1, "test_set_thread_threshold_1" );
+
+   // test_set_thread_threshold_2
+   add_test_to_suite( p_suite, test_set_thread_threshold_2, "test_set_thread_threshold_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
@@ -34,6 +34,12 @@ add_test_dispose( void );
 int
 add_test_deep_dispose( void );
 
+int
+add_test_set_thread_count( void );
+
+int
+add_test_set_thread_threshold( void );
+
 int
 add_test_rows( void );
 
@@ -335,6 +341,8 @@ int main()
    add_test_make_from_args();
    add_test_dispose();
    add_test_deep_dispose();
+   add_test_set_thread_count();
+   add_test_set_thread_threshold();
    add_test_rows();
    add_test_columns();
    add_test_vector_length();
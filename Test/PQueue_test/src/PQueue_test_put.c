@@ -26,6 +26,7 @@ extern "C" {
 #include "CUnit/Basic.h"
 
 #include "int_PQueue.h"
+#include "tens_PQueue.h"
 
 int
 add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
@@ -111,6 +112,60 @@ void test_put_3( void )
    return;
 }
 
+/**
+   test_put_4
+*/
+
+void test_put_4( void )
+{
+   tens_pqueue_t *pqueue = NULL;
+   int32_t i = 0;
+   int32_t n = 0;
+
+   pqueue = tens_pqueue_make();
+
+   // 30..39 and 10..19 interleaved, equal priority within each ten
+   for ( i=0; i<10; i++ )
+   {
+      tens_pqueue_put( pqueue, 30 + i );
+      tens_pqueue_put( pqueue, 10 + i );
+   }
+
+   // then 20..29
+   for ( i=0; i<10; i++ )
+   {
+      tens_pqueue_put( pqueue, 20 + i );
+   }
+
+   CU_ASSERT( tens_pqueue_count( pqueue ) == 30 );
+
+   // each ten comes out in the order it was put
+   for ( i=0; i<10; i++ )
+   {
+      n = n + ( tens_pqueue_item( pqueue ) == 30 + i );
+      tens_pqueue_remove( pqueue );
+   }
+
+   for ( i=0; i<10; i++ )
+   {
+      n = n + ( tens_pqueue_item( pqueue ) == 20 + i );
+      tens_pqueue_remove( pqueue );
+   }
+
+   for ( i=0; i<10; i++ )
+   {
+      n = n + ( tens_pqueue_item( pqueue ) == 10 + i );
+      tens_pqueue_remove( pqueue );
+   }
+
+   CU_ASSERT( n == 30 );
+   CU_ASSERT( tens_pqueue_is_empty( pqueue ) == 1 );
+
+   tens_pqueue_dispose( &pqueue );
+
+   return;
+}
+
 int
 add_test_put( void )
 {
@@ -135,6 +190,9 @@ add_test_put( void )
    // test_put_3
    add_test_to_suite( p_suite, test_put_3, "test_put_3" );
 
+   // test_put_4
+   add_test_to_suite( p_suite, test_put_4, "test_put_4" );
+
    return CUE_SUCCESS;
 
 }
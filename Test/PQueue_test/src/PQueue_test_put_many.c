@@ -0,0 +1,242 @@
+/**
+ @file PQueue_test_put_many.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for PQueue_put_many"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for PQueue_put_many.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "int_PQueue.h"
+#include "tens_PQueue.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_put_many_1
+*/
+
+void test_put_many_1( void )
+{
+   int_pqueue_t *pqueue = NULL;
+   int32_t array[5] = { 7, 24, 3, 13, 11 };
+
+   pqueue = int_pqueue_make();
+
+   int_pqueue_put_many( pqueue, array, 5 );
+
+   CU_ASSERT( int_pqueue_count( pqueue ) == 5 );
+   CU_ASSERT( int_pqueue_item( pqueue ) == 24 );
+
+   int_pqueue_remove( pqueue );
+   CU_ASSERT( int_pqueue_item( pqueue ) == 13 );
+
+   int_pqueue_remove( pqueue );
+   CU_ASSERT( int_pqueue_item( pqueue ) == 11 );
+
+   int_pqueue_remove( pqueue );
+   CU_ASSERT( int_pqueue_item( pqueue ) == 7 );
+
+   int_pqueue_remove( pqueue );
+   CU_ASSERT( int_pqueue_item( pqueue ) == 3 );
+
+   int_pqueue_dispose( &pqueue );
+
+   return;
+}
+
+/**
+   test_put_many_2
+*/
+
+void test_put_many_2( void )
+{
+   int_pqueue_t *pqueue = NULL;
+   int32_t array[2] = { 5, 30 };
+
+   pqueue = int_pqueue_make();
+
+   int_pqueue_put( pqueue, 24 );
+   int_pqueue_put( pqueue, 7 );
+   int_pqueue_put( pqueue, 13 );
+
+   int_pqueue_put_many( pqueue, array, 2 );
+
+   CU_ASSERT( int_pqueue_count( pqueue ) == 5 );
+   CU_ASSERT( int_pqueue_item( pqueue ) == 30 );
+
+   int_pqueue_remove( pqueue );
+   CU_ASSERT( int_pqueue_item( pqueue ) == 24 );
+
+   int_pqueue_prune( pqueue, 3 );
+   CU_ASSERT( int_pqueue_item( pqueue ) == 5 );
+
+   int_pqueue_put_many( pqueue, array, 0 );
+   CU_ASSERT( int_pqueue_count( pqueue ) == 1 );
+
+   int_pqueue_dispose( &pqueue );
+
+   return;
+}
+
+/**
+   test_put_many_3
+*/
+
+void test_put_many_3( void )
+{
+   int_pqueue_t *pqueue = NULL;
+   int32_t array[1000] = { 0 };
+   int32_t i = 0;
+   int32_t last = 0;
+   int32_t ok = 1;
+
+   for ( i = 0; i < 1000; i++ )
+   {
+      array[i] = ( i * 7919 ) % 1000;
+   }
+
+   pqueue = int_pqueue_make();
+
+   int_pqueue_put_many( pqueue, array, 1000 );
+   int_pqueue_put_many( pqueue, array, 100 );
+
+   CU_ASSERT( int_pqueue_count( pqueue ) == 1100 );
+
+   last = int_pqueue_item( pqueue );
+   while ( int_pqueue_is_empty( pqueue ) == 0 )
+   {
+      if ( int_pqueue_item( pqueue ) > last )
+      {
+         ok = 0;
+      }
+      last = int_pqueue_item( pqueue );
+      int_pqueue_remove( pqueue );
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   int_pqueue_dispose( &pqueue );
+
+   return;
+}
+
+/**
+   test_put_many_4
+*/
+
+void test_put_many_4( void )
+{
+   tens_pqueue_t *pqueue = NULL;
+   int32_t array[20] = { 0 };
+   int32_t i = 0;
+   int32_t n = 0;
+
+   pqueue = tens_pqueue_make();
+
+   // a batch larger than the queue is heapified
+   for ( i=0; i<10; i++ )
+   {
+      array[2*i] = 10 + i;
+      array[2*i + 1] = 30 + i;
+   }
+
+   tens_pqueue_put_many( pqueue, array, 20 );
+
+   // a smaller batch is sifted up, equal priority with earlier items
+   for ( i=0; i<5; i++ )
+   {
+      array[i] = 35 + 10*( i % 2 ) + i;
+   }
+
+   tens_pqueue_put_many( pqueue, array, 5 );
+
+   CU_ASSERT( tens_pqueue_count( pqueue ) == 25 );
+
+   // 46, 48, then 30..39, then 35, 37, 39, then 10..19
+   n = n + ( tens_pqueue_item( pqueue ) == 46 );
+   tens_pqueue_remove( pqueue );
+   n = n + ( tens_pqueue_item( pqueue ) == 48 );
+   tens_pqueue_remove( pqueue );
+
+   for ( i=0; i<10; i++ )
+   {
+      n = n + ( tens_pqueue_item( pqueue ) == 30 + i );
+      tens_pqueue_remove( pqueue );
+   }
+
+   for ( i=0; i<3; i++ )
+   {
+      n = n + ( tens_pqueue_item( pqueue ) == 35 + 2*i );
+      tens_pqueue_remove( pqueue );
+   }
+
+   for ( i=0; i<10; i++ )
+   {
+      n = n + ( tens_pqueue_item( pqueue ) == 10 + i );
+      tens_pqueue_remove( pqueue );
+   }
+
+   CU_ASSERT( n == 25 );
+   CU_ASSERT( tens_pqueue_is_empty( pqueue ) == 1 );
+
+   tens_pqueue_dispose( &pqueue );
+
+   return;
+}
+
+int
+add_test_put_many( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_put_many", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_put_many_1
+   add_test_to_suite( p_suite, test_put_many_1, "test_put_many_1" );
+
+   // test_put_many_2
+   add_test_to_suite( p_suite, test_put_many_2, "test_put_many_2" );
+
+   // test_put_many_3
+   add_test_to_suite( p_suite, test_put_many_3, "test_put_many_3" );
+
+   // test_put_many_4
+   add_test_to_suite( p_suite, test_put_many_4, "test_put_many_4" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
@@ -34,6 +34,9 @@ add_test_is_empty( void );
 int
 add_test_put( void );
 
+int
+add_test_put_many( void );
+
 int
 add_test_remove( void );
 
@@ -104,6 +107,7 @@ int main()
    add_test_count();
    add_test_is_empty();
    add_test_put();
+   add_test_put_many();
    add_test_remove();
    add_test_remove_and_dispose();
    add_test_prune();
@@ -0,0 +1,49 @@
+/**
+ @file tens_PQueue.h
+ @author Greg Lee
+ @version 0.0
+ @brief: "include file for PQueue of ints ordered by tens"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Defines for tens_PQueue type, a PQueue of ints ordered by their tens
+ digit only.
+
+*/
+
+#ifndef TENS_PQUEUE_H_
+#define TENS_PQUEUE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PROTOCOLS_ENABLED
+
+#include "base.h"
+#include "protocol.h"
+
+#define Prefix tens
+#define Type int32_t
+
+#include "PQueue.h"
+
+#undef Prefix
+#undef Type
+ 
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TENS_PQUEUE_H_ */
+
+/* End of file */
+
+
+
@@ -0,0 +1,103 @@
+/**
+ @file PSorter_test_make_n.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for PSorter_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for PSorter_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+ 
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "i_PSorter.h"
+#include "i_Sorter.h"
+#include "p_Basic.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_make_n_1
+*/
+
+void test_make_n_1( void )
+{
+   i_psorter_t *sorter = NULL;
+
+   sorter = i_psorter_make_n( 3, 100 );
+   CU_ASSERT( sorter != NULL );
+   CU_ASSERT( i_psorter_thread_count( sorter ) == 3 );
+   CU_ASSERT( i_psorter_grain_size( sorter ) == 100 );
+   
+   i_psorter_dispose( &sorter );
+   CU_ASSERT( sorter == NULL );
+   
+   return;
+}
+
+/**
+   test_make_n_2
+*/
+
+void test_make_n_2( void )
+{
+   i_psorter_t *sorter = NULL;
+
+   sorter = i_psorter_make_n( 1, 1 );
+   CU_ASSERT( sorter != NULL );
+   CU_ASSERT( i_psorter_thread_count( sorter ) == 1 );
+   CU_ASSERT( i_psorter_grain_size( sorter ) == 1 );
+   
+   i_psorter_dispose( &sorter );
+   CU_ASSERT( sorter == NULL );
+   
+   return;
+}
+
+int
+add_test_make_n( void )
+{
+   CU_pSuite p_suite = NULL;
+   
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_make_n", NULL, NULL);
+   if (NULL == p_suite) 
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_make_n_1
+   add_test_to_suite( p_suite, test_make_n_1, "test_make_n_1" );
+
+   // test_make_n_2
+   add_test_to_suite( p_suite, test_make_n_2, "test_make_n_2" );
+
+   return CUE_SUCCESS;
+   
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
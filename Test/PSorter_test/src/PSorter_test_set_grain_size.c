@@ -0,0 +1,96 @@
+/**
+ @file PSorter_test_set_grain_size.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for PSorter_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for PSorter_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+ 
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "i_PSorter.h"
+#include "i_Sequence.h"
+#include "p_Basic.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_set_grain_size_1
+*/
+
+void test_set_grain_size_1( void )
+{
+   int32_t i = 0;
+   i_psorter_t *sorter = i_psorter_make_n( 4, 1000 );
+   i_sequence_t *seq = i_sequence_make_n( 100 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+
+   i_sequence_ensure_count( seq, 100 );
+
+   i_psorter_set_grain_size( sorter, 3 );
+   CU_ASSERT( i_psorter_grain_size( sorter ) == 3 );
+
+   for ( i = 0; i < 100; i++ )
+   {
+      i_sequence_put( seq, ( 37 * i ) % 100, i );
+   }
+
+   i_psorter_sort_predefined_comparison_function( sorter, pb_seq );
+
+   for ( i = 0; i < 100; i++ )
+   {
+      CU_ASSERT( i_sequence_item( seq, i ) == i );
+   }
+
+   i_psorter_dispose( &sorter );
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+int
+add_test_set_grain_size( void )
+{
+   CU_pSuite p_suite = NULL;
+   
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_set_grain_size", NULL, NULL);
+   if (NULL == p_suite) 
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_set_grain_size_1
+   add_test_to_suite( p_suite, test_set_grain_size_1, "test_set_grain_size_1" );
+
+   return CUE_SUCCESS;
+   
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,570 @@
+/**
+ @file PSorter_test_sort.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for PSorter_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for PSorter_t.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "Protocol_Base.h"
+#include "i_Sequence.h"
+#include "i_DList.h"
+#include "i_PSorter.h"
+#include "i_Sorter.h"
+#include "p_Basic.h"
+#include "Rng_Isaac.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+static
+int32_t
+func( int32_t a, int32_t b )
+{
+   int32_t result = 0;
+   
+   if ( a < b )
+   {
+      result = -1;
+   }
+   else if ( a == b )
+   {
+      result = 0;
+   }
+   else
+   {
+      result = 1;
+   }
+   
+   return result;
+}
+
+void test_sort_0( void )
+{
+
+   i_sequence_t *seq = i_sequence_make_n( 1 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+   
+   i_sequence_ensure_count( seq, 1 );
+   
+   i_sequence_put( seq, 1, 0 );
+   
+   i_psorter_sort( pb_seq, func );
+ 
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+void test_sort_1( void )
+{
+
+   i_sequence_t *seq = i_sequence_make_n( 2 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+   
+   i_sequence_ensure_count( seq, 2 );
+   
+   i_sequence_put( seq, 1, 0 );
+   i_sequence_put( seq, 2, 1 );
+   
+   i_psorter_sort( pb_seq, func );
+ 
+   
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 1 ) == 2 );
+
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+void test_sort_2( void )
+{
+
+   i_sequence_t *seq = i_sequence_make_n( 2 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+   
+   i_sequence_ensure_count( seq, 2 );
+   
+   i_sequence_put( seq, 2, 0 );
+   i_sequence_put( seq, 1, 1 );
+   
+   i_psorter_sort( pb_seq, func );
+ 
+   
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 1 ) == 2 );
+
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+void test_sort_3a( void )
+{
+
+   i_sequence_t *seq = i_sequence_make_n( 3 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+   
+   i_sequence_ensure_count( seq, 3 );
+   
+   i_sequence_put( seq, 1, 0 );
+   i_sequence_put( seq, 2, 1 );
+   i_sequence_put( seq, 3, 2 );
+   
+   i_psorter_sort( pb_seq, func );
+ 
+   
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 1 ) == 2 );
+   CU_ASSERT( i_sequence_item( seq, 2 ) == 3 );
+
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+void test_sort_3b( void )
+{
+
+   i_sequence_t *seq = i_sequence_make_n( 3 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+   
+   i_sequence_ensure_count( seq, 3 );
+   
+   i_sequence_put( seq, 3, 0 );
+   i_sequence_put( seq, 1, 1 );
+   i_sequence_put( seq, 2, 2 );
+   
+   i_psorter_sort( pb_seq, func );
+ 
+   
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 1 ) == 2 );
+   CU_ASSERT( i_sequence_item( seq, 2 ) == 3 );
+
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+void test_sort_3c( void )
+{
+
+   i_sequence_t *seq = i_sequence_make_n( 3 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+   
+   i_sequence_ensure_count( seq, 3 );
+   
+   i_sequence_put( seq, 2, 0 );
+   i_sequence_put( seq, 3, 1 );
+   i_sequence_put( seq, 1, 2 );
+   
+   i_psorter_sort( pb_seq, func );
+ 
+   
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 1 ) == 2 );
+   CU_ASSERT( i_sequence_item( seq, 2 ) == 3 );
+
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+void test_sort_3d( void )
+{
+
+   i_sequence_t *seq = i_sequence_make_n( 3 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+   
+   i_sequence_ensure_count( seq, 3 );
+   
+   i_sequence_put( seq, 3, 0 );
+   i_sequence_put( seq, 2, 1 );
+   i_sequence_put( seq, 1, 2 );
+   
+   i_psorter_sort( pb_seq, func );
+ 
+   
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 1 ) == 2 );
+   CU_ASSERT( i_sequence_item( seq, 2 ) == 3 );
+
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+void test_sort_3e( void )
+{
+
+   i_sequence_t *seq = i_sequence_make_n( 3 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+   
+   i_sequence_ensure_count( seq, 3 );
+   
+   i_sequence_put( seq, 2, 0 );
+   i_sequence_put( seq, 1, 1 );
+   i_sequence_put( seq, 3, 2 );
+   
+   i_psorter_sort( pb_seq, func );
+ 
+   
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 1 ) == 2 );
+   CU_ASSERT( i_sequence_item( seq, 2 ) == 3 );
+
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+void test_sort_3f( void )
+{
+
+   i_sequence_t *seq = i_sequence_make_n( 3 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+   
+   i_sequence_ensure_count( seq, 3 );
+   
+   i_sequence_put( seq, 1, 0 );
+   i_sequence_put( seq, 3, 1 );
+   i_sequence_put( seq, 2, 2 );
+   
+   i_psorter_sort( pb_seq, func );
+ 
+   
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 1 ) == 2 );
+   CU_ASSERT( i_sequence_item( seq, 2 ) == 3 );
+
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+void test_sort_4( void )
+{
+
+   i_sequence_t *seq = i_sequence_make_n( 3 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+   int32_t result = 0;
+
+   i_sequence_ensure_count( seq, 6 );
+
+   i_sequence_put( seq, 6, 0 );
+   i_sequence_put( seq, 5, 1 );
+   i_sequence_put( seq, 4, 2 );
+   i_sequence_put( seq, 3, 3 );
+   i_sequence_put( seq, 2, 4 );
+   i_sequence_put( seq, 1, 5 );
+
+   i_psorter_sort( pb_seq, func );
+
+   result = i_psorter_is_sorted( pb_seq, func );
+   CU_ASSERT( result == 1 );
+
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 1 ) == 2 );
+   CU_ASSERT( i_sequence_item( seq, 2 ) == 3 );
+   CU_ASSERT( i_sequence_item( seq, 3 ) == 4 );
+   CU_ASSERT( i_sequence_item( seq, 4 ) == 5 );
+   CU_ASSERT( i_sequence_item( seq, 5 ) == 6 );
+
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+/**
+   test_sort_5
+*/
+
+void test_sort_5( void )
+{
+   i_psorter_t *sorter = NULL;
+   int32_t result = 0;
+
+   sorter = i_psorter_make();
+   
+   i_sequence_t *seq = i_sequence_make_n( 3 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+
+   i_sequence_ensure_count( seq, 6 );
+
+   i_sequence_put( seq, 6, 0 );
+   i_sequence_put( seq, 5, 1 );
+   i_sequence_put( seq, 4, 2 );
+   i_sequence_put( seq, 3, 3 );
+   i_sequence_put( seq, 2, 4 );
+   i_sequence_put( seq, 1, 5 );
+
+   result = i_psorter_is_sorted_predefined_comparison_function( sorter, pb_seq );
+   CU_ASSERT( result == 0 );
+
+   i_psorter_sort_predefined_comparison_function( sorter, pb_seq );
+   
+   result = i_psorter_is_sorted_predefined_comparison_function( sorter, pb_seq );
+   CU_ASSERT( result == 1 );
+
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 1 ) == 2 );
+   CU_ASSERT( i_sequence_item( seq, 2 ) == 3 );
+   CU_ASSERT( i_sequence_item( seq, 3 ) == 4 );
+   CU_ASSERT( i_sequence_item( seq, 4 ) == 5 );
+   CU_ASSERT( i_sequence_item( seq, 5 ) == 6 );
+
+   i_psorter_dispose( &sorter );
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+/**
+   test_sort_6
+
+   sort a DList, which has no item array and is sorted through item and put
+*/
+
+void test_sort_6( void )
+{
+   int32_t i = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+
+   i_dlist_t *list = i_dlist_make();
+   protocol_base_t *pb_list = ( protocol_base_t * ) list;
+
+   for ( i = 0; i < 50; i++ )
+   {
+      i_dlist_put_last( list, ( int32_t ) ( rng_isaac_u32_item( rng ) >> 24 ) );
+      rng_isaac_forth( rng );
+   }
+
+   CU_ASSERT( i_psorter_is_sorted( pb_list, func ) == 0 );
+
+   i_psorter_sort( pb_list, func );
+
+   CU_ASSERT( i_psorter_is_sorted( pb_list, func ) == 1 );
+   CU_ASSERT( i_dlist_count( list ) == 50 );
+
+   for ( i = 1; i < 50; i++ )
+   {
+      CU_ASSERT( i_dlist_item( list, i - 1 ) <= i_dlist_item( list, i ) );
+   }
+
+   i_dlist_dispose( &list );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+/**
+   key_func
+
+   compare the high 16 bits only, to check that equal keys keep their order
+*/
+
+static
+int32_t
+key_func( int32_t a, int32_t b )
+{
+   return ( ( a >> 16 ) > ( b >> 16 ) ) - ( ( a >> 16 ) < ( b >> 16 ) );
+}
+
+/**
+   sort_stable_ok
+
+   sort n values with the given threads and grain, check order and stability
+*/
+
+static
+void
+sort_stable_ok( int32_t n, int32_t thread_count, int32_t grain_size )
+{
+   int32_t i = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 4321 );
+   i_psorter_t *sorter = i_psorter_make_n( thread_count, grain_size );
+   protocol_base_t *pb_sorter = ( protocol_base_t * ) sorter;
+   i_sequence_t *seq = i_sequence_make_n( n );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+
+   i_sequence_ensure_count( seq, n );
+
+   // a small random key in the high bits, the original index in the low bits
+   for ( i = 0; i < n; i++ )
+   {
+      i_sequence_put( seq, ( int32_t ) ( ( ( rng_isaac_u32_item( rng ) >> 24 ) % 100 ) << 16 ) + i, i );
+      rng_isaac_forth( rng );
+   }
+
+   i_sorter_sort( pb_sorter, pb_seq );
+
+   CU_ASSERT( i_psorter_is_sorted_predefined_comparison_function( sorter, pb_seq ) == 1 );
+
+   for ( i = 1; i < n; i++ )
+   {
+      CU_ASSERT( i_sequence_item( seq, i - 1 ) < i_sequence_item( seq, i ) );
+   }
+
+   CU_ASSERT( key_func( i_sequence_item( seq, 0 ), i_sequence_item( seq, n - 1 ) ) <= 0 );
+
+   p_basic_dispose( &pb_sorter );
+   i_sequence_dispose( &seq );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+/**
+   test_sort_7
+
+   parallel sorts with several thread counts and small grains
+*/
+
+void test_sort_7( void )
+{
+   sort_stable_ok( 1000, 2, 8 );
+   sort_stable_ok( 1001, 3, 8 );
+   sort_stable_ok( 4099, 4, 16 );
+   sort_stable_ok( 10007, 7, 32 );
+   sort_stable_ok( 10007, 8, 1 );
+   sort_stable_ok( 5, 8, 1 );
+
+   return;
+}
+
+/**
+   test_sort_8
+
+   parallel is_sorted finds an item out of order at a chunk boundary
+*/
+
+void test_sort_8( void )
+{
+   int32_t i = 0;
+   int32_t n = 1000;
+   i_psorter_t *sorter = i_psorter_make_n( 4, 10 );
+   i_sequence_t *seq = i_sequence_make_n( n );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+
+   i_sequence_ensure_count( seq, n );
+
+   for ( i = 0; i < n; i++ )
+   {
+      i_sequence_put( seq, i, i );
+   }
+
+   CU_ASSERT( i_psorter_is_sorted_predefined_comparison_function( sorter, pb_seq ) == 1 );
+
+   // chunks are 250 items long
+   i_sequence_put( seq, 248, 250 );
+
+   CU_ASSERT( i_psorter_is_sorted_predefined_comparison_function( sorter, pb_seq ) == 0 );
+
+   i_psorter_sort_predefined_comparison_function( sorter, pb_seq );
+
+   CU_ASSERT( i_psorter_is_sorted_predefined_comparison_function( sorter, pb_seq ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 249 ) == 248 );
+   CU_ASSERT( i_sequence_item( seq, 250 ) == 249 );
+
+   i_psorter_dispose( &sorter );
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+int
+add_test_sort( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_sort", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_sort_0
+   add_test_to_suite( p_suite, test_sort_0, "test_sort_0" );
+
+   // test_sort_1
+   add_test_to_suite( p_suite, test_sort_1, "test_sort_1" );
+
+   // test_sort_2
+   add_test_to_suite( p_suite, test_sort_2, "test_sort_2" );
+
+   // test_sort_3a
+   add_test_to_suite( p_suite, test_sort_3a, "test_sort_3a" );
+
+   // test_sort_3b
+   add_test_to_suite( p_suite, test_sort_3b, "test_sort_3b" );
+
+   // test_sort_3c
+   add_test_to_suite( p_suite, test_sort_3c, "test_sort_3c" );
+
+   // test_sort_3d
+   add_test_to_suite( p_suite, test_sort_3d, "test_sort_3d" );
+
+   // test_sort_3e
+   add_test_to_suite( p_suite, test_sort_3e, "test_sort_3e" );
+
+   // test_sort_3f
+   add_test_to_suite( p_suite, test_sort_3f, "test_sort_3f" );
+
+   // test_sort_4
+   add_test_to_suite( p_suite, test_sort_4, "test_sort_4" );
+
+   // test_sort_5
+   add_test_to_suite( p_suite, test_sort_5, "test_sort_5" );
+
+   // test_sort_6
+   add_test_to_suite( p_suite, test_sort_6, "test_sort_6" );
+
+   // test_sort_7
+   add_test_to_suite( p_suite, test_sort_7, "test_sort_7" );
+
+   // test_sort_8
+   add_test_to_suite( p_suite, test_sort_8, "test_sort_8" );
+
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,45 @@
+/**
+ @file i_Sorter.h
+ @author Greg Lee
+ @version 0.0
+ @brief: "include file for Sorter of ints"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Defines to make Sorter of ints.
+
+*/
+
+#ifndef I_SORTER_H
+#define I_SORTER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "base.h"
+
+#define Prefix i
+#define Type int32_t
+
+#include "P_Sorter.h"
+
+#undef Prefix
+#undef Type
+ 
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* I_SORTER_H */
+
+/* End of file */
+
+
+
@@ -0,0 +1,110 @@
+/*
+   Tests for path_utilities
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// test suite declarations
+
+int
+add_test_make( void );
+
+int
+add_test_make_n( void );
+
+int
+add_test_clone( void );
+
+int
+add_test_copy( void );
+
+int
+add_test_is_equal( void );
+
+int
+add_test_sort( void );
+
+int
+add_test_set_thread_count( void );
+
+int
+add_test_set_grain_size( void );
+
+int
+add_test_all( void );
+
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name )
+{
+   // add the test to the suite
+   CU_pTest p_test = CU_add_test( p_suite, name, test );
+
+   if ( p_test == NULL )
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   return CUE_SUCCESS;
+}
+
+/**
+   main() function for setting up and running the tests.
+
+   Returns a CUE_SUCCESS on successful running, another
+   CUnit error code on failure.
+
+*/
+
+int main()
+{
+   CU_ErrorCode result;
+
+   // initialize the CUnit test registry
+   result = CU_initialize_registry();
+   if ( result != CUE_SUCCESS )
+   {
+      return CU_get_error();
+   }
+
+   // add tests for path utilites
+
+   add_test_make();
+   add_test_make_n();
+   add_test_clone();
+   add_test_copy();
+   add_test_is_equal();
+   add_test_sort();
+   add_test_set_thread_count();
+   add_test_set_grain_size();
+   add_test_all();
+   
+   // Run all tests using the CUnit Basic interface
+
+   // set the test mode to verbose
+   CU_basic_set_mode(CU_BRM_VERBOSE);
+
+   // run the tests
+   CU_basic_run_tests();
+
+   // do any cleanup
+   CU_cleanup_registry();
+
+   // exit with error code
+   return CU_get_error();
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
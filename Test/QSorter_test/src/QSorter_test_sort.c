@@ -30,7 +30,10 @@ extern "C" {
 
 #include "Protocol_Base.h"
 #include "i_Sequence.h"
+#include "i_DList.h"
+#include "i_Circular_Array.h"
 #include "i_QSorter.h"
+#include "Rng_Isaac.h"
 
 int
 add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
@@ -333,6 +336,89 @@ void test_sort_5( void )
    return;
 }
 
+/**
+   test_sort_6
+
+   sort a DList, which has no item array and is sorted through item and put
+*/
+
+void test_sort_6( void )
+{
+   int32_t i = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+
+   i_dlist_t *list = i_dlist_make();
+   protocol_base_t *pb_list = ( protocol_base_t * ) list;
+
+   for ( i = 0; i < 50; i++ )
+   {
+      i_dlist_put_last( list, ( int32_t ) ( rng_isaac_u32_item( rng ) >> 24 ) );
+      rng_isaac_forth( rng );
+   }
+
+   CU_ASSERT( i_qsorter_is_sorted( pb_list, func ) == 0 );
+
+   i_qsorter_sort( pb_list, func );
+
+   CU_ASSERT( i_qsorter_is_sorted( pb_list, func ) == 1 );
+   CU_ASSERT( i_dlist_count( list ) == 50 );
+
+   for ( i = 1; i < 50; i++ )
+   {
+      CU_ASSERT( i_dlist_item( list, i - 1 ) <= i_dlist_item( list, i ) );
+   }
+
+   i_dlist_dispose( &list );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+/**
+   test_sort_7
+
+   sort a Circular_Array whose items wrap around the end of its buffer
+*/
+
+void test_sort_7( void )
+{
+   int32_t i = 0;
+
+   i_circular_array_t *ca = i_circular_array_make( 8 );
+   protocol_base_t *pb_ca = ( protocol_base_t * ) ca;
+
+   for ( i = 0; i < 5; i++ )
+   {
+      i_circular_array_put_last( ca, 0 );
+   }
+
+   for ( i = 0; i < 4; i++ )
+   {
+      i_circular_array_remove_first( ca );
+   }
+
+   for ( i = 6; i > 0; i-- )
+   {
+      i_circular_array_put_last( ca, i );
+   }
+
+   CU_ASSERT( i_circular_array_count( ca ) == 7 );
+
+   i_qsorter_sort( pb_ca, func );
+
+   CU_ASSERT( i_qsorter_is_sorted( pb_ca, func ) == 1 );
+
+   for ( i = 0; i < 7; i++ )
+   {
+      CU_ASSERT( i_circular_array_item( ca, i ) == i );
+   }
+
+   i_circular_array_dispose( &ca );
+
+   return;
+}
+
 int
 add_test_sort( void )
 {
@@ -381,6 +467,12 @@ add_test_sort( void )
    // test_sort_5
    add_test_to_suite( p_suite, test_sort_5, "test_sort_5" );
 
+   // test_sort_6
+   add_test_to_suite( p_suite, test_sort_6, "test_sort_6" );
+
+   // test_sort_7
+   add_test_to_suite( p_suite, test_sort_7, "test_sort_7" );
+
 
    return CUE_SUCCESS;
 
@@ -11,7 +11,7 @@ solution( name )
    project( name )
       kind "ConsoleApp"
       language "C"
-      files { "src/*.c", "../../Protocol_Base/*.c" }
+      files { "../../base/*.c", "src/*.c", "../../Protocol_Base/*.c" }
       links { "cunit", "m", "rt", "gc", "gcov", "pthread" }
       includedirs { "src", "../../base", "../../dbc", "../../Quaternion", "../../Protocol_Base", "../../P_Indexable", "../../P_Iterable", "../../P_Iterable_kv", "../../P_DIterable", "../../P_DIterable_kv", "../../P_Clonable", "../../P_Searcher", "../../P_Sorter", "../../Matvec"  }
 
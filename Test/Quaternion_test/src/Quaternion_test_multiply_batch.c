@@ -0,0 +1,160 @@
+/**
+ @file Quaternion_test_multiply_batch.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Quaternion_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Quaternion_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "f_Quaternion.h"
+#include "d_Quaternion.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_multiply_batch_1
+*/
+
+void test_multiply_batch_1( void )
+{
+   float32_t q0[2] = { 1.0, 2.0 };
+   float32_t q1[2] = { 2.0, 3.0 };
+   float32_t q2[2] = { 3.0, 4.0 };
+   float32_t q3[2] = { 4.0, 5.0 };
+   float32_t o0[2] = { 4.0, 1.0 };
+   float32_t o1[2] = { 3.0, 0.0 };
+   float32_t o2[2] = { 2.0, 0.0 };
+   float32_t o3[2] = { 1.0, 0.0 };
+
+   f_quaternion_multiply_batch( q0, q1, q2, q3, o0, o1, o2, o3, 2 );
+
+   CU_ASSERT( q0[0] == -12.0 );
+   CU_ASSERT( q1[0] == 6.0 );
+   CU_ASSERT( q2[0] == 24.0 );
+   CU_ASSERT( q3[0] == 12.0 );
+
+   // multiplied by one
+   CU_ASSERT( q0[1] == 2.0 );
+   CU_ASSERT( q1[1] == 3.0 );
+   CU_ASSERT( q2[1] == 4.0 );
+   CU_ASSERT( q3[1] == 5.0 );
+
+   return;
+}
+
+/**
+   test_multiply_batch_2
+*/
+
+void test_multiply_batch_2( void )
+{
+   int32_t i = 0;
+   int32_t count = 257;
+   int32_t ok = 1;
+   d_quaternion_t *dq = NULL;
+   d_quaternion_t *dq1 = NULL;
+   float64_t *q[4] = { NULL, NULL, NULL, NULL };
+   float64_t *o[4] = { NULL, NULL, NULL, NULL };
+
+   for ( i = 0; i < 4; i++ )
+   {
+      q[i] = ( float64_t * ) calloc( count, sizeof( float64_t ) );
+      o[i] = ( float64_t * ) calloc( count, sizeof( float64_t ) );
+   }
+
+   for ( i = 0; i < count; i++ )
+   {
+      q[0][i] = sin( 0.3 * i );
+      q[1][i] = cos( 0.7 * i );
+      q[2][i] = 0.01 * i;
+      q[3][i] = -1.5;
+      o[0][i] = cos( 0.2 * i );
+      o[1][i] = 2.0;
+      o[2][i] = sin( 1.3 * i );
+      o[3][i] = 0.5 - 0.002 * i;
+   }
+
+   d_quaternion_multiply_batch( q[0], q[1], q[2], q[3], o[0], o[1], o[2], o[3], count );
+
+   for ( i = 0; i < count; i++ )
+   {
+      dq = d_quaternion_make( sin( 0.3 * i ), cos( 0.7 * i ), 0.01 * i, -1.5 );
+      dq1 = d_quaternion_make( o[0][i], o[1][i], o[2][i], o[3][i] );
+      d_quaternion_multiply( dq, dq1 );
+
+      if (
+            ( fabs( d_quaternion_q0( dq ) - q[0][i] ) > 1.0e-12 )
+            || ( fabs( d_quaternion_q1( dq ) - q[1][i] ) > 1.0e-12 )
+            || ( fabs( d_quaternion_q2( dq ) - q[2][i] ) > 1.0e-12 )
+            || ( fabs( d_quaternion_q3( dq ) - q[3][i] ) > 1.0e-12 )
+         )
+      {
+         ok = 0;
+      }
+
+      d_quaternion_dispose( &dq );
+      d_quaternion_dispose( &dq1 );
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   for ( i = 0; i < 4; i++ )
+   {
+      free( q[i] );
+      free( o[i] );
+   }
+
+   return;
+}
+
+int
+add_test_multiply_batch( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_multiply_batch", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_multiply_batch_1
+   add_test_to_suite( p_suite, test_multiply_batch_1, "test_multiply_batch_1" );
+
+   // test_multiply_batch_2
+   add_test_to_suite( p_suite, test_multiply_batch_2, "test_multiply_batch_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
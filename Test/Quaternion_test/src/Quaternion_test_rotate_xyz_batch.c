@@ -0,0 +1,156 @@
+/**
+ @file Quaternion_test_rotate_xyz_batch.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Quaternion_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Quaternion_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "f_Quaternion.h"
+#include "d_Quaternion.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_rotate_xyz_batch_1
+*/
+
+void test_rotate_xyz_batch_1( void )
+{
+   f_quaternion_t *fq = NULL;
+   float32_t *array = NULL;
+   float32_t x[3] = { 1.0, 0.0, 0.0 };
+   float32_t y[3] = { 0.0, 1.0, 0.0 };
+   float32_t z[3] = { 0.0, 0.0, 1.0 };
+
+   fq = f_quaternion_make_from_roll_pitch_yaw( 0.0, M_PI/2.0, 0.0 );
+   f_quaternion_rotate_xyz_batch( fq, x, y, z, 3 );
+
+   CU_ASSERT( fabs( x[0] ) < 0.00001 );
+   CU_ASSERT( fabs( y[0] ) < 0.00001 );
+   CU_ASSERT( fabs( z[0] + 1.0 ) < 0.00001 );
+
+   CU_ASSERT( fabs( x[1] ) < 0.00001 );
+   CU_ASSERT( fabs( y[1] - 1.0 ) < 0.00001 );
+   CU_ASSERT( fabs( z[1] ) < 0.00001 );
+
+   array = f_quaternion_rotate_xyz( fq, 0.0, 0.0, 1.0 );
+   CU_ASSERT( fabs( x[2] - array[0] ) < 0.00001 );
+   CU_ASSERT( fabs( y[2] - array[1] ) < 0.00001 );
+   CU_ASSERT( fabs( z[2] - array[2] ) < 0.00001 );
+
+   free( array );
+   f_quaternion_dispose( &fq );
+
+   return;
+}
+
+/**
+   test_rotate_xyz_batch_2
+*/
+
+void test_rotate_xyz_batch_2( void )
+{
+   int32_t i = 0;
+   int32_t count = 1001;
+   d_quaternion_t *dq = NULL;
+   float64_t *array = NULL;
+   float64_t *x = ( float64_t * ) calloc( count, sizeof( float64_t ) );
+   float64_t *y = ( float64_t * ) calloc( count, sizeof( float64_t ) );
+   float64_t *z = ( float64_t * ) calloc( count, sizeof( float64_t ) );
+   int32_t ok = 1;
+
+   // not of unit magnitude
+   dq = d_quaternion_make( 0.9, -0.7, 0.4, 1.3 );
+
+   for ( i = 0; i < count; i++ )
+   {
+      x[i] = sin( 0.37 * i );
+      y[i] = cos( 1.1 * i ) * 2.0;
+      z[i] = 0.01 * i - 5.0;
+   }
+
+   d_quaternion_rotate_xyz_batch( dq, x, y, z, count );
+
+   for ( i = 0; i < count; i++ )
+   {
+      array = d_quaternion_rotate_xyz( dq, sin( 0.37 * i ), cos( 1.1 * i ) * 2.0, 0.01 * i - 5.0 );
+
+      if (
+            ( fabs( x[i] - array[0] ) > 1.0e-12 )
+            || ( fabs( y[i] - array[1] ) > 1.0e-12 )
+            || ( fabs( z[i] - array[2] ) > 1.0e-12 )
+         )
+      {
+         ok = 0;
+      }
+
+      free( array );
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   // no points, nothing changed
+   x[0] = 1.0;
+   d_quaternion_rotate_xyz_batch( dq, x, y, z, 0 );
+   CU_ASSERT( x[0] == 1.0 );
+
+   free( x );
+   free( y );
+   free( z );
+   d_quaternion_dispose( &dq );
+
+   return;
+}
+
+int
+add_test_rotate_xyz_batch( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_rotate_xyz_batch", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_rotate_xyz_batch_1
+   add_test_to_suite( p_suite, test_rotate_xyz_batch_1, "test_rotate_xyz_batch_1" );
+
+   // test_rotate_xyz_batch_2
+   add_test_to_suite( p_suite, test_rotate_xyz_batch_2, "test_rotate_xyz_batch_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
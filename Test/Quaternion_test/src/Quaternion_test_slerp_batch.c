@@ -0,0 +1,187 @@
+/**
+ @file Quaternion_test_slerp_batch.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Quaternion_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Quaternion_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "f_Quaternion.h"
+#include "d_Quaternion.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_slerp_batch_1
+*/
+
+void test_slerp_batch_1( void )
+{
+   d_quaternion_t *dq = NULL;
+   float64_t q0[3] = { 0.0, 0.0, 0.0 };
+   float64_t q1[3] = { 0.0, 0.0, 0.0 };
+   float64_t q2[3] = { 0.0, 0.0, 0.0 };
+   float64_t q3[3] = { 0.0, 0.0, 0.0 };
+   float64_t o0[3] = { 0.0, 0.0, 0.0 };
+   float64_t o1[3] = { 0.0, 0.0, 0.0 };
+   float64_t o2[3] = { 0.0, 0.0, 0.0 };
+   float64_t o3[3] = { 0.0, 0.0, 0.0 };
+   int32_t i = 0;
+
+   // yaw 0 to yaw 90 degrees, three times
+   for ( i = 0; i < 3; i++ )
+   {
+      q0[i] = 1.0;
+      o0[i] = cos( M_PI/4.0 );
+      o3[i] = sin( M_PI/4.0 );
+   }
+
+   d_quaternion_slerp_batch( q0, q1, q2, q3, o0, o1, o2, o3, 1.0/3.0, 3 );
+
+   // a third of the way is yaw 30 degrees
+   dq = d_quaternion_make_from_yaw_degrees( 30.0 );
+
+   for ( i = 0; i < 3; i++ )
+   {
+      CU_ASSERT( fabs( q0[i] - d_quaternion_q0( dq ) ) < 1.0e-12 );
+      CU_ASSERT( fabs( q1[i] - d_quaternion_q1( dq ) ) < 1.0e-12 );
+      CU_ASSERT( fabs( q2[i] - d_quaternion_q2( dq ) ) < 1.0e-12 );
+      CU_ASSERT( fabs( q3[i] - d_quaternion_q3( dq ) ) < 1.0e-12 );
+   }
+
+   d_quaternion_dispose( &dq );
+
+   return;
+}
+
+/**
+   test_slerp_batch_2
+*/
+
+void test_slerp_batch_2( void )
+{
+   float64_t q0[2] = { 1.0, 1.0 };
+   float64_t q1[2] = { 0.0, 0.0 };
+   float64_t q2[2] = { 0.0, 0.0 };
+   float64_t q3[2] = { 0.0, 0.0 };
+   float64_t o0[2] = { 0.0, -cos( M_PI/4.0 ) };
+   float64_t o1[2] = { 1.0, 0.0 };
+   float64_t o2[2] = { 0.0, 0.0 };
+   float64_t o3[2] = { 0.0, -sin( M_PI/4.0 ) };
+
+   // the end points
+   d_quaternion_slerp_batch( q0, q1, q2, q3, o0, o1, o2, o3, 0.0, 2 );
+
+   CU_ASSERT( fabs( q0[0] - 1.0 ) < 1.0e-12 );
+   CU_ASSERT( fabs( q1[0] ) < 1.0e-12 );
+
+   d_quaternion_slerp_batch( q0, q1, q2, q3, o0, o1, o2, o3, 1.0, 1 );
+
+   CU_ASSERT( fabs( q0[0] ) < 1.0e-12 );
+   CU_ASSERT( fabs( q1[0] - 1.0 ) < 1.0e-12 );
+
+   // -o is the same rotation as o, half way is yaw 45 degrees, not 135
+   d_quaternion_slerp_batch( q0 + 1, q1 + 1, q2 + 1, q3 + 1, o0 + 1, o1 + 1, o2 + 1, o3 + 1, 0.5, 1 );
+
+   CU_ASSERT( fabs( q0[1] - cos( M_PI/8.0 ) ) < 1.0e-12 );
+   CU_ASSERT( fabs( q1[1] ) < 1.0e-12 );
+   CU_ASSERT( fabs( q2[1] ) < 1.0e-12 );
+   CU_ASSERT( fabs( q3[1] - sin( M_PI/8.0 ) ) < 1.0e-12 );
+
+   return;
+}
+
+/**
+   test_slerp_batch_3
+*/
+
+void test_slerp_batch_3( void )
+{
+   f_quaternion_t *fq = NULL;
+   float32_t q0[1] = { 0.0 };
+   float32_t q1[1] = { 0.0 };
+   float32_t q2[1] = { 0.0 };
+   float32_t q3[1] = { 0.0 };
+   float32_t o0[1] = { 0.0 };
+   float32_t o1[1] = { 0.0 };
+   float32_t o2[1] = { 0.0 };
+   float32_t o3[1] = { 0.0 };
+
+   // nearly equal rotations are interpolated linearly and stay of unit magnitude
+   fq = f_quaternion_make_from_pitch( 0.010 );
+   q0[0] = f_quaternion_q0( fq );
+   q2[0] = f_quaternion_q2( fq );
+   f_quaternion_dispose( &fq );
+
+   fq = f_quaternion_make_from_pitch( 0.012 );
+   o0[0] = f_quaternion_q0( fq );
+   o2[0] = f_quaternion_q2( fq );
+   f_quaternion_dispose( &fq );
+
+   f_quaternion_slerp_batch( q0, q1, q2, q3, o0, o1, o2, o3, 0.5, 1 );
+
+   fq = f_quaternion_make_from_pitch( 0.011 );
+
+   CU_ASSERT( fabs( q0[0] - f_quaternion_q0( fq ) ) < 0.00001 );
+   CU_ASSERT( fabs( q2[0] - f_quaternion_q2( fq ) ) < 0.00001 );
+   CU_ASSERT( fabs( q0[0] * q0[0] + q2[0] * q2[0] - 1.0 ) < 0.00001 );
+
+   f_quaternion_dispose( &fq );
+
+   return;
+}
+
+int
+add_test_slerp_batch( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_slerp_batch", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_slerp_batch_1
+   add_test_to_suite( p_suite, test_slerp_batch_1, "test_slerp_batch_1" );
+
+   // test_slerp_batch_2
+   add_test_to_suite( p_suite, test_slerp_batch_2, "test_slerp_batch_2" );
+
+   // test_slerp_batch_3
+   add_test_to_suite( p_suite, test_slerp_batch_3, "test_slerp_batch_3" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -145,6 +145,9 @@ add_test_interpolate( void );
 int
 add_test_interpolated( void );
 
+int
+add_test_slerp_batch( void );
+
 int
 add_test_get_roll_pitch_yaw( void );
 
@@ -178,6 +181,9 @@ add_test_rotated_vector( void );
 int
 add_test_rotate_xyz( void );
 
+int
+add_test_rotate_xyz_batch( void );
+
 int
 add_test_scale( void );
 
@@ -220,6 +226,9 @@ add_test_multiply( void );
 int
 add_test_multiplied( void );
 
+int
+add_test_multiply_batch( void );
+
 
 int
 add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name )
@@ -304,6 +313,7 @@ int main()
    add_test_set_from_yaw_degrees();
    add_test_interpolate();
    add_test_interpolated();
+   add_test_slerp_batch();
    add_test_get_roll_pitch_yaw();
    add_test_get_roll_pitch_yaw_degrees();
    add_test_get_roll();
@@ -315,6 +325,7 @@ int main()
    add_test_rotate_vector();
    add_test_rotated_vector();
    add_test_rotate_xyz();
+   add_test_rotate_xyz_batch();
    add_test_scale();
    add_test_scaled();
    add_test_conjugate();
@@ -329,6 +340,7 @@ int main()
    add_test_subtracted();
    add_test_multiply();
    add_test_multiplied();
+   add_test_multiply_batch();
 
    // Run all tests using the CUnit Basic interface
 
@@ -0,0 +1,157 @@
+/**
+ @file RBTree_kv_test_rank.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for RBTree_kv_rank"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for RBTree_kv_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "ii_RBTree_kv.h"
+#include "Rng_Isaac.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_rank_1
+*/
+
+void test_rank_1( void )
+{
+   ii_rbtree_kv_t *tree = NULL;
+
+   tree = ii_rbtree_kv_make();
+
+   CU_ASSERT( ii_rbtree_kv_rank( tree, 5 ) == 0 );
+
+   ii_rbtree_kv_dispose( &tree );
+
+   return;
+}
+
+/**
+   test_rank_2
+*/
+
+void test_rank_2( void )
+{
+   ii_rbtree_kv_t *tree = NULL;
+
+   tree = ii_rbtree_kv_make();
+
+   ii_rbtree_kv_put( tree, 20, 20 );
+   ii_rbtree_kv_put( tree, 30, 30 );
+   ii_rbtree_kv_put( tree, 10, 10 );
+   ii_rbtree_kv_put( tree, 20, 20 );
+
+   CU_ASSERT( ii_rbtree_kv_rank( tree, 5 ) == 0 );
+   CU_ASSERT( ii_rbtree_kv_rank( tree, 10 ) == 0 );
+   CU_ASSERT( ii_rbtree_kv_rank( tree, 15 ) == 1 );
+   CU_ASSERT( ii_rbtree_kv_rank( tree, 20 ) == 1 );
+   CU_ASSERT( ii_rbtree_kv_rank( tree, 25 ) == 3 );
+   CU_ASSERT( ii_rbtree_kv_rank( tree, 30 ) == 3 );
+   CU_ASSERT( ii_rbtree_kv_rank( tree, 35 ) == 4 );
+
+   ii_rbtree_kv_dispose( &tree );
+
+   return;
+}
+
+/**
+   test_rank_3
+*/
+
+void test_rank_3( void )
+{
+   ii_rbtree_kv_t *tree = NULL;
+   int32_t i = 0;
+   int32_t v = 0;
+   rng_isaac_t *rng = NULL;
+
+   tree = ii_rbtree_kv_make();
+   rng = rng_isaac_make_with_seed( 12345 );
+
+   // many puts and removes, then check index, rank and item agree
+   for ( i = 0; i < 2000; i++ )
+   {
+      v = ( int32_t ) ( rng_isaac_u32_item( rng ) % 500 );
+      rng_isaac_forth( rng );
+      ii_rbtree_kv_put( tree, v, v );
+   }
+
+   for ( i = 0; i < 700; i++ )
+   {
+      ii_rbtree_kv_remove_by_index( tree, ( int32_t ) ( rng_isaac_u32_item( rng ) % ii_rbtree_kv_count( tree ) ) );
+      rng_isaac_forth( rng );
+   }
+
+   CU_ASSERT( ii_rbtree_kv_count( tree ) == 1300 );
+
+   for ( i = 0; i < ii_rbtree_kv_count( tree ); i++ )
+   {
+      v = ii_rbtree_kv_key( tree, i );
+      CU_ASSERT( ii_rbtree_kv_rank( tree, v ) <= i );
+      CU_ASSERT( ii_rbtree_kv_rank( tree, v + 1 ) > i );
+
+      ii_rbtree_kv_go( tree, i );
+      CU_ASSERT( ii_rbtree_kv_index( tree ) == i );
+   }
+
+   ii_rbtree_kv_dispose( &tree );
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+int
+add_test_rank( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_rank", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_rank_1
+   add_test_to_suite( p_suite, test_rank_1, "test_rank_1" );
+
+   // test_rank_2
+   add_test_to_suite( p_suite, test_rank_2, "test_rank_2" );
+
+   // test_rank_3
+   add_test_to_suite( p_suite, test_rank_3, "test_rank_3" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
@@ -277,6 +277,12 @@ add_test_occurrences_value( void );
 int
 add_test_occurrences_value_eq_fn( void );
 
+int
+add_test_rank( void );
+
+int
+add_test_count_in_range( void );
+
 int
 add_test_as_string( void );
 
@@ -417,6 +423,8 @@ int main()
    add_test_occurrences_eq_fn();
    add_test_occurrences_value();
    add_test_occurrences_value_eq_fn();
+   add_test_rank();
+   add_test_count_in_range();
    add_test_as_string();
 
    add_test_p_basic();
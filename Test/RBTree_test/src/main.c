@@ -166,6 +166,12 @@ add_test_occurrences( void );
 int
 add_test_occurrences_eq_fn( void );
 
+int
+add_test_rank( void );
+
+int
+add_test_count_in_range( void );
+
 int
 add_test_off( void );
 
@@ -321,6 +327,8 @@ int main()
    add_test_cursor_index();
    add_test_occurrences();
    add_test_occurrences_eq_fn();
+   add_test_rank();
+   add_test_count_in_range();
    add_test_off();
    add_test_remove();
    add_test_remove_and_dispose();
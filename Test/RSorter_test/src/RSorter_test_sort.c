@@ -0,0 +1,775 @@
+/**
+ @file RSorter_test_sort.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for RSorter_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for RSorter_t.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <math.h>
+
+#include "Protocol_Base.h"
+#include "i_Sequence.h"
+#include "i_DList.h"
+#include "i_RSorter.h"
+#include "i64_Sequence.h"
+#include "i64_RSorter.h"
+#include "f64_Sequence.h"
+#include "f64_RSorter.h"
+#include "cs_Sequence.h"
+#include "cs_RSorter.h"
+#include "i_Sorter.h"
+#include "p_Basic.h"
+#include "Rng_Isaac.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+static
+int32_t
+func( int32_t a, int32_t b )
+{
+   int32_t result = 0;
+   
+   if ( a < b )
+   {
+      result = -1;
+   }
+   else if ( a == b )
+   {
+      result = 0;
+   }
+   else
+   {
+      result = 1;
+   }
+   
+   return result;
+}
+
+void test_sort_0( void )
+{
+
+   i_sequence_t *seq = i_sequence_make_n( 1 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+   
+   i_sequence_ensure_count( seq, 1 );
+   
+   i_sequence_put( seq, 1, 0 );
+   
+   i_rsorter_sort( pb_seq, func );
+ 
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+void test_sort_1( void )
+{
+
+   i_sequence_t *seq = i_sequence_make_n( 2 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+   
+   i_sequence_ensure_count( seq, 2 );
+   
+   i_sequence_put( seq, 1, 0 );
+   i_sequence_put( seq, 2, 1 );
+   
+   i_rsorter_sort( pb_seq, func );
+ 
+   
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 1 ) == 2 );
+
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+void test_sort_2( void )
+{
+
+   i_sequence_t *seq = i_sequence_make_n( 2 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+   
+   i_sequence_ensure_count( seq, 2 );
+   
+   i_sequence_put( seq, 2, 0 );
+   i_sequence_put( seq, 1, 1 );
+   
+   i_rsorter_sort( pb_seq, func );
+ 
+   
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 1 ) == 2 );
+
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+void test_sort_3a( void )
+{
+
+   i_sequence_t *seq = i_sequence_make_n( 3 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+   
+   i_sequence_ensure_count( seq, 3 );
+   
+   i_sequence_put( seq, 1, 0 );
+   i_sequence_put( seq, 2, 1 );
+   i_sequence_put( seq, 3, 2 );
+   
+   i_rsorter_sort( pb_seq, func );
+ 
+   
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 1 ) == 2 );
+   CU_ASSERT( i_sequence_item( seq, 2 ) == 3 );
+
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+void test_sort_3b( void )
+{
+
+   i_sequence_t *seq = i_sequence_make_n( 3 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+   
+   i_sequence_ensure_count( seq, 3 );
+   
+   i_sequence_put( seq, 3, 0 );
+   i_sequence_put( seq, 1, 1 );
+   i_sequence_put( seq, 2, 2 );
+   
+   i_rsorter_sort( pb_seq, func );
+ 
+   
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 1 ) == 2 );
+   CU_ASSERT( i_sequence_item( seq, 2 ) == 3 );
+
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+void test_sort_3c( void )
+{
+
+   i_sequence_t *seq = i_sequence_make_n( 3 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+   
+   i_sequence_ensure_count( seq, 3 );
+   
+   i_sequence_put( seq, 2, 0 );
+   i_sequence_put( seq, 3, 1 );
+   i_sequence_put( seq, 1, 2 );
+   
+   i_rsorter_sort( pb_seq, func );
+ 
+   
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 1 ) == 2 );
+   CU_ASSERT( i_sequence_item( seq, 2 ) == 3 );
+
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+void test_sort_3d( void )
+{
+
+   i_sequence_t *seq = i_sequence_make_n( 3 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+   
+   i_sequence_ensure_count( seq, 3 );
+   
+   i_sequence_put( seq, 3, 0 );
+   i_sequence_put( seq, 2, 1 );
+   i_sequence_put( seq, 1, 2 );
+   
+   i_rsorter_sort( pb_seq, func );
+ 
+   
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 1 ) == 2 );
+   CU_ASSERT( i_sequence_item( seq, 2 ) == 3 );
+
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+void test_sort_3e( void )
+{
+
+   i_sequence_t *seq = i_sequence_make_n( 3 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+   
+   i_sequence_ensure_count( seq, 3 );
+   
+   i_sequence_put( seq, 2, 0 );
+   i_sequence_put( seq, 1, 1 );
+   i_sequence_put( seq, 3, 2 );
+   
+   i_rsorter_sort( pb_seq, func );
+ 
+   
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 1 ) == 2 );
+   CU_ASSERT( i_sequence_item( seq, 2 ) == 3 );
+
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+void test_sort_3f( void )
+{
+
+   i_sequence_t *seq = i_sequence_make_n( 3 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+   
+   i_sequence_ensure_count( seq, 3 );
+   
+   i_sequence_put( seq, 1, 0 );
+   i_sequence_put( seq, 3, 1 );
+   i_sequence_put( seq, 2, 2 );
+   
+   i_rsorter_sort( pb_seq, func );
+ 
+   
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 1 ) == 2 );
+   CU_ASSERT( i_sequence_item( seq, 2 ) == 3 );
+
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+void test_sort_4( void )
+{
+
+   i_sequence_t *seq = i_sequence_make_n( 3 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+   int32_t result = 0;
+
+   i_sequence_ensure_count( seq, 6 );
+
+   i_sequence_put( seq, 6, 0 );
+   i_sequence_put( seq, 5, 1 );
+   i_sequence_put( seq, 4, 2 );
+   i_sequence_put( seq, 3, 3 );
+   i_sequence_put( seq, 2, 4 );
+   i_sequence_put( seq, 1, 5 );
+
+   i_rsorter_sort( pb_seq, func );
+
+   result = i_rsorter_is_sorted( pb_seq, func );
+   CU_ASSERT( result == 1 );
+
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 1 ) == 2 );
+   CU_ASSERT( i_sequence_item( seq, 2 ) == 3 );
+   CU_ASSERT( i_sequence_item( seq, 3 ) == 4 );
+   CU_ASSERT( i_sequence_item( seq, 4 ) == 5 );
+   CU_ASSERT( i_sequence_item( seq, 5 ) == 6 );
+
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+/**
+   test_sort_5
+*/
+
+void test_sort_5( void )
+{
+   i_rsorter_t *sorter = NULL;
+   int32_t result = 0;
+
+   sorter = i_rsorter_make();
+   
+   i_sequence_t *seq = i_sequence_make_n( 3 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+
+   i_sequence_ensure_count( seq, 6 );
+
+   i_sequence_put( seq, 6, 0 );
+   i_sequence_put( seq, 5, 1 );
+   i_sequence_put( seq, 4, 2 );
+   i_sequence_put( seq, 3, 3 );
+   i_sequence_put( seq, 2, 4 );
+   i_sequence_put( seq, 1, 5 );
+
+   result = i_rsorter_is_sorted_predefined_comparison_function( sorter, pb_seq );
+   CU_ASSERT( result == 0 );
+
+   i_rsorter_sort_predefined_comparison_function( sorter, pb_seq );
+   
+   result = i_rsorter_is_sorted_predefined_comparison_function( sorter, pb_seq );
+   CU_ASSERT( result == 1 );
+
+   CU_ASSERT( i_sequence_item( seq, 0 ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 1 ) == 2 );
+   CU_ASSERT( i_sequence_item( seq, 2 ) == 3 );
+   CU_ASSERT( i_sequence_item( seq, 3 ) == 4 );
+   CU_ASSERT( i_sequence_item( seq, 4 ) == 5 );
+   CU_ASSERT( i_sequence_item( seq, 5 ) == 6 );
+
+   i_rsorter_dispose( &sorter );
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+/**
+   test_sort_6
+
+   sort a DList, which has no item array and is sorted through item and put
+*/
+
+void test_sort_6( void )
+{
+   int32_t i = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+
+   i_dlist_t *list = i_dlist_make();
+   protocol_base_t *pb_list = ( protocol_base_t * ) list;
+
+   for ( i = 0; i < 50; i++ )
+   {
+      i_dlist_put_last( list, ( int32_t ) ( rng_isaac_u32_item( rng ) >> 24 ) );
+      rng_isaac_forth( rng );
+   }
+
+   CU_ASSERT( i_rsorter_is_sorted( pb_list, func ) == 0 );
+
+   i_rsorter_sort( pb_list, func );
+
+   CU_ASSERT( i_rsorter_is_sorted( pb_list, func ) == 1 );
+   CU_ASSERT( i_dlist_count( list ) == 50 );
+
+   for ( i = 1; i < 50; i++ )
+   {
+      CU_ASSERT( i_dlist_item( list, i - 1 ) <= i_dlist_item( list, i ) );
+   }
+
+   i_dlist_dispose( &list );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+/**
+   compare_int32
+
+   qsort comparison of int32_t values, for reference results
+*/
+
+static
+int
+compare_int32( const void *a, const void *b )
+{
+   int32_t x = *( int32_t * ) a;
+   int32_t y = *( int32_t * ) b;
+
+   return ( x > y ) - ( x < y );
+}
+
+/**
+   test_sort_7
+
+   radix sort of random int32_t values of both signs and the extreme values
+*/
+
+void test_sort_7( void )
+{
+   int32_t i = 0;
+   int32_t n = 10007;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 4321 );
+   int32_t *expected = ( int32_t * ) calloc( n, sizeof( int32_t ) );
+   i_rsorter_t *sorter = i_rsorter_make();
+   i_sequence_t *seq = i_sequence_make_n( n );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+
+   i_sequence_ensure_count( seq, n );
+
+   for ( i = 0; i < n; i++ )
+   {
+      expected[i] = rng_isaac_i32_item( rng );
+      rng_isaac_forth( rng );
+   }
+
+   expected[10] = INT32_MIN;
+   expected[20] = INT32_MAX;
+   expected[30] = 0;
+   expected[40] = -1;
+
+   for ( i = 0; i < n; i++ )
+   {
+      i_sequence_put( seq, expected[i], i );
+   }
+
+   qsort( expected, n, sizeof( int32_t ), compare_int32 );
+
+   i_rsorter_sort_predefined_comparison_function( sorter, pb_seq );
+
+   CU_ASSERT( i_rsorter_is_sorted( pb_seq, func ) == 1 );
+
+   for ( i = 0; i < n; i++ )
+   {
+      CU_ASSERT( i_sequence_item( seq, i ) == expected[i] );
+   }
+
+   free( expected );
+   i_rsorter_dispose( &sorter );
+   i_sequence_dispose( &seq );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+/**
+   test_sort_8
+
+   values that differ only in the low byte, so all but one pass are skipped
+*/
+
+void test_sort_8( void )
+{
+   int32_t i = 0;
+   int32_t n = 256;
+   i_rsorter_t *sorter = i_rsorter_make();
+   i_sequence_t *seq = i_sequence_make_n( n );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+
+   i_sequence_ensure_count( seq, n );
+
+   for ( i = 0; i < n; i++ )
+   {
+      i_sequence_put( seq, 0x12345600 + ( n - 1 - i ), i );
+   }
+
+   i_rsorter_sort_predefined_comparison_function( sorter, pb_seq );
+
+   for ( i = 0; i < n; i++ )
+   {
+      CU_ASSERT( i_sequence_item( seq, i ) == 0x12345600 + i );
+   }
+
+   i_rsorter_dispose( &sorter );
+   i_sequence_dispose( &seq );
+
+   return;
+}
+
+/**
+   test_sort_9
+
+   radix sort of int64_t values of both signs
+*/
+
+void test_sort_9( void )
+{
+   int32_t i = 0;
+   int32_t n = 1000;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 12345 );
+   i64_rsorter_t *sorter = i64_rsorter_make();
+   i64_sequence_t *seq = i64_sequence_make_n( n );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+
+   i64_sequence_ensure_count( seq, n );
+
+   for ( i = 0; i < n; i++ )
+   {
+      i64_sequence_put( seq, rng_isaac_i64_item( rng ), i );
+      rng_isaac_forth( rng );
+   }
+
+   i64_sequence_put( seq, INT64_MIN, 1 );
+   i64_sequence_put( seq, INT64_MAX, 2 );
+   i64_sequence_put( seq, -1, 3 );
+   i64_sequence_put( seq, 0, 4 );
+
+   i64_rsorter_sort_predefined_comparison_function( sorter, pb_seq );
+
+   CU_ASSERT( i64_rsorter_is_sorted_predefined_comparison_function( sorter, pb_seq ) == 1 );
+   CU_ASSERT( i64_sequence_item( seq, 0 ) == INT64_MIN );
+   CU_ASSERT( i64_sequence_item( seq, n - 1 ) == INT64_MAX );
+
+   i64_rsorter_dispose( &sorter );
+   i64_sequence_dispose( &seq );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+/**
+   test_sort_10
+
+   radix sort of float64_t values, with infinities, zeros of both signs
+   and subnormals
+*/
+
+void test_sort_10( void )
+{
+   int32_t i = 0;
+   int32_t n = 1000;
+   int32_t i_zero = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 777 );
+   f64_rsorter_t *sorter = f64_rsorter_make();
+   f64_sequence_t *seq = f64_sequence_make_n( n );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+
+   f64_sequence_ensure_count( seq, n );
+
+   for ( i = 0; i < n; i++ )
+   {
+      f64_sequence_put( seq, ( ( float64_t ) rng_isaac_i32_item( rng ) ) * 1.0e-3, i );
+      rng_isaac_forth( rng );
+   }
+
+   f64_sequence_put( seq, 0.0, 10 );
+   f64_sequence_put( seq, -0.0, 11 );
+   f64_sequence_put( seq, 1.0 / 0.0, 12 );
+   f64_sequence_put( seq, -1.0 / 0.0, 13 );
+   f64_sequence_put( seq, 4.9e-324, 14 );
+   f64_sequence_put( seq, -4.9e-324, 15 );
+
+   CU_ASSERT( f64_rsorter_is_sorted_predefined_comparison_function( sorter, pb_seq ) == 0 );
+
+   f64_rsorter_sort_predefined_comparison_function( sorter, pb_seq );
+
+   CU_ASSERT( f64_rsorter_is_sorted_predefined_comparison_function( sorter, pb_seq ) == 1 );
+   CU_ASSERT( f64_sequence_item( seq, 0 ) == -1.0 / 0.0 );
+   CU_ASSERT( f64_sequence_item( seq, n - 1 ) == 1.0 / 0.0 );
+
+   // -0.0 sorts directly before +0.0, between the subnormals
+   for ( i = 0; i < n; i++ )
+   {
+      if ( f64_sequence_item( seq, i ) == -4.9e-324 )
+      {
+         i_zero = i + 1;
+      }
+   }
+
+   CU_ASSERT( signbit( f64_sequence_item( seq, i_zero ) ) != 0 );
+   CU_ASSERT( signbit( f64_sequence_item( seq, i_zero + 1 ) ) == 0 );
+   CU_ASSERT( f64_sequence_item( seq, i_zero + 1 ) == 0.0 );
+   CU_ASSERT( f64_sequence_item( seq, i_zero + 2 ) == 4.9e-324 );
+
+   f64_rsorter_dispose( &sorter );
+   f64_sequence_dispose( &seq );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+/**
+   test_sort_11
+
+   strings have no radix key and are merge sorted with the comparison function
+*/
+
+void test_sort_11( void )
+{
+   cs_rsorter_t *sorter = cs_rsorter_make();
+   cs_sequence_t *seq = cs_sequence_make_n( 5 );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+
+   cs_sequence_ensure_count( seq, 5 );
+
+   cs_sequence_put( seq, "pear", 0 );
+   cs_sequence_put( seq, "apple", 1 );
+   cs_sequence_put( seq, "plum", 2 );
+   cs_sequence_put( seq, "fig", 3 );
+   cs_sequence_put( seq, "cherry", 4 );
+
+   CU_ASSERT( cs_rsorter_is_sorted_predefined_comparison_function( sorter, pb_seq ) == 0 );
+
+   cs_rsorter_sort_predefined_comparison_function( sorter, pb_seq );
+
+   CU_ASSERT( cs_rsorter_is_sorted_predefined_comparison_function( sorter, pb_seq ) == 1 );
+   CU_ASSERT( strcmp( cs_sequence_item( seq, 0 ), "apple" ) == 0 );
+   CU_ASSERT( strcmp( cs_sequence_item( seq, 1 ), "cherry" ) == 0 );
+   CU_ASSERT( strcmp( cs_sequence_item( seq, 2 ), "fig" ) == 0 );
+   CU_ASSERT( strcmp( cs_sequence_item( seq, 3 ), "pear" ) == 0 );
+   CU_ASSERT( strcmp( cs_sequence_item( seq, 4 ), "plum" ) == 0 );
+
+   cs_rsorter_dispose( &sorter );
+   cs_sequence_dispose( &seq );
+
+   return;
+}
+
+/**
+   func_descending
+
+   comparison function that orders int32_t values from largest to smallest
+*/
+
+static
+int32_t
+func_descending( int32_t a, int32_t b )
+{
+   return func( b, a );
+}
+
+/**
+   test_sort_12
+
+   a comparison function other than the predefined one is honored, so a
+   descending function sorts int32_t values from largest to smallest
+*/
+
+void test_sort_12( void )
+{
+   int32_t i = 0;
+   int32_t n = 1000;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 2468 );
+   i_sequence_t *seq = i_sequence_make_n( n );
+   protocol_base_t *pb_seq = ( protocol_base_t * ) seq;
+
+   i_sequence_ensure_count( seq, n );
+
+   for ( i = 0; i < n; i++ )
+   {
+      i_sequence_put( seq, rng_isaac_i32_item( rng ), i );
+      rng_isaac_forth( rng );
+   }
+
+   i_sequence_put( seq, INT32_MIN, 10 );
+   i_sequence_put( seq, INT32_MAX, 20 );
+
+   i_rsorter_sort( pb_seq, func_descending );
+
+   CU_ASSERT( i_rsorter_is_sorted( pb_seq, func_descending ) == 1 );
+   CU_ASSERT( i_sequence_item( seq, 0 ) == INT32_MAX );
+   CU_ASSERT( i_sequence_item( seq, n - 1 ) == INT32_MIN );
+
+   for ( i = 1; i < n; i++ )
+   {
+      CU_ASSERT( i_sequence_item( seq, i - 1 ) >= i_sequence_item( seq, i ) );
+   }
+
+   i_sequence_dispose( &seq );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+int
+add_test_sort( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_sort", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_sort_0
+   add_test_to_suite( p_suite, test_sort_0, "test_sort_0" );
+
+   // test_sort_1
+   add_test_to_suite( p_suite, test_sort_1, "test_sort_1" );
+
+   // test_sort_2
+   add_test_to_suite( p_suite, test_sort_2, "test_sort_2" );
+
+   // test_sort_3a
+   add_test_to_suite( p_suite, test_sort_3a, "test_sort_3a" );
+
+   // test_sort_3b
+   add_test_to_suite( p_suite, test_sort_3b, "test_sort_3b" );
+
+   // test_sort_3c
+   add_test_to_suite( p_suite, test_sort_3c, "test_sort_3c" );
+
+   // test_sort_3d
+   add_test_to_suite( p_suite, test_sort_3d, "test_sort_3d" );
+
+   // test_sort_3e
+   add_test_to_suite( p_suite, test_sort_3e, "test_sort_3e" );
+
+   // test_sort_3f
+   add_test_to_suite( p_suite, test_sort_3f, "test_sort_3f" );
+
+   // test_sort_4
+   add_test_to_suite( p_suite, test_sort_4, "test_sort_4" );
+
+   // test_sort_5
+   add_test_to_suite( p_suite, test_sort_5, "test_sort_5" );
+
+   // test_sort_6
+   add_test_to_suite( p_suite, test_sort_6, "test_sort_6" );
+
+   // test_sort_7
+   add_test_to_suite( p_suite, test_sort_7, "test_sort_7" );
+
+   // test_sort_8
+   add_test_to_suite( p_suite, test_sort_8, "test_sort_8" );
+
+   // test_sort_9
+   add_test_to_suite( p_suite, test_sort_9, "test_sort_9" );
+
+   // test_sort_10
+   add_test_to_suite( p_suite, test_sort_10, "test_sort_10" );
+
+   // test_sort_11
+   add_test_to_suite( p_suite, test_sort_11, "test_sort_11" );
+
+   // test_sort_12
+   add_test_to_suite( p_suite, test_sort_12, "test_sort_12" );
+
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
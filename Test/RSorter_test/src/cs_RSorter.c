@@ -0,0 +1,56 @@
+/**
+ @file cs_RSorter.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "implementation file for sorter of C strings"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Defines for cs_RSorter type.
+
+*/
+
+#include <string.h>
+
+#include "cs_RSorter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static
+int32_t
+func( char_t *a, char_t *b )
+{
+   int32_t result = 0;
+
+   result = strcmp( a, b );
+
+   return result;
+}
+
+#define DISPOSE_FUNCTION( arg )
+#define SORT_FUNCTION_NAME func
+
+#define Prefix cs
+#define Type char_t *
+#define Type_Code char_ptr_type_code
+
+#include "RSorter.c"
+
+#undef Prefix
+#undef Type
+#undef Type_Code
+ 
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,48 @@
+/**
+ @file cs_RSorter.h
+ @author Greg Lee
+ @version 0.0
+ @brief: "include file for sorter of C strings"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Defines to make a rsorter into a cs_rsorter.
+
+*/
+
+#ifndef CS_RSORTER_H_
+#define CS_RSORTER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PROTOCOLS_ENABLED
+
+#include "base.h"
+#include "protocol.h"
+
+#define Prefix cs
+#define Type char_t *
+
+#include "RSorter.h"
+
+#undef Prefix
+#undef Type
+ 
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CS_RSORTER_H_ */
+
+/* End of file */
+
+
+
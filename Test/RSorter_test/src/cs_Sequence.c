@@ -0,0 +1,44 @@
+/**
+ @file cs_Sequence.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "implementation file for sequences of C strings"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Defines for cs_Sequence type.
+
+*/
+
+#include "cs_Sequence.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define VALUE_DEEP_DISPOSE_FUNCTION( arg ) 
+#define VALUE_DEEP_CLONE_FUNCTION( arg ) ( arg )
+#define VALUE_DEEP_EQUAL_FUNCTION( arg1, arg2 ) ( (arg1) == (arg2) )
+
+#define Prefix cs
+#define Type char_t *
+#define Type_Code char_ptr_type_code
+
+#include "Sequence.c"
+
+#undef Prefix 
+#undef Type 
+#undef Type_Code
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,45 @@
+/**
+ @file f64_Indexable.h
+ @author Greg Lee
+ @version 0.0
+ @brief: "include file for Indexable of float64_ts"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Defines to make Indexable of float64_ts.
+
+*/
+
+#ifndef F64_INDEXABLE_H
+#define F64_INDEXABLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "base.h"
+
+#define Prefix f64
+#define Type float64_t
+
+#include "P_Indexable.h"
+
+#undef Prefix
+#undef Type
+ 
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* F64_INDEXABLE_H */
+
+/* End of file */
+
+
+
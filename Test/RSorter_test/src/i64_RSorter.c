@@ -0,0 +1,65 @@
+/**
+ @file i64_RSorter.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "implementation file for sorter of int64_ts"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Defines for i64_RSorter type.
+
+*/
+
+#include "i64_RSorter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static
+int32_t
+func( int64_t a, int64_t b )
+{
+   int32_t result = 0;
+
+   if ( a < b )
+   {
+      result = -1;
+   }
+   else if ( a == b )
+   {
+      result = 0;
+   }
+   else
+   {
+      result = 1;
+   }
+
+   return result;
+}
+
+#define DISPOSE_FUNCTION( arg )
+#define SORT_FUNCTION_NAME func
+
+#define Prefix i64
+#define Type int64_t
+#define Type_Code int64_type_code
+
+#include "RSorter.c"
+
+#undef Prefix
+#undef Type
+#undef Type_Code
+ 
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
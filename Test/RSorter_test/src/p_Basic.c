@@ -0,0 +1,36 @@
+/**
+ @file s_Basic.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "implementation file for Basic of protocol objects"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Defines for p_Basic type.
+
+*/
+
+#include "p_Basic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define Prefix p
+
+#include "P_Basic.c"
+
+#undef Prefix
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -19,6 +19,9 @@ add_test_make( void );
 int
 add_test_make_from_pointer( void );
 
+int
+add_test_make_borrowed( void );
+
 int
 add_test_clone( void );
 
@@ -207,6 +210,7 @@ int main()
 
    add_test_make();
    add_test_make_from_pointer();
+   add_test_make_borrowed();
    add_test_clone();
    add_test_deep_clone();
    add_test_is_equal();
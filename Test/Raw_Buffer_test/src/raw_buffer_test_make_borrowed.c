@@ -0,0 +1,132 @@
+/**
+ @file raw_buffer_test_make_borrowed.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for raw_buffer_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for raw_buffer_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "Raw_Buffer.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+
+/**
+   test_make_borrowed_1
+*/
+
+void test_make_borrowed_1( void )
+{
+   uint8_t p[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+   raw_buffer_t *raw_buffer = raw_buffer_make_borrowed( p, 8 );
+
+   CU_ASSERT( raw_buffer != NULL );
+
+   CU_ASSERT( raw_buffer_count( raw_buffer ) == 8 );
+   CU_ASSERT( raw_buffer_base( raw_buffer ) == p );
+   CU_ASSERT( raw_buffer_is_borrowed( raw_buffer ) == 1 );
+   CU_ASSERT( raw_buffer_read_uint8( raw_buffer, 3 ) == 4 );
+
+   // the borrowed memory is on the stack, so it must not be freed
+   raw_buffer_deep_dispose( &raw_buffer );
+
+   CU_ASSERT( p[7] == 8 );
+
+   return;
+}
+
+/**
+   test_make_borrowed_2
+*/
+
+void test_make_borrowed_2( void )
+{
+   uint8_t p[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+   raw_buffer_t *raw_buffer = raw_buffer_make_borrowed( p, 8 );
+   raw_buffer_t *raw_buffer1 = raw_buffer_clone( raw_buffer );
+
+   // the clone owns a copy of the contents
+   CU_ASSERT( raw_buffer_is_borrowed( raw_buffer1 ) == 0 );
+   CU_ASSERT( raw_buffer_base( raw_buffer1 ) != p );
+   CU_ASSERT( raw_buffer_is_equal( raw_buffer, raw_buffer1 ) == 1 );
+
+   raw_buffer_deep_dispose( &raw_buffer );
+   raw_buffer_deep_dispose( &raw_buffer1 );
+
+   return;
+}
+
+/**
+   test_make_borrowed_3
+*/
+
+void test_make_borrowed_3( void )
+{
+   uint8_t *p = calloc( 8, sizeof( uint8_t ) );
+
+   raw_buffer_t *raw_buffer = raw_buffer_make_from_pointer( p, 8 );
+
+   CU_ASSERT( raw_buffer_is_borrowed( raw_buffer ) == 0 );
+
+   raw_buffer_deep_dispose( &raw_buffer );
+
+   return;
+}
+
+
+int
+add_test_make_borrowed( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_make_borrowed", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_make_borrowed_1
+   add_test_to_suite( p_suite, test_make_borrowed_1, "test_make_borrowed_1" );
+
+   // test_make_borrowed_2
+   add_test_to_suite( p_suite, test_make_borrowed_2, "test_make_borrowed_2" );
+
+   // test_make_borrowed_3
+   add_test_to_suite( p_suite, test_make_borrowed_3, "test_make_borrowed_3" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
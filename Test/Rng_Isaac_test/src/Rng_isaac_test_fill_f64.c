@@ -0,0 +1,144 @@
+/**
+ @file Rng_isaac_test_fill_f64.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Rng_isaac_fill_f64"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Rng_isaac_fill_f64.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "CUnit/Basic.h"
+
+#include "Rng_Isaac.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_fill_f64_1
+*/
+
+void test_fill_f64_1( void )
+{
+   rng_isaac_t *rng = NULL;
+   rng_isaac_t *rng1 = NULL;
+   float64_t *array = NULL;
+   int32_t counts[] = { 3, 300, 1, 253, 1000, 0, 512 };
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t ok = 1;
+
+   rng = rng_isaac_make_with_seed( 17 );
+   rng1 = rng_isaac_make_with_seed( 17 );
+   array = ( float64_t * ) calloc( 1000, sizeof( float64_t ) );
+
+   // counts that start and end inside and at the edges of a buffer
+   for ( i = 0; i < 7; i++ )
+   {
+      rng_isaac_fill_f64( rng, array, counts[i] );
+
+      for ( j = 0; j < counts[i]; j++ )
+      {
+         if ( array[j] != rng_isaac_f64_item( rng1 ) )
+         {
+            ok = 0;
+         }
+         rng_isaac_forth( rng1 );
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   // both are at the same place in the stream
+   CU_ASSERT( rng_isaac_u64_item( rng ) == rng_isaac_u64_item( rng1 ) );
+
+   free( array );
+   rng_isaac_dispose( &rng );
+   rng_isaac_dispose( &rng1 );
+
+   return;
+}
+
+/**
+   test_fill_f64_2
+*/
+
+void test_fill_f64_2( void )
+{
+   rng_isaac_t *rng = NULL;
+   float64_t *array = NULL;
+   float64_t sum = 0.0;
+   int32_t i = 0;
+   int32_t ok = 1;
+
+   rng = rng_isaac_make();
+   array = ( float64_t * ) calloc( 10000, sizeof( float64_t ) );
+
+   rng_isaac_fill_f64( rng, array, 10000 );
+
+   for ( i = 0; i < 10000; i++ )
+   {
+      if ( ( array[i] < 0.0 ) || ( array[i] > 1.0 ) )
+      {
+         ok = 0;
+      }
+      sum = sum + array[i];
+   }
+
+   CU_ASSERT( ok == 1 );
+   CU_ASSERT( fabs( sum / 10000 - 0.5 ) < 0.02 );
+
+   free( array );
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+int
+add_test_fill_f64( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_fill_f64", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_fill_f64_1
+   add_test_to_suite( p_suite, test_fill_f64_1, "test_fill_f64_1" );
+
+   // test_fill_f64_2
+   add_test_to_suite( p_suite, test_fill_f64_2, "test_fill_f64_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,105 @@
+/**
+ @file Rng_isaac_test_fill_u32.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Rng_isaac_fill_u32"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Rng_isaac_fill_u32.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "Rng_Isaac.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_fill_u32_1
+*/
+
+void test_fill_u32_1( void )
+{
+   rng_isaac_t *rng = NULL;
+   rng_isaac_t *rng1 = NULL;
+   uint32_t *array = NULL;
+   int32_t counts[] = { 3, 300, 1, 253, 1000, 0, 512 };
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t ok = 1;
+
+   rng = rng_isaac_make_with_seed( 17 );
+   rng1 = rng_isaac_make_with_seed( 17 );
+   array = ( uint32_t * ) calloc( 1000, sizeof( uint32_t ) );
+
+   // counts that start and end inside and at the edges of a buffer
+   for ( i = 0; i < 7; i++ )
+   {
+      rng_isaac_fill_u32( rng, array, counts[i] );
+
+      for ( j = 0; j < counts[i]; j++ )
+      {
+         if ( array[j] != rng_isaac_u32_item( rng1 ) )
+         {
+            ok = 0;
+         }
+         rng_isaac_forth( rng1 );
+      }
+   }
+
+   CU_ASSERT( ok == 1 );
+
+   // both are at the same place in the stream
+   CU_ASSERT( rng_isaac_u64_item( rng ) == rng_isaac_u64_item( rng1 ) );
+
+   free( array );
+   rng_isaac_dispose( &rng );
+   rng_isaac_dispose( &rng1 );
+
+   return;
+}
+
+int
+add_test_fill_u32( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_fill_u32", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_fill_u32_1
+   add_test_to_suite( p_suite, test_fill_u32_1, "test_fill_u32_1" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,139 @@
+/**
+ @file Rng_isaac_test_make_with_stream.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Rng_isaac_make_with_stream"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Rng_isaac_make_with_stream.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "Rng_Isaac.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_make_with_stream_1
+*/
+
+void test_make_with_stream_1( void )
+{
+   rng_isaac_t *rng = NULL;
+   rng_isaac_t *rng1 = NULL;
+   uint64_t a[256];
+   uint64_t a1[256];
+
+   // stream 0 is the seed's own stream
+   rng = rng_isaac_make_with_stream( 1234, 0 );
+   rng1 = rng_isaac_make_with_seed( 1234 );
+
+   CU_ASSERT( rng != NULL );
+
+   rng_isaac_fill_u64( rng, a, 256 );
+   rng_isaac_fill_u64( rng1, a1, 256 );
+
+   CU_ASSERT( memcmp( a, a1, sizeof( a ) ) == 0 );
+
+   rng_isaac_dispose( &rng );
+   rng_isaac_dispose( &rng1 );
+
+   return;
+}
+
+/**
+   test_make_with_stream_2
+*/
+
+void test_make_with_stream_2( void )
+{
+   rng_isaac_t *rng = NULL;
+   rng_isaac_t *rng1 = NULL;
+   uint64_t a[256];
+   uint64_t a1[256];
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t count = 0;
+
+   // the same seed and stream give the same numbers
+   rng = rng_isaac_make_with_stream( 1234, 7 );
+   rng1 = rng_isaac_make_with_stream( 1234, 7 );
+
+   rng_isaac_fill_u64( rng, a, 256 );
+   rng_isaac_fill_u64( rng1, a1, 256 );
+
+   CU_ASSERT( memcmp( a, a1, sizeof( a ) ) == 0 );
+
+   rng_isaac_dispose( &rng1 );
+
+   // neighbouring streams share no numbers
+   rng1 = rng_isaac_make_with_stream( 1234, 8 );
+   rng_isaac_fill_u64( rng1, a1, 256 );
+
+   for ( i = 0; i < 256; i++ )
+   {
+      for ( j = 0; j < 256; j++ )
+      {
+         if ( a[i] == a1[j] )
+         {
+            count = count + 1;
+         }
+      }
+   }
+
+   CU_ASSERT( count == 0 );
+
+   rng_isaac_dispose( &rng );
+   rng_isaac_dispose( &rng1 );
+
+   return;
+}
+
+int
+add_test_make_with_stream( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_make_with_stream", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_make_with_stream_1
+   add_test_to_suite( p_suite, test_make_with_stream_1, "test_make_with_stream_1" );
+
+   // test_make_with_stream_2
+   add_test_to_suite( p_suite, test_make_with_stream_2, "test_make_with_stream_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
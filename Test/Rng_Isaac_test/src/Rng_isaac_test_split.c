@@ -0,0 +1,153 @@
+/**
+ @file Rng_isaac_test_split.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Rng_isaac_split"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Rng_isaac_split.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "Rng_Isaac.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_split_1
+*/
+
+void test_split_1( void )
+{
+   rng_isaac_t *rng = NULL;
+   rng_isaac_t *rng1 = NULL;
+   rng_isaac_t *child = NULL;
+   rng_isaac_t *child1 = NULL;
+   uint64_t a[300];
+   uint64_t a1[300];
+
+   // the same parent gives the same child
+   rng = rng_isaac_make_with_seed( 99 );
+   rng1 = rng_isaac_make_with_seed( 99 );
+
+   rng_isaac_fill_u64( rng, a, 10 );
+   rng_isaac_fill_u64( rng1, a1, 10 );
+
+   child = rng_isaac_split( rng );
+   child1 = rng_isaac_split( rng1 );
+
+   CU_ASSERT( child != NULL );
+
+   rng_isaac_fill_u64( child, a, 300 );
+   rng_isaac_fill_u64( child1, a1, 300 );
+
+   CU_ASSERT( memcmp( a, a1, sizeof( a ) ) == 0 );
+
+   rng_isaac_dispose( &child );
+   rng_isaac_dispose( &child1 );
+   rng_isaac_dispose( &rng );
+   rng_isaac_dispose( &rng1 );
+
+   return;
+}
+
+/**
+   test_split_2
+*/
+
+void test_split_2( void )
+{
+   rng_isaac_t *rng = NULL;
+   rng_isaac_t *rng1 = NULL;
+   rng_isaac_t *child = NULL;
+   rng_isaac_t *child1 = NULL;
+   uint64_t a[256];
+   uint64_t a1[256];
+   uint64_t a2[256];
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t count = 0;
+
+   rng = rng_isaac_make_with_seed( 99 );
+   rng1 = rng_isaac_make_with_seed( 99 );
+
+   // splitting moves the parent forth past 256 numbers
+   child = rng_isaac_split( rng );
+   rng_isaac_fill_u64( rng1, a, 256 );
+   CU_ASSERT( rng_isaac_u64_item( rng ) == rng_isaac_u64_item( rng1 ) );
+
+   // two children and the parent share no numbers
+   child1 = rng_isaac_split( rng );
+   rng_isaac_fill_u64( child, a, 256 );
+   rng_isaac_fill_u64( child1, a1, 256 );
+   rng_isaac_fill_u64( rng, a2, 256 );
+
+   for ( i = 0; i < 256; i++ )
+   {
+      for ( j = 0; j < 256; j++ )
+      {
+         if ( ( a[i] == a1[j] ) || ( a[i] == a2[j] ) || ( a1[i] == a2[j] ) )
+         {
+            count = count + 1;
+         }
+      }
+   }
+
+   CU_ASSERT( count == 0 );
+
+   rng_isaac_dispose( &child );
+   rng_isaac_dispose( &child1 );
+   rng_isaac_dispose( &rng );
+   rng_isaac_dispose( &rng1 );
+
+   return;
+}
+
+int
+add_test_split( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_split", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_split_1
+   add_test_to_suite( p_suite, test_split_1, "test_split_1" );
+
+   // test_split_2
+   add_test_to_suite( p_suite, test_split_2, "test_split_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -43,6 +43,21 @@ add_test_f64_item( void );
 int
 add_test_forth( void );
 
+int
+add_test_make_with_stream( void );
+
+int
+add_test_split( void );
+
+int
+add_test_fill_u32( void );
+
+int
+add_test_fill_u64( void );
+
+int
+add_test_fill_f64( void );
+
 
 int
 add_gaussian_test_make( void );
@@ -111,6 +126,11 @@ int main()
    add_test_f32_item();
    add_test_f64_item();
    add_test_forth();
+   add_test_make_with_stream();
+   add_test_split();
+   add_test_fill_u32();
+   add_test_fill_u64();
+   add_test_fill_f64();
 
    add_gaussian_test_make();
    add_gaussian_test_make_with_seed();
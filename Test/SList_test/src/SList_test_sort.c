@@ -198,6 +198,52 @@ void test_sort_5( void )
    return;
 }
 
+/**
+   test_sort_6
+*/
+
+void test_sort_6( void )
+{
+   int_slist_t *list = NULL;
+   int32_t i = 0;
+   int32_t value = 0;
+   int32_t count = 0;
+   int32_t ok = 1;
+
+   list = int_slist_make();
+
+   for ( i = 0; i < 1000; i++ )
+   {
+      int_slist_put_last( list, ( i * 7919 ) % 1009 );
+   }
+
+   int_slist_sort( list, sort_func );
+
+   CU_ASSERT( int_slist_count( list ) == 1000 );
+
+   value = int_slist_first( list );
+
+   int_slist_start( list );
+   while ( int_slist_off( list ) == 0 )
+   {
+      if ( int_slist_item_at( list ) > value )
+      {
+         ok = 0;
+      }
+      value = int_slist_item_at( list );
+      count = count + 1;
+      int_slist_forth( list );
+   }
+
+   CU_ASSERT( ok == 1 );
+   CU_ASSERT( count == 1000 );
+   CU_ASSERT( int_slist_last( list ) == value );
+
+   int_slist_dispose( &list );
+
+   return;
+}
+
 int
 add_test_sort( void )
 {
@@ -228,6 +274,9 @@ add_test_sort( void )
    // test_sort_5
    add_test_to_suite( p_suite, test_sort_5, "test_sort_5" );
 
+   // test_sort_6
+   add_test_to_suite( p_suite, test_sort_6, "test_sort_6" );
+
    return CUE_SUCCESS;
 
 }
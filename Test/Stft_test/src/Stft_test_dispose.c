@@ -0,0 +1,200 @@
+/**
+ @file Stft_test_dispose.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Stft_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Stft_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+
+#include "cf_Stft.h"
+#include "cd_Stft.h"
+
+#include "Stft_utility.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_dispose_1
+*/
+
+void test_dispose_1( void )
+{
+   cf_stft_t *stft = NULL;
+
+   stft = cf_stft_make( 16, 4, 2 );
+
+   CU_ASSERT( stft != NULL );
+
+   cf_stft_dispose( &stft );
+
+   CU_ASSERT( stft == NULL );
+
+   return;
+}
+
+/**
+   test_dispose_2
+*/
+
+void test_dispose_2( void )
+{
+   cd_stft_t *stft = NULL;
+
+   stft = cd_stft_make( 16, 4, 2 );
+
+   CU_ASSERT( stft != NULL );
+
+   cd_stft_dispose( &stft );
+
+   CU_ASSERT( stft == NULL );
+
+   return;
+}
+
+/**
+   test_dispose_3
+*/
+
+void test_dispose_3( void )
+{
+   cf_stft_t *stft = NULL;
+
+   stft = cf_stft_make( 12, 4, 4 );
+   cf_stft_set_thread_count( stft, 3 );
+
+   CU_ASSERT( stft != NULL );
+
+   cf_stft_dispose( &stft );
+
+   CU_ASSERT( stft == NULL );
+
+   return;
+}
+
+/**
+   test_dispose_4
+*/
+
+void test_dispose_4( void )
+{
+   cd_stft_t *stft = NULL;
+
+   stft = cd_stft_make( 12, 4, 4 );
+   cd_stft_set_thread_count( stft, 3 );
+
+   CU_ASSERT( stft != NULL );
+
+   cd_stft_dispose( &stft );
+
+   CU_ASSERT( stft == NULL );
+
+   return;
+}
+
+/**
+   test_dispose_5
+*/
+
+void test_dispose_5( void )
+{
+   cf_stft_t *stft = NULL;
+
+   stft = cf_stft_make( 16, 4, 2 );
+   cf_stft_set_thread_count( stft, 2 );
+
+   CU_ASSERT( stft != NULL );
+
+   cf_stft_deep_dispose( &stft );
+
+   CU_ASSERT( stft == NULL );
+
+   return;
+}
+
+/**
+   test_dispose_6
+*/
+
+void test_dispose_6( void )
+{
+   cd_stft_t *stft = NULL;
+
+   stft = cd_stft_make( 16, 4, 2 );
+
+   CU_ASSERT( stft != NULL );
+
+   cd_stft_deep_dispose( &stft );
+
+   CU_ASSERT( stft == NULL );
+
+   return;
+}
+
+int
+add_test_dispose( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_dispose", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_dispose_1
+   add_test_to_suite( p_suite, test_dispose_1, "test_dispose_1" );
+
+   // test_dispose_2
+   add_test_to_suite( p_suite, test_dispose_2, "test_dispose_2" );
+
+   // test_dispose_3
+   add_test_to_suite( p_suite, test_dispose_3, "test_dispose_3" );
+
+   // test_dispose_4
+   add_test_to_suite( p_suite, test_dispose_4, "test_dispose_4" );
+
+   // test_dispose_5
+   add_test_to_suite( p_suite, test_dispose_5, "test_dispose_5" );
+
+   // test_dispose_6
+   add_test_to_suite( p_suite, test_dispose_6, "test_dispose_6" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,169 @@
+/**
+ @file Stft_test_make.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Stft_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Stft_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+
+#include "cf_Stft.h"
+#include "cd_Stft.h"
+
+#include "Stft_utility.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_make_1
+*/
+
+void test_make_1( void )
+{
+   cf_stft_t *stft = NULL;
+
+   stft = cf_stft_make( 16, 8, 1 );
+
+   CU_ASSERT( stft != NULL );
+   CU_ASSERT( cf_stft_frame_length( stft ) == 16 );
+   CU_ASSERT( cf_stft_hop_length( stft ) == 8 );
+   CU_ASSERT( cf_stft_channel_count( stft ) == 1 );
+   CU_ASSERT( cf_stft_count( stft ) == 0 );
+   CU_ASSERT( cf_stft_space( stft ) > 16 );
+   CU_ASSERT( cf_stft_is_frame_ready( stft ) == 0 );
+   CU_ASSERT( cf_stft_thread_count( stft ) == 1 );
+
+   cf_stft_dispose( &stft );
+
+   return;
+}
+
+/**
+   test_make_2
+*/
+
+void test_make_2( void )
+{
+   cd_stft_t *stft = NULL;
+
+   stft = cd_stft_make( 16, 8, 1 );
+
+   CU_ASSERT( stft != NULL );
+   CU_ASSERT( cd_stft_frame_length( stft ) == 16 );
+   CU_ASSERT( cd_stft_hop_length( stft ) == 8 );
+   CU_ASSERT( cd_stft_channel_count( stft ) == 1 );
+   CU_ASSERT( cd_stft_count( stft ) == 0 );
+   CU_ASSERT( cd_stft_space( stft ) > 16 );
+   CU_ASSERT( cd_stft_is_frame_ready( stft ) == 0 );
+   CU_ASSERT( cd_stft_thread_count( stft ) == 1 );
+
+   cd_stft_dispose( &stft );
+
+   return;
+}
+
+/**
+   test_make_3
+*/
+
+void test_make_3( void )
+{
+   cf_stft_t *stft = NULL;
+
+   stft = cf_stft_make( 7, 7, 3 );
+
+   CU_ASSERT( stft != NULL );
+   CU_ASSERT( cf_stft_frame_length( stft ) == 7 );
+   CU_ASSERT( cf_stft_hop_length( stft ) == 7 );
+   CU_ASSERT( cf_stft_channel_count( stft ) == 3 );
+   CU_ASSERT( cf_stft_count( stft ) == 0 );
+   CU_ASSERT( cf_stft_space( stft ) > 7 );
+
+   cf_stft_dispose( &stft );
+
+   return;
+}
+
+/**
+   test_make_4
+*/
+
+void test_make_4( void )
+{
+   cd_stft_t *stft = NULL;
+
+   stft = cd_stft_make( 7, 7, 3 );
+
+   CU_ASSERT( stft != NULL );
+   CU_ASSERT( cd_stft_frame_length( stft ) == 7 );
+   CU_ASSERT( cd_stft_hop_length( stft ) == 7 );
+   CU_ASSERT( cd_stft_channel_count( stft ) == 3 );
+   CU_ASSERT( cd_stft_count( stft ) == 0 );
+   CU_ASSERT( cd_stft_space( stft ) > 7 );
+
+   cd_stft_dispose( &stft );
+
+   return;
+}
+
+int
+add_test_make( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_make", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_make_1
+   add_test_to_suite( p_suite, test_make_1, "test_make_1" );
+
+   // test_make_2
+   add_test_to_suite( p_suite, test_make_2, "test_make_2" );
+
+   // test_make_3
+   add_test_to_suite( p_suite, test_make_3, "test_make_3" );
+
+   // test_make_4
+   add_test_to_suite( p_suite, test_make_4, "test_make_4" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
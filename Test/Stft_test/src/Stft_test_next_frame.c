@@ -0,0 +1,537 @@
+/**
+ @file Stft_test_next_frame.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Stft_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Stft_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+
+#include "cf_Stft.h"
+#include "cd_Stft.h"
+
+#include "Stft_utility.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_next_frame_1
+*/
+
+void test_next_frame_1( void )
+{
+   cf_stft_t *stft = NULL;
+   float *samples = NULL;
+   float *channels[1] = { NULL };
+   float *psd = NULL;
+   float *log_psd = NULL;
+   float *phase = NULL;
+   float *ref_psd = NULL;
+   float *ref_log_psd = NULL;
+   float *ref_phase = NULL;
+   int32_t lengths[5] = { 16, 12, 64, 2, 10 };
+   int32_t n = 0;
+   int32_t hop = 0;
+   int32_t i = 0;
+   int32_t frame = 0;
+   int32_t position = 0;
+   int32_t chunk = 0;
+   int32_t total = 0;
+
+   for ( i=0; i<5; i++ )
+   {
+      n = lengths[i];
+      hop = ( n > 2 ) ? n/3 : 1;
+      total = 6*n;
+
+      stft = cf_stft_make( n, hop, 1 );
+      samples = random_samples_f( total, 4321u + i );
+      psd = ( float * ) calloc( n, sizeof( float ) );
+      log_psd = ( float * ) calloc( n, sizeof( float ) );
+      phase = ( float * ) calloc( n, sizeof( float ) );
+      ref_psd = ( float * ) calloc( n, sizeof( float ) );
+      ref_log_psd = ( float * ) calloc( n, sizeof( float ) );
+      ref_phase = ( float * ) calloc( n, sizeof( float ) );
+
+      // put the samples in uneven chunks and compare each frame
+      position = 0;
+      frame = 0;
+      while ( position < total )
+      {
+         chunk = ( n/2 + 1 < total - position ) ? n/2 + 1 : total - position;
+         if ( chunk > cf_stft_space( stft ) )
+         {
+            chunk = cf_stft_space( stft );
+         }
+
+         channels[0] = samples + position;
+         cf_stft_put( stft, channels, chunk );
+         position = position + chunk;
+
+         while ( cf_stft_is_frame_ready( stft ) == 1 )
+         {
+            cf_stft_next_frame( stft, &psd, &log_psd, &phase );
+            reference_frame_f( samples + frame*hop, n, ref_psd, ref_log_psd, ref_phase );
+
+            CU_ASSERT( is_close_f( psd, ref_psd, n, 0.0001 ) == 1 );
+            CU_ASSERT( is_close_f( log_psd, ref_log_psd, n, 0.0001 ) == 1 );
+            CU_ASSERT( is_phase_close_f( phase, ref_phase, n, 0.001 ) == 1 );
+
+            frame = frame + 1;
+         }
+      }
+
+      CU_ASSERT( frame == ( total - n )/hop + 1 );
+
+      cf_stft_dispose( &stft );
+      free( samples );
+      free( psd );
+      free( log_psd );
+      free( phase );
+      free( ref_psd );
+      free( ref_log_psd );
+      free( ref_phase );
+   }
+
+   return;
+}
+
+/**
+   test_next_frame_2
+*/
+
+void test_next_frame_2( void )
+{
+   cd_stft_t *stft = NULL;
+   double *samples = NULL;
+   double *channels[1] = { NULL };
+   double *psd = NULL;
+   double *log_psd = NULL;
+   double *phase = NULL;
+   double *ref_psd = NULL;
+   double *ref_log_psd = NULL;
+   double *ref_phase = NULL;
+   int32_t lengths[5] = { 16, 12, 64, 2, 10 };
+   int32_t n = 0;
+   int32_t hop = 0;
+   int32_t i = 0;
+   int32_t frame = 0;
+   int32_t position = 0;
+   int32_t chunk = 0;
+   int32_t total = 0;
+
+   for ( i=0; i<5; i++ )
+   {
+      n = lengths[i];
+      hop = ( n > 2 ) ? n/3 : 1;
+      total = 6*n;
+
+      stft = cd_stft_make( n, hop, 1 );
+      samples = random_samples_d( total, 4321u + i );
+      psd = ( double * ) calloc( n, sizeof( double ) );
+      log_psd = ( double * ) calloc( n, sizeof( double ) );
+      phase = ( double * ) calloc( n, sizeof( double ) );
+      ref_psd = ( double * ) calloc( n, sizeof( double ) );
+      ref_log_psd = ( double * ) calloc( n, sizeof( double ) );
+      ref_phase = ( double * ) calloc( n, sizeof( double ) );
+
+      // put the samples in uneven chunks and compare each frame
+      position = 0;
+      frame = 0;
+      while ( position < total )
+      {
+         chunk = ( n/2 + 1 < total - position ) ? n/2 + 1 : total - position;
+         if ( chunk > cd_stft_space( stft ) )
+         {
+            chunk = cd_stft_space( stft );
+         }
+
+         channels[0] = samples + position;
+         cd_stft_put( stft, channels, chunk );
+         position = position + chunk;
+
+         while ( cd_stft_is_frame_ready( stft ) == 1 )
+         {
+            cd_stft_next_frame( stft, &psd, &log_psd, &phase );
+            reference_frame_d( samples + frame*hop, n, ref_psd, ref_log_psd, ref_phase );
+
+            CU_ASSERT( is_close_d( psd, ref_psd, n, 0.0000001 ) == 1 );
+            CU_ASSERT( is_close_d( log_psd, ref_log_psd, n, 0.0000001 ) == 1 );
+            CU_ASSERT( is_phase_close_d( phase, ref_phase, n, 0.000001 ) == 1 );
+
+            frame = frame + 1;
+         }
+      }
+
+      CU_ASSERT( frame == ( total - n )/hop + 1 );
+
+      cd_stft_dispose( &stft );
+      free( samples );
+      free( psd );
+      free( log_psd );
+      free( phase );
+      free( ref_psd );
+      free( ref_log_psd );
+      free( ref_phase );
+   }
+
+   return;
+}
+
+/**
+   test_next_frame_3
+*/
+
+void test_next_frame_3( void )
+{
+   cf_stft_t *stft = NULL;
+   float *samples = NULL;
+   float *channels[1] = { NULL };
+   float *psd = NULL;
+   float *log_psd = NULL;
+   float *phase = NULL;
+   float *ref_psd = NULL;
+   float *ref_log_psd = NULL;
+   float *ref_phase = NULL;
+   int32_t lengths[5] = { 7, 15, 9, 97, 3 };
+   int32_t n = 0;
+   int32_t hop = 0;
+   int32_t i = 0;
+   int32_t frame = 0;
+   int32_t position = 0;
+   int32_t chunk = 0;
+   int32_t total = 0;
+
+   for ( i=0; i<5; i++ )
+   {
+      n = lengths[i];
+      hop = ( n > 2 ) ? n/3 : 1;
+      total = 6*n;
+
+      stft = cf_stft_make( n, hop, 1 );
+      samples = random_samples_f( total, 4321u + i );
+      psd = ( float * ) calloc( n, sizeof( float ) );
+      log_psd = ( float * ) calloc( n, sizeof( float ) );
+      phase = ( float * ) calloc( n, sizeof( float ) );
+      ref_psd = ( float * ) calloc( n, sizeof( float ) );
+      ref_log_psd = ( float * ) calloc( n, sizeof( float ) );
+      ref_phase = ( float * ) calloc( n, sizeof( float ) );
+
+      // put the samples in uneven chunks and compare each frame
+      position = 0;
+      frame = 0;
+      while ( position < total )
+      {
+         chunk = ( n/2 + 1 < total - position ) ? n/2 + 1 : total - position;
+         if ( chunk > cf_stft_space( stft ) )
+         {
+            chunk = cf_stft_space( stft );
+         }
+
+         channels[0] = samples + position;
+         cf_stft_put( stft, channels, chunk );
+         position = position + chunk;
+
+         while ( cf_stft_is_frame_ready( stft ) == 1 )
+         {
+            cf_stft_next_frame( stft, &psd, &log_psd, &phase );
+            reference_frame_f( samples + frame*hop, n, ref_psd, ref_log_psd, ref_phase );
+
+            CU_ASSERT( is_close_f( psd, ref_psd, n, 0.0001 ) == 1 );
+            CU_ASSERT( is_close_f( log_psd, ref_log_psd, n, 0.0001 ) == 1 );
+            CU_ASSERT( is_phase_close_f( phase, ref_phase, n, 0.001 ) == 1 );
+
+            frame = frame + 1;
+         }
+      }
+
+      CU_ASSERT( frame == ( total - n )/hop + 1 );
+
+      cf_stft_dispose( &stft );
+      free( samples );
+      free( psd );
+      free( log_psd );
+      free( phase );
+      free( ref_psd );
+      free( ref_log_psd );
+      free( ref_phase );
+   }
+
+   return;
+}
+
+/**
+   test_next_frame_4
+*/
+
+void test_next_frame_4( void )
+{
+   cd_stft_t *stft = NULL;
+   double *samples = NULL;
+   double *channels[1] = { NULL };
+   double *psd = NULL;
+   double *log_psd = NULL;
+   double *phase = NULL;
+   double *ref_psd = NULL;
+   double *ref_log_psd = NULL;
+   double *ref_phase = NULL;
+   int32_t lengths[5] = { 7, 15, 9, 97, 3 };
+   int32_t n = 0;
+   int32_t hop = 0;
+   int32_t i = 0;
+   int32_t frame = 0;
+   int32_t position = 0;
+   int32_t chunk = 0;
+   int32_t total = 0;
+
+   for ( i=0; i<5; i++ )
+   {
+      n = lengths[i];
+      hop = ( n > 2 ) ? n/3 : 1;
+      total = 6*n;
+
+      stft = cd_stft_make( n, hop, 1 );
+      samples = random_samples_d( total, 4321u + i );
+      psd = ( double * ) calloc( n, sizeof( double ) );
+      log_psd = ( double * ) calloc( n, sizeof( double ) );
+      phase = ( double * ) calloc( n, sizeof( double ) );
+      ref_psd = ( double * ) calloc( n, sizeof( double ) );
+      ref_log_psd = ( double * ) calloc( n, sizeof( double ) );
+      ref_phase = ( double * ) calloc( n, sizeof( double ) );
+
+      // put the samples in uneven chunks and compare each frame
+      position = 0;
+      frame = 0;
+      while ( position < total )
+      {
+         chunk = ( n/2 + 1 < total - position ) ? n/2 + 1 : total - position;
+         if ( chunk > cd_stft_space( stft ) )
+         {
+            chunk = cd_stft_space( stft );
+         }
+
+         channels[0] = samples + position;
+         cd_stft_put( stft, channels, chunk );
+         position = position + chunk;
+
+         while ( cd_stft_is_frame_ready( stft ) == 1 )
+         {
+            cd_stft_next_frame( stft, &psd, &log_psd, &phase );
+            reference_frame_d( samples + frame*hop, n, ref_psd, ref_log_psd, ref_phase );
+
+            CU_ASSERT( is_close_d( psd, ref_psd, n, 0.0000001 ) == 1 );
+            CU_ASSERT( is_close_d( log_psd, ref_log_psd, n, 0.0000001 ) == 1 );
+            CU_ASSERT( is_phase_close_d( phase, ref_phase, n, 0.000001 ) == 1 );
+
+            frame = frame + 1;
+         }
+      }
+
+      CU_ASSERT( frame == ( total - n )/hop + 1 );
+
+      cd_stft_dispose( &stft );
+      free( samples );
+      free( psd );
+      free( log_psd );
+      free( phase );
+      free( ref_psd );
+      free( ref_log_psd );
+      free( ref_phase );
+   }
+
+   return;
+}
+
+/**
+   test_next_frame_5
+*/
+
+void test_next_frame_5( void )
+{
+   cf_stft_t *stft = NULL;
+   float *samples[3] = { NULL, NULL, NULL };
+   float *psd[3] = { NULL, NULL, NULL };
+   float *phase[3] = { NULL, NULL, NULL };
+   float *ref_psd = NULL;
+   float *ref_log_psd = NULL;
+   float *ref_phase = NULL;
+   int32_t n = 24;
+   int32_t hop = 6;
+   int32_t c = 0;
+   int32_t frame = 0;
+
+   stft = cf_stft_make( n, hop, 3 );
+   ref_psd = ( float * ) calloc( n, sizeof( float ) );
+   ref_log_psd = ( float * ) calloc( n, sizeof( float ) );
+   ref_phase = ( float * ) calloc( n, sizeof( float ) );
+
+   for ( c=0; c<3; c++ )
+   {
+      samples[c] = random_samples_f( n + 3*hop, 100u + c );
+      psd[c] = ( float * ) calloc( n, sizeof( float ) );
+      phase[c] = ( float * ) calloc( n, sizeof( float ) );
+   }
+
+   cf_stft_put( stft, samples, n + 3*hop );
+
+   // without log psd
+   for ( frame=0; frame<4; frame++ )
+   {
+      cf_stft_next_frame( stft, psd, NULL, phase );
+
+      for ( c=0; c<3; c++ )
+      {
+         reference_frame_f( samples[c] + frame*hop, n, ref_psd, ref_log_psd, ref_phase );
+
+         CU_ASSERT( is_close_f( psd[c], ref_psd, n, 0.0001 ) == 1 );
+         CU_ASSERT( is_phase_close_f( phase[c], ref_phase, n, 0.001 ) == 1 );
+      }
+   }
+
+   CU_ASSERT( cf_stft_count( stft ) == n - hop );
+
+   cf_stft_dispose( &stft );
+
+   for ( c=0; c<3; c++ )
+   {
+      free( samples[c] );
+      free( psd[c] );
+      free( phase[c] );
+   }
+   free( ref_psd );
+   free( ref_log_psd );
+   free( ref_phase );
+
+   return;
+}
+
+/**
+   test_next_frame_6
+*/
+
+void test_next_frame_6( void )
+{
+   cd_stft_t *stft = NULL;
+   double *samples[3] = { NULL, NULL, NULL };
+   double *psd[3] = { NULL, NULL, NULL };
+   double *phase[3] = { NULL, NULL, NULL };
+   double *ref_psd = NULL;
+   double *ref_log_psd = NULL;
+   double *ref_phase = NULL;
+   int32_t n = 24;
+   int32_t hop = 6;
+   int32_t c = 0;
+   int32_t frame = 0;
+
+   stft = cd_stft_make( n, hop, 3 );
+   ref_psd = ( double * ) calloc( n, sizeof( double ) );
+   ref_log_psd = ( double * ) calloc( n, sizeof( double ) );
+   ref_phase = ( double * ) calloc( n, sizeof( double ) );
+
+   for ( c=0; c<3; c++ )
+   {
+      samples[c] = random_samples_d( n + 3*hop, 100u + c );
+      psd[c] = ( double * ) calloc( n, sizeof( double ) );
+      phase[c] = ( double * ) calloc( n, sizeof( double ) );
+   }
+
+   cd_stft_put( stft, samples, n + 3*hop );
+
+   // without log psd
+   for ( frame=0; frame<4; frame++ )
+   {
+      cd_stft_next_frame( stft, psd, NULL, phase );
+
+      for ( c=0; c<3; c++ )
+      {
+         reference_frame_d( samples[c] + frame*hop, n, ref_psd, ref_log_psd, ref_phase );
+
+         CU_ASSERT( is_close_d( psd[c], ref_psd, n, 0.0000001 ) == 1 );
+         CU_ASSERT( is_phase_close_d( phase[c], ref_phase, n, 0.000001 ) == 1 );
+      }
+   }
+
+   CU_ASSERT( cd_stft_count( stft ) == n - hop );
+
+   cd_stft_dispose( &stft );
+
+   for ( c=0; c<3; c++ )
+   {
+      free( samples[c] );
+      free( psd[c] );
+      free( phase[c] );
+   }
+   free( ref_psd );
+   free( ref_log_psd );
+   free( ref_phase );
+
+   return;
+}
+
+int
+add_test_next_frame( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_next_frame", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_next_frame_1
+   add_test_to_suite( p_suite, test_next_frame_1, "test_next_frame_1" );
+
+   // test_next_frame_2
+   add_test_to_suite( p_suite, test_next_frame_2, "test_next_frame_2" );
+
+   // test_next_frame_3
+   add_test_to_suite( p_suite, test_next_frame_3, "test_next_frame_3" );
+
+   // test_next_frame_4
+   add_test_to_suite( p_suite, test_next_frame_4, "test_next_frame_4" );
+
+   // test_next_frame_5
+   add_test_to_suite( p_suite, test_next_frame_5, "test_next_frame_5" );
+
+   // test_next_frame_6
+   add_test_to_suite( p_suite, test_next_frame_6, "test_next_frame_6" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,477 @@
+/**
+ @file Stft_test_put.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Stft_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Stft_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+
+#include "cf_Stft.h"
+#include "cd_Stft.h"
+
+#include "Stft_utility.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_put_1
+*/
+
+void test_put_1( void )
+{
+   cf_stft_t *stft = NULL;
+   float *samples = NULL;
+   float *channels[1] = { NULL };
+
+   stft = cf_stft_make( 16, 8, 1 );
+   samples = random_samples_f( 16, 12345u );
+   channels[0] = samples;
+
+   cf_stft_put( stft, channels, 10 );
+
+   CU_ASSERT( cf_stft_count( stft ) == 10 );
+   CU_ASSERT( cf_stft_is_frame_ready( stft ) == 0 );
+
+   cf_stft_put( stft, channels, 6 );
+
+   CU_ASSERT( cf_stft_count( stft ) == 16 );
+   CU_ASSERT( cf_stft_is_frame_ready( stft ) == 1 );
+
+   cf_stft_dispose( &stft );
+   free( samples );
+
+   return;
+}
+
+/**
+   test_put_2
+*/
+
+void test_put_2( void )
+{
+   cd_stft_t *stft = NULL;
+   double *samples = NULL;
+   double *channels[1] = { NULL };
+
+   stft = cd_stft_make( 16, 8, 1 );
+   samples = random_samples_d( 16, 12345u );
+   channels[0] = samples;
+
+   cd_stft_put( stft, channels, 10 );
+
+   CU_ASSERT( cd_stft_count( stft ) == 10 );
+   CU_ASSERT( cd_stft_is_frame_ready( stft ) == 0 );
+
+   cd_stft_put( stft, channels, 6 );
+
+   CU_ASSERT( cd_stft_count( stft ) == 16 );
+   CU_ASSERT( cd_stft_is_frame_ready( stft ) == 1 );
+
+   cd_stft_dispose( &stft );
+   free( samples );
+
+   return;
+}
+
+/**
+   test_put_3
+*/
+
+void test_put_3( void )
+{
+   cf_stft_t *stft = NULL;
+   float *samples = NULL;
+   float *channels[2] = { NULL, NULL };
+   int32_t i = 0;
+   int32_t space = 0;
+
+   stft = cf_stft_make( 8, 3, 2 );
+   samples = random_samples_f( 16, 12345u );
+   channels[0] = samples;
+   channels[1] = samples;
+
+   // fill, take frames and refill so that the ring wraps around
+   for ( i=0; i<10; i++ )
+   {
+      space = cf_stft_space( stft );
+      cf_stft_put( stft, channels, space );
+
+      CU_ASSERT( cf_stft_space( stft ) == 0 );
+      CU_ASSERT( cf_stft_is_frame_ready( stft ) == 1 );
+
+      while ( cf_stft_is_frame_ready( stft ) == 1 )
+      {
+         cf_stft_next_frame( stft, NULL, NULL, NULL );
+      }
+
+      CU_ASSERT( cf_stft_count( stft ) < 8 );
+      CU_ASSERT( cf_stft_space( stft ) > 8 );
+   }
+
+   cf_stft_dispose( &stft );
+   free( samples );
+
+   return;
+}
+
+/**
+   test_put_4
+*/
+
+void test_put_4( void )
+{
+   cd_stft_t *stft = NULL;
+   double *samples = NULL;
+   double *channels[2] = { NULL, NULL };
+   int32_t i = 0;
+   int32_t space = 0;
+
+   stft = cd_stft_make( 8, 3, 2 );
+   samples = random_samples_d( 16, 12345u );
+   channels[0] = samples;
+   channels[1] = samples;
+
+   // fill, take frames and refill so that the ring wraps around
+   for ( i=0; i<10; i++ )
+   {
+      space = cd_stft_space( stft );
+      cd_stft_put( stft, channels, space );
+
+      CU_ASSERT( cd_stft_space( stft ) == 0 );
+      CU_ASSERT( cd_stft_is_frame_ready( stft ) == 1 );
+
+      while ( cd_stft_is_frame_ready( stft ) == 1 )
+      {
+         cd_stft_next_frame( stft, NULL, NULL, NULL );
+      }
+
+      CU_ASSERT( cd_stft_count( stft ) < 8 );
+      CU_ASSERT( cd_stft_space( stft ) > 8 );
+   }
+
+   cd_stft_dispose( &stft );
+   free( samples );
+
+   return;
+}
+
+/**
+   frame_data_f_t
+
+   what the frame function of test_put_5 compares each frame with
+*/
+
+typedef struct
+{
+   float *samples;
+   int32_t n;
+   int32_t hop;
+   int32_t frame;
+   int32_t fail_count;
+   float *ref_psd;
+   float *ref_log_psd;
+   float *ref_phase;
+} frame_data_f_t;
+
+/**
+   frame_function_f
+*/
+
+static
+void
+frame_function_f( void *data, float **psd, float **log_psd, float **phase )
+{
+   frame_data_f_t *d = ( frame_data_f_t * ) data;
+
+   reference_frame_f( (*d).samples + (*d).frame*(*d).hop, (*d).n, (*d).ref_psd, (*d).ref_log_psd, (*d).ref_phase );
+
+   if (
+         ( is_close_f( psd[0], (*d).ref_psd, (*d).n, 0.0001 ) == 0 )
+         || ( is_close_f( log_psd[0], (*d).ref_log_psd, (*d).n, 0.0001 ) == 0 )
+         || ( is_phase_close_f( phase[0], (*d).ref_phase, (*d).n, 0.001 ) == 0 )
+      )
+   {
+      (*d).fail_count = (*d).fail_count + 1;
+   }
+
+   (*d).frame = (*d).frame + 1;
+
+   return;
+}
+
+/**
+   test_put_5
+*/
+
+void test_put_5( void )
+{
+   cf_stft_t *stft = NULL;
+   float *samples = NULL;
+   float *channels[1] = { NULL };
+   float *psd = NULL;
+   float *log_psd = NULL;
+   float *phase = NULL;
+   frame_data_f_t d;
+   int32_t total = 0;
+
+   d.n = 16;
+   d.hop = 5;
+   d.frame = 0;
+   d.fail_count = 0;
+   total = 20*d.n + 3;
+
+   stft = cf_stft_make( d.n, d.hop, 1 );
+   samples = random_samples_f( total, 2468u );
+   d.samples = samples;
+   psd = ( float * ) calloc( d.n, sizeof( float ) );
+   log_psd = ( float * ) calloc( d.n, sizeof( float ) );
+   phase = ( float * ) calloc( d.n, sizeof( float ) );
+   d.ref_psd = ( float * ) calloc( d.n, sizeof( float ) );
+   d.ref_log_psd = ( float * ) calloc( d.n, sizeof( float ) );
+   d.ref_phase = ( float * ) calloc( d.n, sizeof( float ) );
+
+   cf_stft_set_frame_function( stft, frame_function_f, &d, &psd, &log_psd, &phase );
+
+   // the whole signal in one put, far more than the ring holds
+   channels[0] = samples;
+   cf_stft_put( stft, channels, total );
+
+   CU_ASSERT( d.frame == ( total - d.n )/d.hop + 1 );
+   CU_ASSERT( d.fail_count == 0 );
+   CU_ASSERT( cf_stft_is_frame_ready( stft ) == 0 );
+   CU_ASSERT( cf_stft_count( stft ) == total - d.frame*d.hop );
+
+   cf_stft_dispose( &stft );
+   free( samples );
+   free( psd );
+   free( log_psd );
+   free( phase );
+   free( d.ref_psd );
+   free( d.ref_log_psd );
+   free( d.ref_phase );
+
+   return;
+}
+
+/**
+   frame_data_d_t
+
+   the frames taken one by one that test_put_6 compares each frame with
+*/
+
+typedef struct
+{
+   double *psd[2];
+   double *phase[2];
+   int32_t n;
+   int32_t frame;
+   int32_t fail_count;
+} frame_data_d_t;
+
+/**
+   frame_function_d
+*/
+
+static
+void
+frame_function_d( void *data, double **psd, double **log_psd, double **phase )
+{
+   frame_data_d_t *d = ( frame_data_d_t * ) data;
+   int32_t i = 0;
+   int32_t k = (*d).frame*(*d).n;
+
+   if ( log_psd != NULL )
+   {
+      (*d).fail_count = (*d).fail_count + 1;
+   }
+
+   for ( i=0; i<2; i++ )
+   {
+      if (
+            ( is_close_d( psd[i], (*d).psd[i] + k, (*d).n, 1.0e-12 ) == 0 )
+            || ( is_phase_close_d( phase[i], (*d).phase[i] + k, (*d).n, 1.0e-12 ) == 0 )
+         )
+      {
+         (*d).fail_count = (*d).fail_count + 1;
+      }
+   }
+
+   (*d).frame = (*d).frame + 1;
+
+   return;
+}
+
+/**
+   test_put_6
+*/
+
+void test_put_6( void )
+{
+   cd_stft_t *stft = NULL;
+   double *samples[2] = { NULL, NULL };
+   double *channels[2] = { NULL, NULL };
+   double *psd[2] = { NULL, NULL };
+   double *phase[2] = { NULL, NULL };
+   double *out_psd[2] = { NULL, NULL };
+   double *out_phase[2] = { NULL, NULL };
+   frame_data_d_t d;
+   int32_t i = 0;
+   int32_t total = 0;
+   int32_t hop = 0;
+   int32_t frame_count = 0;
+   int32_t position = 0;
+   int32_t chunk = 0;
+
+   d.n = 12;
+   d.frame = 0;
+   d.fail_count = 0;
+   hop = 4;
+   total = 30*d.n + 7;
+   frame_count = ( total - d.n )/hop + 1;
+
+   for ( i=0; i<2; i++ )
+   {
+      samples[i] = random_samples_d( total, 1357u + i );
+      psd[i] = ( double * ) calloc( d.n, sizeof( double ) );
+      phase[i] = ( double * ) calloc( d.n, sizeof( double ) );
+      d.psd[i] = ( double * ) calloc( frame_count*d.n, sizeof( double ) );
+      d.phase[i] = ( double * ) calloc( frame_count*d.n, sizeof( double ) );
+   }
+
+   // take the frames one by one as the reference
+   stft = cd_stft_make( d.n, hop, 2 );
+
+   position = 0;
+   while ( position < total )
+   {
+      chunk = cd_stft_space( stft );
+      if ( chunk > total - position )
+      {
+         chunk = total - position;
+      }
+
+      channels[0] = samples[0] + position;
+      channels[1] = samples[1] + position;
+      cd_stft_put( stft, channels, chunk );
+      position = position + chunk;
+
+      while ( cd_stft_is_frame_ready( stft ) == 1 )
+      {
+         out_psd[0] = d.psd[0] + d.frame*d.n;
+         out_psd[1] = d.psd[1] + d.frame*d.n;
+         out_phase[0] = d.phase[0] + d.frame*d.n;
+         out_phase[1] = d.phase[1] + d.frame*d.n;
+         cd_stft_next_frame( stft, out_psd, NULL, out_phase );
+         d.frame = d.frame + 1;
+      }
+   }
+
+   CU_ASSERT( d.frame == frame_count );
+
+   cd_stft_dispose( &stft );
+
+   // then the whole signal in one put, on two threads
+   stft = cd_stft_make( d.n, hop, 2 );
+   cd_stft_set_thread_count( stft, 2 );
+   cd_stft_set_frame_function( stft, frame_function_d, &d, psd, NULL, phase );
+
+   d.frame = 0;
+   channels[0] = samples[0];
+   channels[1] = samples[1];
+   cd_stft_put( stft, channels, total );
+
+   CU_ASSERT( d.frame == frame_count );
+   CU_ASSERT( d.fail_count == 0 );
+   CU_ASSERT( cd_stft_is_frame_ready( stft ) == 0 );
+
+   // without the frame function, frames are left for cd_stft_next_frame
+   cd_stft_set_frame_function( stft, NULL, NULL, NULL, NULL, NULL );
+   channels[0] = samples[0];
+   channels[1] = samples[1];
+   cd_stft_put( stft, channels, cd_stft_space( stft ) );
+
+   CU_ASSERT( cd_stft_is_frame_ready( stft ) == 1 );
+   CU_ASSERT( d.frame == frame_count );
+
+   cd_stft_dispose( &stft );
+
+   for ( i=0; i<2; i++ )
+   {
+      free( samples[i] );
+      free( psd[i] );
+      free( phase[i] );
+      free( d.psd[i] );
+      free( d.phase[i] );
+   }
+
+   return;
+}
+
+int
+add_test_put( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_put", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_put_1
+   add_test_to_suite( p_suite, test_put_1, "test_put_1" );
+
+   // test_put_2
+   add_test_to_suite( p_suite, test_put_2, "test_put_2" );
+
+   // test_put_3
+   add_test_to_suite( p_suite, test_put_3, "test_put_3" );
+
+   // test_put_4
+   add_test_to_suite( p_suite, test_put_4, "test_put_4" );
+
+   // test_put_5
+   add_test_to_suite( p_suite, test_put_5, "test_put_5" );
+
+   // test_put_6
+   add_test_to_suite( p_suite, test_put_6, "test_put_6" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,295 @@
+/**
+ @file Stft_test_set_thread_count.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Stft_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Stft_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+
+#include "cf_Stft.h"
+#include "cd_Stft.h"
+
+#include "Stft_utility.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_set_thread_count_1
+*/
+
+void test_set_thread_count_1( void )
+{
+   cf_stft_t *stft = NULL;
+
+   stft = cf_stft_make( 16, 8, 4 );
+
+   CU_ASSERT( cf_stft_thread_count( stft ) == 1 );
+
+   cf_stft_set_thread_count( stft, 4 );
+
+   CU_ASSERT( cf_stft_thread_count( stft ) == 4 );
+
+   cf_stft_set_thread_count( stft, 1 );
+
+   CU_ASSERT( cf_stft_thread_count( stft ) == 1 );
+
+   cf_stft_dispose( &stft );
+
+   return;
+}
+
+/**
+   test_set_thread_count_2
+*/
+
+void test_set_thread_count_2( void )
+{
+   cd_stft_t *stft = NULL;
+
+   stft = cd_stft_make( 16, 8, 4 );
+
+   CU_ASSERT( cd_stft_thread_count( stft ) == 1 );
+
+   cd_stft_set_thread_count( stft, 4 );
+
+   CU_ASSERT( cd_stft_thread_count( stft ) == 4 );
+
+   cd_stft_set_thread_count( stft, 1 );
+
+   CU_ASSERT( cd_stft_thread_count( stft ) == 1 );
+
+   cd_stft_dispose( &stft );
+
+   return;
+}
+
+/**
+   test_set_thread_count_3
+*/
+
+void test_set_thread_count_3( void )
+{
+   cf_stft_t *stft1 = NULL;
+   cf_stft_t *stft2 = NULL;
+   float *samples[5] = { NULL, NULL, NULL, NULL, NULL };
+   float *psd1[5] = { NULL, NULL, NULL, NULL, NULL };
+   float *psd2[5] = { NULL, NULL, NULL, NULL, NULL };
+   float *log_psd1[5] = { NULL, NULL, NULL, NULL, NULL };
+   float *log_psd2[5] = { NULL, NULL, NULL, NULL, NULL };
+   float *phase1[5] = { NULL, NULL, NULL, NULL, NULL };
+   float *phase2[5] = { NULL, NULL, NULL, NULL, NULL };
+   int32_t lengths[3] = { 64, 30, 7 };
+   int32_t n = 0;
+   int32_t i = 0;
+   int32_t c = 0;
+   int32_t flag = 1;
+
+   for ( i=0; i<3; i++ )
+   {
+      n = lengths[i];
+
+      stft1 = cf_stft_make( n, n/2, 5 );
+      stft2 = cf_stft_make( n, n/2, 5 );
+      cf_stft_set_thread_count( stft2, 3 );
+
+      for ( c=0; c<5; c++ )
+      {
+         samples[c] = random_samples_f( 2*n, 7u*c + i );
+         psd1[c] = ( float * ) calloc( n, sizeof( float ) );
+         psd2[c] = ( float * ) calloc( n, sizeof( float ) );
+         log_psd1[c] = ( float * ) calloc( n, sizeof( float ) );
+         log_psd2[c] = ( float * ) calloc( n, sizeof( float ) );
+         phase1[c] = ( float * ) calloc( n, sizeof( float ) );
+         phase2[c] = ( float * ) calloc( n, sizeof( float ) );
+      }
+
+      cf_stft_put( stft1, samples, 2*n );
+      cf_stft_put( stft2, samples, 2*n );
+
+      // threaded frames are the same as frames from one thread
+      flag = 1;
+      while ( cf_stft_is_frame_ready( stft1 ) == 1 )
+      {
+         cf_stft_next_frame( stft1, psd1, log_psd1, phase1 );
+         cf_stft_next_frame( stft2, psd2, log_psd2, phase2 );
+
+         for ( c=0; c<5; c++ )
+         {
+            if (
+                  ( memcmp( psd1[c], psd2[c], n*sizeof( float ) ) != 0 )
+                  || ( memcmp( log_psd1[c], log_psd2[c], n*sizeof( float ) ) != 0 )
+                  || ( memcmp( phase1[c], phase2[c], n*sizeof( float ) ) != 0 )
+               )
+            {
+               flag = 0;
+            }
+         }
+      }
+
+      CU_ASSERT( flag == 1 );
+      CU_ASSERT( cf_stft_is_frame_ready( stft2 ) == 0 );
+
+      cf_stft_dispose( &stft1 );
+      cf_stft_dispose( &stft2 );
+
+      for ( c=0; c<5; c++ )
+      {
+         free( samples[c] );
+         free( psd1[c] );
+         free( psd2[c] );
+         free( log_psd1[c] );
+         free( log_psd2[c] );
+         free( phase1[c] );
+         free( phase2[c] );
+      }
+   }
+
+   return;
+}
+
+/**
+   test_set_thread_count_4
+*/
+
+void test_set_thread_count_4( void )
+{
+   cd_stft_t *stft1 = NULL;
+   cd_stft_t *stft2 = NULL;
+   double *samples[5] = { NULL, NULL, NULL, NULL, NULL };
+   double *psd1[5] = { NULL, NULL, NULL, NULL, NULL };
+   double *psd2[5] = { NULL, NULL, NULL, NULL, NULL };
+   double *log_psd1[5] = { NULL, NULL, NULL, NULL, NULL };
+   double *log_psd2[5] = { NULL, NULL, NULL, NULL, NULL };
+   double *phase1[5] = { NULL, NULL, NULL, NULL, NULL };
+   double *phase2[5] = { NULL, NULL, NULL, NULL, NULL };
+   int32_t lengths[3] = { 64, 30, 7 };
+   int32_t n = 0;
+   int32_t i = 0;
+   int32_t c = 0;
+   int32_t flag = 1;
+
+   for ( i=0; i<3; i++ )
+   {
+      n = lengths[i];
+
+      stft1 = cd_stft_make( n, n/2, 5 );
+      stft2 = cd_stft_make( n, n/2, 5 );
+      cd_stft_set_thread_count( stft2, 3 );
+
+      for ( c=0; c<5; c++ )
+      {
+         samples[c] = random_samples_d( 2*n, 7u*c + i );
+         psd1[c] = ( double * ) calloc( n, sizeof( double ) );
+         psd2[c] = ( double * ) calloc( n, sizeof( double ) );
+         log_psd1[c] = ( double * ) calloc( n, sizeof( double ) );
+         log_psd2[c] = ( double * ) calloc( n, sizeof( double ) );
+         phase1[c] = ( double * ) calloc( n, sizeof( double ) );
+         phase2[c] = ( double * ) calloc( n, sizeof( double ) );
+      }
+
+      cd_stft_put( stft1, samples, 2*n );
+      cd_stft_put( stft2, samples, 2*n );
+
+      // threaded frames are the same as frames from one thread
+      flag = 1;
+      while ( cd_stft_is_frame_ready( stft1 ) == 1 )
+      {
+         cd_stft_next_frame( stft1, psd1, log_psd1, phase1 );
+         cd_stft_next_frame( stft2, psd2, log_psd2, phase2 );
+
+         for ( c=0; c<5; c++ )
+         {
+            if (
+                  ( memcmp( psd1[c], psd2[c], n*sizeof( double ) ) != 0 )
+                  || ( memcmp( log_psd1[c], log_psd2[c], n*sizeof( double ) ) != 0 )
+                  || ( memcmp( phase1[c], phase2[c], n*sizeof( double ) ) != 0 )
+               )
+            {
+               flag = 0;
+            }
+         }
+      }
+
+      CU_ASSERT( flag == 1 );
+      CU_ASSERT( cd_stft_is_frame_ready( stft2 ) == 0 );
+
+      cd_stft_dispose( &stft1 );
+      cd_stft_dispose( &stft2 );
+
+      for ( c=0; c<5; c++ )
+      {
+         free( samples[c] );
+         free( psd1[c] );
+         free( psd2[c] );
+         free( log_psd1[c] );
+         free( log_psd2[c] );
+         free( phase1[c] );
+         free( phase2[c] );
+      }
+   }
+
+   return;
+}
+
+int
+add_test_set_thread_count( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_set_thread_count", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_set_thread_count_1
+   add_test_to_suite( p_suite, test_set_thread_count_1, "test_set_thread_count_1" );
+
+   // test_set_thread_count_2
+   add_test_to_suite( p_suite, test_set_thread_count_2, "test_set_thread_count_2" );
+
+   // test_set_thread_count_3
+   add_test_to_suite( p_suite, test_set_thread_count_3, "test_set_thread_count_3" );
+
+   // test_set_thread_count_4
+   add_test_to_suite( p_suite, test_set_thread_count_4, "test_set_thread_count_4" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,165 @@
+/**
+ @file Stft_test_wipe_out.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Stft_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Stft_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+
+#include "cf_Stft.h"
+#include "cd_Stft.h"
+
+#include "Stft_utility.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_wipe_out_1
+*/
+
+void test_wipe_out_1( void )
+{
+   cf_stft_t *stft = NULL;
+   float *samples = NULL;
+   float *channels[1] = { NULL };
+   float *psd = NULL;
+   float *ref_psd = NULL;
+   float *ref_log_psd = NULL;
+   float *ref_phase = NULL;
+
+   stft = cf_stft_make( 16, 8, 1 );
+   samples = random_samples_f( 32, 12345u );
+   psd = ( float * ) calloc( 16, sizeof( float ) );
+   ref_psd = ( float * ) calloc( 16, sizeof( float ) );
+   ref_log_psd = ( float * ) calloc( 16, sizeof( float ) );
+   ref_phase = ( float * ) calloc( 16, sizeof( float ) );
+
+   channels[0] = samples;
+   cf_stft_put( stft, channels, 13 );
+
+   cf_stft_wipe_out( stft );
+
+   CU_ASSERT( cf_stft_count( stft ) == 0 );
+   CU_ASSERT( cf_stft_is_frame_ready( stft ) == 0 );
+
+   // samples put after a wipe out start a new frame
+   channels[0] = samples + 16;
+   cf_stft_put( stft, channels, 16 );
+   cf_stft_next_frame( stft, &psd, NULL, NULL );
+   reference_frame_f( samples + 16, 16, ref_psd, ref_log_psd, ref_phase );
+
+   CU_ASSERT( is_close_f( psd, ref_psd, 16, 0.0001 ) == 1 );
+
+   cf_stft_dispose( &stft );
+   free( samples );
+   free( psd );
+   free( ref_psd );
+   free( ref_log_psd );
+   free( ref_phase );
+
+   return;
+}
+
+/**
+   test_wipe_out_2
+*/
+
+void test_wipe_out_2( void )
+{
+   cd_stft_t *stft = NULL;
+   double *samples = NULL;
+   double *channels[1] = { NULL };
+   double *psd = NULL;
+   double *ref_psd = NULL;
+   double *ref_log_psd = NULL;
+   double *ref_phase = NULL;
+
+   stft = cd_stft_make( 16, 8, 1 );
+   samples = random_samples_d( 32, 12345u );
+   psd = ( double * ) calloc( 16, sizeof( double ) );
+   ref_psd = ( double * ) calloc( 16, sizeof( double ) );
+   ref_log_psd = ( double * ) calloc( 16, sizeof( double ) );
+   ref_phase = ( double * ) calloc( 16, sizeof( double ) );
+
+   channels[0] = samples;
+   cd_stft_put( stft, channels, 13 );
+
+   cd_stft_wipe_out( stft );
+
+   CU_ASSERT( cd_stft_count( stft ) == 0 );
+   CU_ASSERT( cd_stft_is_frame_ready( stft ) == 0 );
+
+   // samples put after a wipe out start a new frame
+   channels[0] = samples + 16;
+   cd_stft_put( stft, channels, 16 );
+   cd_stft_next_frame( stft, &psd, NULL, NULL );
+   reference_frame_d( samples + 16, 16, ref_psd, ref_log_psd, ref_phase );
+
+   CU_ASSERT( is_close_d( psd, ref_psd, 16, 0.0000001 ) == 1 );
+
+   cd_stft_dispose( &stft );
+   free( samples );
+   free( psd );
+   free( ref_psd );
+   free( ref_log_psd );
+   free( ref_phase );
+
+   return;
+}
+
+int
+add_test_wipe_out( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_wipe_out", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_wipe_out_1
+   add_test_to_suite( p_suite, test_wipe_out_1, "test_wipe_out_1" );
+
+   // test_wipe_out_2
+   add_test_to_suite( p_suite, test_wipe_out_2, "test_wipe_out_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
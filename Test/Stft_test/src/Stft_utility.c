@@ -0,0 +1,267 @@
+/**
+ @file Stft_utility.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "utilities for testing Stft_t"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Utilities for testing Stft_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "Stft_utility.h"
+#include "cf_Fft.h"
+#include "cd_Fft.h"
+#include "Rng_Isaac.h"
+
+/**
+   random_samples_f
+
+   pseudo random values in [-1, 1]
+*/
+
+float *
+random_samples_f( int32_t length, uint32_t seed )
+{
+   float *result = NULL;
+   int32_t i = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( seed );
+
+   result = ( float * ) calloc( length, sizeof( float ) );
+
+   for ( i=0; i<length; i++ )
+   {
+      result[i] = 2.0f*rng_isaac_f32_item( rng ) - 1.0f;
+      rng_isaac_forth( rng );
+   }
+
+   rng_isaac_dispose( &rng );
+
+   return result;
+}
+
+/**
+   reference_frame_f
+
+   psd, log psd and phase of a frame of samples from a cf_fft_t
+*/
+
+int32_t
+reference_frame_f( float *samples, int32_t length, float *psd, float *log_psd, float *phase )
+{
+   cf_fft_t *fft = NULL;
+   cf_matvec_t *v = NULL;
+   int32_t i = 0;
+
+   fft = cf_fft_make( length );
+   v = cf_matvec_make_column_vector( length );
+
+   for ( i=0; i<length; i++ )
+   {
+      cf_matvec_vector_put( v, samples[i], i );
+   }
+
+   cf_fft_set_input( fft, v );
+   cf_fft_fft( fft );
+
+   memcpy( psd, f_matvec_as_array( cf_fft_psd( fft ) ), length*sizeof( float ) );
+   memcpy( log_psd, f_matvec_as_array( cf_fft_log_psd( fft ) ), length*sizeof( float ) );
+   memcpy( phase, f_matvec_as_array( cf_fft_phase( fft ) ), length*sizeof( float ) );
+
+   cf_fft_deep_dispose( &fft );
+   cf_matvec_dispose( &v );
+
+   return 1;
+}
+
+/**
+   is_close_f
+
+   1 if the items of a and b are equal to within precision times the
+   larger magnitude, or precision when both are smaller than one
+*/
+
+int32_t
+is_close_f( float *a, float *b, int32_t length, float precision )
+{
+   int32_t result = 1;
+   int32_t i = 0;
+   float scale = 0.0;
+
+   for ( i=0; i<length; i++ )
+   {
+      scale = ( fabs( a[i] ) > fabs( b[i] ) ) ? fabs( a[i] ) : fabs( b[i] );
+      if ( scale < 1.0 )
+      {
+         scale = 1.0;
+      }
+
+      if ( fabs( a[i] - b[i] ) > precision*scale )
+      {
+         result = 0;
+      }
+   }
+
+   return result;
+}
+
+/**
+   is_phase_close_f
+
+   1 if the angles in a and b are equal to within precision, modulo 2 pi
+*/
+
+int32_t
+is_phase_close_f( float *a, float *b, int32_t length, float precision )
+{
+   int32_t result = 1;
+   int32_t i = 0;
+
+   for ( i=0; i<length; i++ )
+   {
+      if ( fabs( remainder( a[i] - b[i], 2.0*M_PI ) ) > precision )
+      {
+         result = 0;
+      }
+   }
+
+   return result;
+}
+
+/**
+   random_samples_d
+
+   pseudo random values in [-1, 1]
+*/
+
+double *
+random_samples_d( int32_t length, uint32_t seed )
+{
+   double *result = NULL;
+   int32_t i = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( seed );
+
+   result = ( double * ) calloc( length, sizeof( double ) );
+
+   rng_isaac_fill_f64( rng, result, length );
+
+   for ( i=0; i<length; i++ )
+   {
+      result[i] = 2.0*result[i] - 1.0;
+   }
+
+   rng_isaac_dispose( &rng );
+
+   return result;
+}
+
+/**
+   reference_frame_d
+
+   psd, log psd and phase of a frame of samples from a cd_fft_t
+*/
+
+int32_t
+reference_frame_d( double *samples, int32_t length, double *psd, double *log_psd, double *phase )
+{
+   cd_fft_t *fft = NULL;
+   cd_matvec_t *v = NULL;
+   int32_t i = 0;
+
+   fft = cd_fft_make( length );
+   v = cd_matvec_make_column_vector( length );
+
+   for ( i=0; i<length; i++ )
+   {
+      cd_matvec_vector_put( v, samples[i], i );
+   }
+
+   cd_fft_set_input( fft, v );
+   cd_fft_fft( fft );
+
+   memcpy( psd, d_matvec_as_array( cd_fft_psd( fft ) ), length*sizeof( double ) );
+   memcpy( log_psd, d_matvec_as_array( cd_fft_log_psd( fft ) ), length*sizeof( double ) );
+   memcpy( phase, d_matvec_as_array( cd_fft_phase( fft ) ), length*sizeof( double ) );
+
+   cd_fft_deep_dispose( &fft );
+   cd_matvec_dispose( &v );
+
+   return 1;
+}
+
+/**
+   is_close_d
+
+   1 if the items of a and b are equal to within precision times the
+   larger magnitude, or precision when both are smaller than one
+*/
+
+int32_t
+is_close_d( double *a, double *b, int32_t length, double precision )
+{
+   int32_t result = 1;
+   int32_t i = 0;
+   double scale = 0.0;
+
+   for ( i=0; i<length; i++ )
+   {
+      scale = ( fabs( a[i] ) > fabs( b[i] ) ) ? fabs( a[i] ) : fabs( b[i] );
+      if ( scale < 1.0 )
+      {
+         scale = 1.0;
+      }
+
+      if ( fabs( a[i] - b[i] ) > precision*scale )
+      {
+         result = 0;
+      }
+   }
+
+   return result;
+}
+
+/**
+   is_phase_close_d
+
+   1 if the angles in a and b are equal to within precision, modulo 2 pi
+*/
+
+int32_t
+is_phase_close_d( double *a, double *b, int32_t length, double precision )
+{
+   int32_t result = 1;
+   int32_t i = 0;
+
+   for ( i=0; i<length; i++ )
+   {
+      if ( fabs( remainder( a[i] - b[i], 2.0*M_PI ) ) > precision )
+      {
+         result = 0;
+      }
+   }
+
+   return result;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
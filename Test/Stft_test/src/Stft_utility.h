@@ -0,0 +1,61 @@
+/**
+ @file Stft_utility.h
+ @author Greg Lee
+ @version 0.0
+ @brief: "utilities for testing Stft"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Utilities for testing Stft_t.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+
+float *
+random_samples_f( int32_t length, uint32_t seed );
+
+int32_t
+reference_frame_f( float *samples, int32_t length, float *psd, float *log_psd, float *phase );
+
+int32_t
+is_close_f( float *a, float *b, int32_t length, float precision );
+
+int32_t
+is_phase_close_f( float *a, float *b, int32_t length, float precision );
+
+double *
+random_samples_d( int32_t length, uint32_t seed );
+
+int32_t
+reference_frame_d( double *samples, int32_t length, double *psd, double *log_psd, double *phase );
+
+int32_t
+is_close_d( double *a, double *b, int32_t length, double precision );
+
+int32_t
+is_phase_close_d( double *a, double *b, int32_t length, double precision );
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
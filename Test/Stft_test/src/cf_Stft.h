@@ -0,0 +1,58 @@
+/**
+ @file cf_Stft.h
+ @author Greg Lee
+ @version 0.0
+ @brief: "include file for stft of matrices of complex floats"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Defines to make a Stft into a cf_stft.
+
+*/
+
+#ifndef COMPLEX_FLOAT_STFT_H_
+#define COMPLEX_FLOAT_STFT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PROTOCOLS_ENABLED
+
+#include "base.h"
+#include "protocol.h"
+#include "f_Matvec.h"
+#include "cf_Fft.h"
+#include "cf_Matvec.h"
+#include <complex.h>
+
+#define Prefix cf
+#define Matvec_prefix cf
+#define Matvec_magnitude_prefix f
+#define Type complex float
+#define Magnitude_type float
+
+#include "Stft.h"
+
+#undef Prefix
+#undef Matvec_prefix
+#undef Matvec_magnitude_prefix
+#undef Type
+#undef Magnitude_type
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COMPLEX_FLOAT_STFT_H_ */
+
+/* End of file */
+
+
+
@@ -71,7 +71,7 @@ void test_extras_2( void )
    i = string_hash_code( string );
 
    CU_ASSERT( string != NULL );
-   CU_ASSERT( i == 1633837924 );
+   CU_ASSERT( i == 1382728611 );
 
    string_deep_dispose( &string );
 
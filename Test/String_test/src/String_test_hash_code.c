@@ -40,7 +40,7 @@ void test_hash_code_1( void )
    
    string = string_make_from_cstring( "A" );
    
-   CU_ASSERT( string_hash_code( string ) == 65 );
+   CU_ASSERT( string_hash_code( string ) == 1029007178 );
  
    string_deep_dispose( &string );
 
@@ -57,7 +57,7 @@ void test_hash_code_2( void )
    
    string = string_make_from_cstring( "123acb" );
    
-   CU_ASSERT( string_hash_code( string ) == 958742370 );
+   CU_ASSERT( string_hash_code( string ) == 1139192312 );
  
    string_deep_dispose( &string );
 
@@ -0,0 +1,126 @@
+/**
+ @file String_test_hash_code_64.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for string_hash_code_64"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for string_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "String.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_hash_code_64_1
+*/
+
+void test_hash_code_64_1( void )
+{
+   string_t *string = NULL;
+
+   string = string_make_from_cstring( "A" );
+
+   CU_ASSERT( string_hash_code_64( string ) == 8153392453017390198ULL );
+
+   string_deep_dispose( &string );
+
+   return;
+}
+
+/**
+   test_hash_code_64_2
+*/
+
+void test_hash_code_64_2( void )
+{
+   string_t *string = NULL;
+   string_t *string1 = NULL;
+
+   string = string_make_from_cstring( "0123456789abcdef0" );
+   string1 = string_make_from_cstring( "0123456789abcdef1" );
+
+   CU_ASSERT( string_hash_code_64( string ) == 18191082444834498672ULL );
+   CU_ASSERT( string_hash_code_64( string ) != string_hash_code_64( string1 ) );
+
+   string_deep_dispose( &string );
+   string_deep_dispose( &string1 );
+
+   return;
+}
+
+/**
+   test_hash_code_64_3
+*/
+
+void test_hash_code_64_3( void )
+{
+   string_t *string = NULL;
+   uint64_t h = 0;
+
+   string = string_make_from_cstring( "abc" );
+
+   h = string_hash_code_64( string );
+
+   string_append_cstring( string, "d" );
+
+   CU_ASSERT( string_hash_code_64( string ) != h );
+   CU_ASSERT( string_hash_code( string ) == 1382728611 );
+
+   string_deep_dispose( &string );
+
+   return;
+}
+
+int
+add_test_hash_code_64( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_hash_code_64", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_hash_code_64_1
+   add_test_to_suite( p_suite, test_hash_code_64_1, "test_hash_code_64_1" );
+
+   // test_hash_code_64_2
+   add_test_to_suite( p_suite, test_hash_code_64_2, "test_hash_code_64_2" );
+
+   // test_hash_code_64_3
+   add_test_to_suite( p_suite, test_hash_code_64_3, "test_hash_code_64_3" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
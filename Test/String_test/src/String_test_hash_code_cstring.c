@@ -0,0 +1,91 @@
+/**
+ @file String_test_hash_code_cstring.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for string_hash_code_cstring"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for string_t
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CUnit/Basic.h"
+
+#include "String.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_hash_code_cstring_1
+*/
+
+void test_hash_code_cstring_1( void )
+{
+   CU_ASSERT( string_hash_code_cstring( "A" ) == 1029007178 );
+
+   return;
+}
+
+/**
+   test_hash_code_cstring_2
+*/
+
+void test_hash_code_cstring_2( void )
+{
+   string_t *string = NULL;
+
+   string = string_make_from_cstring( "hello world, this is a longer string of 60 chars or so!!!!" );
+
+   CU_ASSERT( string_hash_code_cstring( "hello world, this is a longer string of 60 chars or so!!!!" ) == string_hash_code( string ) );
+   CU_ASSERT( string_hash_code_cstring( "" ) >= 0 );
+
+   string_deep_dispose( &string );
+
+   return;
+}
+
+int
+add_test_hash_code_cstring( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_hash_code_cstring", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_hash_code_cstring_1
+   add_test_to_suite( p_suite, test_hash_code_cstring_1, "test_hash_code_cstring_1" );
+
+   // test_hash_code_cstring_2
+   add_test_to_suite( p_suite, test_hash_code_cstring_2, "test_hash_code_cstring_2" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
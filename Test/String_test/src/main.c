@@ -62,6 +62,15 @@ add_test_is_float64( void );
 int
 add_test_hash_code( void );
 
+int
+add_test_hash_code_64( void );
+
+int
+add_test_hash_code_cstring( void );
+
+int
+add_test_hash_code_64_cstring( void );
+
 int
 add_test_is_equal( void );
 
@@ -386,6 +395,9 @@ int main()
    add_test_is_int32();
    add_test_is_float64();
    add_test_hash_code();
+   add_test_hash_code_64();
+   add_test_hash_code_cstring();
+   add_test_hash_code_64_cstring();
    add_test_is_equal();
    add_test_is_deep_equal();
    add_test_is_equal_cstring();
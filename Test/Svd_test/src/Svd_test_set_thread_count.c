@@ -0,0 +1,234 @@
+/**
+ @file Svd_test_set_thread_count.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Svd_set_thread_count"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Svd_set_thread_count.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "CUnit/Basic.h"
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+
+#include "f_Svd.h"
+#include "d_Svd.h"
+#include "cf_Svd.h"
+#include "cd_Svd.h"
+
+#include "Svd_utility.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_set_thread_count_1
+*/
+
+void test_set_thread_count_1( void )
+{
+   d_svd_t *dsvd = NULL;
+
+   dsvd = d_svd_make();
+
+   CU_ASSERT( d_svd_thread_count( dsvd ) == 1 );
+
+   d_svd_set_thread_count( dsvd, 4 );
+
+   CU_ASSERT( d_svd_thread_count( dsvd ) == 4 );
+
+   d_svd_set_thread_count( dsvd, 1 );
+
+   CU_ASSERT( d_svd_thread_count( dsvd ) == 1 );
+
+   d_svd_deep_dispose( &dsvd );
+
+   return;
+}
+
+/**
+   test_set_thread_count_2
+*/
+
+void test_set_thread_count_2( void )
+{
+   d_svd_t *svd1 = NULL;
+   d_svd_t *svd2 = NULL;
+   d_matvec_t *m = NULL;
+   d_matvec_t *x1 = NULL;
+   d_matvec_t *x2 = NULL;
+   int32_t size = sizeof( d_matvec_as_array( m )[0] );
+
+   // tall input of four blocks, the same result on any number of threads
+   m = random_matrix_d( 70, 50, 21u );
+
+   svd1 = d_svd_make();
+   d_svd_set_input( svd1, d_matvec_copied( m ) );
+   d_svd_svd( svd1 );
+
+   svd2 = d_svd_make();
+   d_svd_set_thread_count( svd2, 3 );
+   d_svd_set_input( svd2, m );
+   d_svd_svd( svd2 );
+
+   x1 = d_svd_singular_values( svd1 );
+   x2 = d_svd_singular_values( svd2 );
+   CU_ASSERT( memcmp( d_matvec_as_array( x1 ), d_matvec_as_array( x2 ), d_matvec_vector_length( x1 )*size ) == 0 );
+
+   x1 = d_svd_left_singular_vectors( svd1 );
+   x2 = d_svd_left_singular_vectors( svd2 );
+   CU_ASSERT( memcmp( d_matvec_as_array( x1 ), d_matvec_as_array( x2 ), d_matvec_rows( x1 )*d_matvec_columns( x1 )*size ) == 0 );
+
+   x1 = d_svd_right_singular_vectors( svd1 );
+   x2 = d_svd_right_singular_vectors( svd2 );
+   CU_ASSERT( memcmp( d_matvec_as_array( x1 ), d_matvec_as_array( x2 ), d_matvec_rows( x1 )*d_matvec_columns( x1 )*size ) == 0 );
+
+   d_svd_deep_dispose( &svd1 );
+   d_svd_deep_dispose( &svd2 );
+
+   return;
+}
+
+/**
+   test_set_thread_count_3
+*/
+
+void test_set_thread_count_3( void )
+{
+   cd_svd_t *svd1 = NULL;
+   cd_svd_t *svd2 = NULL;
+   cd_matvec_t *m = NULL;
+   cd_matvec_t *x1 = NULL;
+   cd_matvec_t *x2 = NULL;
+   int32_t size = sizeof( cd_matvec_as_array( m )[0] );
+
+   // wide input of three blocks, the same result on any number of threads
+   m = random_matrix_cd( 40, 90, 22u );
+
+   svd1 = cd_svd_make();
+   cd_svd_set_input( svd1, cd_matvec_copied( m ) );
+   cd_svd_svd( svd1 );
+
+   svd2 = cd_svd_make();
+   cd_svd_set_thread_count( svd2, 3 );
+   cd_svd_set_input( svd2, m );
+   cd_svd_svd( svd2 );
+
+   x1 = cd_svd_singular_values( svd1 );
+   x2 = cd_svd_singular_values( svd2 );
+   CU_ASSERT( memcmp( cd_matvec_as_array( x1 ), cd_matvec_as_array( x2 ), cd_matvec_vector_length( x1 )*size ) == 0 );
+
+   x1 = cd_svd_left_singular_vectors( svd1 );
+   x2 = cd_svd_left_singular_vectors( svd2 );
+   CU_ASSERT( memcmp( cd_matvec_as_array( x1 ), cd_matvec_as_array( x2 ), cd_matvec_rows( x1 )*cd_matvec_columns( x1 )*size ) == 0 );
+
+   x1 = cd_svd_right_singular_vectors( svd1 );
+   x2 = cd_svd_right_singular_vectors( svd2 );
+   CU_ASSERT( memcmp( cd_matvec_as_array( x1 ), cd_matvec_as_array( x2 ), cd_matvec_rows( x1 )*cd_matvec_columns( x1 )*size ) == 0 );
+
+   cd_svd_deep_dispose( &svd1 );
+   cd_svd_deep_dispose( &svd2 );
+
+   return;
+}
+
+/**
+   test_set_thread_count_4
+*/
+
+void test_set_thread_count_4( void )
+{
+   d_svd_t *svd1 = NULL;
+   d_svd_t *svd2 = NULL;
+   d_matvec_t *m = NULL;
+   d_matvec_t *x1 = NULL;
+   d_matvec_t *x2 = NULL;
+   int32_t size = sizeof( d_matvec_as_array( m )[0] );
+
+   // tall input of five blocks, the same result on any number of threads
+   m = random_matrix_d( 200, 70, 23u );
+
+   svd1 = d_svd_make();
+   d_svd_set_input( svd1, d_matvec_copied( m ) );
+   d_svd_svd( svd1 );
+
+   svd2 = d_svd_make();
+   d_svd_set_thread_count( svd2, 3 );
+   d_svd_set_input( svd2, m );
+   d_svd_svd( svd2 );
+
+   x1 = d_svd_singular_values( svd1 );
+   x2 = d_svd_singular_values( svd2 );
+   CU_ASSERT( memcmp( d_matvec_as_array( x1 ), d_matvec_as_array( x2 ), d_matvec_vector_length( x1 )*size ) == 0 );
+
+   x1 = d_svd_left_singular_vectors( svd1 );
+   x2 = d_svd_left_singular_vectors( svd2 );
+   CU_ASSERT( memcmp( d_matvec_as_array( x1 ), d_matvec_as_array( x2 ), d_matvec_rows( x1 )*d_matvec_columns( x1 )*size ) == 0 );
+
+   x1 = d_svd_right_singular_vectors( svd1 );
+   x2 = d_svd_right_singular_vectors( svd2 );
+   CU_ASSERT( memcmp( d_matvec_as_array( x1 ), d_matvec_as_array( x2 ), d_matvec_rows( x1 )*d_matvec_columns( x1 )*size ) == 0 );
+
+   d_svd_deep_dispose( &svd1 );
+   d_svd_deep_dispose( &svd2 );
+
+   return;
+}
+
+int
+add_test_set_thread_count( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_set_thread_count", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_set_thread_count_1
+   add_test_to_suite( p_suite, test_set_thread_count_1, "test_set_thread_count_1" );
+
+   // test_set_thread_count_2
+   add_test_to_suite( p_suite, test_set_thread_count_2, "test_set_thread_count_2" );
+
+   // test_set_thread_count_3
+   add_test_to_suite( p_suite, test_set_thread_count_3, "test_set_thread_count_3" );
+
+   // test_set_thread_count_4
+   add_test_to_suite( p_suite, test_set_thread_count_4, "test_set_thread_count_4" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -0,0 +1,482 @@
+/**
+ @file Svd_test_set_truncation.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "tests for Svd_set_truncation"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Unit tests for Svd_set_truncation.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "CUnit/Basic.h"
+
+#include "f_Matvec.h"
+#include "d_Matvec.h"
+#include "cf_Matvec.h"
+#include "cd_Matvec.h"
+
+#include "f_Svd.h"
+#include "d_Svd.h"
+#include "cf_Svd.h"
+#include "cd_Svd.h"
+
+#include "Svd_utility.h"
+#include "Rng_Isaac.h"
+
+int
+add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
+
+/**
+   test_set_truncation_1
+*/
+
+void test_set_truncation_1( void )
+{
+   d_svd_t *dsvd = NULL;
+
+   dsvd = d_svd_make();
+
+   CU_ASSERT( d_svd_truncation( dsvd ) == 0 );
+
+   d_svd_set_truncation( dsvd, 5 );
+
+   CU_ASSERT( d_svd_truncation( dsvd ) == 5 );
+
+   d_svd_set_truncation( dsvd, 0 );
+
+   CU_ASSERT( d_svd_truncation( dsvd ) == 0 );
+
+   d_svd_deep_dispose( &dsvd );
+
+   return;
+}
+
+/**
+   test_set_truncation_2
+*/
+
+void test_set_truncation_2( void )
+{
+   d_svd_t *svd1 = NULL;
+   d_svd_t *svd2 = NULL;
+   d_matvec_t *m = NULL;
+   d_matvec_t *sv1 = NULL;
+   d_matvec_t *sv2 = NULL;
+   int32_t i = 0;
+   int32_t flag = 1;
+
+   // tall input, truncated by subspace iteration, singular values decaying
+   m = random_matrix_d( 120, 80, 11u );
+   for ( i=0; i<80; i++ )
+   {
+      d_matvec_column_vector_scale( m, pow( 0.9, i ), i );
+   }
+
+   svd1 = d_svd_make();
+   d_svd_set_rotation_error( svd1, 1.0e-10 );
+   d_svd_set_input( svd1, d_matvec_copied( m ) );
+   d_svd_svd( svd1 );
+
+   svd2 = d_svd_make();
+   d_svd_set_rotation_error( svd2, 1.0e-10 );
+   d_svd_set_truncation( svd2, 5 );
+   d_svd_set_input( svd2, m );
+   d_svd_svd( svd2 );
+
+   sv1 = d_svd_singular_values( svd1 );
+   sv2 = d_svd_singular_values( svd2 );
+
+   CU_ASSERT( d_matvec_vector_length( sv2 ) == 5 );
+   CU_ASSERT( d_matvec_rows( d_svd_left_singular_vectors( svd2 ) ) == 120 );
+   CU_ASSERT( d_matvec_columns( d_svd_left_singular_vectors( svd2 ) ) == 5 );
+   CU_ASSERT( d_matvec_rows( d_svd_right_singular_vectors( svd2 ) ) == 80 );
+   CU_ASSERT( d_matvec_columns( d_svd_right_singular_vectors( svd2 ) ) == 5 );
+
+   for ( i=0; i<5; i++ )
+   {
+      if (
+            cabs( d_matvec_vector_item( sv1, i ) - d_matvec_vector_item( sv2, i ) )
+            > 0.000001*cabs( d_matvec_vector_item( sv1, 0 ) )
+         )
+      {
+         flag = 0;
+      }
+   }
+
+   CU_ASSERT( flag == 1 );
+   CU_ASSERT( is_same_directions_d( d_svd_left_singular_vectors( svd2 ), d_svd_left_singular_vectors( svd1 ), 1, 5, 0.000001 ) == 1 );
+   CU_ASSERT( is_same_directions_d( d_svd_right_singular_vectors( svd2 ), d_svd_right_singular_vectors( svd1 ), 1, 5, 0.000001 ) == 1 );
+
+   d_svd_deep_dispose( &svd1 );
+   d_svd_deep_dispose( &svd2 );
+
+   return;
+}
+
+/**
+   test_set_truncation_3
+*/
+
+void test_set_truncation_3( void )
+{
+   cd_svd_t *svd1 = NULL;
+   cd_svd_t *svd2 = NULL;
+   cd_matvec_t *m = NULL;
+   cd_matvec_t *sv1 = NULL;
+   cd_matvec_t *sv2 = NULL;
+   int32_t i = 0;
+   int32_t flag = 1;
+
+   // tall input, truncated by subspace iteration, singular values decaying
+   m = random_matrix_cd( 100, 64, 12u );
+   for ( i=0; i<64; i++ )
+   {
+      cd_matvec_column_vector_scale( m, pow( 0.9, i ), i );
+   }
+
+   svd1 = cd_svd_make();
+   cd_svd_set_rotation_error( svd1, 1.0e-10 );
+   cd_svd_set_input( svd1, cd_matvec_copied( m ) );
+   cd_svd_svd( svd1 );
+
+   svd2 = cd_svd_make();
+   cd_svd_set_rotation_error( svd2, 1.0e-10 );
+   cd_svd_set_truncation( svd2, 4 );
+   cd_svd_set_input( svd2, m );
+   cd_svd_svd( svd2 );
+
+   sv1 = cd_svd_singular_values( svd1 );
+   sv2 = cd_svd_singular_values( svd2 );
+
+   CU_ASSERT( cd_matvec_vector_length( sv2 ) == 4 );
+   CU_ASSERT( cd_matvec_rows( cd_svd_left_singular_vectors( svd2 ) ) == 100 );
+   CU_ASSERT( cd_matvec_columns( cd_svd_left_singular_vectors( svd2 ) ) == 4 );
+   CU_ASSERT( cd_matvec_rows( cd_svd_right_singular_vectors( svd2 ) ) == 64 );
+   CU_ASSERT( cd_matvec_columns( cd_svd_right_singular_vectors( svd2 ) ) == 4 );
+
+   for ( i=0; i<4; i++ )
+   {
+      if (
+            cabs( cd_matvec_vector_item( sv1, i ) - cd_matvec_vector_item( sv2, i ) )
+            > 0.000001*cabs( cd_matvec_vector_item( sv1, 0 ) )
+         )
+      {
+         flag = 0;
+      }
+   }
+
+   CU_ASSERT( flag == 1 );
+   CU_ASSERT( is_same_directions_cd( cd_svd_left_singular_vectors( svd2 ), cd_svd_left_singular_vectors( svd1 ), 1, 4, 0.000001 ) == 1 );
+   CU_ASSERT( is_same_directions_cd( cd_svd_right_singular_vectors( svd2 ), cd_svd_right_singular_vectors( svd1 ), 1, 4, 0.000001 ) == 1 );
+
+   cd_svd_deep_dispose( &svd1 );
+   cd_svd_deep_dispose( &svd2 );
+
+   return;
+}
+
+/**
+   test_set_truncation_4
+*/
+
+void test_set_truncation_4( void )
+{
+   d_svd_t *svd1 = NULL;
+   d_svd_t *svd2 = NULL;
+   d_matvec_t *m = NULL;
+   d_matvec_t *sv1 = NULL;
+   d_matvec_t *sv2 = NULL;
+   int32_t i = 0;
+   int32_t flag = 1;
+
+   // wide input, truncated by subspace iteration, singular values decaying
+   m = random_matrix_d( 60, 150, 13u );
+   for ( i=0; i<150; i++ )
+   {
+      d_matvec_column_vector_scale( m, pow( 0.9, i ), i );
+   }
+
+   svd1 = d_svd_make();
+   d_svd_set_rotation_error( svd1, 1.0e-10 );
+   d_svd_set_input( svd1, d_matvec_copied( m ) );
+   d_svd_svd( svd1 );
+
+   svd2 = d_svd_make();
+   d_svd_set_rotation_error( svd2, 1.0e-10 );
+   d_svd_set_truncation( svd2, 4 );
+   d_svd_set_input( svd2, m );
+   d_svd_svd( svd2 );
+
+   sv1 = d_svd_singular_values( svd1 );
+   sv2 = d_svd_singular_values( svd2 );
+
+   CU_ASSERT( d_matvec_vector_length( sv2 ) == 4 );
+   CU_ASSERT( d_matvec_rows( d_svd_left_singular_vectors( svd2 ) ) == 4 );
+   CU_ASSERT( d_matvec_columns( d_svd_left_singular_vectors( svd2 ) ) == 60 );
+   CU_ASSERT( d_matvec_rows( d_svd_right_singular_vectors( svd2 ) ) == 4 );
+   CU_ASSERT( d_matvec_columns( d_svd_right_singular_vectors( svd2 ) ) == 150 );
+
+   for ( i=0; i<4; i++ )
+   {
+      if (
+            cabs( d_matvec_vector_item( sv1, i ) - d_matvec_vector_item( sv2, i ) )
+            > 0.000001*cabs( d_matvec_vector_item( sv1, 0 ) )
+         )
+      {
+         flag = 0;
+      }
+   }
+
+   CU_ASSERT( flag == 1 );
+   CU_ASSERT( is_same_directions_d( d_svd_left_singular_vectors( svd2 ), d_svd_left_singular_vectors( svd1 ), 0, 4, 0.000001 ) == 1 );
+   CU_ASSERT( is_same_directions_d( d_svd_right_singular_vectors( svd2 ), d_svd_right_singular_vectors( svd1 ), 0, 4, 0.000001 ) == 1 );
+
+   d_svd_deep_dispose( &svd1 );
+   d_svd_deep_dispose( &svd2 );
+
+   return;
+}
+
+/**
+   test_set_truncation_5
+*/
+
+void test_set_truncation_5( void )
+{
+   cd_svd_t *svd1 = NULL;
+   cd_svd_t *svd2 = NULL;
+   cd_matvec_t *m = NULL;
+   cd_matvec_t *sv1 = NULL;
+   cd_matvec_t *sv2 = NULL;
+   int32_t i = 0;
+   int32_t flag = 1;
+
+   // wide input, truncated by subspace iteration, singular values decaying
+   m = random_matrix_cd( 48, 100, 14u );
+   for ( i=0; i<100; i++ )
+   {
+      cd_matvec_column_vector_scale( m, pow( 0.9, i ), i );
+   }
+
+   svd1 = cd_svd_make();
+   cd_svd_set_rotation_error( svd1, 1.0e-10 );
+   cd_svd_set_input( svd1, cd_matvec_copied( m ) );
+   cd_svd_svd( svd1 );
+
+   svd2 = cd_svd_make();
+   cd_svd_set_rotation_error( svd2, 1.0e-10 );
+   cd_svd_set_truncation( svd2, 3 );
+   cd_svd_set_input( svd2, m );
+   cd_svd_svd( svd2 );
+
+   sv1 = cd_svd_singular_values( svd1 );
+   sv2 = cd_svd_singular_values( svd2 );
+
+   CU_ASSERT( cd_matvec_vector_length( sv2 ) == 3 );
+   CU_ASSERT( cd_matvec_rows( cd_svd_left_singular_vectors( svd2 ) ) == 3 );
+   CU_ASSERT( cd_matvec_columns( cd_svd_left_singular_vectors( svd2 ) ) == 48 );
+   CU_ASSERT( cd_matvec_rows( cd_svd_right_singular_vectors( svd2 ) ) == 3 );
+   CU_ASSERT( cd_matvec_columns( cd_svd_right_singular_vectors( svd2 ) ) == 100 );
+
+   for ( i=0; i<3; i++ )
+   {
+      if (
+            cabs( cd_matvec_vector_item( sv1, i ) - cd_matvec_vector_item( sv2, i ) )
+            > 0.000001*cabs( cd_matvec_vector_item( sv1, 0 ) )
+         )
+      {
+         flag = 0;
+      }
+   }
+
+   CU_ASSERT( flag == 1 );
+   CU_ASSERT( is_same_directions_cd( cd_svd_left_singular_vectors( svd2 ), cd_svd_left_singular_vectors( svd1 ), 0, 3, 0.000001 ) == 1 );
+   CU_ASSERT( is_same_directions_cd( cd_svd_right_singular_vectors( svd2 ), cd_svd_right_singular_vectors( svd1 ), 0, 3, 0.000001 ) == 1 );
+
+   cd_svd_deep_dispose( &svd1 );
+   cd_svd_deep_dispose( &svd2 );
+
+   return;
+}
+
+/**
+   test_set_truncation_6
+*/
+
+void test_set_truncation_6( void )
+{
+   d_svd_t *svd1 = NULL;
+   d_svd_t *svd2 = NULL;
+   d_matvec_t *m = NULL;
+   d_matvec_t *sv1 = NULL;
+   d_matvec_t *sv2 = NULL;
+   int32_t i = 0;
+   int32_t flag = 1;
+
+   // truncated after a full decomposition, singular values decaying
+   m = random_matrix_d( 30, 20, 15u );
+   for ( i=0; i<20; i++ )
+   {
+      d_matvec_column_vector_scale( m, pow( 0.9, i ), i );
+   }
+
+   svd1 = d_svd_make();
+   d_svd_set_rotation_error( svd1, 1.0e-10 );
+   d_svd_set_input( svd1, d_matvec_copied( m ) );
+   d_svd_svd( svd1 );
+
+   svd2 = d_svd_make();
+   d_svd_set_rotation_error( svd2, 1.0e-10 );
+   d_svd_set_truncation( svd2, 12 );
+   d_svd_set_input( svd2, m );
+   d_svd_svd( svd2 );
+
+   sv1 = d_svd_singular_values( svd1 );
+   sv2 = d_svd_singular_values( svd2 );
+
+   CU_ASSERT( d_matvec_vector_length( sv2 ) == 12 );
+   CU_ASSERT( d_matvec_rows( d_svd_left_singular_vectors( svd2 ) ) == 30 );
+   CU_ASSERT( d_matvec_columns( d_svd_left_singular_vectors( svd2 ) ) == 12 );
+   CU_ASSERT( d_matvec_rows( d_svd_right_singular_vectors( svd2 ) ) == 20 );
+   CU_ASSERT( d_matvec_columns( d_svd_right_singular_vectors( svd2 ) ) == 12 );
+
+   for ( i=0; i<12; i++ )
+   {
+      if (
+            cabs( d_matvec_vector_item( sv1, i ) - d_matvec_vector_item( sv2, i ) )
+            > 0.000001*cabs( d_matvec_vector_item( sv1, 0 ) )
+         )
+      {
+         flag = 0;
+      }
+   }
+
+   CU_ASSERT( flag == 1 );
+   CU_ASSERT( is_same_directions_d( d_svd_left_singular_vectors( svd2 ), d_svd_left_singular_vectors( svd1 ), 1, 12, 0.000001 ) == 1 );
+   CU_ASSERT( is_same_directions_d( d_svd_right_singular_vectors( svd2 ), d_svd_right_singular_vectors( svd1 ), 1, 12, 0.000001 ) == 1 );
+
+   d_svd_deep_dispose( &svd1 );
+   d_svd_deep_dispose( &svd2 );
+
+   return;
+}
+
+/**
+   test_set_truncation_7
+*/
+
+void test_set_truncation_7( void )
+{
+   f_svd_t *svd1 = NULL;
+   f_svd_t *svd2 = NULL;
+   f_matvec_t *m = NULL;
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t flag = 1;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( 16 );
+
+   // float input, truncated by subspace iteration
+   m = f_matvec_make( 100, 60 );
+   for ( i=0; i<100; i++ )
+   {
+      for ( j=0; j<60; j++ )
+      {
+         f_matvec_put( m, ( 2.0*rng_isaac_f32_item( rng ) - 1.0 )*pow( 0.9, j ), i, j );
+         rng_isaac_forth( rng );
+      }
+   }
+
+   svd1 = f_svd_make();
+   f_svd_set_input( svd1, f_matvec_copied( m ) );
+   f_svd_svd( svd1 );
+
+   svd2 = f_svd_make();
+   f_svd_set_truncation( svd2, 3 );
+   f_svd_set_input( svd2, m );
+   f_svd_svd( svd2 );
+
+   CU_ASSERT( f_matvec_vector_length( f_svd_singular_values( svd2 ) ) == 3 );
+
+   for ( i=0; i<3; i++ )
+   {
+      if (
+            fabs( f_matvec_vector_item( f_svd_singular_values( svd1 ), i ) - f_matvec_vector_item( f_svd_singular_values( svd2 ), i ) )
+            > 0.001*f_matvec_vector_item( f_svd_singular_values( svd1 ), 0 )
+         )
+      {
+         flag = 0;
+      }
+   }
+
+   CU_ASSERT( flag == 1 );
+
+   f_svd_deep_dispose( &svd1 );
+   f_svd_deep_dispose( &svd2 );
+
+   rng_isaac_dispose( &rng );
+
+   return;
+}
+
+int
+add_test_set_truncation( void )
+{
+   CU_pSuite p_suite = NULL;
+
+   // add a suite for these tests to the registry
+   p_suite = CU_add_suite("suite_test_set_truncation", NULL, NULL);
+   if (NULL == p_suite)
+   {
+      CU_cleanup_registry();
+      return CU_get_error();
+   }
+
+   // add the tests to the suite
+
+   // test_set_truncation_1
+   add_test_to_suite( p_suite, test_set_truncation_1, "test_set_truncation_1" );
+
+   // test_set_truncation_2
+   add_test_to_suite( p_suite, test_set_truncation_2, "test_set_truncation_2" );
+
+   // test_set_truncation_3
+   add_test_to_suite( p_suite, test_set_truncation_3, "test_set_truncation_3" );
+
+   // test_set_truncation_4
+   add_test_to_suite( p_suite, test_set_truncation_4, "test_set_truncation_4" );
+
+   // test_set_truncation_5
+   add_test_to_suite( p_suite, test_set_truncation_5, "test_set_truncation_5" );
+
+   // test_set_truncation_6
+   add_test_to_suite( p_suite, test_set_truncation_6, "test_set_truncation_6" );
+
+   // test_set_truncation_7
+   add_test_to_suite( p_suite, test_set_truncation_7, "test_set_truncation_7" );
+
+   return CUE_SUCCESS;
+
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
@@ -35,6 +35,8 @@ extern "C" {
 #include "cf_Svd.h"
 #include "cd_Svd.h"
 
+#include "Svd_utility.h"
+
 int
 add_test_to_suite( CU_pSuite p_suite, CU_TestFunc test, char *name );
 
@@ -1213,6 +1215,130 @@ void test_svd_4b( void )
    return;
 }
 
+/**
+   test_svd_5
+*/
+
+void test_svd_5( void )
+{
+   d_svd_t *dsvd = NULL;
+   d_matvec_t *m = NULL;
+   d_matvec_t *m1 = NULL;
+
+   // more vectors than a block, odd block count
+   dsvd = d_svd_make();
+   d_svd_set_rotation_error( dsvd, 1.0e-14 );
+   m = random_matrix_d( 50, 37, 1u );
+   d_svd_set_input( dsvd, m );
+   d_svd_svd( dsvd );
+
+   m1 = d_svd_reconstructed_input( dsvd );
+
+   CU_ASSERT( d_matvec_vector_length( d_svd_singular_values( dsvd ) ) == 37 );
+   CU_ASSERT( d_matvec_is_approximately_equal( m1, m, 0.000001 ) == 1 );
+   CU_ASSERT( is_decreasing_d( d_svd_singular_values( dsvd ) ) == 1 );
+   CU_ASSERT( is_orthonormal_d( d_svd_left_singular_vectors( dsvd ), 1, 0.000001 ) == 1 );
+   CU_ASSERT( is_orthonormal_d( d_svd_right_singular_vectors( dsvd ), 1, 0.000001 ) == 1 );
+
+   d_svd_deep_dispose( &dsvd );
+   d_matvec_dispose( &m1 );
+
+   return;
+}
+
+/**
+   test_svd_5a
+*/
+
+void test_svd_5a( void )
+{
+   cd_svd_t *cdsvd = NULL;
+   cd_matvec_t *m = NULL;
+   cd_matvec_t *m1 = NULL;
+
+   // more vectors than a block, odd block count
+   cdsvd = cd_svd_make();
+   cd_svd_set_rotation_error( cdsvd, 1.0e-14 );
+   m = random_matrix_cd( 50, 37, 2u );
+   cd_svd_set_input( cdsvd, m );
+   cd_svd_svd( cdsvd );
+
+   m1 = cd_svd_reconstructed_input( cdsvd );
+
+   CU_ASSERT( cd_matvec_vector_length( cd_svd_singular_values( cdsvd ) ) == 37 );
+   CU_ASSERT( cd_matvec_is_approximately_equal( m1, m, 0.000001 ) == 1 );
+   CU_ASSERT( is_decreasing_cd( cd_svd_singular_values( cdsvd ) ) == 1 );
+   CU_ASSERT( is_orthonormal_cd( cd_svd_left_singular_vectors( cdsvd ), 1, 0.000001 ) == 1 );
+   CU_ASSERT( is_orthonormal_cd( cd_svd_right_singular_vectors( cdsvd ), 1, 0.000001 ) == 1 );
+
+   cd_svd_deep_dispose( &cdsvd );
+   cd_matvec_dispose( &m1 );
+
+   return;
+}
+
+/**
+   test_svd_6
+*/
+
+void test_svd_6( void )
+{
+   d_svd_t *dsvd = NULL;
+   d_matvec_t *m = NULL;
+   d_matvec_t *m1 = NULL;
+
+   // more vectors than a block, odd block count
+   dsvd = d_svd_make();
+   d_svd_set_rotation_error( dsvd, 1.0e-14 );
+   m = random_matrix_d( 20, 45, 3u );
+   d_svd_set_input( dsvd, m );
+   d_svd_svd( dsvd );
+
+   m1 = d_svd_reconstructed_input( dsvd );
+
+   CU_ASSERT( d_matvec_vector_length( d_svd_singular_values( dsvd ) ) == 20 );
+   CU_ASSERT( d_matvec_is_approximately_equal( m1, m, 0.000001 ) == 1 );
+   CU_ASSERT( is_decreasing_d( d_svd_singular_values( dsvd ) ) == 1 );
+   CU_ASSERT( is_orthonormal_d( d_svd_left_singular_vectors( dsvd ), 0, 0.000001 ) == 1 );
+   CU_ASSERT( is_orthonormal_d( d_svd_right_singular_vectors( dsvd ), 0, 0.000001 ) == 1 );
+
+   d_svd_deep_dispose( &dsvd );
+   d_matvec_dispose( &m1 );
+
+   return;
+}
+
+/**
+   test_svd_6a
+*/
+
+void test_svd_6a( void )
+{
+   cd_svd_t *cdsvd = NULL;
+   cd_matvec_t *m = NULL;
+   cd_matvec_t *m1 = NULL;
+
+   // more vectors than a block, odd block count
+   cdsvd = cd_svd_make();
+   cd_svd_set_rotation_error( cdsvd, 1.0e-14 );
+   m = random_matrix_cd( 20, 45, 4u );
+   cd_svd_set_input( cdsvd, m );
+   cd_svd_svd( cdsvd );
+
+   m1 = cd_svd_reconstructed_input( cdsvd );
+
+   CU_ASSERT( cd_matvec_vector_length( cd_svd_singular_values( cdsvd ) ) == 20 );
+   CU_ASSERT( cd_matvec_is_approximately_equal( m1, m, 0.000001 ) == 1 );
+   CU_ASSERT( is_decreasing_cd( cd_svd_singular_values( cdsvd ) ) == 1 );
+   CU_ASSERT( is_orthonormal_cd( cd_svd_left_singular_vectors( cdsvd ), 0, 0.000001 ) == 1 );
+   CU_ASSERT( is_orthonormal_cd( cd_svd_right_singular_vectors( cdsvd ), 0, 0.000001 ) == 1 );
+
+   cd_svd_deep_dispose( &cdsvd );
+   cd_matvec_dispose( &m1 );
+
+   return;
+}
+
 int
 add_test_svd( void )
 {
@@ -1267,6 +1393,18 @@ add_test_svd( void )
    // test_svd_4b
    add_test_to_suite( p_suite, test_svd_4b, "test_svd_4b" );
 
+   // test_svd_5
+   add_test_to_suite( p_suite, test_svd_5, "test_svd_5" );
+
+   // test_svd_5a
+   add_test_to_suite( p_suite, test_svd_5a, "test_svd_5a" );
+
+   // test_svd_6
+   add_test_to_suite( p_suite, test_svd_6, "test_svd_6" );
+
+   // test_svd_6a
+   add_test_to_suite( p_suite, test_svd_6a, "test_svd_6a" );
+
    return CUE_SUCCESS;
 
 }
@@ -0,0 +1,342 @@
+/**
+ @file Svd_utility.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "utilities for testing Svd"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Utilities for testing Svd_t.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "Svd_utility.h"
+#include "Rng_Isaac.h"
+
+/**
+   random_matrix_d
+
+   matrix of pseudo random values in [-1, 1]
+*/
+
+d_matvec_t *
+random_matrix_d( int32_t rows, int32_t columns, uint32_t seed )
+{
+   d_matvec_t *result = NULL;
+   double *pa = NULL;
+   int32_t i = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( seed );
+
+   result = d_matvec_make( rows, columns );
+   pa = d_matvec_as_array( result );
+
+   rng_isaac_fill_f64( rng, pa, rows*columns );
+
+   for ( i=0; i<rows*columns; i++ )
+   {
+      pa[i] = 2.0*pa[i] - 1.0;
+   }
+
+   rng_isaac_dispose( &rng );
+
+   return result;
+}
+
+/**
+   is_orthonormal_d
+
+   1 if the columns (or rows) of m are orthonormal to within precision
+*/
+
+int32_t
+is_orthonormal_d( d_matvec_t *m, int32_t is_columns, double precision )
+{
+   int32_t result = 1;
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+   int32_t rows = d_matvec_rows( m );
+   int32_t columns = d_matvec_columns( m );
+   int32_t count = ( is_columns == 1 ) ? columns : rows;
+   int32_t length = ( is_columns == 1 ) ? rows : columns;
+   double *pa = d_matvec_as_array( m );
+   double x = 0.0;
+   double dot = 0.0;
+
+   for ( i=0; i<count; i++ )
+   {
+      for ( j=0; j<count; j++ )
+      {
+         dot = 0.0;
+         for ( k=0; k<length; k++ )
+         {
+            if ( is_columns == 1 )
+            {
+               x = pa[ k*columns + j ];
+               dot = dot + pa[ k*columns + i ]*(x);
+            }
+            else
+            {
+               x = pa[ j*columns + k ];
+               dot = dot + pa[ i*columns + k ]*(x);
+            }
+         }
+
+         if ( cabs( dot - ( ( i == j ) ? 1.0 : 0.0 ) ) > precision )
+         {
+            result = 0;
+         }
+      }
+   }
+
+   return result;
+}
+
+/**
+   is_decreasing_d
+
+   1 if the items of v are not increasing
+*/
+
+int32_t
+is_decreasing_d( d_matvec_t *v )
+{
+   int32_t result = 1;
+   int32_t i = 0;
+   int32_t n = d_matvec_vector_length( v );
+   double *pa = d_matvec_as_array( v );
+
+   for ( i=1; i<n; i++ )
+   {
+      if ( cabs( pa[i] ) > cabs( pa[i-1] ) )
+      {
+         result = 0;
+      }
+   }
+
+   return result;
+}
+
+/**
+   is_same_directions_d
+
+   1 if the first count unit columns (or rows) of m and other are the same
+   up to a factor of magnitude one, to within precision
+*/
+
+int32_t
+is_same_directions_d( d_matvec_t *m, d_matvec_t *other, int32_t is_columns, int32_t count, double precision )
+{
+   int32_t result = 1;
+   int32_t i = 0;
+   int32_t k = 0;
+   int32_t columns = d_matvec_columns( m );
+   int32_t other_columns = d_matvec_columns( other );
+   int32_t length = ( is_columns == 1 ) ? d_matvec_rows( m ) : columns;
+   double *pa = d_matvec_as_array( m );
+   double *pa_other = d_matvec_as_array( other );
+   double x = 0.0;
+   double dot = 0.0;
+
+   for ( i=0; i<count; i++ )
+   {
+      dot = 0.0;
+      for ( k=0; k<length; k++ )
+      {
+         if ( is_columns == 1 )
+         {
+            x = pa_other[ k*other_columns + i ];
+            dot = dot + pa[ k*columns + i ]*(x);
+         }
+         else
+         {
+            x = pa_other[ i*other_columns + k ];
+            dot = dot + pa[ i*columns + k ]*(x);
+         }
+      }
+
+      if ( fabs( cabs( dot ) - 1.0 ) > precision )
+      {
+         result = 0;
+      }
+   }
+
+   return result;
+}
+
+/**
+   random_matrix_cd
+
+   matrix of pseudo random values in [-1, 1]
+*/
+
+cd_matvec_t *
+random_matrix_cd( int32_t rows, int32_t columns, uint32_t seed )
+{
+   cd_matvec_t *result = NULL;
+   double complex *pa = NULL;
+   double re = 0.0;
+   double im = 0.0;
+   int32_t i = 0;
+   rng_isaac_t *rng = rng_isaac_make_with_seed( seed );
+
+   result = cd_matvec_make( rows, columns );
+   pa = cd_matvec_as_array( result );
+
+   for ( i=0; i<rows*columns; i++ )
+   {
+      re = 2.0*rng_isaac_f64_item( rng ) - 1.0;
+      rng_isaac_forth( rng );
+      im = 2.0*rng_isaac_f64_item( rng ) - 1.0;
+      rng_isaac_forth( rng );
+      pa[i] = re + im*I;
+   }
+
+   rng_isaac_dispose( &rng );
+
+   return result;
+}
+
+/**
+   is_orthonormal_cd
+
+   1 if the columns (or rows) of m are orthonormal to within precision
+*/
+
+int32_t
+is_orthonormal_cd( cd_matvec_t *m, int32_t is_columns, double precision )
+{
+   int32_t result = 1;
+   int32_t i = 0;
+   int32_t j = 0;
+   int32_t k = 0;
+   int32_t rows = cd_matvec_rows( m );
+   int32_t columns = cd_matvec_columns( m );
+   int32_t count = ( is_columns == 1 ) ? columns : rows;
+   int32_t length = ( is_columns == 1 ) ? rows : columns;
+   double complex *pa = cd_matvec_as_array( m );
+   double complex x = 0.0;
+   double complex dot = 0.0;
+
+   for ( i=0; i<count; i++ )
+   {
+      for ( j=0; j<count; j++ )
+      {
+         dot = 0.0;
+         for ( k=0; k<length; k++ )
+         {
+            if ( is_columns == 1 )
+            {
+               x = pa[ k*columns + j ];
+               dot = dot + pa[ k*columns + i ]*conj(x);
+            }
+            else
+            {
+               x = pa[ j*columns + k ];
+               dot = dot + pa[ i*columns + k ]*conj(x);
+            }
+         }
+
+         if ( cabs( dot - ( ( i == j ) ? 1.0 : 0.0 ) ) > precision )
+         {
+            result = 0;
+         }
+      }
+   }
+
+   return result;
+}
+
+/**
+   is_decreasing_cd
+
+   1 if the items of v are not increasing
+*/
+
+int32_t
+is_decreasing_cd( cd_matvec_t *v )
+{
+   int32_t result = 1;
+   int32_t i = 0;
+   int32_t n = cd_matvec_vector_length( v );
+   double complex *pa = cd_matvec_as_array( v );
+
+   for ( i=1; i<n; i++ )
+   {
+      if ( cabs( pa[i] ) > cabs( pa[i-1] ) )
+      {
+         result = 0;
+      }
+   }
+
+   return result;
+}
+
+/**
+   is_same_directions_cd
+
+   1 if the first count unit columns (or rows) of m and other are the same
+   up to a factor of magnitude one, to within precision
+*/
+
+int32_t
+is_same_directions_cd( cd_matvec_t *m, cd_matvec_t *other, int32_t is_columns, int32_t count, double precision )
+{
+   int32_t result = 1;
+   int32_t i = 0;
+   int32_t k = 0;
+   int32_t columns = cd_matvec_columns( m );
+   int32_t other_columns = cd_matvec_columns( other );
+   int32_t length = ( is_columns == 1 ) ? cd_matvec_rows( m ) : columns;
+   double complex *pa = cd_matvec_as_array( m );
+   double complex *pa_other = cd_matvec_as_array( other );
+   double complex x = 0.0;
+   double complex dot = 0.0;
+
+   for ( i=0; i<count; i++ )
+   {
+      dot = 0.0;
+      for ( k=0; k<length; k++ )
+      {
+         if ( is_columns == 1 )
+         {
+            x = pa_other[ k*other_columns + i ];
+            dot = dot + pa[ k*columns + i ]*conj(x);
+         }
+         else
+         {
+            x = pa_other[ i*other_columns + k ];
+            dot = dot + pa[ i*columns + k ]*conj(x);
+         }
+      }
+
+      if ( fabs( cabs( dot ) - 1.0 ) > precision )
+      {
+         result = 0;
+      }
+   }
+
+   return result;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
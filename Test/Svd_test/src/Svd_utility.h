@@ -0,0 +1,59 @@
+/**
+ @file Svd_utility.h
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "utilities for testing Svd"
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+ 
+ Copyright 2018 Greg Lee
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0)
+ 
+ @section Description
+
+ Utilities for testing Svd_t.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "d_Matvec.h"
+#include "cd_Matvec.h"
+
+d_matvec_t *
+random_matrix_d( int32_t rows, int32_t columns, uint32_t seed );
+
+int32_t
+is_orthonormal_d( d_matvec_t *m, int32_t is_columns, double precision );
+
+int32_t
+is_decreasing_d( d_matvec_t *v );
+
+int32_t
+is_same_directions_d( d_matvec_t *m, d_matvec_t *other, int32_t is_columns, int32_t count, double precision );
+
+cd_matvec_t *
+random_matrix_cd( int32_t rows, int32_t columns, uint32_t seed );
+
+int32_t
+is_orthonormal_cd( cd_matvec_t *m, int32_t is_columns, double precision );
+
+int32_t
+is_decreasing_cd( cd_matvec_t *v );
+
+int32_t
+is_same_directions_cd( cd_matvec_t *m, cd_matvec_t *other, int32_t is_columns, int32_t count, double precision );
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
+
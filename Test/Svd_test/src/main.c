@@ -31,6 +31,12 @@ add_test_set_singular_value_threshold( void );
 int
 add_test_set_input( void );
 
+int
+add_test_set_truncation( void );
+
+int
+add_test_set_thread_count( void );
+
 int
 add_test_svd( void );
 
@@ -91,6 +97,8 @@ int main()
    add_test_set_rotation_error();
    add_test_set_singular_value_threshold();
    add_test_set_input();
+   add_test_set_truncation();
+   add_test_set_thread_count();
    add_test_svd();
    add_test_input();
    add_test_reconstructed_input();
@@ -131,6 +131,7 @@ typedef complex double complex128_t;
 #define MULTITHREAD_COND_DEFINITION_INIT( p )
 #define MULTITHREAD_COND_DESTROY( p )
 #define MULTITHREAD_COND_SIGNAL( p )
+#define MULTITHREAD_COND_BROADCAST( p )
 #define MULTITHREAD_COND_WAIT( p, q )
 #define LOCK( p )
 #define UNLOCK( p )
@@ -185,6 +186,9 @@ typedef complex double complex128_t;
 #undef MULTITHREAD_COND_SIGNAL
 #define MULTITHREAD_COND_SIGNAL( p ) pthread_cond_signal( &(p) )
 
+#undef MULTITHREAD_COND_BROADCAST
+#define MULTITHREAD_COND_BROADCAST( p ) pthread_cond_broadcast( &(p) )
+
 #undef MULTITHREAD_COND_WAIT
 #define MULTITHREAD_COND_WAIT( p, q ) pthread_cond_wait( &(p), &(q) )
 
@@ -83,6 +83,7 @@ extern "C" {
 
 #define HSET_TYPE                0xA5000300
 #define HTABLE_TYPE              0xA5000301
+#define HTABLE_FLAT_TYPE         0xA5000302
    
 // Sequence
 
@@ -115,6 +116,7 @@ extern "C" {
 #define TUPLE_TYPE               0xA5000705
 #define AGENT_TYPE               0xA5000704
 #define TIMED_AGENT_EXECUTOR_TYPE   0xA5000705
+#define BINARY_FILE_ASYNC_TYPE   0xA5000706
    
 // Deques
 
@@ -133,6 +135,8 @@ extern "C" {
 #define QSORTER_TYPE             0xA5000904
 #define SELSORTER_TYPE           0xA5000905
 #define SSORTER_TYPE             0xA5000906
+#define PSORTER_TYPE             0xA5000907
+#define RSORTER_TYPE             0xA5000908
    
 // Searchers
 
@@ -147,6 +151,11 @@ extern "C" {
 #define FFT_TYPE                 0xA5000B04
 #define SVD_TYPE                 0xA5000B05
 #define LSQLINE_TYPE             0xA5000B06
+#define MATVEC_LU_TYPE           0xA5000B07
+#define MATVEC_CHOLESKY_TYPE     0xA5000B08
+#define FFT_PLAN_TYPE            0xA5000B09
+#define STFT_TYPE                0xA5000B0A
+#define LSQLINE_MULTI_TYPE       0xA5000B0B
 
 // Date
 #define DATE_TIME_TYPE           0xA5000C00
@@ -0,0 +1,404 @@
+/**
+ @file pool.c
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "a pool of worker threads"
+
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0):
+
+ 1. Permission is hereby granted to use, copy, modify and/or
+    distribute this package, provided that:
+       * copyright notices are retained unchanged,
+       * any distribution of this package, whether modified or not,
+         includes this license text.
+ 2. Permission is hereby also granted to distribute binary programs
+    which depend on this package. If the binary program depends on a
+    modified version of this package, you are encouraged to publicly
+    release the modified version of this package.
+
+ THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT WARRANTY. ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE AUTHORS BE LIABLE TO ANY PARTY FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES ARISING IN ANY WAY OUT OF THE USE OF THIS PACKAGE.
+
+ @section Description
+
+ Function definitions for pool_t.
+
+ A worker takes the next job of a pool_run first and a task queued with
+ pool_submit otherwise, and runs it outside the lock. The caller of
+ pool_run takes jobs like a worker, so a pool_run with no workers, or with
+ workers busy on tasks, still finishes.
+
+*/
+
+/**
+   Includes
+*/
+
+#include "pool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+
+#include "dbc.h"
+
+/**
+   defines
+*/
+
+#define POOL_DEFAULT_TASK_CAPACITY 16
+
+/**
+   put_task
+
+   put a task at the end of the fifo, growing it if full. Called with the
+   mutex locked.
+
+   @param pool the pool
+   @param job the job function
+   @param arg the argument of the job
+   @param index the index of the job
+*/
+
+static
+void
+put_task
+(
+   pool_t *pool,
+   void (*job)( void *arg, int32_t index ),
+   void *arg,
+   int32_t index
+)
+{
+   int32_t i = 0;
+   pool_task_t *tasks = NULL;
+   pool_task_t *task = NULL;
+
+   if ( (*pool).task_count == (*pool).task_capacity )
+   {
+      // unwrap the fifo into a larger array
+      tasks = ( pool_task_t * ) calloc( 2 * (*pool).task_capacity, sizeof( pool_task_t ) );
+      CHECK( "tasks allocated correctly", tasks != NULL );
+
+      for ( i = 0; i < (*pool).task_count; i++ )
+      {
+         tasks[i] = (*pool).tasks[ ( (*pool).task_first + i ) % (*pool).task_capacity ];
+      }
+
+      free( (*pool).tasks );
+      (*pool).tasks = tasks;
+      (*pool).task_capacity = 2 * (*pool).task_capacity;
+      (*pool).task_first = 0;
+   }
+
+   task = &(*pool).tasks[ ( (*pool).task_first + (*pool).task_count ) % (*pool).task_capacity ];
+   (*task).job = job;
+   (*task).arg = arg;
+   (*task).index = index;
+
+   (*pool).task_count = (*pool).task_count + 1;
+
+   return;
+}
+
+/**
+   take_task
+
+   take the task at the start of the fifo. Called with the mutex locked.
+
+   @param pool the pool
+   @return the task
+*/
+
+static
+pool_task_t
+take_task( pool_t *pool )
+{
+   pool_task_t result = (*pool).tasks[ (*pool).task_first ];
+
+   (*pool).task_first = ( (*pool).task_first + 1 ) % (*pool).task_capacity;
+   (*pool).task_count = (*pool).task_count - 1;
+
+   return result;
+}
+
+#ifdef MULTITHREADED
+
+/**
+   worker
+
+   thread function of a pool worker, runs jobs until the pool quits and
+   the queued tasks are done
+
+   @param arg the pool
+*/
+
+static
+void *
+worker( void *arg )
+{
+   pool_t *pool = ( pool_t * ) arg;
+   void (*job)( void *arg, int32_t index ) = NULL;
+   void *job_arg = NULL;
+   int32_t index = 0;
+   pool_task_t task;
+
+   LOCK( (*pool).mutex );
+
+   while ( ( (*pool).quit == 0 ) || ( (*pool).task_count > 0 ) )
+   {
+      if ( (*pool).next_job < (*pool).job_count )
+      {
+         // take the next job and run it outside the lock
+         index = (*pool).next_job;
+         (*pool).next_job = (*pool).next_job + 1;
+         job = (*pool).job;
+         job_arg = (*pool).arg;
+
+         UNLOCK( (*pool).mutex );
+         job( job_arg, index );
+         LOCK( (*pool).mutex );
+
+         (*pool).jobs_done = (*pool).jobs_done + 1;
+
+         if ( (*pool).jobs_done == (*pool).job_count )
+         {
+            MULTITHREAD_COND_BROADCAST( (*pool).work_done );
+         }
+      }
+      else if ( (*pool).task_count > 0 )
+      {
+         // take the next task and run it outside the lock
+         task = take_task( pool );
+
+         UNLOCK( (*pool).mutex );
+         task.job( task.arg, task.index );
+         LOCK( (*pool).mutex );
+      }
+      else
+      {
+         MULTITHREAD_COND_WAIT( (*pool).work_ready, (*pool).mutex );
+      }
+   }
+
+   UNLOCK( (*pool).mutex );
+
+   return NULL;
+}
+
+#endif // MULTITHREADED
+
+/**
+   pool_start
+*/
+
+void
+pool_start( pool_t *pool, int32_t worker_count )
+{
+   PRECONDITION( "pool not null", pool != NULL );
+   PRECONDITION( "worker_count ok", worker_count >= 0 );
+
+   int32_t i = 0;
+
+   (*pool).worker_count = 0;
+   (*pool).job_count = 0;
+   (*pool).next_job = 0;
+   (*pool).jobs_done = 0;
+   (*pool).task_first = 0;
+   (*pool).task_count = 0;
+   (*pool).quit = 0;
+
+   (*pool).tasks = ( pool_task_t * ) calloc( POOL_DEFAULT_TASK_CAPACITY, sizeof( pool_task_t ) );
+   CHECK( "tasks allocated correctly", (*pool).tasks != NULL );
+   (*pool).task_capacity = POOL_DEFAULT_TASK_CAPACITY;
+
+#ifdef MULTITHREADED
+
+   MULTITHREAD_MUTEX_INIT( (*pool).mutex );
+   MULTITHREAD_COND_INIT( (*pool).work_ready );
+   MULTITHREAD_COND_INIT( (*pool).work_done );
+
+   (*pool).workers = NULL;
+
+   if ( worker_count > 0 )
+   {
+      (*pool).workers = calloc( worker_count, sizeof( *(*pool).workers ) );
+      CHECK( "workers allocated correctly", (*pool).workers != NULL );
+
+      for ( i = 0; i < worker_count; i++ )
+      {
+         MULTITHREAD_THREAD_CREATE( &(*pool).workers[i], NULL, worker, pool );
+      }
+
+      (*pool).worker_count = worker_count;
+   }
+
+#endif // MULTITHREADED
+
+   return;
+}
+
+/**
+   pool_stop
+*/
+
+void
+pool_stop( pool_t *pool )
+{
+   PRECONDITION( "pool not null", pool != NULL );
+
+   int32_t i = 0;
+
+#ifdef MULTITHREADED
+
+   LOCK( (*pool).mutex );
+   (*pool).quit = 1;
+   MULTITHREAD_COND_BROADCAST( (*pool).work_ready );
+   UNLOCK( (*pool).mutex );
+
+   for ( i = 0; i < (*pool).worker_count; i++ )
+   {
+      MULTITHREAD_THREAD_JOIN( (*pool).workers[i], NULL );
+   }
+
+   free( (*pool).workers );
+   (*pool).workers = NULL;
+
+   MULTITHREAD_COND_DESTROY( (*pool).work_ready );
+   MULTITHREAD_COND_DESTROY( (*pool).work_done );
+   MULTITHREAD_MUTEX_DESTROY( (*pool).mutex );
+
+#endif // MULTITHREADED
+
+   free( (*pool).tasks );
+   (*pool).tasks = NULL;
+   (*pool).task_capacity = 0;
+   (*pool).task_count = 0;
+
+   (*pool).worker_count = 0;
+
+   return;
+}
+
+/**
+   pool_run
+*/
+
+void
+pool_run
+(
+   pool_t *pool,
+   void (*job)( void *arg, int32_t index ),
+   void *arg,
+   int32_t job_count
+)
+{
+   PRECONDITION( "pool not null", pool != NULL );
+   PRECONDITION( "job not null", job != NULL );
+   PRECONDITION( "job_count ok", job_count >= 0 );
+
+   int32_t index = 0;
+
+   if ( ( (*pool).worker_count == 0 ) || ( job_count < 2 ) )
+   {
+      // nothing to share
+      for ( index = 0; index < job_count; index++ )
+      {
+         job( arg, index );
+      }
+   }
+   else
+   {
+#ifdef MULTITHREADED
+
+      LOCK( (*pool).mutex );
+
+      (*pool).job = job;
+      (*pool).arg = arg;
+      (*pool).job_count = job_count;
+      (*pool).next_job = 0;
+      (*pool).jobs_done = 0;
+
+      MULTITHREAD_COND_BROADCAST( (*pool).work_ready );
+
+      // the caller takes jobs like a worker
+      while ( (*pool).next_job < job_count )
+      {
+         index = (*pool).next_job;
+         (*pool).next_job = (*pool).next_job + 1;
+
+         UNLOCK( (*pool).mutex );
+         job( arg, index );
+         LOCK( (*pool).mutex );
+
+         (*pool).jobs_done = (*pool).jobs_done + 1;
+      }
+
+      while ( (*pool).jobs_done < job_count )
+      {
+         MULTITHREAD_COND_WAIT( (*pool).work_done, (*pool).mutex );
+      }
+
+      UNLOCK( (*pool).mutex );
+
+#endif // MULTITHREADED
+   }
+
+   return;
+}
+
+/**
+   pool_submit
+*/
+
+void
+pool_submit
+(
+   pool_t *pool,
+   void (*job)( void *arg, int32_t index ),
+   void *arg,
+   int32_t index
+)
+{
+   PRECONDITION( "pool not null", pool != NULL );
+   PRECONDITION( "job not null", job != NULL );
+
+   if ( (*pool).worker_count == 0 )
+   {
+      // no workers, so run the job here
+      job( arg, index );
+   }
+   else
+   {
+#ifdef MULTITHREADED
+
+      LOCK( (*pool).mutex );
+
+      put_task( pool, job, arg, index );
+      MULTITHREAD_COND_SIGNAL( (*pool).work_ready );
+
+      UNLOCK( (*pool).mutex );
+
+#endif // MULTITHREADED
+   }
+
+   return;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* End of file */
@@ -0,0 +1,189 @@
+/**
+ @file pool.h
+ @author Greg Lee
+ @version 2.0.0
+ @brief: "include file for a pool of worker threads"
+
+ @date: "$Mon Jan 01 15:18:30 PST 2018 @12 /Internet Time/$"
+
+ @section License
+
+ Copyright 2018 Greg Lee
+
+ Licensed under the Eiffel Forum License, Version 2 (EFL-2.0):
+
+ 1. Permission is hereby granted to use, copy, modify and/or
+    distribute this package, provided that:
+       * copyright notices are retained unchanged,
+       * any distribution of this package, whether modified or not,
+         includes this license text.
+ 2. Permission is hereby also granted to distribute binary programs
+    which depend on this package. If the binary program depends on a
+    modified version of this package, you are encouraged to publicly
+    release the modified version of this package.
+
+ THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT WARRANTY. ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE AUTHORS BE LIABLE TO ANY PARTY FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ DAMAGES ARISING IN ANY WAY OUT OF THE USE OF THIS PACKAGE.
+
+ @section Description
+
+ Declarations for pool_t, the worker threads shared by the containers
+ that split their work among threads.
+
+ A pool_t is embedded in the structure of its owner and is started and
+ stopped by the owner. Work is handed to it in two ways. pool_run runs
+ job( arg, i ) for each i below job_count on the workers and the calling
+ thread and returns when all are done; it is for the parallel steps of
+ Matvec, PSorter, Svd and Stft. pool_submit queues a single job( arg,
+ index ) and returns at once; it is for owners like Binary_File_async and
+ Input_File_Reader whose workers run ahead of the caller, and which wait
+ for the results with their own mutex and condition variables.
+
+ Without MULTITHREADED a pool has no workers, pool_run runs the jobs in
+ order on the calling thread and pool_submit runs the job before it
+ returns.
+
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef POOL_H
+#define POOL_H
+
+/**
+   Includes
+*/
+
+#include "base.h"
+
+#ifdef MULTITHREADED
+#include MULTITHREAD_INCLUDE
+#endif
+
+/**
+   pool_task_t - a job queued with pool_submit
+*/
+
+typedef struct
+{
+   void (*job)( void *arg, int32_t index );
+   void *arg;
+   int32_t index;
+} pool_task_t;
+
+/**
+   pool_t
+
+   worker threads and the jobs waiting for them. The jobs of pool_run are
+   counted off from next_job, the jobs of pool_submit wait in a fifo of
+   tasks.
+*/
+
+typedef struct
+{
+   int32_t worker_count;
+
+   // the jobs of the current pool_run
+   void (*job)( void *arg, int32_t index );
+   void *arg;
+   int32_t job_count;
+   int32_t next_job;
+   int32_t jobs_done;
+
+   // the jobs of pool_submit not yet taken
+   pool_task_t *tasks;
+   int32_t task_capacity;
+   int32_t task_first;
+   int32_t task_count;
+
+   int32_t quit;
+
+   MULTITHREAD_THREAD_DEFINITION( *workers );
+   MULTITHREAD_MUTEX_DEFINITION( mutex );
+   MULTITHREAD_COND_DEFINITION( work_ready );
+   MULTITHREAD_COND_DEFINITION( work_done );
+} pool_t;
+
+/**
+   Function prototypes
+*/
+
+/**
+   pool_start
+
+   start worker_count worker threads. A caller of pool_run also runs jobs,
+   so an owner with thread_count threads starts thread_count - 1 workers.
+
+   @param pool the pool
+   @param worker_count the number of worker threads, may be 0
+*/
+void
+pool_start( pool_t *pool, int32_t worker_count );
+
+/**
+   pool_stop
+
+   run the jobs queued with pool_submit to their end, then stop and join
+   the worker threads
+
+   @param pool the pool
+*/
+void
+pool_stop( pool_t *pool );
+
+/**
+   pool_run
+
+   run job( arg, i ) for i from 0 to job_count - 1 on the workers and the
+   calling thread, return when all jobs are done. Only one thread at a
+   time may call pool_run on a pool.
+
+   @param pool the pool
+   @param job the job function
+   @param arg the argument shared by all jobs
+   @param job_count the number of jobs
+*/
+void
+pool_run
+(
+   pool_t *pool,
+   void (*job)( void *arg, int32_t index ),
+   void *arg,
+   int32_t job_count
+);
+
+/**
+   pool_submit
+
+   queue job( arg, index ) to be run by the next free worker and return.
+   The jobs are started in the order they are queued. With no workers the
+   job is run before pool_submit returns.
+
+   @param pool the pool
+   @param job the job function
+   @param arg the argument of the job
+   @param index the index of the job
+*/
+void
+pool_submit
+(
+   pool_t *pool,
+   void (*job)( void *arg, int32_t index ),
+   void *arg,
+   int32_t index
+);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POOL_H */
+
+/* End of file */